@@ -0,0 +1,376 @@
+/*****************************************************************************
+ *
+ * basic_process.hh
+ *
+ * Processes and schedulers bound to a sequencing set of a given type
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#ifndef CPPSIM_BASIC_PROCESS_HH
+#define CPPSIM_BASIC_PROCESS_HH
+
+#include <cassert>
+#include <utility>
+#include "process.hh"
+#include "sqs.hh"
+#include "simulation.hh"
+
+//
+// A process calls the sqs at each hold( ), and the scheduler at each
+// event; as the sqs is only known as an sqs*, all these calls are
+// virtual, and cannot be inlined. When the type of the sqs is known at
+// compile time, the simulation can be written with the classes below,
+// which take it as the template parameter Queue (one of sqsDll,
+// sqsPrio, sqsCal, sqsHeap, sqsLadder, sqsWheel, sqsAdaptive, or a class
+// derived from them): their operations are final, so the calls are
+// direct.
+//
+//     class job : public basic_process< sqsHeap > {
+//     public:
+//         job( void ) : basic_process< sqsHeap >( "job" ) { };
+//     protected:
+//         void inner_body( void ) { ... hold( 1.0 ); ... };
+//     };
+//
+//     basic_simulation< sqsHeap >::begin_simulation( );
+//     handle< job > j( new job( ) );
+//     j->activate( );
+//     basic_simulation< sqsHeap >::run( );
+//     basic_simulation< sqsHeap >::end_simulation( );
+//
+// The operations of process itself are the same ones, with the type
+// sqs, so the two kinds of processes can be mixed, and a
+// basic_process< Queue > can be handled through a handle_p. However,
+// the processes derived from basic_process< Queue > must only be
+// created while the current sqs is a Queue.
+//
+
+//
+// The scheduler of a sqs of type Queue
+//
+template< class Queue >
+class basic_sqs : public Queue {
+public:
+    template< class... Args >
+    basic_sqs( Args&&... args ) : Queue( std::forward< Args >( args )... ) { };
+protected:
+    void main( void ) { sqs::run( this ); };
+};
+
+template< class Queue >
+class basic_process : public process {
+public:
+
+    // A stackSize of 0 means coroutine::cStackSize
+    basic_process( const string& name, size_t stackSize = 0 ) :
+        process( name, stackSize )
+    {
+        assert( 0 != dynamic_cast< Queue* >( process::getSqs( ) ) );
+    };
+
+    Queue* getSqs( void ) const
+    {
+        return static_cast< Queue* >( process::getSqs( ) );
+    };
+
+    static Queue* currentSqs( void )
+    {
+        return static_cast< Queue* >( simulation::instance( )->getSqs( ) );
+    };
+
+    //
+    // Modifiers
+    //
+    void activate( void )               { process::activate( getSqs( ) ); };
+    void activateAfter( handle_p& q )   { process::activateAfter( getSqs( ), q ); };
+    void activateBefore( handle_p& q )  { process::activateBefore( getSqs( ), q ); };
+    void activateAt( simtime_arg t )    { process::activateAt( getSqs( ), t ); };
+    void activateDelay( simtime_arg dt = 0 ) { process::activateDelay( getSqs( ), dt ); };
+
+    void reactivate( void )             { process::reactivate( getSqs( ) ); };
+    void reactivateAfter( handle_p& q ) { process::reactivateAfter( getSqs( ), q ); };
+    void reactivateBefore( handle_p& q ) { process::reactivateBefore( getSqs( ), q ); };
+    void reactivateAt( simtime_arg t )  { process::reactivateAt( getSqs( ), t ); };
+    void reactivateDelay( simtime_arg dt = 0 ) { process::reactivateDelay( getSqs( ), dt ); };
+
+    void cancel( void )                 { process::cancel( getSqs( ) ); };
+
+    template< class It > static void activateAll( It first, It last, simtime_arg t )
+    {
+        process::activateAll( currentSqs( ), first, last, t );
+    };
+    template< class It > static void activateAll( It first, It last )
+    {
+        process::activateAll( currentSqs( ), first, last, process::time( currentSqs( ) ) );
+    };
+
+protected:
+
+    void hold( simtime_arg dt )
+    {
+        process::prepareHold( getSqs( ), dt );
+        process::suspend( getSqs( ) );
+    };
+    void passivate( void )
+    {
+        process::preparePassivate( getSqs( ) );
+        process::suspend( getSqs( ) );
+    };
+    void prepareHold( simtime_t dt )    { process::prepareHold( getSqs( ), dt ); };
+    void preparePassivate( void )       { process::preparePassivate( getSqs( ) ); };
+
+    simtime_t time( void ) const        { return process::time( getSqs( ) ); };
+};
+
+//
+// Begins and runs simulations on a sqs of type Queue (see simulation)
+//
+template< class Queue >
+class basic_simulation {
+public:
+    template< class... Args >
+    static Queue* begin_simulation( Args&&... args )
+    {
+        Queue* s = new basic_sqs< Queue >( std::forward< Args >( args )... );
+        simulation::instance( )->begin_simulation( s );
+        return s;
+    };
+
+    static void run( void )             { simulation::instance( )->run( ); };
+    static void end_simulation( void )  { simulation::instance( )->end_simulation( ); };
+
+    static Queue* getSqs( void )
+    {
+        return static_cast< Queue* >( simulation::instance( )->getSqs( ) );
+    };
+};
+
+//
+// The operations of process, on the sqs s of type Q
+//
+
+template< class Q > void process::activate( Q* s )
+{
+    simtime_t now = time( s );
+    if ( idle( ) ) {
+        message( current(), "Act %s [%d] now\n", name().c_str(), id() );
+        s->insertAt( this, now );
+    }
+}
+
+template< class Q > void process::activateAt( Q* s, simtime_t t )
+{
+    simtime_t now = time( s );
+    assert( t >= now );
+    if ( idle( ) ) {
+        message( current(), "Act %s [%d] at " SIMTIME_FMT "\n", name().c_str(), id(), t );
+        s->insertAt( this, t );
+    }
+}
+
+template< class Q > void process::activateBefore( Q* s, handle_p& q )
+{
+    if ( idle( ) ) {
+        message( current(), "Act %s [%d] before %s [%d] at " SIMTIME_FMT "\n",
+                 name().c_str(), id(), q->name().c_str(), q->id(), q->evTime() );
+        s->insert( this, q, pos_before );
+    }
+}
+
+template< class Q > void process::activateAfter( Q* s, handle_p& q )
+{
+    if ( idle( ) ) {
+        message( current(), "Act %s [%d] after %s [%d] at " SIMTIME_FMT "\n",
+                 name().c_str(), id(), q->name().c_str(), q->id(), q->evTime() );
+        s->insert( this, q, pos_after );
+    }
+}
+
+template< class Q > void process::activateDelay( Q* s, simtime_t dt )
+{
+    simtime_t now = time( s );
+    if ( idle( ) ) {
+        message( current(), "Act %s [%d] delay " SIMTIME_FMT "\n",
+                 name().c_str(), id(), dt );
+        s->insertAt( this, now + dt );
+    }
+}
+
+template< class Q > void process::reactivate( Q* s )
+{
+    message( current(), "React %s [%d] now\n", name().c_str(), id() );
+    simtime_t now = time( s );
+    if ( idle( ) )
+        s->insertAt( this, now );
+    else
+        s->reschedule( &_ev, now );
+}
+
+template< class Q > void process::reactivateAt( Q* s, simtime_t t )
+{
+    message( current(), "React %s [%d] at " SIMTIME_FMT "\n",
+             name().c_str(), id(), t );
+    if ( idle( ) )
+        s->insertAt( this, t );
+    else
+        s->reschedule( &_ev, t );
+}
+
+template< class Q > void process::reactivateAfter( Q* s, handle_p& q )
+{
+    message( current(), "React %s [%d] after %s [%d] at " SIMTIME_FMT "\n",
+             name().c_str(), id(), q->name().c_str(), q->id(), q->evTime() );
+    if ( !idle( ) )
+        s->remove( &_ev );
+    s->insert( this, q, pos_after );
+}
+
+template< class Q > void process::reactivateBefore( Q* s, handle_p& q )
+{
+    message( current(), "Act %s [%d] before %s [%d] at " SIMTIME_FMT "\n",
+             name().c_str(), id(), q->name().c_str(), q->id(), q->evTime() );
+    if ( !idle( ) )
+        s->remove( &_ev );
+    s->insert( this, q, pos_before );
+}
+
+template< class Q > void process::reactivateDelay( Q* s, simtime_t dt )
+{
+    message( current(), "React %s [%d] delay " SIMTIME_FMT "\n",
+             name().c_str(), id(), dt );
+    simtime_t now = time( s );
+    if ( idle( ) )
+        s->insertAt( this, now + dt );
+    else
+        s->reschedule( &_ev, now + dt );
+}
+
+template< class Q > void process::cancel( Q* s )
+{
+    message( current(), "Canc %s [%d]\n", name().c_str(), id() );
+    if ( idle( ) )
+        return;
+
+    handle_p cur = current( );
+    s->remove( &_ev );
+    if ( s->empty( ) )
+        suspend( s );
+    else
+        if ( s->first( )->proc( ) != cur.rep( ) )
+            suspend( s );
+}
+
+//
+// Reschedules the current process at time "now + dt", without giving
+// control back to the scheduler. The event notice is moved in place.
+//
+template< class Q > void process::prepareHold( Q* s, simtime_t dt )
+{
+    simtime_t now = time( s );
+
+    assert( this == current( ).rep( ) );
+    assert( !idle( ) );
+
+    message( this, "Hold " SIMTIME_FMT " until " SIMTIME_FMT "\n", dt, evTime()+dt );
+
+    s->reschedule( &_ev, now + dt );
+}
+
+//
+// Removes the event notice of the current process, without giving
+// control back to the scheduler.
+//
+template< class Q > void process::preparePassivate( Q* s )
+{
+    assert( this == current( ).rep( ) );
+    assert( !idle( ) );
+
+    message( this, "Pass\n" );
+
+    if ( s->hibernation( ) )
+        s->idleInsert( this, _ev.evTime( ) );
+
+    s->remove( &_ev );
+}
+
+template< class Q, class It >
+void process::activateAll( Q* s, It first, It last, simtime_t t )
+{
+    assert( t >= time( s ) );
+    for ( ; first != last; ++first ) {
+        process* p = *first;
+        if ( p->idle( ) )
+            _batch.push_back( p );
+    }
+    if ( _batch.empty( ) )
+        return;
+    message( s->current( ), "Act %u processes at " SIMTIME_FMT "\n",
+             (unsigned int)_batch.size( ), t );
+    s->insertBatch( &_batch[ 0 ], _batch.size( ), t );
+    _batch.clear( );
+}
+
+template< class It > void process::activateAll( It first, It last, simtime_arg t )
+{
+    activateAll( simulation::instance( )->getSqs( ), first, last, t );
+}
+
+template< class It > void process::activateAll( It first, It last )
+{
+    sqs* s = simulation::instance( )->getSqs( );
+    activateAll( s, first, last, time( s ) );
+}
+
+template< class Q > simtime_t process::time( Q* s )
+{
+    return ( s->empty( ) ? 0 : s->current( )->evTime( ) );
+}
+
+//
+// Gives up control after the current process has rescheduled (or
+// descheduled) itself. Normally the process detaches, and the
+// scheduler resumes the owner of the first event notice; if direct
+// transfer is enabled, or if batching is and that notice belongs to
+// the current instant (see sqs::setBatching), the process is resumed
+// here instead, saving a context switch. If the first event notice
+// is still ours, there is no switch at all. With neither option,
+// the sqs is not looked at here.
+//
+template< class Q > void process::suspend( Q* s )
+{
+    if ( ( s->directTransfer( ) || s->batching( ) ) && !s->empty( ) ) {
+        absEvNotice* ev = s->first( );
+        if ( !s->directTransfer( ) && ev->evTime( ) != s->instant( ) ) {
+            detach( );
+            return;
+        }
+        process* next = ev->proc( );
+        if ( next == this ) {
+            sqs::transfer( s, next );
+            return;
+        }
+        if ( !next->stackless( ) ) {
+            sqs::transfer( s, next );
+            next->resume( );
+            return;
+        }
+    }
+    detach( );
+}
+
+#endif
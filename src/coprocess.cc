@@ -0,0 +1,100 @@
+/*****************************************************************************
+ *
+ * coprocess.cc
+ *
+ * Stackless processes, whose body is a C++20 coroutine
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cassert>
+#include "coprocess.hh"
+#include "sqs.hh"
+
+#if defined( __cpp_impl_coroutine )
+
+coprocess::coprocess( const string& name ) :
+    process     ( name ),
+    _body       ( 0 )
+{
+
+}
+
+coprocess::~coprocess( )
+{
+    if ( _body )
+        _body.destroy( );
+}
+
+//
+// The body of the coroutine is created the first time the process is
+// scheduled, as the initial suspension point does not run any code of
+// co_body( ). The scheduling operation requested by the body (hold,
+// passivate, ...) has already been performed when resume( ) returns;
+// if the body reached its end, the process terminates.
+//
+void coprocess::dispatch( void )
+{
+    if ( !_body )
+        _body = co_body( ).release( );
+
+    _body.resume( );
+
+    if ( _body.done( ) ) {
+        _body.destroy( );
+        _body = 0;
+        finish( );
+    }
+}
+
+void coprocess::recycle( void )
+{
+    if ( _body ) {
+        _body.destroy( );
+        _body = 0;
+    }
+    process::recycle( );
+}
+
+//
+// Never called, as coprocesses are not run as ordinary coroutines
+//
+void coprocess::inner_body( void )
+{
+    assert( false );
+}
+
+void coprocess::awaiter::await_suspend( std::coroutine_handle<> )
+{
+    switch ( _op ) {
+    case op_hold:
+        _p->prepareHold( _dt );
+        break;
+    case op_passivate:
+        _p->preparePassivate( );
+        break;
+    case op_end:
+        _p->getSqs( )->clear( );
+        break;
+    }
+}
+
+#endif // __cpp_impl_coroutine
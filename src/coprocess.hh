@@ -0,0 +1,134 @@
+/*****************************************************************************
+ *
+ * coprocess.hh
+ *
+ * Stackless processes, whose body is a C++20 coroutine
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#ifndef CPPSIM_COPROCESS_HH
+#define CPPSIM_COPROCESS_HH
+
+#include "process.hh"
+
+#if defined( __cpp_impl_coroutine )
+
+#include <coroutine>
+#include <exception>
+
+//
+// A coprocess is a process whose body is a C++20 coroutine, which is
+// run on the stack of the scheduler. Suspending a coprocess only
+// keeps its coroutine frame alive, which is usually a few tens of
+// bytes, instead of a whole coroutine stack.
+//
+// The body is defined by co_body( ) instead of inner_body( ), and
+// the operations which suspend the process must be awaited:
+//
+//     coprocess::task job::co_body( void )
+//     {
+//         co_await hold( 10.0 );
+//         co_await passivate( );
+//     }
+//
+// All other operations (activate*, reactivate*, cancel of other
+// processes, ...) are the same as for ordinary processes, and
+// coprocesses and processes can be freely mixed in a simulation.
+// As for processes, a coprocess stays alive while it has an event
+// notice or while some handle references it; destroying a suspended
+// coprocess destroys its coroutine frame, with all its local objects.
+//
+class coprocess : public process {
+public:
+
+    //
+    // Return type of co_body( )
+    //
+    class task {
+    public:
+        struct promise_type {
+            task get_return_object( void )
+            {
+                return task( std::coroutine_handle<promise_type>::from_promise( *this ) );
+            };
+            std::suspend_always initial_suspend( void ) noexcept { return { }; };
+            std::suspend_always final_suspend( void ) noexcept { return { }; };
+            void return_void( void ) { };
+            void unhandled_exception( void ) { std::terminate( ); };
+        };
+
+        explicit task( std::coroutine_handle<promise_type> h ) : _h( h ) { };
+        std::coroutine_handle<promise_type> release( void )
+        {
+            std::coroutine_handle<promise_type> h = _h;
+            _h = 0;
+            return h;
+        };
+        task( task&& other ) : _h( other.release( ) ) { };
+        ~task( ) { if ( _h ) _h.destroy( ); };
+    private:
+        task( const task& );
+        task& operator=( const task& );
+        std::coroutine_handle<promise_type> _h;
+    };
+
+    coprocess( const string& name );
+    virtual ~coprocess( );
+
+    void dispatch( void );
+    bool stackless( void ) const { return true; };
+
+protected:
+
+    //
+    // Awaitable operations. The scheduling operation is performed when
+    // the coroutine suspends, and the scheduler regains control.
+    //
+    class [[nodiscard]] awaiter {
+    public:
+        enum op_t { op_hold, op_passivate, op_end };
+
+        awaiter( coprocess* p, op_t op, simtime_t dt = 0 ) :
+            _p( p ), _op( op ), _dt( dt ) { };
+        bool await_ready( void ) const noexcept { return false; };
+        void await_suspend( std::coroutine_handle<> );
+        void await_resume( void ) const noexcept { };
+    private:
+        coprocess*      _p;
+        op_t            _op;
+        simtime_t       _dt;
+    };
+
+    awaiter hold( simtime_arg dt )      { return awaiter( this, awaiter::op_hold, dt ); };
+    awaiter passivate( void )           { return awaiter( this, awaiter::op_passivate ); };
+    awaiter end_simulation( void )      { return awaiter( this, awaiter::op_end ); };
+
+    // The body of the coprocess
+    virtual task co_body( void ) = 0;
+
+    void recycle( void );
+
+private:
+    void inner_body( void );
+
+    std::coroutine_handle<task::promise_type> _body;
+};
+
+#endif // __cpp_impl_coroutine
+
+#endif
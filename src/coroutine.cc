@@ -35,6 +35,7 @@
 #include "config.h"
 #endif
 #include "coroutine.hh"
+#include "profiler.hh"
 #include <iostream>
 #include <cstdlib>
 #include <cassert>
@@ -45,81 +46,732 @@ extern "C" {
 using namespace std;
 
 size_t coroutine::cStackSize = 16*(size_t)sysconf( _SC_PAGESIZE );
+bool coroutine::cStackPaint = false;
+bool coroutine::cSharedStack = false;
+size_t coroutine::cSharedStackSize = 256*(size_t)sysconf( _SC_PAGESIZE );
 unsigned long coroutine::_num_ctx_switch = 0;
 
+#if COROUTINE_METHOD == COROUTINE_MCSC || COROUTINE_METHOD == COROUTINE_ASM
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Part common to the switching methods in which each coroutine has
+// its own stack
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <string>
+#include "stackPool.hh"
+
+coroutine* coroutine::_zombie = 0;
+coroutine* coroutine::_sharedOwner = 0;
+
+/*
+ * Stack usage tracking. When cStackPaint is set, each stack is filled
+ * with a known pattern when it is handed to a coroutine; the high-water
+ * mark is then the distance between the top of the stack and the
+ * lowest byte which has been overwritten. The class of each painted
+ * coroutine is recorded when it is armed, as its dynamic type is no
+ * longer available when the stack is released by the destructor.
+ * These structures are never deleted, as coroutines may still be
+ * destroyed after the static objects of this file.
+ */
+#define STACK_PAINT     0xA5
+
+struct stackUsage_t {
+    const type_info*    type;
+    unsigned long       count;          // Num. of stacks measured
+    size_t              stackSize;      // Largest stack size
+    size_t              maxUsed;        // High-water mark
+};
+typedef map< string, stackUsage_t > stackUsageMap_t;
+typedef map< coroutine*, const type_info* > paintedMap_t;
+
+static stackUsageMap_t* stackUsage = 0;         // By mangled class name
+static paintedMap_t* painted = 0;               // Live painted coroutines
+
+/*
+ * Hibernation statistics
+ */
+static unsigned long    hibernations = 0;
+static unsigned long    restores = 0;
+static size_t           hibernated_bytes = 0;
+static size_t           saved_bytes = 0;    // All saved stack buffers
+static double           restore_time = 0.0;     // Total, in seconds
+static double           max_restore_time = 0.0;
+
+/*
+ * The used part of a stack is saved in a buffer from the stack pool,
+ * which starts with its own size and the number of bytes in use; this
+ * keeps the sizes out of the coroutines which have nothing saved.
+ */
+struct coroutine::savedStack {
+    size_t      capacity;               // Bytes after the header
+    size_t      size;                   // Bytes saved
+    char* data( void ) { return (char*)( this + 1 ); };
+};
+
+static void updateStackUsage( stackUsageMap_t& m, const type_info* t, size_t size, size_t used )
+{
+    stackUsage_t& u( m[ t->name( ) ] );
+    u.type = t;
+    u.count++;
+    if ( size > u.stackSize )
+        u.stackSize = size;
+    if ( used > u.maxUsed )
+        u.maxUsed = used;
+}
+
+#if COROUTINE_METHOD == COROUTINE_MCSC
+
+/*
+ * Context of the main coroutine. The main coroutine runs on the
+ * process stack, so it does not need a stack from the pool.
+ */
+static ucontext_t main_context;
+#define MAIN_CONTEXT    &main_context
+
+#else
+
+#define MAIN_CONTEXT    0
+
+#endif
+
 /*
  * This is the main coroutine. 
  */
 class main_coroutine : public coroutine {
 public:
-    main_coroutine( void ) : coroutine( ) { };
-    virtual ~main_coroutine( ) { };
+    main_coroutine( void ) : coroutine( ) { _context = MAIN_CONTEXT; _shared = false; };
+    virtual ~main_coroutine( ) { _context = 0; };
 protected:
     void main( void ) { };
 } main_component;
 
 coroutine* coroutine::_current_coroutine = &main_component;
 
-#if COROUTINE_METHOD == mcsc
-
-//////////////////////////////////////////////////////////////////////////////
-//
-// Part specific for the makecontext/swapcontext based switching method
-//
-//////////////////////////////////////////////////////////////////////////////
+/*
+ * A coroutine cannot give back its own stack while it is still
+ * running on it. When its main() returns, the coroutine is recorded
+ * as a "zombie", and its stack is released by the next coroutine
+ * which gets control, as soon as the context switch completes.
+ */
+void coroutine::releaseZombie( void )
+{
+    if ( 0 != _zombie ) {
+        _zombie->releaseStack( );
+        _zombie = 0;
+    }
+}
 
 /*
- * Function used by makecontext as a "trampoline" to call the main method of 
- * a coroutine.
+ * Function used as a "trampoline" to call the main method of a
+ * coroutine.
  */
 void cor_trampoline( coroutine* c )
 {
+    if ( __builtin_expect( profiler::cEnabled, 0 ) )
+        profiler::instance( )->arrive( );
+    coroutine::releaseZombie( );
     c->main( );
-    c->_cor_terminated = true;
+    c->markTerminated( );
+    coroutine::_zombie = c;
     c->detach();
 }
 
-coroutine::coroutine( ) :
-    _context    ( new ucontext_t ),
+//
+// The stack and the context are not allocated until the coroutine is
+// entered for the first time, so that processes which are created but
+// never activated do not use any stack space.
+//
+coroutine::coroutine( size_t stackSize ) :
+    _context    ( 0 ),
+    _stack      ( 0 ),
+    _saved      ( 0 ),
+    _stackSize  ( 0 == stackSize ? cStackSize : stackSize ),
+    _shared     ( cSharedStack ),
     _cor_terminated( false ),
     _caller     ( 0 ),
     _callee     ( 0 )
 {
+    // _stackSize is 32 bits wide, to keep coroutines small
+    if ( _stackSize != ( 0 == stackSize ? cStackSize : stackSize ) ) {
+        cerr << "FATAL: Stack size too large" << endl;
+        abort( );
+    }
+}
+
+coroutine::~coroutine( )
+{
+    if ( 0 != _context )
+        releaseStack( );
+    assert( 0 == _caller );
+    assert( 0 == _callee );
+}
+
+//
+// Takes a stack from the pool, and builds the initial context of the
+// coroutine on it.
+//
+void coroutine::arm( void )
+{
+    assert( 0 == _stack );
+    _stack = stackPool::instance( )->acquire( _stackSize );
+    if ( cStackPaint ) {
+        if ( 0 == painted )
+            painted = new paintedMap_t( );
+        memset( _stack, STACK_PAINT, _stackSize );
+        (*painted)[ this ] = &typeid( *this );
+    }
+    makeContext( _stack, _stackSize );
+}
+
+//
+// Must be called before the coroutine is entered for the first time
+//
+void coroutine::ownStack( void )
+{
+    assert( 0 == _context );
+    _shared = false;
+}
+
+//
+// Gives back the stack (if any), so that the coroutine starts again
+// from the beginning of main( ) the next time it is entered. Used to
+// recycle coroutine objects; the coroutine must not be running.
+//
+void coroutine::reset( void )
+{
+    assert( this != _current_coroutine );
+    assert( 0 == _caller );
+    assert( 0 == _callee );
+    if ( this == _zombie )
+        _zombie = 0;
+    if ( 0 != _context )
+        releaseStack( );
+    _cor_terminated = false;
+}
+
+void coroutine::releaseStack( void )
+{
+    if ( _shared ) {
+        if ( this == _sharedOwner )
+            _sharedOwner = 0;
+        if ( 0 != _saved )
+            freeSaved( _saved );
+        _saved = 0;
+        _context = 0;
+        return;
+    }
+    assert( 0 != _stack );
+    if ( 0 != _saved ) {
+        hibernated_bytes -= _saved->size;
+        freeSaved( _saved );
+        _saved = 0;
+    }
+    recordStackUsage( );
+    stackPool::instance( )->release( _stack, _stackSize );
+    _stack = 0;
+    _context = 0;
+}
+
+coroutine::savedStack* coroutine::saveStack( savedStack* buf, const char* low, size_t size )
+{
+    stackPool* pool = stackPool::instance( );
+    if ( 0 == buf || size > buf->capacity ) {
+        if ( 0 != buf )
+            freeSaved( buf );
+        size_t bytes = sizeof( savedStack ) + size;
+        buf = (savedStack*)pool->acquireBuffer( bytes );
+        buf->capacity = bytes - sizeof( savedStack );
+        saved_bytes += bytes;
+    }
+    buf->size = size;
+    memcpy( buf->data( ), low, size );
+    return buf;
+}
+
+void coroutine::freeSaved( savedStack* buf )
+{
+    size_t bytes = sizeof( savedStack ) + buf->capacity;
+    saved_bytes -= bytes;
+    stackPool::instance( )->releaseBuffer( (char*)buf, bytes );
+}
+
+size_t coroutine::savedBytes( void )
+{
+    return saved_bytes;
+}
+
+//
+// Accounts for the usage of a painted stack which is about to be
+// released (or whose paint is about to be lost)
+//
+void coroutine::recordStackUsage( void )
+{
+    if ( 0 == painted )
+        return;
+    paintedMap_t::iterator it = painted->find( this );
+    if ( it != painted->end( ) ) {
+        if ( 0 == stackUsage )
+            stackUsage = new stackUsageMap_t( );
+        updateStackUsage( *stackUsage, it->second, _stackSize, stackUsed( ) );
+        painted->erase( it );
+    }
+}
+
+size_t coroutine::stackUsed( void ) const
+{
+    const unsigned char* p = (const unsigned char*)_stack;
+    const unsigned char* end = p + _stackSize;
+    while ( p < end && STACK_PAINT == *p )
+        p++;
+    return end - p;
+}
+
+size_t coroutine::maxStackUsed( const type_info& t )
+{
+    size_t result = 0;
+    if ( 0 != stackUsage ) {
+        stackUsageMap_t::const_iterator it = stackUsage->find( t.name( ) );
+        if ( it != stackUsage->end( ) )
+            result = it->second.maxUsed;
+    }
+    if ( 0 != painted ) {
+        paintedMap_t::const_iterator it;
+        for ( it = painted->begin( ); it != painted->end( ); it++ )
+            if ( *it->second == t && it->first->stackUsed( ) > result )
+                result = it->first->stackUsed( );
+    }
+    return result;
+}
+
+//
+// Reports the usage of the stacks released so far, together with
+// that of the stacks which are still in use
+//
+void coroutine::stackReport( void )
+{
+    stackUsageMap_t m;
+    if ( 0 != stackUsage )
+        m = *stackUsage;
+    if ( 0 != painted ) {
+        paintedMap_t::const_iterator it;
+        for ( it = painted->begin( ); it != painted->end( ); it++ )
+            updateStackUsage( m, it->second, it->first->_stackSize, it->first->stackUsed( ) );
+    }
+
+    cout << endl
+         << "Coroutine stack usage:" << endl;
+    if ( m.empty( ) )
+        cout << "  No painted stacks (see coroutine::cStackPaint)" << endl;
+    stackUsageMap_t::const_iterator it;
+    for ( it = m.begin( ); it != m.end( ); it++ ) {
+        cout << "  " << profiler::className( *it->second.type ) << endl
+             << "    Num. of stacks............." << it->second.count << endl
+             << "    Stack size................." << it->second.stackSize << endl
+             << "    Max stack used............." << it->second.maxUsed << endl;
+    }
+    cout << endl;
+}
+
+#if COROUTINE_METHOD == COROUTINE_MCSC
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Part specific for the makecontext/swapcontext based switching method
+//
+//////////////////////////////////////////////////////////////////////////////
+
+const char* coroutine::method( void )
+{
+    return "mcsc";
+}
+
+//
+// The ucontext_t structure is stored at the top of the stack itself,
+// in order to avoid a separate allocation. On the shared stack, this
+// means that the context of a coroutine is saved and restored together
+// with its part of the stack.
+//
+void coroutine::makeContext( char* stack, size_t size )
+{
+    char* top = stack + size - sizeof( ucontext_t );
+    top -= (uintptr_t)top % 16;
+    _context = (ucontext_t*)top;
+
     getcontext( _context );
     _context->uc_flags          = 0;
     _context->uc_link           = 0;
-    _context->uc_stack.ss_sp    = (char*)malloc( cStackSize );
-    _context->uc_stack.ss_size  = cStackSize;
+    _context->uc_stack.ss_sp    = stack;
+    _context->uc_stack.ss_size  = top - stack;
     makecontext( _context, (void(*)())cor_trampoline, 1, this );
 }
 
-coroutine::~coroutine( )
+void coroutine::swap( coroutine* from, coroutine* to )
 {
-    free( _context->uc_stack.ss_sp );
-    free( _context );
-    assert( 0 == _caller );
-    assert( 0 == _callee );
+    assert( 0 != from->_context );
+    assert( from->_context != to->_context );
+    if ( -1 == swapcontext( from->_context, to->_context ) ) {
+        cerr << "FATAL: swapContext returned -1" << endl;
+        abort( );
+    };
 }
 
-bool coroutine::terminated( void ) const
+char* coroutine::savedSp( void ) const
 {
-    return _cor_terminated;
+#if defined( __x86_64__ )
+    return (char*)_context->uc_mcontext.gregs[ REG_RSP ];
+#elif defined( __i386__ )
+    return (char*)_context->uc_mcontext.gregs[ REG_ESP ];
+#elif defined( __aarch64__ )
+    return (char*)_context->uc_mcontext.sp;
+#else
+    cerr << "FATAL: The shared stack is not supported on this architecture" << endl;
+    abort( );
+#endif
+}
+
+#else
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Part specific for the assembly switching method
+//
+//////////////////////////////////////////////////////////////////////////////
+
+/*
+ * swapcontext() also saves and restores the signal mask, which costs
+ * a system call on each switch. Here only the registers which the
+ * ABI requires to be preserved across calls are saved, on the stack
+ * of the coroutine being suspended; the context of a coroutine is
+ * then just its saved stack pointer.
+ *
+ * cppsim_switch_context( from, to ) pushes the callee-saved registers,
+ * stores the stack pointer in *from, loads the stack pointer "to" and
+ * pops the registers saved there. A new coroutine starts with a frame
+ * which makes cppsim_switch_context "return" to cppsim_context_entry,
+ * which in turn calls cor_trampoline( c ). The coroutine pointer and
+ * the address of cor_trampoline are found in two callee-saved
+ * registers of the initial frame.
+ */
+extern "C" {
+    void cppsim_switch_context( void** from, void* to );
+    void cppsim_context_entry( void );
+}
+
+#if defined( __x86_64__ )
+
+__asm__ (
+    ".pushsection .text\n"
+    ".globl cppsim_switch_context\n"
+    ".type cppsim_switch_context, @function\n"
+    ".align 16\n"
+"cppsim_switch_context:\n"
+    "\tpushq %rbp\n"
+    "\tpushq %rbx\n"
+    "\tpushq %r12\n"
+    "\tpushq %r13\n"
+    "\tpushq %r14\n"
+    "\tpushq %r15\n"
+    "\tsubq $16, %rsp\n"
+    "\tstmxcsr 8(%rsp)\n"
+    "\tfnstcw (%rsp)\n"
+    "\tmovq %rsp, (%rdi)\n"
+    "\tmovq %rsi, %rsp\n"
+    "\tldmxcsr 8(%rsp)\n"
+    "\tfldcw (%rsp)\n"
+    "\taddq $16, %rsp\n"
+    "\tpopq %r15\n"
+    "\tpopq %r14\n"
+    "\tpopq %r13\n"
+    "\tpopq %r12\n"
+    "\tpopq %rbx\n"
+    "\tpopq %rbp\n"
+    "\tret\n"
+    ".size cppsim_switch_context, .-cppsim_switch_context\n"
+    ".globl cppsim_context_entry\n"
+    ".type cppsim_context_entry, @function\n"
+    ".align 16\n"
+"cppsim_context_entry:\n"
+    "\tmovq %r12, %rdi\n"
+    "\tcallq *%r13\n"
+    "\tud2\n"
+    ".size cppsim_context_entry, .-cppsim_context_entry\n"
+    ".popsection\n"
+    );
+
+//
+// Initial frame, from the lowest address: x87 control word and MXCSR
+// (16 bytes), r15, r14, r13, r12, rbx, rbp, return address. The return
+// address is placed so that the stack pointer is 16-byte aligned when
+// cppsim_context_entry calls cor_trampoline, as the ABI requires.
+//
+void coroutine::makeContext( char* stack, size_t size )
+{
+    void** sp = (void**)( (uintptr_t)( stack + size ) & ~(uintptr_t)15 );
+    *--sp = (void*)cppsim_context_entry;        // return address
+    *--sp = 0;                                  // rbp
+    *--sp = 0;                                  // rbx
+    *--sp = (void*)this;                        // r12
+    *--sp = (void*)cor_trampoline;              // r13
+    *--sp = 0;                                  // r14
+    *--sp = 0;                                  // r15
+    sp -= 2;
+    // The new coroutine inherits the floating point control settings
+    __asm__ __volatile__ ( "fnstcw %0" : "=m" ( *(uint16_t*)sp ) );
+    __asm__ __volatile__ ( "stmxcsr %0" : "=m" ( *(uint32_t*)( sp + 1 ) ) );
+    _context = sp;
+}
+
+#elif defined( __aarch64__ )
+
+__asm__ (
+    ".pushsection .text\n"
+    ".globl cppsim_switch_context\n"
+    ".type cppsim_switch_context, %function\n"
+    ".align 4\n"
+"cppsim_switch_context:\n"
+    "\tsub sp, sp, #160\n"
+    "\tstp x19, x20, [sp, #0]\n"
+    "\tstp x21, x22, [sp, #16]\n"
+    "\tstp x23, x24, [sp, #32]\n"
+    "\tstp x25, x26, [sp, #48]\n"
+    "\tstp x27, x28, [sp, #64]\n"
+    "\tstp x29, x30, [sp, #80]\n"
+    "\tstp d8, d9, [sp, #96]\n"
+    "\tstp d10, d11, [sp, #112]\n"
+    "\tstp d12, d13, [sp, #128]\n"
+    "\tstp d14, d15, [sp, #144]\n"
+    "\tmov x9, sp\n"
+    "\tstr x9, [x0]\n"
+    "\tmov sp, x1\n"
+    "\tldp x19, x20, [sp, #0]\n"
+    "\tldp x21, x22, [sp, #16]\n"
+    "\tldp x23, x24, [sp, #32]\n"
+    "\tldp x25, x26, [sp, #48]\n"
+    "\tldp x27, x28, [sp, #64]\n"
+    "\tldp x29, x30, [sp, #80]\n"
+    "\tldp d8, d9, [sp, #96]\n"
+    "\tldp d10, d11, [sp, #112]\n"
+    "\tldp d12, d13, [sp, #128]\n"
+    "\tldp d14, d15, [sp, #144]\n"
+    "\tadd sp, sp, #160\n"
+    "\tret\n"
+    ".size cppsim_switch_context, .-cppsim_switch_context\n"
+    ".globl cppsim_context_entry\n"
+    ".type cppsim_context_entry, %function\n"
+    ".align 4\n"
+"cppsim_context_entry:\n"
+    "\tmov x0, x19\n"
+    "\tblr x20\n"
+    "\tbrk #0\n"
+    ".size cppsim_context_entry, .-cppsim_context_entry\n"
+    ".popsection\n"
+    );
+
+//
+// Initial frame, from the lowest address: x19 .. x28, x29 (frame
+// pointer), x30 (link register), d8 .. d15. The first switch to the
+// coroutine "returns" to cppsim_context_entry with x19 = this and
+// x20 = cor_trampoline.
+//
+void coroutine::makeContext( char* stack, size_t size )
+{
+    void** sp = (void**)( (uintptr_t)( stack + size ) & ~(uintptr_t)15 );
+    sp -= 20;
+    for ( int i=0; i<20; i++ )
+        sp[i] = 0;
+    sp[0] = (void*)this;                        // x19
+    sp[1] = (void*)cor_trampoline;              // x20
+    sp[11] = (void*)cppsim_context_entry;       // x30
+    _context = sp;
+}
+
+#else
+
+#error The asm context switching method is only available on x86-64 and aarch64
+
+#endif
+
+const char* coroutine::method( void )
+{
+    return "asm";
+}
+
+void coroutine::swap( coroutine* from, coroutine* to )
+{
+    cppsim_switch_context( &from->_context, to->_context );
+}
+
+char* coroutine::savedSp( void ) const
+{
+    return (char*)_context;
+}
+
+#endif
+
+/*
+ * Shared stack. The coroutine whose data is on the shared stack is
+ * its "owner"; the owner keeps its data there while suspended, until
+ * another coroutine running on the shared stack is entered. At that
+ * point the used part of the stack (from the saved stack pointer, red
+ * zone included, to the top) is copied into a buffer of the owner,
+ * and the data of the new owner is copied back to the same address.
+ * This cannot be done while running on the shared stack itself: in
+ * that case, the copy is done by the stack switcher, a coroutine with
+ * a small stack of its own, which then gives control to the new owner.
+ */
+#define RED_ZONE        128
+
+static char* sharedStack = 0;
+static char* sharedTop = 0;
+
+void coroutine::takeSharedStack( void )
+{
+    assert( _shared );
+    assert( this != _sharedOwner );
+    stackPool* pool = stackPool::instance( );
+
+    if ( 0 == sharedStack ) {
+        sharedStack = pool->acquire( cSharedStackSize );
+        sharedTop = sharedStack + cSharedStackSize;
+    }
+
+    coroutine* owner = _sharedOwner;
+    if ( 0 != owner && !owner->_cor_terminated ) {
+        char* low = owner->savedSp( ) - RED_ZONE;
+        if ( low < sharedStack )
+            low = sharedStack;
+        owner->_saved = saveStack( owner->_saved, low, sharedTop - low );
+    }
+
+    if ( 0 == _context )
+        makeContext( sharedStack, cSharedStackSize );
+    else
+        memcpy( sharedTop - _saved->size, _saved->data( ), _saved->size );
+    _sharedOwner = this;
+}
+
+class stackSwitcher : public coroutine {
+public:
+    stackSwitcher( void ) : coroutine( 4*stackPool::instance( )->pageSize( ) )
+    {
+        ownStack( );
+        arm( );
+    };
+    coroutine* target;
+protected:
+    void main( void )
+    {
+        while ( 1 ) {
+            target->takeSharedStack( );
+            swap( this, target );
+        }
+    };
+};
+
+static stackSwitcher* switcher = 0;
+
+/*
+ * Hibernation. The used part of the stack is found as for the shared
+ * stack, but the stack itself is kept (so that the pointers into it
+ * stay valid): only its pages are given back to the system.
+ */
+bool coroutine::hibernate( void )
+{
+    if ( _shared || 0 == _stack || 0 != _saved || _cor_terminated ||
+         this == _current_coroutine )
+        return false;
+
+    // The paint is lost, so the stack usage is recorded now
+    recordStackUsage( );
+
+    char* top = _stack + _stackSize;
+    char* low = savedSp( ) - RED_ZONE;
+    if ( low < _stack )
+        low = _stack;
+    _saved = saveStack( 0, low, top - low );
+    stackPool::instance( )->discard( _stack, _stackSize );
+
+    hibernations++;
+    hibernated_bytes += _saved->size;
+    return true;
+}
+
+bool coroutine::hibernated( void ) const
+{
+    return !_shared && 0 != _saved;
+}
+
+void coroutine::wake( void )
+{
+    struct timespec t0, t1;
+    clock_gettime( CLOCK_MONOTONIC, &t0 );
+    memcpy( _stack + _stackSize - _saved->size, _saved->data( ), _saved->size );
+    hibernated_bytes -= _saved->size;
+    freeSaved( _saved );
+    _saved = 0;
+    clock_gettime( CLOCK_MONOTONIC, &t1 );
+
+    double dt = ( t1.tv_sec - t0.tv_sec ) + ( t1.tv_nsec - t0.tv_nsec ) * 1e-9;
+    restores++;
+    restore_time += dt;
+    if ( dt > max_restore_time )
+        max_restore_time = dt;
+}
+
+size_t coroutine::hibernatedBytes( void )
+{
+    return hibernated_bytes;
+}
+
+void coroutine::hibernationReport( void )
+{
+    cout << endl
+         << "Coroutine hibernation statistics:" << endl
+         << "  Num. of hibernations........." << hibernations << endl
+         << "  Num. of restores............." << restores << endl
+         << "  Hibernated bytes............." << hibernated_bytes << endl
+         << "  Mean restore latency (us)...." 
+         << ( restores > 0 ? 1e6 * restore_time / restores : 0.0 ) << endl
+         << "  Max restore latency (us)....." << 1e6 * max_restore_time << endl
+         << endl;
 }
 
 void coroutine::enter( void )
 {
-    ucontext_t *old_context = _current_coroutine->_context;
-    assert( 0 != old_context );
-    assert( _context != old_context );
+    coroutine* old = _current_coroutine;
+    if ( 0 == _context && !_shared )
+        arm( );
+    else if ( 0 != _saved && !_shared )
+        wake( );
     _current_coroutine = this;
     _num_ctx_switch++;
-    if ( -1 == swapcontext( old_context, _context ) ) {
-        cerr << "FATAL: swapContext returned -1" << endl;
-        abort( );
-    };
+    if ( __builtin_expect( profiler::cEnabled, 0 ) )
+        profiler::instance( )->leave( old );
+    if ( _shared && this != _sharedOwner ) {
+        if ( old->_shared ) {
+            if ( 0 == switcher )
+                switcher = new stackSwitcher( );
+            switcher->target = this;
+            swap( old, switcher );
+        } else {
+            takeSharedStack( );
+            swap( old, this );
+        }
+    } else
+        swap( old, this );
+    if ( __builtin_expect( profiler::cEnabled, 0 ) )
+        profiler::instance( )->arrive( );
+    releaseZombie( );
 }
 
-#elif COROUTINE_METHOD == sjlj_copy
+#elif COROUTINE_METHOD == COROUTINE_SJLJ_COPY
 
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -128,17 +780,41 @@ void coroutine::enter( void )
 //////////////////////////////////////////////////////////////////////////////
 
 #include <cstring>
+
+/*
+ * This is the main coroutine. 
+ */
+class main_coroutine : public coroutine {
+public:
+    main_coroutine( void ) : coroutine( ) { };
+    virtual ~main_coroutine( ) { };
+protected:
+    void main( void ) { };
+} main_component;
+
+coroutine* coroutine::_current_coroutine = &main_component;
+
 /*
  * Taken from Helsgaun. Renamed some variables
  */
 
 char* _stackBottom = 0;
 
-coroutine::coroutine( ) :
+const char* coroutine::method( void )
+{
+    return "sjlj_copy";
+}
+
+//
+// All coroutines run on the process stack, so the stack size is
+// ignored
+//
+coroutine::coroutine( size_t ) :
     _stackBuffer( 0 ),
     _low        ( 0 ),
     _high       ( 0 ),
     _bufferSize ( 0 ),
+    _cor_terminated( false ),
     _caller     ( 0 ),
     _callee     ( 0 )
 {
@@ -173,14 +849,23 @@ coroutine::~coroutine( )
 
 void coroutine::enter( void ) 
 {
+    _num_ctx_switch++;
+    if ( __builtin_expect( profiler::cEnabled, 0 ) )
+        profiler::instance( )->leave( _current_coroutine );
     if ( ! _current_coroutine->terminated() ) {
         _current_coroutine->storeStack( );
-        if ( setjmp(_current_coroutine->_envir ) )
+        if ( setjmp(_current_coroutine->_envir ) ) {
+            if ( __builtin_expect( profiler::cEnabled, 0 ) )
+                profiler::instance( )->arrive( );
             return; 
+        }
     }
     _current_coroutine = this;
     if ( !_stackBuffer ) {
+        if ( __builtin_expect( profiler::cEnabled, 0 ) )
+            profiler::instance( )->arrive( );
         main( );
+        _current_coroutine->markTerminated( );
         delete _current_coroutine->_stackBuffer;
         _current_coroutine->_stackBuffer = 0;
         detach( );
@@ -224,9 +909,65 @@ void coroutine::restoreStack( void )
     longjmp(_current_coroutine->_envir, 1);
 }
 
-bool coroutine::terminated( void ) const
+// All the coroutines already share the process stack
+void coroutine::ownStack( void )
+{
+
+}
+
+void coroutine::reset( void )
+{
+    assert( this != _current_coroutine );
+    assert( 0 == _caller );
+    assert( 0 == _callee );
+    delete _stackBuffer;
+    _stackBuffer = 0;
+    _bufferSize = 0;
+    _low = _high = 0;
+    _cor_terminated = false;
+}
+
+// Stacks are already saved in buffers of the right size
+bool coroutine::hibernate( void )
+{
+    return false;
+}
+
+bool coroutine::hibernated( void ) const
+{
+    return false;
+}
+
+size_t coroutine::hibernatedBytes( void )
+{
+    return 0;
+}
+
+// Each coroutine keeps its own stack buffer
+size_t coroutine::savedBytes( void )
+{
+    return 0;
+}
+
+void coroutine::hibernationReport( void )
+{
+    cout << endl
+         << "Coroutine hibernation statistics:" << endl
+         << "  Not available with the sjlj_copy method" << endl
+         << endl;
+}
+
+size_t coroutine::maxStackUsed( const type_info& )
+{
+    return 0;
+}
+
+void coroutine::stackReport( void )
 {
-    return ( !_stackBuffer && _bufferSize );
+    cout << endl
+         << "Coroutine stack usage:" << endl
+         << "  Not available with the sjlj_copy method" << endl
+         << endl;
 }
 
 #else
@@ -28,12 +28,28 @@
 #include <config.h>
 #endif
 
-#if COROUTINE_METHOD == mcsc    // makecontext/swapcontext
+//
+// Context switching methods. COROUTINE_METHOD is set by configure
+// (see the --with-context option) to one of the following values.
+//
+#define COROUTINE_MCSC          1       // makecontext/swapcontext
+#define COROUTINE_SJLJ_COPY     2       // setjmp/longjmp with stack copying
+#define COROUTINE_ASM           3       // hand-written assembly
+
+#ifndef COROUTINE_METHOD
+#define COROUTINE_METHOD COROUTINE_MCSC
+#endif
+
+#if COROUTINE_METHOD == COROUTINE_MCSC  // makecontext/swapcontext
 
 extern "C" {
 #include <ucontext.h>
 }
 
+#elif COROUTINE_METHOD == COROUTINE_ASM // assembly
+
+#include <cstdlib>
+
 #else                           // setjmp/longjmp
 
 extern "C" {
@@ -43,36 +59,105 @@ extern "C" {
 
 #endif                          // End alternative part
 
+#include <typeinfo>
+
 class coroutine
 {
 
-#if CONTEXT_METHOD == mcsc      // makecontext/setcontext
+#if COROUTINE_METHOD != COROUTINE_SJLJ_COPY
     friend void cor_trampoline( coroutine * c );
+    friend class main_coroutine;
+    friend class stackSwitcher;
 #endif                          // End alternative part
 
 public:
     virtual ~coroutine ();
     
     // Accessors
-    inline bool terminated( void ) const;
+    bool terminated( void ) const               { return _cor_terminated; };
     
     // Modifiers
     void resume( void );
     void call( void );
     
     static size_t cStackSize;
+    static bool cStackPaint;                    // Track stack usage
+    static unsigned long numCtxSwitch( void )   { return _num_ctx_switch; };
+
+    //
+    // Shared stack mode. Coroutines created while cSharedStack is set
+    // all run on a single stack of cSharedStackSize bytes; when one of
+    // them needs the stack, the used part of it is saved by the
+    // coroutine which was using it. Not available with the sjlj_copy
+    // method, which always works this way.
+    //
+    static bool cSharedStack;
+    static size_t cSharedStackSize;
+    static const char* method( void );          // Context switching method
+
+    //
+    // Stack usage, by class. Only available when cStackPaint is set
+    // before the coroutines are entered for the first time.
+    //
+    static size_t maxStackUsed( const std::type_info& t );
+    static void stackReport( void );
+
+    //
+    // Hibernation. The used part of the stack of a suspended coroutine
+    // is copied aside, and the memory of the stack is given back to the
+    // system; the stack keeps its address, and its content is restored
+    // the next time the coroutine is entered. Coroutines on the shared
+    // stack, and those which have not started yet, are not hibernated.
+    //
+    bool hibernate( void );
+    bool hibernated( void ) const;
+    static size_t hibernatedBytes( void );      // Currently saved aside
+    static void hibernationReport( void );
+
+    // Bytes of all the buffers in which suspended coroutines keep
+    // their part of the shared stack, or their hibernated stack
+    static size_t savedBytes( void );
 protected:
-    coroutine( );
+    // A stackSize of 0 means cStackSize
+    coroutine( size_t stackSize = 0 );
     void detach( void );
+    void ownStack( void );                      // Never use the shared stack
+    void reset( void );                         // Makes the coroutine new again
+    void markTerminated( void )                 { _cor_terminated = true; };
     virtual void main( void ) = 0;              // Coroutine body
     
     static unsigned long _num_ctx_switch;	// Number of context switches
 private:
     inline void enter( void );
 
-#if COROUTINE_METHOD == mcsc            // makecontext/setcontext
-    ucontext_t  *_context;
-    bool        _cor_terminated;
+#if COROUTINE_METHOD != COROUTINE_SJLJ_COPY // separate stacks
+    void arm( void );                   // Gets a stack, creates the context
+    void makeContext( char* stack, size_t size );
+    void releaseStack( void );          // Gives the stack back to the pool
+    size_t stackUsed( void ) const;     // High-water mark of a painted stack
+    void recordStackUsage( void );
+    char* savedSp( void ) const;        // Stack pointer of a suspended coroutine
+    void takeSharedStack( void );       // Saves the owner, restores this
+    void wake( void );                  // Restores a hibernated stack
+    static inline void releaseZombie( void );
+    static inline void swap( coroutine* from, coroutine* to );
+
+    // Buffer in which the used part of a stack is saved
+    struct savedStack;
+    static savedStack* saveStack( savedStack* buf, const char* low, size_t size );
+    static void freeSaved( savedStack* buf );
+
+#if COROUTINE_METHOD == COROUTINE_MCSC
+    ucontext_t  *_context;              // Stored at the top of _stack
+#else
+    void        *_context;              // Saved stack pointer
+#endif
+    char        *_stack;                // Taken from the stack pool
+    savedStack  *_saved;                // If _shared or hibernated
+    unsigned int _stackSize;            // Below 4GB, checked on creation
+    bool        _shared;                // Runs on the shared stack
+    static coroutine *_zombie;          // Terminated, still owns its stack
+    static coroutine *_sharedOwner;     // Whose data is on the shared stack
 #else                                   // setjmp/longjmp, copy
     inline void storeStack( void );
     inline void restoreStack( void );
@@ -82,6 +167,8 @@ private:
     size_t      _bufferSize;
 #endif
 
+    bool        _cor_terminated;
+
     coroutine   *_caller;
     coroutine   *_callee;
     static coroutine *_current_coroutine;
@@ -27,12 +27,21 @@
 
 // Process
 #include "process.hh"
+#include "coprocess.hh"
+#include "recyclable.hh"
+#include "basic_process.hh"
+#include "simset.hh"
 #include "logger.hh"
 
 // Sequencing set implementations
 #include "sqs.hh"
 #include "sqsDll.hh"
 #include "sqsPrio.hh"
+#include "sqsCal.hh"
+#include "sqsHeap.hh"
+#include "sqsLadder.hh"
+#include "sqsWheel.hh"
+#include "sqsAdaptive.hh"
 
 // Statistics
 #include "mean.hh"
@@ -52,5 +61,6 @@
 
 // Misc
 #include "assertions.hh"
+#include "profiler.hh"
 
 #endif
@@ -25,3 +25,10 @@
 #include "handle.hh"
 
 unsigned long int shared::_active_handle_count = 0;
+
+shared::~shared( )
+{
+    assert( 0 == _sharedCount );
+    assert( _active_handle_count > 0 );
+    --_active_handle_count;
+}
@@ -27,6 +27,7 @@
 
 #include <cassert>
 #include <map>
+#include <type_traits>
 #include "logger.hh"
 
 using namespace std;
@@ -47,23 +48,26 @@ template< class T > class handle;
 class shared {
     template< class T > friend class handle;
 public:
-    virtual ~shared( ) 
-    { 
-        assert( 0 == _sharedCount );
-        assert( _active_handle_count > 0 );
-	logger* l = getLogger();
-        l->message( 0, "%ld\n", --_active_handle_count );
+    virtual ~shared( );
+
+    static logger* getLogger( void )
+    {
+        // Looked up once, as the name would be allocated at each call
+        static logger* l = logger::instance( "libcppsim::shared" );
+        return l;
     };
 
-    static logger* getLogger( void ) { return logger::instance( "libcppsim::shared" ); };
+    // Number of shared objects which have not been destroyed yet. It
+    // is only counted: logging it at each construction and destruction
+    // would cost more than the construction itself
+    static long unsigned int count( void ) { return _active_handle_count; };
 
 protected:
     // Instances of this class cannot be created directly
     shared( ) : 
         _sharedCount( 0 ) 
     { 
-	logger* l = getLogger();
-        l->message( 0, "%ld\n", ++_active_handle_count );
+        ++_active_handle_count;
     };
 
     // get_ref() increments the _sharedCount counter. Returns the updated
@@ -82,6 +86,13 @@ protected:
 	return --_sharedCount; 
     };
 
+    // dispose() is called when the last handle to the object is
+    // released. Classes which recycle their objects override it.
+    virtual void dispose( void )
+    {
+        delete this;
+    };
+
 private:
     unsigned int                _sharedCount;
     static long unsigned int    _active_handle_count;
@@ -91,9 +102,20 @@ private:
 //
 // handle class.
 //
+// A handle is just a pointer: it has no virtual members, so that it
+// takes no more room than a T* in the containers and in the objects
+// which hold it. A handle which is moved (or returned, or passed by
+// value from a temporary) hands its reference over, leaving the
+// source null, without touching the reference count. Converting a
+// handle to a handle of a base class is a static_cast, and a moved
+// handle keeps its reference across the conversion too; only the
+// conversion to a derived class needs a dynamic_cast, which gives a
+// null handle if the object is not of that class.
+//
 //////////////////////////////////////////////////////////////////////////////
 template< class T >
 class handle {
+    template< class S > friend class handle;
 public:
     handle( T* obj = 0 ) : _obj( obj ) 
     {
@@ -107,20 +129,38 @@ public:
             _obj->get_ref( );
     };
 
-    virtual ~handle( ) 
+    handle( handle<T>&& other ) noexcept : _obj( other._obj )
+    {
+        other._obj = 0;
+    };
+
+    ~handle( ) 
     {
         unBind( );
     };
 
     handle& operator=( const handle<T>& other ) 
     {
+        // The new reference is taken first, so that assigning a handle
+        // to itself does not release the object
+        T* obj = other._obj;
+	if ( 0 != obj ) 
+	    obj->get_ref( );
 	unBind( );
-	_obj = other._obj;
-	if ( !isNull( ) ) 
-	    other._obj->get_ref( );
+	_obj = obj;
 	return *this;
     };
 
+    handle& operator=( handle<T>&& other ) noexcept
+    {
+        if ( this != &other ) {
+            unBind( );
+            _obj = other._obj;
+            other._obj = 0;
+        }
+        return *this;
+    };
+
     T* operator->( ) const 
     {
 	assert( ! isNull( ) );
@@ -146,16 +186,33 @@ public:
     void setNull( void ) { unBind( ); };
     
     // Type conversion
-    template< class S > operator handle<S>() 
+    template< class S > operator handle<S>() const &
     {
-        return handle<S>( dynamic_cast<S*>( _obj ) );
+        if constexpr ( is_convertible< T*, S* >::value )
+            return handle<S>( static_cast<S*>( _obj ) );
+        else
+            return handle<S>( dynamic_cast<S*>( _obj ) );
+    };
+
+    template< class S > operator handle<S>() &&
+    {
+        handle<S> result;
+        if constexpr ( is_convertible< T*, S* >::value )
+            result._obj = static_cast<S*>( _obj );
+        else {
+            result._obj = dynamic_cast<S*>( _obj );
+            if ( result.isNull( ) )
+                return result;
+        }
+        _obj = 0;
+        return result;
     };
 
 private:
     void unBind( void )
     {
         if ( !isNull( ) && ( 0 == _obj->unget_ref( ) ) )
-            delete _obj;
+            _obj->dispose( );
 	_obj = 0;
     };
 
@@ -192,12 +249,7 @@ public:
 
     };
 
-    weak_handle( const handle<T>& other ) : _obj ( other._obj )
-    {
-
-    };
-
-    virtual ~weak_handle( ) 
+    weak_handle( const handle<T>& other ) : _obj ( other.rep( ) )
     {
 
     };
@@ -233,9 +285,12 @@ public:
     void setNull( void ) { _obj = 0; };
     
     // Type conversion
-    template< class S > operator weak_handle<S>() 
+    template< class S > operator weak_handle<S>() const
     {
-        return weak_handle<S>( dynamic_cast<S*>( _obj ) );
+        if constexpr ( is_convertible< T*, S* >::value )
+            return weak_handle<S>( static_cast<S*>( _obj ) );
+        else
+            return weak_handle<S>( dynamic_cast<S*>( _obj ) );
     };
 
 private:
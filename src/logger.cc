@@ -29,7 +29,11 @@
 
 // using namespace std;
 
-map< string, logger* > logger::_instances = map< string, logger* >();
+map< string, logger* >& logger::instances( void )
+{
+    static map< string, logger* >* table = new map< string, logger* >( );
+    return *table;
+}
 
 logger::logger( ) :
     _os ( &cerr ),
@@ -40,9 +44,10 @@ logger::logger( ) :
 
 logger* logger::instance( const string& name )
 {
-    if ( 0 == _instances[ name ] )
-        _instances[ name ] = new logger( );
-    return _instances[ name ];
+    logger*& l = instances( )[ name ];
+    if ( 0 == l )
+        l = new logger( );
+    return l;
 }
 
 void logger::setOutputFile( std::ostream* os )
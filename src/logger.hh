@@ -48,7 +48,9 @@ protected:
 
     ostream*    _os;    // Output stream
     int         _l;     // Level of verbosity
-    static map< string, logger* > _instances;
+    // The loggers by name. The table is never destroyed, as handles
+    // released by static destructors still log through it.
+    static map< string, logger* >& instances( void );
 };
 
 #endif
@@ -1,10006 +0,0 @@
-/* Header file "mrand_seeds.h" included by mrand.c */
-
-static double drng[][6] =
-{
-  {0.0,           0.0,           1.0,           0.0,           0.0,           1.0},
-  {1772212344.0,  1374954571.0,  2377447708.0,   540628578.0,  1843308759.0,   549575061.0},
-  {2602294560.0,  1764491502.0,  3872775590.0,  4089362440.0,  2683806282.0,   437563332.0},
-  { 376810349.0,  1545165407.0,  3443838735.0,  3650079346.0,  1898051052.0,  2606578666.0},
-  {1847817841.0,  3038743716.0,  2014183350.0,  2883836363.0,  3242147124.0,  1955620878.0},
-  {1075987441.0,  3468627582.0,  2694529948.0,   368150488.0,  2026479331.0,  2067041056.0},
-  { 134547324.0,  4246812979.0,  1700384422.0,  2358888058.0,    83616724.0,  3045736624.0},
-  {2816844169.0,   885735878.0,  1824365395.0,  2629582008.0,  3405363962.0,  1835381773.0},
-  { 675808621.0,   434584068.0,  4021752986.0,  3831444678.0,  4193349505.0,  2833414845.0},
-  {2876117643.0,  1466108979.0,   163986545.0,  1530526354.0,    68578399.0,  1111539974.0},
-  { 411040508.0,   544377427.0,  2887694751.0,   702892456.0,   758163486.0,  2462939166.0},
-  {3631741414.0,  3388407961.0,  1205439229.0,   581001230.0,  3728119407.0,    94602786.0},
-  {4267066799.0,  3221182590.0,  2432930550.0,   813784585.0,  1980232156.0,  2376040999.0},
-  {1601564418.0,  2988901653.0,  4114588926.0,  2447029331.0,  4071707675.0,  3696447685.0},
-  {3878417653.0,  2549122180.0,  1351098226.0,  3888036970.0,  1344540382.0,  2430069028.0},
-  { 197118588.0,  1885407936.0,   576504243.0,   439732583.0,   103559440.0,  3361573194.0},
-  {4024454184.0,  2530169746.0,  2135879297.0,  2516366026.0,   260078159.0,  2905856966.0},
-  {2331743881.0,  2059737664.0,   186644977.0,   401315249.0,    72328980.0,  1082588425.0},
-  { 694808921.0,  2851138195.0,  1756125381.0,  1738505503.0,  2662188364.0,  3598740668.0},
-  {2834735415.0,  2017577369.0,  3257393066.0,  3823680297.0,  2315410613.0,   637316697.0},
-  {4132025555.0,  3700940887.0,   838767760.0,  2818574268.0,  1375004287.0,  2172829019.0},
-  {3489426225.0,  4112746453.0,  2594929844.0,  1633976546.0,  1583084490.0,  4147801476.0},
-  { 226509369.0,   146935912.0,  3937833922.0,  1061829953.0,   813052180.0,  3597307501.0},
-  {3256044974.0,  3681783929.0,   575085515.0,  1457436746.0,  1015379089.0,   237144042.0},
-  {3893937255.0,  2700371479.0,  2540977187.0,   448868868.0,  2639602201.0,  3320881846.0},
-  {2151265850.0,  2125810247.0,  1191988643.0,  1600692767.0,   135550530.0,   395838860.0},
-  {3135267209.0,  3623600367.0,  2626505177.0,  4281737957.0,  2062913934.0,  2592194162.0},
-  { 390422829.0,  1811400753.0,   322793407.0,  3490624807.0,  3235017317.0,   371104964.0},
-  {2656265790.0,  3996442108.0,  3386349306.0,  1626832241.0,  1574763932.0,  3706202892.0},
-  {3589952455.0,  1163511069.0,  2697607059.0,   534184903.0,  3766759256.0,   251252346.0},
-  {2882420196.0,  3003606956.0,  3629906612.0,  2537203610.0,  2746594184.0,  1661091636.0},
-  {1183183944.0,   583879472.0,  4255459700.0,   713754974.0,  2922254235.0,  1161913813.0},
-  {4132807367.0,  3628950852.0,   399250763.0,  3845478137.0,  1309889890.0,   213170736.0},
-  {3112893239.0,  1632688723.0,  1523209273.0,  1177690048.0,  3460621046.0,  2768883982.0},
-  {2661550465.0,  1554695591.0,  4025759551.0,  3938508444.0,  4250175274.0,  1555765950.0},
-  {2684621241.0,  1586910242.0,  3611689202.0,   206694063.0,     6969092.0,  1062099384.0},
-  { 235778005.0,  1845387954.0,  3114888710.0,  2203759286.0,  3114065342.0,  2496367282.0},
-  {2441823102.0,  2650658691.0,  1337568664.0,  1857164665.0,  1915815707.0,   884425315.0},
-  {4101909040.0,  4166390745.0,  2860172669.0,  3497960192.0,  3577628224.0,  4213141252.0},
-  {3699546758.0,  3377270633.0,    68718870.0,  2774746460.0,  1020495218.0,  1575238977.0},
-  {1139564619.0,  2523670566.0,  3355096665.0,   495198678.0,  2395315759.0,   849476900.0},
-  { 635963092.0,   311652233.0,   262540809.0,  3184560243.0,  2651025088.0,   789619078.0},
-  {1271360621.0,  4223486533.0,  1390580044.0,  2888955378.0,  3184629747.0,   630626237.0},
-  {1678221843.0,   231113094.0,  4130363024.0,  3852779467.0,  1604842289.0,  4212522078.0},
-  {2778593270.0,  1004903484.0,  2973098739.0,   665751699.0,  2332674775.0,   295462521.0},
-  {4198005471.0,   972878412.0,  1558189575.0,    55781237.0,  3893360589.0,  1732945031.0},
-  {1152796221.0,  1778239045.0,  1459562806.0,  3905398533.0,  3769475924.0,  2644342737.0},
-  {2510032067.0,  3734379515.0,   531296007.0,   701842463.0,  2074273193.0,  2292680950.0},
-  {2971989859.0,  2256121557.0,  2142214447.0,  3137353222.0,   773588230.0,  3902637774.0},
-  {4229774628.0,   121176046.0,  3728703289.0,  3849382323.0,  2003165682.0,  1467065642.0},
-  { 323392186.0,  3824746296.0,  1629368039.0,   739902158.0,  1994020456.0,  1037183254.0},
-  { 513283862.0,  2188379510.0,  1957928689.0,   813409383.0,  3806082123.0,   635316674.0},
-  { 552826185.0,  2555996419.0,  2271338972.0,  3547921306.0,  1228993928.0,  2361559081.0},
-  {1295138976.0,  1495710207.0,   723074677.0,  3820787179.0,  3845682156.0,  4174822106.0},
-  {2521565200.0,    31792620.0,  3784456031.0,  1065580104.0,  3937944782.0,  4215959677.0},
-  {3400057703.0,  2744571285.0,  1393759441.0,  1601776871.0,  3165609536.0,   835804949.0},
-  {4088663797.0,   662403715.0,  1972116992.0,  2505435866.0,  3440128606.0,   777899473.0},
-  {3780961670.0,  2157269301.0,  1083414147.0,  2821221342.0,  3067184313.0,  2993244053.0},
-  {2795653207.0,  2163909033.0,  3809789650.0,  2585746232.0,  3313980374.0,  3096075721.0},
-  {2378158017.0,  3726102874.0,  2689185822.0,  2369776558.0,   432649940.0,  1111256897.0},
-  {3456908798.0,   495588917.0,  1480249157.0,  2815947509.0,  1071333363.0,  1928430914.0},
-  { 717921372.0,  2683845918.0,   930457772.0,  2530097953.0,  2417205907.0,  3022951420.0},
-  {1689355612.0,  1039193903.0,  3613681802.0,  1080205242.0,  2013101883.0,  2468502905.0},
-  {2504068936.0,  3230484718.0,  1748896401.0,  1453957344.0,   848547757.0,   161200170.0},
-  {4201049117.0,   444124251.0,  2581583939.0,  1322446501.0,   681505596.0,  1663004988.0},
-  {2930586493.0,  3370079320.0,   198796253.0,  3012797217.0,  3840048005.0,   184999535.0},
-  {2532724791.0,  1241080524.0,  3800041958.0,  3303947134.0,  3174626846.0,  3073510302.0},
-  {  14809834.0,  3618645306.0,  1942542077.0,   669052232.0,   651470251.0,  1391560038.0},
-  { 995707287.0,  1759822820.0,  2501644613.0,  3721319358.0,  3968667126.0,  2535846961.0},
-  { 979173856.0,  1997457820.0,  1968292063.0,  1380431809.0,  3055802991.0,   540373583.0},
-  {3681007982.0,  2977347732.0,   571110841.0,  2217121181.0,  2733362413.0,    32186934.0},
-  {1975286634.0,   958506122.0,    46451179.0,  3475987512.0,  2626451279.0,  3517401221.0},
-  { 330144009.0,  1060219535.0,  1447223839.0,  3165226575.0,   599904263.0,  3911112835.0},
-  {2537161090.0,  3500106754.0,   926795530.0,   728440468.0,  1129037665.0,  2789187437.0},
-  {3793615118.0,  2750706029.0,  2156058298.0,  3079033430.0,  2780569996.0,  3936920391.0},
-  {1198120767.0,  2694820585.0,  2834525274.0,   188651758.0,   308670432.0,  1369385984.0},
-  {2702470127.0,    19874369.0,  4012779639.0,  3121258228.0,  1839121226.0,  3861314075.0},
-  {2554275712.0,   719378996.0,  2400430690.0,  1141204239.0,  1627924328.0,  1297183842.0},
-  { 705258195.0,  4161016439.0,  1462878351.0,  3976713745.0,  1141257086.0,  3425581727.0},
-  {3358325932.0,  2544614576.0,  1863746614.0,  1124881023.0,  3147032679.0,  3087920200.0},
-  {2977113134.0,  3977111791.0,  4253114310.0,   142443885.0,   243603301.0,  3716506593.0},
-  {3431919302.0,  1245400869.0,  1324788929.0,  2860157607.0,   941144108.0,  3857335131.0},
-  {3906194044.0,  1681219081.0,  2843586309.0,  4089310580.0,  2176521638.0,   690520146.0},
-  {3745569546.0,   792495396.0,  1806539660.0,  4272439405.0,  1894505679.0,  1392532334.0},
-  { 865747759.0,  3079408284.0,  1984574005.0,   613765073.0,  1551526411.0,  4256443592.0},
-  {2814963340.0,  2834960950.0,  2968542314.0,   309822219.0,  1823774832.0,  1839552557.0},
-  {2548640113.0,  2862571993.0,  4042326055.0,  2483508296.0,  2762715198.0,   593338793.0},
-  {2568040427.0,  2120166173.0,   942509028.0,  2137567779.0,  2626314860.0,  2259019634.0},
-  {1311709266.0,  3938696051.0,  1456683566.0,  3795230520.0,  1388639258.0,  2800468070.0},
-  {3117451406.0,   928974817.0,  2781895567.0,   321394107.0,   110152236.0,  2088746743.0},
-  {1875039110.0,  3442179808.0,  3890426888.0,  1777391452.0,  1835432708.0,   562722092.0},
-  {1448528649.0,  2330442989.0,  2407439339.0,  3707873573.0,  4196869323.0,  2107506543.0},
-  {2780921782.0,   358207338.0,  3529199325.0,  4247445586.0,  2383769411.0,  3241037506.0},
-  {1378002714.0,  2723574102.0,  1749215013.0,  2907202697.0,  2962834356.0,  1188034898.0},
-  { 120313119.0,  1494806970.0,  2910978351.0,   722434700.0,  1419161042.0,  2517182236.0},
-  {1195864685.0,  3838840335.0,  1111591396.0,  3060365866.0,  2463752639.0,  3666213547.0},
-  {1333023911.0,  1979613259.0,  2132866392.0,  1394964690.0,  1264353313.0,  3231502632.0},
-  {3768306921.0,  1680121724.0,   805680272.0,  1951253770.0,  1486168061.0,  2955477946.0},
-  { 109224445.0,  2861250694.0,  4196750427.0,   939526471.0,  1752437524.0,  1145799039.0},
-  { 408306775.0,  2148819781.0,  3316724552.0,   137163319.0,  4180687869.0,   574961213.0},
-  {2386386992.0,  3078479797.0,   167075008.0,  1253465513.0,  4072841169.0,  2167533564.0},
-  {2315827434.0,  3392038067.0,  2279258261.0,  1432017357.0,   568998206.0,  1206469405.0},
-  {1678601670.0,  1150247641.0,  2499326926.0,   699715048.0,  1501364333.0,  1669290797.0},
-  {3957493358.0,  1670076821.0,   804110344.0,  2866685751.0,   836848697.0,  3107121052.0},
-  {  19764713.0,  3522310913.0,    46276655.0,  1383766567.0,  2804181892.0,   581103203.0},
-  {2167472521.0,  2014671778.0,   682905578.0,   958597651.0,  1861637882.0,  2944058806.0},
-  {1385430895.0,  2356575885.0,   353068024.0,  2200078216.0,  3700934213.0,  2049244134.0},
-  {2833841811.0,  3185343708.0,  1090554308.0,   595830647.0,    11546156.0,   812414988.0},
-  { 968812800.0,  3123207359.0,  2759640075.0,  2696848485.0,  1678403296.0,  3773995716.0},
-  { 840236174.0,  3526637660.0,  4058538497.0,  3302218596.0,  3827979469.0,  2075185104.0},
-  {1134590412.0,   890326218.0,  1397678185.0,    17901169.0,  1636324160.0,   155684467.0},
-  {2417485870.0,  4187012752.0,  2471614778.0,  3401206287.0,  2236132104.0,  1925076677.0},
-  { 409076633.0,   138200637.0,   534262654.0,   170693953.0,  3102340032.0,   186137910.0},
-  {1840875213.0,   879540625.0,   791467211.0,  2514136033.0,  2877359342.0,  2883634657.0},
-  {3505105649.0,   104133676.0,  1539837496.0,  2128875612.0,  3052052925.0,  4211889302.0},
-  { 896923878.0,  3135723093.0,  1791043017.0,  3646191373.0,  3172519941.0,  2093781646.0},
-  {2222859505.0,   444924434.0,   196289768.0,  2499035230.0,  2869312181.0,   636886484.0},
-  {3730540589.0,  3232474660.0,  1781917564.0,  3720273469.0,  1292682041.0,  2824979855.0},
-  {2841888278.0,  2990967857.0,  2764821478.0,  1039953293.0,  1432962019.0,  2952732867.0},
-  {4222281370.0,  3776080821.0,  1110876229.0,    83862283.0,  1816657732.0,  4253577541.0},
-  {1208898880.0,  3446559293.0,  3884103245.0,  1092989712.0,   789761206.0,  2496084542.0},
-  {1362833465.0,  2902364806.0,  3962562565.0,  1584273191.0,  1581951512.0,   314212827.0},
-  {4034387952.0,  4212323873.0,  1215556249.0,  4114176610.0,   314477640.0,  1102481802.0},
-  {4216454304.0,  3097720081.0,  2100164655.0,  2111666470.0,  3168350541.0,   911341790.0},
-  { 235086596.0,  3078069032.0,  2849850906.0,  4006268304.0,  3621689937.0,  1752818559.0},
-  {2561118695.0,  1359899900.0,   120233830.0,  1772699343.0,  3566372298.0,   190473233.0},
-  {1623940678.0,  3352345082.0,   588597541.0,  2642764851.0,  2212913553.0,  2827710582.0},
-  {3198409257.0,  1057617817.0,  2723637644.0,  4151165210.0,  3933857338.0,   153832659.0},
-  {2141448700.0,   931043448.0,  3972563106.0,   281421145.0,  4117387806.0,   635579188.0},
-  { 572888822.0,  1755780990.0,  3644525073.0,  1593845110.0,  3182029115.0,  3500004183.0},
-  {2485774913.0,  3572825150.0,  2297437420.0,  2533946233.0,  3481175635.0,  3606142401.0},
-  {3988803528.0,  2149528350.0,  4227249907.0,  1091797855.0,  3353712884.0,  3140513565.0},
-  {1142068543.0,  3480780802.0,   365906160.0,  4145081757.0,  1526050176.0,  2476753123.0},
-  {3639467390.0,  2033633945.0,  3779796312.0,  1340589230.0,  2131693900.0,  2266655456.0},
-  {1066518541.0,  1552771636.0,  1776704296.0,  1161842314.0,  4112464213.0,  1989503814.0},
-  {3052278808.0,  2689306117.0,  4217824011.0,  3418061529.0,   452384302.0,   752057746.0},
-  { 311084890.0,  4184322385.0,  1281084011.0,  3003732500.0,  3489203675.0,  3887682877.0},
-  {  81451189.0,  2211072148.0,  1583364330.0,  1758485202.0,  3739249845.0,  3250830076.0},
-  {3491649208.0,   334377295.0,  2876443753.0,  2539957041.0,  2839687743.0,  1053747129.0},
-  { 118851792.0,  1577867278.0,  2706390476.0,  2002398228.0,  4230039565.0,  1171407625.0},
-  {3370386313.0,  4002390230.0,  1876838840.0,  3692042219.0,  2633768909.0,   802495609.0},
-  {4152478315.0,    38010269.0,   354617674.0,  3951655610.0,  2172601062.0,  4032710847.0},
-  {3545462600.0,  4021035191.0,  2284997786.0,  2598491900.0,  2978248132.0,  2190117645.0},
-  {3874107424.0,  3007551560.0,  3913294741.0,  4068735802.0,   799750594.0,  1510855703.0},
-  {1076951717.0,   457487081.0,  3692466040.0,  1167649296.0,  2061830097.0,  2922935049.0},
-  {2001878545.0,  1789258674.0,  1731515798.0,  2805466112.0,  3541206508.0,  3233899833.0},
-  {1589586946.0,  2001884471.0,  1137588289.0,  2280875749.0,  1999638691.0,  3387977391.0},
-  {2914263047.0,  2489870434.0,  3626517924.0,  1198705539.0,  3019951509.0,  2749057096.0},
-  {2909236943.0,  4253566321.0,  3921285870.0,  1461143753.0,   780828816.0,  3406105822.0},
-  {1396568500.0,  3970621096.0,   937446184.0,   197425380.0,  3900572949.0,  3236731959.0},
-  {2172025159.0,  1724604777.0,   615287793.0,  2806607906.0,  1536758570.0,  2480798627.0},
-  { 255465842.0,  2118848877.0,  2711113211.0,  3330713564.0,  2597768929.0,  3423805950.0},
-  { 591451481.0,  3231728507.0,  3980702395.0,  3993399784.0,   582508070.0,   401882147.0},
-  {2979686056.0,  2605765598.0,  3261557424.0,  1704512361.0,  3581487583.0,  4163863918.0},
-  {3422392601.0,  1937976329.0,   897270108.0,  4200352002.0,   111503146.0,   217046658.0},
-  {  26359120.0,  3598581019.0,  3214698794.0,  2917332688.0,  4234171206.0,  1747293565.0},
-  {3829144113.0,  4013113129.0,  4240547683.0,   183631880.0,  4104847387.0,   808861864.0},
-  {4266876338.0,  2162684321.0,  3675140194.0,   764153197.0,   667816904.0,   811631412.0},
-  {2222841939.0,  1214394911.0,  1826581449.0,  4088096456.0,  1002421216.0,  2952104700.0},
-  {1712318718.0,  3475060577.0,  2366902856.0,  1311661221.0,  2505880802.0,  3543401515.0},
-  {1842283581.0,  1287454151.0,  1575584930.0,  1965746823.0,   828326642.0,  2813487794.0},
-  {1755263989.0,  3085298219.0,  4010055946.0,  2379055856.0,  3708802031.0,  3842162166.0},
-  { 238251413.0,   849842969.0,  4272531287.0,   230065166.0,  4166391919.0,  1752273912.0},
-  {2570979412.0,  2489401667.0,  2827424194.0,  1639576561.0,  1838038183.0,  1877037401.0},
-  {3737593581.0,  3462392385.0,  2506985965.0,  3181536328.0,  4179829346.0,  3983325072.0},
-  {4239290999.0,  3798734732.0,  3538954329.0,  1870087030.0,   982574470.0,  4087540638.0},
-  {2735208281.0,   968624674.0,    54276831.0,  2110888789.0,   123131433.0,  1867617091.0},
-  {1198324303.0,   280341691.0,  1824997801.0,  3673905886.0,  1282202773.0,  1344611900.0},
-  {1621192172.0,  2990750597.0,  3054555220.0,  1210666329.0,   811418816.0,  1711574946.0},
-  {2022315850.0,  2439159308.0,  1538427153.0,  1514324411.0,  3575594256.0,  3355141056.0},
-  { 925334800.0,  1932043909.0,  1089095554.0,  3835127973.0,  1746395003.0,    82768221.0},
-  {4169860516.0,   579656085.0,  3373681510.0,   607474404.0,  2127826302.0,  2108007456.0},
-  { 405749023.0,  3135257738.0,    51416753.0,  4271241087.0,   600855511.0,  4238445362.0},
-  { 620002506.0,  3808724740.0,  3074071840.0,   160904792.0,   983878282.0,  3091672936.0},
-  {2023585183.0,  2993057483.0,  3773871083.0,  1772316345.0,  2395855450.0,  2518152131.0},
-  {3727459874.0,  2742644750.0,  1645862042.0,  2140075786.0,  2462073907.0,  4094228741.0},
-  { 611775417.0,  3914081326.0,  3596279764.0,   557666006.0,  3571640840.0,  4184731077.0},
-  {2345402778.0,  1362357742.0,   541379425.0,  4238817167.0,  2871549417.0,  2413135225.0},
-  {2136342493.0,  2137322318.0,   154899576.0,   864498920.0,  1368926078.0,   446502369.0},
-  { 699811199.0,  2984825878.0,    26380246.0,  2214574692.0,  2219375821.0,  1751210879.0},
-  {2608596783.0,  1026666630.0,   427870763.0,  3813291381.0,  2427476462.0,  1444772291.0},
-  {3946033260.0,  3501087782.0,  1504595973.0,  3866214422.0,  1383596619.0,  1228035908.0},
-  { 111541610.0,  3083097308.0,  2713819108.0,   374226336.0,  4186460421.0,  4057366726.0},
-  {3410272764.0,  1676878042.0,  4142753837.0,  3250035416.0,  2223626124.0,   729498154.0},
-  {2325024221.0,   946438568.0,  1833289684.0,  3617603546.0,  1404121853.0,    44357093.0},
-  {2956911357.0,  1579562934.0,  1564406219.0,  3170152805.0,   273147292.0,  2723083005.0},
-  {2919313346.0,  1685759919.0,  2661579305.0,   413152734.0,  2547364072.0,   532666430.0},
-  { 744419299.0,  3438698767.0,  1306761728.0,  4086240455.0,  2209655811.0,  2014926282.0},
-  {4170284595.0,   485716022.0,  1404716568.0,  2995939663.0,  3401309937.0,   372882569.0},
-  {3274132021.0,  3230904086.0,  3093094378.0,  3625250107.0,  3582135806.0,  3321050743.0},
-  {3376732916.0,  2577396175.0,  2013052075.0,  2230184544.0,   409731222.0,  3540505190.0},
-  {3087173712.0,   636223402.0,  4294718618.0,   941664589.0,    80154581.0,  2330755672.0},
-  { 445846499.0,  2364389126.0,   324411596.0,   272980602.0,    84392226.0,  3427882894.0},
-  {1588072573.0,   152970339.0,  1443581049.0,  1610335781.0,  2425289002.0,  1205027785.0},
-  { 224358076.0,   831166947.0,   545466829.0,   810405455.0,  4173514459.0,  1116677313.0},
-  {2016133737.0,  4149113369.0,   308366638.0,  2279229473.0,  1415032816.0,   624778491.0},
-  { 975481440.0,  1462853282.0,   683229360.0,  3596466613.0,  3489184647.0,  1214646031.0},
-  {3918900295.0,  3126519944.0,  2010091123.0,  3348048606.0,  2768777628.0,  1352222609.0},
-  {3855567915.0,  2091985504.0,  1684665363.0,  3957002109.0,   556238500.0,  2791339222.0},
-  {2791520793.0,  3672631510.0,  3348461817.0,  1395495570.0,   440280353.0,  4201081795.0},
-  {2158664670.0,  1910957003.0,  1604470931.0,  2122592367.0,  2780663819.0,  3218620411.0},
-  {3990201382.0,  3702916744.0,   146535241.0,   754395735.0,  2188789611.0,  2061334392.0},
-  {2983374345.0,  2069861624.0,  3454365867.0,  2308179822.0,  1550664874.0,  2713593857.0},
-  { 383335379.0,  3047456225.0,  2406417094.0,     5581877.0,  1158801481.0,  2171928479.0},
-  { 615105607.0,  1699809558.0,  2571880736.0,  1781153536.0,  3252815941.0,    10000104.0},
-  {1517532602.0,  3704804288.0,  3176371836.0,  2960713102.0,  2451186198.0,   233067538.0},
-  {3509824805.0,   309235786.0,  1305263064.0,  2297004641.0,   997001495.0,  3989965351.0},
-  { 398993329.0,   808031667.0,   648014403.0,  2162680551.0,  3430192660.0,  2434997262.0},
-  { 305543687.0,   341168499.0,   614167274.0,     5924182.0,   505200342.0,  4162186830.0},
-  { 830403782.0,  3725535740.0,  3735392573.0,    46280914.0,  2509967193.0,  1150811159.0},
-  {4041169203.0,  3330550407.0,  3358310343.0,  4238116147.0,  3332257516.0,   904827594.0},
-  {1663775260.0,  1828149028.0,   684157433.0,  1908485102.0,  1494388753.0,  2215953731.0},
-  {4066341710.0,  1159723440.0,   706477473.0,  2724146560.0,  4049882570.0,  1861492607.0},
-  {1507113305.0,  4122744504.0,  4023201007.0,  2941608697.0,  3643459770.0,   256027895.0},
-  {3437959508.0,  3945529552.0,  2535699018.0,  1010170421.0,  1111890338.0,  4213255087.0},
-  {  51351560.0,  1448474471.0,  3362138304.0,   921302021.0,  2165726394.0,  1413007153.0},
-  {2362956170.0,  1953474118.0,  2067291089.0,  3191796005.0,  1182678870.0,  1547770487.0},
-  {2964679118.0,  4294936376.0,  2298769800.0,  2958490513.0,  1045751196.0,  3417908513.0},
-  { 611803884.0,  2967145184.0,  3890677236.0,  2992585647.0,   906112965.0,  3008948634.0},
-  { 683601493.0,  4195693143.0,   772385653.0,  3395118529.0,   274147372.0,  3225495984.0},
-  { 217998383.0,  2802726542.0,  3032517757.0,  3621544176.0,  1892185497.0,  1250691886.0},
-  {2288242273.0,   461614178.0,  1505911367.0,  4282808335.0,  2991350834.0,  1901851980.0},
-  {4182929395.0,  2974049710.0,  1342084833.0,  2616067645.0,  2910189535.0,  2333035174.0},
-  { 409107893.0,  1250323015.0,   991735478.0,  1635507703.0,  2997990758.0,  4077510189.0},
-  {2287231989.0,  2770866225.0,  3905237734.0,   876018837.0,  1561088818.0,  1715916623.0},
-  { 541433109.0,  1239175828.0,   377516936.0,  1490550792.0,   757401495.0,   671496262.0},
-  {1474939093.0,   281598051.0,   496233723.0,  2957179272.0,  3355693007.0,   966758529.0},
-  {2703198080.0,  3869613817.0,  1097432793.0,  3511677476.0,  3457413678.0,  2309502762.0},
-  {3663265540.0,    62911645.0,  4061701595.0,  1762473338.0,  1557424464.0,  2886962682.0},
-  {3007706587.0,   634991523.0,   859351183.0,  3870579928.0,  3640242847.0,  1821161025.0},
-  {3831899017.0,  4249050617.0,  2379658721.0,  4094510906.0,  1421353832.0,  2643513234.0},
-  {2220935214.0,  2275884870.0,  1367704236.0,  3811303943.0,  3692637905.0,  3312498568.0},
-  {2521696298.0,   238704027.0,  3806682673.0,  2905750445.0,  4057434281.0,  2203176592.0},
-  {3309699653.0,  4054978521.0,  2682024238.0,   791034227.0,  3186855390.0,  2365378543.0},
-  {1066340011.0,  2613465018.0,  1831917712.0,  3000345087.0,   237790827.0,  1021932172.0},
-  {4165329598.0,  2094471500.0,  2617498899.0,  2331539528.0,  2816029426.0,  2105655799.0},
-  {2955107128.0,   676136222.0,   566342198.0,  3065144429.0,  2055390863.0,  2448495205.0},
-  {2786508769.0,   852515339.0,  2561906166.0,  2945736682.0,  3785107290.0,  2287634380.0},
-  { 374195902.0,  3080550475.0,  2976346956.0,  1247640761.0,    47424566.0,  3756717051.0},
-  { 780042638.0,  2591384150.0,  3521738735.0,  2647188561.0,  3719887166.0,  4025245963.0},
-  {2820853508.0,  1845533236.0,  2581796306.0,  4029076562.0,  2472518018.0,  4161726663.0},
-  {4243471629.0,  3507012777.0,  1519545812.0,   157728114.0,  2794679530.0,   440843850.0},
-  { 935048399.0,   952398737.0,  2702572753.0,  3460269654.0,  1697550694.0,  4118512320.0},
-  { 173007317.0,  3305245929.0,  3680434920.0,   163597484.0,  3801809562.0,   994055518.0},
-  {1758926776.0,   132682676.0,  1272780151.0,   298737618.0,  2593561818.0,   650749861.0},
-  { 309040592.0,   708392313.0,   899408778.0,   851480398.0,  1852636786.0,  4059555852.0},
-  {4100040948.0,  2814548816.0,   520192873.0,  2403922563.0,  1767380582.0,   776922174.0},
-  { 860821846.0,   785030883.0,  2464700462.0,  1350864505.0,  1804784573.0,  1316680017.0},
-  {1727559396.0,  3553321123.0,   815824435.0,  3663787675.0,  2691035188.0,  2476444397.0},
-  {2806215418.0,   887286905.0,  2918105512.0,  1731835134.0,   735717479.0,  1779822916.0},
-  {2254322003.0,  1278118267.0,   379892789.0,  3498718055.0,   711386936.0,  2544255524.0},
-  {1787274159.0,  1959223959.0,  3422937127.0,  2358481446.0,  1628953751.0,  3639338017.0},
-  {3697414233.0,  1652710380.0,  1565933463.0,  2793038560.0,  4090943763.0,   129183976.0},
-  {3498173141.0,   220657852.0,    36765628.0,  3385370800.0,  1815739863.0,  3095364298.0},
-  {1455144392.0,  3741765083.0,   669157916.0,  4101786422.0,   899626705.0,  2021114426.0},
-  {3132156767.0,    98659230.0,  3080787356.0,  1923746675.0,  3470812724.0,  3726618727.0},
-  { 474425456.0,  4013621006.0,  1047529229.0,  2719529576.0,   739324835.0,  2964280517.0},
-  {3846086414.0,  4144204382.0,  2462138783.0,   640493707.0,  4231444747.0,  2103513315.0},
-  {1599766749.0,  3998116848.0,  2700345976.0,  1341589710.0,  2492528931.0,   943183680.0},
-  {1751752765.0,  3937131104.0,  2564737630.0,   554155808.0,  3651136126.0,  1661831764.0},
-  {3488377334.0,  3480892424.0,  3603332536.0,  2591152031.0,   898769702.0,  2314400761.0},
-  { 217636294.0,  4040356155.0,  2963953664.0,  3147542327.0,  1458041433.0,  2936882537.0},
-  { 917325919.0,  1657147477.0,  1822989395.0,  2667686084.0,  2314397821.0,   524240244.0},
-  {4258312883.0,  3249228875.0,  3690265181.0,  3231918317.0,  3248908033.0,  4175483801.0},
-  {4097165596.0,   638044916.0,  3309171874.0,  1023090023.0,   955916234.0,  3128215358.0},
-  {3989107470.0,  2012160720.0,  4228910949.0,   677424172.0,  1518238510.0,  2784791574.0},
-  { 774032932.0,   216825336.0,  2324404952.0,   298697565.0,   189346321.0,   696475821.0},
-  {3590931823.0,  2733655278.0,   873609470.0,  3728907859.0,   185798784.0,   233777066.0},
-  {  60354197.0,  1053791206.0,  1740694547.0,   215608054.0,  1803051825.0,  4143285974.0},
-  {4182563474.0,  3004814053.0,  1065358441.0,   956948394.0,  1208323792.0,  3041410466.0},
-  {2964883431.0,  4189223657.0,  3303249550.0,  3210423384.0,   492724532.0,  2786497119.0},
-  { 835630634.0,  2079487870.0,  2309270924.0,   689312336.0,  3129782602.0,  2183027949.0},
-  { 704232896.0,  1817127236.0,  2604447722.0,   514744760.0,  3950549012.0,  1124742047.0},
-  {2547534814.0,  1521199859.0,  3790503517.0,  1761783975.0,  3110637879.0,  2675575865.0},
-  {4223235379.0,  3357713619.0,  3461247314.0,  2659437806.0,  2293009224.0,  1622031596.0},
-  {1698989239.0,  2614196074.0,   829999936.0,  1435233341.0,   868325339.0,  4191145444.0},
-  { 354198681.0,  3153738200.0,  3073776500.0,  1437588679.0,  1839158916.0,  3251003149.0},
-  {2518449426.0,   702334587.0,   621906864.0,  1559031378.0,   766037735.0,  3911487879.0},
-  {2469411816.0,   773792516.0,  2785267332.0,  2982394591.0,  2279701319.0,  1684009274.0},
-  {1616389177.0,  2313706694.0,  3090203790.0,  2993605763.0,  1078030359.0,   108206772.0},
-  {3761055605.0,  2097945658.0,   521605383.0,   274726761.0,  4004815786.0,  1107622343.0},
-  {2315274936.0,   430874703.0,  1971317032.0,  3922922963.0,  1468922792.0,  3212568968.0},
-  { 370260924.0,   385670757.0,  3788831750.0,  1611797073.0,  4211146485.0,  3332693224.0},
-  {3150151661.0,  3506453073.0,  1189163844.0,  2903163552.0,  3886762756.0,  4058318124.0},
-  {1257885831.0,   805070203.0,   848551510.0,  1766570884.0,   269511643.0,  1103507799.0},
-  {1716475849.0,  1766199612.0,   987817456.0,   372524381.0,  1917460847.0,  3159771227.0},
-  {2584944599.0,  1529233331.0,  3651137134.0,  2754835904.0,   585607108.0,   911977787.0},
-  {2102093292.0,   746867494.0,   478174509.0,  2708275760.0,  1015483585.0,  2115637260.0},
-  {1880056352.0,  1242942158.0,  1767623966.0,  4283373052.0,   710716755.0,  2800274722.0},
-  { 607212267.0,   191596576.0,  3701704053.0,  3918519762.0,  1534052467.0,   978380890.0},
-  { 184514529.0,  3642023296.0,  3401702345.0,  1563519156.0,  2797103200.0,  2157628549.0},
-  {2235847215.0,  3933313224.0,  2912678223.0,  1277150064.0,  1572824159.0,  3301468609.0},
-  {2407512294.0,  2724487456.0,   727163470.0,  3088651203.0,  1803567391.0,   612480687.0},
-  {4025351628.0,   989109448.0,  3021005370.0,  1629801655.0,  2197377917.0,   936412320.0},
-  { 862234353.0,  3666248869.0,  3096645255.0,    48852304.0,  2082543633.0,  1585050736.0},
-  { 457598041.0,  2368693495.0,  1845198514.0,  3967460591.0,  1921199235.0,  1119054855.0},
-  {3502877770.0,  3218554188.0,   495466882.0,  3375063751.0,  3790376647.0,  3439929878.0},
-  {3378351361.0,  3914873510.0,  1540942107.0,  2280538189.0,  3451135939.0,  1654022939.0},
-  {1219220225.0,  4082019154.0,  4248890121.0,   887938377.0,  2166973234.0,  2944199012.0},
-  { 574838418.0,  2541276019.0,   978624139.0,   734873475.0,  3701421938.0,   901623598.0},
-  { 979468241.0,  3488263962.0,  2289231630.0,  2685124274.0,  2135997065.0,  2856912710.0},
-  { 208304617.0,  2194644382.0,  2722974845.0,  1861153059.0,  3478462747.0,  1176975832.0},
-  {1585653749.0,   850508387.0,  3624934106.0,   496749173.0,  2875559173.0,  1047845504.0},
-  { 496024850.0,  2097480248.0,  3778991590.0,  3468630095.0,  4179543721.0,  3179786169.0},
-  {3130340113.0,  1459717916.0,  2973180517.0,  2516743907.0,  2477550481.0,  2181019722.0},
-  { 496623499.0,  3369197037.0,   556008904.0,    26358286.0,  2163698692.0,  3546141106.0},
-  { 921741981.0,  1696362419.0,  2182552937.0,  1173674580.0,  3282689283.0,  2763534742.0},
-  {3303440940.0,  3943197046.0,  3392983188.0,  2410214222.0,  1318963484.0,  2461405512.0},
-  {3662093037.0,  4275279257.0,  1766532090.0,   890199553.0,  1825902791.0,  1746217195.0},
-  {4239403732.0,   768270443.0,  3140618850.0,  4049411929.0,   882154172.0,  4291645077.0},
-  {3353802681.0,  3636427113.0,  4228639008.0,  2686620678.0,  2328064202.0,  2834112899.0},
-  {1660344948.0,  2847107384.0,  2337080651.0,   816606479.0,   921004344.0,  2769121858.0},
-  { 870326751.0,  2572258694.0,   477054607.0,  4067313461.0,  1690820844.0,  1170015238.0},
-  {1331526243.0,  2426256512.0,  1121307891.0,  3376612497.0,  3786898548.0,  3921074843.0},
-  {2807880121.0,  1347871884.0,  2592174351.0,  3764960905.0,  2791864538.0,   872066384.0},
-  { 778777092.0,  3506874608.0,   886397267.0,   387258206.0,   219138949.0,  2542372807.0},
-  {1928414516.0,  2396824245.0,   645630180.0,  3995965011.0,   510673511.0,  3097655012.0},
-  {3405215658.0,  3238916026.0,  4282587058.0,  2019959799.0,  3962117019.0,  3137049772.0},
-  {1697061393.0,  2789539550.0,  2167221102.0,   265437606.0,  3095153341.0,  1710430180.0},
-  {3520460842.0,  4174890574.0,   667912908.0,  3403204068.0,  1078626684.0,  3382653317.0},
-  { 894686482.0,   394689529.0,  3486421084.0,  4180727995.0,   260553745.0,  3391346314.0},
-  {2475494874.0,  1266125804.0,  1790458510.0,  3184156533.0,  3773661184.0,  2460863738.0},
-  {2120873615.0,  4246227286.0,  2638390908.0,  2564053473.0,  2131145046.0,  2839935336.0},
-  {3289827176.0,  3899103636.0,  3534099113.0,   944899400.0,  1560540084.0,  2747021321.0},
-  { 493364452.0,  3457821687.0,  1155886205.0,   771075510.0,  2811994460.0,  3946681449.0},
-  {1271627776.0,  1831395823.0,  3784523804.0,   405092014.0,   219153108.0,  3941130228.0},
-  {3537686865.0,   475967558.0,  3991216388.0,   892894296.0,  1244140712.0,  3866520651.0},
-  {3754446750.0,  4177109197.0,  3173525781.0,  2566363264.0,   500648122.0,  3853849861.0},
-  {2647172379.0,  3106078474.0,  1711865087.0,  3521362744.0,  3331288165.0,  3955852857.0},
-  { 459251751.0,  2408166022.0,   525051792.0,  2958911537.0,  4096835960.0,  1536236769.0},
-  {1892015158.0,   571434677.0,   963513144.0,  4230580175.0,  4129553252.0,  2661237074.0},
-  {3888730133.0,  1439269178.0,  1723494633.0,    79792079.0,  3299224630.0,  2678396603.0},
-  {3667832597.0,  1749263456.0,   880941457.0,  3202568157.0,    24048015.0,  4026341199.0},
-  {4052938886.0,  2041575005.0,   560645375.0,  2647046329.0,  1175543995.0,  3674495823.0},
-  {3708575532.0,  3927104212.0,  1996624657.0,  4043276139.0,  4171856794.0,  3040980617.0},
-  { 935733324.0,  2940399632.0,  2451210275.0,  4219665213.0,  4129319088.0,  4004046749.0},
-  {3319430408.0,   813740643.0,    23211959.0,  3638088542.0,  1203993266.0,  3489506214.0},
-  {1657573126.0,  2329036248.0,  1993692945.0,  3564825861.0,  1751953490.0,  1413717665.0},
-  { 311396372.0,  4167474549.0,    11593002.0,   459400952.0,  2591390965.0,  2221231583.0},
-  {1995442867.0,  3960271004.0,   365705672.0,  2779672063.0,   774186653.0,   595999554.0},
-  {  65373103.0,  2883571773.0,  3196979068.0,  2554546012.0,  1253011134.0,  3203593632.0},
-  {3932066353.0,  2653328132.0,  1137455228.0,  4105114174.0,  4227114001.0,  2162507548.0},
-  { 693372868.0,  2748811446.0,  3346444232.0,  1970820241.0,  2388509308.0,  1801975927.0},
-  { 522074433.0,  1196927045.0,  1356406251.0,  2080462903.0,  1001516938.0,  1146436926.0},
-  { 632410588.0,  3867022047.0,   822808702.0,  2874822183.0,  1270046688.0,  2926372247.0},
-  {2055320386.0,  2314917087.0,  3033718904.0,  3597773999.0,  1154119422.0,  2602169206.0},
-  {2708912286.0,   501300055.0,   534484316.0,  4093724526.0,     6305663.0,  4163446278.0},
-  {2898014693.0,  2524179783.0,  4197827077.0,  2280522701.0,  1027406293.0,  3703624257.0},
-  {1116968878.0,    27480951.0,  2791512369.0,  2445412139.0,  3853912456.0,  2400467234.0},
-  {3184802847.0,  1023718001.0,  1879341987.0,  2002053470.0,   119070868.0,   152924624.0},
-  {1733474304.0,  1425922260.0,  2695854674.0,  2140971999.0,  2661133335.0,  1120831067.0},
-  {2461028479.0,  3559681394.0,  2473328278.0,  2252693378.0,   783456649.0,  4247586618.0},
-  {3350420882.0,   531948838.0,  3726341792.0,  1445868848.0,  2734875225.0,  3311498410.0},
-  {2958438929.0,   757957743.0,  1917078255.0,  3839827393.0,   674849816.0,  4244988715.0},
-  {3228225902.0,  1277943361.0,  3671036453.0,  3999626837.0,   434498575.0,  2347878541.0},
-  {1665480906.0,  2820647557.0,   788474621.0,  4075235262.0,   883791883.0,  3448761858.0},
-  {2436636093.0,  2326041488.0,  2601261957.0,   878830691.0,  2002813591.0,  2938902486.0},
-  {3869954523.0,  1464281012.0,   946298350.0,   900532651.0,  3605913902.0,  3459967747.0},
-  {3145717266.0,  1026738920.0,   504595396.0,    77870740.0,    62871252.0,   433748767.0},
-  { 368882840.0,  3164782374.0,  3581125249.0,  4111288130.0,  3854284536.0,  4176406184.0},
-  {1985496552.0,  1199879464.0,  1361115334.0,  3413908696.0,  1939612867.0,   741021744.0},
-  {1779191853.0,  3778884912.0,  2155838983.0,  3001310413.0,  3817320029.0,   671884541.0},
-  {2035583410.0,     5834639.0,  1223626779.0,   837729114.0,  3986715280.0,  2782550894.0},
-  {4285100654.0,  2634176126.0,  3095670574.0,  2177108895.0,   358031266.0,  1015859494.0},
-  {4243859916.0,  1335451790.0,   369234100.0,  1093507532.0,  2574497480.0,   490146059.0},
-  {1317083678.0,   894107200.0,  3556747866.0,  3697354510.0,  2426585595.0,    68899408.0},
-  {2038337627.0,  1634648536.0,    41710400.0,  3666376614.0,  3205300765.0,  1476518581.0},
-  { 762319528.0,  1027350483.0,   781120318.0,  3471538224.0,  3114846045.0,  3195499659.0},
-  { 512391997.0,  3440323500.0,  3838866093.0,   558597047.0,  1360413381.0,  2879566683.0},
-  { 328333140.0,   531110160.0,  2133662516.0,  1425966932.0,  2776434571.0,  3061076140.0},
-  {3543143662.0,  1205815418.0,  1683718359.0,  2150991801.0,  3053071718.0,   752713911.0},
-  { 514978484.0,  3718099054.0,   438926284.0,  3057923507.0,   481540774.0,  1723010769.0},
-  {3240556982.0,  2947456207.0,    73681456.0,  3655046184.0,    61258769.0,  3433005758.0},
-  { 648835562.0,  2511412494.0,  1359699622.0,   984199533.0,  3532398415.0,  3242120926.0},
-  {2755835433.0,  2822493314.0,   959735899.0,  3957971875.0,  1704635981.0,   883115956.0},
-  { 597201764.0,   697581867.0,   297469626.0,  4017209763.0,   983096400.0,  3323823478.0},
-  {3350734522.0,  1689878967.0,   702633904.0,  3506102594.0,  1756297801.0,  1012240914.0},
-  { 706779828.0,  2126247113.0,   137820954.0,  4042509447.0,  1199158633.0,  3298148834.0},
-  { 780511277.0,  1431212011.0,  2582403334.0,  2551842033.0,  1633535153.0,  1178660679.0},
-  { 975283238.0,  2515726168.0,   927484858.0,   515696428.0,   165820356.0,  3579223861.0},
-  {2130449390.0,  2591912146.0,  1624506185.0,  1970844304.0,  3190833958.0,  3569949097.0},
-  {2073112010.0,   491909688.0,  2104728531.0,  2478155853.0,  3793401414.0,  3983586891.0},
-  {  70227499.0,  3645621092.0,  3390615199.0,  1820357845.0,   361903187.0,  1178315090.0},
-  {3101305887.0,  2065010719.0,  4199041661.0,  3296297799.0,   595574010.0,  2188127450.0},
-  { 697254325.0,  2312674440.0,  3984055733.0,  1851446389.0,   692535584.0,  2586985665.0},
-  { 896406432.0,  3159528519.0,  3383047610.0,  3280691089.0,   491807807.0,  3854577941.0},
-  {3284838810.0,  2334715843.0,  4223440058.0,  2996835813.0,  1404409526.0,  2092265568.0},
-  {1188733246.0,  2820250139.0,  2335737080.0,  3473614803.0,  4070776669.0,  1592974782.0},
-  {3273124977.0,   597136971.0,   283956680.0,  1724733440.0,  3395521357.0,  1758513878.0},
-  { 431092359.0,  3654728205.0,  2205692430.0,  3282206216.0,  2764015137.0,  3071429885.0},
-  {2867462571.0,  2488904041.0,  3923779510.0,  1696529154.0,  2178359027.0,  4227062560.0},
-  {1580562351.0,  1142729580.0,  2834429612.0,  1454646412.0,  2238698455.0,  3643519708.0},
-  { 323588672.0,   644012546.0,  2769677549.0,  1490831684.0,   205249722.0,  3215463501.0},
-  {1709749207.0,   439634766.0,  3004708635.0,  3243518112.0,  4259604206.0,  3141615286.0},
-  {1092810524.0,  4279615548.0,  2919788782.0,  2293315573.0,  1355210556.0,  3539645077.0},
-  {1046087866.0,   663894942.0,  3956613139.0,   909598317.0,   182491630.0,    91001754.0},
-  {3052959252.0,   406696973.0,  3487659273.0,  3267970848.0,  1564135035.0,    84759787.0},
-  {2408432204.0,    67051670.0,  4119123331.0,  3346298622.0,  1421588183.0,  1630128223.0},
-  {2328374004.0,  3720625783.0,  2222024088.0,  3804531403.0,  4278214250.0,  2161304082.0},
-  {2989039182.0,  2611542570.0,  1983636093.0,  4099707429.0,  2772118363.0,  2569858116.0},
-  {2253777665.0,   261574327.0,  3135362236.0,  2888746648.0,  3516559664.0,  1178778887.0},
-  { 490179773.0,  1263847769.0,  1160786654.0,  1665748929.0,  2405647082.0,  4272967417.0},
-  { 578170449.0,  2332566948.0,  4142183141.0,  2086138273.0,  1628927376.0,  1687784496.0},
-  {  37378718.0,  1685378884.0,  3997777590.0,   809732303.0,  2484355758.0,   482147025.0},
-  {2039544559.0,  2491454534.0,  1803007278.0,  1533432537.0,  3363994952.0,  2145917739.0},
-  {2714379320.0,   907922150.0,  1297354397.0,  1778032420.0,   967169951.0,  4222358458.0},
-  {3471659164.0,  3322914216.0,   733665209.0,  3114448096.0,  3399125604.0,  1819807657.0},
-  {1332230123.0,   408844243.0,  3115522991.0,  2031399933.0,  4280938447.0,   169682565.0},
-  {3541206330.0,   620438920.0,  3808147363.0,  2865295626.0,  3463206368.0,  1143622966.0},
-  {2688547450.0,  2503381652.0,  3935445875.0,  2663625400.0,  2674369069.0,   214904697.0},
-  {  30588816.0,  3548406419.0,  2002429824.0,  2631025581.0,  2065030346.0,  1586614738.0},
-  {1862734522.0,   850813787.0,  2952305377.0,  3395986005.0,  1758032358.0,  2709875199.0},
-  { 817397234.0,   876236925.0,  1007898955.0,   473480747.0,  3653916351.0,  3261906605.0},
-  {3617825528.0,  1006952382.0,  1614227921.0,  3729077744.0,  2015027702.0,  3413489435.0},
-  {2521881578.0,   791341771.0,  3592263487.0,   197844992.0,  2083900003.0,   729341849.0},
-  {2947871543.0,  4138758368.0,  1162477413.0,  3882746795.0,  3072595369.0,  1469601320.0},
-  { 224164317.0,  1741639310.0,  1100673076.0,  4046903558.0,  3614671992.0,  4290813309.0},
-  {1491287780.0,  2964370798.0,   269586239.0,   620212614.0,  1478634164.0,  2073519575.0},
-  {2293330779.0,   273875331.0,  3307750864.0,  1053782557.0,  1957349311.0,  3502625114.0},
-  {1356157319.0,   540296324.0,   665731978.0,  3482076921.0,   566383459.0,  3094089668.0},
-  {2858021237.0,   130793867.0,  2576255171.0,   948143174.0,  3901676992.0,  4087606491.0},
-  {1971298392.0,  3932977295.0,   280584975.0,  1466729609.0,  1235426987.0,  1076108259.0},
-  {4202140759.0,  1946539432.0,  1312519770.0,  2644451726.0,  1879811522.0,  3231423542.0},
-  { 457673982.0,  2236248030.0,  3105820763.0,  3274990908.0,   693452019.0,  4179695568.0},
-  {1576326285.0,  1174660987.0,  1081553298.0,  1770622640.0,  1880143350.0,  2180136792.0},
-  {3493158333.0,   381351548.0,  3722398631.0,  3170812445.0,  3948086972.0,  3311146874.0},
-  { 943415813.0,   536930194.0,  2376144237.0,  3756048811.0,    36690196.0,  1207049254.0},
-  {3879756709.0,  1273965725.0,    81519952.0,  3095691445.0,  4008772377.0,  3638185813.0},
-  { 610867270.0,   602285287.0,  3114250777.0,   302642633.0,  3918194829.0,  2862586595.0},
-  {3659923255.0,   811653063.0,  1173990556.0,  1397013773.0,  1739467663.0,  1012511771.0},
-  {1334841140.0,  2710980496.0,   343001587.0,  1116840915.0,   204973286.0,   488703167.0},
-  {1964027510.0,  3036159073.0,  2599602649.0,  3217980407.0,  2742360022.0,  2620096384.0},
-  {2380842024.0,  1073431651.0,  3079467914.0,  1280036602.0,  2950854820.0,   596150227.0},
-  {1853049745.0,  2211755692.0,  3258005809.0,  1918338777.0,  2733362972.0,   855756025.0},
-  {3187366567.0,  2868421455.0,   155357279.0,   276802036.0,  4150043075.0,   865059972.0},
-  {2167350347.0,  1754573985.0,  1469634802.0,  3857853188.0,  3994976057.0,  3316822813.0},
-  {3524263317.0,  2069175678.0,  1345341949.0,  2358618390.0,  1202394011.0,  1689037746.0},
-  {1950661684.0,  2115396210.0,   645819304.0,  2785281032.0,  3485959244.0,   908753562.0},
-  {3747755762.0,    36350720.0,   160107314.0,  2528533130.0,  1444026943.0,  3073058531.0},
-  {1335965137.0,  1206948792.0,  1039748416.0,  1476252507.0,  1445278836.0,   666771311.0},
-  {2218732278.0,  1937624419.0,   367300742.0,  2581494811.0,  3734034369.0,  3863159900.0},
-  {2183949921.0,  2932220193.0,  2547695839.0,  1095822111.0,  2862130765.0,  1597447862.0},
-  {4072403934.0,  3592137374.0,  2193590178.0,  3084421849.0,   826933902.0,  2242279503.0},
-  { 757015986.0,  2514471579.0,  1424773558.0,  1467498273.0,  4195069947.0,  3907873219.0},
-  {1963724385.0,    30627962.0,  3065838614.0,  4204501505.0,  3917953055.0,  3656264755.0},
-  {1296636626.0,  1164343654.0,  2851760092.0,  4153581154.0,   993817986.0,  2279801525.0},
-  {3580169630.0,   272069484.0,  1437732972.0,  2180570120.0,  3135589465.0,  1408941827.0},
-  {2866694865.0,  2631147236.0,  3419464560.0,  2446828938.0,  1854655361.0,  2478692917.0},
-  {3579953856.0,  2891847983.0,  2443233908.0,  1681178474.0,  3314083667.0,  2932287298.0},
-  {3506584566.0,  4049636594.0,  2251619278.0,  1802247867.0,  3105875529.0,  2763826970.0},
-  {3613943962.0,  4081049231.0,  1822937757.0,  2901545875.0,  2822153515.0,  2997884495.0},
-  {3825993826.0,   910378393.0,  2386577761.0,  1481002796.0,  2964766154.0,  2001572127.0},
-  { 760579433.0,  3883595783.0,  1440479714.0,  2282403897.0,  1084497195.0,  3039340888.0},
-  { 406593406.0,  3795694277.0,  3988665171.0,  3897785732.0,   758976452.0,  1368182655.0},
-  {1375999683.0,  1394269372.0,  4137257030.0,  3299991144.0,  4020632842.0,  3925611980.0},
-  { 302827950.0,  1161473494.0,  3473376536.0,  3916458328.0,  1884687314.0,  3919377451.0},
-  {3316752966.0,  4038430669.0,  3676187865.0,  3138417851.0,  3837924995.0,  3588031906.0},
-  { 342707563.0,  2255792381.0,   609273682.0,  3647028885.0,  4188652101.0,   741779575.0},
-  {2533679329.0,  2659678944.0,  3038266358.0,  4046548541.0,  3661997294.0,   163537201.0},
-  {1975791621.0,   980794593.0,  2935170166.0,  4120430503.0,  3304380476.0,   763368418.0},
-  {1766118600.0,  2331351492.0,   459138742.0,  3208379076.0,  3936412458.0,  2771952879.0},
-  {1906375687.0,  2293416422.0,  3330428961.0,  1371091256.0,  3652010684.0,  2790271659.0},
-  {1829172204.0,  2618845283.0,  1195306909.0,  3885155791.0,  3965084106.0,  2311399104.0},
-  {3726235858.0,  3432588156.0,   567433306.0,  3931566864.0,  3603780552.0,  1755129119.0},
-  {3929119175.0,  1095656555.0,  1344688872.0,   111113225.0,  3392486852.0,  2787240561.0},
-  {1734777372.0,  3585627324.0,  2385921549.0,  2301138864.0,  1386639617.0,  1051765345.0},
-  {2149482103.0,  1506238199.0,  2568701072.0,  1485934179.0,  1570346223.0,   682963136.0},
-  {3861932997.0,  2027445149.0,   527512977.0,   111457107.0,   411737340.0,  2055494183.0},
-  {2183407138.0,   194540861.0,  4054753133.0,  1674314368.0,  3667841266.0,  2454329438.0},
-  {3056534854.0,  1049070589.0,  3931265367.0,  1380039381.0,  2246489711.0,  2731172848.0},
-  { 896581586.0,  1682122627.0,  3264947845.0,  3239652647.0,  1803898683.0,  2406377897.0},
-  {1550609704.0,  2526621496.0,  1221709678.0,  1054990030.0,   195760519.0,  2387448031.0},
-  {1723510487.0,  2711073276.0,  2419886149.0,   335062880.0,  2719455181.0,  3566388212.0},
-  {2675624742.0,  1175583978.0,  2484185915.0,  1977085991.0,  1939809730.0,  1376546222.0},
-  {3864962505.0,  1594802606.0,  3338887418.0,  1941626562.0,  2778451431.0,  1571881715.0},
-  { 930587815.0,    76549674.0,   709547485.0,  1421112056.0,   578884773.0,  1561464357.0},
-  {4008074493.0,  3241578146.0,  3710137804.0,  2246613164.0,  4106150556.0,  1329883107.0},
-  { 506191570.0,  3559856952.0,  2449342670.0,  2458896112.0,  1271184768.0,  1829207532.0},
-  {3338866127.0,  3489362088.0,   915335142.0,  2880133927.0,  3880108565.0,  1045232408.0},
-  {2975225950.0,  1948636388.0,  4220417885.0,  1233292796.0,  1459249285.0,  1847726278.0},
-  {2139611814.0,  1993452897.0,    97659074.0,  2214558519.0,  2100642617.0,   723907613.0},
-  {1595027839.0,  3016369288.0,  4090350748.0,  1397524467.0,  2287636623.0,  3657354249.0},
-  {2955904802.0,   997531000.0,  1794712740.0,   297557644.0,   210049314.0,  4067192739.0},
-  {2509164209.0,  1194699966.0,   520666681.0,  1068226375.0,  1972512503.0,  2211614536.0},
-  {1677362697.0,  2496313827.0,  3900468367.0,   768322823.0,   906153429.0,  2371040664.0},
-  { 433366604.0,  1297768519.0,  1280135779.0,   943607921.0,  1028141130.0,  3352521434.0},
-  {4218805705.0,  3184006518.0,  3484181986.0,  3563438297.0,  2180058949.0,  3728040939.0},
-  {4294624677.0,  4019054769.0,   762438968.0,  1887081412.0,  3689111826.0,   355069068.0},
-  { 499912411.0,  4291949276.0,  2073313389.0,   644499083.0,  3222121745.0,  1686585513.0},
-  {1958428522.0,  2853908024.0,  2506392259.0,  2138811983.0,  2559384129.0,  3166534694.0},
-  { 952946837.0,  3218686164.0,   795486796.0,  3960386347.0,  1592841597.0,  2445194191.0},
-  {2421988549.0,   548557611.0,  2940485866.0,  1315595703.0,  3746702905.0,   925508595.0},
-  { 775304989.0,  4069577399.0,  3455843391.0,   645926927.0,  3761390688.0,  3074132443.0},
-  { 417992798.0,  1652787384.0,  2052836875.0,   686081373.0,  1266207543.0,  1999164673.0},
-  {2101134047.0,   795746077.0,  3176835774.0,  3558239741.0,  1505855082.0,  2372825825.0},
-  { 557112642.0,   462785059.0,   662558563.0,  2876201671.0,   209603477.0,  3310531797.0},
-  {3839331323.0,  4216222199.0,   470396437.0,  2736994396.0,  3782097997.0,  3055809907.0},
-  {2196276055.0,  2449016279.0,  1739346191.0,  2657401973.0,  4203998613.0,   124595117.0},
-  {3182814261.0,  2584496955.0,   764054046.0,  4100112835.0,    62252601.0,  1033760790.0},
-  {3082875875.0,   243767378.0,  3277032569.0,  1679473148.0,   872818337.0,   459916045.0},
-  {3136550366.0,  1797861747.0,   600795237.0,  1549971948.0,   670249295.0,  1036625892.0},
-  {1230999127.0,  2427745901.0,   506936081.0,  1463114006.0,  1892818246.0,  3896336159.0},
-  { 926593376.0,  1037240084.0,  3491939230.0,  1735940185.0,  1538970736.0,  3512395771.0},
-  {2312333167.0,  2535898449.0,  2636818997.0,  1412141898.0,  1255708352.0,    74323987.0},
-  {2239879935.0,  2586759389.0,  1948327930.0,  1009125873.0,  4118658381.0,   485634932.0},
-  { 790717849.0,  4023771212.0,  2096662679.0,   548101953.0,  3681301981.0,  2410912994.0},
-  {3047636090.0,  2108084832.0,  2259207593.0,   127904759.0,  1183234485.0,  2623534305.0},
-  {2719126452.0,  2602398841.0,  3791120914.0,    39871429.0,  2257404056.0,   245421341.0},
-  {2024838791.0,  3318577210.0,  2196114369.0,  1218928491.0,  1214839256.0,  2915260136.0},
-  { 427970603.0,  2705438975.0,  4166607559.0,    73936928.0,  2761187549.0,  2024838887.0},
-  {1394201259.0,  3352536164.0,  2018444407.0,   891388821.0,   514763605.0,  2398313717.0},
-  {1878994154.0,  1635388022.0,   782291143.0,  3493975518.0,  2653838862.0,  2649117407.0},
-  {2566091064.0,  3400924711.0,  3219029076.0,  3007416149.0,   386186895.0,  2850811964.0},
-  {1500908753.0,  2903841039.0,   324120902.0,   112246674.0,  4224291739.0,  1901810739.0},
-  {2594435778.0,  3658528231.0,  4122669135.0,   161662797.0,  1800664329.0,  1378876961.0},
-  {1599358280.0,   606880307.0,  1380246345.0,  3680679167.0,  4005960287.0,  3501745211.0},
-  { 636665129.0,    90410201.0,  2319960943.0,   248984017.0,   296718987.0,  1322357563.0},
-  {2464801490.0,  2520289868.0,  1192970767.0,  1597102074.0,  2540247503.0,  3933798810.0},
-  { 750926262.0,  3060740700.0,  2745390842.0,  3110414378.0,  1747898821.0,  1226396631.0},
-  {1638302402.0,   150315895.0,  2248886292.0,  2329454833.0,   626537811.0,   747729322.0},
-  {2830735957.0,  3177690647.0,  2949817619.0,  2384672585.0,  3113320791.0,   202881651.0},
-  {1704422873.0,  2332628845.0,  2506884063.0,  4238295522.0,  2425437480.0,  3199379132.0},
-  { 599893856.0,   245410909.0,  4253945086.0,  1131839135.0,  4183243454.0,     4734733.0},
-  {2614036169.0,  2014662000.0,  1710986591.0,  2226013138.0,  1308215442.0,   395046596.0},
-  {2900124805.0,   837428793.0,  3826504046.0,   109034536.0,  3918978317.0,  3569782931.0},
-  {1416086586.0,  3801831933.0,  3745331980.0,  3029446081.0,  1087828636.0,   385229264.0},
-  {3843028795.0,  3414441653.0,  2246685044.0,  1926083412.0,  3189873308.0,  3684583538.0},
-  {1622078024.0,   302280564.0,  3331035439.0,   857265883.0,   276676430.0,   646432038.0},
-  {3192705829.0,  3328000627.0,  1367259952.0,   232909995.0,  2735781021.0,  2210244043.0},
-  {2300392774.0,  2182149215.0,  2755104891.0,  1179722732.0,    48943679.0,  1794824371.0},
-  {3306684666.0,  2373310829.0,  4027499817.0,  1527759246.0,   968908793.0,  3134883238.0},
-  {3788567590.0,  3743906985.0,   472612175.0,  3531768213.0,  3177756740.0,  3682159777.0},
-  {2707114248.0,  1415310877.0,  3354532806.0,  3741931618.0,  4283869601.0,  1153307272.0},
-  { 963238973.0,  2977287700.0,  3584355677.0,  4097481589.0,  3744330470.0,  3389387642.0},
-  {1236661449.0,  3310779395.0,  3539991542.0,  3920405830.0,  1840987195.0,  1123625214.0},
-  {3577501312.0,   677955387.0,   358643369.0,   757761212.0,  3174077244.0,   125866475.0},
-  { 712679444.0,  2828720199.0,   791442259.0,  3040965992.0,    94496384.0,  4035514403.0},
-  {2264467607.0,   573577760.0,  1191331158.0,  1646858816.0,  3129123313.0,  2967515638.0},
-  {2101914991.0,  3934801650.0,  3279168330.0,  1825511857.0,  4092115730.0,  2439651682.0},
-  {1985037480.0,   176735210.0,  2475984386.0,   149549164.0,  3554501907.0,  1536467167.0},
-  { 157356586.0,  4283923825.0,  2435835053.0,  3411548616.0,  3429304417.0,  1651550612.0},
-  { 810712314.0,  1638716682.0,  2723484541.0,   943954469.0,   631181434.0,  1784646587.0},
-  {3897088041.0,  1167009179.0,  2822157811.0,   335949382.0,  2265796958.0,  1354795303.0},
-  {1687430443.0,  1462422143.0,  2203584015.0,   463081200.0,  1409985424.0,  3103718451.0},
-  {3947273352.0,  1468135609.0,   999231728.0,   126915011.0,   703874508.0,   154190332.0},
-  {2322300616.0,  2692504270.0,  4258936522.0,   950097035.0,  2563296628.0,  1239538008.0},
-  {2827864698.0,  1486653031.0,  1964009744.0,  3994124195.0,  2211899306.0,  1853690145.0},
-  { 365789995.0,  1208148855.0,  4185243527.0,  2158674762.0,  1471867934.0,  3531848745.0},
-  {2121144846.0,  3971767579.0,  1485424898.0,  3312306485.0,  2713920058.0,   659565711.0},
-  {1048582560.0,  2812753478.0,   680113267.0,  4166687697.0,   528141392.0,  3750031566.0},
-  {3011874950.0,  1637254089.0,  1743524884.0,  1964321744.0,   316385141.0,  3125472028.0},
-  {1837559492.0,  4259772286.0,  2104018804.0,  3200782961.0,  3527123896.0,  1747966808.0},
-  {4025730731.0,  3021027332.0,   656056196.0,  2029822410.0,  3928795855.0,  2211492214.0},
-  { 119645782.0,  3805577963.0,  3196799095.0,  3079020785.0,  3912268938.0,  3946305673.0},
-  {2746555910.0,  1299158008.0,  3631083784.0,    22920208.0,   407630148.0,  1751053192.0},
-  {3728913749.0,  3045251209.0,  2653525638.0,  3995304334.0,  3813007018.0,  3842294105.0},
-  {2087214040.0,  3584966699.0,  1563898398.0,  2646836282.0,  2678504239.0,   132469163.0},
-  {2956615562.0,   670881503.0,  1139948106.0,  3311609361.0,   282979086.0,  1651598644.0},
-  {3317319803.0,   923736041.0,  1978685976.0,  3409311280.0,  2339131995.0,  1291107667.0},
-  { 964650728.0,  3036112070.0,  1851267314.0,  3897030115.0,  2911398790.0,  3937340534.0},
-  {3729351342.0,  3170763685.0,    78261390.0,  2749259641.0,  3189089669.0,  4168693808.0},
-  {1257691216.0,  3839447371.0,   824273463.0,  4012846570.0,  1485235043.0,   726158824.0},
-  {4145006426.0,  3159915862.0,  2449185602.0,   426559370.0,  3292974187.0,  4277016828.0},
-  {2696011898.0,  3830611569.0,  1974423865.0,  3659220708.0,  4198931032.0,   190310368.0},
-  {3285757554.0,  1364377607.0,  2780022850.0,  2819500973.0,    65850492.0,  3719694430.0},
-  {2117508624.0,  3762801140.0,  1382334168.0,  1512509376.0,  1624250487.0,    59699869.0},
-  {1712939903.0,   429777877.0,  3440770358.0,  3476038247.0,  3592592301.0,   675173582.0},
-  { 678238337.0,  4134672027.0,  1329356631.0,   114103619.0,  1804533526.0,  4190799372.0},
-  {3289400255.0,  2076876769.0,  4060866872.0,  1127091083.0,  3055903873.0,   933314089.0},
-  {3416366535.0,   160239869.0,  3552343270.0,   716066963.0,  2922858612.0,    44617673.0},
-  {2922281114.0,  2135511791.0,  3579009290.0,   973383953.0,  3534044455.0,  3690953849.0},
-  {2453036976.0,  2402217467.0,   547038549.0,  2396247414.0,  3858721279.0,   563562029.0},
-  {3976143240.0,  3847461863.0,  1112440515.0,  2172716512.0,   147503768.0,   862440944.0},
-  {1349801270.0,  1951942367.0,  1115097822.0,  2406473540.0,  2640935199.0,  3115307465.0},
-  {1270548452.0,   833752842.0,  3285706507.0,   392177162.0,  1351352931.0,  1499604739.0},
-  {2163291595.0,  4265506137.0,  1489853226.0,  3595839014.0,  4123203502.0,  2100704638.0},
-  {4059239674.0,  3371058077.0,  2354937160.0,   923039043.0,   330518501.0,  2184971310.0},
-  {2853424377.0,   131132544.0,  3105140234.0,  3093709197.0,   796250811.0,  2772951365.0},
-  {2737648781.0,   846051715.0,  1384344840.0,   480256566.0,  4016993148.0,  3253150462.0},
-  {  49127103.0,  3900912766.0,  2412434650.0,    83288075.0,  3305429211.0,   615159777.0},
-  {1409848108.0,  2284165699.0,  3840360762.0,   364189977.0,  3147946747.0,  1440728019.0},
-  {1977302310.0,   711255048.0,  2304235247.0,  4093452243.0,  2355445067.0,  1138810221.0},
-  {3660771010.0,  1444316910.0,  2681158250.0,  2817922801.0,  3017306327.0,   111517916.0},
-  { 740032539.0,  2489742943.0,  3589849607.0,  3987325063.0,  4191563512.0,   831423783.0},
-  {1447688694.0,  1356440082.0,  3505429072.0,   363495856.0,  3599857640.0,  2733935526.0},
-  {2773988331.0,   900964049.0,   248046997.0,  3461391268.0,  1786546133.0,  1254879669.0},
-  {4023221803.0,   708524583.0,   984628957.0,  3866044400.0,  1273933425.0,  1546350355.0},
-  {2712812218.0,  2907521021.0,  2826562020.0,  3405026913.0,  4252196074.0,  3275360300.0},
-  {2701512781.0,  3810414220.0,   253772839.0,  4215972220.0,  1309921149.0,  1485222205.0},
-  {3852718449.0,  2540919844.0,   288345594.0,    22421155.0,  4232561385.0,  3367518526.0},
-  {1755437680.0,   834440075.0,  3408182754.0,  2480336187.0,  1975812732.0,  2379372496.0},
-  {2071679095.0,  1421908931.0,  3799505890.0,  1829906387.0,   918522661.0,  4166372114.0},
-  { 374487170.0,  3943264405.0,  1784507077.0,  1263776286.0,  2434232236.0,  4239289231.0},
-  {1698153108.0,  3299180794.0,  3395666532.0,  2941356628.0,  1893041573.0,  4165677850.0},
-  {1251225414.0,  1495203188.0,    58444906.0,   118204736.0,   255975714.0,   478760437.0},
-  { 836267831.0,   241729728.0,  1972926472.0,  1226212888.0,    26339619.0,   880914715.0},
-  {3819719381.0,  2082146224.0,  4083891640.0,   487753450.0,  2290543781.0,  2788622639.0},
-  { 771730869.0,  1474997769.0,  3710710038.0,  3113096545.0,  1689279640.0,  2487360536.0},
-  {2534947103.0,  1426434582.0,  1060227510.0,   464596309.0,  1106901370.0,  1966154307.0},
-  {3615667231.0,   127598101.0,  1196714760.0,  3583625903.0,   539598731.0,  2049134156.0},
-  {2346843204.0,  3993921902.0,   542586641.0,  1445917368.0,  3468678212.0,   513142821.0},
-  {3063912136.0,  1892905082.0,  1242211666.0,  3839871591.0,   900391827.0,  2660984445.0},
-  { 545065966.0,  3033651959.0,  3013705729.0,  2894115547.0,  3872636995.0,  1109196615.0},
-  {3369790534.0,   995794192.0,  3945439695.0,  3435287628.0,  4016088694.0,  3015278026.0},
-  {3203120682.0,   197627182.0,  3698815759.0,  3892525171.0,   259519064.0,  3548151831.0},
-  { 639188016.0,  2996328022.0,  1430776248.0,   883353690.0,  3583684838.0,  3795798704.0},
-  {2558557365.0,  2326597204.0,  3178841477.0,  3946674679.0,  1641643977.0,  2195775221.0},
-  {2270108929.0,    45130451.0,   924513735.0,  3983577232.0,  3505124796.0,  3204001670.0},
-  {3963092955.0,   675076091.0,   387872275.0,  3174915529.0,   703155748.0,  3735941375.0},
-  {1282766273.0,  2005184803.0,  1512005708.0,  1006669928.0,   104759000.0,  2760230536.0},
-  {3440710164.0,  3517373083.0,  2964058051.0,  3503669260.0,  2190076032.0,  3358866419.0},
-  { 421577268.0,  3059774762.0,  3864040814.0,  1455133296.0,   121145728.0,    79868541.0},
-  {1069134078.0,  2112918624.0,  2341118503.0,  2231278699.0,  2552435464.0,     7940893.0},
-  {3931422105.0,  2252222706.0,  3533885652.0,  2673623338.0,   979719302.0,  2997844467.0},
-  {4009398591.0,   844816994.0,  1268295037.0,   895451826.0,  1458333708.0,  3943691506.0},
-  { 919455059.0,  2356663315.0,   476199971.0,  3460257248.0,    41280542.0,  3225242276.0},
-  {3754027883.0,  4272650516.0,  2420447171.0,  1835020781.0,  3303049092.0,  2617238059.0},
-  {3570105638.0,  3112615211.0,   386472175.0,  4152019421.0,  1632917856.0,  3561857464.0},
-  {3438767538.0,  1895446086.0,  4153827568.0,   211555557.0,   228067365.0,   569862207.0},
-  {2894498647.0,   964077364.0,   174624170.0,   868830362.0,  1548587578.0,  3747585975.0},
-  { 312102746.0,  3042028755.0,  1731485598.0,  1084544568.0,  1795710822.0,   478705052.0},
-  {1476596895.0,  3798800058.0,  1766667114.0,  1388794644.0,  3711748953.0,  2425051700.0},
-  {3249723348.0,  1883467183.0,  3537616391.0,  3203959817.0,  3071330385.0,  1061039197.0},
-  {1591109104.0,  3916260841.0,  2521673048.0,  2211583442.0,  3977170551.0,   215618147.0},
-  {3284029037.0,   380330213.0,  1038631940.0,  3971774783.0,  3134220288.0,  2985905089.0},
-  {2729511246.0,   941931657.0,  3176986260.0,   543249567.0,  2360221763.0,  4144089110.0},
-  {2925173027.0,  3888895694.0,  1046260414.0,  1557481258.0,  1251278344.0,   246980014.0},
-  {1971672915.0,  2545247611.0,  3955247741.0,   825410128.0,   651708627.0,  4100794586.0},
-  {1799805017.0,  3593570210.0,  2235790993.0,  3447307171.0,   909105995.0,  1908887898.0},
-  {3834212973.0,  3212866342.0,  1202548768.0,   419841384.0,  1528847088.0,   164086107.0},
-  {2346973131.0,  1438170246.0,  1984316823.0,  3736585415.0,  1560252975.0,  4144246483.0},
-  {1002757653.0,  4243981276.0,  2994869533.0,  3614991267.0,   435687977.0,  2062403545.0},
-  {1750222753.0,  1405059162.0,  1852468904.0,  1038091096.0,  3237265275.0,  3756167358.0},
-  {3015257903.0,  3570573693.0,  3638829754.0,  1776546043.0,  1917351893.0,   328834873.0},
-  {1918266566.0,    43360708.0,  3341610134.0,  3599329772.0,   357510009.0,  1020230643.0},
-  {3304898416.0,  3392682623.0,  3589817113.0,  3314167291.0,  4091149539.0,  1730891472.0},
-  {3568940885.0,  2287802597.0,  2072598666.0,   394838690.0,  1126581598.0,  1580980837.0},
-  {1819629474.0,  2477448608.0,  2045303092.0,  1819668467.0,  3382800241.0,  1894970482.0},
-  {2363245421.0,  3376289895.0,  3221959146.0,  3918824969.0,  3013606951.0,  3333160178.0},
-  {2336311454.0,   459608044.0,  1786447464.0,  4181701878.0,  2267144579.0,  2600735839.0},
-  {2680688588.0,  3920156609.0,  3686699210.0,  3535607814.0,  3660450019.0,  3401755407.0},
-  {3378279524.0,   393467484.0,  2336259245.0,  2906604917.0,  1662723355.0,    77599252.0},
-  {1345205069.0,  1745267179.0,  3366688437.0,   985248864.0,  2907145468.0,   226207450.0},
-  { 175662573.0,  3491333295.0,   927194231.0,  3836766724.0,   627874124.0,  3746399464.0},
-  {3928611081.0,  2754129462.0,  3863594069.0,   866905191.0,  3660458455.0,  3097170307.0},
-  {3604382434.0,   592310991.0,  4269107956.0,   474646343.0,  2198840612.0,  1466180791.0},
-  {1814181807.0,  2026960876.0,  1458396496.0,  2324006033.0,   809362542.0,  2574997194.0},
-  {2894734471.0,  3335047603.0,   192810783.0,   164953545.0,  1511201521.0,  2469249962.0},
-  {1144439261.0,  1613645595.0,  3247306214.0,   937495065.0,  3501083684.0,   383252305.0},
-  {2361076357.0,  3783913210.0,  1368098969.0,  4209431010.0,  2598004038.0,  1795293434.0},
-  {3438168776.0,  2025397589.0,  2854612598.0,  2426621401.0,  3349381634.0,  1505497383.0},
-  {1189588993.0,  3539427726.0,  3085496671.0,  1317047818.0,  1575546007.0,  2589524107.0},
-  {2222736806.0,  2056070218.0,  2368346898.0,  4018955188.0,  3857881072.0,  2946879896.0},
-  {3460687683.0,   330799309.0,  2643600178.0,     4908562.0,  2923287109.0,  3076656805.0},
-  {3939757160.0,   275680860.0,   476092446.0,  2473713497.0,   964792813.0,  1020264462.0},
-  {1417471977.0,   917904876.0,  1031231619.0,   406696853.0,  1515958834.0,  3932684533.0},
-  {3296009987.0,  3892605427.0,   510349534.0,  3044113499.0,  2556808155.0,  1887567057.0},
-  { 959530980.0,  3772082718.0,  3950830163.0,   375565685.0,  3080889406.0,  1397022892.0},
-  { 626126389.0,   494940974.0,  4247540858.0,   303982809.0,  2736814700.0,  1361617447.0},
-  {2988809732.0,  3196349657.0,   545165570.0,  1186717565.0,  2478650482.0,  1675415807.0},
-  {2754758582.0,  3557698222.0,  4248577887.0,  2510041255.0,  4120473192.0,  1818894755.0},
-  { 374891193.0,  4187858060.0,   784764206.0,  3613751692.0,  4129027058.0,   776026931.0},
-  { 306090264.0,  3691393887.0,  2996202210.0,   910750686.0,   698517586.0,   259771557.0},
-  { 574682397.0,   530508911.0,  1551699609.0,  1594385772.0,  1792020530.0,  3397142310.0},
-  {3673128301.0,  3242488080.0,  2479806706.0,   875452026.0,  1660860609.0,  1966055746.0},
-  {2471172450.0,   757406246.0,  1290908713.0,  3732658730.0,  2136647411.0,  3543080659.0},
-  {4043610576.0,  3328599152.0,   290518978.0,  3577714590.0,  3940298562.0,  1974577087.0},
-  {2789306613.0,   582072601.0,  3271913199.0,  2899433282.0,  3744663506.0,  2288250049.0},
-  {1932039982.0,  2755913630.0,  3416190097.0,  3717560333.0,   899216905.0,  1082789907.0},
-  { 157243374.0,  4050949535.0,   857131691.0,    54409521.0,  3079803745.0,  1647629051.0},
-  { 717382393.0,  3910845888.0,   723527680.0,  1137735605.0,  3995454071.0,  2567593874.0},
-  { 701835969.0,  1401353227.0,  3492684572.0,   449999405.0,  2645398929.0,  1617727643.0},
-  {1583797622.0,  2017371336.0,   694054003.0,  3112708931.0,  4103246757.0,   522682541.0},
-  {3748754174.0,  2762791288.0,  3026817598.0,  2321337938.0,  2004692436.0,  1459307607.0},
-  {2827453735.0,  3621819594.0,  2063701387.0,   267252276.0,  1402034536.0,  1138515566.0},
-  {1058512237.0,  1583870606.0,   156310691.0,   604692340.0,   155867023.0,  1847638999.0},
-  {3143965552.0,  2262685729.0,  2228010020.0,   592709836.0,  1481299849.0,  1276670282.0},
-  {3328365674.0,  3597123045.0,  1407655291.0,  2043050480.0,  2783256003.0,  2365164145.0},
-  {1798273071.0,   818779185.0,  4192991010.0,  2401216719.0,  3445478602.0,  2231771818.0},
-  { 125225422.0,  2734267808.0,  1680793342.0,  2610031213.0,  3655240711.0,  2168062520.0},
-  {3421168219.0,  3152842809.0,   166124949.0,  1606608187.0,  3040027065.0,   578068172.0},
-  {2813810936.0,   536264974.0,  2745875232.0,  2063925861.0,  2433243638.0,  3659868910.0},
-  {2164942201.0,  3730900554.0,  1840533899.0,  1587085798.0,  1292258800.0,  2153278272.0},
-  {2498976819.0,  2237820748.0,  1642149404.0,  1272801838.0,  1361081867.0,   109342781.0},
-  { 867704498.0,  3878779348.0,  2770390142.0,  1576447966.0,  3472419355.0,  1501096906.0},
-  {3347903685.0,   310644624.0,   878296386.0,   831951307.0,  1773336301.0,   683811200.0},
-  {3375653326.0,  2823613339.0,  3806122867.0,  1822798097.0,  1925570047.0,  2660555751.0},
-  {1416292996.0,   190049693.0,  1983947480.0,  3824949653.0,   237866024.0,    55246385.0},
-  {1776631305.0,  1052982846.0,  2130020160.0,  1986582816.0,   669087957.0,  1053613164.0},
-  {3706563258.0,   968024585.0,   266751704.0,     5824856.0,  2043640800.0,  3141405078.0},
-  { 546235266.0,  2776401106.0,  2309054066.0,   667489374.0,   603689880.0,  1124604761.0},
-  { 779239483.0,  2145996267.0,  1298768375.0,  2287649497.0,  2552161383.0,  1983419553.0},
-  {2202375653.0,  1944353990.0,  3395932847.0,  1215075056.0,  4047999383.0,  1597092882.0},
-  {1380992502.0,  3342504024.0,  1090143738.0,  3424391427.0,   929443758.0,  2242560868.0},
-  {2739879732.0,  3481808780.0,  3982082854.0,  3262952851.0,  1001725026.0,   986475083.0},
-  {  74366059.0,  2621753897.0,  2239786352.0,   567432876.0,  1318783895.0,  1574847915.0},
-  {3772802452.0,  1345760228.0,  2788684691.0,  3719607866.0,   239290937.0,  1988735435.0},
-  {1114915176.0,  2275839777.0,  2740915090.0,  2255864964.0,  2293456269.0,   529015133.0},
-  {1953879823.0,   446400621.0,  1070316974.0,   514290538.0,  3772743686.0,    42189235.0},
-  {1380420656.0,  1164863081.0,  2193363783.0,  2673854900.0,  3593298571.0,   821639271.0},
-  {2430560122.0,  1723562297.0,  1712374561.0,  3585648363.0,  3051895369.0,  2499789205.0},
-  {  96098110.0,  2948974272.0,  4058259452.0,  1181358091.0,   720670280.0,  1717555019.0},
-  {2575367896.0,  1154859763.0,  4106131178.0,   205202111.0,  2914373910.0,  1498845412.0},
-  {1528472610.0,  3074239904.0,  2049023360.0,  2103937359.0,  3539590189.0,  1497909459.0},
-  {3206271421.0,  3783460366.0,  2885364405.0,  1017876879.0,   472804824.0,   868787170.0},
-  {3179742125.0,   739900811.0,  4256835787.0,  1449429812.0,  1286087091.0,  4234664987.0},
-  {3932291744.0,  1431918183.0,  3927135208.0,  3070778739.0,  2487369521.0,  1277639962.0},
-  {2007924161.0,  3898312570.0,  3492544706.0,   661948036.0,   188074848.0,  1180736231.0},
-  {1966783721.0,  1732184909.0,  2739645690.0,  4103349508.0,  2345683442.0,  1350870302.0},
-  {1143468613.0,  4129215632.0,  1153100386.0,   727423497.0,  1457162995.0,  1261294355.0},
-  {3270673374.0,  1476080901.0,   155931797.0,   269946981.0,   195177541.0,  2104542004.0},
-  {3659580109.0,  4104079382.0,  3964140682.0,  3859867259.0,   138442909.0,  2671147650.0},
-  {1754198571.0,  3299469546.0,  4030299509.0,   591943882.0,  2719705211.0,  3719640699.0},
-  {3868040662.0,  2862413445.0,  1008822848.0,  3040824108.0,  4058526326.0,  3875119573.0},
-  { 784448116.0,  2591692724.0,  2587976523.0,  1617742493.0,  3342204858.0,  3922325526.0},
-  {2517872130.0,  1465669777.0,   644042798.0,  3318649174.0,  4145104564.0,  2189919570.0},
-  {1818314460.0,   661040976.0,   374547713.0,  2373266321.0,  3724227403.0,  2310139872.0},
-  {3080171696.0,  4141524677.0,  2821018090.0,  3919776364.0,  1466175994.0,   995101497.0},
-  {2450387060.0,  3125728298.0,  1530942409.0,  1224073524.0,  1272624157.0,  3633806188.0},
-  {2998889889.0,  2964062834.0,  1732220126.0,   105570298.0,  2420959062.0,    63042461.0},
-  {2878446841.0,  2556891005.0,  3990454095.0,  2349100860.0,  3332479711.0,  1603122137.0},
-  {2810194956.0,  2023627393.0,  2151646312.0,  3562131899.0,  3188403688.0,  3431107207.0},
-  {2408750923.0,  1721866277.0,  1860889809.0,  1258781446.0,  4226072121.0,  3655895407.0},
-  {1313295259.0,  4140452696.0,  3979519087.0,  4010397215.0,  3399022198.0,   541466766.0},
-  {3584423517.0,   878321934.0,  2856511998.0,  1546915135.0,   656798531.0,   962839479.0},
-  {3508831422.0,  2469147981.0,   389054077.0,  2120395212.0,  1651093536.0,  1447895383.0},
-  {3185539766.0,  3913900083.0,  2935632770.0,  4007501541.0,  2656768423.0,  3278109046.0},
-  {2554179190.0,   488429883.0,  2688111513.0,  1169468981.0,  2593264802.0,  2651000938.0},
-  {3420534641.0,  1888177820.0,  3125948321.0,  2917216700.0,  2603517797.0,  3570263407.0},
-  {2199593167.0,  2454263769.0,  2674857744.0,  3697824802.0,  1561060945.0,   367723604.0},
-  {1282917741.0,   686305734.0,  2258879366.0,  2660837686.0,  2493219184.0,  4018951243.0},
-  {3700841133.0,  4291385626.0,  4128853316.0,   583590710.0,  3949708618.0,   105187250.0},
-  {3373058988.0,  2661411740.0,  3802596013.0,  2790221185.0,   182750137.0,   282912013.0},
-  {2749379671.0,  3897950413.0,  1452455314.0,  1361096918.0,  1380118192.0,  3397591607.0},
-  { 619818315.0,   679974763.0,  1371487252.0,  4207622665.0,  4107355670.0,  2824382068.0},
-  {2456070462.0,  2979580418.0,  1821986542.0,  4123752545.0,  1703635703.0,  2485116403.0},
-  {3104884531.0,  1914057758.0,  1438590636.0,  1419225233.0,  1670593313.0,  2757973777.0},
-  { 824072024.0,  2324045741.0,  3739698319.0,  1160474359.0,  3498472992.0,  3645127566.0},
-  {2052915764.0,   810441953.0,  2140837660.0,   769588020.0,  1960734962.0,  2545143698.0},
-  {2166773084.0,   504616422.0,   843438384.0,  2824783789.0,  1774257938.0,  2334398741.0},
-  {1796359330.0,   817872921.0,  2960304946.0,  1731170421.0,  2918648741.0,  1488800280.0},
-  {3051031145.0,  1560968772.0,  2839927594.0,  1702687300.0,  3580597255.0,  3547353606.0},
-  {3841826846.0,  2345834503.0,  3465628394.0,  1913303924.0,  1650545013.0,   309852309.0},
-  {3707825837.0,  1729234713.0,  3775985552.0,   635802664.0,  2558615490.0,  3399558229.0},
-  {3488240293.0,   495869477.0,  1116745103.0,   887763926.0,  1478091207.0,  1096926932.0},
-  { 497542779.0,  4239464032.0,   459890838.0,  1501745183.0,  3253096946.0,  3535118222.0},
-  {3935786046.0,  2125030578.0,  4152705043.0,  1630786274.0,   353529772.0,   701946137.0},
-  {4050073742.0,  3069537401.0,   337186755.0,   959985923.0,   504310725.0,   625366219.0},
-  {  38459803.0,  2777677578.0,  1041612393.0,  1987738572.0,  3827806355.0,  1963310358.0},
-  { 160909608.0,  3006735104.0,  1285144810.0,  3163098071.0,  3003733615.0,  2671346733.0},
-  {2334332260.0,  3313974792.0,  2930095413.0,  3039879873.0,  1175158282.0,  3798216484.0},
-  {3405476757.0,  3221054515.0,   666222848.0,   106115259.0,  3321012397.0,   711303133.0},
-  {3541177677.0,  1858611401.0,  1801570097.0,  2547216280.0,  3877971452.0,  3254021416.0},
-  { 475427659.0,  3208149678.0,   515697433.0,     6336215.0,  2150971657.0,  1475191215.0},
-  {3741719626.0,  1871380437.0,   424875589.0,  2580035485.0,  3576180675.0,  2230339851.0},
-  {1757004377.0,  3796034968.0,  2132690506.0,  2789713570.0,  2749071612.0,  1425787571.0},
-  { 167230287.0,  3295488692.0,  2506723733.0,  3139922530.0,  3348861578.0,   890206013.0},
-  { 965933575.0,  2515538465.0,   389198509.0,  3371039725.0,  4156508299.0,  2086820537.0},
-  { 481619177.0,   702102795.0,  1540365281.0,   734287207.0,  1391640602.0,   372971125.0},
-  {1556231431.0,  1325354352.0,  3742569066.0,  2388133091.0,   127012724.0,  1722901821.0},
-  {2653203935.0,   172638827.0,  1772760414.0,  1619281742.0,  2816043332.0,  3120789522.0},
-  { 311983172.0,  3080830458.0,  3915783376.0,  3023127061.0,  3727923819.0,  2333381207.0},
-  {2535825961.0,  3565768830.0,  2104906094.0,   520461369.0,  2738233679.0,  4220816534.0},
-  {3522824573.0,  1501039766.0,   399186463.0,  1659158739.0,   196937436.0,  3099936154.0},
-  {3851571594.0,   603926776.0,  1491766732.0,  2182219877.0,   713825488.0,  2077984676.0},
-  { 427857893.0,  2864019086.0,   762773767.0,  2730069901.0,   340458503.0,  1775077678.0},
-  {  48860050.0,  2822826115.0,   760614145.0,   569794832.0,   727782794.0,   546967098.0},
-  { 354515285.0,   690803972.0,  2145610883.0,  3882808495.0,  3874777634.0,  3750271160.0},
-  {2187052938.0,  3015094609.0,  4144320409.0,  2393816683.0,   978156666.0,   579792181.0},
-  { 248887432.0,  2347298647.0,  3769152547.0,     5879512.0,  1404063975.0,  2807707562.0},
-  { 963435543.0,  1316041108.0,  4068055051.0,  3068914734.0,  3416771493.0,   622395372.0},
-  { 875532540.0,  3419379739.0,  1344041882.0,   284895079.0,  3134684791.0,  2597189634.0},
-  {4262382164.0,   678928988.0,  2695265472.0,  2844094413.0,  1147954744.0,  2934872315.0},
-  {1646525225.0,  2305042523.0,  3539821524.0,  3982388931.0,  2400726312.0,   369866749.0},
-  {1483678346.0,   851341851.0,  3506036747.0,  3476194481.0,  3715291288.0,  2042559038.0},
-  {1788507301.0,  3616954535.0,   856672822.0,  1070387113.0,   734986292.0,  1971664177.0},
-  {3973917248.0,  1481934751.0,  2900515512.0,  3819067300.0,   312727573.0,  3861788283.0},
-  {2790394279.0,  2861882041.0,  1352933958.0,   459275474.0,  2042833667.0,  4016517955.0},
-  { 101512932.0,   531672420.0,  3436818137.0,  2249302242.0,   727780165.0,  2824327196.0},
-  { 586546686.0,  2682104494.0,   859468861.0,  1292446917.0,   313779827.0,  2581174047.0},
-  {2952077937.0,  3973841521.0,   856396652.0,  1716930264.0,  1368058163.0,  3734991105.0},
-  {3971705373.0,  3681757446.0,   445384400.0,  3208129614.0,  1141458470.0,  3518660202.0},
-  {2296764139.0,  1401342587.0,   464814013.0,  1710772997.0,  3126254272.0,  2714165693.0},
-  { 668654652.0,  2164944656.0,   553836787.0,  1322811046.0,  3160993921.0,  2511460465.0},
-  {3096331974.0,   630085864.0,  4190706718.0,  1181554969.0,  3222723180.0,  3682306901.0},
-  {2424450436.0,  2306563147.0,  1177479914.0,  1074939332.0,  1566085976.0,   500947622.0},
-  {1867239182.0,  3116019482.0,  2651538318.0,  2877137410.0,  2767774929.0,   472034760.0},
-  { 457083258.0,  2236949321.0,  1198699313.0,   633480849.0,  2526580196.0,  3880380315.0},
-  {2817630633.0,   159730064.0,  2114547888.0,  2156395709.0,  3899541685.0,  1895128920.0},
-  {1855365805.0,  3365978937.0,  2045614944.0,   155386100.0,  3889215270.0,   657283973.0},
-  {3914478894.0,  2607700489.0,  1983746192.0,  3777928290.0,  3322806618.0,  1549890270.0},
-  {1669472029.0,   907238566.0,  1327824649.0,  3890099561.0,  4063003374.0,  3493735111.0},
-  { 256835775.0,  3994866849.0,   806335873.0,  3860653827.0,   776504711.0,  3057965516.0},
-  {1976724308.0,  3406609626.0,   573371251.0,  3444505461.0,  3817891583.0,   570139401.0},
-  {2774844702.0,  3530897139.0,  1555648851.0,  2398727420.0,  1286717660.0,  4219092269.0},
-  {1441038886.0,  4035548303.0,  4162192367.0,  3822216662.0,  1954277175.0,  1701364994.0},
-  {2551669303.0,  2560104049.0,   329407501.0,  3103563531.0,  2873255953.0,  3731788304.0},
-  { 594168085.0,  3583259588.0,  1784687965.0,  1959389973.0,  2360155530.0,  3951084320.0},
-  {1166488219.0,  3787218176.0,  3773745128.0,   822317357.0,  3134286418.0,  1038317741.0},
-  { 558498740.0,   577196957.0,  3739960830.0,  1649109129.0,   754851329.0,  1409196055.0},
-  { 387714235.0,   727288974.0,  1843852986.0,  3730074520.0,  1108410800.0,  2055390024.0},
-  {4015148180.0,  4286720618.0,  3707070473.0,  2845434963.0,  3738832196.0,  2762474945.0},
-  {2581644847.0,  1834083422.0,  2305093963.0,  2661700741.0,  1640388755.0,   877849567.0},
-  {1857340958.0,   831087293.0,  3485402995.0,  2903610339.0,   192842860.0,   515990160.0},
-  {3738583048.0,  1572392019.0,  1411695798.0,  1292458008.0,  2655213628.0,  1784794616.0},
-  {2485265452.0,  1772449817.0,   722322970.0,   447239935.0,  1686002208.0,   484743376.0},
-  {3819085937.0,   184747241.0,   730322052.0,  3147709372.0,  3999212578.0,  1517561658.0},
-  {3159738720.0,  1840338430.0,   980831064.0,  1677903992.0,  3531612509.0,  4235616014.0},
-  {2366669762.0,  2267311715.0,  3540469267.0,  3630421866.0,  2974979723.0,  3556894163.0},
-  {1277362425.0,  1580899806.0,  2797362806.0,  2522542369.0,    89643764.0,  1804441521.0},
-  {2212938358.0,  1662724752.0,   646278538.0,  4123199914.0,  2286981036.0,   287717155.0},
-  { 522845471.0,  3457384582.0,   686791445.0,   192448792.0,  2904628344.0,  2504995519.0},
-  {4239163137.0,  2576092985.0,  2912931976.0,   569555972.0,   865239390.0,  2804008398.0},
-  {  34487546.0,   214609235.0,  1455893873.0,   723854130.0,  3624264305.0,  2161752341.0},
-  { 792713844.0,  3845750312.0,  1242793335.0,  2484380369.0,  2586575810.0,  1955195342.0},
-  { 839998727.0,  3610317081.0,  1281204134.0,    40736439.0,  2486836215.0,  3863732384.0},
-  {3929843526.0,    71087617.0,   828914744.0,   433169689.0,  2977070692.0,  2485054885.0},
-  {1935091106.0,  3698046112.0,  2824060928.0,  3406306995.0,  3468676826.0,  3125584707.0},
-  {1048593333.0,   477715603.0,   134333419.0,  3624141862.0,  1082406169.0,  3718480705.0},
-  {4185934201.0,  2788696106.0,  1226527377.0,  1426675202.0,  3298460155.0,   642315227.0},
-  { 214031713.0,  3416835848.0,  2670869443.0,  4118545218.0,  3819176031.0,  1364504167.0},
-  {3047762460.0,  2155906489.0,  1987985570.0,  3830951237.0,  1760885615.0,  2565684806.0},
-  {2003015730.0,  4047667502.0,  1342606360.0,  1703682284.0,  1359357612.0,    85189994.0},
-  { 530009889.0,   556055997.0,  1215605631.0,   195813232.0,  1371754242.0,  3412632655.0},
-  {2401492184.0,  3409031358.0,  4036291410.0,  3659790921.0,  3219581114.0,   381098330.0},
-  {3752820768.0,  4281966827.0,  3934385174.0,  1726125907.0,   212105905.0,   789902548.0},
-  {4037200340.0,  2799846979.0,  2856795179.0,  1939000120.0,    90508801.0,  1785302492.0},
-  {1006956764.0,  2005548996.0,   894237466.0,   952662483.0,  3131364307.0,  2921248225.0},
-  {2564945360.0,  3315121578.0,  1102640772.0,   984177240.0,   230353282.0,  1690680094.0},
-  {2130517467.0,  2895516400.0,  1927658229.0,   799017853.0,   922077826.0,  1212886314.0},
-  {2492105674.0,  2695744971.0,   577623467.0,  3323704710.0,  3485251603.0,  4291756139.0},
-  {1662273283.0,  3932731978.0,   713573438.0,  4190432913.0,  2492589927.0,  3124907688.0},
-  {2815820002.0,   759779673.0,  2274678413.0,   508804587.0,  2512666576.0,  1584704498.0},
-  {3627232604.0,  4270068254.0,  2284214551.0,   592373060.0,   431222513.0,  2237872941.0},
-  {1361243520.0,  2524016084.0,  2054282752.0,  3930564388.0,  2313551550.0,   266252853.0},
-  {2283961760.0,  2854415995.0,  1936587242.0,  1576617491.0,  1031176503.0,  1925253377.0},
-  {1357662633.0,  3013754745.0,  1257519495.0,  2721992109.0,  2479563009.0,  3457400215.0},
-  {1643292267.0,  1095866741.0,  2183381064.0,  3422706061.0,   902326621.0,  4124662023.0},
-  {1642841533.0,  1091816212.0,   687539656.0,  2822356543.0,  2656311320.0,  1819454307.0},
-  {4076438758.0,  3323797989.0,   835099836.0,  2045219094.0,  2792042181.0,  3789121325.0},
-  {2982876266.0,   707913880.0,  4016980369.0,   620694850.0,  3992183847.0,  1634705734.0},
-  { 830531545.0,   201300506.0,  1862770266.0,   124324682.0,   773502721.0,  2756133611.0},
-  {2932659104.0,   367116337.0,  2836250783.0,  1286024277.0,  2075653621.0,  2516533043.0},
-  {2068190131.0,  1108905065.0,   423897500.0,   765920225.0,  3250369447.0,   177200602.0},
-  {3546585630.0,  1505515240.0,  2492145256.0,  3781671601.0,  2734008198.0,  3958365863.0},
-  {1323222485.0,  2915108942.0,  3722117362.0,  2125700628.0,   302312029.0,  3434938598.0},
-  { 785823729.0,  4122683441.0,   127945213.0,  4027863270.0,   601542089.0,   228425014.0},
-  { 384431398.0,  2302359481.0,   776265984.0,  3389872308.0,  2273744440.0,  2971913232.0},
-  {1240640620.0,  1974807391.0,  4167859680.0,   560976419.0,  1033168446.0,   187757472.0},
-  { 713479125.0,  3656298210.0,   600326524.0,  1261221146.0,  3471027003.0,  2205178549.0},
-  { 649990734.0,  2080047938.0,  3238027431.0,  1380161576.0,  1313008131.0,  2674252780.0},
-  {3769849572.0,  2655900150.0,  1262127394.0,   787530912.0,  1417813098.0,  3940573290.0},
-  {2953928257.0,  1616113922.0,   643770113.0,   830202947.0,  2256897230.0,  2145889798.0},
-  { 467425048.0,  2247183390.0,   251473099.0,  2131511302.0,  2714526991.0,  3283019995.0},
-  {1471062276.0,  3316398874.0,  4231045749.0,   513622513.0,  1603893192.0,  1920966138.0},
-  {2117411318.0,  3543055031.0,  3160840785.0,     7524156.0,  1481056440.0,   543326558.0},
-  {1795146366.0,  2692875071.0,  4063138080.0,  2044703088.0,     5015581.0,  2576625618.0},
-  {2622666256.0,  3435462896.0,  2460608801.0,  3176873791.0,   116300819.0,  3895169601.0},
-  {2303334880.0,  2686068639.0,  2546759354.0,  1713396796.0,  3544405268.0,  3072568899.0},
-  {2015329872.0,  3616883183.0,  1707608024.0,  2805897352.0,   487592473.0,  3870764977.0},
-  {1936147912.0,  3843795870.0,  3027224341.0,  3498328048.0,  3389905665.0,  4068820209.0},
-  {4150668272.0,  2739002584.0,   621751123.0,  2557902002.0,  1476973116.0,  2929125411.0},
-  {3834199675.0,  1998190827.0,  2997474667.0,   685818951.0,   390157254.0,  1285687217.0},
-  {2628910765.0,  3170295524.0,  1707172338.0,  3625919756.0,  4120803870.0,  3171003084.0},
-  {2840932714.0,  3630499934.0,  3987013684.0,   435103324.0,  3324068532.0,  1887118237.0},
-  { 690630023.0,  2246685770.0,  4282502632.0,  2989888007.0,  1984571946.0,  2679856869.0},
-  { 514847476.0,  3266368797.0,  2078057213.0,  3872756048.0,   107931496.0,   498707606.0},
-  {3423686316.0,  2069754032.0,  3402137402.0,  1717558895.0,  3650002545.0,  4182177262.0},
-  {2108419797.0,  1460970916.0,  4223449670.0,   691175009.0,    94737812.0,   234350253.0},
-  {1146179843.0,   905330272.0,   445392863.0,  4213989544.0,  1269014575.0,  3201905209.0},
-  {2236136242.0,  2575596017.0,   168019016.0,  3301988485.0,   660295520.0,  1411655301.0},
-  {4026505257.0,  3770772541.0,  1068885638.0,  3093126572.0,  2665495669.0,   587524765.0},
-  {1037245641.0,  4259796041.0,   563992910.0,  3366363616.0,   591450478.0,  3945354719.0},
-  {1333448904.0,  1896811123.0,  3615788358.0,  4221382160.0,  3371987326.0,  3597413052.0},
-  { 465153567.0,  1182676152.0,  2643126462.0,  4106415947.0,   178874206.0,  3089153340.0},
-  {2577537161.0,  1042368129.0,   615921090.0,  2175158851.0,   924025560.0,   221990750.0},
-  {3802762312.0,  1626571862.0,  1014749347.0,  2322530656.0,   168812238.0,  2741367366.0},
-  {2638222960.0,  2086246108.0,   920944010.0,  3216215215.0,   102793795.0,  1537606512.0},
-  { 141627589.0,  1722985919.0,  3898198054.0,  2070609107.0,  3433855441.0,  3532997760.0},
-  {3445917235.0,  1556137249.0,   590581784.0,  1390391334.0,  1796208774.0,  4141634040.0},
-  {2314762335.0,  1404238630.0,  1596312496.0,  2639888545.0,  1837363605.0,   427152483.0},
-  {4031062452.0,  2051892894.0,  2447276219.0,   188591440.0,  2154065950.0,  2604747880.0},
-  {4290869371.0,   791873641.0,  2493565262.0,  1286347994.0,   785691046.0,  3431043513.0},
-  { 386808698.0,  1216770620.0,  3244171310.0,  2611395215.0,  3039257091.0,  3205523803.0},
-  { 363889885.0,  2471667630.0,  3358634389.0,  1991012893.0,  2772968524.0,  1817708668.0},
-  {1101125312.0,  3704075758.0,   374369723.0,  1604537477.0,  3985750830.0,  2591596740.0},
-  {2437753983.0,  2117875015.0,  3005853848.0,  4197797079.0,   849355209.0,  3692465442.0},
-  {4271703577.0,   529758675.0,  4066932948.0,  2360304651.0,   301549531.0,  1356846001.0},
-  { 927262763.0,   350736435.0,  2230115785.0,  3814909566.0,  1148081065.0,   712822087.0},
-  {2339852627.0,  3225312594.0,  1709517728.0,   703227950.0,  2504291764.0,  1003005900.0},
-  {1817808574.0,  3056106358.0,    63043068.0,  2507200293.0,  2815611661.0,  2292707483.0},
-  {2836825453.0,  3088183077.0,  1826549253.0,  1108284653.0,  2714213025.0,   442554207.0},
-  { 964882594.0,  1675034312.0,  3786763980.0,   949260645.0,   859286749.0,  3587445435.0},
-  {3133391369.0,   376948936.0,  2801513683.0,  1706522287.0,  2204598807.0,  3856946525.0},
-  {1185445736.0,  3385880258.0,  1631244907.0,   840642562.0,  1497307782.0,  1496167494.0},
-  { 746972243.0,  3835724304.0,  3033070869.0,   482161449.0,   925449336.0,   214563064.0},
-  {4052989203.0,   720636275.0,  3764376542.0,  3214252564.0,  1329453269.0,  4096593253.0},
-  {3908819625.0,   381096490.0,   805124308.0,  1124074856.0,  3973730143.0,   918294338.0},
-  {3302650474.0,  1906685322.0,  3651660064.0,  1482430428.0,  1476811412.0,  2277564645.0},
-  {3640564210.0,  1720339892.0,    58869908.0,  1328178884.0,  3441431345.0,  3703094732.0},
-  {2899164963.0,  3377935227.0,  3063240540.0,  1487745837.0,   522057046.0,   507789632.0},
-  { 638200397.0,  3809633458.0,  2378032875.0,  1685720145.0,  1683937007.0,   369214755.0},
-  {1103557442.0,  2451863986.0,   716423962.0,  2370045411.0,  4116082416.0,  1048881874.0},
-  {1344342950.0,  3360648321.0,  3639814106.0,  3469796975.0,  1398710541.0,  3676325202.0},
-  { 453491600.0,   677236455.0,  1093669508.0,  1666742682.0,  3414479226.0,   582219386.0},
-  {3851968918.0,  3391770494.0,  2865385240.0,   830424933.0,  2690108250.0,  1261250229.0},
-  {3260856508.0,  1708685405.0,  3923846789.0,  2412205554.0,  1298823813.0,   539537621.0},
-  {2336324879.0,  1661058239.0,  1444219186.0,  1004540082.0,  3344407571.0,  3460943158.0},
-  {4256211616.0,  2204123773.0,  1102113943.0,   314353280.0,  2546493682.0,  2623768845.0},
-  {2629278519.0,  3382013372.0,   974759758.0,   411971849.0,  1799163989.0,    61963683.0},
-  {1061971126.0,  2544848168.0,  3253700697.0,  1264813608.0,  1423083416.0,  1943823560.0},
-  { 189389625.0,  3369258661.0,  4263666645.0,  1601988537.0,  3047945954.0,  1686208872.0},
-  {2884897098.0,  2460518969.0,  2734242555.0,  3108618876.0,   702408698.0,   740831299.0},
-  {3010853246.0,  2356178876.0,   896419535.0,  4130744915.0,  1935750831.0,  2675985247.0},
-  { 446524285.0,  4016134831.0,   808977916.0,  2642220729.0,  1087126948.0,  2669836522.0},
-  {2674959459.0,  3287454708.0,  4263652732.0,  1533027711.0,  3980987168.0,  2827551660.0},
-  {  74554061.0,  2824517945.0,  3874343483.0,  3044247227.0,  3173043581.0,  1490755999.0},
-  {2513583460.0,  3799269873.0,   594971931.0,  3877593784.0,   916781956.0,   860769912.0},
-  {4245324544.0,  3190417753.0,  1013415511.0,   178045028.0,   376041699.0,   262497265.0},
-  { 158943259.0,  1147821820.0,  2781070139.0,  3433230382.0,  3043130402.0,  1426554014.0},
-  {2553175978.0,  1547756901.0,  3806938838.0,  4013398194.0,  3615867237.0,   994533257.0},
-  {4179550182.0,  4222805604.0,  2055021902.0,   823637039.0,  2072006849.0,  2383590546.0},
-  {1825043245.0,  2707024816.0,  2744234571.0,  3405212016.0,  3424486264.0,   363938937.0},
-  {2106138043.0,  3284828474.0,  2751808383.0,  3052378712.0,  1481580743.0,  2083373145.0},
-  { 875474387.0,  1569660974.0,   599920392.0,  3799995893.0,  1086661684.0,   923351817.0},
-  {2423916363.0,  4006595211.0,  2307954332.0,    95931750.0,  1692001437.0,  3367205758.0},
-  {1411352282.0,  3090401796.0,  3799686361.0,  1668698336.0,  2684595919.0,  1209094842.0},
-  {3549472958.0,  1109011053.0,  1301737395.0,    79543440.0,  4089984658.0,  2518194505.0},
-  {3006893888.0,  3683189005.0,  1967905134.0,  2877762587.0,  1205711468.0,   880514663.0},
-  {2577735701.0,   639760342.0,  2174160151.0,  3333223140.0,   676623147.0,  2928713743.0},
-  {2089223589.0,  1175705672.0,  2475147955.0,  2908417231.0,  1905317643.0,   807328116.0},
-  {2956373510.0,  1650262521.0,  3955820100.0,  4175264140.0,   673689246.0,  4222602044.0},
-  {3159843750.0,  3057414081.0,  4055074477.0,  1169260475.0,  2050888666.0,  2032369425.0},
-  {1537231987.0,   138840925.0,  1365780565.0,  2447210416.0,   340385689.0,  1726423165.0},
-  {2628355066.0,  2379693022.0,   789272512.0,  2914626324.0,  3028531285.0,  3447138868.0},
-  {1718812157.0,  3957580863.0,  1142688234.0,  4221024926.0,   918644913.0,  1395459370.0},
-  {2008177424.0,  1684004303.0,  2081174400.0,   906988048.0,  1916282394.0,  2511856310.0},
-  {4037239237.0,  3543703103.0,  2655386781.0,  2778501898.0,   887567630.0,  3047646563.0},
-  {1917206404.0,   620417382.0,  3166760422.0,   516472424.0,  2962221325.0,  3037316724.0},
-  { 793973029.0,  3762084312.0,  3362302788.0,  1630951156.0,  2461242367.0,  4035957621.0},
-  {1205998699.0,  2672727459.0,  2387349947.0,  1325853371.0,    90567194.0,  3302776275.0},
-  {2086900653.0,  1278615296.0,  1001006543.0,  2766335970.0,   927493647.0,    28404253.0},
-  {3320918373.0,   665791390.0,  3970704223.0,  3833682299.0,  3926072013.0,  2690543350.0},
-  {1908182346.0,  3293552465.0,  1403238796.0,  3666837313.0,  2493039986.0,  3144707904.0},
-  {1153861511.0,   960366981.0,   673045862.0,  1839418881.0,  4278063535.0,  2517478638.0},
-  {3883951864.0,  2673469640.0,  3448277915.0,  4115175239.0,  2492531073.0,   654925257.0},
-  { 126164991.0,  1812831808.0,  2822260110.0,  3364061114.0,  1870715947.0,  2516741635.0},
-  {3938486010.0,  1813788574.0,    68877634.0,  4275352522.0,  4069396698.0,    97943569.0},
-  { 524328027.0,   712767034.0,  1570498852.0,  1155780944.0,  3700085823.0,  1253153056.0},
-  {3214275771.0,  1447655243.0,  3281522783.0,  1329462890.0,  3262099549.0,   917361975.0},
-  {2094002987.0,   694965734.0,  3973704529.0,  3736192263.0,  3439927961.0,  1232063626.0},
-  {3630847797.0,   113749099.0,   664926316.0,  2065817504.0,   517837445.0,  2517445225.0},
-  {3376453870.0,  2894073255.0,  2831754387.0,  1829986672.0,  1334409288.0,  2344835205.0},
-  {2916062262.0,  1382839699.0,  1464837792.0,  3026170895.0,  2878125041.0,  1602275244.0},
-  {4056550784.0,  1064398583.0,  1794879217.0,  3863790715.0,  3643183495.0,  1722844206.0},
-  {2293050067.0,  2366890883.0,   820048480.0,  1751623077.0,  4196918717.0,  2782948075.0},
-  {4094889702.0,  2367386113.0,  1226614071.0,  2614252116.0,  2337492063.0,    60897495.0},
-  {1316090099.0,  1562070084.0,  3553261911.0,  3917438653.0,  3565745298.0,   819151207.0},
-  {3183565799.0,  4080360835.0,  4180358364.0,  3978808435.0,  3933924475.0,  1002004103.0},
-  {3705232141.0,  2615527978.0,  2616202773.0,   637361995.0,  3957741924.0,  1058410913.0},
-  {3248591064.0,  2316893548.0,  4216722260.0,   710404084.0,  2331478832.0,  2393288906.0},
-  { 214560618.0,  3002042555.0,  3743433821.0,   555697160.0,  4180052657.0,  1131663485.0},
-  { 345591167.0,  1621223656.0,  3659549317.0,  3591788632.0,  2964510867.0,  1158739853.0},
-  {2797496429.0,   236189083.0,   754457120.0,  1950505881.0,   859284961.0,  2111980356.0},
-  {1133883882.0,  1579144488.0,  3887225292.0,  1056384264.0,  2082739616.0,  1682642147.0},
-  {1039174270.0,   150648999.0,   239004939.0,  3916085390.0,  3597079250.0,  1959639539.0},
-  {1474251005.0,  2794783243.0,  3808642638.0,  3493879884.0,  2608579278.0,  1279362878.0},
-  { 463280288.0,  2922412597.0,  4109778262.0,  1914641424.0,  2461895447.0,  3840475151.0},
-  {3731487115.0,  4247084322.0,  2388886610.0,  1662143045.0,  3053537730.0,  2671842459.0},
-  {3712735553.0,  3562288611.0,   931409564.0,  3440466408.0,   883733661.0,  1718119340.0},
-  {1810782397.0,   949388712.0,  3270131454.0,  1223599407.0,  1182360112.0,  3060333338.0},
-  {3406876233.0,  3917500522.0,  4061980498.0,  1518261588.0,  1900592798.0,  2707737675.0},
-  {3300613447.0,  3367405309.0,  3475511180.0,  1943333771.0,  1388383187.0,  2966397782.0},
-  {2289683112.0,  2992756940.0,  3999559923.0,  3017179688.0,  3931267245.0,  3786525475.0},
-  { 793950314.0,   956526370.0,  4125994829.0,  3947357625.0,  2222732828.0,   608269472.0},
-  {2502360887.0,  1746275810.0,   302498747.0,   100728009.0,   947045253.0,  3760103766.0},
-  {4210949989.0,  3021727916.0,  3321832908.0,   794714215.0,  3653041826.0,  2476525222.0},
-  {3841463995.0,   685055720.0,  3297280903.0,   363355641.0,  1451605295.0,  1867037655.0},
-  {2391024993.0,   846274184.0,  3855176146.0,  1775816238.0,  2809283032.0,  3647209774.0},
-  {3116474208.0,  3912062288.0,  2902776277.0,  1493372532.0,   757912778.0,  1453887028.0},
-  {2115400980.0,  1647967116.0,  3225950098.0,  1299725035.0,  3336206605.0,  3135723135.0},
-  { 476317811.0,  3164581253.0,  1955303510.0,  2004492266.0,   275283320.0,  1034735572.0},
-  {1501179347.0,  1425390647.0,  2063279355.0,   908099494.0,  3986566941.0,   332845746.0},
-  {3036960874.0,  3692313574.0,  3283673352.0,   581979800.0,  2228942054.0,  1202668946.0},
-  {2045970074.0,  3409926254.0,  2818091895.0,  1956900784.0,  2330033239.0,   593683329.0},
-  {2394937388.0,  3734724665.0,  2850677782.0,  3953065836.0,  1220318002.0,  1368086568.0},
-  {  84415415.0,  2125875789.0,  4196827142.0,  3548869917.0,  1030729819.0,   500314559.0},
-  {1294454304.0,  3547366227.0,  4083500441.0,  1683552200.0,  3206384695.0,  3286971682.0},
-  {4127016279.0,    73640752.0,  1922692498.0,  4109267340.0,   682756409.0,  3739277505.0},
-  { 630852085.0,   880366569.0,  2578057829.0,  2709802453.0,  2270583513.0,   830767223.0},
-  {1393779770.0,   821540398.0,  3869799280.0,  3133175408.0,   625690641.0,  2351420930.0},
-  { 937518929.0,  2089980356.0,  1436047621.0,  3177686628.0,  1184551763.0,  3420217733.0},
-  { 749303508.0,  2388993665.0,  1097411062.0,  3968992511.0,  1354014696.0,  2683088380.0},
-  {  49053389.0,  2531606356.0,  2493594629.0,  2685189395.0,   591365479.0,  1947206461.0},
-  {1278801887.0,  2444920325.0,  2410108486.0,  3450960298.0,  4149681195.0,  1342645392.0},
-  {2244219719.0,  2987017677.0,  3197846087.0,   136666163.0,  1161067622.0,  2856597232.0},
-  {3822033466.0,   453312659.0,    52256862.0,  3153923059.0,  3499450757.0,  3165646796.0},
-  {1137900679.0,   201725552.0,  1787545093.0,  2944535320.0,  3197591324.0,  4253395484.0},
-  {1125335971.0,  1326209863.0,  3510865122.0,  2642395959.0,   982418319.0,   382288416.0},
-  {2707393691.0,   383674632.0,  2457042934.0,  1489758497.0,  1651316920.0,   483355450.0},
-  {3506438428.0,  3204398189.0,   534820843.0,  1183384195.0,  3782209538.0,     5929112.0},
-  { 912192389.0,  1099142284.0,  4238115678.0,  1494504615.0,  4222163915.0,  3897344535.0},
-  { 389973482.0,  3362686412.0,  2739631916.0,  2959530236.0,  1355289549.0,  3776253376.0},
-  { 225996343.0,  1342846650.0,  2202314243.0,  2832177710.0,  2269734499.0,  2397760107.0},
-  {2112130453.0,  3952568755.0,   520428088.0,  2464963836.0,  2520765397.0,  1565116569.0},
-  {1784636740.0,  4234408456.0,   629975689.0,  2923307921.0,  3995900265.0,  1096667699.0},
-  {2957390618.0,  1040787116.0,  3917187781.0,  1852543972.0,  3708156362.0,  2196885640.0},
-  {1357637645.0,  1059427249.0,   800951665.0,  1558460654.0,  1972949201.0,  3182661420.0},
-  {3998158503.0,  4141116611.0,  2023156682.0,  3526608661.0,  2523991336.0,  3387636868.0},
-  {1093849504.0,  1309662553.0,  4009252663.0,   546826189.0,    34275639.0,  2323354291.0},
-  { 312071526.0,  3525634931.0,  1208894421.0,  2212683978.0,   467777307.0,   829671632.0},
-  {4014430127.0,  3398589352.0,  1905610209.0,   815302373.0,  2797955068.0,   225433702.0},
-  {2470529007.0,  2742077450.0,  2903370352.0,  2279067586.0,  4183721953.0,  2570380775.0},
-  { 220433001.0,  1805334401.0,  1163418814.0,  4012960933.0,  2601029767.0,  3473883374.0},
-  {3895376704.0,   338307077.0,  1424927398.0,   850611535.0,   820786706.0,  1076134451.0},
-  {2645350199.0,  2078538111.0,   286753861.0,  3303436755.0,  3567737764.0,  2328346633.0},
-  {2280804143.0,   780473203.0,   419773954.0,  3950922182.0,  1142106655.0,  4160644851.0},
-  {1628685007.0,  1063201038.0,  2236318585.0,   393328534.0,  1917651040.0,  2801873919.0},
-  {4015613528.0,   241714117.0,  1821091341.0,  2774207363.0,  3499634683.0,  3920672099.0},
-  {4042497879.0,  3095878866.0,  1621427908.0,  3388638971.0,  2451773422.0,  3237433762.0},
-  { 722612410.0,  3491742477.0,  2147243765.0,  4280202174.0,    15699144.0,  3363679888.0},
-  {3019382205.0,   532658712.0,  2535043792.0,   162224631.0,  3315889756.0,   715942485.0},
-  {3979802254.0,  1399729891.0,  2975290039.0,   390380154.0,  1945386615.0,   300425221.0},
-  {1390570267.0,   819404799.0,   182724483.0,  2718628059.0,   902023771.0,  3819012411.0},
-  { 771859084.0,  3533409145.0,  3642221667.0,  1875647600.0,  2691768511.0,     7273915.0},
-  {1378825705.0,   420916698.0,  2902443294.0,   853379010.0,  1994323785.0,  1716919326.0},
-  { 512404125.0,  3277123711.0,  2140732217.0,  3895553590.0,   484118713.0,  2880382320.0},
-  {1986926984.0,  3503859707.0,  1265397230.0,   371508658.0,    61326465.0,   674423784.0},
-  {3713634120.0,   574860231.0,  3327463734.0,    39720925.0,   794931529.0,  4199087598.0},
-  {2848643787.0,  2766217219.0,   153947045.0,  1546150119.0,  3217559502.0,   142438117.0},
-  {2232950603.0,  3850161013.0,  2440762006.0,  1886597635.0,  1699199851.0,  1200101543.0},
-  {2835384351.0,  3690743310.0,  1515576601.0,  1717987347.0,  1171350820.0,   455247175.0},
-  { 795480799.0,  2304716934.0,   305112532.0,  3257719850.0,  2912938589.0,  4007733397.0},
-  {3574431616.0,  3667785792.0,   292332366.0,   351899707.0,  4246678661.0,  2575031882.0},
-  {  24568515.0,  1125054058.0,  1702300735.0,  1342467819.0,  1853828667.0,   512470016.0},
-  {3228597633.0,  1546008254.0,  1285020192.0,  4240231592.0,  3234639716.0,   320278902.0},
-  {1973838575.0,  2150978165.0,  3386861112.0,  2002065523.0,  2524895393.0,  1481865126.0},
-  {3845636354.0,  4227105700.0,    13175204.0,  3660996809.0,   149193999.0,  2845497867.0},
-  {1866453538.0,  3589446496.0,   112894992.0,  3231615620.0,  1892506641.0,  1234188530.0},
-  {1506568107.0,  2537536410.0,   448366052.0,  3021229867.0,   309005572.0,  3023594497.0},
-  {2246165813.0,  1986866788.0,  1996836585.0,  2383988257.0,  1613243654.0,  1471884309.0},
-  {3392471085.0,  4012164235.0,   252964119.0,  2532916404.0,  1793051358.0,  1488738587.0},
-  {4226264233.0,  1796553184.0,  2981029367.0,   486252823.0,  4285175522.0,  3651163770.0},
-  {1616912473.0,  1136427239.0,  1262153412.0,  3062664654.0,  1810814732.0,  4117940624.0},
-  {3685915632.0,  3646437691.0,  1629093510.0,   136150006.0,  2694554587.0,  3751736522.0},
-  {2920365586.0,   942938198.0,  3026886243.0,   111126373.0,  3661275825.0,  3945265912.0},
-  {2341792553.0,  3019200730.0,  3733312199.0,  3904220600.0,  1167444872.0,  1950810724.0},
-  {1359941973.0,  2301105697.0,    86863405.0,  1571096017.0,    64806576.0,  1568072792.0},
-  {2329724356.0,  3559297371.0,   390819005.0,  2504835584.0,  3590740948.0,  3383386267.0},
-  {4160654753.0,  1128861829.0,  1035792454.0,  3996855286.0,  2570274492.0,  1999911892.0},
-  { 224193516.0,   983114481.0,  1717848049.0,  2128517049.0,  3758416867.0,  1957579455.0},
-  {3209144212.0,  2040304769.0,  4021770133.0,  3429176785.0,    23465180.0,  3814367265.0},
-  {2755226927.0,  1093467790.0,   447473683.0,  2826309739.0,  2376413612.0,  3445970498.0},
-  {3778915285.0,  2159919199.0,  4271871841.0,  1562847320.0,   389934159.0,  1548223467.0},
-  {1933692533.0,   564440077.0,  2173497840.0,  1271115366.0,   792111669.0,   830164100.0},
-  {3957565857.0,  2747897526.0,  3043763722.0,  2172923297.0,  2617543444.0,  2643156396.0},
-  {1132255309.0,   918223784.0,  2029618827.0,  2066371144.0,  3896601058.0,  4280746204.0},
-  {3882156084.0,  3809071527.0,  4177245554.0,    52150356.0,   892780051.0,  1568658150.0},
-  {2537023983.0,  3367707355.0,  2393934434.0,  4041678129.0,   267435324.0,  1364637453.0},
-  {3621574350.0,   216586465.0,   784277516.0,  2642114764.0,  3627345145.0,  4199050884.0},
-  {3043430989.0,   628003812.0,  4086115780.0,  2528695761.0,  3473761127.0,  1854670667.0},
-  {1685584294.0,  1642823366.0,  2550295985.0,  2696608906.0,  3744813261.0,  3261276282.0},
-  {1429369762.0,  2672012338.0,  1678220368.0,  3929026536.0,   449101391.0,  1411384247.0},
-  {1424556661.0,  2835393992.0,  1079387545.0,  4043068108.0,   221545110.0,  3425511684.0},
-  {3511849505.0,   557734213.0,  3375669067.0,  1037571859.0,  2000330372.0,  3293742032.0},
-  {2974775026.0,   618589361.0,   248629096.0,  1897095187.0,   213258567.0,  2850566869.0},
-  { 123010076.0,  3168881467.0,  4270557959.0,  3277882687.0,  3904911353.0,  1661026834.0},
-  {1113501408.0,  1920883563.0,  3066524694.0,  2293004472.0,  3992808035.0,   806427110.0},
-  {3070575088.0,   872882671.0,   225343703.0,    14803807.0,  3535480994.0,  2812430963.0},
-  {1634090455.0,  2373561109.0,  1790040002.0,  2326477211.0,  3233211251.0,  2725322514.0},
-  { 533882407.0,   461538756.0,  2324849846.0,  3597305224.0,   760329569.0,  3461217933.0},
-  {3167648214.0,  1477282450.0,  1011253921.0,  3522886923.0,  1841373943.0,   924734344.0},
-  {2173934607.0,  2620401043.0,  1695683138.0,  2095465577.0,   609456815.0,   337796753.0},
-  {2078701897.0,   625190665.0,  2886060257.0,  1339354329.0,  3473617653.0,  2745203418.0},
-  {2247389467.0,   552761397.0,   440326645.0,  1982934677.0,   191527264.0,  1981471825.0},
-  {1945153909.0,  3750616525.0,  1557225134.0,  2794744418.0,   938364374.0,  2692101686.0},
-  {1734374882.0,  1493562975.0,  1684526689.0,  1768856665.0,  3223386985.0,   924747877.0},
-  { 966226305.0,  3121286776.0,  1459119417.0,  3027878810.0,  1478314277.0,  1572937668.0},
-  {1572768799.0,  1750420014.0,   946434997.0,  2057964574.0,  3854236996.0,   542037518.0},
-  {3907932954.0,   670355561.0,  1299426881.0,  1365156140.0,  1890101317.0,  1803230813.0},
-  {1309761236.0,   129001915.0,  1806954360.0,   266311103.0,  2996377322.0,  1051459516.0},
-  {1203701038.0,    51763443.0,  3072311708.0,  3503474473.0,  1449529978.0,   192845484.0},
-  {  61600411.0,  2325041834.0,  2921016636.0,  1667030798.0,  2236984967.0,   184636650.0},
-  {3617224200.0,  3792083355.0,    35156206.0,  2383315993.0,  3015225341.0,   163888461.0},
-  {4150991510.0,  2771167429.0,  2080490307.0,   106315553.0,  1024657984.0,   177873250.0},
-  {2948002559.0,  2274659720.0,  2807785919.0,  1293091859.0,  2516457567.0,  4158809521.0},
-  {3590783466.0,  3786116485.0,   149533631.0,  3715580621.0,   625296966.0,  1771906203.0},
-  {  63072767.0,  4218799962.0,   809586800.0,  1810039753.0,  2228466115.0,  1516524354.0},
-  {4266551601.0,  2730840444.0,  2662668771.0,  4264395580.0,  3964912016.0,  4144538486.0},
-  { 334999313.0,  3267635132.0,   557485107.0,  2344234158.0,  4026477910.0,  2966074428.0},
-  {3032631486.0,  3513248527.0,  1378540707.0,  3585876385.0,  2915718370.0,   158925076.0},
-  {3296710991.0,  2159873019.0,  2456821256.0,  2098138095.0,  1775109311.0,  2725326638.0},
-  { 761188384.0,  3110437903.0,  1159636489.0,   639648728.0,  1158045951.0,   813331788.0},
-  {3246284376.0,  2157818773.0,  3103182352.0,  1588894935.0,  3870992167.0,   885742904.0},
-  {1096445056.0,  3747124721.0,  1615180658.0,   224989251.0,  3510883438.0,  2984865208.0},
-  {2481683706.0,  1194777252.0,  1389848809.0,   389944231.0,  2922133875.0,  1823475378.0},
-  {1478469257.0,   398603487.0,  3315217660.0,  2943271864.0,  2511271505.0,  2417566782.0},
-  {3347395521.0,  2645220967.0,  3599080981.0,  1557440924.0,  1613445476.0,   112437545.0},
-  {3859386867.0,  3516602932.0,  3053058843.0,   428716910.0,  2352408116.0,  1798096194.0},
-  {4143066721.0,  3648905581.0,   848525731.0,  4196319191.0,  1583484855.0,   101037345.0},
-  {1208241627.0,  2615490469.0,  2201332650.0,   721225763.0,  1553703903.0,  2990431689.0},
-  {2815213799.0,  1519349332.0,  3329760842.0,  3339931493.0,  1990924535.0,  3275951659.0},
-  { 963348782.0,  3934179171.0,    82328057.0,  3977389503.0,  3456269628.0,  3097445772.0},
-  {2375313016.0,   477345675.0,  4143087187.0,  4128607062.0,  2583972357.0,  3700634984.0},
-  {3261265938.0,  3972499120.0,  2220112989.0,  2486390881.0,  1290991570.0,  1812415653.0},
-  {2678571413.0,  1257705934.0,  2757570191.0,  1029710253.0,  1522492879.0,  1639199874.0},
-  {3691772867.0,  3416867126.0,  3605051357.0,  1111089679.0,   559320312.0,  3280272948.0},
-  {2534196742.0,  4175116866.0,   278168710.0,   679494650.0,  1352422540.0,  3929720053.0},
-  {2694910961.0,  3186209469.0,  4178387292.0,  3537100969.0,  1306159384.0,   286049314.0},
-  {2420993588.0,  2814605416.0,   884861645.0,  2231364395.0,  2974900521.0,   543596196.0},
-  {3966413279.0,   461331329.0,  3647359062.0,  3628534112.0,  3075510747.0,   114837515.0},
-  { 244061427.0,  2550886945.0,   298562010.0,  2626561704.0,   708428539.0,  4071792418.0},
-  {3298501469.0,  1620812492.0,  3326388753.0,  3859667690.0,  3449251520.0,  1232928752.0},
-  {2018009066.0,  1465290813.0,   183551583.0,  3741887125.0,    37819618.0,   546681764.0},
-  {2679853255.0,  2721861552.0,   318307993.0,  1109102540.0,  1912506921.0,  3676450673.0},
-  {2951352702.0,  3901629725.0,  1986582670.0,  4071208720.0,  1551470722.0,  3156860434.0},
-  {2819216524.0,  2422615478.0,  3501203766.0,  3315422349.0,   537850987.0,  2405149042.0},
-  {1727210587.0,  2748483914.0,  2247329035.0,   850288258.0,  1288168050.0,  2724962956.0},
-  {2061550877.0,  1360696751.0,  1949815229.0,  3397471178.0,  1238741267.0,  1385702878.0},
-  { 113339143.0,   244958461.0,  1482022002.0,  4244065815.0,  2174783265.0,  2106108141.0},
-  {2796276430.0,  2056050089.0,  3362884746.0,  4148771754.0,  1675144389.0,  1713654328.0},
-  {2478307288.0,  2589078741.0,  3276272213.0,  3098065352.0,  4278461262.0,  1156480447.0},
-  {  86720893.0,  2514044743.0,  3259686486.0,  3564661931.0,   449619585.0,  2679002862.0},
-  {1692597641.0,  3721702147.0,  3436902143.0,  3091897566.0,  3371258735.0,  1235748538.0},
-  {2284170677.0,   281108073.0,   754227622.0,  3292281668.0,   197597136.0,   325826358.0},
-  { 452626395.0,  3477168842.0,   505964110.0,  3700576986.0,  1665210901.0,  3588918828.0},
-  {1016284317.0,  4034133504.0,  3737577060.0,  2641538680.0,  3618806772.0,    22917395.0},
-  {3676023857.0,  3907909237.0,  2582739133.0,  3162299026.0,  3104568053.0,  2034033453.0},
-  {2590620346.0,   540871879.0,    31316629.0,  2922815094.0,     9683552.0,  3385993217.0},
-  {2427228509.0,  3735852789.0,   437338521.0,  2318035354.0,  2886517830.0,  2052261078.0},
-  {4047563787.0,   669545800.0,  2365271848.0,  1547196049.0,  3754638158.0,  3114619425.0},
-  {1940378131.0,  4092000269.0,  3209099958.0,  1765847546.0,  3875313236.0,  1684036161.0},
-  {2150668563.0,  2554542791.0,  2331796267.0,  1221377190.0,  4131883508.0,  3027842335.0},
-  { 581447715.0,   692316384.0,     2242682.0,  3040229118.0,   617663022.0,  4016391562.0},
-  {3237216993.0,   575649255.0,  2561136298.0,  3973360466.0,  2037080911.0,  3481530445.0},
-  { 881023889.0,  4018794613.0,  3100936058.0,   635086266.0,  1029182128.0,    99158363.0},
-  {2692735254.0,  3509025503.0,  1865376276.0,  3494716816.0,  3075384422.0,   897331514.0},
-  { 135932830.0,   296741664.0,  2652884657.0,  1421530080.0,  1942720661.0,  3865557958.0},
-  {1863813841.0,  3832491857.0,  2392590094.0,  2836046808.0,  1114234139.0,  1733126175.0},
-  { 417123487.0,  3253459769.0,  3216171436.0,  1192112568.0,  1853962575.0,  2450895556.0},
-  {4287175088.0,  2177965046.0,  2735874264.0,  2674964856.0,  3870312030.0,  1593184401.0},
-  {4178161215.0,  3903536274.0,  3366105648.0,   789415878.0,   997793833.0,   960363034.0},
-  {1294916030.0,   817442000.0,  1849364312.0,  1775467944.0,  3997089641.0,  1307674098.0},
-  {4268866381.0,  1171422009.0,  2668024129.0,  2046262496.0,  3153459362.0,  1632677306.0},
-  {3965781330.0,  1813164283.0,  1878339129.0,  1686313921.0,  2135809733.0,  2480422534.0},
-  { 144304918.0,  1541801330.0,  3140605725.0,  3194411781.0,  1065634094.0,  1192516953.0},
-  {1285422392.0,  1249395861.0,  2109060887.0,  4243687109.0,  1996982101.0,  3909027451.0},
-  {2312869333.0,  4020870096.0,  2900003681.0,  1218910679.0,  3105373821.0,  2498703922.0},
-  {3247532132.0,  3784885834.0,  3898740111.0,  3603709029.0,  2888446695.0,  4253557761.0},
-  { 948278795.0,  3256504063.0,  1696263699.0,  3944579362.0,   461920514.0,  2232596665.0},
-  {2850239285.0,  3423295434.0,   477528514.0,  1387327256.0,  2588986506.0,   821197580.0},
-  {3791094948.0,  1186500674.0,  4127371176.0,  1817715881.0,   919092722.0,  4169899970.0},
-  {1248442132.0,  2375338236.0,   622256971.0,  2714925341.0,  2367151201.0,  2569205375.0},
-  { 261820946.0,  3438573608.0,  2396564096.0,  1905720804.0,  4209151826.0,  3559978245.0},
-  {1455140527.0,  2236864831.0,  1781017489.0,  4195086773.0,   866208186.0,   754722391.0},
-  { 594885609.0,   990282486.0,  1855714722.0,  3629351141.0,  3722373708.0,  2732700738.0},
-  {3615564765.0,  3520187496.0,  3322072505.0,  1530469526.0,   175503058.0,  1419753683.0},
-  {3473703911.0,  1827887573.0,  1355944039.0,   735234820.0,   769378979.0,  1625931060.0},
-  {3002502634.0,  1039278388.0,  2053981786.0,  3450965177.0,  3201623807.0,   304833304.0},
-  {4202975921.0,  1973867031.0,  1921248856.0,  4111769497.0,  3773655524.0,  1105942159.0},
-  {3052801214.0,  3847321960.0,    40265502.0,  3839570761.0,  1833915120.0,   374881510.0},
-  {2406292494.0,  2694919215.0,  1375290477.0,  3790755011.0,  1668500686.0,   865710218.0},
-  {1979961287.0,  1914825019.0,  2880181896.0,  2846876958.0,   742294576.0,  3384941091.0},
-  {2087612969.0,  1187442243.0,  2277011600.0,  1308785048.0,  1175602965.0,  3390412614.0},
-  {3666950930.0,  3052756460.0,   811247199.0,  2083123881.0,   743004310.0,  1680971595.0},
-  {2902709603.0,  2830923897.0,   636941821.0,  1155896593.0,  3808588640.0,   311814914.0},
-  {2123986446.0,  1611865251.0,  3693020331.0,  3423777837.0,  1933565870.0,  3960748770.0},
-  {2310813153.0,   171649951.0,  3413839061.0,  3233144835.0,   929160758.0,  2454228368.0},
-  { 872656816.0,   798256202.0,  3310215220.0,  1876496785.0,  3706956142.0,  2215114825.0},
-  { 674404995.0,  3431770830.0,  3371301676.0,  2985659974.0,  2304383770.0,  3063997628.0},
-  {2948005301.0,  3595834572.0,   840910982.0,   503750915.0,  4221029076.0,   737956564.0},
-  {3796714817.0,   228824735.0,   478161145.0,  3165762352.0,  3803304392.0,  4077989482.0},
-  {1459804638.0,  3323778632.0,  3948057296.0,  2269713387.0,  3545582432.0,  2489993648.0},
-  {3784658689.0,  1162895500.0,  2818450544.0,  1419511242.0,  3849252373.0,   175111074.0},
-  {3761949209.0,  1164367826.0,  4040148836.0,  1070887289.0,  1440571891.0,  2012124729.0},
-  {4213534017.0,   248881915.0,  2434783842.0,  2435407341.0,  3076073175.0,  1627211286.0},
-  {3821599262.0,  3170724147.0,   757610694.0,  1844975911.0,  1336341741.0,   949251781.0},
-  { 480916687.0,  3129325213.0,  1565551450.0,  3739430588.0,   704531999.0,  3512131113.0},
-  { 734836685.0,  2448226358.0,   679399491.0,   615484179.0,  4240278946.0,  1948097041.0},
-  {2478741117.0,  1493448050.0,  1889646068.0,  3014910488.0,  3033453083.0,  2539399932.0},
-  {3253565580.0,   630651950.0,   819154398.0,  1879132525.0,  1944606927.0,  2246561867.0},
-  {3691883051.0,  2797713177.0,   766775938.0,  2989387447.0,  1738209477.0,  3533536359.0},
-  {4000166088.0,  1897755601.0,  2317778885.0,    47328685.0,    34589653.0,  1637679201.0},
-  {2860814387.0,  2125180062.0,  2171873961.0,  3767049580.0,   972371577.0,  3085291476.0},
-  {2618898560.0,  3654803108.0,    67656281.0,  3251768857.0,   754406542.0,  2648598579.0},
-  {1820022713.0,  2031966536.0,  1317135539.0,  2527093431.0,  3748202911.0,  1344289648.0},
-  {2316309085.0,  3899512325.0,  3874539118.0,  3586524665.0,  1872019132.0,  1952239737.0},
-  {3333759598.0,  3442990099.0,   730837087.0,  2509215553.0,  2557605214.0,  2602973624.0},
-  {3739133523.0,  2481389698.0,  1692655481.0,  2703570720.0,  3156067668.0,  3060020439.0},
-  {2158191328.0,  3322058500.0,  1958317297.0,  1103337805.0,  4023883214.0,   173989942.0},
-  {2360721416.0,  1093094954.0,  1472966811.0,   303997241.0,  2947978102.0,  4283686694.0},
-  { 341931398.0,   907515635.0,  3036274187.0,  3183105363.0,   457350171.0,   947005026.0},
-  {3489408723.0,  1182690233.0,  1312117203.0,  2924713728.0,  2570166702.0,  2237754052.0},
-  {3669965156.0,  3462473122.0,  3025414183.0,  4275260489.0,  2347434631.0,  1243690398.0},
-  {  69784285.0,  2820616317.0,  4104376816.0,  3715749036.0,  2170340044.0,  2049561576.0},
-  {1370791019.0,    55078097.0,  2474717801.0,  2683688611.0,  4207981784.0,  1121328413.0},
-  {3430239749.0,  3004610368.0,  2111577448.0,  2295295037.0,  1280644728.0,  3068236427.0},
-  { 402190716.0,  1402194956.0,  1800407529.0,  2393403651.0,  4265963775.0,  2577295540.0},
-  { 754653313.0,  1330311666.0,  2969016268.0,  4154929462.0,   465971130.0,  1246460005.0},
-  {2805976979.0,  3061871948.0,  4104925094.0,  3910767104.0,   246469020.0,   833041322.0},
-  {3289364459.0,  3062223176.0,  2532745846.0,   661247884.0,  1791410822.0,  2074969138.0},
-  {1815042106.0,  3771713284.0,   641129323.0,   860926477.0,  3399719353.0,  1283107114.0},
-  {3885932255.0,  4105782144.0,  1607437353.0,   710405410.0,  2738437864.0,  2321253895.0},
-  {2868625013.0,  1752655281.0,   429035598.0,  3306912163.0,  3458741117.0,  1782771699.0},
-  {2815081779.0,   604871659.0,   679705338.0,   886969993.0,  1443522480.0,  1941118552.0},
-  {2466113206.0,  4183350983.0,  3748462302.0,  1290744280.0,   755455068.0,  3974106094.0},
-  {3802681885.0,  3395866348.0,  2150751313.0,  3192858927.0,    78423073.0,   134281861.0},
-  {2803509831.0,  2288442253.0,   216685897.0,  1222137989.0,  4077497835.0,  1369433217.0},
-  { 513129057.0,  2920264543.0,  3966468028.0,   944020753.0,   406426307.0,    44850156.0},
-  {3357855851.0,  3551130050.0,  1741872826.0,   249490293.0,  3121078840.0,   494756116.0},
-  {2413881828.0,  1308392249.0,  1180493053.0,  1338397021.0,    45957709.0,  4232032635.0},
-  {2312050230.0,  1808659536.0,  2574134504.0,  1340315174.0,  3738107135.0,  3762288032.0},
-  {4236537141.0,  3631645096.0,   620566673.0,  2873260572.0,  2976933254.0,  1366676191.0},
-  {4272125932.0,  4101407821.0,   740591613.0,  1091766564.0,  1368399443.0,  3148718056.0},
-  {4008612308.0,  3711805878.0,  2231383985.0,  3497214380.0,  3593053610.0,  3075567419.0},
-  {4125160824.0,  1833994236.0,  3193103728.0,  3534382122.0,  1847804638.0,  1229202096.0},
-  {3308635340.0,  3712933434.0,    10914664.0,  3134633807.0,  2733489644.0,   335625566.0},
-  {3903685005.0,  3696230400.0,  1029693828.0,  1944528471.0,  1687646453.0,  3244660628.0},
-  {3747983073.0,  3525158604.0,  3606794650.0,  2018428933.0,   266445316.0,   772265295.0},
-  {3543202879.0,  3372117524.0,  4220975320.0,  1665351507.0,   237675804.0,  1527988743.0},
-  {1264428330.0,  4028305725.0,  3705710968.0,  3424507058.0,  2285682692.0,  1930663442.0},
-  {2944543490.0,   457388426.0,  2977244844.0,  3938374173.0,  2468002025.0,  1188837744.0},
-  {3616177956.0,  1568603476.0,   686722661.0,  3083183450.0,  3490690879.0,  3107955881.0},
-  {1179552763.0,  3923460181.0,  2555094339.0,   235001157.0,  3153297487.0,  1380414935.0},
-  {2333882385.0,   274170888.0,   521732782.0,   392964921.0,  1156479732.0,  3879323444.0},
-  { 242427750.0,  1846036268.0,   520782718.0,  3488025339.0,  1478427476.0,  2761965531.0},
-  {1809163719.0,  4110361121.0,  2695850289.0,   280838514.0,   535482447.0,  3972332301.0},
-  {2523209739.0,  2917702627.0,  4174132865.0,   596380587.0,  2105446991.0,   223137983.0},
-  {1633253833.0,  2789034322.0,  4187177638.0,  4238056968.0,   980529831.0,   626246204.0},
-  {2072974215.0,  3446560429.0,  3778665220.0,  1527156941.0,   599516107.0,  3661253406.0},
-  {1720486371.0,   328929485.0,  2298451937.0,  1495384143.0,   492174205.0,   155369710.0},
-  {3496963728.0,  1433375233.0,   538678192.0,   282694420.0,  1214398294.0,  4040086039.0},
-  { 166971678.0,  4084285457.0,  2919874696.0,   576155104.0,  2340906002.0,   476318133.0},
-  {1115356484.0,  1138064780.0,  1167781407.0,  3448378619.0,   792847718.0,   432399467.0},
-  { 780118129.0,  4231712948.0,  3148318543.0,  1341794366.0,  2717210176.0,  3167330444.0},
-  { 253606582.0,    87028619.0,   817318917.0,  4123827220.0,  2484825031.0,  1921921011.0},
-  {2492425678.0,    11310428.0,   443795827.0,  1620262483.0,  1215126786.0,  4081778885.0},
-  {4214411112.0,  3504199864.0,  2472485792.0,  3017486265.0,  3063274343.0,    71170270.0},
-  { 446312954.0,  2496672739.0,  1384549093.0,  3609276977.0,  2121272059.0,  2191090178.0},
-  {3317582910.0,  1727393512.0,  2596162050.0,  3004143117.0,  2108506718.0,  3050075047.0},
-  {3166970607.0,  2268121115.0,  1965419447.0,  2725417795.0,  2112741307.0,  3374730363.0},
-  {3421551824.0,  2588553288.0,  4218312423.0,  1081929970.0,  2575158192.0,  1414475673.0},
-  {3997564164.0,  3652207945.0,  1634144775.0,   638390850.0,  2159042208.0,  2028687044.0},
-  {1470182885.0,  1236147127.0,    34608645.0,  3955996720.0,  3110070790.0,  1089898622.0},
-  { 585649625.0,  3553100187.0,  3587932831.0,  1627481535.0,  2939411006.0,   259338906.0},
-  {2363950424.0,  2280019548.0,   542525236.0,  3305700659.0,  1887194565.0,  1663512370.0},
-  {1957030216.0,  3665488965.0,  2460339980.0,  4223721827.0,  4236428667.0,  3548933937.0},
-  { 730973202.0,  3857452482.0,   700531921.0,  2625687178.0,  3057150595.0,   451121505.0},
-  {3092186035.0,  1086424909.0,  3402700407.0,  2455876291.0,  1037919945.0,   178730976.0},
-  {  27913683.0,   742541173.0,  3568055641.0,  3320000072.0,  1318110048.0,  3936287067.0},
-  {3764662212.0,  1384305613.0,  2909311613.0,  3955434259.0,  3920490548.0,  2217517649.0},
-  {1240274141.0,  4066063612.0,  3037918887.0,   650083303.0,   647982008.0,   313802678.0},
-  {1585378044.0,  3636614630.0,  2060836709.0,  2696147400.0,   350587940.0,  2338203606.0},
-  { 360865932.0,  2936100685.0,   528981564.0,  4140877684.0,  1901823577.0,  1613625480.0},
-  {3835285369.0,  1603943556.0,   115583460.0,   955434449.0,  4045764860.0,  1321839474.0},
-  {1191203687.0,  3799792331.0,   366900540.0,   849713132.0,   421998107.0,  2990574480.0},
-  {3136530196.0,  3229095555.0,  1156989776.0,   635434296.0,  3406338891.0,  1748652623.0},
-  {  77621952.0,   903599621.0,    32308412.0,  2877039410.0,  1734251365.0,  1136193350.0},
-  {1995256521.0,  1668784493.0,  3190889844.0,  2768722798.0,  3907815168.0,   955633897.0},
-  { 966235917.0,  3251097888.0,    64105153.0,  1946436621.0,  2786114295.0,  1885172442.0},
-  { 780804517.0,  2119055356.0,  1895297162.0,  4118442786.0,  3024484746.0,  1817784649.0},
-  {1337040213.0,  2427842523.0,  1425121338.0,   178518171.0,  2796444895.0,  3746372962.0},
-  {1825293873.0,  1948031194.0,  3489199156.0,   428346890.0,  1543761352.0,   304271669.0},
-  {3203303476.0,  2287565489.0,  1614102649.0,   235351500.0,   859011517.0,  1370327452.0},
-  {2816747199.0,   681824589.0,  1865832145.0,  2358229826.0,   667165481.0,  1435167199.0},
-  {2555887337.0,  2213200835.0,   831100932.0,  2704447344.0,  3492492370.0,  4149597945.0},
-  {3309672017.0,  3221340723.0,  4243045174.0,  1190117444.0,   839257686.0,  3586634927.0},
-  {3747769644.0,  2155677142.0,  1639102377.0,  1826958443.0,  3984270882.0,  3149442914.0},
-  {3628362760.0,  1023794047.0,   284180830.0,  2735356793.0,  3201886739.0,  4134822768.0},
-  {3941694679.0,  3705732160.0,   743352873.0,  3807510250.0,   186847862.0,  3300684356.0},
-  { 624550439.0,  4155199813.0,  2055399973.0,  1543482117.0,  1445800107.0,  3935281540.0},
-  {3218467373.0,   378568083.0,  4107842811.0,  2292299946.0,   442096658.0,  1090723867.0},
-  {1737505517.0,  4019921461.0,  3924539013.0,  3087167347.0,   800640012.0,   632732693.0},
-  {1809292402.0,  3801523877.0,  2890859998.0,   995508536.0,  1611966504.0,    19791834.0},
-  { 263985792.0,   497993320.0,  3388393694.0,   123965099.0,  2201528696.0,  1124202493.0},
-  {3489904132.0,  2601166989.0,  2366687365.0,    90976697.0,  2627536647.0,   768033265.0},
-  {1621710195.0,   810706312.0,   508974881.0,  3111581106.0,  3708317300.0,   597488571.0},
-  {3217576450.0,  2462873977.0,  3423176702.0,  2672845134.0,  1524540038.0,  3091229998.0},
-  {1311794805.0,  2056003680.0,  1460345370.0,  1925793000.0,  1325650591.0,  4265129835.0},
-  {3460872130.0,  2127421765.0,  3431792979.0,  2682474984.0,  2562718293.0,  1913206306.0},
-  { 354642280.0,  2413430525.0,  1358371847.0,  2712292483.0,   816997353.0,   522018177.0},
-  {2373835898.0,  1040257460.0,  4291646693.0,  1179717102.0,  2271660698.0,  4008988902.0},
-  { 347395255.0,  2545845354.0,  1970409015.0,  1859200328.0,  3170714075.0,    95234952.0},
-  {3087050784.0,  4285923157.0,  3547675479.0,  3087350677.0,  2905072637.0,  2970665907.0},
-  {3343269336.0,  1570437129.0,   917836673.0,  1018696164.0,   676395215.0,  4205466914.0},
-  { 614202721.0,  1487891962.0,  2400939055.0,  1136751445.0,  2667919416.0,  1698374879.0},
-  {1696127320.0,  4260656715.0,  4119085885.0,  1931646281.0,   542093772.0,  3177006185.0},
-  {2803568183.0,  4158072888.0,  4215914343.0,  2784188271.0,  1638225952.0,  3955431946.0},
-  { 551592303.0,  3287227461.0,  1442662364.0,  2679020292.0,  2185283622.0,  2095975663.0},
-  {3217727216.0,  1629285805.0,    23370368.0,  4197892113.0,  3758982252.0,   677759078.0},
-  {1769772197.0,  3668120133.0,  2457416821.0,  3132893829.0,  3030066176.0,  3561198166.0},
-  { 420078814.0,  3078161904.0,   755905684.0,  1003542006.0,  2714599653.0,  3180304590.0},
-  {2573598640.0,  1336185513.0,  2643853014.0,  1818211947.0,  2006324615.0,  2653663801.0},
-  {1667769531.0,  2144761963.0,  1926569392.0,  1293296445.0,  2040038284.0,    82673940.0},
-  {2934708459.0,  3074449991.0,  3115579199.0,  1006570378.0,  1074684393.0,  3565129762.0},
-  { 472084288.0,  3695606413.0,   980948367.0,   679945848.0,  2137316457.0,  2188466941.0},
-  { 422803169.0,  3254697624.0,  3947449413.0,  1588257806.0,  3411029124.0,  4001820465.0},
-  {2064271979.0,  3618405086.0,  1153882114.0,  1507429223.0,  1393793170.0,  3274232574.0},
-  {1135631228.0,  3311528052.0,  1354215698.0,  1990890148.0,  2316735778.0,  3030766542.0},
-  {1681211579.0,   642212850.0,   716287244.0,   223440915.0,  3118654312.0,  2511387140.0},
-  { 437768332.0,  3461402588.0,   400814698.0,  1014558382.0,  3342907895.0,   189760650.0},
-  {2585193986.0,   128707521.0,   643337786.0,  2830150718.0,  2350081759.0,  3071139854.0},
-  {3270387311.0,   905429068.0,   461014650.0,  1541247911.0,  3878899645.0,  3505278198.0},
-  {2587464756.0,  2845431737.0,   704377296.0,   933869724.0,  3010713063.0,  3767766995.0},
-  {3504953061.0,  1957333753.0,  3097954869.0,  2994925625.0,  1008511647.0,  1960971436.0},
-  {1804810138.0,  2525274839.0,   498890962.0,   615649674.0,  2618190765.0,  2165613444.0},
-  {2141256314.0,  3636077037.0,    12617809.0,  3284601953.0,   452418830.0,  4236969641.0},
-  { 959958822.0,  3208846570.0,  1453359087.0,  3788518697.0,  3633170503.0,  2870568157.0},
-  {2392275290.0,  3314305611.0,  1196430753.0,  2913728559.0,  1441862621.0,  2769461272.0},
-  {2744373764.0,  2320489417.0,    46464432.0,  3776446697.0,   546790471.0,  3216543502.0},
-  {1327498362.0,  1876508356.0,  2178396245.0,  2358650312.0,  3386823600.0,   729746175.0},
-  { 904022174.0,  2431448039.0,  3896246127.0,  2766060002.0,  3638388340.0,  2834506124.0},
-  { 660258206.0,  2885509075.0,  2936776630.0,  2922393112.0,  2818862634.0,  2041150316.0},
-  {2090499303.0,  2892406611.0,  4079869796.0,  1433596636.0,   246481117.0,  1479665190.0},
-  {1681933054.0,  3302163099.0,  1934913780.0,  2605471290.0,  3672441197.0,  2642949810.0},
-  {3580971475.0,  4105125235.0,  3083046251.0,  2927472630.0,  1325987440.0,  4004401489.0},
-  {3826729604.0,  2317058310.0,   888291187.0,  1170768687.0,  2439626019.0,  1648889540.0},
-  { 685868122.0,    54380018.0,  1547257416.0,  1404864234.0,  2536769952.0,  1043655487.0},
-  {3834012639.0,   673324534.0,  2008979298.0,  1565552178.0,  1315189794.0,  1112301773.0},
-  { 589795940.0,  1904149677.0,  3540126360.0,  4070366141.0,  2699061866.0,   773009906.0},
-  { 561284183.0,   783006590.0,  4056249272.0,    29293956.0,  3750206822.0,  4238480447.0},
-  {3238293770.0,  2100070969.0,   175764708.0,  1733649014.0,  2892014343.0,   127775551.0},
-  {  61730714.0,  1847608012.0,   686191135.0,   851203605.0,  1349450331.0,  2043047870.0},
-  {2666043109.0,   365297683.0,   698658867.0,   711763896.0,   858604354.0,   721089127.0},
-  { 418721181.0,  4282236705.0,   710661785.0,  2490722725.0,   667013061.0,  3830950652.0},
-  {1053841795.0,  3080579697.0,  2176995433.0,  1487173489.0,  2025308116.0,  3441166572.0},
-  {2489572046.0,  3707163484.0,  2179618353.0,    16355077.0,  3834812199.0,  2741480774.0},
-  {4291624307.0,  2856083687.0,   981770298.0,  1113089038.0,  3632887847.0,   140270063.0},
-  { 339493879.0,  1069609217.0,  1529917224.0,  1985179207.0,  2369809928.0,  1425996964.0},
-  {2994048606.0,    54114155.0,  2197368034.0,  3668117217.0,  2118736540.0,  3356336751.0},
-  {4051254083.0,   248416649.0,   621065165.0,  3950240219.0,  1676144225.0,  3533467636.0},
-  {1142958983.0,  4177245422.0,  1375782655.0,  2703165393.0,  2202891415.0,  1698382222.0},
-  { 854600142.0,  1494272880.0,   418012223.0,  4091867510.0,  3742239438.0,  3253056314.0},
-  { 926247678.0,   476657151.0,  3678164229.0,  2439033755.0,  4209181438.0,  2937804082.0},
-  {1908565119.0,  3082961425.0,  3686710674.0,  3904409851.0,  3621594353.0,  1882568263.0},
-  {3843620527.0,  3261707829.0,  2307072090.0,  3220873986.0,  2040895386.0,   896431136.0},
-  {3000689045.0,   607350576.0,  3474273467.0,   942378634.0,  1685652835.0,  3243536993.0},
-  {2308018543.0,  1523540496.0,  3098998184.0,  2179859923.0,   412734267.0,  3135234298.0},
-  { 354762532.0,   381401582.0,  3544339265.0,  2252591632.0,  3442003481.0,  3991318796.0},
-  {1570201979.0,  1222406518.0,   285706678.0,  2846309643.0,   422021488.0,  3769929854.0},
-  {2934601814.0,  1784390375.0,   604605620.0,  2586820364.0,  2629569186.0,  1141043567.0},
-  { 663512034.0,  2675259672.0,   758834230.0,  3616594283.0,  2845649249.0,  3007664252.0},
-  {4047610601.0,  3186821766.0,  3764912817.0,  4291750268.0,   999163557.0,   732645995.0},
-  {3833367863.0,  3389205624.0,  4174655076.0,  1811188337.0,  4162987920.0,  1452073693.0},
-  {2995737293.0,  3903501021.0,   456100953.0,  1881557563.0,  3619723751.0,   120243083.0},
-  {2101709691.0,   360345844.0,  3494029104.0,  1456891547.0,  1276301157.0,  3398777948.0},
-  {2059372183.0,  1381871280.0,  4167501893.0,   196990457.0,    41369377.0,  3110289657.0},
-  { 688817078.0,  1339216056.0,  3105015008.0,  1860093223.0,  3586290543.0,  1746187488.0},
-  {2049866190.0,  2662434034.0,   499113486.0,  1433680478.0,   625832305.0,   809046623.0},
-  {4072367827.0,   405122264.0,  3015605829.0,  2884234088.0,   132243990.0,  3918967257.0},
-  {4017152785.0,  3607515897.0,  4192543814.0,  4131853919.0,  3099608005.0,  3079492147.0},
-  {2740895927.0,   299398873.0,  2516564535.0,  3058475146.0,  1399260622.0,  1427103984.0},
-  { 375751364.0,    88670078.0,  3808065963.0,  1825967987.0,  1549319398.0,  3919242893.0},
-  {2209470006.0,  1406998841.0,    53216699.0,  3292617321.0,  1666156799.0,  1222388480.0},
-  { 997645765.0,  3615180679.0,  1316112103.0,  2482637140.0,  1372093452.0,  2930911923.0},
-  { 780333828.0,   908782183.0,  3655851883.0,  1793773044.0,  1983609693.0,  2425410108.0},
-  { 224390731.0,   906149331.0,  3831027467.0,  4086567009.0,  2492825837.0,  1195254074.0},
-  {1732391726.0,  3035215421.0,   328852928.0,  4072348476.0,  2119323292.0,   382325543.0},
-  { 175521675.0,  2594032323.0,  2066648725.0,  3818524644.0,  4260664534.0,  2325088774.0},
-  { 532016175.0,  4258243999.0,  1412028376.0,  1710976373.0,  1653526038.0,   234838198.0},
-  { 551193676.0,  2619154968.0,   789545790.0,  4269872382.0,  2483105744.0,   458008730.0},
-  {4006101655.0,  4132336478.0,  1558726784.0,  1271069535.0,   169206745.0,   454320584.0},
-  {2892824187.0,  4266049879.0,  3948777080.0,  1437960469.0,  1344945933.0,   988362170.0},
-  {2606969996.0,    22805034.0,  2961450120.0,  1102205205.0,  3690232126.0,  2935925829.0},
-  {3827253509.0,  2959428206.0,  2107314787.0,   565538878.0,  1255225069.0,  3048771427.0},
-  {3595132731.0,   569917765.0,  2708442497.0,  2081733321.0,  2261210601.0,   922978201.0},
-  {2714001392.0,   112727529.0,  3647213885.0,  2042188797.0,  3185880568.0,   369768032.0},
-  { 415894737.0,  3382666963.0,  2305422522.0,  1916374899.0,   971762338.0,  1455722682.0},
-  { 239531489.0,  2956180600.0,  3564624774.0,  3431744360.0,   539797141.0,  3942764895.0},
-  {2002035402.0,  2771499719.0,  3706572816.0,  1366604498.0,   965611999.0,  2209704610.0},
-  {2260311639.0,  1606053330.0,  3061146053.0,  2325383419.0,  3812589902.0,  1507738433.0},
-  {2812874171.0,  3993092866.0,  2971740494.0,  1171490896.0,  2732930263.0,  1453086862.0},
-  {1359381508.0,  3935175939.0,  2491230746.0,  1976357600.0,  2695147003.0,  3723238041.0},
-  {  19441057.0,  3181052456.0,  3055392446.0,   623036216.0,  3527252341.0,  2694271778.0},
-  {1841395599.0,  2150253708.0,  4267634428.0,   589798617.0,  2243177229.0,  2352874624.0},
-  { 887679554.0,  1213812899.0,  1097722518.0,  1718648455.0,  3633426174.0,  3952662798.0},
-  {1036318169.0,  1421002333.0,  2189904822.0,  3384653696.0,   377007241.0,  3111872397.0},
-  {2599261531.0,    97283155.0,  1593274823.0,  1286459747.0,  2398980822.0,   156850116.0},
-  {1720959837.0,  1647534759.0,  4289719553.0,  4209699452.0,   459410611.0,  2564458229.0},
-  {3837740535.0,  1521159090.0,   408927695.0,   647539571.0,   709148937.0,  3968751209.0},
-  {3224831351.0,  3489706627.0,  2164502044.0,  2065384752.0,  2136593368.0,  1788496721.0},
-  {1192070671.0,  3632962946.0,  2360506949.0,  1914092445.0,  2162184568.0,   787596077.0},
-  {2425108647.0,   487634590.0,  2402942990.0,  1192568312.0,  1126277034.0,  3545172769.0},
-  { 226638442.0,   996910790.0,  1032375333.0,  2423848494.0,  1957103187.0,  1097987715.0},
-  { 901729664.0,  3683395460.0,   331916379.0,  2421022332.0,  2451316637.0,  3221052518.0},
-  {2324283389.0,  3980402648.0,   909451590.0,  3456420597.0,   566308252.0,  1902340646.0},
-  { 615969000.0,  2771832708.0,  2328296470.0,  1806431044.0,  1415459767.0,  3918182707.0},
-  {4052911379.0,  3157432919.0,  1825327506.0,   680164867.0,   248414550.0,   160830205.0},
-  {1059084110.0,  1229348625.0,  3526992272.0,  3440207737.0,  2123592348.0,  1140874543.0},
-  {2797750810.0,  2576550862.0,  3495867551.0,   129796626.0,  2615821741.0,   279981651.0},
-  {2098429018.0,   524458992.0,  3292198578.0,   206144230.0,  3229703947.0,  2499244371.0},
-  {1747825435.0,  1679948675.0,  2073102181.0,  1959056653.0,  1918190536.0,  3263200568.0},
-  { 146970391.0,  1674670440.0,  1016122068.0,  2185419207.0,   688089328.0,  3066953320.0},
-  {1367937554.0,  1876085200.0,  4171762752.0,  3493554696.0,  3069847652.0,  4046335846.0},
-  { 520844525.0,  1895273834.0,  3542193846.0,   823555528.0,  2980302988.0,  4019288529.0},
-  {2998178507.0,  3172234914.0,  1477098041.0,  3578587411.0,  3025777981.0,   150201297.0},
-  {1661291088.0,  1162982937.0,  1637913057.0,  2982053901.0,  4243689464.0,   456770151.0},
-  {3255648162.0,   986614143.0,  1089772993.0,  3795431309.0,  2044081907.0,  4207186261.0},
-  {3086952909.0,  1569332466.0,  3169815670.0,  3100275214.0,  3797570151.0,  3442621947.0},
-  {1552736556.0,  1863460449.0,  1437084759.0,  2032978763.0,  2239677225.0,  3604247601.0},
-  {3431582949.0,  3597845197.0,   774762778.0,  2334678352.0,   840913938.0,  1569425503.0},
-  { 523018754.0,  1734195174.0,  1508156564.0,  3381507805.0,  1900364049.0,  1159618553.0},
-  { 215718454.0,  3854307929.0,  2334483907.0,   194755556.0,   462053974.0,  2265431284.0},
-  { 597275848.0,  1043464649.0,  3540507521.0,  1910271126.0,   993705870.0,  2605715060.0},
-  { 631841639.0,  4071891103.0,   604990303.0,  3850140575.0,  1422599299.0,  1745432209.0},
-  {2355323195.0,  2484973764.0,  4125623561.0,  4051361193.0,  3234947283.0,  3593575506.0},
-  {3075287347.0,  3382171307.0,  1961405186.0,  1556108939.0,  2581446533.0,  4059057398.0},
-  {3883583698.0,  2787530639.0,  3122333247.0,  2741980732.0,  2165604692.0,   646339560.0},
-  {3966251155.0,   851317929.0,   993859047.0,   573590697.0,  3816376725.0,  4067211386.0},
-  {2610413257.0,  3570396023.0,   841185081.0,  2010877727.0,  3526806391.0,  4214235326.0},
-  { 430003436.0,  3927889716.0,  4092607332.0,   250332455.0,  2747769194.0,  1995760412.0},
-  {4004384523.0,  2027139014.0,  3994516626.0,  1905396902.0,  2340624242.0,  1845513053.0},
-  {2776739518.0,  2604122827.0,  3983038365.0,   978256450.0,  4281283034.0,  2985436777.0},
-  {3451893752.0,   341679529.0,   110413624.0,    61417024.0,    81161927.0,  1450010958.0},
-  {3371171427.0,  3875924227.0,   663459451.0,  3158456520.0,  1844035116.0,  3514368491.0},
-  { 765519491.0,    90406964.0,  3883234706.0,  4008161480.0,   339210539.0,  1631252192.0},
-  {2709925155.0,   693767897.0,  3282662224.0,  1388639618.0,  1320557009.0,   707863736.0},
-  {2857219003.0,  3273236629.0,  4287190998.0,  3185519270.0,   798865859.0,  2030332119.0},
-  {3907191082.0,  3503682581.0,   509870447.0,   557229396.0,  3416735337.0,  1473909066.0},
-  {3865909487.0,  4035481713.0,  2465031637.0,  1835256311.0,  1744823928.0,   159801523.0},
-  {1702721573.0,  3313413180.0,  3531266080.0,  3922801285.0,  1776115133.0,  2867154470.0},
-  {2103478132.0,  1236647437.0,  1765283307.0,  1266489395.0,  2722195814.0,   497218113.0},
-  { 174517246.0,  2814908030.0,   888845120.0,   884919195.0,  2280848620.0,  3340501857.0},
-  {3484959538.0,   972583283.0,   204134582.0,   752735171.0,   468503134.0,  4158520466.0},
-  {4060267185.0,  4130204835.0,   848010871.0,  2693737437.0,  1828790349.0,  1134152794.0},
-  {3388392037.0,  1456324634.0,  3303461390.0,  2385789065.0,  1032722223.0,  2735739412.0},
-  {1203433202.0,  2000658706.0,   592015207.0,  1431489972.0,  2568907904.0,  1760163904.0},
-  {1492422071.0,  3857541410.0,  3777880045.0,  3093085151.0,   399925961.0,    96469405.0},
-  {1034887930.0,  2759194370.0,  1787104763.0,   513673623.0,  1613187598.0,   254936249.0},
-  {2618354976.0,   547809853.0,  4204056249.0,  3693104220.0,  3504381994.0,  2831436473.0},
-  {  96597203.0,   115935429.0,  4074800889.0,   862093621.0,  1014938608.0,  3804611265.0},
-  { 252469397.0,  3926882287.0,  3546816711.0,  1468336583.0,  2009444779.0,  3180032121.0},
-  {1029051394.0,  2494840565.0,  3299298569.0,  1005140694.0,   880499444.0,  4144740768.0},
-  {1151616738.0,   482441718.0,  2732220421.0,  1449067430.0,   146513841.0,  2065829258.0},
-  {1268655498.0,   392805478.0,   706313179.0,   177451975.0,  4043455551.0,  3473965499.0},
-  {1547068548.0,  2044799461.0,  2467220285.0,  4048941574.0,   185223972.0,  2218974081.0},
-  {1897045846.0,  2969407049.0,  2877661482.0,  3034874792.0,  2677910051.0,  1191420074.0},
-  {4278246830.0,  1603638499.0,  1974143135.0,  1915809085.0,  1933427111.0,  2270476332.0},
-  {3550027763.0,  1514045532.0,  1197604536.0,  2450158037.0,   335048344.0,  2273568814.0},
-  { 717671560.0,  3022205005.0,  3591939652.0,  4286284267.0,  1704499688.0,  2891275904.0},
-  {2865027425.0,  3732113028.0,   843980930.0,  4149956098.0,    48734080.0,  2060375441.0},
-  {4128672356.0,  1028449721.0,  1454008962.0,  2971302374.0,  2191930586.0,  3003183700.0},
-  {1857885302.0,  1106023273.0,  3122055454.0,  3575446214.0,  1944736699.0,  2372449352.0},
-  {3575701843.0,  2446899093.0,  1031359921.0,  2846577537.0,  3461638684.0,    65219914.0},
-  {2016800348.0,  3446802271.0,  1787477793.0,  1911655672.0,  1058576660.0,  3258073924.0},
-  {2368730075.0,  3377892742.0,  2445813949.0,  3000434750.0,  1545333535.0,   282371052.0},
-  { 400870596.0,   914449289.0,   842574592.0,  1678308818.0,   591512621.0,   928691462.0},
-  {1968000488.0,  4165300640.0,  1345335354.0,  1656560486.0,   835518118.0,  1781343518.0},
-  { 481615375.0,   653668181.0,  2384997529.0,  1952422485.0,  2926734468.0,  2511187105.0},
-  { 442631342.0,  2948564224.0,  2862384923.0,  2748420885.0,  3423694810.0,  2435246481.0},
-  {3926037395.0,  4220035382.0,  4143670493.0,  4256208585.0,  3936607653.0,  1986961273.0},
-  {2474020087.0,  3240601925.0,  4147163836.0,  3211373256.0,   677536109.0,  2380625689.0},
-  {3045914678.0,  3571509677.0,   680495893.0,  1027388512.0,    79291194.0,   139653507.0},
-  {1998188537.0,  1093937281.0,  3655107330.0,   856936721.0,  2693044819.0,  1204964681.0},
-  { 339546720.0,   547066662.0,  2824017099.0,  1727967858.0,   291782288.0,  3043233409.0},
-  {3764037623.0,  4100257097.0,  4026981119.0,  1098389688.0,  1282447024.0,  2975137286.0},
-  {3809291573.0,  2589182731.0,  4133714152.0,   374069589.0,  1719299400.0,  4272410971.0},
-  {3460982520.0,  3712631620.0,  1685549493.0,   356359681.0,  2046322098.0,  1534714489.0},
-  {2628892730.0,  4065543510.0,  2035154617.0,  2269701028.0,  3454259021.0,  2790460553.0},
-  {2888604421.0,  3041284550.0,  2805363566.0,  1427843162.0,  3164249904.0,  1380885022.0},
-  {1022952503.0,  1213491063.0,  4119890047.0,  1600842347.0,  1380260081.0,  3442358983.0},
-  { 280208579.0,  3464972468.0,  3867216077.0,  2938767599.0,  2082887834.0,  3980068864.0},
-  { 482683331.0,   993087638.0,   183924741.0,  3736774473.0,  3566704865.0,  1420843651.0},
-  {1475198793.0,   454023038.0,  1482930972.0,  2883061746.0,  3344885012.0,  2617441405.0},
-  {3762278716.0,  4100103179.0,  3008834949.0,  3526245673.0,  2814709499.0,   469727333.0},
-  { 155374651.0,  2558331448.0,  3814375778.0,  3927848687.0,  1084490880.0,  1555338120.0},
-  {2356061864.0,  3311546994.0,  2598878142.0,  3363447287.0,  1703101234.0,  3380337029.0},
-  {1222623725.0,  1458042381.0,  3581949955.0,   917225395.0,    96647823.0,   735263429.0},
-  {4270010676.0,  1679715909.0,  3572344381.0,  2364209803.0,  1596466315.0,  1683178719.0},
-  {1525141054.0,   658550394.0,   266032988.0,   212056330.0,  3433010580.0,  3177257727.0},
-  {3507764756.0,  2622899686.0,   264318059.0,  4053164876.0,  1671159436.0,  1710228570.0},
-  {3072884217.0,  4025935471.0,  3299405645.0,   418439401.0,   923922731.0,   810109373.0},
-  {1762683000.0,  3131506612.0,  1301510708.0,  1382295474.0,  2209255722.0,  2107027731.0},
-  {  55207412.0,   986629658.0,  1013574708.0,  2894506056.0,  1418526744.0,  3708365694.0},
-  { 460769466.0,  3439381825.0,   829350656.0,  1765310038.0,  2554009698.0,  2110488176.0},
-  {1731963341.0,  3732914459.0,   437270047.0,  2217539414.0,  2006659839.0,  2840411505.0},
-  {3413510838.0,  4019760697.0,   691459340.0,  2697358479.0,  2723509304.0,  3333705618.0},
-  {2689847613.0,  3084492531.0,  1483525736.0,  3085095710.0,  3897189930.0,  2475157971.0},
-  { 920315545.0,  3872891220.0,  1562294601.0,  2100598038.0,  1898498096.0,  1635971653.0},
-  { 124287625.0,   924708375.0,   499106954.0,  3519580831.0,  3439059487.0,  2089064656.0},
-  { 861928611.0,  2985777343.0,  1715574021.0,  3824538434.0,  3121964376.0,   662616022.0},
-  {4166605906.0,  1213568619.0,   130400995.0,  3817611833.0,  1432030001.0,  1625018228.0},
-  {2309564582.0,  3824148991.0,  4110452211.0,  2968937403.0,  1436864987.0,  2818180022.0},
-  {  53277469.0,  2050746366.0,  1190684105.0,  3620392621.0,  1174021157.0,  1297564239.0},
-  { 259544375.0,  2495362455.0,  2292109159.0,  2420770768.0,  1452196454.0,  2251095118.0},
-  {3147621759.0,  2579260647.0,  1590135123.0,  1960508176.0,  4253474356.0,  1973252318.0},
-  {1353535813.0,  2577102344.0,  2595508638.0,  3703377944.0,  1760012535.0,  3081329726.0},
-  {  45613269.0,  4061601437.0,  2153887707.0,  2300040992.0,   305240884.0,  2843207081.0},
-  {  13170902.0,  1352363430.0,  3873489534.0,  1039224850.0,   970959573.0,   789153660.0},
-  { 898500619.0,  2133759154.0,  1027572670.0,  2650039662.0,  1910797168.0,  3834389967.0},
-  { 740365115.0,  2253537525.0,   245927719.0,   832344915.0,   266872903.0,  4288466966.0},
-  {1685052152.0,    56984267.0,  2269823543.0,  2821256539.0,  2315558218.0,  1718926869.0},
-  {1669394732.0,   935092351.0,  2429959990.0,   159381272.0,   937399832.0,  1932708422.0},
-  {2107137972.0,  1272873950.0,  1398801715.0,  1262487425.0,   740067435.0,   643760173.0},
-  {2550480027.0,  2609979401.0,  4119874049.0,  3053021395.0,  1021289445.0,  1375651143.0},
-  { 569617913.0,  3141969398.0,   602111983.0,   712431250.0,  3140012235.0,  1428678896.0},
-  {1196175203.0,   571352285.0,   209171595.0,   301272739.0,  2187074915.0,   976036732.0},
-  {1402653976.0,  1950229651.0,  2192090853.0,  3975844156.0,  1320418474.0,  2409719473.0},
-  { 805826623.0,   183935820.0,  2572316016.0,    52294047.0,  2240346752.0,   429875449.0},
-  {1857967218.0,   809875783.0,  2022474004.0,   293885463.0,  1300218327.0,  2801978291.0},
-  {4250326370.0,  2679794481.0,  2307603448.0,  2350889968.0,  1776367687.0,  2533713127.0},
-  { 703768985.0,  3412541752.0,  1947484822.0,  4135249844.0,  1999135803.0,  1347345410.0},
-  {1804587745.0,  1870461371.0,  2898173619.0,  1790259354.0,  2810369689.0,  3019601491.0},
-  {1117351793.0,  2453115649.0,  3102867149.0,  3035898369.0,  2115947691.0,  1990115495.0},
-  { 188316725.0,   908406105.0,  1302399975.0,  1272150459.0,    78386715.0,  2674052101.0},
-  {3231728036.0,  1268615984.0,   507536297.0,  1231483549.0,  2399851283.0,  2447769897.0},
-  {2711685840.0,  3240739382.0,  3663742827.0,  3001819987.0,  1520934352.0,  2282130483.0},
-  {1629480777.0,   222896208.0,  1871153374.0,   240174557.0,  4123235415.0,   949261981.0},
-  {3921755394.0,    59912809.0,  1849144305.0,  1642839474.0,  3854516285.0,  3500996304.0},
-  { 912069179.0,  3740857494.0,  1197675000.0,  2447206670.0,  1223416237.0,  3424779063.0},
-  {3626403725.0,  3027194517.0,  3358410740.0,  2633027649.0,  1483536397.0,  2653964927.0},
-  {4065791251.0,   757745128.0,  3807114398.0,  3177069139.0,  2757763240.0,  3053293193.0},
-  { 980821668.0,   479529118.0,  3183348499.0,  3592331249.0,  2166032144.0,  1340549251.0},
-  {2695296174.0,  2095267924.0,  4226326019.0,  2555852746.0,  1884062548.0,  3837645636.0},
-  {3811962369.0,  3489283991.0,   430217342.0,   922427569.0,   945684031.0,   913561568.0},
-  {2259964795.0,   339680350.0,  3255183293.0,  3148793277.0,  2715407180.0,  3604818524.0},
-  {2106957037.0,  2853964863.0,  4286378936.0,  3874678862.0,  2614915151.0,  3594724141.0},
-  {4098087505.0,  3521897929.0,   358965236.0,  2614341579.0,  2058081142.0,  1896240080.0},
-  {1603012900.0,  2505519949.0,  1989873337.0,  1991155884.0,  3980540891.0,  3173985019.0},
-  {2887340556.0,  3458303670.0,  2966950183.0,  1564518179.0,   590356968.0,  4265424224.0},
-  {3337685334.0,  2979226718.0,  2921380395.0,  2215406220.0,   758019991.0,   132264141.0},
-  {2539743722.0,  2228917896.0,  2009317274.0,  2747217902.0,  1437061773.0,  2072998246.0},
-  {3388832746.0,  2670979988.0,  1741473899.0,   163312994.0,  4180727808.0,  3924505267.0},
-  { 126894862.0,   587396352.0,  3204858128.0,  2308638216.0,  2605472449.0,   952743754.0},
-  { 863348361.0,  3339491891.0,  3295383006.0,  3296389500.0,  1394755600.0,  4215712310.0},
-  {1370605136.0,  1776238083.0,   258509350.0,  3309773228.0,  4085866992.0,  4027226619.0},
-  {2530898215.0,  2998217076.0,  2133534659.0,  1827132570.0,  4158274627.0,  3929104235.0},
-  {3921547100.0,  1650741805.0,  2209126124.0,  2222090438.0,  3284426794.0,   486659938.0},
-  {2141119088.0,  2361075083.0,   844982340.0,    45033792.0,  1762222371.0,   826544289.0},
-  {3209654076.0,   576171966.0,  3943660616.0,   143073079.0,  2928706025.0,    91365404.0},
-  {1750410264.0,   411393976.0,  3750573181.0,  4052554995.0,     4810686.0,  3812608354.0},
-  {1716989510.0,  1243973587.0,  2396087356.0,  1298732366.0,  4094249212.0,    64237519.0},
-  {1418493709.0,  2590338890.0,   400259683.0,  2393927150.0,  2940707361.0,  1160893245.0},
-  { 915831788.0,  1194599191.0,  3033192379.0,  1027187163.0,  2713521321.0,   506497264.0},
-  {1548755803.0,  3613477944.0,  3579616040.0,  2727939905.0,  3082990798.0,  3918185518.0},
-  {3269716878.0,  2995827510.0,  1544049085.0,  3317561825.0,  2726824137.0,  4121808011.0},
-  { 170744258.0,   122999768.0,  3888476012.0,  2600136064.0,  3526515722.0,  3204719217.0},
-  {1786394275.0,   798519663.0,  3128648388.0,  3458096950.0,  2104661436.0,   325412361.0},
-  {4283815304.0,  1666215302.0,  1824628686.0,    60100886.0,  3817040421.0,  3150410357.0},
-  {2603045593.0,  3848598084.0,  2867124929.0,   955564124.0,  2725228055.0,   759200657.0},
-  { 538955518.0,  1491441689.0,  4241286260.0,   404307021.0,  2266837694.0,  2966437059.0},
-  {2345553770.0,  3955983118.0,  4072924114.0,  4219686151.0,   793988516.0,  2149901310.0},
-  {3285119841.0,   978085287.0,  2437418509.0,   698553072.0,  4265075641.0,   401195678.0},
-  { 419356222.0,  3692808772.0,  2356099170.0,  4054270021.0,   802565345.0,  1539581088.0},
-  {2827646767.0,   587161146.0,  2472359027.0,  1631441228.0,   116664365.0,  3228388920.0},
-  {1778582143.0,   842200902.0,  3222199130.0,  1355242706.0,  1836170391.0,  3934246235.0},
-  {1106268458.0,  2417203817.0,  1836996572.0,  2765607616.0,  4190921629.0,  1498774480.0},
-  {4085778530.0,  3832471521.0,  3135038113.0,  2327628763.0,  3534722178.0,   742195806.0},
-  {2595973625.0,  3496541488.0,  2187803792.0,   728989702.0,  3925703759.0,    61606223.0},
-  { 913656298.0,   585717211.0,  2883804960.0,  3735478284.0,  1250309879.0,  1144932009.0},
-  {2112526302.0,   357991456.0,  2889766155.0,  4179942762.0,  2625137844.0,   856878387.0},
-  {1491129423.0,  1976481785.0,   204841525.0,   205505136.0,  2096854621.0,  3853885651.0},
-  {3537912002.0,  1731144308.0,   104686169.0,  1719578938.0,  2167489412.0,  1805535806.0},
-  {2341193677.0,     8040761.0,   125290982.0,  2133819331.0,  1595409352.0,  3311983283.0},
-  {3266916695.0,  3587688705.0,  2939123499.0,  3571809967.0,  3340842405.0,   783600735.0},
-  {1889539332.0,   201767142.0,   528550293.0,  2258781927.0,  1969410485.0,  1327767609.0},
-  {1201675226.0,  1470829021.0,   741977235.0,  3567955795.0,  1201035276.0,   931222877.0},
-  {2164372833.0,   471916236.0,  4280905351.0,  2689204816.0,   334516392.0,  1363228581.0},
-  {2764811417.0,  2141561105.0,  2986541687.0,  1685714842.0,  1057462293.0,  3852143459.0},
-  {1336241185.0,   885653384.0,   660518496.0,  1561715588.0,  1300624555.0,  2148512109.0},
-  { 752808441.0,  2177978375.0,  3306138292.0,  2010678661.0,  2919755958.0,  2618615223.0},
-  {4048081921.0,  3484009500.0,  1949064959.0,  1932583407.0,  3634728800.0,  2787358029.0},
-  {1984443821.0,  2050454418.0,  2807341789.0,  3573119766.0,  1508387008.0,  3078273723.0},
-  {3580644807.0,  3802081916.0,  3683230747.0,  2991397192.0,  1130205106.0,  3375075242.0},
-  {1208071309.0,  3300208080.0,  3800161277.0,  1478086925.0,   594488422.0,   416031362.0},
-  { 490597718.0,   567003390.0,  2129073898.0,  3107470682.0,  1400055560.0,  2637846281.0},
-  { 842549354.0,  1155051093.0,  2387048682.0,  2264394291.0,  3182400971.0,  2086926238.0},
-  {1227127400.0,  2907131449.0,  3680276913.0,  3096770496.0,  1832838218.0,  1036567153.0},
-  {4271164504.0,  3584807650.0,  1549531000.0,  1993324354.0,  1308268291.0,  1220746574.0},
-  {4207490525.0,  1446990099.0,  1318764264.0,  3698110890.0,  4139889328.0,  1081530696.0},
-  {3565814519.0,    37405859.0,  1342659998.0,  4137932617.0,  1406637334.0,  2578059597.0},
-  {3889089146.0,  2405310616.0,  1388071780.0,  1681074497.0,   541341833.0,   359514206.0},
-  { 548493341.0,   169469761.0,  1767556968.0,  3634348953.0,    41993355.0,     8958559.0},
-  {2802113419.0,  4262788370.0,  2699317081.0,  2464418624.0,  4164879276.0,  2012183035.0},
-  {3228930236.0,  1665405565.0,  1258997729.0,   525196411.0,  2254099620.0,  3136698228.0},
-  {4253121568.0,  1464625822.0,  2285651864.0,  1153237097.0,  3418315374.0,  2913762488.0},
-  {2490882856.0,  1872015471.0,   400398539.0,  2021023813.0,  3000022741.0,  4224419523.0},
-  {2194300857.0,  3775832855.0,  1899556692.0,  1944957304.0,  1468238875.0,   672153511.0},
-  { 672046322.0,   820582712.0,   264391574.0,   486260480.0,  3045152135.0,   763399660.0},
-  {2184576903.0,  1095034838.0,  1440531834.0,  1086260714.0,     7286182.0,  2473286756.0},
-  { 220792801.0,  3055447631.0,   777385751.0,  1485574812.0,  2798920600.0,  4112518633.0},
-  {1569753459.0,  2606380909.0,   877018317.0,  3189589658.0,  1992596265.0,  3000892830.0},
-  {3629339019.0,  2127026291.0,   927706505.0,  3680936715.0,   719545368.0,  2111006163.0},
-  { 193261752.0,  1937936386.0,   197188517.0,  3582557720.0,  3444940256.0,  3931420109.0},
-  {2453159923.0,  4269489256.0,  2770620361.0,   839983522.0,  4097838884.0,  3561777176.0},
-  {2392544407.0,  4181487087.0,  4019834438.0,  3266547286.0,  2175815234.0,  2117564740.0},
-  {1454423071.0,  1362099891.0,  1851051779.0,  2339436756.0,  3999739588.0,  1996481714.0},
-  {3945616759.0,  2014265589.0,  1098188816.0,  4159935748.0,   303752084.0,  1053462228.0},
-  { 341540682.0,  3044464623.0,  4131623313.0,  3154509399.0,  2052584631.0,   718584169.0},
-  {2038886378.0,   342479659.0,  1182194875.0,  2112149134.0,  1723234457.0,  1340278217.0},
-  { 335138650.0,  3998496137.0,   236783676.0,   221236008.0,  4079724732.0,   666789920.0},
-  {3517536000.0,   210304739.0,  4135370021.0,  3724537939.0,  1428709507.0,   818829823.0},
-  {  80841250.0,  2290074301.0,  2385230050.0,  2336802711.0,   309871424.0,  2803341757.0},
-  {3089988559.0,  2675485217.0,  1575517685.0,  3710832975.0,  3202453218.0,  4233612613.0},
-  {1557506247.0,  4038525057.0,  1793219782.0,   226755336.0,  1368211140.0,   754628752.0},
-  {  42168946.0,  2099016495.0,  1357662273.0,   626649190.0,  2057773384.0,   586725654.0},
-  {1452596134.0,  2943577138.0,  2743242467.0,   895053662.0,  3315430256.0,   792897896.0},
-  {2437236464.0,   366803881.0,   164225963.0,  3901274436.0,  3533452290.0,  1546872283.0},
-  {2538215319.0,   998134952.0,  3766105651.0,  3988608000.0,  1825673735.0,   100899709.0},
-  {4293813903.0,  1024453508.0,  2710589630.0,  1495918098.0,   190044641.0,   979892295.0},
-  { 669139007.0,  3684983560.0,  3973553771.0,  2868228670.0,  3016324650.0,  4162636606.0},
-  {3662877890.0,  1766888794.0,  2655168170.0,   909934369.0,   204117075.0,  3097768254.0},
-  {3662892717.0,  2383298264.0,   125331424.0,  1198454997.0,  1659764294.0,  3417351342.0},
-  { 618536139.0,  4247301859.0,  3488431321.0,   975423834.0,  1479014101.0,  2038999225.0},
-  { 687801559.0,  2477245684.0,  2065646271.0,  2520538098.0,  3302823581.0,   852005760.0},
-  { 905255898.0,    26877071.0,  2025649746.0,  2112891599.0,  3413236442.0,  3895635549.0},
-  { 774390665.0,  3680975248.0,  1554450909.0,  3896618160.0,  3011411288.0,   408325973.0},
-  {3069902588.0,  3665343469.0,  2457949664.0,  3823835356.0,  3988762647.0,  2525158839.0},
-  {  70956312.0,  3705342095.0,  3190355829.0,   777818523.0,  4271006387.0,   647973508.0},
-  {1313495673.0,   632375193.0,  1826436405.0,  1374190271.0,  3535484591.0,  4235241203.0},
-  { 443485961.0,  2899888467.0,  1655132707.0,   657132163.0,  3053887839.0,  1509608723.0},
-  { 924836440.0,  3764052598.0,  2125406462.0,  2650223574.0,   206983545.0,  1088756684.0},
-  {3680421100.0,  2719841777.0,   711108040.0,   301407494.0,  1265409427.0,  3367801378.0},
-  { 799312102.0,  1508576427.0,  1144617016.0,   904415856.0,   214264502.0,   670860700.0},
-  {4207344021.0,  1633492082.0,  2190527467.0,   209420943.0,   402510252.0,  2832186742.0},
-  {3568028178.0,   788003568.0,  1245589707.0,  1907656666.0,  3098134788.0,  2312931987.0},
-  {3599384675.0,   895576675.0,  4285744318.0,  2115905609.0,  1790758469.0,  3646747890.0},
-  { 301235444.0,  3866727950.0,  2688482580.0,  4207026792.0,  4101799802.0,  2371744032.0},
-  { 259086409.0,  3693940131.0,  4151228693.0,  3959627149.0,  3437494300.0,  3975706634.0},
-  {2839429924.0,  1823402723.0,  3423265595.0,  1056225553.0,   961286311.0,   836885510.0},
-  {2117097429.0,  1382487478.0,  1120747837.0,  2836712118.0,  2440209921.0,  2013863408.0},
-  {1134659126.0,   816325893.0,  1559743535.0,   463907373.0,   663316292.0,  3793680287.0},
-  {3692066337.0,  2793230959.0,  4198297952.0,  4044029740.0,   695318325.0,  1848528970.0},
-  {4160320017.0,  2851319138.0,   560449290.0,  2985051850.0,  1217520232.0,  2886219097.0},
-  {4065037191.0,  4096297085.0,   126592509.0,  1882412498.0,  2071354840.0,  1970377376.0},
-  {3873027769.0,  2578067961.0,  2639417140.0,  3432685125.0,  2037805466.0,  3413879797.0},
-  {4220265305.0,  3348317323.0,  3151133583.0,  2706411106.0,   801810366.0,  1285771380.0},
-  {2749601016.0,   335663763.0,   545364835.0,   833856179.0,   716857454.0,  3216016393.0},
-  { 718887888.0,  1072983414.0,   870381890.0,  3161181190.0,  3976603151.0,  1956228564.0},
-  {2964858801.0,  3380762279.0,  1206731251.0,  4143865064.0,   552056672.0,   459051192.0},
-  { 366900116.0,    75634513.0,   588019354.0,  2379590462.0,  1753812071.0,   482084766.0},
-  { 386211099.0,  3713902130.0,   792273695.0,   874158135.0,  1854240145.0,  2650815831.0},
-  {2054822600.0,  3904416398.0,  2140018275.0,  1000519663.0,   881117828.0,  2238656145.0},
-  {2612770866.0,  1225290197.0,  3088526307.0,   933459653.0,  3472274959.0,  2776290834.0},
-  {2022714530.0,  1896135065.0,  3769055279.0,  2454834725.0,  1452571079.0,  3880603426.0},
-  {3638337222.0,  3243510637.0,   739316519.0,   909083000.0,   734964160.0,  3793734958.0},
-  {2491911246.0,  2347837334.0,  3704097999.0,  3533586623.0,  3556053494.0,   819329607.0},
-  {2143103893.0,   152932167.0,   473989616.0,   527585409.0,   526430141.0,  2061345668.0},
-  {3202727548.0,  1756570413.0,   679136752.0,  2603754615.0,  3863142794.0,  2683474662.0},
-  {3940245782.0,  3479508524.0,   575090152.0,  1440616260.0,  4226268927.0,  3566389959.0},
-  {1392733994.0,  1385146392.0,  3200158079.0,  3817289090.0,  4057306129.0,  3273250234.0},
-  {3916516281.0,   613574737.0,  2443670180.0,  1151502533.0,  1988810425.0,   155453358.0},
-  {1982988420.0,  1080074901.0,   968723726.0,  2008812289.0,  3360633744.0,  1146831236.0},
-  {2316578745.0,  1799862296.0,  3613126107.0,  3567498513.0,  2712136397.0,  1733971179.0},
-  {  76663369.0,  3006626271.0,  3850093345.0,   460604696.0,  1855142155.0,   529261557.0},
-  {1996556284.0,  2072997810.0,  4186688907.0,  1351133266.0,  1814792319.0,  1177139001.0},
-  {2125379217.0,  2029708318.0,  2864225687.0,   650607046.0,   274878679.0,  3069906495.0},
-  {3351770935.0,  2497821508.0,  4153354304.0,   679697685.0,  3960356966.0,   806767248.0},
-  { 328275939.0,  4043309408.0,  2139479233.0,   913605882.0,  1693238811.0,  2683234253.0},
-  { 380077906.0,  1328178088.0,    11606151.0,  2800482042.0,  1843301390.0,  3925503590.0},
-  {2618561243.0,   226120259.0,  3457819092.0,  3615977369.0,  1202142717.0,  1705039221.0},
-  {4030097477.0,  3210652147.0,  1892930308.0,  1916375784.0,  3440899958.0,  2966392172.0},
-  {3620514038.0,  1550579228.0,  3041900106.0,   170383556.0,  2340063251.0,   907922599.0},
-  { 342331034.0,   721896856.0,    49489263.0,  1527262159.0,  1683589584.0,  4072820963.0},
-  {3634418905.0,  3115483114.0,  3717354509.0,  3748911941.0,  1796294008.0,   152541531.0},
-  {3750452105.0,  2581846506.0,  2072260273.0,    33869140.0,  1174907909.0,   597713778.0},
-  {1140624162.0,  2366089057.0,  1212969052.0,  3994457001.0,  2926284005.0,  2201992238.0},
-  {2710153095.0,  3308966806.0,  3862486221.0,   657572409.0,  2469838038.0,   964983877.0},
-  {1025288875.0,  3845649407.0,  2004678764.0,  1891851531.0,   455205008.0,  1082108689.0},
-  { 253887316.0,  2415871445.0,  2535095644.0,   443125686.0,  2138319878.0,   192138499.0},
-  {1019852901.0,  3567211075.0,  2218760129.0,  1686112565.0,  1215446710.0,  1372583128.0},
-  { 275635795.0,  2525796717.0,  3357334668.0,  1334571285.0,  1606242654.0,  2048010768.0},
-  {3738308504.0,   212746549.0,   853589850.0,  1232168251.0,   987865447.0,  2672697680.0},
-  {  18232095.0,   729561267.0,  1746889182.0,  1816525473.0,   536898351.0,  3990216981.0},
-  {2025808804.0,   575240417.0,  2941565985.0,   436656809.0,  1251600019.0,  3504284350.0},
-  { 221795598.0,  1430590601.0,    32668395.0,  2237734419.0,  3150860496.0,  2286918144.0},
-  { 173084365.0,  3003153596.0,  1764525642.0,  2804758294.0,  3445052269.0,  3258770616.0},
-  { 875506370.0,   361180796.0,  4024641362.0,  2902171621.0,  4203523326.0,  1763622838.0},
-  {2053041216.0,   330471618.0,  1446024502.0,  3411931835.0,  1068273930.0,  3524430250.0},
-  {2969651630.0,  3981945698.0,  1380182238.0,  3503548794.0,   451428015.0,  1371476558.0},
-  {3135341649.0,  3689534504.0,   724929318.0,  1925197828.0,  2954226488.0,     2659962.0},
-  { 828848754.0,  2424147921.0,     4157349.0,  2948836916.0,  3034493100.0,  1114276668.0},
-  {1397088472.0,   350692162.0,     3926047.0,  3257645132.0,  2302645930.0,  4224998125.0},
-  { 252555652.0,  1300165905.0,  1724886312.0,  3692826907.0,  1460437471.0,  3903941668.0},
-  {3899639446.0,   329291111.0,  2284041738.0,  2369173843.0,  2398407564.0,  3592128991.0},
-  {3911760323.0,    67404161.0,  2703385757.0,   405197951.0,   355745561.0,   934213039.0},
-  { 339406964.0,  3919218018.0,   452781237.0,  2217131507.0,  4047987121.0,   192337036.0},
-  {2141273417.0,  1182317733.0,   211129007.0,   617546987.0,  4243939530.0,  3631681660.0},
-  {  35415814.0,   668069683.0,  2731793510.0,  3117145487.0,  2167020187.0,  1037117336.0},
-  { 674861329.0,  4285936971.0,   338248962.0,  3885635135.0,   766323643.0,  2283389594.0},
-  { 138295915.0,  4100488513.0,  1539171013.0,  1191862364.0,  2969269347.0,   846654610.0},
-  {3414917819.0,  3125357083.0,   426896464.0,  1319326733.0,  3144437607.0,  2237643079.0},
-  {3916233621.0,  1316686135.0,  3567000364.0,  1376637793.0,  4064896238.0,  1487622375.0},
-  {3396501263.0,  2702246970.0,   517420869.0,  1982160101.0,  1911576239.0,  3040512731.0},
-  { 975916361.0,  3840375836.0,  1377635861.0,   327976008.0,  1519799713.0,  3796911237.0},
-  {2667885453.0,   952833842.0,  3973401078.0,  2321614175.0,  3927613410.0,  1882773529.0},
-  {1858388566.0,  3473161415.0,  3878435469.0,  1941871412.0,    81437505.0,   278073407.0},
-  {  44607612.0,  3585127385.0,  2286785599.0,  1886785267.0,   137087961.0,  1312413515.0},
-  {   2853552.0,  4226575141.0,  2979917656.0,  2317044457.0,  1156462950.0,  2088949409.0},
-  {2291169357.0,  1194583012.0,  2398179939.0,  2232603151.0,   838198405.0,   876041396.0},
-  {3730214556.0,  1206987976.0,  3907608341.0,  4206671908.0,  2844820458.0,  2787086158.0},
-  {3257973679.0,    75931331.0,  3480413505.0,  3292621230.0,  3390987037.0,  2046625271.0},
-  {3014960136.0,  3598182239.0,   157240612.0,  3828626184.0,  2480449890.0,   218383527.0},
-  {2767715168.0,  4222411133.0,  2398772484.0,  3228404615.0,  1700927124.0,  3750609595.0},
-  {3921044119.0,  1023739032.0,   235449781.0,  3827931787.0,  3687984289.0,  3265994925.0},
-  {2949785917.0,   736829015.0,  3971922352.0,   247039178.0,   781168969.0,  4272501799.0},
-  {  49619975.0,   542562335.0,  3440470607.0,   770770984.0,  1385616801.0,  1682159693.0},
-  {2438924802.0,  1356910355.0,  4205189097.0,   368016018.0,  3246845157.0,  2708413187.0},
-  {4082746617.0,  3489083555.0,  1048521898.0,   399496371.0,  2905414448.0,  1044426862.0},
-  {3686266046.0,  2655063472.0,  3794015862.0,  1616841653.0,  1522666056.0,   965303896.0},
-  {3041512368.0,   251088762.0,  1407818751.0,  4215298264.0,   236571642.0,  1775698649.0},
-  {3187573443.0,  3435426300.0,   138116255.0,  1436074100.0,   592366168.0,  2376300388.0},
-  { 937497413.0,   528067409.0,  3638590080.0,  1698640842.0,  3989536545.0,   273487526.0},
-  {4152974794.0,  1223526522.0,  3848565958.0,   941356982.0,   487383062.0,  3813812115.0},
-  {3620043186.0,   606418829.0,  3927649897.0,  2045107014.0,  2927934814.0,   575242136.0},
-  {2021610455.0,  2888107390.0,   700884438.0,  2914318811.0,  2927380424.0,  2340497050.0},
-  { 902187914.0,  1685143151.0,  1018470890.0,  3909016524.0,  3865650465.0,  1330771892.0},
-  {3587238159.0,   469485679.0,  3570895804.0,  2816339128.0,  1849808056.0,  1937454165.0},
-  {3953605274.0,  1079756443.0,  3654286954.0,  3932997106.0,  3509745013.0,  2826995467.0},
-  { 463172901.0,  1329750417.0,  1438196059.0,  1584025653.0,  3838438430.0,  3835974245.0},
-  { 742483575.0,  2159619872.0,  2022353159.0,  2034040494.0,   559391514.0,  1771770002.0},
-  {4071607449.0,   742024992.0,  3561031948.0,   206205801.0,  4222611337.0,  1650393411.0},
-  { 790754142.0,   881698008.0,  3729424078.0,  1726979975.0,   532715111.0,  3206323947.0},
-  { 912873123.0,  1565639663.0,  3752027491.0,  1039517658.0,  1961639064.0,  1883601778.0},
-  {1595966717.0,   340457380.0,  2798747289.0,  1674216059.0,   223238043.0,  2736647447.0},
-  {2567944628.0,  2661175267.0,  3615121012.0,  1147427951.0,   305360962.0,  3658335365.0},
-  {1731319553.0,  4074230034.0,  1600830035.0,  1155485058.0,  2955326229.0,  1957884631.0},
-  {  34751419.0,  1410920034.0,  1266942305.0,  3229881786.0,  2255268652.0,  4001829083.0},
-  {1717356663.0,  3976635052.0,  3079829246.0,   560502686.0,   378379866.0,  4026625586.0},
-  {3791740801.0,   135928162.0,   208157951.0,  3229228999.0,  2780634559.0,  2799364795.0},
-  { 560014396.0,   805640432.0,  3808468326.0,  2912139136.0,  2597870226.0,  2644698509.0},
-  { 154419489.0,  3631616243.0,   565787138.0,  1009688330.0,  2003544513.0,  3949029015.0},
-  {2459638342.0,  2412512917.0,  4123086753.0,  2449476848.0,  2951034268.0,   459205217.0},
-  {1666652192.0,  3305640495.0,  2350375059.0,  2177771930.0,   175308270.0,  2442627874.0},
-  {1631862755.0,  1385929004.0,  1701719093.0,  2313771159.0,  1582910630.0,   308437136.0},
-  { 309785861.0,  1676956909.0,   841870518.0,  2376716536.0,  1029027167.0,  2770599432.0},
-  {1600139901.0,  1688259906.0,  3442470989.0,   753443931.0,  2765425774.0,  4222432273.0},
-  {2864110312.0,  3412349106.0,  2332098414.0,   161812316.0,  3016815172.0,  1155563458.0},
-  {1475919033.0,   924914560.0,  1190795037.0,   880648498.0,  2714732168.0,  3575556783.0},
-  {1003310617.0,  2624651928.0,  1248296494.0,  2462169781.0,  1130938382.0,  4064038369.0},
-  {3923404447.0,   109193687.0,   506847966.0,  2666045981.0,   605447073.0,  2845543293.0},
-  {1684831353.0,   554147335.0,  1482590741.0,  1575774860.0,  3005600962.0,  1896112692.0},
-  {1233635589.0,  3113732664.0,  1291156930.0,  2492202062.0,   328275196.0,   448558622.0},
-  {1611392975.0,  3716363718.0,  3647206067.0,  2516205329.0,  1115125161.0,  1306154206.0},
-  {1674766264.0,  1725902475.0,  3122413824.0,  3924230673.0,  4106667633.0,   239889606.0},
-  { 922499099.0,   476631254.0,  1221800623.0,    46144663.0,  3043651908.0,   143483096.0},
-  {1012566938.0,  3154961143.0,  3862149103.0,  4135099068.0,  1509201486.0,  1564090132.0},
-  {3465586898.0,   948951685.0,  3672185918.0,  3325449927.0,   973873633.0,  1049023334.0},
-  {3257421309.0,  2877780256.0,   813467566.0,  3501858764.0,  1997576745.0,  3590229374.0},
-  {3202929731.0,    80945692.0,   934103812.0,  3549909826.0,   726380441.0,  4273373728.0},
-  {4164353471.0,  3987157340.0,  3174868759.0,  1611943000.0,  3177386263.0,  3629674761.0},
-  {4183816795.0,  2902019293.0,  2365716110.0,   225863782.0,  1072847558.0,   493198979.0},
-  {1108896285.0,  4161876278.0,  3700749919.0,   685927902.0,  4000928258.0,  2898961112.0},
-  {2217785531.0,  3358269745.0,  4087462560.0,  3473059221.0,  4072201498.0,   223221415.0},
-  {1823394872.0,  3408714485.0,  3561405145.0,  3537138294.0,  1895326527.0,  1764093956.0},
-  {2224859942.0,  3660717568.0,  1196779658.0,  2436066745.0,  2380203953.0,  3342255421.0},
-  {2650742718.0,   257641768.0,  2734590084.0,   108075738.0,  2268433146.0,  3681142132.0},
-  { 102576228.0,  1108797758.0,   249176619.0,  1534366276.0,   127742036.0,  2920315406.0},
-  {3157034688.0,  1720319517.0,  1134868518.0,  1362302192.0,  2684160176.0,  2493400373.0},
-  { 800856361.0,   227972987.0,  2639093017.0,  1308866544.0,  2646508225.0,  1878578816.0},
-  {3100388318.0,  4082349401.0,   840959324.0,  2140123682.0,   626481926.0,  3309761643.0},
-  { 156541266.0,  3646055642.0,  1161875321.0,   350931820.0,  3490675653.0,  3666546423.0},
-  { 940812704.0,  4035431889.0,    47634163.0,  4275504712.0,  3443164610.0,  2807205828.0},
-  {1575072231.0,  4251049666.0,    30738011.0,   418516832.0,  2477568739.0,  2113489502.0},
-  {2853684078.0,  1322424102.0,  3100800041.0,  2325020940.0,  3326612985.0,  2597816481.0},
-  { 150315423.0,  2573652172.0,  4204879551.0,  3583317422.0,   532282930.0,    54758504.0},
-  {2444191708.0,   950388981.0,  4160516285.0,  3296559506.0,   328581901.0,  2422061478.0},
-  { 602623686.0,  2459729349.0,   530355197.0,  2042166092.0,  2014948925.0,  1888087790.0},
-  { 173912029.0,   599877029.0,   503617183.0,  3953976703.0,  1007577791.0,   137034535.0},
-  { 363309198.0,  1780232716.0,  3104543303.0,   667164308.0,  2378827100.0,  3721305488.0},
-  { 355704322.0,  1852227058.0,   211484828.0,  3063551463.0,   732275239.0,  3096605917.0},
-  {4024621720.0,    13148195.0,   559189871.0,  3625972133.0,  2030679412.0,  3036822756.0},
-  { 676562518.0,  4108672120.0,  2473047524.0,  2869935522.0,  3119887762.0,  4024469143.0},
-  {1356245534.0,  3857201075.0,  2090778396.0,  3614911045.0,  3366842023.0,  1665304285.0},
-  {3795981823.0,  1843728358.0,    50147585.0,   439131218.0,  3075726984.0,  2331959339.0},
-  {1825760219.0,  1661109469.0,  3816202640.0,  3886622211.0,  2645671458.0,  1084141374.0},
-  {2104572893.0,     2108065.0,  3213556248.0,  1181023784.0,  3109059677.0,  1166014137.0},
-  {2768315224.0,  3030192676.0,   534594904.0,  2144305967.0,  1003648204.0,   805075833.0},
-  { 119945766.0,   906615824.0,  1371794667.0,   632776562.0,  3519468133.0,  3875004474.0},
-  { 400665610.0,  1338113099.0,  3841628278.0,   684804488.0,  2295120188.0,  2168165476.0},
-  {1002871376.0,  3621425570.0,   990654593.0,  4240495814.0,  1415249048.0,  1410978155.0},
-  {3222595828.0,  2825045243.0,  2839371305.0,  2102078890.0,  2449367310.0,  3858204372.0},
-  { 658705093.0,   906520540.0,  3953213772.0,  4203764777.0,  3194789004.0,  2064553893.0},
-  {2731707083.0,  3717776587.0,    23291848.0,  3089108901.0,  4058490881.0,  3909486350.0},
-  {2209794736.0,   467413584.0,  2494188640.0,   827968109.0,  1792755572.0,    53017533.0},
-  {1503922735.0,  4002893522.0,  2736680139.0,  4158140889.0,  1467482043.0,  4072006136.0},
-  {2392431891.0,   601953659.0,  3219154291.0,  3234858607.0,   790085427.0,   881336232.0},
-  {1443030683.0,  2114279284.0,  3006488008.0,  3113049819.0,  3954289894.0,  2564578536.0},
-  {1891688773.0,  3541837675.0,   868284835.0,  3727515342.0,  2338525064.0,  1382987991.0},
-  {3645206542.0,  2850049707.0,  2162839056.0,  3477142351.0,  3231919287.0,   405324806.0},
-  {3865070607.0,  1373576366.0,  3721834833.0,  1098065121.0,  1020009566.0,  3751271029.0},
-  {1831925035.0,  1151098489.0,  1181355311.0,  2304497855.0,  3996726109.0,  1578923925.0},
-  {3202821966.0,  3536901373.0,  1939729315.0,  3324876703.0,  2644202320.0,  3693427589.0},
-  {2864803986.0,  1449697071.0,   142357883.0,   184549756.0,  4191840590.0,  1495747550.0},
-  {2045388189.0,  3813386015.0,  2520796217.0,   489633824.0,   283362474.0,  4194353512.0},
-  { 648785024.0,   522913844.0,   218500359.0,  1118892781.0,  2819272478.0,  2675064011.0},
-  {2606218301.0,   714964995.0,   780873730.0,  1321127762.0,  3410220371.0,   649654997.0},
-  {1085818775.0,  2289046968.0,   247021102.0,   121902909.0,  3671082761.0,   125220851.0},
-  {3158488526.0,  3332646984.0,  3123854412.0,  1522613692.0,   411521428.0,   890828270.0},
-  {1364319580.0,  4158242633.0,  4020086157.0,   586051057.0,   267499049.0,   265264851.0},
-  { 776559096.0,   487417945.0,  2202852468.0,  3965731804.0,  3655571583.0,  2560757716.0},
-  {2816625301.0,   328738270.0,  3539345648.0,   492804286.0,  1395294106.0,  2736335470.0},
-  {2347030228.0,  3592929293.0,  3851375440.0,   648354798.0,   263217503.0,  2094945735.0},
-  { 454402678.0,  3022482640.0,   169177069.0,  4014922399.0,  1606563699.0,   348034103.0},
-  {1631983834.0,   110594450.0,  3165399533.0,  2899716659.0,  1361226788.0,  3713828591.0},
-  {3753064148.0,   969704937.0,  4235496753.0,  3315245987.0,  1769567896.0,  1939890175.0},
-  {3297876753.0,  2691571272.0,  1149989297.0,  1151778625.0,  2824277537.0,   566466247.0},
-  {1580578023.0,   359456496.0,  3947795462.0,  2697837182.0,  4202709077.0,   398641125.0},
-  {3514976051.0,  3686609235.0,  4208386679.0,  2247401617.0,  2404432024.0,  1484441808.0},
-  { 826332205.0,  2484170681.0,  4008106981.0,  3550851736.0,  1869181983.0,   466639668.0},
-  {2959249833.0,  1771825634.0,  1992815844.0,  1269335639.0,  1541667548.0,  2690256720.0},
-  {3835627970.0,  2464431299.0,  3671133951.0,  2535128315.0,  3027871134.0,  3840851596.0},
-  {2268166279.0,  4196349333.0,  3321662490.0,  2412317124.0,  3282771855.0,  1187053338.0},
-  { 851576463.0,   727197958.0,  3295014790.0,  3101413878.0,  3840690368.0,  4213730423.0},
-  {2607267773.0,  2768039874.0,  2841565523.0,  2631539519.0,  3770130282.0,  2187405747.0},
-  {3948048986.0,   299195410.0,   150448660.0,  3447416400.0,  1700896422.0,   522354199.0},
-  {2338153357.0,  3875050103.0,  3970082531.0,  1992112530.0,  2552880842.0,  3655493552.0},
-  {1364171534.0,  3740469841.0,  4036142692.0,   960577659.0,   332446673.0,  2462424049.0},
-  {  39826459.0,   414961065.0,   881211723.0,  1671262655.0,  1444286980.0,  2823657914.0},
-  {2689807133.0,  3763504446.0,  2884563578.0,  2371569627.0,  4239518145.0,  2669477411.0},
-  {1088911116.0,  1748464538.0,  2406087507.0,   404736873.0,  1412766446.0,  1271114228.0},
-  {2715252723.0,   614671152.0,  2256405951.0,  1642580042.0,  1280235855.0,  2013237271.0},
-  {4291244582.0,  2065513548.0,   357414554.0,    72314537.0,  1521797880.0,  4229590039.0},
-  { 289822629.0,  1858524550.0,  2551362642.0,  3929910986.0,   591021101.0,   725096589.0},
-  {2228602338.0,  1501601277.0,  1801209803.0,   817139561.0,   542617767.0,  3869120651.0},
-  {2106520587.0,  3579649456.0,  4043194553.0,  3065776160.0,  3770637800.0,  3115860146.0},
-  {3555375906.0,  3954514282.0,  1339740583.0,  2373635792.0,  1857829930.0,  3447892220.0},
-  {2744594126.0,  1702680151.0,  2436317263.0,  1710048248.0,  4212638639.0,  3646375545.0},
-  {2933450767.0,   837640736.0,  1648414937.0,   120349420.0,   206152106.0,   917165111.0},
-  {  63757594.0,  1690304431.0,  1778277108.0,   737329402.0,   811404566.0,   123133641.0},
-  {2912111644.0,  2064781979.0,  1150964767.0,    53517640.0,    97082602.0,   116299056.0},
-  {1778581732.0,   462259411.0,   174134249.0,  2370619530.0,  1859331115.0,  4164825910.0},
-  {1912362400.0,  3452761476.0,   148812929.0,  3691748398.0,  3911329993.0,  1849488786.0},
-  { 319464087.0,  3710247034.0,   313013126.0,   980265177.0,  2143077963.0,  2461002573.0},
-  {  34292898.0,  4283818282.0,  3376845258.0,  2683707083.0,  1497099913.0,   259962360.0},
-  {2332095109.0,  1005222066.0,  1688457612.0,  1856881962.0,  2236598571.0,  3237039144.0},
-  {2222172560.0,  3228543969.0,  1268308398.0,  3395870593.0,  2774968045.0,  1635052606.0},
-  {1769983676.0,  4203921251.0,  3519617065.0,  3514484203.0,  3303970926.0,  2194339053.0},
-  {4239517354.0,  1420835137.0,   934271248.0,  3632787570.0,  2144302951.0,  3804447685.0},
-  {2451516805.0,  1618179860.0,   656171869.0,  2358116882.0,  3353853540.0,   354117276.0},
-  { 993008244.0,   765358621.0,   155558680.0,  4014354249.0,  1399407927.0,   151418145.0},
-  {2725452646.0,  1776717471.0,  1795452113.0,  1706910207.0,  2614450010.0,  3305797713.0},
-  { 943451675.0,  4246330081.0,  2276019641.0,   838597681.0,  2934203491.0,  1096256515.0},
-  {2521366059.0,  2371663181.0,  3465002786.0,   711520860.0,  1861424419.0,  3986983720.0},
-  {3025454667.0,  1184264695.0,    29014050.0,  2499103476.0,  4251693706.0,  2556463452.0},
-  {3217691560.0,  1829677343.0,  3278310375.0,  2882981683.0,   203608937.0,  1191793123.0},
-  {1520800539.0,  3340481092.0,  1872122270.0,  2344433675.0,  3670699789.0,  2216594149.0},
-  {1545112286.0,   289038939.0,  1646477248.0,  3657337188.0,  3465800396.0,  2588112718.0},
-  {4064847440.0,  4155020667.0,  2001696075.0,  3650971042.0,  3912918350.0,  3208693956.0},
-  { 508320857.0,   677582025.0,  3596469456.0,  1538367844.0,  1995142089.0,   959688004.0},
-  {2561715649.0,  3365184180.0,   487351422.0,  1419620498.0,  2032615574.0,  2031977821.0},
-  {1905776295.0,  1617474385.0,  1926736407.0,    74874969.0,  2035355454.0,   236488159.0},
-  { 354917405.0,  1152662373.0,  1152533931.0,  1815514872.0,    80272301.0,  2195236034.0},
-  {2583921894.0,   361110061.0,  3464231955.0,  3709719223.0,  2431913133.0,  1383166387.0},
-  {2693631266.0,  3988989242.0,  3968629507.0,  2888788399.0,  1004503024.0,  1837965072.0},
-  {3802817798.0,  1357598444.0,   541685878.0,  2632379561.0,  1584292575.0,  1491407628.0},
-  {1307084709.0,   416794033.0,   435147316.0,  2946547720.0,  3114659023.0,  3745101393.0},
-  {2262686655.0,   175907340.0,  3285607005.0,  3419667304.0,  2537905120.0,  2812162725.0},
-  {3642460692.0,   701512209.0,   300867952.0,  3024764748.0,  3810995972.0,    13847386.0},
-  {1001548108.0,  3595659101.0,  3682901316.0,   289325870.0,  3949930016.0,  2145519510.0},
-  {3215515819.0,  1275438121.0,  2178243016.0,  4056061631.0,   418067955.0,  4097452959.0},
-  { 240401725.0,  2514906495.0,  3201704390.0,  2355785155.0,  3078124355.0,  4102328367.0},
-  {3997915401.0,   285803244.0,  1983403260.0,  1915737158.0,  3527133025.0,  1459110174.0},
-  {1731353722.0,   504914355.0,  2349740919.0,   403022242.0,   830126596.0,   195798736.0},
-  {2494022354.0,  3784854990.0,   684325304.0,  4025684304.0,  1807437897.0,  2572046511.0},
-  {3979574302.0,  3252542398.0,   210104448.0,  2493387335.0,  1245875093.0,  1729639647.0},
-  {2578695481.0,   736373115.0,  3963448018.0,  2872945311.0,  3992112403.0,   232448876.0},
-  {4223169841.0,  3266229289.0,  3560130740.0,  1698220792.0,  3283152189.0,  1178309353.0},
-  {1312445669.0,  1549488905.0,  3295948038.0,   225833371.0,  4048567234.0,  4027414572.0},
-  {2730964715.0,  3605548430.0,  3076413851.0,   772128617.0,  1560683930.0,  3707889525.0},
-  { 588426703.0,  2144736236.0,  2297959986.0,  3792914710.0,  1108801220.0,  1426552990.0},
-  { 501966118.0,  2161161577.0,  2079467565.0,   942280015.0,  3976884119.0,   988100528.0},
-  {1910376305.0,  2377299592.0,  3177280725.0,  2028222569.0,   513775431.0,  1573509331.0},
-  {3060163832.0,  3858855669.0,  3061214393.0,  2852934365.0,   204616637.0,  1189047902.0},
-  {1443536928.0,  3103476049.0,   427461144.0,  1972105252.0,  1294476727.0,  1902297583.0},
-  {1456240830.0,  1569906230.0,  2029174798.0,  3368865920.0,   677888934.0,  1402871633.0},
-  {3198835222.0,  2756153809.0,  2834958291.0,  1445101600.0,   605392192.0,  2918228929.0},
-  {4057192295.0,  4283201940.0,  1839193471.0,  3720768801.0,   373153330.0,  4155348446.0},
-  {2992476201.0,  1326287101.0,  1730879103.0,  3412038809.0,   816993540.0,  1328916141.0},
-  {3441223166.0,  1047952770.0,  1794105559.0,   908598410.0,  1228303377.0,  1549151261.0},
-  { 621507453.0,   293892679.0,  2725301469.0,  2209044092.0,  2159809464.0,  3617473289.0},
-  {3699758134.0,   245885702.0,    71566948.0,   172288583.0,  1206632557.0,  3881898334.0},
-  {1365887231.0,  4031985682.0,  4114670942.0,  1502182675.0,  2909871918.0,  2389911473.0},
-  {1264856785.0,  1955598158.0,  3021293075.0,   735493906.0,  1050862889.0,  2666056512.0},
-  {1948994686.0,   223672407.0,    50845899.0,  1548069551.0,  2822347580.0,  3914820921.0},
-  { 713873097.0,  2321890666.0,  4223442268.0,  2363245535.0,  1492254324.0,  3648682778.0},
-  {1866294110.0,   471386005.0,  1249992293.0,  1079995645.0,   230776822.0,  2646341065.0},
-  { 345729930.0,  2185499155.0,   807534163.0,  1245145330.0,  4156369303.0,   213715490.0},
-  {2803508401.0,  1840349668.0,  1618601425.0,   355090244.0,  1037601561.0,  3430913072.0},
-  {2332279297.0,  3383311239.0,  4160100927.0,  3589090811.0,  2505303737.0,  3128099896.0},
-  {1557668792.0,  1299013139.0,  4142579834.0,   195976112.0,   954148768.0,   263520176.0},
-  {2210750899.0,  2457673191.0,  1780640599.0,  1106153212.0,  3705632681.0,  3832235749.0},
-  {2353030640.0,  2732051708.0,  1916626474.0,   505286451.0,  4072602734.0,  4213115803.0},
-  {2065184564.0,  2967588282.0,   883875415.0,  3928950178.0,  3324430730.0,  2096092653.0},
-  { 952021746.0,  1924140371.0,  1844376506.0,  1620178129.0,  2767368496.0,  1773485648.0},
-  { 433744944.0,  3483996637.0,  2668603084.0,  2647820617.0,  3855154668.0,  1965279851.0},
-  {2271043754.0,  2269278823.0,  3667321032.0,  1580316805.0,  3979700263.0,  2823762679.0},
-  { 908221332.0,    94221711.0,  1837232383.0,  1871247749.0,  3096344157.0,   608636440.0},
-  {3420976243.0,  2975003773.0,   989749631.0,  1418734380.0,  2467788586.0,  1527897877.0},
-  {2209825771.0,  1572547655.0,  3177821525.0,  3173061514.0,  1750252786.0,   259479732.0},
-  {1519663227.0,   844062440.0,  1932521758.0,  4081801030.0,  2192465142.0,  3454555422.0},
-  {2694465714.0,  2282340178.0,  3384785499.0,  4131682648.0,  2986367122.0,   959108623.0},
-  {1706485017.0,  1463759666.0,  2023173206.0,  3086422903.0,  1717235935.0,  2597652372.0},
-  {1801443079.0,  2767666193.0,  1927505618.0,  1815687312.0,   124574150.0,  3376693375.0},
-  {3709030405.0,  1063727650.0,  3047330418.0,  3068425322.0,  3182322520.0,  1170261704.0},
-  { 430395700.0,   254985651.0,  2430924356.0,  2227912781.0,  3272615716.0,  4187458502.0},
-  {3720334436.0,  3900070063.0,  3848839912.0,  1237104608.0,    43892613.0,  1862188032.0},
-  {2015453068.0,  2726833859.0,  2875850689.0,  2926025058.0,  2193868293.0,  3504997579.0},
-  { 877276936.0,  3911760132.0,  2203990810.0,  2073672178.0,  2498746520.0,  1625844912.0},
-  { 654423869.0,   385723629.0,  1245907718.0,  2543175993.0,  3746085323.0,  1956549686.0},
-  {1413813593.0,  1889054794.0,  1301654450.0,  3966940706.0,  3137707050.0,   805329920.0},
-  { 476123721.0,   299852541.0,  2046333302.0,  2193711135.0,   774714401.0,  3850024079.0},
-  {4165465629.0,  2233594952.0,  1448602077.0,  1584480705.0,  1287041465.0,  2312303889.0},
-  {3974350925.0,  2887000758.0,  3999458042.0,  3651583684.0,  2964828175.0,  3696975968.0},
-  {4280556419.0,  1714571933.0,  1547318652.0,  3187593448.0,  3085735118.0,   911626232.0},
-  {1847377166.0,  3369966758.0,  1226951495.0,  3036799115.0,  2401779360.0,  1848419943.0},
-  { 824180055.0,   537616506.0,   271289891.0,  2361011023.0,  3398914203.0,  4009061411.0},
-  {2591442942.0,  1234448579.0,    65210257.0,  1806818537.0,  2677778111.0,   233252425.0},
-  {3409045643.0,  1439907708.0,  3526188399.0,  3551571626.0,   348049030.0,    25863675.0},
-  {1573087403.0,  2558892838.0,    15127901.0,   951512833.0,  3649284037.0,  3736112880.0},
-  {3051914898.0,  1822739196.0,  1400752760.0,  2900477268.0,  2273427708.0,  1781678971.0},
-  {3417722202.0,  3459517806.0,  2505527827.0,  3071791529.0,  2402133244.0,  1604585827.0},
-  {  32296399.0,  1892853474.0,  2922113544.0,  3615662454.0,  1488512849.0,  3335971581.0},
-  {2323392532.0,  2795996478.0,  3300779040.0,  3259814265.0,  3409623806.0,  3508963631.0},
-  {1940941710.0,  3205266807.0,  1502126309.0,  1082456047.0,   646917022.0,  1153175460.0},
-  {2914577173.0,  3441152539.0,  2320429862.0,   991204559.0,  3996584637.0,   952896485.0},
-  {2012176824.0,  1282761839.0,  3696977818.0,   568119345.0,  3198475318.0,  2977776621.0},
-  {1928772469.0,  2612636952.0,  3833828880.0,   422523009.0,  2830339487.0,  2843290517.0},
-  { 805203823.0,  3785349100.0,  1020713694.0,   522806840.0,  3589087826.0,    19217012.0},
-  {2921510456.0,  1434628919.0,   110645032.0,  4068894099.0,  2363728633.0,  3630658000.0},
-  {1974603863.0,  3509517332.0,  1575563848.0,  3965778514.0,  3208218884.0,  1870868735.0},
-  {2402565160.0,  3806828250.0,    53659458.0,  2711704346.0,  1224060326.0,   704192032.0},
-  {1431694897.0,  1408954604.0,  2398440125.0,   404993822.0,  1786364897.0,  2933251387.0},
-  {3539411898.0,   373156069.0,  2692010163.0,  2539116196.0,  3731674206.0,   449329687.0},
-  {2457994557.0,   260952524.0,  3715915213.0,   562612372.0,  3191710085.0,  1113406759.0},
-  {1420873065.0,  1591628970.0,  3994053581.0,  1677024211.0,  2420432858.0,   763107698.0},
-  { 528136397.0,   863033195.0,  2872752762.0,   943465151.0,   852187401.0,  1735085040.0},
-  {2554395654.0,  1214476980.0,  1585446318.0,  4042709793.0,  2055017702.0,  2114361048.0},
-  {2601165663.0,  2458391399.0,  1487718863.0,  1934565920.0,  3007438529.0,  2630647615.0},
-  { 725517790.0,  2033929568.0,   546143624.0,  2995612280.0,  2887634906.0,  3795937648.0},
-  {3587220502.0,  2061544406.0,  4271280956.0,  3647127476.0,  3949546543.0,   632564166.0},
-  {3258676056.0,  3261115994.0,  3695963563.0,  2918618842.0,   916969239.0,   956766011.0},
-  {2047534552.0,  3523191761.0,   699151303.0,  1079054508.0,  3490560415.0,  3371522923.0},
-  {3652519654.0,  2304564328.0,     1902289.0,  3540499625.0,  2185861735.0,    21477689.0},
-  { 421455899.0,  1492975887.0,  3850646584.0,  4158090976.0,  1043049322.0,  1084212133.0},
-  {2140090363.0,  2200266359.0,  3825499575.0,  3657733728.0,  2249191217.0,  4015293854.0},
-  { 963225561.0,   855930982.0,  1215710294.0,   857525843.0,  2159401098.0,    21562461.0},
-  {3930532036.0,  3639624189.0,  1786777340.0,  1658927304.0,  1118499359.0,  2208336372.0},
-  {1988943511.0,  1122783934.0,  4172615944.0,  2996530755.0,  2540627445.0,   375892957.0},
-  {2854766288.0,  2377718730.0,  2540410596.0,  1588817111.0,   125197325.0,  1086374928.0},
-  {2784792996.0,  2094120696.0,   434499210.0,  1061134874.0,  3155368228.0,  3643857729.0},
-  { 514644319.0,  3182387605.0,  2180844467.0,  3716272299.0,  2429340156.0,  3104807852.0},
-  {3231595152.0,  2663096106.0,  3142338280.0,  2249704926.0,   435413672.0,     4231173.0},
-  { 392842219.0,  3696433172.0,  3787909603.0,  3569391801.0,  4125819586.0,   788294685.0},
-  { 801572172.0,  1990702051.0,  1800493297.0,  4259635763.0,  1745273559.0,  3420527356.0},
-  {2438882355.0,    23626643.0,  4049103849.0,  3241384680.0,  3770137368.0,  3307668090.0},
-  {3773544309.0,   628054196.0,  3478652853.0,   952980415.0,  1880726249.0,  1590749846.0},
-  {3134621915.0,   846275037.0,   860092510.0,  3793045180.0,   368601594.0,  1008278758.0},
-  {1031903829.0,  4190693725.0,  3402261813.0,  1648807391.0,  3879278722.0,  3972525024.0},
-  {  64460803.0,  2872885172.0,   690766826.0,   624628461.0,   423936130.0,  1227139227.0},
-  { 110417666.0,  3638473855.0,   388168519.0,  3501907411.0,  3620259332.0,  2053042622.0},
-  { 341809244.0,    27062362.0,    83220725.0,  2673063224.0,  3139983449.0,  1651108474.0},
-  {1060816867.0,  2554714462.0,   347285697.0,  2438586890.0,  1278047345.0,  2841934312.0},
-  {2457284592.0,  2424247615.0,  1863718334.0,  2816440192.0,  2828228555.0,  2358120950.0},
-  {1600630138.0,  3447062548.0,   508473032.0,   103769053.0,  3252415671.0,  4016820095.0},
-  { 565359697.0,  1300989564.0,  4135935591.0,  2367393593.0,  2404625573.0,  2691664588.0},
-  {  35128370.0,   717050800.0,  1506118811.0,  1516433468.0,  1137794841.0,   114849944.0},
-  {2411831049.0,  3882264362.0,  2039694042.0,  1660483215.0,  2173256851.0,   163012303.0},
-  {4062155878.0,  2572047234.0,  4055350520.0,  2046482049.0,  3709258872.0,  2240517556.0},
-  {1558585674.0,  1510631275.0,  3571579038.0,  3087300690.0,   610693660.0,  3656813310.0},
-  {2391344883.0,  1583857051.0,  2032716713.0,  1839150830.0,  2839991548.0,  3308103414.0},
-  { 157871016.0,   992879486.0,  2304473497.0,  2770732119.0,  4100819998.0,  2293860831.0},
-  { 170076062.0,  2276333564.0,  2550585433.0,  2809427246.0,  3540550703.0,  3990775671.0},
-  {3729493426.0,  3436189421.0,  3966757194.0,  3536386678.0,  4261210185.0,   443061615.0},
-  { 723732405.0,  1273332736.0,  1798292935.0,  2311841132.0,  3173996693.0,  1503950745.0},
-  {3744494445.0,  2532384211.0,  2579965073.0,  3660831416.0,  1552986971.0,  1586499013.0},
-  {3951246237.0,  2999264871.0,   375621756.0,  1981963738.0,  2868171975.0,  2750870214.0},
-  {3471359644.0,  1226378048.0,    77962622.0,  2399166590.0,  1184301495.0,  1014767066.0},
-  {1182704457.0,  1444356774.0,  2008569429.0,  3992138949.0,  2692434484.0,  3579762201.0},
-  {2972787021.0,  3747252346.0,  2901420499.0,  1972096160.0,  3861194916.0,   473302471.0},
-  {2348829265.0,  3400879148.0,  1449511377.0,  3882775042.0,  1236257266.0,  1425910415.0},
-  {3448125582.0,   380073388.0,  1976149744.0,  3990315901.0,  4153405061.0,  3189274879.0},
-  {  16402553.0,  3683897759.0,  3628336277.0,  3129652400.0,  2104451579.0,  1306774521.0},
-  {3776272271.0,  2024097748.0,  3756854082.0,  1119187757.0,  1495326400.0,  3009948353.0},
-  {3439580044.0,  3742948329.0,   515958172.0,  2808089225.0,  3827512042.0,  1525933418.0},
-  {1812745673.0,    24675705.0,  2112742264.0,  1672302983.0,  2479219531.0,   580652740.0},
-  {1333648729.0,  1520723536.0,  3124417899.0,   824815035.0,  3078326789.0,  3997192658.0},
-  { 238015980.0,  2214983251.0,  1463282285.0,  2194372735.0,   354710996.0,  1612745468.0},
-  {2190709979.0,  2713699555.0,  2829549349.0,  4049050111.0,  2761709193.0,  1742126939.0},
-  {1081452458.0,  3970228325.0,  3923908540.0,  4229864351.0,  1620241734.0,  4174495388.0},
-  { 958877313.0,  2716273292.0,  1490821972.0,  1512855828.0,  3117580864.0,  2877650421.0},
-  { 575447304.0,  2041728616.0,   870636716.0,  1606969901.0,  1687776097.0,  3855986532.0},
-  {3522456336.0,   340542851.0,  2995446397.0,  2892021011.0,  1786448484.0,  3192659897.0},
-  {1934887330.0,   234822802.0,   768026358.0,  3303075481.0,   612152138.0,   594028925.0},
-  {1235952726.0,  1187393632.0,  1140085867.0,  3626297353.0,   776675081.0,  1260419602.0},
-  {1315957875.0,  1703245371.0,  2559308629.0,  4262554615.0,  3661634319.0,   230344940.0},
-  {2885438066.0,  2421273343.0,   353132691.0,  3414144457.0,   653368038.0,  2950251837.0},
-  {4270006028.0,  2470295833.0,  2797956278.0,   579460535.0,  1935709849.0,  1029275961.0},
-  {3985169549.0,  2910247237.0,  3874427024.0,   568934189.0,   177803957.0,  2869105259.0},
-  {1644728832.0,  2700809923.0,  2580691174.0,  2397979267.0,  1571011718.0,  1837133370.0},
-  {4091537025.0,  4068960979.0,  3645659251.0,   513803584.0,    14595350.0,  1454854977.0},
-  {1746080821.0,  4177329455.0,  1440378394.0,   367907191.0,   439963765.0,  2184424777.0},
-  {2900606338.0,  4181897348.0,  1912116287.0,  4059096295.0,   676908354.0,  3471533733.0},
-  {1139897312.0,  2857301605.0,  1024883752.0,  2643117400.0,  2367013749.0,  3765944272.0},
-  {3054909116.0,  2582346311.0,   726577299.0,  2638639620.0,  1597460054.0,  1511559926.0},
-  { 225839882.0,   577520503.0,  1087209177.0,  3030939581.0,  3967460193.0,  4163655838.0},
-  {3602621974.0,  2409918558.0,   679285988.0,  3515858510.0,  3845206939.0,   351691450.0},
-  { 956808671.0,   307612197.0,    33068525.0,  2021094536.0,  1616736149.0,  2102061722.0},
-  {3965523847.0,  1970971935.0,  3344050373.0,  1957193737.0,   301113974.0,  2081587122.0},
-  {4068742734.0,  4076424137.0,  1946679892.0,  4052072953.0,   103765243.0,  2606323083.0},
-  { 746769758.0,   453461761.0,  3150433109.0,  1616066665.0,  4135358697.0,  3959511446.0},
-  {2043696496.0,  2363333881.0,  2467076231.0,  2669485741.0,   381946711.0,  3974204177.0},
-  {1037108865.0,   256098363.0,   353250981.0,  1096677599.0,   182408492.0,  2070882081.0},
-  {1850156388.0,  3349600304.0,  2736046995.0,  2180674962.0,  3176354496.0,   718683919.0},
-  {2692184149.0,  2730751185.0,   612575739.0,  1719701369.0,  1242122814.0,  4236665779.0},
-  { 194564680.0,  1408434052.0,  4191122883.0,  4279236229.0,   562143083.0,  3379555341.0},
-  {2622805439.0,  2818175705.0,   359655921.0,  1480645428.0,  2119933094.0,  2584230451.0},
-  { 991639386.0,  1732519456.0,  2029496966.0,  3240670964.0,   458303266.0,  4250732173.0},
-  {1885879012.0,   112403534.0,  1033735558.0,  1600380020.0,  3475855094.0,  1522300383.0},
-  { 919039871.0,   597966959.0,  2599019921.0,   731453973.0,  2633695456.0,  1860154390.0},
-  {2272800057.0,   833176498.0,   789393148.0,  1718895610.0,  1790998474.0,  1786272026.0},
-  {2545079144.0,  1852706581.0,  3901379122.0,  2257802722.0,  1553962884.0,  2217702260.0},
-  {3360743843.0,  2556601526.0,  3120995767.0,  2562248095.0,  3486119023.0,   741909412.0},
-  {2196205999.0,  2687485982.0,  3643291472.0,  3559759171.0,   820955755.0,  3101341175.0},
-  { 480652817.0,  1220917669.0,  2187437637.0,  1053929260.0,   476469463.0,  1555680671.0},
-  {2303283506.0,  2440609811.0,  1007924550.0,  4158236147.0,  3885646554.0,  2030204528.0},
-  { 852564840.0,  4213094959.0,  2023341462.0,   127425042.0,  1710319427.0,  2902265723.0},
-  {3833208559.0,   838844904.0,   843605579.0,   148977745.0,  3141206570.0,  2601517273.0},
-  {3920955154.0,  3193681240.0,  2571818932.0,   610897751.0,   244024861.0,  2495925589.0},
-  {1252765503.0,  3534313821.0,   812763473.0,  1838211176.0,    77040422.0,  2905958498.0},
-  { 297168119.0,   687107789.0,  3247707908.0,  1347790682.0,  1508681630.0,    50382907.0},
-  {3035683389.0,  2681242220.0,  4128604192.0,  3420399696.0,  1832136012.0,   689099030.0},
-  {3294757638.0,  1048234280.0,  1030662054.0,  3000385976.0,    28728622.0,  1370766826.0},
-  {1903218766.0,  1557405363.0,  4286397395.0,  1786591548.0,  1809409443.0,  2373206953.0},
-  {3406294609.0,  3995115560.0,  1335412182.0,  1727483282.0,   794446489.0,  1685553908.0},
-  {2037673124.0,  2867607918.0,   823637526.0,  3660376916.0,  1372863164.0,  2218279269.0},
-  {1655365274.0,  3441446479.0,   654629236.0,  4044353702.0,  2039141339.0,  3715948261.0},
-  {3378011394.0,  3085621833.0,  2720053495.0,  2189774684.0,  1670062388.0,  1659654870.0},
-  { 119960476.0,    98504844.0,   357225507.0,  3908665050.0,  3485455303.0,  3110142621.0},
-  {2094260076.0,   741120690.0,  1884431739.0,  1736030884.0,   159128004.0,   644473301.0},
-  {3768460970.0,  2665056116.0,  1681089599.0,  2169742064.0,  1683519768.0,  3812736678.0},
-  {2776001061.0,   332385395.0,  4071135937.0,  2482308918.0,  3489998951.0,  2932973700.0},
-  {2850183804.0,  1637636149.0,  3979155584.0,  1216216510.0,  1625858829.0,  4210764189.0},
-  {1015124227.0,   618065460.0,   403797600.0,  2988494993.0,  4048851102.0,  1759355481.0},
-  { 387474096.0,  2255697144.0,  1696347623.0,  2688845034.0,  3913215514.0,  2338867552.0},
-  {4142135398.0,  3938985172.0,  1083704239.0,  4263185792.0,   231915478.0,   251250595.0},
-  { 547403402.0,  1806745813.0,  3986894418.0,   839576063.0,  2233552566.0,  3966199414.0},
-  {3286846495.0,  1710933453.0,  1664652852.0,  1475139811.0,  2331365501.0,  3193972524.0},
-  {1922860603.0,  2554218530.0,   296624841.0,  1797449342.0,  1320269274.0,  2679089629.0},
-  { 396708458.0,  2275749922.0,  2164686999.0,   995931184.0,    69047387.0,  4042631509.0},
-  {2762518717.0,   752497033.0,    87150137.0,  3419708261.0,  4224523903.0,  4257041589.0},
-  {2964370861.0,   699717565.0,  3942389898.0,   470646027.0,   882630079.0,  2192901909.0},
-  {1216496603.0,  3184224870.0,  2425105598.0,  2467813396.0,  3020901022.0,  1205651332.0},
-  { 111167226.0,  1518628702.0,  3084199531.0,  1308122372.0,  1359075271.0,  1845991574.0},
-  {2021278526.0,  1671830034.0,  4145204117.0,  3696748870.0,  3415898824.0,  2411590709.0},
-  {3837392823.0,  3606899421.0,  3218271941.0,  1643189244.0,  3367381502.0,  3867249405.0},
-  {1771082314.0,  4008204927.0,  2708273633.0,   417864286.0,  1157202171.0,  4259905014.0},
-  { 107293254.0,  2504995248.0,   133577306.0,  3697463455.0,   160736774.0,   555625392.0},
-  {1627152725.0,  1302086013.0,  1238130550.0,  3520208117.0,  4093685401.0,  1936303913.0},
-  {2960037621.0,  3817271852.0,  3498815920.0,  2731208621.0,  4038932090.0,  3479666508.0},
-  {1518701976.0,  1011321010.0,   254546552.0,   931677258.0,   989908232.0,   722110276.0},
-  {2042416595.0,   348550270.0,  4277731684.0,  2597485208.0,  2337336054.0,  4203635555.0},
-  {3381181560.0,  3683673498.0,   361115490.0,  3119326852.0,  2078480518.0,  2785446466.0},
-  {1131096525.0,  2447664930.0,  1778932823.0,  2594532001.0,  3181159082.0,  3517064492.0},
-  {1738920532.0,  3746695402.0,  1958309091.0,  4077227579.0,  4172236659.0,  2911300789.0},
-  {2235970092.0,   462861616.0,   666194102.0,   504180258.0,  1691827325.0,  3767344431.0},
-  { 343901171.0,  1612748632.0,  2000293467.0,   863330277.0,  3944878675.0,  3903000915.0},
-  {2678972842.0,  2058296705.0,  2950958807.0,  3044146460.0,   651089143.0,  2178352703.0},
-  {2276568975.0,  1271770507.0,  2169102419.0,  2390853912.0,  3278227165.0,   211290327.0},
-  {  62498159.0,   349657955.0,  2026368839.0,  3621153623.0,   658949577.0,   815356468.0},
-  { 688767653.0,  2206840403.0,  2975912276.0,  4157808236.0,  2034622054.0,   696474470.0},
-  {  68371579.0,  1538647905.0,  1575616890.0,  3660856173.0,   101453336.0,  3023261111.0},
-  { 690592680.0,  2708799647.0,  2310707996.0,  2443881308.0,   646410687.0,  1008900620.0},
-  {4099000648.0,  3799876371.0,  1201670792.0,   346638718.0,  3162064545.0,  1949629719.0},
-  {2276640635.0,  4196213675.0,  2709503879.0,  4128817753.0,  3028354878.0,  2572142771.0},
-  { 467884153.0,  3240051539.0,  4177724168.0,   931413589.0,  3825266900.0,  1973892227.0},
-  {2201982779.0,  1948404186.0,  3396436889.0,  4070398665.0,  1657303511.0,  2697046010.0},
-  {2856250923.0,  2851787742.0,  2776662357.0,  2821777065.0,  1190505663.0,   248723765.0},
-  {3059543094.0,  1465549006.0,   979652678.0,   808731671.0,  1247369961.0,  2221121903.0},
-  {2648774766.0,  1836017866.0,   109487550.0,  2022962442.0,  3129355995.0,  2917956914.0},
-  { 494205130.0,   616710176.0,   117082747.0,  1430833735.0,   258896157.0,   899339445.0},
-  {2285948109.0,   317325437.0,  2419629689.0,  1459366235.0,  1298753730.0,  2605936862.0},
-  {2163277831.0,  1533114399.0,   272321480.0,  3511322538.0,  3639112198.0,   385773825.0},
-  {  54287461.0,   427706488.0,  1942474761.0,  1617291762.0,  1937047881.0,  1826592826.0},
-  {3202541680.0,  2396312107.0,  3688517574.0,  1550745468.0,   427165940.0,  3953010221.0},
-  {2085304542.0,  2551570638.0,  2643945143.0,  1700372279.0,  1694603829.0,  3304757844.0},
-  {3628674567.0,  2348462162.0,  1720103334.0,  2119623819.0,  1997127213.0,  3878160329.0},
-  {2211049933.0,  1632601786.0,  1055930166.0,  1865776858.0,   885843946.0,  2371584232.0},
-  { 822646323.0,  1133006254.0,  1339027076.0,   306246426.0,  2313431013.0,   641498767.0},
-  {2843639881.0,  4027756724.0,  1020247455.0,  3688578611.0,  1767531000.0,  3000951769.0},
-  { 355510824.0,   835721622.0,   210725214.0,   879652041.0,  3777465980.0,  3171350607.0},
-  {4191819538.0,     1661430.0,  1298931436.0,  2019284504.0,  1079056621.0,  1908551162.0},
-  { 502058475.0,   992173923.0,   601507738.0,  1380520875.0,  1025899230.0,  2242403940.0},
-  {4026932052.0,  1192995084.0,  1888726677.0,   578513856.0,   863104031.0,  1729481842.0},
-  {3156844430.0,   217975249.0,  1725641897.0,   823304334.0,  1916921848.0,  1484738621.0},
-  {3951399680.0,  3831384029.0,  3318728905.0,   875359560.0,  3335086454.0,  1666655402.0},
-  { 686914365.0,   241955191.0,  1945062224.0,  3781269368.0,  4049463530.0,   321595552.0},
-  { 295012893.0,    91497313.0,  3793893264.0,  1914237316.0,  2462563397.0,  3428192388.0},
-  {3446577451.0,  3853870938.0,  1980577126.0,  4084493542.0,  2024550974.0,  3569970789.0},
-  {4046700910.0,  3948812274.0,  4099495020.0,  1188353687.0,  4144122698.0,  4066250131.0},
-  { 362444630.0,  1009970091.0,   328087548.0,  2133954496.0,    77133740.0,  2958080052.0},
-  {2094075468.0,  3756709809.0,   383747499.0,   696240287.0,  4106216887.0,  3283489998.0},
-  {2447892790.0,   662790023.0,   362679049.0,  1452023977.0,  1846685776.0,  3468176322.0},
-  {2390476621.0,   233718171.0,  1125235870.0,  1354813079.0,  1896491344.0,  1324449737.0},
-  {2610966822.0,  1293004557.0,  2895029878.0,   871464396.0,  1102735813.0,   580206280.0},
-  {3801588025.0,  2339457005.0,  3448015794.0,   729103650.0,  1253306428.0,  2158597937.0},
-  {1601011089.0,  2315980139.0,  1933390143.0,  3999643054.0,  4124549766.0,  3544463742.0},
-  { 291677004.0,   716512120.0,  2080285385.0,  2564105186.0,  1590897706.0,  3624175636.0},
-  {3586316794.0,   899428730.0,  2690030804.0,   741710367.0,  1846389751.0,   123140847.0},
-  {1622685594.0,   452789133.0,   778161585.0,  1009118514.0,   230392880.0,  1049601388.0},
-  {2469691502.0,  1061432414.0,  3560627353.0,   654273832.0,  1168433553.0,   745865685.0},
-  {1937060019.0,  2076857497.0,   636874201.0,  3074893538.0,   292121193.0,  3027632281.0},
-  {2067854084.0,   267289430.0,  2396087410.0,  2860478480.0,  3153784479.0,  3971142098.0},
-  {4152658835.0,  1002638596.0,  2294972923.0,   792150240.0,   312199235.0,  1070305089.0},
-  {3991883447.0,   926407728.0,  2639247115.0,  2360404689.0,  3357285239.0,   539784406.0},
-  {3217104995.0,  2499685487.0,  3065422660.0,   328092347.0,  1813389907.0,  2326162062.0},
-  {1035172279.0,  1854440476.0,  2378291538.0,  2771669545.0,   969248910.0,  2181398473.0},
-  {2578410516.0,  2266491588.0,  1175329277.0,  3386597482.0,  3999003756.0,  2748121628.0},
-  { 214471849.0,  2445670390.0,  1236484714.0,    81990191.0,    67530619.0,   864181942.0},
-  {3305059478.0,  2838609945.0,   701062711.0,  2937524943.0,  4087440238.0,  4187029331.0},
-  { 437976686.0,  2325205697.0,  3378426426.0,   156521695.0,  2146018605.0,  1833482110.0},
-  {4165683319.0,  3507792048.0,   314969770.0,   619217928.0,    52609305.0,   803986622.0},
-  { 790569346.0,  1387668877.0,  1398865313.0,  2952704854.0,  3441683728.0,  4178414213.0},
-  {  49914019.0,  1243506309.0,  2248325612.0,    90304093.0,  4191832522.0,  2915035079.0},
-  { 565112986.0,  1605312771.0,  1917063833.0,  1421510517.0,  3815983696.0,   686887048.0},
-  {1038165152.0,   783971069.0,  3749593134.0,    28721011.0,   743978338.0,  3609853208.0},
-  {2283330444.0,  3677399209.0,  4258482641.0,  2092540957.0,  2419618999.0,  2193382430.0},
-  {3128679248.0,  2030573774.0,  1820748762.0,  4255609355.0,   551681975.0,   482539585.0},
-  {2260098786.0,   774991608.0,  3413817151.0,  3357883555.0,   670289617.0,   844475729.0},
-  {3123307013.0,  3225360997.0,  3739352921.0,  2020994156.0,  2915551477.0,  1504755479.0},
-  {3183584567.0,  2456756963.0,  1508422394.0,   190954540.0,   774196732.0,   898821832.0},
-  {1578301801.0,  3040764375.0,  3291154343.0,  2289909083.0,   218113297.0,  1751833904.0},
-  {1903346913.0,  2662095715.0,  2508978384.0,  2272341515.0,  3986997391.0,  2819696192.0},
-  {3688660519.0,  1188838800.0,  1947357617.0,  3873952111.0,  1293164275.0,  3462356257.0},
-  {1360469642.0,   815484133.0,  2081668846.0,  2275151756.0,  1911511126.0,   655257249.0},
-  { 114662836.0,   581330004.0,   256308013.0,  1911012397.0,  3206114939.0,   846573182.0},
-  {1224418027.0,   261956784.0,  1640969995.0,  3499008348.0,  4170841278.0,  4059545121.0},
-  { 895184242.0,  4265612014.0,   234782847.0,   634952590.0,  2116546039.0,   144677064.0},
-  {3591235521.0,  3259422693.0,  2151925041.0,  3835522553.0,  1293822630.0,  2638938675.0},
-  {2553805010.0,   817346173.0,  1845699930.0,   833183645.0,  3348812642.0,   956126816.0},
-  {1732588111.0,  3399623935.0,  3316303506.0,  2322739669.0,  2036446267.0,  1092607929.0},
-  {3739343099.0,  1843931297.0,  2723077744.0,   383605368.0,   757438214.0,   367153551.0},
-  {4204698129.0,  2699509123.0,  3085097851.0,   810682242.0,   696565928.0,  4030989963.0},
-  {2152740438.0,  3830544926.0,  3899385922.0,  1457150762.0,   565623943.0,  2444425462.0},
-  { 563853959.0,  1187438612.0,  2742325947.0,  1157867463.0,  1200331194.0,  1418821614.0},
-  {2477537293.0,  2003965046.0,  2509241796.0,  1501629512.0,  2343687373.0,    22201446.0},
-  {3511006954.0,   749048759.0,  3995960508.0,  1611577370.0,  2920444981.0,  2195947748.0},
-  {3017093548.0,  1776024119.0,   105534820.0,  1503048480.0,  2277095237.0,  1741204223.0},
-  {1445620263.0,  3894568014.0,  4045644770.0,   680899937.0,  1439254000.0,   630876692.0},
-  {1115997622.0,  1149685483.0,  3709637613.0,  2247655046.0,   227081137.0,   773037081.0},
-  {2367241129.0,  1055305731.0,  3288024328.0,  1519437099.0,  3073604101.0,  3714472420.0},
-  {3013429423.0,  1232499034.0,  2565558710.0,  3030770121.0,  1464771714.0,   105303172.0},
-  {1560146962.0,    71780533.0,  3147472276.0,  2910976077.0,  3146381895.0,  1676423852.0},
-  {2046326102.0,  1825223036.0,  3177843929.0,  2259910587.0,   345156584.0,   292855637.0},
-  {1957281545.0,  2367577944.0,   898442784.0,  1290144547.0,  3861835286.0,  1816577962.0},
-  {1701033139.0,  3948526938.0,  2568466346.0,  2210730673.0,  3799344368.0,   294208410.0},
-  { 261668458.0,  1399558454.0,  3026852779.0,  2726331355.0,   662174791.0,   853753925.0},
-  {3618029189.0,  1477455548.0,   529460380.0,     2838086.0,  1087997982.0,  1140502304.0},
-  {1075588562.0,   436354947.0,  2767161561.0,  1992896927.0,  3046579187.0,   367573599.0},
-  {2138847227.0,   766100020.0,  1911969388.0,   438522792.0,  3127618478.0,  3664962617.0},
-  {2305809112.0,  3978169454.0,  2500883874.0,  4092276808.0,  1873417254.0,  2004518575.0},
-  {1014000451.0,  1438821595.0,  1505005707.0,  1618513397.0,  1499059618.0,  2369097636.0},
-  { 326563609.0,  3453497996.0,  3362419903.0,  1494204182.0,  3117287735.0,  3180979141.0},
-  {2791752408.0,  3847683600.0,  1972454516.0,  4240304534.0,  2084548210.0,  1056552960.0},
-  {4101153924.0,  2013568880.0,   375529514.0,  2403575585.0,  2719763121.0,  3448973170.0},
-  { 211794490.0,  3881683282.0,  3836333645.0,  4219635747.0,  1621001739.0,  3508193774.0},
-  {3541466629.0,  4070076543.0,  1678673417.0,  1137053206.0,  4033462199.0,  1604092152.0},
-  {1651023042.0,   392882331.0,  1417801809.0,  4228805251.0,   193955060.0,    57025169.0},
-  {1351457466.0,   204240942.0,  2760800833.0,   282638543.0,  1208077147.0,  2738902214.0},
-  { 707538561.0,  3379065294.0,  1997955004.0,  4048342445.0,  4156168761.0,  2446392390.0},
-  {3564775823.0,  3003483090.0,   726714138.0,    30770141.0,  1463754794.0,  3858949773.0},
-  { 887431398.0,  4045112452.0,  2215436317.0,  3150491757.0,  1848644255.0,  3351687320.0},
-  {2655562135.0,  1884592547.0,   406380062.0,  2066922611.0,  4170897985.0,  2426721632.0},
-  { 459005753.0,  3792763028.0,  1419661268.0,  2899730289.0,  3477712924.0,  3788795854.0},
-  {4060140814.0,  2532581861.0,     7396554.0,  1106666905.0,   369079673.0,  4168008282.0},
-  { 698355128.0,  3114122638.0,  2001402997.0,   702775313.0,  3974992235.0,  2211350416.0},
-  {3141804946.0,  1782649766.0,  1416783609.0,  4198005894.0,   943407172.0,  3271095496.0},
-  {2471511671.0,  2812439041.0,  3156391329.0,  2444565915.0,  2140061515.0,  1043205644.0},
-  {3155732377.0,   407267955.0,  2975165039.0,  1880027695.0,  3970387142.0,  3759516408.0},
-  {2313308263.0,    66441315.0,  3856470396.0,   916460872.0,  1731606722.0,   455312557.0},
-  {2929149001.0,  2697747215.0,   666259018.0,   497754360.0,  2239123186.0,   962577401.0},
-  {1775879272.0,   918361726.0,  1368421383.0,  3408458129.0,  3457954272.0,   229040794.0},
-  {1539770825.0,  2902639951.0,  1453605493.0,  2813338496.0,  2869566414.0,  3019841565.0},
-  {1454455388.0,   188744456.0,   185324663.0,  3792024518.0,  2585535097.0,  2673531844.0},
-  {2562806432.0,  1578036868.0,  2601037261.0,  4146063747.0,  3123181151.0,  2320413745.0},
-  { 906013440.0,  3971064777.0,  3730667902.0,  2868724828.0,  2484012352.0,  1121833868.0},
-  {3011518202.0,  1647993193.0,  4123299959.0,  1507749457.0,  3853750661.0,  1700763184.0},
-  {1991324103.0,  2610386654.0,  2109108588.0,  4128104350.0,   206740014.0,  4083061251.0},
-  {3055685453.0,  2748579512.0,  2605480004.0,  2585788664.0,  2501655201.0,  1587094539.0},
-  {3624152424.0,  1851174249.0,  2773713717.0,   963384904.0,   803065115.0,  2000366979.0},
-  {1630210318.0,  2734148389.0,  1939259825.0,  1828210167.0,  2539784227.0,  1067048390.0},
-  {3561507049.0,  1069024299.0,  2011489533.0,   199357613.0,  4128553102.0,  1160699797.0},
-  {1949577807.0,  1387335805.0,   426675400.0,  3104105153.0,  2218128887.0,  3333480376.0},
-  {1005233226.0,  2000549759.0,  1910124690.0,  2492506731.0,  3029877737.0,  3228463037.0},
-  {2982060492.0,  1679425613.0,   837386790.0,   494068473.0,   909104330.0,  3851530426.0},
-  {1713269662.0,   615939898.0,  3995018871.0,  2806310394.0,  2180667195.0,  2671518723.0},
-  {4022708476.0,  2492596582.0,  3832921516.0,   763063303.0,   171419806.0,   962103701.0},
-  { 648248970.0,  4146515956.0,  1605925119.0,  1799650893.0,  3736955032.0,  2685021637.0},
-  {3965400588.0,  1268171239.0,  4088161925.0,  3963622254.0,  1724049530.0,  1532699038.0},
-  {2089178970.0,   130137288.0,   258824018.0,  4103848002.0,  1773814214.0,  3907687907.0},
-  {2082675725.0,  3870049542.0,  2155062380.0,   114499548.0,  4184935324.0,   730359712.0},
-  {3607412515.0,  3052667100.0,  3836629392.0,  1619249958.0,   214803086.0,  1257113424.0},
-  {1865734823.0,  2842725192.0,  2224697011.0,  3075034734.0,  2220717737.0,  3542526778.0},
-  { 143779692.0,  2198763846.0,  1018348840.0,  1365958644.0,  4215605744.0,    88060151.0},
-  {2216494414.0,  1857748418.0,   382188726.0,  3330809806.0,  4133934618.0,  2499436550.0},
-  {2760364708.0,  3464526166.0,  3709436398.0,  4286054568.0,   306139246.0,  1859457439.0},
-  {2875384041.0,  3806717617.0,  1601828489.0,  1171827373.0,  2604026953.0,  3105220406.0},
-  {1892610774.0,  4133555787.0,   251455191.0,  2297828033.0,  2474264480.0,   516388171.0},
-  {1638146395.0,   719843527.0,  3922593684.0,  3329706727.0,  1300201427.0,  1607267333.0},
-  {3970074734.0,  3519059230.0,   366670651.0,  2836078849.0,  2462031924.0,  1453845246.0},
-  {2967196830.0,  2330455889.0,  2441426786.0,  2950877178.0,  3381360409.0,  1850632387.0},
-  {1312805118.0,  2787946841.0,   549038355.0,  1648232945.0,  3758174268.0,   681094769.0},
-  { 393259258.0,   965847587.0,  4147870976.0,  1277321726.0,  1477950092.0,  4111411640.0},
-  {1941576221.0,   802035422.0,  3089300531.0,  3510915920.0,   409311414.0,  2192133430.0},
-  {1430395818.0,   378192871.0,  1682841390.0,  1207649419.0,  2289732894.0,  3387350270.0},
-  {4019341366.0,  1731251770.0,  3054398556.0,  1264227545.0,    66997922.0,  1243272666.0},
-  {4113918341.0,  3891720050.0,  2113341678.0,  1936662128.0,  2573372122.0,  1206144108.0},
-  {2786314560.0,  2896427963.0,    24470553.0,  4227818054.0,  1685253772.0,  3475642491.0},
-  {1306078970.0,  1976890710.0,   282311664.0,   380994214.0,  2354751055.0,  1690601317.0},
-  {3674826005.0,  2916643385.0,   850017971.0,  2658880356.0,   930016159.0,    17374365.0},
-  {  33339799.0,   222461849.0,  1391218423.0,   541679194.0,   180317300.0,   445348936.0},
-  {4000430580.0,  3480827844.0,  2549467307.0,   844057615.0,   125875520.0,  2353795375.0},
-  {  32145223.0,   729724647.0,  2028326900.0,  2783294602.0,   919173141.0,  2521182469.0},
-  {3946726074.0,  3750177057.0,  2633886435.0,  1840269235.0,  2665133104.0,  4274734444.0},
-  {4147966843.0,  4263718503.0,  1263729289.0,  1310794282.0,  2793250847.0,  3792220410.0},
-  {3752208020.0,   490466794.0,   822595621.0,    20430974.0,  4147252687.0,  1448075590.0},
-  {3218520002.0,  3331661545.0,  3956469316.0,  3529272431.0,  2224007912.0,  2455003136.0},
-  { 373999361.0,   757335274.0,  2087083704.0,  1595667724.0,  3666553262.0,  2319003926.0},
-  {3029767963.0,   619282446.0,    87910372.0,   229462490.0,  2557484952.0,  4180428569.0},
-  {1216472591.0,  3644285194.0,  2581958973.0,  1970618160.0,   343079275.0,   615850236.0},
-  {1281309237.0,   638456382.0,  1581461172.0,   948311396.0,  1647195633.0,  2499461989.0},
-  {3191082761.0,  2857406491.0,  1933297615.0,   437311268.0,  3211682572.0,  1164623954.0},
-  {3086787845.0,  3695011114.0,  4165746785.0,  2683565311.0,  3800785264.0,  1820638090.0},
-  { 308420012.0,  2283869778.0,  2814059646.0,  1571099324.0,  1139208991.0,   945408853.0},
-  {2576502881.0,  1454311282.0,   661123613.0,   520679127.0,  4161385647.0,   135274425.0},
-  { 834068215.0,  2853923401.0,  1260679251.0,  3502191266.0,  1444036547.0,  1526959985.0},
-  {1611235664.0,  2754659570.0,  3718197667.0,   545758038.0,  1738029045.0,  2835351736.0},
-  {3994382340.0,   362722131.0,  2216619401.0,   231712409.0,  1865804800.0,   741142353.0},
-  { 391173291.0,  2874289473.0,  3070759462.0,  3858343620.0,  3865167498.0,   822257601.0},
-  {2088135050.0,   667103367.0,  2903668383.0,   320009008.0,  2205259684.0,   450553913.0},
-  {3200771586.0,  1347268577.0,   927327896.0,  3326750851.0,  1210155904.0,   959385059.0},
-  {  79320544.0,   673721325.0,   849129233.0,   612640889.0,  3788739202.0,  3804034817.0},
-  {2056124302.0,   365988598.0,  2717509943.0,  2514267878.0,  2136643419.0,  1911979314.0},
-  {2383446192.0,  2495587440.0,  1361117242.0,   182630512.0,  3434024516.0,  1516294816.0},
-  {1650554215.0,  2747089528.0,    74564488.0,   386197913.0,  1144891481.0,  3219796649.0},
-  {3167029771.0,  4083896860.0,  1035149930.0,  3124863067.0,  3952023244.0,  4159182820.0},
-  {1493488528.0,  1707979159.0,  2634017609.0,   926893206.0,  3311352568.0,  3210719152.0},
-  {3013550987.0,  1423149062.0,  3353076747.0,  2685771849.0,  2886622417.0,  1816721282.0},
-  {1857783058.0,   812057785.0,   442910319.0,  2297458762.0,  2739963242.0,   272602023.0},
-  {1594936335.0,   586393721.0,  4255604774.0,  3260365296.0,  1087147248.0,  4073655052.0},
-  {3356292260.0,  3865319777.0,  1298063025.0,  1928201770.0,  2187927248.0,  3798771167.0},
-  {3614111429.0,  2485874757.0,  4147778996.0,  3886401658.0,  2271446373.0,  2254904535.0},
-  {1855660594.0,  3442311443.0,  1380457237.0,  1331249660.0,  3629567700.0,  1801747739.0},
-  {1329493890.0,  4188140622.0,   969157873.0,   724950879.0,  1231850132.0,  2611048614.0},
-  {2705796414.0,  4000738677.0,  3849497828.0,   618513940.0,  3121277542.0,  3211189217.0},
-  {3682143368.0,  3430718578.0,   274426937.0,   567120609.0,  1070297720.0,  2907628132.0},
-  {3938711658.0,  3161730185.0,  1111618479.0,   925192172.0,  1255016486.0,  3936413060.0},
-  { 951365388.0,  2448073615.0,  1806206862.0,  3210466799.0,   813929449.0,   809303579.0},
-  {2374556300.0,  3041224749.0,  3418792295.0,   851354465.0,  1146760102.0,  2147682343.0},
-  {1538701221.0,  3594112321.0,   740822340.0,   471772910.0,  2646311604.0,  1781574951.0},
-  {1878113717.0,  3407947359.0,  3483543965.0,  1119471579.0,  2015768650.0,  3678325628.0},
-  { 975218865.0,  3627467871.0,  4047426451.0,   375521531.0,   533548055.0,  2746491166.0},
-  {1898463583.0,  1867969104.0,  4272827890.0,   410432832.0,  3857833072.0,  1648475329.0},
-  { 494350981.0,  3796167992.0,   778812394.0,   539883887.0,  2204344912.0,  2181145219.0},
-  {2344495428.0,   885319211.0,  3475637402.0,  2820481904.0,  1057658214.0,  1409702455.0},
-  { 864619457.0,  3857487630.0,  3650786137.0,  2075610968.0,  3363507625.0,   648595635.0},
-  {1879790201.0,  1077387649.0,   278650271.0,  3842295326.0,  3333556866.0,  3232635556.0},
-  {1325731184.0,  1180279030.0,  2373635800.0,   997201206.0,   533038214.0,  2316180328.0},
-  {1758986282.0,  1487003118.0,  1389284419.0,  2157152653.0,  4060043372.0,  3983509941.0},
-  {3208481925.0,  3489515068.0,  2034440949.0,  4175255251.0,   190971661.0,  4003793134.0},
-  {3114976109.0,  2628681002.0,  3428340930.0,  3326819541.0,  3134448389.0,  3108569577.0},
-  {2394034094.0,  3410009125.0,  4168980888.0,  3580522405.0,  4127652894.0,  1678292877.0},
-  {3153633826.0,  4221867115.0,  1822871437.0,  1064335309.0,  3077284227.0,  2847000505.0},
-  { 883390058.0,  3898391456.0,   750690469.0,  3085314883.0,  2391889717.0,   305192830.0},
-  {3146182387.0,  1906234537.0,   335755164.0,  3288870029.0,  2773141745.0,  1154895497.0},
-  {3051740165.0,  3773950751.0,  3142673957.0,  2390132087.0,  1634611710.0,   355540618.0},
-  {2257795463.0,  3872746777.0,  2938831622.0,  2957382853.0,   117216563.0,  1937476610.0},
-  {4031656478.0,   812617907.0,  1220909350.0,  2840902836.0,   873872038.0,  3425958505.0},
-  {3520850112.0,  3210992962.0,  2903502636.0,  3453352933.0,  3686494160.0,  1865904584.0},
-  { 636427858.0,  1591191805.0,  1219883218.0,  1898068332.0,  2282553290.0,  1564238926.0},
-  {2699769744.0,   195962982.0,  3743253753.0,  4111985514.0,  1589683841.0,  2200761166.0},
-  {2526264744.0,  1360384934.0,  3207510446.0,   726353149.0,  3186022867.0,  2400987084.0},
-  {1991367270.0,  2021730781.0,   680957652.0,  4120789407.0,  2588542063.0,   560391480.0},
-  { 997044056.0,  1655895285.0,   723770283.0,  3687798927.0,   415909598.0,  2428969234.0},
-  {2929045791.0,  4142356030.0,  3716821677.0,  3352421246.0,  4215153065.0,   878173859.0},
-  { 607990555.0,  2209624846.0,   125003749.0,  2410842556.0,  4138748883.0,  2346180028.0},
-  {1025459594.0,  1837167365.0,  3905451082.0,  3131890638.0,  3121491463.0,  3479839207.0},
-  {4007474664.0,  1702267632.0,  2553331984.0,  3954075366.0,   411007203.0,  3753272872.0},
-  {1231168148.0,   418943129.0,   469914395.0,  2256565538.0,   919637177.0,  3291198937.0},
-  {2451208132.0,   643041459.0,  1090158389.0,    73417233.0,  1645232844.0,  3934337568.0},
-  {1203317804.0,  3913396839.0,  3500896885.0,   338299711.0,  1922257962.0,   297113675.0},
-  {1593676158.0,  2726926292.0,  1004173649.0,   469522972.0,  3477808487.0,  2808468295.0},
-  { 362848566.0,   706875658.0,   596249628.0,  1078501532.0,  2623103345.0,    37648970.0},
-  {3585450089.0,   618392355.0,  3275353041.0,   469920518.0,  1887692678.0,  1540008830.0},
-  {1213360818.0,   339750154.0,   626906277.0,  2531709712.0,  2135509211.0,  2070174174.0},
-  {4154290293.0,  2311128314.0,  2302800062.0,   734061271.0,  3014211562.0,   597266484.0},
-  {3515299886.0,   750154901.0,  2848713605.0,  1707230167.0,  4280776053.0,  2922190013.0},
-  {3740526970.0,  1416534482.0,  1805199955.0,  1632107284.0,    76758730.0,  1306698732.0},
-  { 736715675.0,  3604515024.0,  3913276940.0,  1448941348.0,  2061594392.0,  2993314849.0},
-  {  21990054.0,  3555633077.0,  1655393655.0,  2080505944.0,   526843256.0,  4047129704.0},
-  {1199829776.0,  2677158595.0,  2880069776.0,  3424568513.0,  2586543273.0,  1379114946.0},
-  {1746752554.0,   604156489.0,  1952213395.0,   571236108.0,   929914046.0,  2442936742.0},
-  {4021712936.0,  3802943506.0,  2906160024.0,  3155003363.0,  4246762722.0,  4135986562.0},
-  { 752902113.0,  1568309984.0,  3912760838.0,  1243602482.0,    33859783.0,  2260014722.0},
-  { 623693102.0,  3044952107.0,   132905500.0,   562895363.0,  3443736310.0,  3143499501.0},
-  {3507043316.0,  3702754566.0,  1598554803.0,  3907998702.0,  2183373279.0,  2709807556.0},
-  {2968279611.0,  1634574979.0,  1948255869.0,  2098103783.0,  2589787960.0,  1395463516.0},
-  {1017063229.0,  3459215475.0,   402802801.0,  1047645063.0,   362916987.0,  2613562904.0},
-  {2273271511.0,  3513188226.0,  3097655420.0,  1149230632.0,  2198215417.0,  1618912853.0},
-  {2858772056.0,  2632419856.0,  1545860421.0,  1697297219.0,  3073817939.0,  3511943388.0},
-  {2978121168.0,  1417903961.0,  2621100770.0,  2806340700.0,   645031705.0,  2083344135.0},
-  { 348505925.0,  3968884410.0,   605954152.0,  2255853333.0,  2886943007.0,  2553105773.0},
-  {4176086580.0,  1999933090.0,  2693626143.0,   193904526.0,  2630977491.0,  2431224844.0},
-  {3400408563.0,  2758557599.0,  3678875027.0,  3022889416.0,   106903382.0,  2945990402.0},
-  {2794378937.0,  3157727036.0,  1407042751.0,  1516541997.0,  3624666368.0,   641006048.0},
-  {2718044718.0,  3140165085.0,   826065119.0,  2225816381.0,  2441585764.0,  3285974947.0},
-  {1823959643.0,  2982735778.0,   519848581.0,  2167641357.0,   124617638.0,   239484483.0},
-  { 886609818.0,  1402902873.0,  3024038923.0,  2632162504.0,  3618868514.0,   656173508.0},
-  {3065188430.0,  2379670704.0,   181571377.0,  1519751825.0,  1338614344.0,  2810082943.0},
-  {3620575492.0,  2527139177.0,  1842517951.0,   497086196.0,  4015093985.0,  3455143713.0},
-  {3040169296.0,  1974180099.0,  1194051259.0,   645227012.0,   234303399.0,   832158209.0},
-  {1150219260.0,  1895887738.0,   446683037.0,  3385609495.0,  1580297975.0,  2487099017.0},
-  {3771705008.0,  1070366519.0,  1958888974.0,  3493292676.0,  2123500706.0,  2862238808.0},
-  { 184036801.0,  3535352595.0,  4130787480.0,  1940237844.0,  3890343440.0,  3399897879.0},
-  {2337862265.0,   483005702.0,  2321494215.0,  4291947063.0,  3578948250.0,  1450546643.0},
-  {2584191828.0,  1970675653.0,  3396067677.0,  1044117470.0,  1531132484.0,    63920922.0},
-  {1912472915.0,  3593730218.0,  1267296118.0,  3012137058.0,  3085823562.0,  2680389306.0},
-  {4088105641.0,  3855038768.0,  1214081585.0,  2235910914.0,  1383333989.0,  3095631019.0},
-  { 838846627.0,   981025042.0,  3329919079.0,  1970095761.0,  1492668328.0,  2967911920.0},
-  {3329434762.0,  3143353625.0,  1186051204.0,  2738691001.0,  2346632698.0,   983739321.0},
-  {1049240065.0,  1326325416.0,  1117653434.0,  2890720087.0,  1534116402.0,  3565686393.0},
-  {2045252981.0,  2266158104.0,  2754657337.0,   416578368.0,   630884388.0,  1901382996.0},
-  {1401977694.0,  3727454222.0,  2510172708.0,  3250933808.0,  1348124931.0,  3704799596.0},
-  {4043208076.0,  1427559795.0,   514528721.0,  4222613871.0,  3539446135.0,  4211807042.0},
-  {1438424492.0,  2426211843.0,  3023442136.0,  1171345626.0,  1234122907.0,  1113073859.0},
-  {4038652000.0,   654874524.0,  2664244490.0,   938019115.0,   306764151.0,  3140898101.0},
-  {2986944169.0,     3058871.0,   472006329.0,   849460314.0,  2956078310.0,  1766345893.0},
-  { 979204828.0,  3826017283.0,  3669919231.0,  1410755020.0,   692932151.0,  2593235289.0},
-  {2619204503.0,   294083249.0,   843577917.0,  2595716717.0,  2374151508.0,  1437082857.0},
-  {3687504246.0,  1100775517.0,  2529602841.0,  2023343204.0,   634162982.0,  1980321854.0},
-  {3924662011.0,  1292661074.0,  3284274836.0,  1286311561.0,  3005787522.0,  1547701340.0},
-  {2887648678.0,   941015534.0,  2044402319.0,  1492584244.0,  4029685803.0,   263251251.0},
-  {2950880439.0,   719411469.0,  1201169203.0,  3902287060.0,  2728045341.0,  2157490159.0},
-  {4091257345.0,  2174199978.0,  1954670084.0,  2099562210.0,  2630440434.0,  1492420389.0},
-  {1850558719.0,  1810657732.0,  3635173546.0,  4077463191.0,  3165475642.0,   671525659.0},
-  {3167197940.0,  2948103896.0,   545419878.0,   462997976.0,   426367406.0,  1844990602.0},
-  {1512581151.0,  2567987810.0,  1005918765.0,  2231578323.0,   772378986.0,  1756853371.0},
-  {3969044984.0,   237119804.0,    97015481.0,  3072336254.0,  3217422538.0,  2957331958.0},
-  {3220822283.0,    84225166.0,  1665035028.0,  3396600887.0,   550477786.0,   577378110.0},
-  { 680584134.0,  3295892243.0,   116739218.0,  2019035578.0,  2411045488.0,  2335404920.0},
-  {2681110944.0,   236366772.0,   703002114.0,  2220804703.0,  4282440526.0,  3204734181.0},
-  { 915622595.0,  3563377201.0,   747907116.0,  1286291436.0,  1121988635.0,  1905255063.0},
-  {2156368419.0,   225942243.0,  3177775986.0,  1180786577.0,  4107487401.0,  3039424053.0},
-  {2151225256.0,    99521082.0,    20077893.0,  2693654268.0,  1281809070.0,  1935012923.0},
-  {2852302489.0,  3023721639.0,  1926436790.0,  1293369211.0,  3409808201.0,  3646297614.0},
-  {2000004221.0,  1271767249.0,  1843590300.0,  3070393973.0,    59005696.0,  2351574885.0},
-  { 218256804.0,  2404305653.0,  3876226504.0,  2060079860.0,  2026463919.0,  1800668180.0},
-  {2125126263.0,  2258441164.0,  1231975772.0,  2012370898.0,  3378646848.0,  3853631910.0},
-  {1783711326.0,   537836069.0,  3585088663.0,  3026168069.0,  3935118859.0,  1087782749.0},
-  { 796474033.0,  3704970907.0,   868231337.0,  3716484929.0,  2035942082.0,  1645107992.0},
-  {2370706126.0,  3828722061.0,  2480151869.0,  3545980349.0,  4020480474.0,   200239836.0},
-  {  13781446.0,  1334014194.0,  1990367057.0,   206911999.0,  4281351549.0,  2838259513.0},
-  {2386575646.0,   990505915.0,  2079986162.0,  2610083539.0,  3637464251.0,  2378049129.0},
-  {3104488457.0,   552374042.0,     8870181.0,  1351834183.0,  1672525056.0,  3654117177.0},
-  {2914701193.0,  2238169762.0,   152037533.0,  2390824175.0,  3446627549.0,  1653793529.0},
-  {1263985964.0,   433586593.0,  3250724524.0,   295822347.0,     5197580.0,  1391390843.0},
-  {2376752438.0,  2103738454.0,  2134443609.0,   213423219.0,  3727900220.0,   284005703.0},
-  { 980239957.0,  4257630531.0,   762024150.0,  4220849566.0,  4039361546.0,  3530718001.0},
-  {3388804000.0,  1679190934.0,   281182362.0,  2074487173.0,  2202452364.0,  3572814882.0},
-  {3687310078.0,  1503600843.0,   528556687.0,  2197513812.0,   816777681.0,  1839746160.0},
-  {1421890099.0,  3315645585.0,   150399667.0,  3527887580.0,  2453649860.0,  3541863122.0},
-  {4251921193.0,  2731748662.0,  3413952115.0,  2372084075.0,   137966900.0,  1451311607.0},
-  {2124063998.0,   358978426.0,   167459763.0,  2545467601.0,   903853704.0,  2933096169.0},
-  {2348301762.0,  2816719901.0,  2660296974.0,  3209832471.0,  4087308284.0,   114371734.0},
-  {2440441096.0,   792543320.0,  1195215762.0,  1033560205.0,  2921016725.0,  3894074243.0},
-  {1429712698.0,   416734217.0,  2461072726.0,  1945123051.0,   723358767.0,  2772960707.0},
-  {1782167379.0,  1877409802.0,  3150768848.0,   369760652.0,  1883657545.0,  1630614969.0},
-  {4182690109.0,  1986762774.0,  2307108851.0,  3117482993.0,  2830662763.0,   923029658.0},
-  {3303310073.0,  4137778027.0,  1679281685.0,  2455499380.0,  4283576747.0,  3540694103.0},
-  { 601807626.0,  3610375391.0,  3608272488.0,   435775416.0,  1289381875.0,  2068652335.0},
-  { 142906369.0,  2371726124.0,  2226452590.0,  2480090794.0,  1889674836.0,  1301896837.0},
-  {1627279542.0,  2089649057.0,   461571916.0,  3448648564.0,  1308448871.0,  2781940396.0},
-  {3974418821.0,  1993597015.0,   178119060.0,  2486553252.0,  2101476701.0,   990317395.0},
-  { 516138481.0,  2121297837.0,  2944636665.0,  2755167304.0,  3214664749.0,    41701255.0},
-  {2285455177.0,    31939243.0,  1720370080.0,  4083145452.0,   374602040.0,  1315527760.0},
-  {3944239631.0,  4256572981.0,  1580213919.0,  1758248265.0,  1953948781.0,  1620221514.0},
-  {3743172284.0,  1839885169.0,  1595188759.0,  1939921524.0,  1695725971.0,  3206211627.0},
-  {1856499978.0,  2359282907.0,  2230053305.0,   728322028.0,  3624889236.0,  1121342283.0},
-  {3474176651.0,   642115839.0,   986816028.0,  1593290007.0,  3907899432.0,   161437503.0},
-  {3813516253.0,  3290311163.0,  1194257043.0,  1239223424.0,  3306131802.0,  2659785303.0},
-  {1673072404.0,  2007878305.0,  2401284542.0,  2925117862.0,   216875043.0,  3410085753.0},
-  {3566391749.0,  3806310825.0,   432625343.0,  4108591705.0,  1219914761.0,  1184852570.0},
-  {3203602638.0,  2588561649.0,  1670176386.0,  3577275434.0,   212325279.0,  3533120767.0},
-  { 812306969.0,  1368311594.0,   984632304.0,  2240356465.0,  3032051596.0,   270364861.0},
-  {3912434411.0,   551092173.0,  2020654125.0,   935165170.0,  3232167201.0,  2933478539.0},
-  {3765532793.0,  2324772389.0,  3986575091.0,   198450413.0,  3897836280.0,  1392686880.0},
-  {3248120067.0,  2751371520.0,  3398270952.0,  3167084296.0,   912653184.0,  3518075795.0},
-  {2712583471.0,  1604680127.0,  2379488081.0,  2497061624.0,   124298049.0,  2968323162.0},
-  { 591752229.0,  1177280981.0,  3562206298.0,  1006258796.0,  2114636501.0,   784279967.0},
-  {2525878903.0,  1433591035.0,  4139762514.0,  4142762549.0,   594096332.0,  2659116976.0},
-  { 537637647.0,   946639534.0,   832539086.0,  3789231707.0,  4127653553.0,  2769609920.0},
-  {3910134848.0,  1893161315.0,  2684814307.0,   965825786.0,  3439361602.0,  2135159126.0},
-  {2124893140.0,  2266050190.0,  2847893086.0,  1406014909.0,  2038384789.0,  2138950048.0},
-  {3875047320.0,  1753317281.0,  1478112058.0,  4010158947.0,  1308228850.0,  3738335775.0},
-  {1157485151.0,  1044322737.0,  2435611924.0,  3076240796.0,    49415776.0,  1955260326.0},
-  { 537460794.0,  3972612648.0,  2061943982.0,   206902997.0,  2692756512.0,   365398428.0},
-  {3058489566.0,  2639871163.0,  4102655192.0,  2174132590.0,  3260379608.0,  1821418754.0},
-  {3148421689.0,  2178658638.0,  3394202501.0,  1854722115.0,  1662415751.0,  3811188669.0},
-  {1092506636.0,  2397964847.0,  2548681944.0,  4285250360.0,  1078464086.0,   838898094.0},
-  {1825776736.0,   236811546.0,  2418512191.0,  1732715330.0,  3988734323.0,  1115477693.0},
-  {1978710223.0,  2029797942.0,  1262457558.0,   138736599.0,   782067206.0,  3822359642.0},
-  {2713677643.0,  2350004492.0,  2562936484.0,  4211373947.0,   141593295.0,   298532295.0},
-  { 343629107.0,  1639651924.0,  4104394586.0,   361217227.0,   717355678.0,  4291438790.0},
-  {1503714490.0,   685646909.0,  1323947849.0,  3051098246.0,  1768478811.0,  2251592309.0},
-  {3583966004.0,  1299295801.0,   850111942.0,  1173117585.0,   367595174.0,  1393538348.0},
-  { 893152542.0,  4079346068.0,  4224882388.0,  2455118435.0,   107744075.0,   295112428.0},
-  {4195971484.0,  2325896169.0,  2491685316.0,   872217390.0,  2357503468.0,  4107951346.0},
-  { 709970309.0,  2055261082.0,  3727627339.0,  3185697338.0,   599995436.0,  3040969129.0},
-  { 517553865.0,  3529007056.0,  4234064208.0,  1795136394.0,   437362343.0,  1243686289.0},
-  {2467281061.0,  1843335836.0,   959977301.0,  3663960478.0,  3295680568.0,  1220111318.0},
-  {1256121560.0,  2170805270.0,   932223220.0,  1940892114.0,  3248013232.0,  1143721216.0},
-  {1628403462.0,  2550759174.0,  3469516388.0,  2267202956.0,  3601463491.0,  3036300569.0},
-  {4013880556.0,   692807401.0,  3536700507.0,  3675028178.0,  3628640905.0,  2002065654.0},
-  { 279309957.0,   819681797.0,    18471754.0,  1005840268.0,  2052382528.0,  3813482387.0},
-  {2677825789.0,  1689982705.0,  3529889501.0,   828250601.0,  3685388381.0,   461853213.0},
-  {1360155133.0,    76095453.0,  4147885698.0,  2887575765.0,   644687158.0,  3252176954.0},
-  {2626247931.0,  3999042145.0,  3130532921.0,  2201953928.0,   101013345.0,  4144462019.0},
-  {1079862852.0,   872161486.0,   214140893.0,  3670836955.0,  3128744093.0,  3170703042.0},
-  {2026203619.0,  1380204694.0,   374734693.0,  3930915650.0,   175910514.0,  1914065434.0},
-  {1499103340.0,  2758712944.0,  3677866574.0,  1641975684.0,   135175570.0,   389740373.0},
-  {3356392068.0,   215619537.0,  1956024069.0,  2758704810.0,  3798544863.0,   173566810.0},
-  {2643381807.0,  1205175341.0,  3506310357.0,  4178224800.0,  1954220887.0,  1399727337.0},
-  {3077774475.0,  3296137610.0,  3749643486.0,  4266756025.0,  3040755889.0,  1119293335.0},
-  {3205739460.0,  4168168381.0,  4060694160.0,  1803917802.0,   120395458.0,  3026060153.0},
-  {1468384693.0,  1867117359.0,  1282288181.0,  2118919604.0,  1795945712.0,  3969518627.0},
-  {1975267109.0,   822161389.0,  1597672019.0,  1253771288.0,   725008833.0,  1774130515.0},
-  {2643613659.0,  3992773467.0,  3156114200.0,  2490113908.0,  2464177106.0,  1652598143.0},
-  {3773369068.0,   278154969.0,  2326042011.0,   654006332.0,   205864007.0,  3820087459.0},
-  {3379671484.0,  1403420474.0,   203615383.0,  2997481866.0,  2712817527.0,  1652864922.0},
-  {3154001197.0,   560195130.0,  1909210067.0,  1307947025.0,  2765650684.0,  2216265321.0},
-  {1948851828.0,  2724510847.0,   629787820.0,  2035164393.0,  2039389566.0,  1716969205.0},
-  {3745876102.0,  3298712727.0,   461686650.0,  1521041572.0,  3071508704.0,  2185687588.0},
-  { 957287708.0,  1421220783.0,  1580606778.0,   976966711.0,  3738697743.0,  4091584593.0},
-  {1442474392.0,   254982732.0,   539993576.0,  3110578378.0,  2864040060.0,  2849057226.0},
-  {2157768647.0,  1845068482.0,   993363974.0,   878822599.0,  1358755837.0,  3413390641.0},
-  {1975337227.0,  1385654938.0,    15310447.0,   254135247.0,  3194178083.0,  1876859460.0},
-  {2163081594.0,  2370558731.0,  3121426393.0,  2858043872.0,  1946123726.0,   456358309.0},
-  {3768757425.0,   720909099.0,   228698708.0,   634059239.0,  4198335536.0,  2775297869.0},
-  {1187534212.0,  3087354806.0,  1525610881.0,   989323473.0,  2926447660.0,  1946440382.0},
-  {2298900050.0,   463277958.0,   129921185.0,  3905235203.0,   344886975.0,   544627964.0},
-  {1436564455.0,  1889421059.0,  2267352460.0,  3304356284.0,  3919435505.0,   310729807.0},
-  {1969129361.0,  1109205133.0,   139405046.0,  3054998234.0,  2502438104.0,  3866354590.0},
-  {1917362901.0,  2421419255.0,  2078561314.0,   716170641.0,   959802674.0,  4101159265.0},
-  {1095755712.0,  3652444283.0,  3503931688.0,  3470716390.0,  2191461950.0,    54132752.0},
-  {1226758241.0,  2209853206.0,  2407554646.0,   458143367.0,   354558580.0,  1348690609.0},
-  {3340734036.0,  3818414168.0,   680144284.0,   820895170.0,  2199983569.0,  1465362930.0},
-  { 138017016.0,   258651923.0,  3213165960.0,  1318329202.0,  1891451106.0,    91231620.0},
-  {3627709721.0,  1768661153.0,   616867353.0,  4002934399.0,   640797387.0,  3128981572.0},
-  {3229424371.0,  2777836369.0,  4073897907.0,  3929360557.0,  2768954791.0,  1664026861.0},
-  {  83376195.0,  3903376325.0,  3132538476.0,  1236127977.0,  1037931888.0,  4259962327.0},
-  {3910956753.0,   938846690.0,  4005345531.0,  1131684782.0,  1457781525.0,  3034038563.0},
-  {1661069363.0,   141651089.0,    17103236.0,  2959132776.0,  2917496390.0,  2368182856.0},
-  { 531317850.0,   687102727.0,  1975524024.0,  4056338483.0,  2616937271.0,   982428716.0},
-  {4207626526.0,  1637358087.0,  4286278469.0,  3070151271.0,   403269671.0,  2713027755.0},
-  { 197594296.0,  3254609581.0,  1279853484.0,   792279260.0,   714312077.0,  4247911233.0},
-  {2024926911.0,   362350318.0,  4202945966.0,  2578417820.0,  2129869314.0,   306601733.0},
-  {1621935175.0,   460333880.0,  2869155885.0,  2645036437.0,  2743338111.0,  3802859886.0},
-  {2918620113.0,  2938072269.0,  2971503660.0,  2911158076.0,  2068401360.0,   945049235.0},
-  {3627622028.0,  1182905204.0,   173639968.0,  4140856132.0,   671822239.0,  1324496115.0},
-  {3374351564.0,  3912102002.0,   717356921.0,   661838578.0,  3784326316.0,  1840303100.0},
-  {3468432670.0,   310558180.0,   220401180.0,  3383843974.0,  3514323626.0,  3681430202.0},
-  {2141992183.0,   795582685.0,  3018848318.0,  1156580491.0,  3270036212.0,  3768459311.0},
-  {1074890852.0,  2877252745.0,   194989881.0,   358730050.0,   857943550.0,  4166873155.0},
-  {2860872831.0,  1318371157.0,  3656627614.0,  2656491828.0,  1284868717.0,  3791141223.0},
-  { 648423399.0,  1022976978.0,  1917004111.0,  1905787628.0,  3655676965.0,  3134603788.0},
-  {1202450346.0,  1259306680.0,  3423988913.0,  3929111434.0,  2480205813.0,  2163011261.0},
-  { 438166295.0,  1212050269.0,  3749341747.0,  2308533560.0,  3264493178.0,  1603787934.0},
-  {4026314639.0,  1877230388.0,  1663864980.0,  3449741528.0,  3626482112.0,  2739363581.0},
-  {3043091588.0,   866157095.0,  1621686855.0,  2843519138.0,  1884568920.0,  2275014727.0},
-  {3931279016.0,   956055210.0,  1092609184.0,    17951877.0,  4201864256.0,  4002085909.0},
-  {2515523289.0,  3860934496.0,  1169232450.0,  1521726491.0,  1312321880.0,  1410973757.0},
-  {2520708557.0,  4097852537.0,  1857061807.0,  1174179386.0,  2340237319.0,  1561258180.0},
-  {1684531457.0,  2882048437.0,  1866494336.0,  2624798648.0,  2558739478.0,  3407069074.0},
-  { 646262050.0,  1069675671.0,  3041915968.0,  1866592548.0,   183190493.0,  1542965184.0},
-  {1826535636.0,   152601405.0,  1847337570.0,  2821371539.0,  3717140841.0,  1779261103.0},
-  { 110347001.0,   283435888.0,  3174857199.0,  2255612791.0,  1429797412.0,  1329202307.0},
-  {1590739398.0,  4089625156.0,  1812602151.0,  1275264644.0,  3202044849.0,  1198643014.0},
-  {2798479055.0,   425306992.0,  2904623343.0,   263848954.0,  4284340206.0,  3722548801.0},
-  {1091033939.0,  3070339685.0,  3198047913.0,  3902856078.0,  3158003673.0,   545981675.0},
-  {2985330633.0,   876633811.0,  1253109694.0,    94384154.0,   692272058.0,  1499179739.0},
-  {3422356137.0,  1891762461.0,  2672861204.0,  2780457479.0,    41756602.0,  2258917739.0},
-  {2881631614.0,  2789497977.0,  1362370570.0,  2364386401.0,  2195091218.0,   883464423.0},
-  { 509056282.0,  2287950958.0,  3431278543.0,  2040886322.0,  2502387403.0,   627170051.0},
-  {4157092230.0,   458895514.0,  2922272334.0,  2104226278.0,   275121759.0,  1057098046.0},
-  {3948599161.0,  3376828589.0,  1356287724.0,  3812522164.0,  1760717776.0,  3305570284.0},
-  {2174092961.0,  4168346218.0,  2035102420.0,   635247782.0,  1443071356.0,  3454354077.0},
-  {2898020621.0,   973465026.0,   322614770.0,  3017334120.0,  1323968413.0,  1745065246.0},
-  {1164531860.0,  3163607642.0,  3343083085.0,  1078958985.0,  4065370615.0,  2495671873.0},
-  { 161559833.0,  1882301569.0,  3941394172.0,  3232377855.0,  3890899276.0,   589480218.0},
-  {3723658030.0,  3452003864.0,  3215944754.0,   247296254.0,  1727189246.0,  3356103597.0},
-  {2566819624.0,  2039521907.0,  2998140334.0,   125853960.0,  3265495536.0,  3247603894.0},
-  {2902144093.0,   170827107.0,  3611288886.0,  2182496452.0,  3946276277.0,   541117591.0},
-  {3782566678.0,  1597683870.0,  1959164904.0,  1593236509.0,  1192840183.0,  1283252461.0},
-  { 708785653.0,  3272926002.0,  3510158866.0,  3526351646.0,  1984209982.0,  1643324220.0},
-  {3389960803.0,  1826389465.0,   450952926.0,  1469614210.0,   470253699.0,  1712701636.0},
-  {1713536107.0,   497318578.0,  1357661837.0,  2561772492.0,  1187353452.0,  2356437111.0},
-  {1615415787.0,  3608067804.0,  3327898477.0,   995045003.0,  3852931840.0,  3745815533.0},
-  {3101997058.0,   472626923.0,  3225532859.0,   101198700.0,  2643839645.0,  2979461727.0},
-  {2941265708.0,   576651950.0,  2770180640.0,  2133151275.0,  3615937022.0,  3610931649.0},
-  {4243269232.0,  3212787160.0,  1450719644.0,  2310703033.0,  1606083822.0,   577675791.0},
-  { 563383253.0,  3998142960.0,   566608556.0,   950267885.0,  2235941768.0,  2099421162.0},
-  {2223486676.0,  2630790429.0,   574729565.0,  3696121474.0,  2329517872.0,  2262109011.0},
-  {2945888604.0,  2303402062.0,  3471081346.0,   412239111.0,   509418044.0,  3622812395.0},
-  {3948944446.0,  3205737707.0,   461112612.0,  1316234148.0,  4116944080.0,  2151267776.0},
-  {4152655904.0,   299586480.0,  3732414451.0,  2123346511.0,  1321585473.0,   736199215.0},
-  {3774959441.0,  3651802824.0,   984762584.0,  1366575777.0,   396205291.0,   499719714.0},
-  {4151217473.0,  1796859843.0,   138906890.0,  1085900753.0,  1249491850.0,  3301852372.0},
-  {3716533529.0,  2523988687.0,  2863672870.0,  1583459868.0,  4197589766.0,  4099446559.0},
-  { 385322472.0,  1059326647.0,  1926891416.0,  2248358096.0,  2595189040.0,  3547261828.0},
-  {3284519843.0,   571061449.0,  1440147225.0,  2453549923.0,  3330490869.0,  2739065397.0},
-  { 961405520.0,  2958266746.0,  1551488605.0,  3022383479.0,  4270538036.0,   798278271.0},
-  { 413628918.0,  2806357068.0,  3313833886.0,   435413329.0,  3250022608.0,  1799635445.0},
-  {1310174454.0,  3776161845.0,  3453971713.0,  2062218693.0,  1237267208.0,  1331528156.0},
-  {1947278967.0,  3490313591.0,  2860131282.0,   206588222.0,  1375048232.0,  3377757288.0},
-  { 423345710.0,  1138422838.0,  1453689864.0,  2610734110.0,  4294159092.0,  2583470550.0},
-  {1758322879.0,  2992816089.0,  4272730678.0,  2174565771.0,  4055426224.0,   285661461.0},
-  {3360265204.0,   953998814.0,  4271815913.0,  3015229715.0,   805700956.0,  2403251621.0},
-  {1495697410.0,  4080356354.0,  2755011988.0,  3411345101.0,  3647976571.0,  1514585473.0},
-  {3050701528.0,  1104705845.0,   314819392.0,  3807875145.0,  1706877828.0,  1672823144.0},
-  {1948969849.0,  2643170025.0,  2880940020.0,  4168548980.0,  4099118348.0,   433537879.0},
-  {2985342541.0,  1850830094.0,  3916696257.0,  2785423110.0,  1733756687.0,   630337037.0},
-  {1140575343.0,  3375619882.0,  3975812032.0,   926379600.0,  2317706233.0,  3288521322.0},
-  {4260243857.0,  2413223726.0,  3913307833.0,  3561958441.0,  3825992218.0,   418861920.0},
-  {3514809137.0,  3422196883.0,  4057965212.0,  1708674102.0,  3794705421.0,  2966195725.0},
-  { 493973447.0,  3479541465.0,  3656023208.0,  2274396848.0,  1881712570.0,  2550473523.0},
-  {2703806311.0,  1551636836.0,  1156068972.0,  2369459254.0,  3011574011.0,  2311005096.0},
-  { 191326151.0,  1863083917.0,  3524284407.0,  3498189902.0,  1312392465.0,   460255197.0},
-  { 637087471.0,   909984962.0,  1290108561.0,   440422681.0,   169113122.0,  1078381091.0},
-  {1247778255.0,   545342694.0,  2435321079.0,    45738210.0,  4252153256.0,   842595287.0},
-  {2093176956.0,   712050907.0,   676568219.0,  2176087956.0,  3290765842.0,  3456005479.0},
-  {2785538921.0,  1006346862.0,  1611370072.0,  3726210469.0,  3509949992.0,  1628944617.0},
-  {1418145871.0,  1345692850.0,  3236455256.0,  2733186734.0,  1290470992.0,  2613014396.0},
-  {2331565150.0,  1197550004.0,   467485199.0,   163905663.0,  4191770099.0,  4126920033.0},
-  {2448761988.0,  1056942013.0,  1898277660.0,  2633545373.0,  2595237019.0,  1071685896.0},
-  {2931595945.0,  2249937480.0,  4098535131.0,  2538500801.0,  2371071958.0,  2525509097.0},
-  {2507442991.0,  3399829048.0,  1701449231.0,   228244892.0,  4143675849.0,  4046825986.0},
-  {4231233462.0,   737671571.0,  1341073707.0,  3109125075.0,  1612540938.0,  2786294458.0},
-  {1934659937.0,  3107917280.0,    61599963.0,   304843641.0,  4133676679.0,   538760056.0},
-  { 918685998.0,   558607761.0,   532548250.0,  3682880319.0,   549645075.0,  3424647335.0},
-  { 158364478.0,  4097347321.0,  3792482072.0,   796572349.0,  2933869058.0,  1608239950.0},
-  {3053324468.0,  2213129251.0,    72902028.0,  1611038901.0,   185451854.0,  2020660204.0},
-  { 517551148.0,  3271394798.0,  3679951366.0,  4245855450.0,  1552332960.0,  2454080035.0},
-  {1656213231.0,  1085003122.0,  2981691950.0,   516199626.0,  2094154376.0,  1680358458.0},
-  {2735121941.0,  2036992641.0,  1345176426.0,  3141191410.0,  2511007730.0,  4103317394.0},
-  {1639273355.0,  4242624367.0,  2117603062.0,  3702964954.0,  1439458548.0,  1919160214.0},
-  {2259390623.0,  2791199540.0,  4081242750.0,  3725788047.0,  3403815710.0,  2684508392.0},
-  {1030315213.0,  3864828427.0,  2925920484.0,  1438211183.0,  2213997695.0,    71470481.0},
-  {1975704301.0,   406378668.0,  2900339071.0,  2780468962.0,  1970813623.0,  3965368189.0},
-  {2534173763.0,   199992128.0,   747328300.0,  3605804279.0,  1137520138.0,   973076932.0},
-  {1026229320.0,  3067637918.0,  2294373256.0,    80406879.0,  2871530472.0,   511375339.0},
-  { 277175476.0,  3055515457.0,  2398565374.0,  3922615268.0,   482285501.0,  3570032915.0},
-  {3650429628.0,  1646408617.0,  4079150332.0,  2754723259.0,   159298362.0,  2461265582.0},
-  {3365038656.0,  1361055879.0,   128747275.0,   793417490.0,  3916631443.0,   361403774.0},
-  {1888436421.0,  1724320400.0,  3714797563.0,  1277857741.0,  3365940910.0,  3342460177.0},
-  {1004430932.0,  2158975477.0,  2616992941.0,  1767899838.0,  4203319293.0,  3262663340.0},
-  { 708288403.0,   258694814.0,  2356087653.0,  3685420103.0,  1780499565.0,  2829274271.0},
-  { 460535828.0,  2577937287.0,  1219387480.0,   745825903.0,   295703573.0,   329528455.0},
-  { 322897933.0,  2356838916.0,  2712199022.0,  2869690061.0,  2458670286.0,   776846414.0},
-  {4208610304.0,  4087118866.0,  2229076407.0,  3670142600.0,  1606388095.0,  2605594612.0},
-  {3375000571.0,  3879505473.0,  1679679267.0,    15662360.0,  1864618759.0,  2978966568.0},
-  {2986369614.0,  1468956988.0,  1782555450.0,  2320540456.0,  3631671521.0,  3270636112.0},
-  { 813661056.0,   874183637.0,  2280455261.0,   336587406.0,  3888887901.0,  3404487619.0},
-  {3412738677.0,  1401881216.0,   610902002.0,  2354806465.0,  2083891835.0,    99320543.0},
-  {3487081999.0,   862280777.0,  2336861329.0,  1148518099.0,  3169970991.0,  1890795001.0},
-  {1433980437.0,   756109487.0,  2026667673.0,  1068056336.0,  1778744137.0,  2761465093.0},
-  {1707702032.0,  2489263879.0,  2682296117.0,  3728072271.0,  3047144317.0,   800062815.0},
-  {2273562698.0,  1241727897.0,  2351640497.0,  3358419937.0,  2126122394.0,  2528160569.0},
-  {3194940496.0,  1371199995.0,  2702407367.0,  3346332277.0,   462092364.0,  3177723462.0},
-  {4168651513.0,  1812062269.0,  4075120195.0,   622474860.0,  1312548147.0,  3871830222.0},
-  {1213324345.0,  1767056513.0,  2733747136.0,  3416664955.0,  2081172034.0,  1853790233.0},
-  {2501930020.0,  3803190174.0,  1515545479.0,  2739153993.0,  4053427911.0,  3430232951.0},
-  {2116457790.0,   138388806.0,   436173532.0,  4146745494.0,  2373071892.0,  2876418921.0},
-  {2884762260.0,  1449827330.0,  2773164568.0,  1263300670.0,  3332919843.0,   450560240.0},
-  {3314235498.0,  1242253562.0,  2215123419.0,  1212134725.0,  2831409702.0,  2367167225.0},
-  {2697733582.0,  1825120570.0,  1911415245.0,   674187430.0,   558576779.0,  3308591452.0},
-  {3769989996.0,  1902629198.0,  2945754597.0,  2819885808.0,  1694089167.0,  2033343353.0},
-  {2964119996.0,  3708331848.0,  1871405001.0,  1236455639.0,   478216696.0,  2487128939.0},
-  {2559645280.0,  4169882900.0,  2887076053.0,  1473225988.0,  1966892138.0,   513250503.0},
-  { 269913925.0,  2131079829.0,   994669508.0,  3685351485.0,  3227748531.0,  3664910063.0},
-  {2696000729.0,  3298361856.0,  2430263077.0,  3056985496.0,  2924552731.0,  3859509111.0},
-  {3896996924.0,   362550737.0,  1431798678.0,  1575615422.0,  1807027356.0,  1265242527.0},
-  {4128182639.0,  1514228954.0,  2297208376.0,  3710498006.0,   968504605.0,  4233508883.0},
-  {2898263688.0,  2045180957.0,  3735541756.0,  3432111063.0,  2598827661.0,  1678218023.0},
-  {2684678563.0,  3193770675.0,  2446945151.0,  2320590707.0,  2244185568.0,  2982544670.0},
-  {3978873794.0,  4133112265.0,   865881065.0,  1083241442.0,  4093184611.0,   552943935.0},
-  {3819757984.0,  2109249367.0,  1714381421.0,  1463808501.0,  2982010674.0,   446538223.0},
-  {3925918850.0,  4204838229.0,  2992705423.0,  3189304904.0,  2030894315.0,  2135799781.0},
-  { 989184436.0,   607521123.0,  3500211072.0,  1589177673.0,  1986861897.0,  1327308911.0},
-  {1085088512.0,  2331951267.0,  4276616849.0,   812597839.0,  1052853298.0,   894355647.0},
-  {3884464856.0,  1808356166.0,  2445701647.0,  1955139878.0,  3524931434.0,   705181118.0},
-  {3816828705.0,  2706835090.0,   762652929.0,  4125805640.0,  3595524574.0,  1396313621.0},
-  {4097093995.0,   426206961.0,    37580474.0,  2896009211.0,  3053526556.0,  3661755727.0},
-  { 749782163.0,  3786515642.0,  3414343756.0,  1432823807.0,  1449366270.0,   693337390.0},
-  {1133964543.0,  3151957080.0,   928700014.0,   318442261.0,  1572064680.0,  2158979277.0},
-  {4005151903.0,  1758536471.0,  3993927085.0,  1424892676.0,  2689325040.0,  3294617688.0},
-  {2363996131.0,  3813972006.0,  2858482306.0,  3584346686.0,  2658058836.0,  2476814065.0},
-  {2055648691.0,  2915146313.0,  2820740041.0,  3451070676.0,  3972768731.0,   281259476.0},
-  { 186033317.0,  2804859037.0,  1150241283.0,  3820029881.0,  2687136378.0,   330044259.0},
-  {2634980092.0,  2070531002.0,  1440111046.0,  3332244570.0,  3720390334.0,  1411374480.0},
-  {1225154078.0,  3191309983.0,  3814834196.0,  3198706332.0,  2613199328.0,  2471579856.0},
-  { 484913712.0,  3638155440.0,   185312631.0,   360105182.0,  1094864729.0,  1247816530.0},
-  { 957408000.0,  1498218897.0,  3164875404.0,  4036524934.0,  1025319020.0,  3339141284.0},
-  {4071755358.0,   691191778.0,  1325603348.0,  2901994035.0,  2316798104.0,   822787110.0},
-  {3697637408.0,   107214375.0,  3383215531.0,   489230043.0,  4293322066.0,  2842585166.0},
-  { 449007646.0,  3385649282.0,  2926971497.0,  3374370107.0,   515062067.0,  2909907227.0},
-  {3647317879.0,  2606708521.0,   374074459.0,  4186352954.0,   455692748.0,  3383614020.0},
-  {2733014285.0,  1133352121.0,   872956269.0,      517888.0,  3012050045.0,  3147154236.0},
-  {4057122541.0,  2826616847.0,  2138524164.0,  3484577353.0,  4221365093.0,  4255089437.0},
-  {2363209579.0,   178997824.0,  1175600400.0,  4234536982.0,  1530583884.0,  3834980278.0},
-  { 911566527.0,  2265050528.0,   360940122.0,    94364803.0,  4238189245.0,  3705892586.0},
-  {  84726215.0,  1876818056.0,  2317480582.0,   440059019.0,   530094171.0,  2079739190.0},
-  {3728965375.0,  3702085651.0,  3618165840.0,  3153109718.0,   834681387.0,   603085288.0},
-  {2426557792.0,   388843448.0,  3204650930.0,   539589124.0,  1037634351.0,  1662785093.0},
-  {1660455377.0,  3869220275.0,  3480033499.0,  3553036165.0,  3859008454.0,  3256146207.0},
-  {2776834262.0,  3795821633.0,  4056482084.0,   785675899.0,  2969180198.0,  1936879271.0},
-  {3595338107.0,   348370316.0,  2224036726.0,   131662088.0,  3138442654.0,  2907274497.0},
-  { 498091237.0,   447257923.0,  1818344923.0,  1027828659.0,  1808586276.0,  3527018567.0},
-  {1605406473.0,  3392157559.0,  2923107624.0,  2894491158.0,  1439724301.0,  1546459118.0},
-  {3854724634.0,  4184175340.0,  3426652813.0,  1109486818.0,   338341268.0,   128817588.0},
-  { 904532305.0,  2357871799.0,  1291424706.0,   359432611.0,  4158908180.0,  1817694233.0},
-  {  26869061.0,  1025726185.0,   891872551.0,   821883511.0,    20061639.0,  2112313115.0},
-  {3796671772.0,  1292628612.0,  3644135388.0,  3306856189.0,  2005829616.0,  1293242633.0},
-  {2828008068.0,  4178582652.0,   750797681.0,  3285465394.0,   277306035.0,   222631790.0},
-  {2243729222.0,   602427229.0,   793221973.0,  1121676013.0,  2797337273.0,  2464012577.0},
-  {1159879322.0,   412785104.0,   404650358.0,  2273080879.0,  3285605750.0,  1830508785.0},
-  {3724837424.0,  4128116989.0,  4258722286.0,  3741389435.0,  2964566352.0,  3949403001.0},
-  {3041315325.0,   958762525.0,   961355645.0,  4006967028.0,  3651719584.0,  3259306864.0},
-  {1910694399.0,  1145727368.0,   917727995.0,  3812357914.0,   654607377.0,  1040574343.0},
-  {1408952308.0,  1348170308.0,  2397438522.0,    34378278.0,    44123321.0,  1320396828.0},
-  {3860152248.0,  4028531838.0,  1879369668.0,  2561382215.0,   940806014.0,  4046819377.0},
-  {2449364055.0,  4097372006.0,  1855116123.0,  2251930328.0,  4152843664.0,  3931098807.0},
-  {3590578844.0,   276712510.0,  3657235631.0,  3001761342.0,  3363205859.0,  1876614152.0},
-  { 342232797.0,  1691662567.0,   584332404.0,    51909063.0,  3296052152.0,  2248051289.0},
-  {3452536692.0,  4276089863.0,  1990124566.0,  1621812229.0,  2731225550.0,  1913718061.0},
-  { 441813570.0,  1304997226.0,  2842109741.0,  1493655403.0,  1023889844.0,  3821833045.0},
-  {2505129941.0,  2117146848.0,   918139780.0,  3682773967.0,  3476749811.0,   925996505.0},
-  {3200016367.0,  2312816131.0,  2812144728.0,  2773243526.0,  1265166767.0,  3924467068.0},
-  {3416597855.0,  1983755611.0,  2974713071.0,   162709491.0,  2208356495.0,  2288390649.0},
-  {3411762819.0,   361072914.0,  3921493139.0,  3943924572.0,  3199939947.0,   136213545.0},
-  {1850924144.0,  1275973009.0,  1923880407.0,  3539662790.0,  4029628361.0,  1572874308.0},
-  {1508754668.0,  2001789716.0,  2875294401.0,  2189133332.0,  2153625226.0,  4271836658.0},
-  {  94958297.0,  2615806780.0,  1140008893.0,  1558143137.0,    96392993.0,  4179784569.0},
-  {4253378503.0,  2751133971.0,  2615416638.0,  1428039769.0,  3443912578.0,   781832818.0},
-  {2735657170.0,  1141307186.0,   346361612.0,  1821003265.0,  3697635276.0,  2247049171.0},
-  {2911851361.0,  1519406610.0,   291689915.0,  3524594873.0,  2441691706.0,  1534810970.0},
-  {3540445537.0,  2950878346.0,  3920128082.0,  1019801225.0,  3013814945.0,  3965260578.0},
-  {1541350066.0,  3890441574.0,  1832555512.0,  1992020279.0,  1647859255.0,  2078744739.0},
-  {2831212151.0,  1688154572.0,   440601201.0,  2003639553.0,   511547945.0,  3226408489.0},
-  {2378008770.0,   931952251.0,  2898611947.0,   866466197.0,   744262759.0,  1390397369.0},
-  { 975575860.0,  3526808631.0,  2947268392.0,  2486714877.0,   218290773.0,   399570860.0},
-  {2523917057.0,  1465308053.0,    27796926.0,   807433401.0,  3594790482.0,  1125808775.0},
-  {  31341214.0,   596018039.0,  3859746441.0,   231911074.0,  3538983546.0,  3235212842.0},
-  {4232219373.0,  3287332818.0,  3084008422.0,  2785164632.0,   393266110.0,  1022353130.0},
-  { 728457403.0,  1997816423.0,   112400352.0,  1283481944.0,  1878619068.0,  1840525942.0},
-  {3377573154.0,  1681281911.0,  2001262943.0,   163032401.0,    68381091.0,  2522930394.0},
-  {3397124022.0,  3732203657.0,  4205235468.0,  1564549768.0,  2064276429.0,  3742024587.0},
-  {4250828149.0,   419329838.0,  1819202049.0,  4079370027.0,  1602390364.0,   991179654.0},
-  {1036587149.0,   406495786.0,  1548166304.0,  1079319708.0,  1565547525.0,  3735347967.0},
-  {3243543702.0,  1466094482.0,  3916504266.0,  2784035754.0,    91379903.0,  3472851907.0},
-  {4230763681.0,  2974652924.0,  1931830401.0,  1705994150.0,  1144685909.0,  3033738443.0},
-  {3229741194.0,   177261655.0,  4054858032.0,  2215035858.0,  3522155550.0,   413005615.0},
-  {4264139971.0,  4013079830.0,  1819577402.0,  3381720858.0,  3437681088.0,  2837179484.0},
-  {3621978521.0,   505736933.0,  2348315869.0,  1014886972.0,  1448373423.0,   948553084.0},
-  {1718127349.0,  3848847154.0,   855340325.0,  1837745982.0,   428898842.0,  2489677289.0},
-  {1291745390.0,  1636459939.0,  2380136413.0,  4201432142.0,   738571556.0,  1206889494.0},
-  { 535123466.0,  3066550718.0,  3371231453.0,  2846524389.0,  3952760234.0,  2878661534.0},
-  {2269252436.0,    43471587.0,   156726593.0,   177546226.0,  2162686062.0,  1901815490.0},
-  {1397874981.0,  1071597459.0,  4156592242.0,  1050216905.0,  4074816101.0,  2389859627.0},
-  { 967695260.0,  3124290922.0,  2230479164.0,  2777188263.0,  3404683898.0,  3339027559.0},
-  {3635115446.0,  1535443016.0,  1653050029.0,   974715316.0,  2398624152.0,   584785723.0},
-  {4192817174.0,  2393311744.0,  1824490277.0,    48643501.0,  3431827885.0,  1609752375.0},
-  {2206467686.0,  3648562098.0,   362499111.0,  4016251705.0,   551316992.0,  1689559967.0},
-  {2477185335.0,   477711382.0,  3783294408.0,  3549088364.0,  2529422492.0,   470713123.0},
-  { 553089626.0,  3953732244.0,   961916577.0,  3781083231.0,  1683271724.0,  3124136429.0},
-  {2965278217.0,   404490375.0,  4243568010.0,   448151163.0,  2746146511.0,  1623011534.0},
-  { 101737195.0,  2532040055.0,  2826385794.0,  4087129299.0,  1963423528.0,  4243979356.0},
-  {3826384581.0,  3272620320.0,  3964782164.0,  3661459700.0,  3493209679.0,  2762610534.0},
-  {2600978937.0,  3996567446.0,  2271353993.0,  2211713454.0,  3923759672.0,   610580404.0},
-  {2088482125.0,  3669696416.0,   479939773.0,  1878113435.0,   755581020.0,   259907757.0},
-  {1915658897.0,  2630605647.0,  2860978246.0,  1573669786.0,  1426622002.0,  1976148696.0},
-  {1335338916.0,  3757783423.0,  1387004366.0,  3766883443.0,   900796262.0,  1028050076.0},
-  { 462946740.0,   155812248.0,  3614806524.0,  3204224297.0,  2799625609.0,   378328708.0},
-  {3398508964.0,  1374812042.0,  1356006356.0,  3009277608.0,  2387928921.0,  2031588359.0},
-  { 945534385.0,  2671167066.0,  1063496667.0,  2288788933.0,  3104837704.0,  2806777987.0},
-  {4216746801.0,  2276977540.0,   117998523.0,   415678811.0,  2716371330.0,  3439036104.0},
-  {1728482024.0,  2586502297.0,  1309556583.0,  2942087879.0,   654838127.0,  4223311556.0},
-  {4106989924.0,  1987485739.0,  2126198987.0,  1460510598.0,  1395936503.0,  3004250690.0},
-  {1478007872.0,   312486217.0,   505792086.0,  4012625176.0,  3666988937.0,   728097710.0},
-  {3861757610.0,  1794114816.0,  2629423017.0,  3089047891.0,   453062297.0,  4146177371.0},
-  { 888301904.0,   133537436.0,   122831795.0,   190757035.0,   581500510.0,  1832147504.0},
-  {1387292785.0,  3435191452.0,  3947157341.0,  1716698900.0,  4243147629.0,   714532657.0},
-  {2522507067.0,   593721498.0,  2372529003.0,  3910076160.0,  2510234787.0,   423908131.0},
-  { 502932847.0,  3904991381.0,  3174185712.0,   809475384.0,  2924392840.0,  2416594312.0},
-  { 976175868.0,   475378390.0,   805182100.0,  2863036491.0,  3709677251.0,  3979384536.0},
-  {3327552926.0,   102964965.0,  3251417135.0,  3850191792.0,   297301610.0,  4033276557.0},
-  { 947798907.0,  1636448395.0,  3523653088.0,  2699625175.0,  3111204531.0,  1021135843.0},
-  { 449673886.0,  3541064959.0,  2603553376.0,   453678815.0,  2856528228.0,   557830691.0},
-  { 186653061.0,   920059950.0,   700839132.0,  3602607297.0,  1436684537.0,  3500340982.0},
-  {3156453070.0,  1490104277.0,  2246179536.0,  1586070882.0,  3983158916.0,  2263123246.0},
-  {3275855444.0,  1802543460.0,   119608812.0,  4246008126.0,  2798160804.0,  4046991438.0},
-  {2862319394.0,  1780569940.0,  1386133614.0,  4255928419.0,  3175839033.0,  1353134079.0},
-  { 537619211.0,  1387352239.0,   956301248.0,  3906884464.0,   861434973.0,  2910683793.0},
-  { 531319315.0,  1696646047.0,  1365955107.0,  1611965444.0,  3326319492.0,   320339877.0},
-  {3011995079.0,  2286602024.0,  1385431266.0,  3189773012.0,  3885261709.0,  3185747548.0},
-  {2024729533.0,  1654066019.0,  1253571424.0,   747573829.0,  3250757101.0,  4163730862.0},
-  {2505295265.0,  3261726829.0,  2648633596.0,  2229021401.0,  2618580745.0,  1554802773.0},
-  {4166126190.0,  3017878697.0,  2827467858.0,  3396161753.0,   999031779.0,  3330906320.0},
-  {2465149306.0,  1490100457.0,  2583700328.0,  2437792089.0,  3948051169.0,  1443282816.0},
-  {3137898678.0,   678542066.0,  3494845305.0,  2139062391.0,   332974028.0,  3928987431.0},
-  {3679642121.0,   740377199.0,  3061732145.0,   996415665.0,  4028983350.0,  1815932003.0},
-  {1297895046.0,  2940988044.0,  1052467737.0,   728020330.0,  3619692921.0,  1717510000.0},
-  {  12066934.0,  3516165826.0,  4261506649.0,  2996224757.0,  1378250083.0,  2244440490.0},
-  { 917879470.0,   221336436.0,   874881837.0,  3407591273.0,  2138706117.0,   654505740.0},
-  {3309838094.0,  2623317696.0,  4073728910.0,  2934925164.0,  3968294022.0,  4248920442.0},
-  {1853594840.0,  1770978727.0,  1311210349.0,  2156268166.0,  1800878532.0,  1073900127.0},
-  {2950325834.0,   599297335.0,  2550788124.0,  3899681582.0,    16160995.0,  2018578262.0},
-  {1975817261.0,  2649295605.0,  3624709784.0,   254530563.0,  4161172623.0,  3151065905.0},
-  {3697810527.0,  2191244108.0,  1611161648.0,   355572435.0,   792082409.0,   345765507.0},
-  {  87017756.0,  1563147086.0,  4162632320.0,  3738562237.0,  2201741261.0,  1280130571.0},
-  {  40808453.0,  2784288696.0,  3919117705.0,  1729306869.0,  4056076127.0,  3677152498.0},
-  {2397808990.0,  1789454852.0,  3683729364.0,    80373545.0,  1530160882.0,  1043072915.0},
-  {3592451075.0,  1073916364.0,  3265206869.0,   371187122.0,  2240230066.0,  3915151252.0},
-  {2675059713.0,  2594556770.0,  4022078332.0,   657293958.0,  1175033679.0,   337476815.0},
-  {2356922481.0,  2080047382.0,  3943022036.0,  3601911869.0,  2196046331.0,  2552464471.0},
-  {1208720469.0,   743734436.0,  3079142944.0,  2389028024.0,  1724609865.0,  3492108608.0},
-  { 814380667.0,   241438490.0,   793814836.0,   285001388.0,  2297155619.0,    20588790.0},
-  {1382711336.0,   337790781.0,  3680805176.0,  2831122002.0,  3232772994.0,  2298231422.0},
-  {2149543367.0,  1737984235.0,  3725769504.0,   288770808.0,  2210374573.0,  4169812521.0},
-  {  63956286.0,  1719678591.0,  1859184109.0,   238171106.0,  1064990508.0,  1271687077.0},
-  {1936294061.0,   445277179.0,  2825144182.0,  1208642029.0,   766737565.0,  4285704702.0},
-  {3024022208.0,  3287655907.0,  3339537522.0,  2911750988.0,  4000921306.0,  1789048144.0},
-  {1254361510.0,    84402342.0,   646460322.0,  1140631935.0,  3787819415.0,  1815313263.0},
-  {1549593747.0,   867899709.0,  2321841567.0,   148755662.0,   618671863.0,  1144028693.0},
-  { 324344907.0,  1195051192.0,  3749285034.0,  1686139218.0,  3992506688.0,  2688700109.0},
-  {2048590906.0,  1094193152.0,  3086361424.0,  2725014053.0,  3694760662.0,  2603684491.0},
-  {3521221456.0,  3743862731.0,  3257171663.0,  3050593492.0,  3125811669.0,  1159137077.0},
-  {2200077521.0,   389979362.0,  3086292265.0,  1120143034.0,  3315000048.0,  3341686274.0},
-  {3950912118.0,  4039855435.0,  2864373085.0,  2486136310.0,   789216180.0,  1367260203.0},
-  {3049596442.0,  3098511727.0,  2625747877.0,  3140900615.0,   102292423.0,   752148690.0},
-  {4285748352.0,  2484707840.0,  1776505762.0,  3052596479.0,  3980411751.0,  2441998651.0},
-  {2236045501.0,  1639632774.0,  3214962173.0,    64219444.0,  1421128618.0,  3739691576.0},
-  {2596395686.0,  3547183971.0,  1029849252.0,   670474290.0,   585244853.0,  1446332352.0},
-  { 335885360.0,  3920082358.0,  3356755647.0,   712095589.0,  4177899163.0,  2257338133.0},
-  {2810493886.0,   889321640.0,  3910417866.0,  1508237902.0,   634518118.0,  3055173420.0},
-  {2045043622.0,  3736990058.0,  2158192863.0,  3952353473.0,  3553708899.0,  3379872074.0},
-  { 781480035.0,  2997770372.0,  1762739348.0,  3294364558.0,  1499711014.0,  2393596217.0},
-  {2162337614.0,  1553487400.0,  2425889343.0,  2111533974.0,  1628776743.0,  3243575762.0},
-  {1499683884.0,  1219220354.0,   488880005.0,  2062737681.0,  3025091369.0,  3672313641.0},
-  {3707089928.0,  1595563531.0,  3479544452.0,  2393657175.0,  1288632280.0,   347566568.0},
-  {2908302976.0,  2442597328.0,   486062172.0,    17589059.0,  3372962641.0,  2870248404.0},
-  {1540129081.0,   770281617.0,   439599078.0,   896474585.0,  2632690139.0,  2214052503.0},
-  {2166606424.0,  3084015078.0,  1061004492.0,   226212913.0,  3569762952.0,  3814270665.0},
-  {1379417168.0,  1492133338.0,  4265798583.0,  3670151311.0,  1672592807.0,   321510359.0},
-  { 161604464.0,  3115150332.0,  3952352473.0,  3728184485.0,  2572004512.0,  3363831992.0},
-  {1491616794.0,   911081957.0,   755760932.0,  1855675342.0,  1588942717.0,  4131531101.0},
-  {4102378296.0,  2660753719.0,   252502431.0,    49687246.0,  2178361439.0,  2133425373.0},
-  {3146288312.0,  4256699939.0,  2614057332.0,  2547601914.0,  1247669635.0,   749809430.0},
-  {2956182229.0,  3136676260.0,  1538589622.0,  3812187768.0,  3697383382.0,   256240926.0},
-  {2520426335.0,   401343353.0,  3645482247.0,  2634187933.0,  1328037590.0,  1666888033.0},
-  {2996682864.0,  1307241901.0,  1213328240.0,  2666691768.0,  1114751779.0,  3535445478.0},
-  {4011234088.0,  2018628437.0,  3483032037.0,   459059945.0,  3891759239.0,  4001036424.0},
-  {3296129398.0,   315378338.0,   352085083.0,   194556621.0,  4262806357.0,  2337628036.0},
-  { 534885663.0,  3737141071.0,  4134838065.0,  1466088594.0,  2691501404.0,  2079950780.0},
-  {1111432936.0,  2901299626.0,   620345423.0,  3270056423.0,  1491729556.0,  2708119013.0},
-  {1793499041.0,  3173162473.0,  2489544443.0,  3479855232.0,   340550903.0,  1767446591.0},
-  {3145400323.0,  4198461952.0,  1388015121.0,  1896156947.0,  3181920790.0,  2517803452.0},
-  {1318953964.0,   630525703.0,  2991295035.0,  1080577881.0,   611545143.0,  3428817435.0},
-  { 486978079.0,  1968966795.0,   441210290.0,  1751885956.0,  2862641791.0,  2436312653.0},
-  { 500841588.0,  3743805046.0,  4069655061.0,  3363925486.0,  1317073603.0,  3926422267.0},
-  {3975199885.0,  2168151291.0,   127770059.0,  1089391077.0,  2445007914.0,   373961957.0},
-  {2071546119.0,  1574571629.0,  1453895941.0,  1459976925.0,  1778451995.0,  3802717766.0},
-  { 629583334.0,  3038956471.0,  2758172020.0,  1747626643.0,   200658100.0,  2861798143.0},
-  { 684882048.0,  1806704447.0,  2919726713.0,  2284106660.0,   112003822.0,   961628042.0},
-  { 824301090.0,  1215989142.0,  3641975788.0,  2575505648.0,   716527491.0,  3464209593.0},
-  {1669263226.0,  1013288899.0,  1665032724.0,  1931975050.0,   316793575.0,  2071877979.0},
-  { 512454966.0,  3439878480.0,  1174270010.0,  1041851718.0,  1001880559.0,  3904002035.0},
-  {1004358868.0,  3150529223.0,  2381259996.0,  2728247485.0,  3934603064.0,   121039920.0},
-  { 153185525.0,   584342047.0,  1173366005.0,  2033553098.0,  2801861514.0,  2235599958.0},
-  {1075115360.0,   217576968.0,  2894796683.0,  2752606536.0,  1740641241.0,  4108817575.0},
-  {3778343922.0,   551686028.0,  2799035265.0,  3768737811.0,  1271015277.0,  2945338557.0},
-  {3920149627.0,  1119630186.0,  1283646408.0,   798323270.0,  4262312684.0,  1669116774.0},
-  {3899214538.0,  2724845151.0,  1319573299.0,  3666457176.0,  3781859606.0,  3288904570.0},
-  {1350451953.0,  3190501201.0,  4068111780.0,  4206987977.0,   905151171.0,  3522094282.0},
-  { 493721076.0,  1534467688.0,  2792281045.0,   968579745.0,    77123507.0,  2905878480.0},
-  {2960453611.0,  3194011519.0,  1092865246.0,   559679513.0,  2984633618.0,  3132835485.0},
-  {1933832211.0,  2239750454.0,   398125870.0,  2022742257.0,  2485324162.0,   979795936.0},
-  { 470980900.0,  1028686450.0,  2096113752.0,  3458030194.0,   850226556.0,  3824936309.0},
-  {   3316524.0,    65460415.0,  1902734652.0,   664594782.0,  2095623474.0,   401607736.0},
-  {2714102893.0,  1845804706.0,  3331169316.0,  2261951148.0,   113343472.0,  1538427995.0},
-  { 721772069.0,  2192193639.0,   166503817.0,  1111177042.0,    65995617.0,  1233772612.0},
-  { 729586223.0,    71575948.0,    90148578.0,   523809794.0,  1583475660.0,  3515643528.0},
-  {1384004592.0,  2906909807.0,  1438056001.0,   429620992.0,   961969085.0,  3014517166.0},
-  {4043161032.0,  2098947503.0,  2451931160.0,  2799516019.0,   545094994.0,  1238475173.0},
-  {2593170915.0,  3866748457.0,  3528819173.0,  2380965772.0,   447337767.0,  1236467702.0},
-  {2473516818.0,  2619697899.0,   315994078.0,   156938565.0,  4246199755.0,   152579872.0},
-  { 401788343.0,  3536587528.0,  1709562160.0,  1858064085.0,   717524842.0,   523040478.0},
-  { 414617884.0,  3737526827.0,   408254916.0,  2808605826.0,  1975849995.0,  2179067059.0},
-  {2095485393.0,  1830079456.0,  1714854902.0,  1198572305.0,  2065506470.0,  2896381637.0},
-  {3008308289.0,  4244065196.0,  1499136887.0,  2596972184.0,  1038487602.0,  3493553985.0},
-  {2711873059.0,    31754862.0,  3044765698.0,  1641376713.0,  2846285485.0,   199079471.0},
-  {3347452930.0,  1152559784.0,  3058541953.0,  3632431337.0,   193860811.0,   867169529.0},
-  {   2514716.0,  1603596868.0,  3687154394.0,  2378254013.0,  2495146814.0,  3450135769.0},
-  { 580620409.0,  3262088523.0,  2315358022.0,   620767116.0,  3484879636.0,  3038877728.0},
-  {1637220177.0,  2267811949.0,  2446723286.0,   525239486.0,   433535098.0,  3636315977.0},
-  {1262145389.0,  1263200131.0,  1488200943.0,  3684665370.0,  1529293863.0,  2897729843.0},
-  { 695288290.0,   347390974.0,   207448233.0,  3616230342.0,  3662353418.0,  3739329119.0},
-  {1251948214.0,  2896371727.0,  3580082212.0,   318242210.0,   408085238.0,  4214339593.0},
-  {1216714010.0,   710116972.0,  3909812282.0,  1528185639.0,  3339776189.0,  2193798391.0},
-  {2945826062.0,  3066761003.0,  2286581711.0,   168083391.0,  1087905849.0,  2009302366.0},
-  {3894267921.0,  1955545254.0,   208422919.0,  3314228237.0,   569446156.0,  2796870112.0},
-  {3329060452.0,  1219644572.0,   786571572.0,   650737739.0,   731732695.0,   920639912.0},
-  {1321932506.0,   243405230.0,   938970359.0,   605389214.0,  2228805898.0,  1976456001.0},
-  { 141913568.0,    31715175.0,  3963354279.0,  2584851137.0,  3452854108.0,  2571766814.0},
-  {2108194814.0,   981620259.0,  1002580539.0,  1852260133.0,  2524895461.0,  2942139251.0},
-  {3909817146.0,  3731127270.0,  2431013271.0,   776832182.0,   960479679.0,  1360545272.0},
-  {2214150273.0,   401508744.0,    96063330.0,  2937929988.0,  4129694238.0,   471725068.0},
-  {1886305074.0,  1441120254.0,  2725011964.0,  2582448145.0,  3177579598.0,  3341799743.0},
-  {3512026389.0,  1555262410.0,  2916999630.0,  3097648856.0,  2685535254.0,  1893446426.0},
-  { 513314131.0,  2713607649.0,  2689891897.0,  1318996109.0,   590421650.0,  1287397222.0},
-  {3897943754.0,  3675755435.0,  1942401355.0,  1080585703.0,  2637766710.0,  1706649213.0},
-  {  22684191.0,  4257774238.0,  3498989462.0,  3752778609.0,  2915400447.0,  1977452745.0},
-  { 107718779.0,   793503314.0,  1908451988.0,  4251220814.0,  2453488390.0,  1342886255.0},
-  {3710685419.0,   619495791.0,  3206459328.0,  1910304858.0,   362282143.0,  1006692046.0},
-  {3827707712.0,  1540824410.0,  2705402824.0,  1271177377.0,   372485776.0,  3934353076.0},
-  {2168985661.0,  3528306572.0,  2376905617.0,  4000597020.0,  2307497304.0,  1764852727.0},
-  {3202492970.0,    66396600.0,  3314350288.0,   780262687.0,   799183757.0,  3024869271.0},
-  { 825689015.0,  4100660425.0,  3581993460.0,  2068548581.0,   210667888.0,  3711016365.0},
-  {3098635114.0,  2073875797.0,  1836421220.0,  3741154833.0,  3266492875.0,  1210908211.0},
-  {1653512093.0,  2489597674.0,  3371265901.0,  2238456592.0,  3611705206.0,  3624442163.0},
-  {1518056403.0,  1450655956.0,  1736269339.0,  2699430647.0,  1753878088.0,   634253406.0},
-  {1508654392.0,   913107257.0,  2661320808.0,  1332700499.0,   314989698.0,    12913531.0},
-  {1262873090.0,  3516984661.0,  3532844859.0,   973847157.0,  1740818180.0,  3571192381.0},
-  {1277925485.0,  4011973896.0,  1581050153.0,   170296751.0,  3813296175.0,  1838798248.0},
-  {3977298556.0,  2164808817.0,    89749623.0,  3609480411.0,  4187715199.0,  3330849638.0},
-  {2710051884.0,  3882498290.0,  1589965393.0,  1991741639.0,  1713415149.0,  2581107473.0},
-  {1376542691.0,  2217132879.0,  3049477782.0,  3670503118.0,   358563516.0,  3128311559.0},
-  {3312828013.0,   389957843.0,   158194312.0,  1378673353.0,  1421244074.0,  2343393004.0},
-  {1662455370.0,   621423158.0,  2177717637.0,   414800348.0,   135241467.0,  4146551239.0},
-  {1619578902.0,  1887480454.0,  2917197035.0,  1442793159.0,  1219072549.0,   754604389.0},
-  {3835565423.0,   415273668.0,  2732661245.0,  2387434148.0,  3430215873.0,  2279452198.0},
-  {1642267806.0,  1498906541.0,  2209910616.0,  1129596382.0,    95285990.0,  3545872248.0},
-  { 383106958.0,  2157259976.0,  3550499493.0,  3337967614.0,  1488290232.0,  2477694078.0},
-  { 639694978.0,   877076100.0,  1445601575.0,  1668753210.0,  3404547748.0,  2888120826.0},
-  { 336897013.0,  3210940590.0,  4292011638.0,  2240408604.0,  3301138613.0,  3704686440.0},
-  {1717494406.0,  3043121364.0,    21564582.0,   967912153.0,  1551403915.0,  2710283050.0},
-  {3637726674.0,  1360950424.0,  2715954279.0,  3457089116.0,  3026939670.0,  2765167863.0},
-  {2330656429.0,  4214487622.0,  3094960958.0,  3225469409.0,   269844615.0,  3203126270.0},
-  {3724151919.0,  1107290795.0,   332076984.0,  4191363694.0,   102740519.0,   761984065.0},
-  {2183860828.0,  1314125277.0,  4044457590.0,   323158199.0,  3937789083.0,  1991622054.0},
-  { 244801057.0,   133036315.0,  3704446065.0,  2823117874.0,   991827044.0,    21212258.0},
-  {1887937716.0,  3246956280.0,  2247319682.0,  2642752599.0,   599875059.0,  1211985995.0},
-  {1835846356.0,  2398998836.0,  3093910695.0,  3782263343.0,  1010988844.0,  3004258165.0},
-  {1373711304.0,  1569331033.0,  1414889439.0,  1073157167.0,  3932303671.0,    49741051.0},
-  {1385304058.0,  1538733579.0,  2111574749.0,  2901872490.0,  3051789179.0,  3463411039.0},
-  {  31163406.0,  2108978856.0,  2227078932.0,  1739102921.0,  1240405830.0,  1481327610.0},
-  {2081405138.0,  3293147236.0,  1370427207.0,  3182664967.0,  3772375199.0,   581726603.0},
-  {4232248038.0,   918971934.0,   894275379.0,   526092160.0,  4256923379.0,   722734433.0},
-  {3772217992.0,  2554575941.0,  2255969588.0,  1003523389.0,  4184080516.0,  2152500855.0},
-  {4146203381.0,  2171585585.0,  4025271035.0,  1791775568.0,  1049573651.0,  2334465171.0},
-  {2513738140.0,  3768503833.0,  1396769675.0,  1528629686.0,  3134245439.0,  2953722838.0},
-  {1598044207.0,  2321320611.0,  4015624404.0,  1965270946.0,  3263424727.0,  2398149864.0},
-  {1584470675.0,  3922898233.0,  2616541549.0,  3984027718.0,  1826204881.0,  3711117212.0},
-  {4183376577.0,   874954265.0,  3311516532.0,  2080602609.0,   405472567.0,  2985614634.0},
-  {3636819478.0,  3825249499.0,  3694817886.0,  3752578639.0,  1923446716.0,  1487900860.0},
-  { 601095252.0,   883322038.0,   621241263.0,  3113697366.0,   612621288.0,  1225149418.0},
-  {1494762343.0,   503025891.0,  1235544777.0,  1519348578.0,  2362177588.0,  1279967511.0},
-  {1757441380.0,  4259363785.0,  1810727421.0,  3336919464.0,  3183112008.0,  2028498656.0},
-  {3242132776.0,    31659375.0,  3623758887.0,  2591858000.0,  3919929000.0,  2818963668.0},
-  {1810203432.0,  2072380222.0,  3351759752.0,  3987517782.0,   972654617.0,  2258439963.0},
-  {1752174374.0,    62115004.0,  1391561355.0,  3704708536.0,  1890832844.0,  2740967181.0},
-  { 840928007.0,  2603402580.0,   142776420.0,  3023335557.0,  3806935061.0,  1298184119.0},
-  {1026122244.0,  1667428630.0,  1898792380.0,  3701936540.0,  4098535381.0,  4080823532.0},
-  {2113071972.0,  1921727260.0,  3453048451.0,  3005441683.0,  3670304990.0,  3939360728.0},
-  { 403187993.0,  3601294107.0,  3953468772.0,  4188431136.0,  2166140877.0,  1562809015.0},
-  {2897225000.0,  2659434033.0,   546927914.0,   310068193.0,  3245314975.0,   241423403.0},
-  {1776827199.0,  2801830444.0,   906507066.0,  2338568459.0,  3761529437.0,   403019575.0},
-  { 506538215.0,   505585672.0,   800299523.0,  3464214312.0,  4225168116.0,  1773431198.0},
-  {3022467629.0,  3320945412.0,  3857135627.0,   204817601.0,   242577937.0,   730228305.0},
-  {1016443744.0,  2553837119.0,   979348569.0,  1081708992.0,    89941506.0,  1343584500.0},
-  {2458785547.0,  1673257994.0,  3509836696.0,  3979740495.0,   820745412.0,   515741421.0},
-  { 880819146.0,  2683912843.0,  1788493078.0,  3299177266.0,  2202032731.0,   886652962.0},
-  { 179423403.0,  3858586850.0,  2095716707.0,  1130473103.0,  2757696008.0,  2264293817.0},
-  {2241476567.0,  3012533332.0,  3482210979.0,  4022093916.0,  3691215483.0,   703108655.0},
-  {2698680125.0,  3607788658.0,  4024443151.0,   197324329.0,   908320984.0,     9637575.0},
-  {1652391064.0,  1693236051.0,  2133921185.0,   756469020.0,  3649052344.0,  2102803739.0},
-  {2769861666.0,  1183162021.0,  2137200107.0,  4060818052.0,  3681765634.0,  1788497091.0},
-  {3919485300.0,  2195866095.0,   623242556.0,  1581853818.0,  1021063221.0,  2126090072.0},
-  {1845298607.0,   562762513.0,  1214571349.0,  2663019890.0,  1062802411.0,  1684751862.0},
-  {3091151126.0,  3059612702.0,   189572408.0,   317583614.0,  1286830519.0,  2377975196.0},
-  {2426072267.0,  2429150735.0,  2987005801.0,  1305135193.0,  2874458080.0,  2932368313.0},
-  {2296903756.0,  1413678284.0,  1077546648.0,  2867406237.0,  2886351401.0,  2035494603.0},
-  { 474997019.0,  1863395020.0,  1718255699.0,  2075267027.0,  2153318913.0,  1195132369.0},
-  { 787924324.0,  3553023922.0,  4148333585.0,  3803752254.0,  1799661547.0,  2515835554.0},
-  {  47801667.0,  3371495773.0,  2368916902.0,  1665879109.0,  1058788387.0,  1841790226.0},
-  {3275220912.0,   942783449.0,   124722708.0,  2040147442.0,  2461568707.0,  1967907783.0},
-  {  13130795.0,  3242893878.0,  3933200205.0,    42204964.0,  4073839779.0,  1807152549.0},
-  {1417792095.0,  2452654471.0,  4054480066.0,  1163240638.0,  2445995195.0,   873838411.0},
-  { 287289610.0,  2271123608.0,  1328182145.0,   759882542.0,  3207116832.0,  3951537667.0},
-  {1974960892.0,   473305060.0,  4055762246.0,  4227234973.0,   295762545.0,  3946894499.0},
-  {3372168245.0,  3193065356.0,  1164977173.0,  3641858464.0,  3274990095.0,  1813334880.0},
-  {2419877520.0,  3961234735.0,  2325815411.0,  3092908291.0,  2545042262.0,  2128421796.0},
-  {3621921691.0,  2198547215.0,  2746820113.0,  2772186283.0,   646528125.0,  2697343539.0},
-  { 784685759.0,   127288424.0,  1084707800.0,  2181610298.0,  1890836160.0,  1533515948.0},
-  {1506502563.0,  2373456806.0,  2711458924.0,    59792104.0,  2981913057.0,  2468360283.0},
-  {2606925886.0,  1332351261.0,  3742090834.0,  2590898672.0,  3267547266.0,  1652079497.0},
-  {1893560427.0,   751523982.0,  3917037392.0,  1377898403.0,  1347070467.0,  3232717128.0},
-  {3180590825.0,   666841499.0,   229653974.0,  1799543961.0,   822113617.0,  3776461412.0},
-  { 700692389.0,   673652446.0,  3874558580.0,  4255395547.0,  3437032090.0,  1705607051.0},
-  {  23350989.0,  2083638685.0,  2525070794.0,  3110811868.0,  1346824016.0,  3003557635.0},
-  {4034483142.0,  1129859679.0,  3649032846.0,   959859066.0,  4146476651.0,  2168218584.0},
-  {3778486668.0,  1587327131.0,   777408207.0,  4149013002.0,  1643071638.0,  3510009761.0},
-  { 100288129.0,  2077817795.0,  2672567575.0,  1779770541.0,   832774645.0,   776063137.0},
-  { 503469560.0,  2163916878.0,  2183834428.0,   800552943.0,  3538160306.0,    13409419.0},
-  {1832819528.0,   679861994.0,  2662674702.0,  1278171634.0,  3309580049.0,  1591667878.0},
-  {1939204083.0,  3960320362.0,     4683402.0,   815500119.0,  3049516851.0,  3371108781.0},
-  {3204419924.0,  3209087378.0,   536313401.0,   151443368.0,   467937885.0,  4210967913.0},
-  {4213420336.0,  3403002228.0,  2611343267.0,  1743137563.0,  3373494091.0,   971328500.0},
-  {2316664722.0,  1180314580.0,  3516943363.0,  2846444439.0,   372011116.0,  3453179206.0},
-  {1445170693.0,  2441232734.0,   842908060.0,  3291107176.0,  3185939957.0,  3062815864.0},
-  {1408821370.0,  1113529933.0,  4150776698.0,   488957071.0,  2838516059.0,  3008470202.0},
-  {1700439398.0,    40022482.0,  3853275673.0,  1026535871.0,   895296720.0,  3249310468.0},
-  {1744096081.0,  2558298090.0,  3208440144.0,   489540888.0,  2520363230.0,  2594668462.0},
-  {3570349540.0,  2338259578.0,  3598343603.0,   256756874.0,  2670489439.0,  3589275180.0},
-  { 531137332.0,  3897408020.0,  3919715755.0,   522877060.0,  2675661061.0,  3879782658.0},
-  { 818812527.0,  1683174959.0,  2490504638.0,  1048725597.0,   229313763.0,  3531136283.0},
-  {2668766602.0,  1897410992.0,   571506343.0,  3542950253.0,  3397341992.0,  2829203096.0},
-  { 499828964.0,  2348865000.0,   906108637.0,  1823772162.0,  4253653415.0,  1955912737.0},
-  {3153735220.0,   543392815.0,  3404600553.0,  3238029055.0,  2969057482.0,  3321888819.0},
-  {1583950706.0,  1097085827.0,  1174360507.0,  2327775975.0,  2512347802.0,  2939593832.0},
-  {1140439468.0,   175802201.0,  3383452482.0,   356794648.0,  2802174057.0,   602875992.0},
-  {1086631341.0,   182040382.0,     3101705.0,  4094433195.0,  3607745754.0,  3153271571.0},
-  { 879030582.0,  1405936797.0,  3311329627.0,   872155782.0,  3546781853.0,   997551017.0},
-  {2866064951.0,  1709867188.0,  4049622143.0,  3944311695.0,  2761718682.0,   133745323.0},
-  {1090887262.0,   337808075.0,  3126827211.0,   593225800.0,  3620991990.0,  3794809644.0},
-  {3897129348.0,  3088192810.0,  3434608979.0,  1631038723.0,  2347939594.0,  3581327226.0},
-  {1574781750.0,  3661477495.0,  3581190014.0,  3894993682.0,  1505431866.0,   786861658.0},
-  {3634362490.0,  1248513296.0,  2355296144.0,  1082889507.0,  2338128289.0,   198923744.0},
-  {1261928675.0,  1313963160.0,  2687438171.0,  2678000386.0,  2908338375.0,  1170087722.0},
-  {3166859281.0,   859678356.0,  4085430575.0,  3230282579.0,  1009173966.0,   810008727.0},
-  {3201395107.0,   578843415.0,   144272155.0,  3731398196.0,  1160157684.0,   404773255.0},
-  { 646970381.0,  3775701017.0,   743877554.0,  2704448470.0,  1242685443.0,  1166773105.0},
-  {1936683389.0,   323629831.0,  4044786184.0,  4265423201.0,  3707675317.0,   490627699.0},
-  { 262340041.0,   375369711.0,  1948731069.0,  4198472276.0,  3324535436.0,  4085535147.0},
-  {3513481219.0,  3703547308.0,  3557076220.0,  3222319617.0,  1108965488.0,  1979499171.0},
-  {1711528033.0,  3950897091.0,  2883535208.0,  2691671402.0,  3109131570.0,  3668124886.0},
-  {3990669342.0,   984794949.0,  4083190814.0,  3824021131.0,  3419141944.0,  3297720658.0},
-  {3654159513.0,  2483157730.0,  1065708071.0,   368558953.0,  3912378933.0,  2408137392.0},
-  {2986902053.0,  2920005363.0,  3949607045.0,    14330110.0,    76392919.0,  1728347173.0},
-  {2782417174.0,  2493037194.0,  2617486432.0,  2394254424.0,   286997950.0,  3586246795.0},
-  {3715767686.0,    95991893.0,   427569812.0,  2514549920.0,  3473484831.0,  3681199854.0},
-  {3090855141.0,  3668005469.0,  2942866261.0,  2524575055.0,  1206093435.0,  2066085719.0},
-  {2968032396.0,  2841813263.0,  3260032500.0,  3555854914.0,  1186106505.0,   793259484.0},
-  {3942365591.0,  4079687209.0,  2351349302.0,  1212933959.0,  3427715809.0,   835369306.0},
-  {1067151172.0,  1529320937.0,  4218646485.0,  2067743015.0,  2579129706.0,  1543175708.0},
-  { 585922414.0,   698728450.0,  1528313590.0,  4178497419.0,    54114205.0,  1674397175.0},
-  {3772075573.0,  2171102792.0,  1296773836.0,  2586992321.0,  3359734477.0,   865993906.0},
-  {1460718331.0,  3060442677.0,   684910726.0,  1562568951.0,  1844760695.0,  3419402406.0},
-  {3237964542.0,  2374420141.0,  2796092295.0,   159934301.0,  3582268468.0,  2817391431.0},
-  {3661658050.0,   352351598.0,   126303991.0,  3797851216.0,  3134119764.0,  3680072785.0},
-  {1484185060.0,  3144093707.0,   574030143.0,  2021399700.0,   290541442.0,  4099298721.0},
-  {1765234914.0,  3808554356.0,  1298334259.0,  3426073643.0,  3254291127.0,  2782652436.0},
-  {4223586441.0,  1381859274.0,  1376454481.0,  2586077394.0,   885377285.0,  3432632602.0},
-  {2991335608.0,   547905044.0,   701128356.0,  2373866866.0,  3243953286.0,  3819241229.0},
-  {2926145961.0,  1329623607.0,  1647784684.0,  1667289285.0,  3401516058.0,  1349141299.0},
-  {4027654707.0,  1561364742.0,  1279298036.0,   786313067.0,  3574718767.0,  3543130189.0},
-  {4066163532.0,  3959219323.0,  2980919482.0,  2502065206.0,  1078006110.0,  1764073795.0},
-  {4193422420.0,  3057204086.0,  2992888584.0,  1291753028.0,   335291260.0,  1804936082.0},
-  {  61260987.0,   116587105.0,  3437365389.0,  1770848452.0,   482962922.0,  3756772043.0},
-  {2232251087.0,  4249254162.0,  2116457850.0,  2354742158.0,   520184776.0,  4021494168.0},
-  {3843358765.0,  1707093832.0,  3196459061.0,  2921753903.0,  2642619535.0,  3923535030.0},
-  {1599364883.0,  3652955117.0,   607301788.0,  1139261082.0,   599754829.0,  2065678901.0},
-  {3200114980.0,  4166837086.0,   510053954.0,  1380360535.0,  1488225622.0,  3806625307.0},
-  { 922073774.0,   700872314.0,  1772588067.0,  3346198809.0,    81469741.0,   992288217.0},
-  {1383255187.0,  3401569701.0,  1529247439.0,  3864324618.0,   528635589.0,   229231498.0},
-  {1867314237.0,  3688310154.0,   235121368.0,  1774327945.0,   206825308.0,   854099524.0},
-  {4252607434.0,   748136323.0,  3875407103.0,  3616118008.0,  1967066663.0,    90716096.0},
-  { 486976033.0,  4271394112.0,  1493064790.0,   249969416.0,  2988019285.0,  1436491429.0},
-  {3978664520.0,  3029455950.0,  1917832922.0,  2979802914.0,  2450238636.0,  1435919398.0},
-  { 988075593.0,  3685582080.0,  4070580702.0,  1799431222.0,  2559836365.0,   327275339.0},
-  {1458555135.0,  1628711943.0,  1650047360.0,  3113090218.0,  1869648539.0,  4202569461.0},
-  { 495826642.0,  3485057846.0,  4085229940.0,  2980765675.0,   182717934.0,  1824534401.0},
-  {4049017235.0,   377974464.0,  2647522631.0,   395056051.0,  2983509232.0,  1053065651.0},
-  {4081937897.0,  1023150646.0,  2536924823.0,  2246597986.0,  2380292767.0,  2379900956.0},
-  {1733824765.0,  1355656016.0,  3351729503.0,  4084878297.0,  4231582397.0,  1854345412.0},
-  { 454388418.0,  4172078535.0,  4281038856.0,  2405706692.0,  3049152044.0,  2806332999.0},
-  { 893205420.0,   481967534.0,  1359762201.0,   943357432.0,  4043050767.0,   107125220.0},
-  { 199606789.0,   439887036.0,  3768805297.0,  1088497127.0,  3106363140.0,  1953859513.0},
-  {2815360791.0,   850404971.0,  2917319651.0,   109072067.0,  2623833339.0,  1594427813.0},
-  {1068326869.0,  2743561749.0,  1781973326.0,  1770510120.0,   360772442.0,    80136728.0},
-  {2313128410.0,  3021844672.0,  3635295617.0,   227877902.0,   572651376.0,  2775563419.0},
-  {2370285538.0,  1957177331.0,  3913515636.0,  3488533947.0,  2877532136.0,  3126262175.0},
-  { 135760428.0,  2278207980.0,  1387362491.0,  4263854361.0,  2377491163.0,  3687489245.0},
-  {   2041796.0,  3050360636.0,   667459479.0,  2354324221.0,   673215499.0,  3038900850.0},
-  {3793298042.0,   947806144.0,   724091616.0,  4119013883.0,  3498580371.0,  4075428028.0},
-  {2928324871.0,  3610067713.0,  1388552361.0,  1215879781.0,  3344770320.0,  2947494744.0},
-  {1192537449.0,  3273789019.0,   557257912.0,  1326840846.0,  3922102170.0,  2359014133.0},
-  { 463555199.0,  2811863444.0,  1831008305.0,  3627532481.0,   898763559.0,  3367478215.0},
-  {2392318915.0,  1268658943.0,  3738181229.0,  2080341262.0,    25454411.0,  1487012065.0},
-  {1260132360.0,  4086204386.0,  1133760568.0,  1881489630.0,  2772031114.0,  2213150667.0},
-  {3149138057.0,  2011976424.0,  3193325854.0,   491433913.0,  1680010767.0,   880078426.0},
-  {1651847524.0,  2263637922.0,  1581936477.0,   264608903.0,  2781819785.0,  2453086748.0},
-  {2084988692.0,  3961196070.0,   711353372.0,  3388177651.0,   473041426.0,  1346143711.0},
-  {4253651870.0,  1181272534.0,  2939294136.0,  2071360158.0,  2153692096.0,  1392557268.0},
-  {1260805518.0,  1937979829.0,   259371636.0,  2410686116.0,  1640808343.0,  1671300972.0},
-  {1004350098.0,   616795034.0,  3132353040.0,  1570247961.0,  4268986229.0,  3522743148.0},
-  {  46849587.0,   801209098.0,  1589887682.0,  1711139110.0,  1546394155.0,   297847342.0},
-  {3161348192.0,  2746539942.0,  2197176531.0,  1418522202.0,  3869247144.0,   470296101.0},
-  {  82527981.0,  1152495396.0,  1325991469.0,  2111998891.0,  1162390975.0,  1352460179.0},
-  {3865630517.0,  2529158514.0,  3259266496.0,   864765830.0,  1679682600.0,   533457865.0},
-  {3392908331.0,  1692738770.0,   492268443.0,  2947625126.0,  3894007569.0,  1876368175.0},
-  {3424314137.0,   957251729.0,  3213566104.0,  3932061547.0,   464673302.0,  1154782165.0},
-  { 821617430.0,  3803426175.0,  4195486255.0,  3910494226.0,  1572474962.0,   478131238.0},
-  {3833252346.0,  2556578409.0,  1046275749.0,  3842125341.0,  1102920280.0,  2652082280.0},
-  {3426178581.0,  4263640034.0,  3649146676.0,  2001784615.0,  1263352655.0,   334767632.0},
-  { 332346913.0,   751222216.0,   848095323.0,   222345845.0,  3876979632.0,  3931267023.0},
-  {1893051265.0,  4006916614.0,  1234451449.0,  1892575439.0,  1700625384.0,  1939632263.0},
-  {1722963537.0,  2660076359.0,  2322237983.0,  2345580859.0,   789653754.0,  3210043927.0},
-  {1034147221.0,    45944962.0,   507382246.0,  1180794462.0,  2189217167.0,   890874297.0},
-  {3802204633.0,   926365009.0,  1452412765.0,   713055303.0,   939468833.0,  3207942848.0},
-  { 696992394.0,  1141547788.0,  3853435731.0,  3445762651.0,  2052171793.0,  1357151177.0},
-  { 574964156.0,   843372952.0,  1635443841.0,  2868699746.0,  4218000652.0,  2785116170.0},
-  {1042389303.0,   913036713.0,   279581681.0,  1093185970.0,   570432857.0,  4222238893.0},
-  {2909900029.0,   609439165.0,   999113030.0,  1938268639.0,    11554570.0,  3938016555.0},
-  { 738371440.0,  2852789858.0,   306776264.0,   499629568.0,  2357628459.0,  1414906178.0},
-  { 131081062.0,  2208116978.0,   675574464.0,  2303366205.0,  1107967651.0,  2225477359.0},
-  {3908462763.0,  1493695408.0,  1338320408.0,  2217181054.0,  2508601086.0,   582092337.0},
-  {4106858432.0,   622396251.0,  1065848236.0,  2223864448.0,  1031518295.0,  2157999254.0},
-  {1247780136.0,   207427503.0,   164457817.0,  2972737631.0,  2741554477.0,  2617770703.0},
-  {4148913625.0,  3080005732.0,  3585705474.0,  2622502897.0,  1920023304.0,  1216147997.0},
-  {4021395906.0,  1898812905.0,  3877752925.0,  1396287731.0,  1169030489.0,  1818023372.0},
-  {2033079690.0,  4229752616.0,  2267928310.0,  3009949773.0,  3784393275.0,  1450361968.0},
-  {1279830355.0,  3642630696.0,  1093051437.0,   173114892.0,  3082447916.0,  2103774465.0},
-  {3501072473.0,  2990912276.0,  2228216802.0,  4248951192.0,  3377253146.0,  1771310456.0},
-  {1700580172.0,  3119665005.0,  3822908063.0,   624413848.0,   355188125.0,  1120944429.0},
-  {3550925493.0,  4214591327.0,  1825320836.0,  2898625972.0,  2771191637.0,  4061210083.0},
-  {1640620699.0,  1698865492.0,  2124736279.0,  4035884302.0,  1639303498.0,  2853339445.0},
-  { 311803410.0,  3605744571.0,  3679671030.0,  2668566717.0,  1470470206.0,  3488633002.0},
-  { 582108704.0,  1363790496.0,  2695833464.0,  3097244160.0,   842275270.0,  1617458152.0},
-  {2799438355.0,  3026421530.0,  2371075912.0,  1175841666.0,  3998044207.0,  1944561092.0},
-  {1854713064.0,  2289652485.0,  3009847061.0,  1464892573.0,  3189033854.0,  2781286762.0},
-  {1930362205.0,  2991109670.0,   226801480.0,   139003854.0,  3103086722.0,  3582288534.0},
-  {1052775825.0,  3615675994.0,  2161682755.0,   320937901.0,  2901545779.0,  2037165048.0},
-  {1050530146.0,  3945139970.0,  1682881745.0,  1459020476.0,  2374700711.0,  2353884348.0},
-  {1535304335.0,   686541308.0,   939726684.0,   688418416.0,  2022821440.0,   888772847.0},
-  { 654996920.0,  4074939637.0,  3085403137.0,    87283325.0,  4000181165.0,  4043824794.0},
-  { 341335883.0,  3022817571.0,  4167338372.0,  1145683267.0,  1951614490.0,   922792290.0},
-  { 165877975.0,  1539065030.0,  1844672900.0,  1697257190.0,  1791364460.0,   315304886.0},
-  { 221923618.0,   190098099.0,  4044900203.0,  1854012754.0,  3748151558.0,  3651003692.0},
-  {2675076153.0,  3687499757.0,  4248149619.0,  3915603122.0,  1534709856.0,  1664191752.0},
-  {1291574682.0,  3062255132.0,  3213693606.0,  1538308760.0,  3740171209.0,  1407412503.0},
-  {4078893775.0,  1033565409.0,  4116743071.0,  2732847335.0,  1716815301.0,  1908767603.0},
-  {3881799442.0,  4227655416.0,  3468244549.0,   438697396.0,  3593344710.0,  1367050275.0},
-  {3735847997.0,  2604539296.0,  3866556522.0,  2665073131.0,  2926350841.0,    35938772.0},
-  {2903563529.0,  1208855495.0,  3408282998.0,  2764253117.0,  1647076301.0,  3166744285.0},
-  {1971660047.0,  3551076825.0,  2428455240.0,  1888519615.0,  1280804422.0,  2564655198.0},
-  {4112651672.0,  4013945300.0,  1642979720.0,  1673785857.0,  1574236020.0,    60200744.0},
-  {3096248417.0,  1288717103.0,  2532478719.0,  1466109336.0,   560938154.0,   622165107.0},
-  { 506351013.0,   897852712.0,  1603348090.0,  1613809326.0,  2596259286.0,  3261397608.0},
-  {3201846318.0,  3800902676.0,   864231965.0,  2360237283.0,     6345680.0,  3475170293.0},
-  {3883092953.0,   745406247.0,   621390600.0,  1293083110.0,   286022990.0,   613698894.0},
-  {2116265904.0,  3873763134.0,   564965411.0,   690663572.0,  3285787803.0,  3136607095.0},
-  {4177791200.0,  3762388618.0,  3418427030.0,   537532619.0,  1917696610.0,   169705001.0},
-  {1733201249.0,   176261207.0,  3103210642.0,   980053129.0,  3226301420.0,  4258806573.0},
-  {4112507004.0,  2776307898.0,  2746393332.0,  1468529755.0,  2592539494.0,  3570918938.0},
-  { 890018257.0,   135514089.0,   602956719.0,  2401655667.0,  1858123507.0,  1872072448.0},
-  {2840832185.0,  4026401216.0,  2594398351.0,  3282233158.0,  2407736703.0,   329996943.0},
-  {4271874840.0,   483613714.0,  1369137827.0,   716117195.0,  1393826184.0,  1844264673.0},
-  {2759112325.0,  2883829767.0,     2480590.0,  2657980936.0,  3565382425.0,  2600158909.0},
-  {2007069980.0,   927760485.0,  2176416982.0,  1122183781.0,   682735078.0,  3322402285.0},
-  {3067557111.0,  1967469381.0,   899248642.0,  1874907199.0,  2708894159.0,  2595770547.0},
-  {3307758142.0,  2590833891.0,  3758505375.0,   253891497.0,  3311815579.0,  2325593254.0},
-  {3622820290.0,  1963069076.0,  3362103903.0,  3375218033.0,  3782650136.0,  1117036405.0},
-  {1808801479.0,   544236568.0,  1312995173.0,  3015679461.0,  1480645676.0,   797669059.0},
-  {1251367743.0,  3797771174.0,  3972829875.0,  3344321688.0,  2078131527.0,  3160549305.0},
-  {3775007816.0,  2427455943.0,  1944508892.0,   869650343.0,  3378821266.0,   230906478.0},
-  {2399316948.0,  2669407250.0,  2674629318.0,  4107327820.0,  1777678695.0,    99639590.0},
-  {1289523880.0,  1195228121.0,  2786385314.0,  2821712262.0,  2538990592.0,  4032256663.0},
-  {4016622191.0,  3619161428.0,  2932435976.0,  3913687641.0,  1701255453.0,   566972380.0},
-  { 460824630.0,  2109814550.0,   790490527.0,   206110787.0,   394275184.0,  3096616148.0},
-  {1058214353.0,  3362897660.0,   787177787.0,   658144529.0,  3526005914.0,  1052285707.0},
-  { 622119450.0,  2427416100.0,  2919707421.0,   929238051.0,   291115496.0,  1027725088.0},
-  {2668901647.0,  3316935307.0,  4176389565.0,  1076637354.0,   269372850.0,  1708686983.0},
-  {2475694890.0,  2522542145.0,  3682122739.0,  3349776634.0,   927916618.0,  2334888519.0},
-  {2827692690.0,  2058687717.0,  3362195796.0,  3883125135.0,    51657167.0,   689078009.0},
-  {3218608847.0,   728865347.0,  2925464093.0,  2003671250.0,  1003735379.0,  3602718405.0},
-  {2075495840.0,   944632786.0,  3213967277.0,  4098826170.0,  2975315285.0,   800466620.0},
-  {2547115934.0,   760943536.0,  3802647455.0,  2767894772.0,   913533001.0,  1685107774.0},
-  {2316339543.0,  3138903509.0,   818142540.0,  2937073511.0,  1847470676.0,  3239496881.0},
-  { 166186492.0,   310142340.0,  1696678345.0,  1654920650.0,  1063958357.0,  3508716896.0},
-  {1801773393.0,  3688030455.0,  3568836867.0,  1567484172.0,  1135041588.0,  3074005666.0},
-  {3936606645.0,  1639900531.0,   929763278.0,  1774436730.0,  4264446979.0,   589478410.0},
-  {3961935071.0,  1838668357.0,  2299756985.0,   142771567.0,   148611101.0,  2337527461.0},
-  { 215418761.0,     3269230.0,  2731154205.0,  2395400828.0,  2880073439.0,  1297154188.0},
-  {3617139488.0,  3757424961.0,  2170259160.0,   816708652.0,  3181804953.0,  1396912786.0},
-  {1927833754.0,  2179410075.0,  2879300559.0,  1754540907.0,  1796744416.0,  3721117123.0},
-  {2623291922.0,   208027287.0,   549889188.0,  1399567058.0,    30146696.0,  1698993952.0},
-  {3128068118.0,  3885983450.0,   317575630.0,   999830038.0,  2797866322.0,  2176587944.0},
-  {3313574128.0,  1526137343.0,  2274731429.0,  3215875548.0,   987460350.0,  1459676295.0},
-  {1675086863.0,  3493318971.0,  2593334218.0,  3288807360.0,   238168904.0,  1098377394.0},
-  {2653562772.0,  1295856234.0,  3582183705.0,  3575390346.0,  1928207838.0,  2337339229.0},
-  { 618052329.0,  2842109057.0,  2395260623.0,  1887959526.0,  2705324184.0,  2449573559.0},
-  { 507515775.0,  3073453794.0,  2216274011.0,   376663573.0,  3244903214.0,  2536072933.0},
-  {1426696030.0,  1758462139.0,   149672932.0,  3568593310.0,   611550209.0,  3863555440.0},
-  {1455701532.0,  4029061903.0,  2200617939.0,  1966062588.0,   356623682.0,   122744758.0},
-  { 368599308.0,  1070395790.0,   477923585.0,  4126711935.0,  3519457576.0,  4203708093.0},
-  {3168759633.0,  2248754443.0,  4231207678.0,   848469844.0,  3814747757.0,  3970179742.0},
-  { 368674778.0,  1458121299.0,   382045627.0,  1789972446.0,  3497656057.0,  1705314540.0},
-  { 298898310.0,  1341056566.0,  3087298239.0,  3850437645.0,  2274780710.0,   830462077.0},
-  { 208271989.0,  4184699750.0,  3179847400.0,  3273493377.0,   776548522.0,  1817274192.0},
-  {2350022119.0,  3571469708.0,  1804722503.0,  3156914053.0,   356325422.0,  4092827988.0},
-  { 164963702.0,   401970030.0,  3841570621.0,  4180284953.0,  1520196402.0,    21071429.0},
-  { 963519986.0,   355172358.0,  3317352671.0,  3207360414.0,  2229223179.0,  1613772667.0},
-  {2752937128.0,  3068639960.0,  1233053601.0,  1858883070.0,   219383089.0,  3993360845.0},
-  {3374487978.0,  2485593820.0,  1048106818.0,  2052727658.0,  2676596761.0,  3307544509.0},
-  {3070445494.0,  3152448612.0,  2579826040.0,   695449110.0,   259113202.0,  3837218296.0},
-  {3075736764.0,  1065802865.0,  4017388059.0,     2842866.0,  2451831611.0,  3003283427.0},
-  {2293769936.0,  1671255986.0,  1719658505.0,  1748610858.0,   601557983.0,   150874363.0},
-  {  42529667.0,  4000879259.0,  2711109236.0,  4080337904.0,  4216975543.0,   185672049.0},
-  {1685896893.0,  1339225478.0,  3351176036.0,  1367783485.0,  1366102031.0,  3914244108.0},
-  { 639606301.0,   345968087.0,  2916220080.0,  3638169527.0,  1465014828.0,  2573588251.0},
-  {3273285978.0,  3980748234.0,  1663324196.0,  1879149901.0,  1394835951.0,   644399967.0},
-  {1479576161.0,  3430198891.0,  4051088940.0,   149371852.0,  1410206760.0,     1330296.0},
-  {2324549187.0,  3198382076.0,  1087044343.0,   324216600.0,  4080324098.0,  3522724594.0},
-  { 690012769.0,  1196759464.0,  1922169286.0,  1628485151.0,  1563531778.0,   244039866.0},
-  {3644103779.0,  2642246287.0,   217599930.0,  2255266157.0,  1371490456.0,  3858695670.0},
-  { 500761938.0,   465753099.0,  2861968623.0,  1554093764.0,  1354198834.0,  3490748439.0},
-  {4120859676.0,   438683041.0,  3814379177.0,  1961366507.0,  2132142445.0,  1676187692.0},
-  { 621776921.0,  2230295139.0,   975324151.0,  3884471070.0,   544233752.0,  3346276171.0},
-  { 329818826.0,   461504987.0,  1603109350.0,   637802922.0,   593071538.0,  2134002510.0},
-  {3879515579.0,   667303884.0,  2451978409.0,  1393843399.0,  2382141994.0,  2609856037.0},
-  { 770872536.0,  3773105973.0,   673821735.0,  3168740014.0,  1318666896.0,  3610558569.0},
-  { 952471726.0,  3322107916.0,  3439894581.0,    68442653.0,  3843670519.0,  3980018954.0},
-  { 259114608.0,  3588127575.0,  3529479491.0,  3505853365.0,  4012435004.0,  3026617956.0},
-  {2636376238.0,  3719062431.0,   339446789.0,   406183493.0,  1950400260.0,  1169841020.0},
-  {1610931651.0,   413767286.0,  3408530001.0,  1527536503.0,  3541419848.0,   357714364.0},
-  {3945572522.0,  1857909111.0,  2692138445.0,  4134824339.0,   672347115.0,   510277697.0},
-  {3995120300.0,  3155630891.0,  1627550848.0,  3221837406.0,  2776308055.0,   923096078.0},
-  {1698805119.0,  3099842115.0,  3878546311.0,  3937648481.0,  2809278983.0,   418197985.0},
-  {1486109875.0,  3887473942.0,  2716347713.0,  1605006067.0,  1624038292.0,  2756050211.0},
-  { 225105283.0,  1028800446.0,  3475530378.0,   341271471.0,  2907536336.0,  2910932183.0},
-  {3545884116.0,  3309795498.0,   991686561.0,   564783151.0,  3558089046.0,  3891571025.0},
-  { 202084856.0,  2441080321.0,   129381008.0,  2076003667.0,   118976818.0,  3806834018.0},
-  {3182598945.0,  3847944104.0,  2759140202.0,  2993434969.0,  1117601657.0,  3160120571.0},
-  {1746214215.0,   579986143.0,  1509635152.0,   935115445.0,  1930302314.0,  2513226139.0},
-  {1456218620.0,  2085751699.0,  3041693709.0,   736956969.0,  2344944359.0,   217577751.0},
-  {3291421244.0,  2934942981.0,  1668663484.0,  3291173909.0,  3316966504.0,   471708902.0},
-  {1847097090.0,  2665904752.0,  1272046789.0,  3726570993.0,  2209771083.0,  2683735885.0},
-  {2399988057.0,   718141726.0,  3534158837.0,  1677278983.0,  3309727307.0,  4196707511.0},
-  {2474423727.0,  3521145916.0,  4206415637.0,  2903580645.0,  2712725934.0,  1570641375.0},
-  {1114540064.0,  1195180935.0,  1108731799.0,    17834540.0,   465679789.0,  2199602244.0},
-  {2184032872.0,  2993596540.0,     1503437.0,  3262524033.0,   596861666.0,   275427392.0},
-  {3620318531.0,   771006407.0,  2080164336.0,  2147113062.0,  3661429719.0,  2251740994.0},
-  {4208107872.0,  4121995796.0,  1475281086.0,  3498303128.0,  3146027697.0,  4269589824.0},
-  {4082505684.0,  1768974574.0,  3250666738.0,   316703888.0,  3806236258.0,   322006092.0},
-  {2414543335.0,  1723174751.0,  1692883840.0,   648239540.0,  2068454105.0,  4277783817.0},
-  {2533342792.0,  2501261432.0,  1464338528.0,  1738464961.0,  1349601166.0,   539987597.0},
-  {1396239695.0,  2758328465.0,   284381783.0,  1636306355.0,   329655441.0,  3351600675.0},
-  { 736443890.0,  3695781118.0,   759702983.0,   605218164.0,    21536437.0,   522628879.0},
-  {2185344559.0,  2237209836.0,  3358058594.0,  2997095454.0,  1285959823.0,  2216767424.0},
-  { 334896980.0,  3032082052.0,  4094556806.0,  2070002722.0,  1758368386.0,  2617495794.0},
-  {3414120853.0,   868647336.0,  4052723461.0,  2977817617.0,   390953142.0,  3647492287.0},
-  {2574408321.0,  3537645876.0,  2369047158.0,  3497447836.0,   598763565.0,  3632418827.0},
-  {2324135550.0,  3120311989.0,  2601128622.0,  3918630401.0,  1164649626.0,  2126414171.0},
-  {1453666316.0,  4030619828.0,   850572919.0,   965394080.0,  2659261926.0,  2415296821.0},
-  { 177173088.0,   661896891.0,  3619468491.0,  1646681068.0,   283441056.0,   282422750.0},
-  { 201861255.0,  3409420101.0,  3476382386.0,  1934725396.0,   271477161.0,  2364371452.0},
-  {1946815292.0,  1740659679.0,  2669638959.0,  1272400126.0,   216348489.0,  2521753111.0},
-  {3423553428.0,  3798003651.0,  1450185487.0,  1053018491.0,   897229945.0,   566751710.0},
-  {2522142439.0,   830160333.0,  1007761571.0,   345858381.0,  2121029578.0,  3628056712.0},
-  {1031862387.0,  2654888856.0,   608158510.0,  1789534136.0,  3404350121.0,  2230366848.0},
-  {1543977628.0,  3789276855.0,  2490073621.0,  2072188863.0,  3456628587.0,  4100883686.0},
-  { 867204797.0,  3143622897.0,  2551098109.0,  2504897239.0,  3903285237.0,  3714919334.0},
-  {2081687743.0,  1804936113.0,  2827165971.0,    77018555.0,  2505851711.0,  1638347763.0},
-  {1525589599.0,  3225376838.0,  3181962177.0,  2789034574.0,  4118174379.0,  1660668243.0},
-  {1295727616.0,  3150830358.0,  3722825428.0,  4249187686.0,  4073912214.0,  1732936728.0},
-  {3025188318.0,  1334075588.0,  3896519965.0,  3746875801.0,   104798441.0,  2917919891.0},
-  {3594844075.0,  4006954007.0,  1955713621.0,  4284920668.0,  2327842329.0,  1093740265.0},
-  {3928623688.0,  1272215644.0,  2178842464.0,  2952883863.0,  3436298067.0,  1693778013.0},
-  {2984170039.0,  3051903508.0,  2821554305.0,   435553428.0,  1986501397.0,  2427230281.0},
-  { 279906663.0,  1763244069.0,   101646473.0,   208013378.0,  2073078991.0,  3772022654.0},
-  {2982285860.0,  1706549035.0,  3903674422.0,  2962947084.0,  1163377284.0,  2924475994.0},
-  {3443227552.0,  3143271070.0,   779993129.0,  2345118597.0,  3769384258.0,  2013495156.0},
-  {1083941101.0,  3117044642.0,   749533157.0,  2742069589.0,   849872669.0,  2693327295.0},
-  {2677112011.0,  2084777643.0,  2043282502.0,  1939979050.0,   714600537.0,   746454314.0},
-  {2412545716.0,  1643473590.0,  2642757509.0,  1008186397.0,    80625984.0,  1254156026.0},
-  {3131627771.0,  2509125982.0,  1316794564.0,  1318704776.0,  3876301093.0,  1238338523.0},
-  {3933832617.0,  3670412191.0,   995513498.0,   400518961.0,  1533539966.0,  4078579406.0},
-  { 818133061.0,   651155570.0,  1509584511.0,  3166327006.0,  1396807417.0,   918016699.0},
-  {3931370556.0,  1972980979.0,   877635820.0,  3835710738.0,  2208305877.0,  2080855187.0},
-  {1099018573.0,  1515657755.0,  4145648841.0,  2541980756.0,  1594746153.0,  2090026899.0},
-  {2967896065.0,  2561461947.0,  1797298658.0,  2831059215.0,  2646651551.0,  2288194329.0},
-  { 908693869.0,  1857415010.0,  1532161358.0,  3024462301.0,  1693461776.0,    79075300.0},
-  { 919961845.0,  3340853061.0,  4128840528.0,  3682390845.0,  4023750072.0,   105440300.0},
-  {2831166023.0,  2808100436.0,  4150837974.0,   691753058.0,  1570847086.0,  2528779478.0},
-  {  68023431.0,  4252460112.0,  4268260517.0,  3706441632.0,  3312113208.0,  4227509932.0},
-  { 894726355.0,  1972388719.0,   719552483.0,  3742516938.0,  2805304517.0,   226936161.0},
-  {2962073332.0,  3115103910.0,  1646818155.0,  3155250514.0,  2105670403.0,   659379270.0},
-  {1613575716.0,   777043902.0,  3631744181.0,  4095976031.0,  2116231440.0,     3626412.0},
-  {1099460807.0,  2003112351.0,  1397006443.0,  1003972663.0,  2250823748.0,   429997808.0},
-  { 474919506.0,   423390056.0,  2121690662.0,  4041807778.0,  3335848848.0,  3126831695.0},
-  {3283779096.0,   239072498.0,  4057193121.0,  4056002679.0,  2486265979.0,  2205395867.0},
-  {1309969795.0,  3371573915.0,   657119019.0,  3870115297.0,  2786557571.0,  3347636691.0},
-  { 220625560.0,  3412463559.0,  1744537096.0,    15989042.0,  3191555556.0,   368047164.0},
-  {1124504196.0,   316566208.0,  3475317327.0,  2009907227.0,  1045598433.0,  3764185806.0},
-  { 455579890.0,  2293279126.0,  1853312369.0,    32258893.0,  4124729612.0,   221895333.0},
-  {1822887240.0,  2037746727.0,   962615140.0,    53529845.0,  3586011121.0,   976676982.0},
-  {3145413080.0,  1924972578.0,  2003371821.0,  3589034870.0,  3525072402.0,  2625995030.0},
-  {3126901697.0,   523413302.0,  3619917019.0,  2113235924.0,  1043190288.0,  3217718764.0},
-  {2619753968.0,  2488479511.0,   876219341.0,  1573586338.0,  2275934390.0,   875850908.0},
-  { 915739955.0,  3450772582.0,  1765605177.0,  3771999494.0,  3854347636.0,  4204435846.0},
-  { 233185879.0,  3416988350.0,  1163749100.0,    97277578.0,  3889391818.0,   308367808.0},
-  {2218167158.0,  2011639805.0,   195416176.0,  4261042339.0,  1562619514.0,  2159757354.0},
-  {3645257021.0,  3201103236.0,   981797588.0,  2291860436.0,  1330989960.0,  3318328943.0},
-  {1795035367.0,   381770682.0,  3221152706.0,   650892107.0,   103842175.0,  2949918184.0},
-  { 757909689.0,  1906063367.0,  4141398971.0,   519893878.0,   224120810.0,  4157240216.0},
-  {1957573065.0,  1779451099.0,  2543197762.0,  1073753573.0,  3479971616.0,  1299313869.0},
-  { 533431803.0,  1067724519.0,  3776478281.0,  3184511435.0,  1941930785.0,  1387090114.0},
-  {2162948432.0,  3105156134.0,  2369639917.0,   896627413.0,   218358617.0,  1477194268.0},
-  {1031000455.0,  2396448221.0,  2490989033.0,  4196502274.0,  1259175729.0,  1331974132.0},
-  {3749213960.0,   952866165.0,   191845742.0,  2368068740.0,  2431703601.0,  1852664524.0},
-  {1961670375.0,   214627726.0,  1673135785.0,  2543607364.0,  1655005383.0,  4127703964.0},
-  { 224915289.0,  3722304774.0,  4219689630.0,  3333245169.0,  1591450854.0,   700664928.0},
-  {2465264506.0,   785722989.0,  2187552717.0,  1351524747.0,  2739970999.0,   296880280.0},
-  {1650399594.0,   428874098.0,  2722002958.0,  1743389779.0,  1604639911.0,  1353133153.0},
-  { 487612610.0,  1639639306.0,   122479662.0,  1172942412.0,  2757683159.0,   374846565.0},
-  {2215772670.0,  4135118603.0,   725120441.0,   658571992.0,  4213927030.0,  2553006517.0},
-  {3221591950.0,   455274252.0,   180070755.0,   942205834.0,   242917979.0,   586793061.0},
-  { 357200269.0,  4156007225.0,  2917028900.0,  3694439123.0,  3223106814.0,  2135781803.0},
-  {1117909884.0,   710108780.0,  1317673093.0,  4067381929.0,  2290715269.0,  2931884944.0},
-  {4196432398.0,  4254239373.0,  1890838555.0,  3893214738.0,  2037322365.0,   505864049.0},
-  {3630019594.0,  3193421776.0,  3777674602.0,  3996722307.0,  3765322030.0,  2604704351.0},
-  {2881039189.0,  2869847604.0,   670700987.0,  2732785901.0,  3678423208.0,  2820240182.0},
-  {2338739206.0,  1083480656.0,  1222358943.0,  1761145546.0,   219687022.0,   116595797.0},
-  { 407987816.0,  1413591304.0,  2506094865.0,  3844189797.0,   170074682.0,  2794915467.0},
-  {2462532417.0,  4153055541.0,  1525064872.0,  4241239840.0,   767588558.0,  4019114328.0},
-  {  67561173.0,  1650591980.0,  2633856103.0,  1807587052.0,   943862069.0,  2997934887.0},
-  { 727582546.0,  2112952427.0,   124104960.0,  1177453476.0,  2492978146.0,   470864599.0},
-  {2720953903.0,  2416144996.0,  3402133229.0,  1080700331.0,   719606378.0,  1813042789.0},
-  { 162295719.0,  1092411544.0,  3031254251.0,   414452860.0,  2029190845.0,  1348745524.0},
-  { 155697799.0,  2427165886.0,  1616982987.0,  3597466902.0,  3010863936.0,  2153853916.0},
-  {1320340305.0,  3128921417.0,  2908524434.0,  1599411178.0,  2698783991.0,  2647687804.0},
-  {2869700017.0,  2571740055.0,  2800297398.0,  1322384787.0,   876757632.0,  2942118654.0},
-  {2781409191.0,  2472585396.0,  1867700531.0,  3805404674.0,  2968237672.0,   789371296.0},
-  {3304578755.0,  2661610922.0,  3360696499.0,  3271866618.0,  3328529970.0,   996981350.0},
-  {3182930850.0,  2623650771.0,   397535373.0,  1749667822.0,  3788465243.0,  4011973238.0},
-  {2014843361.0,  2493258703.0,  2512579317.0,   641543304.0,   541334562.0,  3708818643.0},
-  {2153487002.0,  2900277322.0,  1584863339.0,  2183603449.0,  3518714330.0,   246101321.0},
-  {1863370762.0,  2408004535.0,  1139321324.0,  2199729440.0,  2739995238.0,  2416264218.0},
-  {1040164119.0,  3331515481.0,    61948308.0,  3308121983.0,  1617201855.0,  2738389396.0},
-  {3590095218.0,  1034575804.0,  3907067629.0,  1878724566.0,  3588171882.0,   155795010.0},
-  {2666339996.0,  2999696854.0,  1462865171.0,  3266119219.0,  3652657561.0,   944336831.0},
-  {3912645642.0,   325804986.0,   933691370.0,  3499675386.0,  4212155053.0,  2833359901.0},
-  {2597075238.0,  3395406047.0,  3996465295.0,  3837998255.0,  3164147144.0,   951865272.0},
-  {1505694411.0,   620863900.0,  4259725225.0,   294410437.0,   305902871.0,   940694605.0},
-  {1425387125.0,  3478067031.0,  1468961418.0,  3581165196.0,   167679207.0,   694007124.0},
-  { 112379598.0,  3050367619.0,  3022979473.0,  3618171030.0,   511819809.0,   332616205.0},
-  {2872613806.0,  3675118623.0,  1497753198.0,  2823436524.0,  1372737283.0,  4243712551.0},
-  { 347630165.0,  1867015948.0,  3696015714.0,  2974843401.0,   263257110.0,  2569712968.0},
-  {3100385724.0,  4124176363.0,  1533260067.0,  2822614514.0,  3631167971.0,  1342699859.0},
-  { 912519677.0,  1197877025.0,  2235838792.0,  2540566857.0,  2233417811.0,  4290537510.0},
-  {2564381045.0,  2791570943.0,  1227815967.0,   596519170.0,  2485469478.0,  4196056950.0},
-  {1523020780.0,    35467141.0,   190935531.0,  3724207311.0,   372041142.0,  1529684650.0},
-  {3577865538.0,  1623997061.0,  4288248098.0,   418290121.0,  3129242553.0,  3200990004.0},
-  {1814306160.0,  1947417404.0,  1979607120.0,  2188945102.0,  3522953813.0,  1385134463.0},
-  {2708861197.0,  3447365474.0,  2392145184.0,   524869465.0,  2040518402.0,   624721550.0},
-  {1186693030.0,  1139582014.0,   230504793.0,  3515398104.0,   462739752.0,  3999253829.0},
-  { 413069765.0,   721397849.0,  1035183844.0,  3099984072.0,    68423579.0,  2606079307.0},
-  {1678277572.0,  3396544530.0,  1849961135.0,   765015602.0,  3110392444.0,  3907287564.0},
-  {2145657214.0,    55859044.0,  2390246638.0,   771119666.0,   822137710.0,  4014589289.0},
-  {2326073959.0,  3079053923.0,  2861325685.0,  2150057021.0,  4228544353.0,  1364826409.0},
-  {1258299838.0,  2489283146.0,   978490627.0,  4205108009.0,  1448409887.0,   686152009.0},
-  { 208695145.0,   520829507.0,  1839891194.0,  2708468370.0,  4187747247.0,  3621780372.0},
-  {1960631648.0,    37366821.0,  4054306004.0,  1633559294.0,  1301168639.0,  2208253962.0},
-  {2278814101.0,   358290696.0,  3179050263.0,   383974607.0,  1380665496.0,  2314073504.0},
-  {4254483209.0,  1986502827.0,  2931036446.0,  3904073669.0,   201817629.0,  2277387506.0},
-  { 646721378.0,  1865990730.0,  1026940897.0,  3376873381.0,   899939963.0,  3322732024.0},
-  {1527761746.0,  1130592117.0,  2335861187.0,   513313144.0,  1097423893.0,  2631958305.0},
-  { 992846066.0,   232653380.0,  2563708221.0,  2649375134.0,  2864882711.0,  3700941846.0},
-  {4077827577.0,  2920728188.0,  3507359416.0,  2179521571.0,  2306971098.0,   809776853.0},
-  {3274124329.0,  3828711752.0,  3270143264.0,  1127342546.0,   680564670.0,  3411765558.0},
-  {3529237920.0,  2039723458.0,  2503812316.0,  2739699807.0,   114340233.0,   210062844.0},
-  {2652203423.0,  4159425391.0,  3091655358.0,  2473119872.0,  3637919551.0,   457537125.0},
-  {4246328476.0,   975717071.0,  3170564029.0,  3398499228.0,  4050636773.0,  1692951391.0},
-  {4243585814.0,  3456049183.0,   202656270.0,  1686083067.0,  3116843769.0,   468441263.0},
-  {2363931921.0,  1374838407.0,  2101331551.0,   709300340.0,  4183493481.0,  1734352294.0},
-  {3043589623.0,  4110437448.0,   443850481.0,  2870911437.0,   786424008.0,  3930398580.0},
-  { 749115973.0,   285801861.0,  3602036336.0,  1516309758.0,   778202363.0,  3246909694.0},
-  {3867313184.0,   482687323.0,  3213063197.0,  1115776609.0,   337062666.0,  4020964179.0},
-  {1958272382.0,  2135558669.0,  2722935298.0,  1573008490.0,  3329406933.0,   569056031.0},
-  {1886066680.0,  1401764720.0,  2289974766.0,  3405676187.0,  2873411279.0,  1279948187.0},
-  { 191835273.0,  3570292328.0,  2739440465.0,  3583464580.0,  2031502200.0,  2363866172.0},
-  {3534636706.0,  3779518582.0,  3283346779.0,  2312913187.0,  3411189966.0,   868310468.0},
-  {1546666068.0,  4160841520.0,  3542543037.0,  1159113512.0,   410075091.0,  1070024445.0},
-  {2431941861.0,  3656179546.0,   739621984.0,  2557770598.0,  3505084676.0,   882570192.0},
-  {2550334069.0,  2615722555.0,  3783638032.0,  1877963153.0,   759303309.0,  4003062519.0},
-  {2848807520.0,  3356709819.0,   262799430.0,  2940936914.0,  2583244711.0,   877543911.0},
-  {1696905641.0,  3401678142.0,  2686891823.0,  3569052673.0,  1106923253.0,  3310214956.0},
-  {2676843829.0,  4172547795.0,   840976166.0,  1810386357.0,    22264254.0,  2096144443.0},
-  {2617397749.0,  4171744504.0,   964377160.0,  1871279524.0,  1379769187.0,  2532617296.0},
-  {3271411605.0,   628971537.0,  1908686796.0,  1650391430.0,    97811955.0,   590386798.0},
-  {2186719020.0,   684951814.0,    70614399.0,  2802963686.0,  2455731039.0,  2773852433.0},
-  {3480014721.0,   762047691.0,   231046970.0,   142763535.0,  3945566200.0,  1578782381.0},
-  { 227973962.0,  2645127324.0,  1359943596.0,  3227790890.0,  4216332459.0,  2321914330.0},
-  {2888427757.0,  1253885199.0,  1098385202.0,  3842630916.0,   461909627.0,   907030743.0},
-  { 655796731.0,  3373876879.0,   675492060.0,   315370362.0,   172558070.0,  2762946361.0},
-  { 490802624.0,  2470305633.0,  2377236771.0,  2405045804.0,  1413152660.0,   174251967.0},
-  {1875735925.0,  1109155793.0,   458015941.0,  4210838315.0,  1294218121.0,   828833258.0},
-  {2536468455.0,   684639323.0,  3134095077.0,  4254112643.0,  3721315931.0,  3379099253.0},
-  {2334536829.0,  2845497085.0,  2856264542.0,  1414817307.0,   646967581.0,    82678989.0},
-  {3912523245.0,  1858821822.0,   351588924.0,  3543498289.0,  1296514444.0,   479207921.0},
-  {1117778203.0,  2247609686.0,  3171173257.0,  1844118378.0,    19353846.0,  2280389631.0},
-  { 549201500.0,  1846140593.0,  1266949037.0,  3645967944.0,   511482370.0,   740633109.0},
-  { 260621290.0,  3877073842.0,  3791513266.0,  2504083770.0,  3314913040.0,  2649065641.0},
-  {4152199714.0,  2089462015.0,  3802349030.0,  4086059536.0,  3959681843.0,   827507760.0},
-  {4159612254.0,  2690182092.0,  2959557472.0,  2563233928.0,   780622379.0,    54530154.0},
-  {1856749426.0,   947550616.0,  3048906898.0,  3465543642.0,  3711186129.0,   152295568.0},
-  { 172087877.0,   155004258.0,  3939748881.0,  3835236796.0,  1274610017.0,   583474983.0},
-  {2709423679.0,  3356071243.0,  3215116679.0,  1342947087.0,  2499224684.0,   497971959.0},
-  {3731178378.0,   773773701.0,  4006524505.0,  2846047778.0,   968952917.0,  2787617227.0},
-  {4201028091.0,  4091002586.0,  4265425445.0,  1318033300.0,  4143156496.0,  4072608233.0},
-  { 802220053.0,  2445239091.0,  1605637731.0,  1035634735.0,  1042468626.0,  3170309109.0},
-  { 869797034.0,  1307338271.0,   512063690.0,   893584336.0,  3988070670.0,  3686065134.0},
-  {1666673191.0,  4130141483.0,   847414206.0,  2182783815.0,   586600570.0,   387736680.0},
-  {1346271847.0,  1914648694.0,   821359755.0,  3963376622.0,  1685600386.0,  2515434113.0},
-  { 335636533.0,  1023393887.0,  4288202614.0,  2301022341.0,  3090702178.0,  4258112055.0},
-  {4288723320.0,    33819328.0,  2616127417.0,   473062509.0,  1427302590.0,  3979563803.0},
-  {4119810635.0,  1305720257.0,  2831303608.0,   329303814.0,   366776855.0,  3088611834.0},
-  { 905290244.0,  3487699468.0,  4237463361.0,  2048991331.0,    10024471.0,  3684629735.0},
-  {1804633736.0,  2444596873.0,   692222236.0,  3714463229.0,  4125067171.0,   716444806.0},
-  {1269577562.0,  2707328189.0,  2401978310.0,   113299741.0,  2873936898.0,  2162302233.0},
-  { 809793850.0,  1132020277.0,  1218664579.0,  1190935378.0,   310480482.0,   138704657.0},
-  {  57956049.0,  1201232933.0,  2478475132.0,  2201870930.0,  1700474603.0,  1143561230.0},
-  {1940871315.0,  4196106099.0,  3938570320.0,  3773900174.0,  4069790082.0,   400942965.0},
-  {3862387683.0,   766178761.0,  2596720858.0,  1657087186.0,  1204415352.0,   433061690.0},
-  {4061652283.0,  3489090088.0,  4006146763.0,  1781603204.0,  3354129701.0,  1848900803.0},
-  {4169055395.0,   569900187.0,  1165876612.0,  3037476610.0,  1051861998.0,  1948207844.0},
-  {2689904865.0,  2297915125.0,  1896535449.0,  3890027826.0,  3225361313.0,  1601295295.0},
-  {2954071319.0,   223891976.0,   818091164.0,  2366328931.0,    83761389.0,    62327569.0},
-  {3398147641.0,  1638891298.0,   356734939.0,   384210175.0,  3414239279.0,  3049846091.0},
-  {3413339223.0,  3476258090.0,   325848202.0,  3489476129.0,  1022914023.0,  2042435810.0},
-  {2199830771.0,  1154819782.0,  2831778561.0,  4210951777.0,  2191524056.0,  1056911588.0},
-  {3373554072.0,  2215508080.0,  1803306426.0,  3204234287.0,  2758210820.0,  3692876303.0},
-  {1422359834.0,   225707181.0,  2537523619.0,  4106196113.0,   979077313.0,  1050722712.0},
-  {3977106887.0,  2911524930.0,  1375777321.0,  2154609570.0,  2333818045.0,  2494725553.0},
-  { 548794766.0,  2441962636.0,  3364688808.0,  2111838446.0,  2552272974.0,  2511824288.0},
-  {3570244822.0,  1039735334.0,  3819544509.0,   985167096.0,  2124540096.0,  2508766510.0},
-  {1590090628.0,   771748805.0,  2264089972.0,   776062418.0,  2058468193.0,  2249444211.0},
-  {3906777343.0,  3764268310.0,  3972977445.0,   819788313.0,  1750758536.0,  2741360476.0},
-  {1274235776.0,  2021846813.0,  3000849409.0,  2193912230.0,  1567339589.0,  3254652838.0},
-  {1254346223.0,  1504398142.0,  1095823238.0,  3268303753.0,  1542151081.0,  3616611669.0},
-  {2177812219.0,  2133455746.0,  3938379118.0,  4173456256.0,  3897271424.0,  2123300516.0},
-  { 138498510.0,  2959674020.0,  1348309779.0,   946708347.0,  2930265499.0,   297693870.0},
-  {4001151325.0,  1700317661.0,  3665628621.0,  3815847602.0,  1954509275.0,  1819973957.0},
-  {3815117054.0,    73965609.0,  2632192999.0,  2590758545.0,  2148543140.0,  1892976432.0},
-  { 317884454.0,  3865311206.0,  3223562307.0,  2129785149.0,  2360078233.0,  1881120974.0},
-  { 187030190.0,  4022518564.0,   999629031.0,   694564150.0,  1712985362.0,  1853156788.0},
-  {3487372306.0,  1098217655.0,  4017721166.0,  3445106028.0,   982438295.0,  1025449532.0},
-  { 635865901.0,   857640764.0,  1637868814.0,  2501310490.0,   863302320.0,  2249062984.0},
-  {3561311937.0,  1119407453.0,  3563257393.0,  3773274996.0,  4151032147.0,  1603348956.0},
-  {1222431378.0,   702111578.0,  1147678182.0,  1085106214.0,  4024919908.0,  1701032362.0},
-  {2051904359.0,  1859980130.0,  2045433328.0,   175625665.0,   477750785.0,  3656853485.0},
-  {1136606510.0,  3320877149.0,  1866858575.0,  1993485452.0,  1543364090.0,  4069935602.0},
-  {3493983242.0,  1591522273.0,  2938805989.0,  2868080362.0,  1070720513.0,   968163602.0},
-  {1893157857.0,  2484273910.0,  2455926105.0,    86268852.0,  3645523623.0,  1358704102.0},
-  {3897900713.0,  4189161979.0,  2571407985.0,  2719733945.0,  1643540600.0,   697654290.0},
-  {3585589808.0,  1453978133.0,  3025851832.0,   201316095.0,  2866047223.0,  1059158952.0},
-  {2504854525.0,   573247180.0,  2471773855.0,  1535003058.0,  3076388028.0,  3815462960.0},
-  {4201078729.0,  3584122296.0,  2840140890.0,   786919285.0,  3345893755.0,  1583716368.0},
-  {2540959684.0,  2385394395.0,   321642472.0,   531898993.0,  1850738308.0,  2705426220.0},
-  {3468522011.0,  3434666872.0,   645786674.0,  3930338365.0,  3321498271.0,  2848981811.0},
-  { 840617124.0,  2652601116.0,  2046027798.0,  3415112107.0,  2460574221.0,   840432863.0},
-  { 542505773.0,  3852708237.0,  2561534593.0,  2577443986.0,  3119112506.0,  1261835727.0},
-  {3764785600.0,  1670648827.0,  1401532756.0,   925380269.0,  2489416723.0,  1768343393.0},
-  { 564101246.0,  2698569539.0,  1875836636.0,  2819148026.0,  1316574416.0,  1241963220.0},
-  {2514494302.0,  1063437575.0,  4218263898.0,  1264822421.0,    88118462.0,  2234745904.0},
-  {1805333683.0,   907457358.0,  4017261531.0,  1860636695.0,  1058364820.0,  1247150663.0},
-  { 103110603.0,  3374220947.0,  3361341383.0,  3429733418.0,   354978403.0,   932425768.0},
-  {3803955174.0,  1409151939.0,  1913826333.0,   622959256.0,  4128094413.0,  2182010234.0},
-  {4183870317.0,  1497611475.0,  3639473171.0,  1148570273.0,  2188396658.0,  2834952296.0},
-  {3991641771.0,   844734304.0,  1197636855.0,   935172297.0,   960063985.0,  3765444863.0},
-  {4241008628.0,  2109286454.0,  3482474606.0,    89695813.0,   620283821.0,   331546052.0},
-  {2697111198.0,   891197725.0,  3423609035.0,  2875853635.0,  1763653320.0,  1312682418.0},
-  {1914855404.0,  4209658751.0,  3783887855.0,  3153623635.0,  1305818410.0,    17114971.0},
-  {2663518136.0,  2730577064.0,   525447689.0,   271910469.0,  2436834748.0,  2495035169.0},
-  { 156817535.0,  2610658424.0,  2878338330.0,  2176021448.0,   891867770.0,  3117756665.0},
-  {2937776138.0,  1157001214.0,  4120413784.0,  2964621339.0,  3369893396.0,   732521336.0},
-  { 376581698.0,  1954648762.0,  2082519729.0,   853660309.0,  1620989685.0,  2317389306.0},
-  {3207232392.0,  3809395766.0,  4195614328.0,  2595473452.0,  3389418163.0,  2953176689.0},
-  {4288937804.0,  3203595099.0,  3618379199.0,  3818544258.0,  3720400287.0,  3171395111.0},
-  {3973498529.0,  3892496216.0,  3324919243.0,  1356384494.0,  2325687959.0,  1583800423.0},
-  { 318010832.0,  1654336712.0,  1977332394.0,  3495858733.0,   202118648.0,  3446701617.0},
-  {2511701033.0,  3769728678.0,  3586628014.0,  1440247900.0,  1180062766.0,   356790604.0},
-  { 442738339.0,  2276307630.0,   958545842.0,  3528319801.0,  2944210116.0,  2908303062.0},
-  {1846489988.0,  3508792529.0,   480270951.0,  3547075849.0,  1877452074.0,  1597704066.0},
-  {2327544145.0,   718699089.0,   349343089.0,  4101628907.0,  3318928407.0,  1089117499.0},
-  {  30564969.0,  3328478634.0,  2982489270.0,  2117094581.0,  1373799406.0,   263227994.0},
-  {3361309480.0,   167160432.0,  1101044675.0,  2483331578.0,  1222627656.0,   888813516.0},
-  {1343694367.0,  3729198232.0,  3607858651.0,  3637921829.0,  3215870119.0,    44217842.0},
-  {1257629005.0,   782190829.0,  1721403379.0,  2964991173.0,  1650991426.0,  1200043165.0},
-  { 242566874.0,  2942243157.0,  2933369527.0,   141121326.0,  2978896897.0,  3592371705.0},
-  {2118629504.0,  1401152624.0,  2462099872.0,  3757132841.0,   397460806.0,  3471336679.0},
-  {1779707878.0,    39593611.0,  2372300775.0,  2224875850.0,  3861154071.0,   100240285.0},
-  {3070499165.0,   168593313.0,  2898823963.0,  3169288205.0,  2674314210.0,  3374346002.0},
-  { 264417509.0,   458378468.0,  1456522872.0,  3178255554.0,  1731679649.0,   852404730.0},
-  {2685659093.0,  2922903994.0,   450792786.0,    26433501.0,  2739703862.0,  2396286722.0},
-  { 805017723.0,  3010461951.0,  2971214905.0,   118475090.0,  2899871671.0,  1568805684.0},
-  {1647747743.0,  2728376881.0,  3763135225.0,  3375428774.0,  2499572705.0,   915558698.0},
-  { 711508597.0,  3942011041.0,  3566721754.0,  3786898948.0,   982451357.0,  2710072666.0},
-  {2720839255.0,  2330028525.0,  1201182642.0,  2499459274.0,  3664913011.0,   693573160.0},
-  {3909677717.0,  3724610663.0,  2598319070.0,  1933861059.0,  2311987432.0,  1080305611.0},
-  {  33429679.0,  2716109264.0,   129622104.0,   773652348.0,  1447988245.0,  2250933339.0},
-  {3151776277.0,   531724888.0,  3041475641.0,  1794016008.0,  1373471758.0,  1197813532.0},
-  {2302961675.0,   174415600.0,  2146892934.0,  1386078430.0,  1266055834.0,   156769215.0},
-  {2261892721.0,  1666646131.0,   129324849.0,   955472930.0,  2635087848.0,  2592646000.0},
-  {2527017494.0,  3185439803.0,  1688712983.0,  3749811500.0,   136310800.0,  2027146350.0},
-  {2021672757.0,   132623461.0,  3401928488.0,  2955990578.0,  1425958156.0,   824906946.0},
-  { 292224579.0,  3078143660.0,  1892179490.0,  1095913477.0,    71798226.0,  3483864242.0},
-  {4127113667.0,   359666881.0,    40864393.0,  1157020310.0,  4294036359.0,  1627771053.0},
-  {2626002378.0,  1327701109.0,  4066528717.0,  1421242015.0,  3180442396.0,   803912739.0},
-  {1287847722.0,  2604534081.0,   466044786.0,  3254788496.0,  3352812074.0,  1106912115.0},
-  {3871592228.0,  3771689588.0,  2934666145.0,  2966416871.0,  4253297767.0,  1735028203.0},
-  {2212236928.0,  2048220512.0,   928831272.0,  1588042763.0,  4070781585.0,  1966095581.0},
-  {3854930059.0,  2538441388.0,  3575402921.0,  3899618852.0,  2766123465.0,  3584557372.0},
-  {1811166888.0,  1682484318.0,  3846560467.0,   155187066.0,  3046467351.0,  2592975774.0},
-  {2742361786.0,   607779983.0,  1530109487.0,  2140610917.0,  2064203190.0,  4076701084.0},
-  { 481148453.0,  2315137312.0,   552533149.0,  3955749830.0,  2403472653.0,  3105217329.0},
-  {1220291660.0,  3315389545.0,  1410069440.0,   570619348.0,  1506876991.0,  1261779049.0},
-  {4173668761.0,  3281100745.0,   767380306.0,  2753213563.0,  3511045000.0,  1375074130.0},
-  {1203047952.0,  3125111446.0,  4090412561.0,  1709348698.0,  2534661971.0,  3569025501.0},
-  { 831698681.0,   331527542.0,  1796082631.0,  3878061683.0,  3690848975.0,  2513328516.0},
-  { 155931633.0,   541011996.0,  3394449786.0,  3418372970.0,  3481901127.0,  1420202423.0},
-  { 107182653.0,  1815037432.0,  2047849696.0,   153576322.0,  4200671627.0,  2198036594.0},
-  {2173249394.0,  1938688377.0,  3823315566.0,   217045242.0,   844388138.0,   146744017.0},
-  { 742419591.0,   617452152.0,   384196514.0,  2320170690.0,  2504826870.0,  1911450066.0},
-  {  57643038.0,  2465011853.0,  3804966549.0,  2522794292.0,  1843507232.0,  4156487382.0},
-  {2816587394.0,  4144373258.0,    78093411.0,  2009836109.0,  2870566522.0,  3115176965.0},
-  {2804775404.0,   652473152.0,  3171544191.0,  1399563897.0,  2911184377.0,   571383239.0},
-  {1474422304.0,   638901859.0,  3998814419.0,  3971209678.0,  2836512868.0,  1228402489.0},
-  {2919269344.0,    67214752.0,   379650938.0,  2848457846.0,  2086588724.0,  3277261050.0},
-  {2331111753.0,  1721215232.0,  3212212695.0,  2464599642.0,  3813719032.0,    20759042.0},
-  {1434885143.0,  2254068110.0,   328405224.0,   872307308.0,   921816251.0,  1555098156.0},
-  {1635105806.0,  3657085387.0,  1345423291.0,  3675231874.0,  1008171633.0,  3402990860.0},
-  {2459868225.0,  2802471264.0,  3245238860.0,  3584071518.0,  2627185242.0,     4647622.0},
-  {4230329233.0,  4228211955.0,   808856459.0,  1455436717.0,  2009778913.0,  1197065984.0},
-  {2795085678.0,  3756504463.0,  3939318246.0,  3525612225.0,   569284634.0,  3803981197.0},
-  {2866924309.0,  4285520252.0,   275101079.0,  1972845588.0,  2767036941.0,  2447433665.0},
-  {2084829612.0,   978482141.0,  3412416288.0,  3625069701.0,  2424252553.0,  3589553529.0},
-  {1823681247.0,  2667042330.0,  4214293313.0,   277760359.0,  1365536300.0,  3097375126.0},
-  { 138359752.0,   920722351.0,  2763233243.0,  2976695054.0,  4221002312.0,   580281735.0},
-  {2523303543.0,  1927232492.0,  3886954357.0,  3837451694.0,   252156677.0,  4061782492.0},
-  {3785738853.0,  1853866646.0,   818618606.0,  4229419903.0,   708015345.0,  1423984749.0},
-  {2819291869.0,  2925710180.0,  1128386968.0,   976796775.0,  1816314745.0,  1419689571.0},
-  {1611970284.0,  1189155318.0,   828841958.0,  4141740018.0,   169203971.0,  2720078083.0},
-  { 186717395.0,  2879115443.0,  3207035406.0,  3069227764.0,  2352438144.0,  3655288731.0},
-  {3566555916.0,  3273732022.0,   534531433.0,  2166298007.0,  3451996128.0,  1267045260.0},
-  {2797618017.0,  1629729495.0,  3431990129.0,  3112821639.0,   740494673.0,   765338030.0},
-  {2971151659.0,   822310516.0,  1553312361.0,   619101753.0,  1909655424.0,   934887544.0},
-  { 729142757.0,  2257275056.0,  2783224022.0,   969723592.0,  3987893622.0,  1443481436.0},
-  {3403908951.0,  2272054612.0,   329091913.0,  2410759447.0,  1954421279.0,  3798726059.0},
-  {4074054300.0,  1937934718.0,  2647052068.0,   273036420.0,  3378411651.0,   126841508.0},
-  { 751699616.0,  2106587319.0,  1486440452.0,  3363118419.0,   717890003.0,  1244363914.0},
-  { 185175791.0,  1321326945.0,  1402626759.0,   885402625.0,   338382480.0,  1231333001.0},
-  {  79264672.0,   284858790.0,   839235529.0,  1285685191.0,  3474991354.0,   553136637.0},
-  {1888229732.0,  4100234124.0,  1147209878.0,  2619467656.0,  3979772939.0,  2724236581.0},
-  {1623946598.0,   372883704.0,   876194602.0,  1354570079.0,   918857933.0,  2725940185.0},
-  {3382778039.0,  2856023352.0,  3475193825.0,  3542300150.0,  1247843994.0,  1866850227.0},
-  { 449531154.0,   406308059.0,  2914166620.0,  4146382089.0,  1166491631.0,  1533049098.0},
-  {3164266743.0,  4176971404.0,  2338247370.0,  2166084826.0,  2567996320.0,  3888631385.0},
-  { 495890510.0,  2917487105.0,  2904033346.0,  1664944538.0,  2421214987.0,  2128999066.0},
-  {4029609821.0,  3959179606.0,  3890904600.0,   181343673.0,  3064372693.0,  1641324928.0},
-  {3402495456.0,  1767626895.0,  1027842616.0,   930083844.0,   921478651.0,  1502246998.0},
-  {1447695193.0,  1720681779.0,  2304474580.0,  1145245029.0,  3600031674.0,   695571141.0},
-  { 524046788.0,   606966184.0,  2159985415.0,  2080122224.0,   824811550.0,  3979548436.0},
-  {4173134181.0,  1471129067.0,   342125172.0,  2452906028.0,  2257645475.0,  1921969075.0},
-  {1451067442.0,  3311065385.0,  3507873780.0,  2074420960.0,  3423313309.0,  3390459453.0},
-  {3069023122.0,  1074286592.0,  1209146079.0,  3914927282.0,  1374544822.0,  3727178982.0},
-  {1535403090.0,  2198435846.0,  2349799514.0,   608567794.0,  1784099931.0,   733339182.0},
-  {2565257040.0,   478594628.0,  2735197845.0,  3091102625.0,   200446706.0,   493146630.0},
-  { 214177996.0,  3784339218.0,   869777902.0,  1365234452.0,  1005922531.0,  1361747745.0},
-  {1937012814.0,  1980434494.0,  3356013664.0,   346246765.0,  1551751326.0,  1708550772.0},
-  {2678421185.0,  2845545672.0,  3929679194.0,  1185748831.0,  4223932871.0,  1810897859.0},
-  {1473438138.0,  1376639040.0,  1372349496.0,  1702875423.0,  1652319216.0,  3794766736.0},
-  {2494768228.0,  2791303155.0,  2148967149.0,   560100777.0,  1539775750.0,  2332395502.0},
-  {1226093986.0,  3772022723.0,  1873239654.0,  1250906029.0,  3932474042.0,  3318060218.0},
-  {1251040510.0,   513005033.0,  3068921055.0,  4242190501.0,   411836604.0,  4141091015.0},
-  {3230082222.0,  4278709336.0,  1944711009.0,  2970892994.0,   492450776.0,   367591403.0},
-  {3752567949.0,  3220965763.0,  2662400747.0,   233706732.0,  3302049588.0,    25630487.0},
-  {1941950956.0,  3243340961.0,   865084135.0,  2575741054.0,   866696133.0,  1715748680.0},
-  {2236466160.0,   858538345.0,  3198684790.0,  4061200870.0,  1880336495.0,  3448677381.0},
-  {4050792949.0,   474305178.0,  4006128906.0,   704918155.0,  3302397723.0,   163875025.0},
-  {2925021627.0,  2112609401.0,   894172948.0,   582884740.0,  3249920838.0,  2390655488.0},
-  { 760780408.0,   641311863.0,   979761930.0,  2958177785.0,  1607167117.0,  2220497976.0},
-  {2489557504.0,  2374663244.0,  2521409627.0,  4094516260.0,   418039811.0,  1357811980.0},
-  {2606058500.0,  1597833493.0,  1020017894.0,  1925207955.0,  3756516916.0,  1775474866.0},
-  {4255415143.0,  1651443901.0,  3889670181.0,  3135368830.0,  3916942596.0,  3539878585.0},
-  {2796355172.0,     7807396.0,  2605148816.0,   316260918.0,  1099824177.0,   524068281.0},
-  { 737106589.0,   736514123.0,  2968828836.0,  3080120600.0,   158861346.0,  2744908312.0},
-  { 487543100.0,  3713522995.0,  2873554361.0,  3724103520.0,  3186163083.0,  1636549890.0},
-  {2577551934.0,  3004479333.0,  3796060030.0,  1367257153.0,  1503667945.0,  1633202619.0},
-  {1631371871.0,    88090931.0,  3930557130.0,  2009962632.0,  3649728958.0,  3512072910.0},
-  { 930521003.0,  2603438898.0,  2326013927.0,  4004929130.0,   337210299.0,  2760892683.0},
-  {1907067374.0,  2320769794.0,  1271888497.0,  1873008873.0,   790891538.0,  1755898484.0},
-  {1245211929.0,   424899001.0,  1363308412.0,  1750877108.0,  2289831476.0,   762397379.0},
-  {3208426600.0,  3900636482.0,  2997061666.0,   351768744.0,  1192974166.0,  2155431282.0},
-  {2262517382.0,  1076837480.0,  1013866699.0,  3069935702.0,   559302066.0,   459749288.0},
-  {2782495719.0,  3282287316.0,   500021559.0,   307626137.0,  3685083810.0,   593386005.0},
-  {2425376995.0,  2965843855.0,  2173239581.0,  2892783005.0,  3090090184.0,  1853751420.0},
-  {3871843471.0,  3282810631.0,  1411341636.0,  2759151716.0,  2638907713.0,   172039290.0},
-  { 415695575.0,  2363553559.0,   191141111.0,  3420501538.0,   444401459.0,   105277675.0},
-  {4204385875.0,  1603626388.0,  3611499813.0,  2379655745.0,  2929862538.0,    70046824.0},
-  {2693584420.0,  4043965311.0,  3139332930.0,  1548654988.0,   495259112.0,  2514182024.0},
-  {3389111643.0,  2406345157.0,  1566164481.0,   544495236.0,  2812825639.0,   204853282.0},
-  {2448453221.0,  3789261776.0,   352916306.0,  2024136068.0,  2585907973.0,  1359340076.0},
-  {1260759752.0,  1161883920.0,  3177883248.0,   142645975.0,   972193376.0,  3014666215.0},
-  { 483784213.0,  3617627125.0,    65466601.0,   491144577.0,  2647249020.0,  1122962452.0},
-  {2116751505.0,  1562297789.0,  3092455523.0,  2453816465.0,  1630752429.0,  3757825864.0},
-  { 946877456.0,  2638014367.0,  3534941802.0,  3586736503.0,  4118056876.0,  2183736038.0},
-  {3017192246.0,   787574407.0,  4040868460.0,  2908931090.0,  3622680338.0,  3166234133.0},
-  {2635371288.0,  3400402077.0,  1325184079.0,   139884770.0,  3778868930.0,  3475172745.0},
-  {3426789220.0,  2776197889.0,  2520375265.0,  3711822172.0,  2153152047.0,   694035090.0},
-  {2545101991.0,   368444448.0,  1163092609.0,  2899729857.0,  1326060526.0,  2870186805.0},
-  { 804327308.0,  2203563548.0,  2691083954.0,  3755168551.0,   172613596.0,  2030290846.0},
-  {2071556156.0,  1577838541.0,   836504016.0,  3470549596.0,  1733134298.0,  1734080337.0},
-  {1773020488.0,  3702396143.0,   766089727.0,  1791196346.0,  1957305122.0,  4139913394.0},
-  {3167805957.0,  1350232355.0,   656788740.0,  3523514493.0,  2708653643.0,   521495326.0},
-  {2392707379.0,   781103031.0,  1029873020.0,   457663589.0,  3107018447.0,  1160237768.0},
-  { 835680233.0,  3230475281.0,   621861744.0,   458049113.0,  3097785436.0,  4012138216.0},
-  {1607771222.0,  3719290791.0,  2727599325.0,  2230354870.0,   446294758.0,  1303371069.0},
-  {2913771128.0,  1119891373.0,  1104463504.0,   562265888.0,    67489501.0,  2778264169.0},
-  { 827897751.0,  2577517345.0,  1390267319.0,  2030029750.0,  4110185822.0,  1894021172.0},
-  { 128275735.0,  2481226587.0,  1565692579.0,  1017841765.0,  2025577981.0,  3034301072.0},
-  { 750840936.0,   813680961.0,   199542503.0,  1774097372.0,   737466521.0,   891124230.0},
-  {2173147267.0,  1530282591.0,  3915099391.0,  1423697306.0,  1757458432.0,   973023183.0},
-  {1717022952.0,  3061701951.0,  3904064076.0,  2936188258.0,   825110006.0,  1018679588.0},
-  {3631075874.0,  3017237842.0,  4077166279.0,  4142192163.0,  1057261791.0,  3149083994.0},
-  {3713112125.0,  2511090632.0,   434524025.0,  1219186268.0,  2964792131.0,  1971647965.0},
-  {1472732761.0,  2810500713.0,  3838589556.0,  2446533285.0,  2561253964.0,  2588029987.0},
-  {4191642841.0,  3802822338.0,  1413309102.0,  2582958846.0,  2001411821.0,   152936876.0},
-  {2039896782.0,  1186719552.0,  1111682226.0,   155146423.0,  1836209261.0,  3186615190.0},
-  {3532911155.0,  4186450806.0,  1089620162.0,  1714743147.0,  1254550948.0,  1116337321.0},
-  {2951427271.0,   397431233.0,   843481672.0,  2093233394.0,   714170195.0,  3764566506.0},
-  {   9835719.0,  3912186265.0,  1771542155.0,  3323809696.0,  1300921835.0,  2412944465.0},
-  {3694835287.0,   173488577.0,  2561569558.0,   777874538.0,  3593452808.0,   549128394.0},
-  {1965609296.0,  4093639496.0,   147946952.0,  1871029084.0,  3270000085.0,  3520802947.0},
-  { 250866984.0,  4190145983.0,  1487402746.0,  2899788620.0,  2004615136.0,  4075865147.0},
-  {3848827755.0,  1650238499.0,  1521676406.0,  2215540140.0,  1099997356.0,  2324693645.0},
-  {1420629758.0,  1175495097.0,  2403005501.0,  3600906853.0,  3417069489.0,  3251082460.0},
-  {2197028292.0,  3977871315.0,  1240380353.0,   213265173.0,   426275588.0,  3678744588.0},
-  {2528802812.0,  1418167868.0,   110179419.0,  3891895373.0,  2895481690.0,  2278199503.0},
-  {3331974613.0,  3033820228.0,  1979820675.0,  3138198970.0,  3548773347.0,  1555280786.0},
-  { 385293522.0,  3051884188.0,  2477127480.0,  3970858686.0,  1068164208.0,  2626838831.0},
-  {3997086227.0,  3812316362.0,   910176324.0,   725847167.0,  2546448413.0,  2843206996.0},
-  {1545351591.0,   518508160.0,  4065961221.0,   832565276.0,  3253560666.0,  3543983858.0},
-  {  23722490.0,  1238641419.0,   394761596.0,  2467248478.0,   352125150.0,  1736525277.0},
-  {2382247416.0,  2623128802.0,  1477685940.0,  1143295838.0,    71377835.0,  2519091467.0},
-  { 824089338.0,  2086498867.0,   676260345.0,  1484496017.0,  2454580725.0,   845453635.0},
-  {2195879068.0,  3967571441.0,  3152325532.0,  3369370323.0,   770951813.0,   446190589.0},
-  { 814440759.0,  2481678694.0,  2324327960.0,  2455212250.0,   364917134.0,  3425970854.0},
-  {2308038549.0,  3198215416.0,  1994929792.0,  2260419764.0,  2347263575.0,   436834986.0},
-  {2055764533.0,   502965383.0,  2858556424.0,  3310245176.0,   146811706.0,  1202128280.0},
-  {2163716930.0,  4238471632.0,  2579812513.0,  2615328173.0,   859593180.0,  1952206143.0},
-  {4205310229.0,   597882722.0,   216677337.0,  2115849892.0,  1565116968.0,  1287222616.0},
-  {1086201550.0,  3542532235.0,  2926522688.0,  3769319325.0,  3509714603.0,  1274371382.0},
-  {3734035304.0,  1075748491.0,  1962619084.0,  2702933159.0,   966759269.0,  3876575152.0},
-  { 426846314.0,  1410768562.0,  1426860349.0,  3810775568.0,   978387070.0,  2742571042.0},
-  {3381657822.0,  1174962584.0,  1784217874.0,  1012354384.0,  2837854936.0,  3836627105.0},
-  { 111977587.0,  1664392552.0,  1405048942.0,  4218649223.0,  1973153337.0,  1190362141.0},
-  { 689849661.0,  1138033345.0,  3542917353.0,  2043038024.0,  3503718316.0,  1275646925.0},
-  {3310393721.0,  2651706892.0,  1385373117.0,   924848295.0,  2022361510.0,  1445885153.0},
-  {2745523291.0,  2705927586.0,  1273723533.0,  1792079428.0,   889313085.0,  3369228200.0},
-  {2014898674.0,  3642785817.0,  1836782600.0,  3353971187.0,  1534033210.0,   756902521.0},
-  {2986253024.0,  2416407141.0,  1429035010.0,  2556754460.0,  1981031120.0,   942383611.0},
-  {2739963251.0,  1215709025.0,  2787563044.0,   545142130.0,  2408551431.0,   843654515.0},
-  { 134415525.0,   621843659.0,  2610779465.0,  3532028143.0,  1908687062.0,  2524647535.0},
-  {4046744715.0,  2842229466.0,  1002737138.0,  1225172163.0,  1746901562.0,  2428740437.0},
-  {3890031015.0,  3568606825.0,  2652776392.0,  2285991299.0,  2321148089.0,  1861961063.0},
-  { 977389915.0,  4009609053.0,  1885064573.0,  1582435070.0,  1111135687.0,  1551197392.0},
-  {3800433961.0,  1419090104.0,  3633496654.0,  3988473785.0,  2881375609.0,  1577329394.0},
-  { 632376691.0,  2580159682.0,   882911358.0,  4154501000.0,  4115766152.0,   572804868.0},
-  { 906008736.0,   509340358.0,  3836413329.0,  4238304532.0,  2604489296.0,    54372516.0},
-  {1913781677.0,  2991460493.0,  3451261491.0,  1988618105.0,  2584154422.0,  3789269085.0},
-  {1538425787.0,  1388508368.0,  2610865802.0,  2181615974.0,  1213213545.0,  2316880305.0},
-  {  61896747.0,  2540214604.0,  2212834744.0,   287774341.0,  2403485209.0,  1498529461.0},
-  {3715440401.0,  2686330311.0,  1127771403.0,  2224500176.0,  4123672758.0,  3370305741.0},
-  {2392151039.0,  1128734428.0,   412143847.0,  2061422085.0,  3599308810.0,  4154376429.0},
-  {1110912122.0,  1447579523.0,  1778003207.0,  2141498485.0,  4142588360.0,  2660444792.0},
-  { 802565313.0,  3950093339.0,  4268914452.0,  2028708067.0,  1578506631.0,  3893686638.0},
-  {1227259310.0,  3466305096.0,  3724725713.0,  2470217375.0,  3765813113.0,  3197699210.0},
-  {3988904887.0,  1871149747.0,  2802586440.0,  1183634597.0,  2368912587.0,  2978369622.0},
-  {1451236764.0,  2084796379.0,   116492777.0,  3912725154.0,  4155665630.0,  1740578889.0},
-  {4246684489.0,  2813797694.0,   937037443.0,  2020532434.0,  4131156169.0,  3998536215.0},
-  { 283771911.0,  3152331586.0,  1262925779.0,  2548242768.0,  2520098775.0,  3111133931.0},
-  {3820588693.0,   803563980.0,   295536818.0,  1477771246.0,  1670205066.0,  3387365842.0},
-  {3223336737.0,  1927680980.0,   142935083.0,  1165410794.0,  2940082976.0,  4121916597.0},
-  { 894703279.0,  3963072869.0,  2165277798.0,  3216253131.0,  2789173154.0,   909604181.0},
-  { 390907280.0,  3564240610.0,   767457769.0,   645257649.0,  1494283599.0,  3409659731.0},
-  { 204773333.0,  2814812632.0,  2583943513.0,  4268751894.0,  4110495586.0,   987999701.0},
-  { 954036557.0,  2828383971.0,   696967208.0,  1371219785.0,  2208708603.0,  2484471111.0},
-  {1429184698.0,  2642808969.0,  2554435160.0,   169508906.0,  3923597868.0,  2157572998.0},
-  {2812322896.0,  2030437875.0,   283383918.0,  3060684118.0,  3783404517.0,  2815319068.0},
-  { 187575856.0,  2541535080.0,  1131669711.0,  3543888742.0,  1827599568.0,  2221412742.0},
-  {3063777137.0,  2071354287.0,  4234255445.0,  3923136484.0,  3751452396.0,  1169670483.0},
-  {4192483945.0,  3434761370.0,  1976847675.0,  1175023030.0,  3841142524.0,  3457258997.0},
-  {2669073672.0,  3772029588.0,  2709590625.0,   271411736.0,  1467504193.0,  2220656659.0},
-  {3929162510.0,  3942545304.0,  3325560968.0,  2940589527.0,  1779852999.0,  2289190122.0},
-  {1759320855.0,  3264447645.0,  1029008295.0,  1473785680.0,   868195993.0,  4164096274.0},
-  {1873838013.0,  2399317237.0,  1410225522.0,  3419226778.0,  1084976303.0,  1939564888.0},
-  { 347979417.0,  2221996137.0,  3278748905.0,    51076685.0,  2621290495.0,  4177579307.0},
-  { 641647694.0,  1870651510.0,   565189381.0,  4225835518.0,   320071835.0,  3576261322.0},
-  {3487519737.0,    45869995.0,  3110551469.0,   319365287.0,   454028844.0,  1121527233.0},
-  {2214170415.0,   359153669.0,  1625680252.0,  2334498747.0,  3872920048.0,  2895059869.0},
-  {2563550725.0,   632091714.0,   189386439.0,  2700408724.0,  1229169723.0,   532293609.0},
-  {2861851069.0,  3530089744.0,  3714174155.0,   449834893.0,  1041086958.0,   417366068.0},
-  { 167539128.0,  1221081897.0,  3291674132.0,  2741771098.0,  1024486788.0,  2787438800.0},
-  {1583700818.0,  2813944297.0,  3039586740.0,  1859323765.0,  3521461656.0,  2631017731.0},
-  {2769794576.0,  2944273287.0,    93268967.0,    85021695.0,  1392466941.0,  4115381849.0},
-  {2924675877.0,  4214656651.0,  1923453076.0,  2461127194.0,  3867982054.0,  2050058221.0},
-  {1741420417.0,   135446331.0,  2655065621.0,   109889532.0,   934262934.0,  1819612098.0},
-  {1987466118.0,   220505008.0,  1060758167.0,  1002161510.0,  1468681982.0,   616419193.0},
-  {4117738347.0,  3833041750.0,  1562919103.0,  3633188657.0,  1384889332.0,  2454858152.0},
-  {1111367568.0,  2019684378.0,  1885501789.0,  1298281883.0,  2833589370.0,  4112514702.0},
-  {2245171262.0,  3209259225.0,  1402022978.0,  4086113058.0,  3246677528.0,  1758942350.0},
-  {2506247626.0,  4010054802.0,  1599234515.0,  3945310801.0,  2117182521.0,   226839221.0},
-  {1988643141.0,   850642388.0,  1044733324.0,   914653280.0,  1072903805.0,  3376504884.0},
-  { 281805655.0,  2281262718.0,  2542507467.0,  1165830438.0,  2880083745.0,   703918680.0},
-  { 565239572.0,  4091658098.0,  2459364280.0,  1142489594.0,  2751514237.0,  3853083115.0},
-  {1766591829.0,  2685325000.0,   646841828.0,  2188069745.0,   142509439.0,  2445118440.0},
-  {1142349862.0,   611203007.0,   711199908.0,  2059708650.0,  2809038413.0,  3247621637.0},
-  {3464354481.0,  3607921813.0,  4058404288.0,  1455913980.0,  3806100240.0,  3378761070.0},
-  { 493274345.0,  4148900335.0,  2644793211.0,  3134060010.0,  1596561302.0,  2178310778.0},
-  { 339449658.0,  4273008688.0,   337502613.0,   202248488.0,  3531901637.0,  1344867924.0},
-  { 913267726.0,   300749415.0,   106323258.0,   805473193.0,  1125950631.0,  3919056402.0},
-  {1375397466.0,  1320252229.0,  2270109016.0,  1692102740.0,   420921669.0,  4146180886.0},
-  {2379210828.0,  3567283624.0,  1563624932.0,  2025522165.0,  2876970892.0,  2381586279.0},
-  {3018589210.0,  1165924646.0,  1625658070.0,  1441476470.0,  2350441087.0,  3449868561.0},
-  {1912640561.0,  1655812597.0,    79421416.0,  1348779272.0,  4130859748.0,  3526776733.0},
-  { 188752760.0,   383964693.0,   799505562.0,  4161853669.0,  4174104973.0,  3234218504.0},
-  { 217062733.0,  4278207152.0,  1815709894.0,    59673304.0,  3731835167.0,  4086395793.0},
-  { 752022221.0,  3770481421.0,  1207122616.0,  3143029008.0,   939496357.0,  3277469128.0},
-  {1451989018.0,    55065593.0,  3216677857.0,  1165322815.0,   439026891.0,   806333784.0},
-  {1806721332.0,  1808464132.0,  2380493314.0,  3129696359.0,  3302686774.0,   974656808.0},
-  {1007697039.0,   193654631.0,  2164078236.0,  3670752137.0,   945191275.0,  2570853857.0},
-  {2317876274.0,  3240970137.0,  4134725689.0,  3352982631.0,  1355699126.0,  4169149049.0},
-  {2969048728.0,  3118410115.0,  2936788002.0,   350717820.0,  4110780133.0,  3630689848.0},
-  {3784709092.0,   107684252.0,  3366903208.0,  2042179805.0,    60604909.0,  1485249246.0},
-  {2111918946.0,   282192399.0,  1954501472.0,  4215041779.0,  1232313157.0,  3673523253.0},
-  {2216551089.0,  3663952251.0,  3156902565.0,  2880312177.0,   774920855.0,  1124722534.0},
-  {1773760517.0,   121928116.0,  1947136576.0,   605106173.0,   516616988.0,  1011701904.0},
-  {  24447078.0,  3624153954.0,   522577665.0,  4238428200.0,  1953290394.0,  3670362349.0},
-  {1636330282.0,  2337028734.0,  2561845814.0,  3154660487.0,  3476058894.0,   853961317.0},
-  {2679086351.0,  2319141547.0,   466233022.0,   442108908.0,  3458493698.0,   157994178.0},
-  {2494318437.0,  1414706351.0,  3469737532.0,  3126827809.0,   876300225.0,  3918824191.0},
-  { 380271027.0,  2624365803.0,  2559579309.0,    51838146.0,  1504651032.0,   665877154.0},
-  {4175508542.0,  1274143991.0,  3527712511.0,  2019964552.0,   737176791.0,  1088528339.0},
-  {2166308443.0,   635040150.0,  2316874100.0,  2684199162.0,  3075874509.0,  1644442909.0},
-  {3329976770.0,  4057157340.0,   658724833.0,  2658467360.0,  3010347227.0,  3049860167.0},
-  {3484386973.0,  3740489975.0,  3135861970.0,   791210824.0,  2497347771.0,   419144857.0},
-  {2585870552.0,   112853105.0,  1665708891.0,   323552959.0,  2613078284.0,   420946202.0},
-  {2289630957.0,  2466703902.0,  4037294576.0,  4118662182.0,  1166399722.0,   397344690.0},
-  {2232850304.0,  2627684226.0,  1350995738.0,  2093988423.0,   629125570.0,   281127586.0},
-  { 584615791.0,   282409245.0,  1135692250.0,  3286249608.0,  4137312775.0,   419006380.0},
-  {4255842357.0,  1108170147.0,   341012934.0,  2253227894.0,  1586778254.0,  1522925373.0},
-  {  51238982.0,  3155192637.0,  2769899220.0,  2895123177.0,  3648101845.0,  3013698350.0},
-  {2386779818.0,  1762369809.0,  1815777998.0,  3902380663.0,  3889414705.0,  2539694262.0},
-  {2317757757.0,  2417079299.0,  3184603257.0,  3155539472.0,  2492695736.0,    38783718.0},
-  {1630390890.0,   459049847.0,  2326533696.0,   470616995.0,  2165926960.0,   706513423.0},
-  {1567507986.0,  3328961498.0,  3486571372.0,  2140006415.0,   575129303.0,   719746777.0},
-  { 956927323.0,  1842727759.0,  2891846166.0,   923116350.0,  2900218885.0,  4060687416.0},
-  { 533639300.0,   469229861.0,   711065368.0,  1046044856.0,  4052337829.0,  2427844495.0},
-  {2767993204.0,   575897849.0,   256532353.0,  1938151365.0,  2127052120.0,   546705074.0},
-  {3363301656.0,   802305130.0,  3356439090.0,  1322473504.0,  1366845161.0,   817872781.0},
-  {3919364798.0,  3671325247.0,   265671317.0,  3584056918.0,  1986774370.0,  1864158225.0},
-  {1891924045.0,   740874726.0,  2211469781.0,  3442398017.0,  1439405092.0,  1275815925.0},
-  {2713640407.0,   521727973.0,  1547837435.0,   799783509.0,  2784808475.0,  2290426260.0},
-  {2466120020.0,   442572249.0,  3808077586.0,   300140612.0,  1242481086.0,  1457318816.0},
-  {2087997471.0,  2193183391.0,  1852742304.0,  1231740331.0,  2953502025.0,  2918428195.0},
-  {2327727073.0,  4104247856.0,  4066837100.0,  1510382125.0,   522593410.0,  1843540542.0},
-  { 995230270.0,  3989520962.0,  2754726621.0,  3036255279.0,   519860719.0,   513571066.0},
-  {3837321835.0,  4153578662.0,    37086880.0,  2017084701.0,  2466971023.0,  3460384545.0},
-  { 309909262.0,  2787851258.0,  2892749601.0,  1623384714.0,  4251271618.0,  1015568649.0},
-  {4067396965.0,  2617486703.0,   188595692.0,  1315089489.0,  2569983121.0,   440251909.0},
-  {2578292475.0,   957354133.0,  3134555450.0,   903729906.0,  1595398795.0,  2320741694.0},
-  { 385017015.0,  4046187596.0,   748651976.0,  3702943604.0,  3988681010.0,  1610877700.0},
-  { 549391297.0,  4225189917.0,  2166547959.0,   259023146.0,  3896417354.0,  4032007560.0},
-  { 241013757.0,  4199104826.0,   776181267.0,  3746419544.0,  3125533865.0,  3770718287.0},
-  {2231639115.0,  2709788666.0,  2433605109.0,  4247029051.0,  4063137382.0,  2860386084.0},
-  {3560378810.0,  2461912304.0,  3335199373.0,  2936843227.0,  4274588339.0,   867130802.0},
-  {1071009051.0,  3899044830.0,   950703849.0,  1778056093.0,   484248485.0,  2366049045.0},
-  {2502964803.0,  1596705203.0,  3911290654.0,  3125947003.0,  1570722422.0,  3787632507.0},
-  {2371813359.0,  1465975044.0,  2531056027.0,   106901880.0,   812332618.0,   204329770.0},
-  { 221382135.0,  1794128135.0,  1414488314.0,  3800790731.0,   293795143.0,  1832791512.0},
-  {1237401182.0,  1033630335.0,  3309268472.0,   342972006.0,  2082148356.0,  1531087372.0},
-  {3696519001.0,  3368558373.0,   682018111.0,   256775914.0,  1908397070.0,   612178907.0},
-  {1960691608.0,  2472683272.0,  2108692850.0,   381014306.0,  1368654379.0,  3449652076.0},
-  {3192148673.0,  1369489588.0,   324716424.0,  4063998772.0,  1154511978.0,  2446991006.0},
-  {1858970615.0,   684660395.0,  1637043868.0,  2719912053.0,  1679605836.0,  3803212509.0},
-  {2202484409.0,  3114079745.0,  3615493770.0,   997401363.0,   759125463.0,  2168275378.0},
-  {2367148713.0,  1860338511.0,  1190230036.0,  2165611026.0,  1359085547.0,  2684214310.0},
-  { 321241955.0,  1962645692.0,  1366225114.0,  1609724523.0,  4146986271.0,     3829804.0},
-  {2952974573.0,  4119677354.0,   792853057.0,  3783804922.0,  3867324177.0,   743676104.0},
-  {2245868668.0,  4219701127.0,  1147699702.0,  2241407929.0,  4293401362.0,  3687108763.0},
-  {1457529899.0,  3279850420.0,  1749350334.0,  2111491262.0,  4080063128.0,  2401495696.0},
-  { 194809499.0,  4085164020.0,  1667185433.0,  2649063089.0,   886365063.0,  1668949264.0},
-  {1238780997.0,  1743030989.0,  1537952813.0,  3334939613.0,  2188971769.0,  3533358513.0},
-  {3710698160.0,  2881158049.0,  1338657914.0,  1350959190.0,  2276987668.0,  2748663087.0},
-  { 984261543.0,  2643754447.0,    66897092.0,  1964634418.0,    82069018.0,  3183907719.0},
-  {1360142629.0,   224100886.0,  3099890544.0,  2052911850.0,  3847850864.0,   103492809.0},
-  {3486784432.0,  1411988687.0,  3225742125.0,   565935240.0,  2007862320.0,   823355941.0},
-  {1824560903.0,   942392373.0,   333583177.0,  3990628969.0,  2181797775.0,  3224666088.0},
-  {1281737342.0,  2274903290.0,  3804209156.0,  2178547249.0,  3869005787.0,  1186025622.0},
-  {4134692197.0,  1893553025.0,  3316380482.0,  2116733417.0,  1120281825.0,  3440288572.0},
-  {3496891597.0,  2717587266.0,  2811609417.0,  3250058826.0,  1467882143.0,   369041548.0},
-  { 801948091.0,  3087604649.0,  2021552833.0,  1368553110.0,  2284972314.0,  1317118278.0},
-  {3138290243.0,  3687210847.0,  4290809593.0,  1012803127.0,  3736432264.0,  3058039530.0},
-  {2473861314.0,  4141677244.0,  3094932043.0,  2318287259.0,  1828867312.0,  3748531122.0},
-  {3733526167.0,   476049972.0,  1338760246.0,  1568475574.0,  3092996089.0,   844086636.0},
-  {  17301720.0,   128874548.0,  2648734141.0,  3210948270.0,  3251368601.0,  1407138078.0},
-  {1424883075.0,   986368342.0,  4083719754.0,  3740594713.0,   274043977.0,   680305765.0},
-  {2775084033.0,   306099180.0,  4274281466.0,  2067143399.0,  1815210876.0,  3797620989.0},
-  {3277629528.0,  3205348712.0,  3370955990.0,   797069698.0,   199679619.0,  1458281100.0},
-  {4194697790.0,  4166510873.0,   701058706.0,  1387648743.0,  2007899339.0,  4157236711.0},
-  {3943463373.0,    25508716.0,  2720002937.0,  3954867335.0,   902270755.0,  3007511453.0},
-  {3188291763.0,  1080635672.0,   467182668.0,   462286267.0,  1526607385.0,  1562291606.0},
-  {3872645290.0,  2701782956.0,  2906907696.0,  3331729889.0,  4255610698.0,  3433481404.0},
-  {4054851323.0,   791200895.0,  2854863450.0,  2413740413.0,   668808793.0,  3022605715.0},
-  {2385137101.0,  3640072982.0,  2333666902.0,  3497792068.0,  2128806051.0,  1877738155.0},
-  { 526457580.0,  1029240226.0,  3949114267.0,  3499655717.0,  4193334757.0,  3411596236.0},
-  {2157094094.0,  1206454707.0,   749089877.0,  1584317980.0,  4013398400.0,  3409203828.0},
-  {3972938440.0,   105732932.0,    69871970.0,  3423664471.0,   712992998.0,  3237502364.0},
-  {1480483623.0,  1373026115.0,  1430732495.0,  3946662355.0,   572501340.0,  3053665828.0},
-  {  59407310.0,    20841640.0,  2514750719.0,    97086877.0,  1109288878.0,  1743156986.0},
-  {2697487888.0,  1386652824.0,  3779117722.0,   443162230.0,  3592037463.0,  1409090955.0},
-  {4108668886.0,  2509539713.0,  2783399111.0,  4100257081.0,   177804710.0,  3026984273.0},
-  {3020445640.0,  1479672407.0,  2845601243.0,  2211005101.0,  3973761025.0,  3932406833.0},
-  { 526594249.0,  2479446195.0,  2187200122.0,   563170681.0,  1423575827.0,  2316091766.0},
-  {3648186980.0,   823253212.0,  3357486699.0,  2340612016.0,  1603057414.0,  3749697440.0},
-  {2921009997.0,   314324178.0,   705249682.0,   920275306.0,  1684269455.0,  1647755606.0},
-  {2661756361.0,  1654248845.0,  2721259226.0,   341700680.0,   699729568.0,  3626917811.0},
-  {3854848442.0,  2255880917.0,  1107669370.0,  2714984365.0,  1983605429.0,  1442201039.0},
-  {3331234099.0,   116234859.0,  1483735577.0,  2235412528.0,  3873266357.0,  2623536000.0},
-  { 524769087.0,  2722169676.0,  1571854987.0,  2074167686.0,   650258645.0,  2423071714.0},
-  { 818853710.0,   921379465.0,  3267017281.0,   495771276.0,  2799118003.0,  1133759270.0},
-  { 182991254.0,   147304460.0,   384680199.0,   752849046.0,  1198259352.0,  2847842221.0},
-  {3717498404.0,  2622605096.0,  4266552840.0,  1436216099.0,    39934682.0,  3783894942.0},
-  {2174646671.0,  2045138977.0,  1621873423.0,  3509148287.0,  1025831216.0,  3241551191.0},
-  {3248429028.0,  2441744517.0,  2229399592.0,  1708591221.0,  1252737337.0,  2058112215.0},
-  {3624239755.0,   369993000.0,   675505497.0,   761272570.0,  3308636010.0,  4222571472.0},
-  { 340918785.0,  2889630068.0,  4277899911.0,   328370602.0,  2374978995.0,  2966271504.0},
-  {2748186728.0,  1436896481.0,  3602922780.0,   428100423.0,  2249817704.0,  4271956536.0},
-  {2034777115.0,  3673958728.0,  2295984116.0,  1903617322.0,  2490717786.0,  1034024062.0},
-  {2875786755.0,  2853510455.0,  2619273332.0,  3990770210.0,  3628691154.0,  3173819657.0},
-  {1027661116.0,  3892512264.0,  3976663917.0,  2558797994.0,  3465438144.0,  3057509564.0},
-  {2708774649.0,  3226003366.0,  3552346458.0,  1103356990.0,  3763191538.0,    70306413.0},
-  {3044101560.0,   674016926.0,  2705891901.0,  3201759632.0,    86819646.0,  3801131105.0},
-  {1536294611.0,  4160526078.0,  3855276602.0,  2012873661.0,   748768753.0,  3652123796.0},
-  {1299228785.0,  3412505487.0,  2013303610.0,  3371772476.0,  2047681252.0,  3093987100.0},
-  { 249988003.0,  4278799351.0,   339151710.0,   108308594.0,  1201696438.0,  2480174248.0},
-  {3989779612.0,   407917167.0,  2144880065.0,  3766612863.0,   960317317.0,  1694741707.0},
-  {1095371277.0,  1958394598.0,  1919626087.0,  1169441030.0,  3699359147.0,  3922910403.0},
-  {  50259909.0,  3975394949.0,  3088026552.0,  3892801032.0,  2865009342.0,  3664907144.0},
-  {1238422523.0,  3699185552.0,  2523897572.0,  3443476556.0,  1209821004.0,  4208204307.0},
-  { 494352199.0,   128413240.0,  2837564881.0,  1888283906.0,  1490164910.0,  3539497386.0},
-  {3316517545.0,  3230163045.0,  1145788170.0,   671202149.0,  2530966907.0,  2617197729.0},
-  {2782504669.0,  4092345758.0,  1147257045.0,  4241725352.0,  2103670541.0,  1565436877.0},
-  {4060465930.0,  3860583923.0,   412405470.0,  2401133267.0,  2885694249.0,  2723370016.0},
-  {2255757059.0,   155123959.0,   423984231.0,  2318326039.0,   453129340.0,  1278964172.0},
-  {4151240999.0,   287872275.0,  3981512941.0,   304479195.0,  3384968274.0,  3317284275.0},
-  {2157781735.0,  3879617179.0,  3273290648.0,  1844166767.0,  2063356811.0,  3995461144.0},
-  {3904046375.0,  3760685052.0,  3226741390.0,  2008648023.0,   488657228.0,  2549693578.0},
-  { 469020039.0,  1519877120.0,  1165143376.0,  2050921735.0,  2528732805.0,  3294754086.0},
-  {4249787254.0,  2365255361.0,  2467669507.0,  2965658435.0,   869601112.0,   901722724.0},
-  {2239118817.0,   471169086.0,  3995765714.0,  1029148425.0,  1077106054.0,  2217251505.0},
-  {1487496004.0,   942987611.0,   871618765.0,  1483656747.0,  2321503045.0,  3766611080.0},
-  {1036101947.0,   853464356.0,  1757329834.0,  3105906374.0,  2910696272.0,  2831841748.0},
-  {3912960620.0,   492319621.0,  1884032376.0,  1846765423.0,  2094696507.0,  3086949491.0},
-  {3150846170.0,  2810443659.0,  4038049831.0,  2095439627.0,   978531201.0,  3142005127.0},
-  {  20051605.0,  1380992287.0,  3781848128.0,  3118077192.0,   572702948.0,  4239116986.0},
-  {1772441392.0,  1160737959.0,  2978033744.0,  3210499418.0,  3776235907.0,  4012104399.0},
-  {    403308.0,  2400374920.0,  2151423721.0,  1461841655.0,  4294371857.0,  2451056412.0},
-  {1686511930.0,  3163428074.0,  1825846343.0,  1655886156.0,  1281379152.0,  3218300206.0},
-  {1167927746.0,  1237724271.0,  3127201282.0,  1635791292.0,  1896208972.0,  1144624405.0},
-  {4155349189.0,   267052787.0,  3753786854.0,  3894827743.0,    49379433.0,  2416919341.0},
-  {1630482631.0,  4212923433.0,    17919814.0,  3971975005.0,  1211139244.0,  1683525296.0},
-  {1853981475.0,   921965924.0,  2194811727.0,  3453528898.0,  3726725251.0,  1236142945.0},
-  {3636785739.0,  3523505333.0,  2634536321.0,   494695201.0,   979415428.0,  1083517215.0},
-  {2696856326.0,  2176952129.0,  2155384040.0,   503939551.0,  1566134540.0,  4041082205.0},
-  {4003680365.0,   115936224.0,   906247637.0,   165538559.0,  3482063077.0,  1982373287.0},
-  {2997034401.0,  3452638536.0,   254559998.0,   754573662.0,  3487453222.0,  2202108175.0},
-  {1302991050.0,  1595292110.0,  4030041517.0,    53964309.0,  2725210763.0,  1235133089.0},
-  {1128308099.0,  3913799822.0,  4226727119.0,  2520165388.0,  1491388215.0,  2537284848.0},
-  {3562795156.0,  1813722522.0,  1617481392.0,  3518533732.0,  2447210020.0,  3114212971.0},
-  {1909614984.0,  4229901169.0,  2995938695.0,  2240783662.0,  2138629084.0,   556426323.0},
-  {1342973273.0,  2270223712.0,   616903164.0,  2305188066.0,  4265239081.0,  1823603827.0},
-  {  82730196.0,  3966987695.0,   380016060.0,  1671110450.0,  3576384144.0,  1790552388.0},
-  {2696276000.0,  4019239125.0,  2904067506.0,  3611048701.0,  3464387153.0,  1504542805.0},
-  {1111576712.0,  2507592572.0,   838464422.0,   185936566.0,  1801320570.0,  3564094752.0},
-  { 806142499.0,  1716994233.0,   568730156.0,   339644179.0,  1821279530.0,  3109912943.0},
-  {1104476828.0,  3303712497.0,  2595748741.0,   735149745.0,  3361464512.0,  3852558133.0},
-  {2214986722.0,  1915423713.0,  2018955704.0,  3712601743.0,  3163528429.0,  3510848911.0},
-  { 136305698.0,  1354550843.0,  4140650046.0,  4249577209.0,  1382867023.0,  1429928032.0},
-  {1695839753.0,  2761631272.0,  1821107131.0,  2364779544.0,   336132275.0,  1428410068.0},
-  {1536344095.0,  3136552761.0,  1885922165.0,   697237139.0,  3365613137.0,  1097488584.0},
-  {2585758737.0,  3369256361.0,  1386013825.0,   277643792.0,  2675395103.0,   358030158.0},
-  { 101617343.0,  1072526669.0,   698190641.0,  1587976342.0,  2746154296.0,  1396285226.0},
-  {1916464240.0,  3634863925.0,  4277517677.0,  1841565073.0,  3429837149.0,  1373487244.0},
-  { 687449897.0,  2289350841.0,    49566585.0,     9231463.0,  1376334490.0,  1342536722.0},
-  {1894690460.0,   633056726.0,   251638524.0,   301079623.0,  3786389981.0,  3855191097.0},
-  {2063250766.0,  1405520057.0,  3418256983.0,  3995981111.0,  1205323110.0,  1515319102.0},
-  {2641648861.0,  3725180218.0,  2294246552.0,   987838829.0,  3116638950.0,  3451482131.0},
-  {1129272983.0,  1547546509.0,  3929938966.0,  1281666738.0,   900214944.0,  2598854423.0},
-  { 771377654.0,  1954614852.0,  4062533390.0,   230857194.0,   281505116.0,   513380847.0},
-  {4033465833.0,  3504501082.0,   701556249.0,  3305209120.0,  3474888000.0,  3073370453.0},
-  {3223013405.0,  4070530172.0,  1162014854.0,  1181836580.0,  1395673938.0,  1980905118.0},
-  {2639330374.0,    92103008.0,   184477350.0,   986581715.0,  1010061504.0,   955765404.0},
-  {3724241693.0,  3499792114.0,   139029039.0,  3928969750.0,  3891520031.0,  1967741812.0},
-  {3365005688.0,  4054969645.0,    46730849.0,   252623411.0,  3590900159.0,   423840643.0},
-  {3800527936.0,   415716866.0,   136036496.0,  3792268253.0,  2865206906.0,  2553275238.0},
-  { 376904330.0,  3049728540.0,  1171869274.0,  3942961306.0,  4157360791.0,   773549998.0},
-  {3376997989.0,   232797333.0,  2456522413.0,   127099838.0,    54592012.0,   492752196.0},
-  { 786712403.0,  2789008623.0,  3078095894.0,  4009193077.0,  3810161109.0,  1110712229.0},
-  {3277391928.0,  3055931486.0,  1353140175.0,   327211172.0,  1990219352.0,  3727674382.0},
-  { 927033202.0,  1621924220.0,  2677730389.0,  2978972930.0,  3124567096.0,  1770975838.0},
-  { 812530636.0,  3998607189.0,   729537725.0,  2971282554.0,  3662968013.0,  3457532240.0},
-  {1352591239.0,  1401922529.0,  3912261724.0,   661399463.0,  3734758739.0,   855990753.0},
-  {1513855060.0,   790526633.0,  1429429793.0,  1766054650.0,  2272728895.0,  1217030979.0},
-  {2080749694.0,  3917035257.0,   351842291.0,   299941682.0,  3618325051.0,  2869941031.0},
-  {2692744655.0,   670507883.0,  3475036452.0,   934099833.0,  4066873143.0,   754002972.0},
-  {1646119171.0,  1169407463.0,   439960208.0,  3112142899.0,  2586636704.0,  3691049088.0},
-  {1495970741.0,  1047976329.0,  2800822191.0,  2601961529.0,  1100506423.0,   136729037.0},
-  {1008937859.0,   449384754.0,  2921374674.0,  2486501560.0,   900467703.0,  1859430149.0},
-  {3323073959.0,  3374680845.0,  1232342365.0,  3449198891.0,  2427119895.0,  1868931902.0},
-  {2266139375.0,  2468188171.0,   584028780.0,  3546939139.0,  1609137673.0,   360357704.0},
-  {1574320499.0,  1088009785.0,  3600445725.0,  1239580522.0,  1552427639.0,  2883578920.0},
-  {3816142665.0,  1364789477.0,  1778647651.0,  2441201128.0,  1030086376.0,  4201716172.0},
-  { 993684634.0,  1244981677.0,  3898324641.0,  2725242614.0,   886833583.0,  1161281208.0},
-  {2502961890.0,  2416356160.0,  3325033068.0,  2913456054.0,   140206922.0,  1471748940.0},
-  { 724670899.0,  3842500749.0,  2614329372.0,  2812693742.0,    66976387.0,   964807157.0},
-  {2180547812.0,  2232209391.0,  3897005471.0,   197532027.0,  1288504046.0,  1618849146.0},
-  {3684353992.0,  3443688516.0,  1689960179.0,  4182579381.0,  1662434739.0,  1758063550.0},
-  { 171572439.0,  1528020886.0,  1169292173.0,  3899099872.0,  3501317882.0,  2778123711.0},
-  {1406148833.0,  3875414848.0,    48731863.0,  3944544182.0,  2564195388.0,  3003617296.0},
-  {2492593736.0,  4119669521.0,  1270028585.0,  2542990013.0,   559127286.0,   485969140.0},
-  {3535244525.0,  1019395426.0,  3373611039.0,   485213955.0,   992191951.0,  4269653815.0},
-  { 875415541.0,  3075776629.0,   445593216.0,  3023493506.0,  4285252754.0,   712776332.0},
-  {3138247806.0,  2435572785.0,  3806659659.0,  2400633861.0,   870028607.0,  1009231706.0},
-  {4107842399.0,  4278139919.0,  1658691860.0,  1646217745.0,  3673941671.0,   100900075.0},
-  {2856435959.0,  2837683746.0,   337181100.0,   415598914.0,  2945787445.0,   327658410.0},
-  {2239505228.0,  2671970009.0,    75132977.0,  3155378929.0,  2895457009.0,   562963159.0},
-  {2177531352.0,  4105239409.0,  1760691246.0,   635103188.0,  3410743569.0,  4152052919.0},
-  {2115307076.0,  1198570662.0,  3151476699.0,  1893185117.0,  3100105774.0,  3437615107.0},
-  {2133813981.0,  3703647270.0,   747941711.0,  1387962077.0,  2143432484.0,  4020645826.0},
-  {3236322957.0,  1298657423.0,  2692670148.0,  2379572837.0,   776500546.0,  4278620598.0},
-  { 380677715.0,  1070234738.0,  4059456853.0,  3964031490.0,   179750113.0,  2173692819.0},
-  {3738672718.0,  4294381740.0,  2041284118.0,  2154332898.0,  1967613045.0,   502733473.0},
-  {2994029112.0,  3953444629.0,  3594309158.0,  3889182197.0,  2476639023.0,  3170050063.0},
-  {3602310036.0,  1779348977.0,  1982040852.0,   618101007.0,  2190522802.0,  3076700320.0},
-  { 950148620.0,  4283468915.0,   854086305.0,  1389868846.0,  2338528600.0,  1969484915.0},
-  { 658681102.0,   377398935.0,  3383172094.0,  2604813228.0,  1663029885.0,   851111122.0},
-  {4190412303.0,  1504994355.0,  1420322307.0,   243401233.0,  2236827426.0,   127139963.0},
-  { 829633848.0,  3218953713.0,   218657441.0,  1213916095.0,  3334810175.0,  1000306513.0},
-  {3485130318.0,  3789237046.0,  3509016921.0,  2310698082.0,  3121505438.0,  3983154924.0},
-  {2253483513.0,  1568457360.0,  2106693493.0,  2038337964.0,  3453192535.0,  2107312093.0},
-  {2457686663.0,  3215345684.0,  2831171121.0,  4070247695.0,   247234727.0,  4204289907.0},
-  {3083793493.0,  4046366059.0,  1055248447.0,  3615220965.0,  3606156852.0,  3800697440.0},
-  {1045833021.0,  2415232134.0,   260567910.0,  1227627724.0,  1433525345.0,  3535340897.0},
-  {2184027200.0,  1993555993.0,  1610647294.0,  1075039851.0,  3889870944.0,  3883890358.0},
-  {3539003970.0,  1255227592.0,   292685810.0,  3169300788.0,  3972981909.0,  2681055979.0},
-  {2189076195.0,  2843192588.0,  4075255646.0,  1809467178.0,   153052581.0,  2703220164.0},
-  { 193018133.0,   540992120.0,  1692093681.0,  3522260629.0,   559392715.0,  1708876192.0},
-  {1796031579.0,   838095456.0,  1741225979.0,  2237413550.0,  1588680119.0,   836138357.0},
-  {2492081254.0,  3414768507.0,   860243743.0,  3163294564.0,  3016165326.0,  1924874819.0},
-  {1816545369.0,  3767438127.0,  1692942655.0,  3681848101.0,  1956956702.0,  1991088776.0},
-  {1547626209.0,  2941479792.0,  1683388589.0,  3291321213.0,   354866801.0,   205355484.0},
-  {2649511930.0,   485559894.0,  4005044414.0,  1397118680.0,  2282182028.0,  1186851006.0},
-  { 662540752.0,  3269101837.0,  2406354009.0,  3866381677.0,   399363425.0,  2394399354.0},
-  {  39023210.0,   714894995.0,  1225575021.0,   791277831.0,  3202588128.0,  2254344701.0},
-  {1061186993.0,  3689145367.0,  2357365618.0,  1184926630.0,  3590043499.0,  3219599094.0},
-  {3706204238.0,  2532700240.0,  3383980441.0,  1780231686.0,  4086551892.0,  3593257915.0},
-  { 822071876.0,  1448625495.0,   656963438.0,  1741685167.0,  3139878566.0,  2342474275.0},
-  {1559551320.0,  4121772375.0,  1000805098.0,  2456001029.0,  1220705154.0,  3740897946.0},
-  {4263989299.0,  3021669302.0,   283783003.0,  3010452120.0,    86042755.0,  3958869712.0},
-  { 385618429.0,   920046376.0,  2841064623.0,  3553518225.0,    55152179.0,   417454131.0},
-  { 899227919.0,   883552160.0,  1987681395.0,  3622149537.0,  2998819698.0,  1727705753.0},
-  {2416598798.0,   151999609.0,  1733611788.0,   361169157.0,  3029602030.0,   646123484.0},
-  {4084886949.0,  3936526606.0,  3714933337.0,  3956452121.0,  4211049392.0,  1103365552.0},
-  {2973829414.0,  1278930928.0,  1656281727.0,   637850140.0,   374840434.0,  4271804115.0},
-  {4120581206.0,  4145483415.0,   121780317.0,  2360536899.0,  3321251214.0,  1829907164.0},
-  {2201099048.0,  1517739954.0,  1409757640.0,  2661855114.0,   667088216.0,  2117314577.0},
-  {3628786038.0,  2420831460.0,   960473554.0,  2624771821.0,   741615868.0,  2925013503.0},
-  { 721606283.0,  1510093387.0,   186709955.0,  4162548093.0,  3085224087.0,  4059189195.0},
-  {3979479507.0,    21540047.0,  2180710948.0,  2461647306.0,  1643449790.0,  1973042840.0},
-  {  77756450.0,  2532747102.0,  2831728010.0,  3460912304.0,  2417362081.0,  1165300356.0},
-  {2796451067.0,  2655055676.0,  2401461313.0,  1169549052.0,  4197452756.0,  3317460436.0},
-  {3447484929.0,  2719888341.0,  3300594776.0,  2470880286.0,  1727135469.0,   838134548.0},
-  {1000800879.0,  2657191037.0,  3071169432.0,  2240517096.0,  1865491080.0,  3429000435.0},
-  {2594576525.0,  3807301096.0,  3387864694.0,  2762454376.0,  2033160537.0,  2246699531.0},
-  {1796249830.0,   970128659.0,  3869504952.0,  2147655831.0,  3806392498.0,  1709934149.0},
-  {1166789854.0,  2901215141.0,  2289829690.0,   360508928.0,  2690449141.0,  4125812872.0},
-  {3743157575.0,  2140451685.0,  3068861877.0,   810966406.0,    36550918.0,  1412806544.0},
-  {1774615796.0,  2611379407.0,  2190003975.0,   475476701.0,  4174104402.0,   821961919.0},
-  {2699978853.0,  1963574894.0,  3852195361.0,  3859148235.0,  3635982998.0,  2950650117.0},
-  {3574933382.0,  4000309241.0,   590199333.0,  3616125256.0,  2408172584.0,  2325881013.0},
-  {3455361210.0,  2357562968.0,  3876644938.0,  1933759302.0,   264958701.0,  3684347883.0},
-  {2036734722.0,  3504655901.0,  3880603140.0,   190200301.0,  3519579874.0,  2064175068.0},
-  {4044680209.0,  3905005616.0,   339943744.0,  2961301678.0,  1367326512.0,   857955128.0},
-  {1413868642.0,   734786933.0,  2826385823.0,  3736103908.0,  1343318286.0,  1669397124.0},
-  { 658638461.0,   441700597.0,   581960598.0,  1912885058.0,  1879303554.0,  4187619139.0},
-  { 988210915.0,  2512670032.0,  1126426814.0,  1034823717.0,  1801144363.0,   996865989.0},
-  {3897347010.0,  3179383469.0,  4045018736.0,   432607520.0,  1435799968.0,  3127261656.0},
-  {3606976025.0,  4179374332.0,  3215798532.0,  1861966503.0,  1845685514.0,  3631764660.0},
-  {3675333025.0,  1862418232.0,  3157300529.0,  1128669046.0,   517573397.0,  3415350219.0},
-  { 385658920.0,   304710959.0,  4242346624.0,   414096304.0,   640343398.0,   540843431.0},
-  {1575774226.0,  3641365552.0,  1445208793.0,   568117764.0,  3369795349.0,  2616588653.0},
-  { 159080245.0,  3808800426.0,   573828680.0,  3277703192.0,  3348017874.0,   142911844.0},
-  {3773340433.0,  3262071947.0,    26307305.0,  4033386391.0,   340688113.0,  2255939016.0},
-  {2484463591.0,  3691506721.0,   785878911.0,  2907056339.0,   885187805.0,  3019002685.0},
-  {3620749306.0,  1496874768.0,   213493005.0,  4079779646.0,  3623279888.0,  3192169972.0},
-  {1345314019.0,  4187075891.0,  3215427171.0,   737940368.0,    58193096.0,  1694175541.0},
-  {4281182480.0,   734035475.0,  2971834638.0,    92021206.0,  2133998236.0,  3493776100.0},
-  { 114118243.0,  2496497226.0,  2156969843.0,  2567860364.0,  3735602148.0,  3957407167.0},
-  {3445835094.0,  2145810152.0,  1114516833.0,   844926040.0,  2850637932.0,  1835029847.0},
-  {2497418053.0,  4191964274.0,   737584447.0,   331975429.0,  1421484181.0,  4127226604.0},
-  { 732810390.0,   881031779.0,  2180818396.0,  1108221356.0,  1382477529.0,  2089261907.0},
-  {1876069731.0,   496133085.0,  3861050589.0,  1016719126.0,  1010635468.0,   103313391.0},
-  {3744175681.0,  4150227831.0,  3645210554.0,   878216182.0,   905756328.0,  1899262137.0},
-  {1108828037.0,  1163269587.0,  2765696368.0,  2522393088.0,  4139825921.0,  1711616181.0},
-  {2137599564.0,  3461494722.0,  4131606782.0,   732026048.0,  3188336953.0,  3646155619.0},
-  {1852202061.0,  3685697140.0,  3287863126.0,  1749214912.0,  2766920383.0,  1719346498.0},
-  {1948067590.0,   590515050.0,  3148165939.0,  1471126621.0,   375694398.0,   873783335.0},
-  {1042392495.0,  2936219397.0,  2303280354.0,   455941744.0,  2219642784.0,  1222667394.0},
-  {2229837532.0,   901708520.0,   815728374.0,  4006902682.0,  3105602682.0,  3828030163.0},
-  {3963592345.0,   679160738.0,  1018853400.0,  2872061802.0,   553780413.0,  2748895148.0},
-  {2852644767.0,  3289880397.0,  2966184143.0,  1158117024.0,  2516488992.0,  3300494000.0},
-  {2870735204.0,  3902372100.0,  1604033432.0,  1042780400.0,   632319160.0,  1226217100.0},
-  {2029392331.0,   637349753.0,  1451497687.0,  3268453689.0,  2861703963.0,  3585179723.0},
-  { 586575013.0,  2989229244.0,  3817235677.0,  3849498978.0,  1653919463.0,   974730904.0},
-  {1506223412.0,  3054704725.0,  2583347310.0,  3361116594.0,    65417616.0,  3378691218.0},
-  {3406440083.0,  3626152409.0,  3576507993.0,  3894951224.0,  2126039206.0,  1445434407.0},
-  {1928125117.0,  3855721517.0,  1779296434.0,   408063993.0,  2026344427.0,   799559480.0},
-  {1066229347.0,   776804076.0,  4228371867.0,  1132446999.0,  3868839410.0,   527219937.0},
-  {1972010892.0,  4174459050.0,  1210464456.0,    41430266.0,   138252571.0,  2294922638.0},
-  {3269828605.0,  4093302488.0,  3072655741.0,  3769357025.0,  3993269205.0,  1896182728.0},
-  {1811496864.0,  2392947277.0,  4173585878.0,  1970205892.0,  3971529805.0,  1972166347.0},
-  {2210144133.0,  2434606294.0,  1316077548.0,  3219867881.0,  4032974558.0,  2405038438.0},
-  { 300862390.0,  3720613704.0,  1216459303.0,    75591033.0,  4216511951.0,  2743859764.0},
-  { 106472964.0,   166304991.0,  3700261277.0,  2240609581.0,  2049686797.0,   353674502.0},
-  {4124765868.0,   337772451.0,  1752146684.0,  2069216272.0,  2648138781.0,  3696189511.0},
-  {3494696221.0,  1407732563.0,   648038783.0,  3932736309.0,  3366204319.0,  3229538554.0},
-  {2941190747.0,  3758263411.0,  1997468435.0,   307181936.0,   884672227.0,  1943178972.0},
-  {2869417276.0,   207825701.0,  2784368320.0,  1113857590.0,  1236089984.0,  3437513558.0},
-  {2774612839.0,  1076635044.0,  1335257859.0,   615130932.0,    29307697.0,   552678045.0},
-  {2770125699.0,   556692410.0,  4135844901.0,  1260679850.0,  1693131562.0,  2939317215.0},
-  {3290425059.0,  3768584026.0,  1142294241.0,  2777570075.0,   393676773.0,  3987080927.0},
-  {2639479610.0,   202744397.0,  2230986717.0,  3667322361.0,  1877232553.0,  2053988301.0},
-  {1422992291.0,    80564629.0,  1743154518.0,  1818213830.0,  2207436308.0,  3880317073.0},
-  {1648254786.0,  3572721716.0,  1291729002.0,  2381692878.0,  2639745537.0,  1458362308.0},
-  {2644691721.0,   756616190.0,  2637204189.0,  1450852365.0,  2636299555.0,  3880653820.0},
-  {2261613039.0,   271670299.0,  3580729991.0,  2019736271.0,  1269759112.0,  2310289287.0},
-  {2777209523.0,  1353418545.0,  3246750736.0,   215214764.0,  1891322517.0,  1685691680.0},
-  {3152082830.0,  1014727969.0,   605801167.0,   550934212.0,  3274650044.0,  2831505533.0},
-  {3337917429.0,   340756899.0,  1527510402.0,  2308953593.0,  1947437076.0,   273066175.0},
-  {3294538078.0,  3954941747.0,  2906830752.0,  2554833574.0,   135317702.0,  4222890866.0},
-  {1851560874.0,   935734256.0,  1216303234.0,  2830499390.0,  1672575566.0,  2314171835.0},
-  {4159260093.0,  3756524356.0,  1032695040.0,   408938845.0,   899782609.0,  1340108577.0},
-  {3182046948.0,  2440419368.0,  3986152798.0,  2929219686.0,    49288111.0,  3014070275.0},
-  {  88523896.0,   723585199.0,  1291207197.0,   744253185.0,  3341522973.0,  4211417537.0},
-  {2580372545.0,  3208496590.0,  3389227648.0,  3411554473.0,  2875258380.0,  3209604139.0},
-  {2658164082.0,   826442732.0,  2306926090.0,   857332399.0,  3550815343.0,   395976930.0},
-  {1527359402.0,  1575497172.0,  3025131997.0,   734096912.0,  1945431048.0,  3131990666.0},
-  {2925438588.0,  2733981271.0,    60703147.0,   241241492.0,  2475237438.0,  2026968183.0},
-  { 935781511.0,  3515001468.0,  1290533582.0,  1038855378.0,  3607853115.0,   650868793.0},
-  {3792220055.0,   354341346.0,  2312978407.0,  2517843442.0,  2730035873.0,  4038177319.0},
-  {2195666747.0,  2131809243.0,  3923971403.0,  3600291505.0,  1640729054.0,  2141867222.0},
-  {  72258110.0,  3341985415.0,  2081226035.0,   906751221.0,  1137540804.0,  1020022557.0},
-  {2539165460.0,  1661517857.0,  2921658364.0,  3183681915.0,  2747716485.0,  2758090881.0},
-  { 303758694.0,  2369506486.0,  1333559414.0,  1965201490.0,   222400423.0,   237948290.0},
-  {3877784710.0,   644893865.0,   763257248.0,  3273281835.0,  1893455727.0,  3452810617.0},
-  { 405405797.0,  1076204822.0,   162477222.0,  1208731741.0,  2738647138.0,  2704259866.0},
-  {2938639688.0,  1145896881.0,  1210016260.0,   745986217.0,    21198995.0,  1081316830.0},
-  {4180395358.0,  2860788251.0,  2835349897.0,  2628710046.0,  3219477661.0,  1316336835.0},
-  {1064731072.0,  2620766384.0,  3010564682.0,  2049848741.0,   229849704.0,  1672674436.0},
-  {1754113830.0,   632391988.0,  2858235670.0,  2907645427.0,  4131038097.0,  4254228152.0},
-  {3520117234.0,  3223649950.0,  1102177261.0,   143501226.0,  3401565416.0,  2907396924.0},
-  {1972157505.0,  4226622304.0,   251132956.0,  4090043090.0,  1140764548.0,  1486906935.0},
-  { 183321519.0,  2991082657.0,  3780865948.0,   379806058.0,  3932505937.0,  1468357534.0},
-  {3167997645.0,  3858259629.0,  4036357432.0,  2118036942.0,   421845862.0,  2848336507.0},
-  {1630117831.0,  3635449721.0,  3696489081.0,  2855124140.0,  2320210311.0,  4186193010.0},
-  {1605418681.0,  1101279226.0,  2872548357.0,  4272339695.0,  2538962669.0,   601082289.0},
-  {3969612398.0,  3403874455.0,  2188570631.0,  1079797687.0,  3041591672.0,  4042598469.0},
-  {2348052063.0,  4180484036.0,  1102424208.0,  1667035778.0,  1594548841.0,  4123589234.0},
-  {3963089702.0,   471473473.0,  1103572084.0,  3606362233.0,  4133283616.0,  2040098238.0},
-  { 222440770.0,  3456015082.0,  2260875643.0,  2955939254.0,  1741936680.0,   513948506.0},
-  { 285469622.0,  1834688027.0,  4282399609.0,   335318718.0,   877305704.0,   788306725.0},
-  {4076415485.0,  1313225461.0,  4003428952.0,  3760322844.0,  3354719133.0,  3310361021.0},
-  {  36522393.0,   485898065.0,  3603531645.0,  2862376258.0,  2721244497.0,  2249176417.0},
-  {3310130398.0,  1783385360.0,  1562775230.0,  4065026632.0,  3895092244.0,  3418739121.0},
-  {3216449616.0,  2980815481.0,  2136929064.0,  3105860186.0,  3156198472.0,  4172657025.0},
-  {3170765052.0,  4262758029.0,  1609396227.0,   687334901.0,  3187682269.0,   982733449.0},
-  {3706781928.0,  3015905925.0,  2051271725.0,  3742343237.0,  1283271924.0,  2202202031.0},
-  {2451201722.0,  1132195141.0,  3819322155.0,  1784619433.0,  3082823415.0,  1699867801.0},
-  {3763378215.0,  1898602045.0,  1738075725.0,  3575965695.0,  3572891390.0,  1809832615.0},
-  {2709498620.0,  1268134536.0,   708957422.0,   555705211.0,  2274962160.0,  2108875602.0},
-  {3491210339.0,  2570606789.0,  1481324014.0,  4223519580.0,  1197863536.0,  3853349998.0},
-  {2429779453.0,  1659074015.0,  1880947515.0,   534541732.0,  3012726746.0,  3158902270.0},
-  {1487067151.0,  1812298785.0,  2630499828.0,   769010771.0,   827479803.0,  2990899504.0},
-  {3886912868.0,  3768603528.0,  3352794403.0,  3207544810.0,  1451335764.0,  2759239762.0},
-  {3234529008.0,  1463210832.0,   915936693.0,  3138874061.0,  2414089018.0,  2511446760.0},
-  { 790694995.0,  2560507919.0,   177349170.0,   703051485.0,  2762785392.0,  4276636121.0},
-  {2683920007.0,  2983267070.0,   488432915.0,  2389041220.0,  3602379803.0,  4223515474.0},
-  {1247188456.0,  3800144437.0,  1043810345.0,  3434472426.0,   412745760.0,  3761712731.0},
-  {3821488008.0,  1497653913.0,  2677063460.0,   696450922.0,  2063533103.0,  2619515711.0},
-  {3542483537.0,   874670478.0,  4189219227.0,    10214131.0,  1171263160.0,  3215844038.0},
-  {2564879465.0,  3123959507.0,   314092038.0,  2451014581.0,  3269239819.0,  3538156875.0},
-  {3521140660.0,  2143449242.0,  4271965488.0,  4290290844.0,   912854638.0,  1041360425.0},
-  {1739510066.0,  1304084947.0,   725821406.0,  3078083309.0,  2721762062.0,  4240284108.0},
-  {1775068832.0,   831705812.0,  1811553177.0,  3187402955.0,   245237292.0,  1500947072.0},
-  {3551236569.0,  3995998000.0,   233585781.0,  2002806436.0,  1613742598.0,   319705969.0},
-  {2959544142.0,   639983207.0,  3495165078.0,  2900447106.0,   322185651.0,  3336694729.0},
-  {4006523886.0,  1231461108.0,  2772037164.0,   666420911.0,  3657110593.0,  1715752373.0},
-  { 755484838.0,  2044597112.0,  2976733240.0,  3446916727.0,   588100589.0,  3207279381.0},
-  {1074168640.0,  4033615774.0,   595616579.0,   735339904.0,  2043554055.0,  2751218977.0},
-  {3287873520.0,  1858507166.0,   485572618.0,   627365452.0,  2090345734.0,  2597879255.0},
-  {1285950133.0,   493449762.0,   848818434.0,  2525964618.0,  2684499188.0,  2804484552.0},
-  { 301978072.0,  2526499328.0,  3192025312.0,  2384079134.0,  2552965665.0,  2966090926.0},
-  { 318234734.0,  3844314233.0,  2004315475.0,  3121917581.0,   517308072.0,  2070999733.0},
-  { 356062526.0,   660295796.0,  3187000438.0,  3818537499.0,  3876539661.0,  3908136441.0},
-  { 747359680.0,   712083275.0,  3668865409.0,   255046737.0,  1995395238.0,  3815136616.0},
-  {3375643467.0,  2092833836.0,  1266393266.0,  1529488205.0,  2113093125.0,  3553648588.0},
-  { 346510955.0,  1506568106.0,  1864141670.0,  2312197409.0,  3324419735.0,   456748946.0},
-  {2132531203.0,    44473202.0,  1735667370.0,  1698421744.0,  1795188122.0,   188582805.0},
-  {2758844183.0,   694026934.0,  3267931306.0,  3253656992.0,  3255093894.0,  1435295496.0},
-  {1691572916.0,   531531575.0,  3379496063.0,   692934263.0,  1679891060.0,  4218830093.0},
-  {3345178341.0,  2323686321.0,  3301921754.0,   344868026.0,  2303475774.0,   770003712.0},
-  {3610751725.0,  2838156782.0,  3284159345.0,  2813735714.0,   565558933.0,  2329339932.0},
-  {4169604245.0,  1856353771.0,  3971757483.0,  1038423758.0,  3192768999.0,   256233361.0},
-  {4029315437.0,  3420444495.0,   346461510.0,  3351211662.0,  1777262290.0,  3363515671.0},
-  {1030255644.0,  4192498250.0,  3132219040.0,  4250397799.0,   694029687.0,   919830430.0},
-  {3708129573.0,  2978402861.0,  3996748539.0,  1335189864.0,  1947326312.0,  3127718929.0},
-  {3968563218.0,    15887780.0,   462045900.0,  2180538981.0,  3518272921.0,  2468434904.0},
-  {4182709866.0,  4037492246.0,  1247240645.0,  1039076202.0,  1091166688.0,   194559383.0},
-  {3028408745.0,  1016949099.0,  2398895896.0,  4238298091.0,  1235045333.0,  2847389960.0},
-  {4268889402.0,    27221009.0,  3184916191.0,  1713326313.0,  2562081055.0,  2563919201.0},
-  {3231092595.0,  3180570882.0,  2610600265.0,  2623340071.0,   417532374.0,  1049948962.0},
-  {3428497888.0,  3821627274.0,  4113665501.0,  3925819285.0,  3476691188.0,   878793820.0},
-  { 405364751.0,   263843301.0,   688966897.0,  1502548773.0,  3220180055.0,  2784024719.0},
-  {1642986767.0,  2198406628.0,  3335415181.0,   368294543.0,  3823661258.0,  1745444307.0},
-  {1008381768.0,  3268179728.0,   931932053.0,   174334763.0,   311496278.0,  1936177061.0},
-  {3617959761.0,  2588902332.0,  2885093540.0,  2028498645.0,   766224557.0,  3177217093.0},
-  {2791702946.0,  2118124851.0,   860075513.0,  3422561287.0,  3256610558.0,   812249170.0},
-  { 755395726.0,  1884374941.0,  1970050933.0,  1525434145.0,  2179237677.0,  1354199443.0},
-  { 286336048.0,  2617478641.0,  3095284081.0,  1999154728.0,   750811243.0,  3377167993.0},
-  { 545317537.0,  1893515872.0,  3341122155.0,  3214904191.0,  2040805078.0,  2945621439.0},
-  {1954671178.0,  3221946382.0,  2176031476.0,  4008815438.0,  2676449230.0,  2883042059.0},
-  {1231141150.0,  3801840640.0,  1923189101.0,  2458378042.0,  2789559112.0,  1133419483.0},
-  {3076070020.0,  2608813704.0,  3355121667.0,  4011552156.0,  2067500537.0,   673464026.0},
-  {2669211957.0,  2958248476.0,  1178899207.0,  3297981710.0,  1252644201.0,  4062722768.0},
-  { 477900574.0,   440527308.0,  1829918488.0,  1670533170.0,  1534444358.0,  2429182344.0},
-  {2978037269.0,  1539486487.0,  2019431406.0,  3804832398.0,  4261236310.0,  2392409649.0},
-  {2655691972.0,  2587794083.0,   711427674.0,  2359110303.0,  2399954579.0,  4028692099.0},
-  {1578210752.0,  4099073689.0,  2709076319.0,  1222390014.0,  2723265955.0,  2730920304.0},
-  {2257088208.0,  2256473551.0,  2880150309.0,  1020603893.0,  3852168995.0,  4093827778.0},
-  { 390357705.0,   252651624.0,  3254786741.0,  3668684558.0,  3561056528.0,  1961292065.0},
-  {2986688122.0,  3020735256.0,  3309977804.0,  3295884831.0,  4093074530.0,  3117527193.0},
-  { 697326438.0,  4147497706.0,  3927972705.0,  1575323960.0,  2783638271.0,  4269114255.0},
-  {2213347471.0,  3017072159.0,  2743267379.0,  1598787795.0,  1733724761.0,  2790071977.0},
-  {4012862571.0,  1860057563.0,  1282509488.0,  3832185956.0,  1556917124.0,  2362372217.0},
-  {3294596218.0,  2963709402.0,  2367669282.0,  1876270100.0,  1061264173.0,  3573454485.0},
-  {3359260236.0,  2353822753.0,  1669535157.0,   823814157.0,    59844236.0,   510409491.0},
-  { 348847701.0,  2697355734.0,  1278822469.0,  2963630570.0,  2408392460.0,  2271561666.0},
-  {2229235533.0,  3812166486.0,   501685082.0,  3115361894.0,  3322207203.0,  2235378320.0},
-  { 712703947.0,  1554515760.0,   644219721.0,   167954232.0,  1750464696.0,  2110800164.0},
-  {2318473472.0,  2732130524.0,   664906472.0,  2424277491.0,    49697916.0,  3064536054.0},
-  {1510804757.0,  2148543572.0,  3420088181.0,  2495862068.0,  2574570753.0,  2067049827.0},
-  {2011516803.0,  2831162039.0,  2816831130.0,  2687284639.0,  2649247072.0,  1726943154.0},
-  {2994464553.0,  1354576946.0,  2202963469.0,  2156951502.0,  3322873733.0,   894882947.0},
-  { 993115615.0,   858472282.0,  3228963998.0,  3327023359.0,  3070342965.0,  4223022431.0},
-  {3718292997.0,  1266916109.0,  3732674073.0,  1284101666.0,   480759935.0,  4173409075.0},
-  {2291113574.0,  2747755000.0,   209893814.0,  1257364554.0,  3101796937.0,    27956108.0},
-  { 167094611.0,    64917601.0,   386966479.0,   458071386.0,  3012252959.0,  1554575574.0},
-  {1256353900.0,  1614108081.0,   679975230.0,  1277680779.0,  1612706791.0,   530493182.0},
-  {4270611333.0,  1367957929.0,  2899957917.0,  1779398402.0,   642465465.0,  3241378828.0},
-  { 468568482.0,    60748908.0,  3600254120.0,  1480623720.0,  3200597697.0,  3743886328.0},
-  {1926673769.0,  3861245514.0,  1708623441.0,  2751579631.0,   780154280.0,  3613582721.0},
-  { 696105265.0,  3891344153.0,  2169010768.0,  4080261113.0,  1254854216.0,  4033868855.0},
-  { 268425516.0,  3713574352.0,  4172164334.0,  2530299249.0,  3175930011.0,   482294284.0},
-  {2300493421.0,  1303978851.0,  1121158408.0,  2271124722.0,  1661457900.0,   195038643.0},
-  {3489645319.0,  2875505426.0,  3770159573.0,  2361303763.0,  3798982911.0,   228108234.0},
-  { 791181642.0,   166725907.0,  3419002511.0,  3361307646.0,  2233352273.0,  3565700403.0},
-  {2088281328.0,  1696485025.0,  3044395709.0,  1114335939.0,  2777285388.0,  1089272110.0},
-  {2514184713.0,  1052401222.0,  4231695282.0,  4246740349.0,  2117355945.0,   592811160.0},
-  {4230946739.0,   903016992.0,  1430255563.0,   318940858.0,  1019785081.0,  4005907417.0},
-  {2461881433.0,   261784519.0,   618996903.0,  2335278570.0,  3967908416.0,   146902230.0},
-  {1744503103.0,  2832967774.0,  3162752289.0,   753814642.0,  4083901462.0,   827570030.0},
-  { 672538950.0,  3491536109.0,  1824344454.0,  2252749438.0,   372134736.0,  3474148697.0},
-  {1388905979.0,  3452308414.0,    26175452.0,   142697066.0,  1724425259.0,  3278706859.0},
-  {2125865286.0,  1930334434.0,   733034992.0,  1539091945.0,  1870799894.0,  2040545073.0},
-  {2008429830.0,  2356144034.0,  4196812024.0,  4262217390.0,  1410913583.0,  2057201587.0},
-  {  96355004.0,  2767684682.0,   328562323.0,  2375402429.0,  2773390957.0,   293038095.0},
-  {3511959079.0,  2657396237.0,  1814087746.0,  1410199878.0,  4112995543.0,  3432312395.0},
-  {2936661117.0,  4206341794.0,  3716561453.0,  2287423507.0,  1622818046.0,  1690675357.0},
-  {3027687267.0,  1080919590.0,  3555011423.0,  2269751392.0,  1974226517.0,  1101601477.0},
-  {2013834764.0,  3222634640.0,   433904909.0,  3566893224.0,  2884698897.0,  3333992438.0},
-  {2559286705.0,   731285654.0,  3745175581.0,  1152237530.0,  3849367207.0,   913545131.0},
-  {2343867234.0,    73471744.0,  1465228163.0,  3329755212.0,  2874412267.0,   357719480.0},
-  {2372307237.0,  2250764778.0,   230737113.0,  2188597609.0,   350574759.0,  1510430925.0},
-  {4187480666.0,   778954876.0,  4129069711.0,  1129893082.0,   821592391.0,  2965550439.0},
-  {3559745278.0,  1989035208.0,   655847452.0,  1279431621.0,   902854351.0,   451249069.0},
-  { 435747886.0,   968749515.0,  3542444585.0,   556909946.0,   613520536.0,  1018104837.0},
-  {1239571327.0,  3569489389.0,    12975018.0,  4024001690.0,  1311638625.0,  2227928689.0},
-  {2630937013.0,   495752274.0,  2687466648.0,  1335128527.0,    93238925.0,  3610563585.0},
-  {3361337006.0,  2639113102.0,  3823872218.0,  1032555894.0,  3876989156.0,  1213676882.0},
-  { 828003456.0,  1834010671.0,  3391155765.0,  3760386244.0,   278905664.0,  1798050295.0},
-  {1726521006.0,   217992094.0,     2818132.0,  1503355688.0,  2408073055.0,  2019382661.0},
-  {1173019511.0,  3983785733.0,  4129243291.0,  3285297209.0,  1954926000.0,  2683255197.0},
-  {3684941871.0,  3881483504.0,   213885187.0,  4105620658.0,  1356712054.0,  2105523085.0},
-  {3123129026.0,  3861595758.0,   892315138.0,  3358759456.0,  2998182802.0,  3635280692.0},
-  {4230568858.0,  3736564227.0,  1186481503.0,  3511468220.0,   480908081.0,  2310356882.0},
-  {3463215423.0,  4058363457.0,  2939353685.0,     3467521.0,   129305026.0,  3676697019.0},
-  {2494812991.0,  2548372460.0,  2794077173.0,  2591247928.0,   612284214.0,  1510032248.0},
-  {2756843047.0,  3006315862.0,  2970052452.0,   121377223.0,   541595649.0,  1165996122.0},
-  { 340950983.0,   476641156.0,  4108975171.0,   825000922.0,  3550748441.0,  4184489088.0},
-  {1457112749.0,  1413842090.0,   100719967.0,  2314512497.0,  2411341106.0,   741528801.0},
-  {3581874462.0,  1715752954.0,  1726120854.0,  4028179101.0,  1998891142.0,    47598192.0},
-  {1175075279.0,  1167030221.0,  1244624183.0,  2083954225.0,   141383364.0,  3898707069.0},
-  {1122339025.0,   265783095.0,  2709769095.0,  1888795559.0,   476950552.0,  3386249684.0},
-  {3505210596.0,  3527611330.0,   422763106.0,  2188997395.0,  4115874636.0,  1805446405.0},
-  {1491167956.0,  2775970800.0,  4100922272.0,  1993591081.0,  2462414094.0,  1837250956.0},
-  {2726777496.0,  2998271668.0,  2584126765.0,   573648769.0,  3329657661.0,  3080107532.0},
-  {1664176347.0,  4118816380.0,  3913949733.0,  2280520790.0,   472143518.0,   636006186.0},
-  { 185809275.0,   160345089.0,  2823356389.0,  1714361787.0,  1688919262.0,  2165128818.0},
-  {2161567074.0,   359713540.0,   611452690.0,  2381530404.0,   993951258.0,  2182428408.0},
-  {3465917816.0,  4241753322.0,   908668029.0,  1607106621.0,  3770792152.0,   949840153.0},
-  {2289622852.0,  4002939613.0,  1000950034.0,  2904726403.0,    70686247.0,  2472733240.0},
-  {2084072533.0,  2434178487.0,   185425841.0,  3842301863.0,  1960696710.0,  1680318775.0},
-  {4053879187.0,  2740682890.0,   463735568.0,  3817600966.0,  1594183447.0,   420607327.0},
-  {1562805591.0,  3879520004.0,  4010552909.0,  3782080716.0,  3017492755.0,  2447706958.0},
-  {2057849216.0,  3952516262.0,  3668623301.0,  4080796690.0,  2073022350.0,  1243858001.0},
-  {2946215021.0,  1430102747.0,  4279679394.0,  1536534055.0,  1217495561.0,  4079456445.0},
-  {2630667189.0,   436964332.0,  2267810305.0,  4141934545.0,   922750430.0,  1152165823.0},
-  {2817705172.0,  2205959784.0,   730822377.0,  1843854318.0,  2976308028.0,  2653936699.0},
-  {   9892892.0,  3977135363.0,  1195179809.0,  3822861594.0,  1792897076.0,  2475256588.0},
-  {3637548978.0,   935348531.0,  3546050373.0,  4075239247.0,   213005621.0,  3846217061.0},
-  { 602066509.0,   647266762.0,  3527677406.0,   860697193.0,   743782784.0,  3161974107.0},
-  { 980236891.0,  1453140659.0,    74179812.0,   246288686.0,   931024664.0,  1011290664.0},
-  {2700391768.0,  3587629508.0,   821101114.0,  3560048719.0,  3948841551.0,   403578727.0},
-  {3486619262.0,  2475368903.0,   435990361.0,    19170563.0,    96962841.0,  2142507019.0},
-  {3324622118.0,  1365791786.0,  1006020059.0,  3974006526.0,  2599774805.0,   879901830.0},
-  {1369260625.0,  3938586102.0,  1183366850.0,   577772021.0,  3514611900.0,  2777259148.0},
-  {1801257195.0,  2844935650.0,  2699732478.0,   973439323.0,  2275256298.0,  3895400180.0},
-  {3689768865.0,  2602906082.0,   707613264.0,  3935342201.0,  3592341570.0,  3918221115.0},
-  { 715711309.0,  3833766204.0,  1118789803.0,  4136894622.0,   196414719.0,  2649654369.0},
-  {3902720419.0,  3299661903.0,  1275299257.0,  2277885553.0,   128836226.0,  3314190013.0},
-  {3667608734.0,  3643705006.0,  3308517174.0,  2382380983.0,  4209004826.0,  1525208621.0},
-  {2759667918.0,  3903780982.0,  1323548281.0,  1503770228.0,  2939943535.0,  2558655029.0},
-  {3330232806.0,  2092026592.0,  1978626690.0,  1764357799.0,  4290786036.0,   155648352.0},
-  { 822637067.0,  3321837729.0,   902230392.0,  2334675321.0,  2140769047.0,  1358855900.0},
-  {1333296509.0,  4065577983.0,  3915437451.0,  2677580209.0,  2996792923.0,   493881984.0},
-  {3895109945.0,  3449919112.0,   466656449.0,  2184629090.0,  3270512963.0,   143839497.0},
-  { 475097086.0,  2363248612.0,  2042590464.0,  3776914079.0,  2713392396.0,  3218830572.0},
-  { 614292528.0,  1411526605.0,  2549069663.0,  2456585661.0,  4230382642.0,   448651643.0},
-  {3830354197.0,  2675457830.0,  2315772156.0,  3060411578.0,  2683287664.0,  4111390098.0},
-  {2592128446.0,  2973275493.0,  3799709153.0,   401351430.0,   456132277.0,  2158224515.0},
-  {2196055746.0,   184900494.0,  1125754218.0,  3205703637.0,   357884822.0,  2806408871.0},
-  { 103160720.0,  1167394895.0,  4238710286.0,  2741552404.0,  1254432106.0,  4026991696.0},
-  { 987600169.0,   527066901.0,  2869182206.0,   975446920.0,  2638882743.0,  3627178677.0},
-  {3017015893.0,  3429046632.0,  3906942929.0,   812658934.0,  2136710410.0,  3197096750.0},
-  {1311182832.0,  2863322924.0,  1139758704.0,  2408516961.0,  3396117773.0,  4253722100.0},
-  { 349756116.0,  2793284834.0,  3227985820.0,  3429271192.0,  3273701300.0,   141680234.0},
-  {1705798638.0,   736159633.0,  2004495167.0,  2142147387.0,   577914486.0,  2966457903.0},
-  {2566511913.0,   497825332.0,   741974619.0,  3919484286.0,    88342837.0,  3725839114.0},
-  {3302362470.0,  3744057265.0,  1201218009.0,  1711505181.0,  2327929278.0,  4130231459.0},
-  { 664989158.0,  2183964688.0,  3145373120.0,  4125760127.0,  3584301112.0,  1139024375.0},
-  {1174933321.0,  1926909519.0,   916828632.0,  3279379717.0,   190679404.0,    29903701.0},
-  {3441860467.0,  1207370298.0,   489621616.0,  1876145150.0,  1383098076.0,   226857504.0},
-  {3855796623.0,  1677463729.0,  1816150780.0,  1817437756.0,  2363976225.0,  4055523015.0},
-  { 104463268.0,   115410356.0,  3595918207.0,  1373676015.0,  2911450599.0,  3628194575.0},
-  {2939805682.0,  1755425819.0,  1596658505.0,  1871698697.0,   470967274.0,  1939781313.0},
-  {1654568482.0,  3641539044.0,  3604173485.0,  3317586235.0,    49146884.0,  3242076677.0},
-  {3928834772.0,   502229635.0,  1588908855.0,  1395254369.0,  3798509876.0,  2356823426.0},
-  {1535232888.0,  1030052446.0,  3398929369.0,  1814146181.0,  3909802523.0,  2084367399.0},
-  {1121485720.0,  3451988870.0,   737087483.0,  3536089523.0,  1841827480.0,  2719757000.0},
-  {3315052718.0,  1680844672.0,  3495741534.0,   709166025.0,   372992367.0,  2051341813.0},
-  {2625016398.0,  1483851354.0,  1326411752.0,  1203441402.0,  1801390863.0,  2688794052.0},
-  {1449246455.0,  3053686634.0,  1754834098.0,  1659337977.0,  4062680025.0,  1470470690.0},
-  {3444137954.0,   752978384.0,  1070289320.0,  2915123344.0,  1117942418.0,  2461096653.0},
-  {3459149528.0,  1983757240.0,  3168845396.0,   718579809.0,  2080010167.0,  1008686508.0},
-  {3932346812.0,  3002607323.0,   199926629.0,    64341053.0,   952477685.0,  4110894694.0},
-  {4054437675.0,   853686566.0,  1617625440.0,  3664748787.0,   973493157.0,  2398580105.0},
-  { 414776736.0,  1761450470.0,   865991777.0,  2254639114.0,    79137688.0,  4284308935.0},
-  {4233455210.0,  3547145227.0,  1510485355.0,  2335629819.0,  2258648648.0,   251090001.0},
-  {1001353705.0,  2641842202.0,  3602919755.0,  1126147241.0,  1501319067.0,  3067678473.0},
-  {1786268952.0,   319688418.0,  2274618767.0,  1163173362.0,  4031491560.0,  4259893793.0},
-  {2315154206.0,  1488177200.0,  2861162499.0,   886213826.0,  2096191340.0,  3318050711.0},
-  {4005138387.0,  3866335850.0,  1922030118.0,  3415508704.0,  4124281248.0,  1173342267.0},
-  {1175545303.0,  3409316729.0,   748043634.0,  1279163039.0,  4216790648.0,   983343213.0},
-  {4173859243.0,  3076992137.0,  2364512898.0,  3306124177.0,  3145238535.0,  3891228264.0},
-  {2432873705.0,   724753208.0,  3968977254.0,  1008272748.0,  3180040288.0,  4126845273.0},
-  {3311707957.0,   388796158.0,  3978984402.0,  1892519475.0,  3275851931.0,   832545419.0},
-  { 126099364.0,  2937016866.0,  1907331449.0,   320306094.0,  2538126047.0,   646577755.0},
-  {3638685149.0,  2922865986.0,  3071296812.0,  1111197113.0,   431177625.0,  3801368476.0},
-  {3142472093.0,  1419528195.0,  1459611628.0,   273153895.0,  4068456465.0,  1172915453.0},
-  {4232544908.0,  2650720458.0,  2158342608.0,  2407959657.0,   865800503.0,  1930125992.0},
-  {4247867850.0,  1115380772.0,  1742510246.0,  1399390740.0,  2576867545.0,  1138615338.0},
-  { 921847385.0,  3183147789.0,  3502914210.0,  4214657383.0,  2699303099.0,   596079415.0},
-  { 660263412.0,  1392864638.0,  3387050392.0,  3073685757.0,  3999064539.0,  3753205430.0},
-  {4097385690.0,  1152461795.0,  1946349111.0,  1675541826.0,  2534171860.0,  3253359909.0},
-  {3245522559.0,  2420519675.0,  1670203537.0,  2466994667.0,  3721113270.0,  3661170007.0},
-  {3795675437.0,  3148480467.0,   130022709.0,  1457576711.0,   620478427.0,  2515913219.0},
-  {4140255346.0,  2000093257.0,  3297370681.0,  3828674803.0,    97520491.0,  2294749584.0},
-  {2800730728.0,    66326166.0,  4202219466.0,  1023239925.0,   264514203.0,  1057100712.0},
-  {4040635563.0,  2616359058.0,  1487708740.0,  2831212086.0,  2092166058.0,  3744496893.0},
-  {2305345156.0,  1930459809.0,  4049970356.0,  2861144713.0,   461043690.0,   511851881.0},
-  {2338314586.0,  3320756074.0,  1401935640.0,   741128383.0,  1605097020.0,   219256611.0},
-  {4023323028.0,  2873492676.0,   116363549.0,  1486525688.0,  2645695603.0,  3323267125.0},
-  {3079218839.0,  3541393250.0,  3736436489.0,  1151438979.0,   249324134.0,  3507877125.0},
-  {3684294148.0,  4230052415.0,  3532225564.0,    63510774.0,  2422987429.0,   170961062.0},
-  { 631726596.0,   460127685.0,  2610653443.0,   118123538.0,  3302083432.0,  1182202796.0},
-  {2574187123.0,  2868045779.0,  1626756710.0,    91085173.0,   523867826.0,  1530872440.0},
-  {3266227811.0,  1611720833.0,  2973226922.0,  4130573943.0,   672378672.0,  2302853897.0},
-  {3324556383.0,  2140849402.0,  3255056351.0,  2504099554.0,   119035872.0,  3259814751.0},
-  {2383360045.0,   178890004.0,  4216371572.0,  1835747028.0,  2147526198.0,  4116890510.0},
-  { 548907245.0,  1164683216.0,  2114414592.0,  2120922022.0,  4182286946.0,  1913317807.0},
-  {3822271665.0,   212076402.0,  2644410849.0,  3991442543.0,  3537996351.0,  1261075456.0},
-  {1065143826.0,  2534703304.0,   243966603.0,   975325608.0,  3040621487.0,  2146447948.0},
-  {1654863975.0,  3414498594.0,  2559729695.0,   891046677.0,  3982390051.0,  3469038806.0},
-  {3708579363.0,  2042146412.0,  2600853554.0,   665564391.0,   204503999.0,  2628820525.0},
-  {2059488156.0,  2190958713.0,  3975896895.0,  4256809751.0,  3334171165.0,  1797659297.0},
-  {4278746889.0,  1993412314.0,  1338687861.0,  3258100049.0,  2564721985.0,  3137324158.0},
-  {2777041409.0,  1316733336.0,  2967271574.0,  3261914640.0,    52498690.0,   922044609.0},
-  {3236465708.0,  4104488440.0,  3308432682.0,  3368212641.0,  3969995073.0,  3530815228.0},
-  {3250331275.0,  1612894037.0,  2030682655.0,   689038336.0,  3088398277.0,  1069515257.0},
-  { 735156457.0,  1288170926.0,  3421821147.0,  3002015339.0,  2834570118.0,  1051661936.0},
-  {3502320553.0,  4009233964.0,  2460835729.0,  1762243848.0,  2948845258.0,  2232618168.0},
-  {4011663882.0,  2131015257.0,  2944153532.0,  3884313083.0,  1167327861.0,  2309515229.0},
-  {2742774896.0,  1764027578.0,  2778211510.0,  2066778473.0,  1748855553.0,   711653803.0},
-  {2991159918.0,    66350499.0,  2231459129.0,  2209499484.0,  2118803043.0,  4008492190.0},
-  { 592798272.0,  3685927769.0,  2232564086.0,  2523394680.0,  4093031464.0,  1474629363.0},
-  {3672844873.0,  2322320461.0,  1143623280.0,  3227397901.0,  1114857571.0,  3073234977.0},
-  {4105587697.0,  2278851551.0,   525886695.0,  3611450478.0,  3186428973.0,  3932939100.0},
-  {2666216993.0,  2154797908.0,   195323389.0,  2806996631.0,  3383052764.0,    89109265.0},
-  {3485667850.0,  1616719922.0,  1415246656.0,  2158024528.0,  2537606761.0,  3619893101.0},
-  {1302742467.0,   214730760.0,  3448652958.0,  3773318890.0,   488613468.0,  1798689100.0},
-  {3235149955.0,  2446292810.0,  2895085248.0,   565326996.0,   109808295.0,  1166968611.0},
-  { 862796992.0,   291445622.0,   746635697.0,  3588849941.0,  2253257677.0,  4092336391.0},
-  {3607403026.0,  3921113272.0,   364063250.0,  1907798571.0,  2565402775.0,   638218268.0},
-  {2913187736.0,  1445997349.0,  2455156546.0,  1891700454.0,   531864037.0,  3814322969.0},
-  {3309668349.0,  3914500206.0,  2171829856.0,  3550909434.0,   669807821.0,  3576794371.0},
-  {2073098489.0,  3640598854.0,   462077624.0,  3830674355.0,  2242949417.0,  1538219836.0},
-  { 283707476.0,  1672024657.0,  2708323757.0,  3868384152.0,  3228353390.0,  4107859362.0},
-  { 312556030.0,  1106514024.0,   322052227.0,   676681160.0,   228317399.0,  4051409170.0},
-  {4279280813.0,  1600492969.0,  2441183867.0,  4200984531.0,   420781440.0,  2584548316.0},
-  {1457866139.0,  1498262739.0,  3797471921.0,  1911895023.0,  1565171051.0,  1329578950.0},
-  { 909213766.0,   344621526.0,   248748757.0,   672489240.0,   454529929.0,  1833902544.0},
-  {2948656681.0,  3410280273.0,   526028024.0,   273414674.0,   780768607.0,  3620789606.0},
-  {3835705507.0,  2323078568.0,  4188071914.0,  3457482276.0,  2945234167.0,   476299525.0},
-  { 466888934.0,  3902781259.0,  2215891311.0,  3464760662.0,  2178182262.0,  3040281078.0},
-  {1539523976.0,  1566660432.0,  4008510300.0,   283964906.0,  2062655112.0,  2705930309.0},
-  {2263134406.0,   376990352.0,   163258794.0,   941852987.0,  2911471659.0,  4023119500.0},
-  {3525015345.0,  2882934454.0,  2047234443.0,  4075496896.0,  2394495998.0,  1293005659.0},
-  {2032857234.0,  4088977491.0,   331723693.0,  3857896027.0,   734575372.0,   484114738.0},
-  {1093135131.0,   331017957.0,  1339659603.0,   403955928.0,  1966600954.0,  2860684026.0},
-  {2715224911.0,   341800905.0,   293284821.0,  1374563131.0,  3422483551.0,  3431609349.0},
-  {3846104662.0,  2662503718.0,  3122350749.0,  1579160295.0,  2780411923.0,    38181468.0},
-  {3160697768.0,  3047364594.0,  2068602490.0,  1092103965.0,  3279036578.0,   795545279.0},
-  {2011614073.0,  3304950817.0,  2731797963.0,  3522458457.0,  3101370512.0,  1000324113.0},
-  {3292583571.0,   233806134.0,   400043528.0,   356916736.0,  1981227179.0,   175427402.0},
-  {3740067564.0,  2653826674.0,  2529709833.0,  2158090054.0,  4137659543.0,  3612339141.0},
-  {3849142000.0,  2723959256.0,   486748291.0,   439987234.0,  3421605013.0,  2834442548.0},
-  {2139397730.0,  3549097161.0,   791123542.0,  1507188122.0,  3160409526.0,  1171487365.0},
-  {1061693790.0,  3554173914.0,  1936471672.0,  1197917339.0,   732238633.0,  3204462780.0},
-  {1757020096.0,  3315534665.0,  1603475131.0,  1179773770.0,  4009951747.0,  1051069736.0},
-  {3481755518.0,  2222300994.0,  2185612665.0,  3824437095.0,  3163931231.0,    90491252.0},
-  {1842844865.0,  3522904326.0,  2692581450.0,  3515691393.0,  2811190042.0,  1975574162.0},
-  {2857582417.0,  4086912106.0,  2065324715.0,  1135167479.0,  2165868900.0,  1065105570.0},
-  {2003422353.0,   895409484.0,   395659845.0,  2147102242.0,   537233375.0,  1485881856.0},
-  {3098001415.0,   251265061.0,   669460202.0,  1773076640.0,  1528217868.0,  4132906021.0},
-  {2790816685.0,   878945828.0,   580620752.0,  2883813061.0,  3313386740.0,   770565456.0},
-  { 565700849.0,  1978732320.0,  3344822578.0,  2115652162.0,  1110674627.0,  3227434239.0},
-  {1142700274.0,  3571247575.0,  3162884050.0,  1969115426.0,   413703615.0,  1406283394.0},
-  {1752220789.0,  2448338544.0,  3570280533.0,   860242245.0,   341625482.0,   303931741.0},
-  {1806024285.0,   298765179.0,  1773695188.0,   244928024.0,  4092509815.0,  2540695165.0},
-  { 144978201.0,  1283243641.0,  3230365222.0,  3676155018.0,  1760589800.0,   809249633.0},
-  {4048783350.0,  1312535374.0,  1162647459.0,   969146107.0,   461916980.0,  1668818715.0},
-  {3017956133.0,  3860414521.0,   998963676.0,  2540548513.0,  3444271070.0,  2365172892.0},
-  {1538951513.0,  3944869602.0,  4055472402.0,  4291815786.0,  3922502850.0,  1947830619.0},
-  {4168524169.0,  4105297216.0,  1568095786.0,  1209847873.0,  2604492629.0,  1694194642.0},
-  {1690035127.0,  3666639813.0,  3317184864.0,  1349043137.0,  2880305334.0,  3890119009.0},
-  {3717047922.0,  2088549909.0,  4146106927.0,  2944457973.0,  3399377810.0,  1242103607.0},
-  {2271791682.0,  1670478083.0,  3761688181.0,  3951150605.0,  1557240425.0,  1910694456.0},
-  {3859068829.0,   300376114.0,  3961700792.0,  2279909432.0,   779166729.0,  3584262943.0},
-  {1138026278.0,  1293025864.0,   451065908.0,  3948491974.0,  1712295284.0,  4105187171.0},
-  {3374984028.0,  2345025016.0,  1652134169.0,   777314392.0,  2615233616.0,  3834442529.0},
-  {3628223846.0,   410589070.0,   794893430.0,  3990436780.0,   614827104.0,    98419925.0},
-  {3050462314.0,  2025744782.0,  3630514462.0,  1014348254.0,  3770342038.0,  2096173208.0},
-  {2040759549.0,    58849711.0,  3901955446.0,  3090826029.0,  4223154932.0,  2403534703.0},
-  { 119219846.0,   310903977.0,  2180333610.0,  3334808929.0,  2352347784.0,  3451592106.0},
-  {2152660991.0,  4032903295.0,  3814094909.0,  2339981604.0,    38914890.0,   108072682.0},
-  { 803649543.0,  2667160678.0,  3414987476.0,  3764416459.0,  2129830387.0,  1728376030.0},
-  {2536125558.0,   412735067.0,  3073673003.0,  2973165789.0,  3074077584.0,  1442951000.0},
-  {3164916948.0,  3288578422.0,  3114157831.0,  3882773404.0,  3514751881.0,   601854729.0},
-  {2381037706.0,  1177766165.0,  3801326421.0,  2487798057.0,  2213157360.0,  2188044361.0},
-  {1776143915.0,  1662215003.0,  3340560215.0,  4253307194.0,  3546966017.0,  1532567040.0},
-  {1932836698.0,   935152485.0,   514180061.0,  2349663250.0,  4236501410.0,   955770994.0},
-  {3235270226.0,  3843132549.0,  2045593002.0,  3303846945.0,   596972915.0,   779230059.0},
-  {4178567886.0,  2837114890.0,   804317591.0,  4092331201.0,  3922047070.0,    22696617.0},
-  { 469244177.0,  2624216518.0,   462705093.0,  1011671211.0,  3488046278.0,  4095143500.0},
-  { 372857653.0,   663476696.0,  3816756242.0,  1663989988.0,   570437691.0,   170555061.0},
-  {1042836502.0,  1851525394.0,   955408555.0,  3112081673.0,  4218797961.0,  2681073052.0},
-  {2571137702.0,  4051416880.0,  2241560340.0,    26067011.0,  1939426523.0,  2370586175.0},
-  { 998091069.0,  1908141827.0,  1379238619.0,  2356285846.0,   319081729.0,   406631165.0},
-  {1581380497.0,  1228515350.0,   595474229.0,  2789794132.0,  2410878949.0,  2907392716.0},
-  {2795242659.0,  1126150975.0,  3906597421.0,  3519114649.0,  1023444544.0,   354699750.0},
-  {2435330044.0,   457953338.0,  1639847488.0,  2902718922.0,  2304525684.0,  1039898625.0},
-  { 461883808.0,   598562037.0,   113253441.0,  3234634968.0,  1662041676.0,  2274184347.0},
-  {2591222797.0,  1704263375.0,  1188026029.0,  3318670687.0,   442411351.0,  1628272593.0},
-  { 100790599.0,  4064505723.0,  1557774459.0,  1906626959.0,  3076405444.0,  1944487502.0},
-  {3379691095.0,   955339763.0,   489751950.0,  3284279445.0,  2046474644.0,  3471561029.0},
-  {1717451932.0,  1357411945.0,  1682459070.0,   707399079.0,  1601408381.0,  1909470290.0},
-  {4060995280.0,  2500277293.0,    11379861.0,  1584136661.0,  2240020710.0,   429136922.0},
-  {2954758731.0,  1664268286.0,   609182972.0,  3915402788.0,  1818823246.0,  2584368834.0},
-  {2392490011.0,  1117231368.0,  2984936866.0,   413466182.0,  2590716774.0,   490495998.0},
-  { 567531811.0,  3772583765.0,     2270259.0,      616798.0,  2404526161.0,   785205748.0},
-  {3491200488.0,  3892322268.0,  3848648878.0,   731204020.0,   580168451.0,  3554667942.0},
-  { 748275148.0,   402499983.0,   267286089.0,  2085328659.0,  2386298237.0,   136538441.0},
-  {2229851774.0,  2482210130.0,  2509181792.0,  1984481472.0,  2231200485.0,  2054779383.0},
-  {2601402840.0,  2533616819.0,   108317630.0,  1327984568.0,  3638268141.0,   970258291.0},
-  {3171208146.0,  1140945287.0,  1545530833.0,  1221530572.0,    69714641.0,   329325041.0},
-  {1842794914.0,    15144837.0,  2887980987.0,  2509365887.0,  1270124095.0,  2365385801.0},
-  {3306227603.0,  3095009408.0,  2910627888.0,  1217633352.0,  1852141531.0,  3784988033.0},
-  { 656153686.0,   597410768.0,  4111616581.0,   914153977.0,  2763286051.0,  3089407775.0},
-  { 357793624.0,  1585944288.0,   633746266.0,  4039329506.0,  1199985248.0,  2037904538.0},
-  {3837861406.0,   203826884.0,  4043677903.0,  2305897386.0,   960267742.0,  3166942604.0},
-  {3520744594.0,  2159715680.0,  4106826001.0,  1091489175.0,   570481577.0,  2584068533.0},
-  {2933950521.0,   565103866.0,  3697868051.0,  3619695761.0,  3531597206.0,  3661247106.0},
-  {1962548405.0,   501776719.0,  3079321434.0,   198335804.0,  2386711525.0,  1598536954.0},
-  {3873055201.0,  2759161341.0,  1278838543.0,   607411820.0,  2965916682.0,   954879719.0},
-  {1231804538.0,   293595421.0,  3475640477.0,  1937322678.0,  1252048225.0,  4141622499.0},
-  { 428477520.0,   148908090.0,  1536555125.0,  3645104207.0,    17332925.0,  3528885762.0},
-  {2983407729.0,   709829644.0,   355412287.0,  1880128203.0,  3935780333.0,   806261307.0},
-  {1637437793.0,  2574496483.0,  2091653077.0,  3746393249.0,  3114742806.0,  3949856494.0},
-  {2556425386.0,  3148586507.0,  2489786372.0,  3063473542.0,  1102531696.0,  2704829311.0},
-  {3908985310.0,  1938314465.0,  2549144550.0,  3547306184.0,  2317558667.0,  2137137699.0},
-  {1486649506.0,  3730109379.0,   199992695.0,  3204970780.0,  1638009168.0,  4052660214.0},
-  {3529631565.0,  1370913727.0,   634735514.0,  2489124757.0,  3605149402.0,  2190083118.0},
-  { 693730996.0,  1019296826.0,  2695970047.0,   181221610.0,  3412911162.0,  3588920743.0},
-  { 370355824.0,   673755814.0,  2642522135.0,  2682882181.0,  3015248855.0,  3817532708.0},
-  {2526275951.0,  2342865834.0,  1967001580.0,   957406137.0,  1715087596.0,  2712823631.0},
-  {3252558026.0,  1678722865.0,  3452823447.0,  4085918322.0,  2259428330.0,  4123005522.0},
-  { 331788960.0,  1376060886.0,  3667308281.0,  3457673808.0,  1887668433.0,  2737355742.0},
-  {2083440435.0,  2069948857.0,   865374720.0,  2022186249.0,  3326755051.0,  2666893800.0},
-  { 277461378.0,   598724135.0,  1428151889.0,  2343168038.0,  3775990348.0,   677573474.0},
-  {3496175232.0,  2248411097.0,  3375740870.0,  1263112389.0,  1925775083.0,  2366594105.0},
-  {1853400410.0,  3845051993.0,  3509133639.0,  1495178536.0,  3713882664.0,  3511555335.0},
-  {3865845343.0,  2375937254.0,    66112458.0,  4171871853.0,   292173921.0,  1069539912.0},
-  {1304724181.0,  3181543680.0,  3778529721.0,   269830255.0,   323931361.0,   810881593.0},
-  {1491664091.0,  1088022392.0,  2673989886.0,  3086986077.0,  3139366857.0,  1423850741.0},
-  {2152475394.0,  3840251374.0,  3535470119.0,  3005322857.0,  4208493118.0,  3926755535.0},
-  {1488566089.0,  3131077136.0,    86903779.0,  3104564845.0,  1049910709.0,   339336088.0},
-  {3582430980.0,  2440702187.0,  1228911583.0,  1689712975.0,  3283902285.0,  2470109953.0},
-  {1291404980.0,  3080422408.0,  1876431491.0,  1921404252.0,  4262315378.0,  3700234434.0},
-  {2053308927.0,  1914329972.0,   723887712.0,  3153549030.0,   113632826.0,  3018287049.0},
-  {2466068073.0,  3316744064.0,  2867199807.0,  4072027659.0,  2059562961.0,  2211791246.0},
-  {2463500221.0,  3719403933.0,  1985753335.0,  3537736672.0,  3960834755.0,  2035512134.0},
-  {2758757368.0,  3346771828.0,  2092243668.0,  1042087524.0,  2134327505.0,  4009546872.0},
-  {1373709272.0,  4053397979.0,  1609858605.0,  2366705240.0,  2726281042.0,  2464262074.0},
-  { 483966588.0,  3956094885.0,  1125932497.0,   104024321.0,  1452176670.0,   373431338.0},
-  {1533555019.0,  3023969334.0,  1933060183.0,    46296548.0,  2008510922.0,  2220148345.0},
-  {2336847308.0,  3645423490.0,  3818705272.0,  3644798645.0,  1418729523.0,  2226493755.0},
-  {1186132331.0,  3208445845.0,  3370916692.0,  3160432759.0,  1750913510.0,  1178388880.0},
-  {3452568162.0,   799393077.0,  3663633952.0,  2506711252.0,  1595569939.0,  2251633045.0},
-  { 230355785.0,  1549072476.0,  1961504201.0,  3336541105.0,  3774298745.0,   176796424.0},
-  {1670258216.0,  1499343996.0,  3614136565.0,  2452250071.0,  4014747629.0,   276560533.0},
-  {3392199554.0,   693585020.0,  3958651256.0,  3320626185.0,   902802299.0,  1571866368.0},
-  {2447999722.0,    69536543.0,  1006547021.0,  2727134678.0,  2154892538.0,  3274213801.0},
-  { 213352719.0,  1890313968.0,   558496352.0,  2854130530.0,  4131483812.0,   200198466.0},
-  { 103389167.0,  3699361186.0,  3386297569.0,    73444972.0,  1237272196.0,   993274541.0},
-  {2991356590.0,  2696086076.0,   411514678.0,  4195443059.0,  1831308188.0,  3714166476.0},
-  { 616882695.0,  1102599147.0,  1918799617.0,  2446009866.0,  2103050197.0,   593171226.0},
-  { 409980894.0,   689060057.0,  2889365694.0,   880350490.0,  2881960809.0,  2385768737.0},
-  {3547828728.0,  2325351568.0,   856060448.0,  1062180322.0,  4050927266.0,  2442547410.0},
-  {2759039569.0,    96191462.0,  3926575792.0,   854443533.0,  2573592819.0,  3830385540.0},
-  {1294078706.0,  2000869588.0,  1062624536.0,  3181783693.0,  2309540231.0,  2354448509.0},
-  {1333855841.0,  3038331552.0,  2949075491.0,  3779956080.0,  1097223292.0,  3559637379.0},
-  {1750169979.0,  3046884490.0,  3325811605.0,    57715309.0,   953081702.0,   113534135.0},
-  { 252200898.0,  1872706628.0,  3606567305.0,  4157332261.0,    62072772.0,   455165505.0},
-  {3979631744.0,   407784334.0,  2294761186.0,  3416185604.0,  4264083773.0,   561281411.0},
-  { 416766838.0,   507243855.0,  3840272618.0,  1078986311.0,  3472078970.0,  3309881310.0},
-  {  82159362.0,   889473571.0,  1066428661.0,  1302739002.0,  1392008164.0,  2726486232.0},
-  { 579439564.0,  1548536078.0,   171180404.0,  3102039380.0,    44356225.0,   869115977.0},
-  {3660506424.0,  1455765294.0,  2459054750.0,  2690618114.0,  1488075929.0,  1489281921.0},
-  {3909509969.0,   526640073.0,   835384457.0,  4216546185.0,   123351337.0,  1550076728.0},
-  {1943081987.0,  2739256278.0,  3478181553.0,  2458651514.0,   911786738.0,  4243830166.0},
-  {4245859047.0,  2249430657.0,  1015374083.0,  4103473364.0,  1234154180.0,  2829068448.0},
-  {1797407965.0,  4291515607.0,    98109679.0,  3898272585.0,  4037905860.0,  3641858575.0},
-  {3974874161.0,  3447822050.0,  3223430733.0,   795335474.0,    30187215.0,  2711968285.0},
-  { 872041854.0,  2781957578.0,  1757691460.0,  1544606638.0,  3407389038.0,   757213913.0},
-  {3549534548.0,  4222816851.0,  3802360078.0,   930710195.0,   787026016.0,   104178225.0},
-  {1957009377.0,   910657279.0,  3139337489.0,  3917642673.0,  3155236214.0,  3522213560.0},
-  {2721227136.0,  2844043041.0,  4113006557.0,  2332883297.0,    43308647.0,  1546992789.0},
-  {4143462288.0,   661896766.0,  2180811389.0,   351160089.0,   396550681.0,  2898505983.0},
-  {3709229630.0,  1538660082.0,  3638032317.0,   736305011.0,   116479505.0,  3786388905.0},
-  { 306779959.0,  3934637663.0,  2432583059.0,  3772465586.0,  2790075799.0,  2805769060.0},
-  {2064694814.0,  3469600201.0,  2113936661.0,  3923922293.0,   914255399.0,  3744136187.0},
-  {3237761989.0,  1576675264.0,   141801470.0,  2323149142.0,  1106231384.0,   323616754.0},
-  {1402699976.0,  3159114033.0,  3342503806.0,  3112828697.0,  2828741932.0,  3071752021.0},
-  {2994811677.0,  2621393626.0,  1791286255.0,  1095161631.0,   182001711.0,  4243449448.0},
-  {3696007004.0,  2910968265.0,   622921884.0,  3254881480.0,  4187253238.0,   766836795.0},
-  {3667870594.0,  3925817758.0,   934931355.0,   945233337.0,  1131605005.0,   787128731.0},
-  {1724310324.0,  2072618669.0,   515519313.0,  1201641859.0,   886136217.0,  3918512836.0},
-  {2086598441.0,  2252906881.0,  2285373115.0,   982511541.0,  3137684712.0,  1110492110.0},
-  {1709422868.0,  4188543030.0,  2543553601.0,  4065379001.0,  2910358216.0,   807617467.0},
-  {4287181264.0,  2450949646.0,  3640702996.0,  4107723912.0,  1289226192.0,  3092906099.0},
-  {2610630294.0,  2018805121.0,  1515676248.0,  1143018261.0,  1109819275.0,  3265770351.0},
-  {3105843639.0,  3176697907.0,   934026105.0,   922650000.0,  2119185096.0,  3937104235.0},
-  {3405089474.0,  1626911461.0,  2491629993.0,  3550115621.0,  3615253851.0,  2185286007.0},
-  {4250970605.0,  2247141194.0,  4160009317.0,    19851053.0,  3029883115.0,  2473778054.0},
-  {1073701048.0,  2990007778.0,  1741645285.0,  1113494761.0,  3661750244.0,   293906095.0},
-  {1584178722.0,   613297421.0,  3810254128.0,  2287828410.0,  4057983804.0,  1525607905.0},
-  {4218656192.0,  1774967608.0,   479512120.0,  4084804423.0,   529711759.0,  2920016361.0},
-  {1516660648.0,  2881695336.0,  1276472177.0,  1076464589.0,  1609903015.0,  4277262053.0},
-  {2925435243.0,  3416496871.0,  3534352229.0,  3025685044.0,   956944197.0,  2970061449.0},
-  {  26418005.0,   633049266.0,  3343765969.0,  1516565017.0,  1495320531.0,  3851505893.0},
-  { 960648614.0,  1890976109.0,  2267314250.0,  1423628819.0,  4072595317.0,  3277143652.0},
-  {3600414311.0,  2932374255.0,  1269121955.0,   657889522.0,   277108743.0,  1674833452.0},
-  { 624598503.0,  2965422928.0,  1656456005.0,  3265238803.0,  3779955301.0,  1109021291.0},
-  {4054648752.0,   220488884.0,  2552032788.0,  2151859273.0,   342645771.0,   144324456.0},
-  {2360756626.0,   699597589.0,   257232530.0,  2043294209.0,  2956421841.0,   260837687.0},
-  {2076623840.0,  3627401429.0,  3043540959.0,  3470550645.0,  2833569086.0,  2714383323.0},
-  {1093280431.0,    97836152.0,  2813460043.0,  2400327094.0,  3220790402.0,  3298098580.0},
-  {1650994967.0,  1034346017.0,  4087190900.0,  4146835364.0,  1455539959.0,  1424731905.0},
-  {3245469070.0,  2905531820.0,  1899921945.0,    56134865.0,  3244243069.0,   176920034.0},
-  {3508073447.0,  1674746030.0,  1073743090.0,  2578392335.0,  3405869426.0,   565224543.0},
-  {2772891695.0,  3708714589.0,  2066248952.0,  1975834706.0,  4143600982.0,   440279851.0},
-  {1407214380.0,  3854980005.0,  2469050367.0,  1809946969.0,  2449827299.0,  2216035302.0},
-  {1195223484.0,   908527880.0,    43248172.0,  2708344899.0,  1877032341.0,  1295625855.0},
-  {2721424047.0,  3644966707.0,  2151097894.0,   648283244.0,  3443915759.0,  1509431988.0},
-  {1779248918.0,    23853276.0,  1111557288.0,  3221601138.0,  2224660190.0,  3661287553.0},
-  {4238552514.0,  1104543573.0,  2082147032.0,  3642920145.0,   413334954.0,  1287753693.0},
-  {1765056731.0,  2792237399.0,  3082654508.0,   956796352.0,   297064068.0,  3211194041.0},
-  {1105242974.0,  2407628431.0,    14003263.0,  1600210993.0,  3004333051.0,  2323960674.0},
-  {4165663960.0,  2997060021.0,  1691989988.0,  3896088588.0,  2245270018.0,  2961489519.0},
-  {3354850277.0,  2744653085.0,   925085051.0,  2974235296.0,  2989883645.0,  1964529360.0},
-  { 958559553.0,  4138774919.0,  3256392716.0,  2781039475.0,   935391315.0,  2515205402.0},
-  {1070811670.0,  2029212296.0,  3350282367.0,  4245104010.0,    56484385.0,  4006896294.0},
-  {4272496100.0,   808422964.0,  2051009391.0,  1332973690.0,  1975088108.0,  4151630823.0},
-  {4220399352.0,  4007936070.0,  3870389337.0,  4232470156.0,  1192714609.0,  3591344025.0},
-  {4047205476.0,   742175401.0,  1946387395.0,  1871043879.0,     4864612.0,   269480512.0},
-  { 780835661.0,  4240346617.0,   913946510.0,  3387820089.0,  2717333846.0,  3211135430.0},
-  { 837486438.0,  2259333804.0,  1936341866.0,  1587857850.0,  4028155183.0,  1357558777.0},
-  {1632254147.0,  3312161380.0,   766125424.0,  2495545458.0,  2613066683.0,  2326318025.0},
-  {2768203392.0,  3243780720.0,  2439644382.0,  2148783497.0,   498160676.0,  1026892037.0},
-  {2810096850.0,  2094321311.0,  1328757061.0,  1748632439.0,  1944960706.0,  2975813702.0},
-  { 115182166.0,  1851377361.0,    90740162.0,  2932688305.0,  1448419717.0,  3425670800.0},
-  { 560237018.0,  1514669904.0,   993023200.0,   245723229.0,   372898327.0,   822734221.0},
-  {2406810609.0,  4278988716.0,  1581409622.0,  4089087739.0,  1578701418.0,   874470794.0},
-  {3888408804.0,  1962176442.0,  1655630031.0,  1377432234.0,  1705006929.0,  4205351163.0},
-  {3312384279.0,  1318321279.0,  1247613027.0,   441686040.0,  1333601575.0,  1158807815.0},
-  {3571377966.0,  3829568266.0,  3768732672.0,   438865250.0,  1241305125.0,  2853595695.0},
-  { 128271638.0,  1306931542.0,  2444756002.0,  2496220317.0,  3456885469.0,  1992560992.0},
-  { 670924243.0,  1952827523.0,  1137531074.0,  3352353437.0,  1434349662.0,  1654074497.0},
-  {3997081237.0,  1166867418.0,  4127397225.0,  3021415807.0,  1526765203.0,  1356611044.0},
-  {1558495720.0,  1909698680.0,    86090655.0,  3830407614.0,   901136010.0,  1393955058.0},
-  {1749067090.0,  3777987976.0,   294551016.0,  1219487608.0,  3794773732.0,  2989076742.0},
-  { 986959816.0,  2698863620.0,  1147953808.0,  3290476085.0,  2244610669.0,  1793336348.0},
-  { 882475593.0,  1705202133.0,  3769259692.0,  3509327761.0,  3738816746.0,  2293249710.0},
-  {3102813538.0,  2767086256.0,  3064079406.0,  3398290900.0,  3537917822.0,   395964548.0},
-  { 105136810.0,    47384813.0,  3918476326.0,  3210228296.0,  1523303056.0,  1205901403.0},
-  {1916833511.0,  2777739783.0,  1439008682.0,  3265459573.0,  1023729130.0,  4004642791.0},
-  {2176523093.0,  2713267368.0,   624730185.0,  4125970905.0,  1252161505.0,  1194361562.0},
-  {3925284099.0,  3867871191.0,  1117446501.0,   186953462.0,  2674137467.0,  2465872047.0},
-  {4172267928.0,  3146714826.0,  2714143779.0,  1769851125.0,   497528571.0,  3507403346.0},
-  {3443146828.0,  2195829951.0,  3888948374.0,  2047640376.0,  3670511853.0,  4147769799.0},
-  {  94474009.0,  1068977888.0,  2329466569.0,  1179173496.0,  3902685951.0,  2100278889.0},
-  {4105943821.0,   213272730.0,  1501647165.0,  3782817584.0,  1147314200.0,  2624974141.0},
-  {3807985798.0,  1440933400.0,   289954241.0,  3321524985.0,  3520413149.0,  2495958487.0},
-  {1952675326.0,   541866731.0,  3335569179.0,  3364005854.0,  3988981030.0,  3701957638.0},
-  { 281650814.0,  3112251321.0,  4275966031.0,  1827936735.0,  1158886758.0,    86891266.0},
-  {4066072455.0,  3912167447.0,  1627105478.0,   266554182.0,  1847788824.0,  2878968377.0},
-  { 855970432.0,  3879858393.0,  1351088974.0,  4038072331.0,  2252726828.0,  3666367866.0},
-  {3892852152.0,  1570980068.0,  2007256612.0,  2414238011.0,  3211349834.0,   660626584.0},
-  {2135226337.0,  1526741214.0,  4050653404.0,  1594272429.0,  3118746395.0,  2180322548.0},
-  {1068929531.0,  4030083204.0,  2847265682.0,  2545462352.0,  1154300689.0,  1960746745.0},
-  {4277158417.0,  2158443040.0,  1791461569.0,  1989580791.0,  4203244820.0,   669281139.0},
-  {1423977766.0,  3922865652.0,  3826499115.0,  2567280053.0,  4168006751.0,  2343831795.0},
-  {1365563097.0,  2302735936.0,   380908911.0,  1676146195.0,  1820387525.0,  1223027723.0},
-  {2958101886.0,  1116413639.0,  3337282973.0,   363256475.0,  1958778584.0,  2809070975.0},
-  {  57465045.0,  3938509358.0,  1878901612.0,  3862907283.0,  3458874173.0,  4133099949.0},
-  { 972592583.0,  3765601874.0,  3410356390.0,  4145454523.0,  1114516077.0,  2578857278.0},
-  {2664754311.0,  2140577183.0,  2977542354.0,  4048393042.0,  1904981176.0,  1682256397.0},
-  { 124801260.0,  4060422846.0,   281385677.0,  2460977306.0,   312053090.0,  2445882829.0},
-  {3856814726.0,  3629896458.0,   762060286.0,  1978084738.0,   181309615.0,  2636386791.0},
-  {3351955472.0,   719145064.0,  2883229978.0,  4159023450.0,  3641042510.0,  3820758125.0},
-  {2033311939.0,  2274277361.0,  1397825513.0,  2571380707.0,  2321934854.0,  3979638307.0},
-  {3883376204.0,  3683271424.0,  3412478676.0,  3825301736.0,  2244684483.0,  1887643743.0},
-  {2871363939.0,  2985404857.0,  2560426020.0,   212390843.0,  2240875928.0,   968782290.0},
-  {2992782361.0,   528343790.0,  1582619091.0,  2397410222.0,  3698149725.0,   732563876.0},
-  { 228133322.0,  1516583757.0,  3724617881.0,  1027160603.0,  1468082273.0,  2585764000.0},
-  {4000213352.0,   631256121.0,  3519371364.0,  3719066456.0,    62131936.0,  3392567247.0},
-  { 385978114.0,  1368571285.0,   186850235.0,  1030755664.0,  1134768117.0,  1804465998.0},
-  {4081498327.0,  3259789665.0,  1797452740.0,  3878694917.0,  4011684926.0,  1103862299.0},
-  {3808585007.0,  4240898966.0,  2978652363.0,  2698016264.0,  1660546530.0,  3084351078.0},
-  {2687710184.0,  2589770078.0,  2812815728.0,  1239203363.0,   402910112.0,   153181839.0},
-  { 531974862.0,  3060044443.0,  1671296547.0,  3286427319.0,  1593488495.0,  2148565888.0},
-  {1192694619.0,   977997068.0,  3603420819.0,  1347344984.0,   874030085.0,  1942237996.0},
-  {2796405446.0,  1900653163.0,   128967745.0,  2704558212.0,  1769693179.0,    91885306.0},
-  {1845164922.0,  2719806373.0,  3304251420.0,  2623767050.0,  3023352465.0,  3902843001.0},
-  {1019202175.0,   221432931.0,  1403991460.0,  2409941464.0,   545626590.0,  3591792116.0},
-  {2300147652.0,  3982939351.0,    62791712.0,  2455886216.0,  1315208105.0,  3282697231.0},
-  {1182036832.0,   343315534.0,  3786843034.0,  4074711638.0,  1409297427.0,  1307498485.0},
-  {2425502769.0,  1226038482.0,  1058446606.0,    99709967.0,  3692761080.0,  3495621540.0},
-  {1151393863.0,   120088608.0,  2801373829.0,  3213594622.0,  1027711220.0,  2122216871.0},
-  {4131295527.0,  2071767280.0,  2640913853.0,  1229291606.0,   240773537.0,  1266497840.0},
-  {2771117994.0,  2063197247.0,  2310006298.0,  2376276489.0,  2249147130.0,  2877523049.0},
-  {2172569998.0,  3097711231.0,  3400035547.0,  2805111553.0,  4084911381.0,  2042522152.0},
-  { 925774323.0,  1639277273.0,  3733524186.0,  2529788483.0,  1512849657.0,  1461265599.0},
-  {1208644054.0,  2341876261.0,  1826790191.0,  3271338687.0,  4216583841.0,  3572498544.0},
-  {1991281789.0,  2613401267.0,  2806471957.0,  2473799516.0,  2391827188.0,  2120131155.0},
-  {1728929381.0,  2475605758.0,  1908590592.0,  3044122063.0,  1903148162.0,  1365778416.0},
-  {4154457776.0,  2846231680.0,   206573558.0,  3935738428.0,  1699499932.0,  2461849386.0},
-  {3604735967.0,  3141215073.0,  1254493456.0,   930200123.0,   508253824.0,  3165127836.0},
-  {1911080003.0,  1956851759.0,   470853721.0,  1451494650.0,   514152949.0,  2446940803.0},
-  {1943669210.0,   560226504.0,  2389461261.0,  2049458283.0,  3194563295.0,  2222926714.0},
-  {4221601832.0,  1711341913.0,    53667132.0,  2985216505.0,  2386778890.0,  2720346091.0},
-  { 842027440.0,  3762257711.0,  1044782960.0,  4178832253.0,   217324071.0,  3158192991.0},
-  { 901915830.0,  3371988033.0,   697027483.0,  1536426572.0,  1754429881.0,   343152753.0},
-  { 824061316.0,  1764596779.0,  1806067345.0,  1172656610.0,  4128036692.0,  3386618281.0},
-  { 999189138.0,  2519350464.0,  1789009470.0,  1980360010.0,   412550649.0,  3684395839.0},
-  {4065071271.0,  2805376707.0,   239886389.0,   474730327.0,   387973078.0,  3844382386.0},
-  {2731255114.0,  1443266366.0,  4054534940.0,   735570996.0,    27856903.0,  3978035176.0},
-  {2328671766.0,  1535570853.0,   390928015.0,  2513957937.0,  1932579330.0,   838553083.0},
-  { 700065442.0,   302105466.0,  3715080965.0,  1963219640.0,  2500912699.0,  3760837512.0},
-  {2847989343.0,  1801295199.0,  3888025166.0,  2532129274.0,  1288412922.0,  2130073802.0},
-  { 487218933.0,  3522461524.0,  2434686745.0,  1882561083.0,  4092946962.0,  3941880020.0},
-  {1678165979.0,   239997647.0,  1259443081.0,  1344632253.0,  3959589443.0,   145941363.0},
-  {1215933836.0,   817866391.0,  4209629150.0,  3545268333.0,  2849003407.0,   478262784.0},
-  { 601774590.0,  1281877034.0,  3538731935.0,  3925215300.0,   910572888.0,   704588666.0},
-  {1768734548.0,   546144315.0,  1525875434.0,  1108708449.0,  2947909622.0,  3366501908.0},
-  {2481954549.0,  3128729486.0,  3967445003.0,   724639015.0,  4036102488.0,  3570334860.0},
-  {4005570358.0,  4048193330.0,  3968791911.0,  2643354886.0,  3088889253.0,  1032541936.0},
-  {1410424002.0,  3091853163.0,  1660569651.0,  3935708096.0,   401934079.0,  1968784721.0},
-  {2186753635.0,   801911028.0,  1106793224.0,   590848758.0,   610528824.0,  3304132643.0},
-  {1577519104.0,  2040160047.0,  3245050387.0,  2067988230.0,   812211311.0,  2554843216.0},
-  {3007092857.0,  1660674948.0,  3918331098.0,    48923916.0,  2580178659.0,    28516816.0},
-  { 698867403.0,    32762579.0,  4000950750.0,  2005825488.0,  1259729101.0,  2868051414.0},
-  {2875582875.0,   124316935.0,  2584254622.0,  3105703179.0,  3191788579.0,  1920359470.0},
-  {4030002916.0,   731534139.0,   760679973.0,   578392551.0,   659926517.0,   742914778.0},
-  {2719930921.0,  2178120562.0,   215029963.0,   487952312.0,  4050027713.0,  4247247527.0},
-  {1610130248.0,   750424982.0,  2313569504.0,  1665799798.0,   970843167.0,   938330945.0},
-  {2709209507.0,  3976707749.0,  3424755835.0,  2582400313.0,  3756118570.0,  1343393568.0},
-  {1664977322.0,  2724924445.0,  2306662148.0,  1046317773.0,  3545302665.0,  3758141323.0},
-  {2206446759.0,  1792192735.0,  2177657566.0,  2947928845.0,  1896582141.0,  1769879802.0},
-  {2665019653.0,  2941802258.0,  3897186149.0,  4083767100.0,   879328816.0,  2434190774.0},
-  {2322839213.0,   844032855.0,  3357335293.0,   621088707.0,  3622694434.0,  3699397675.0},
-  {2391695208.0,  4156221318.0,  1151507701.0,  3516972895.0,  3236665784.0,  1454937207.0},
-  {3242160804.0,  3156772589.0,  2737833086.0,  2788803836.0,  1487697995.0,   450468567.0},
-  {3009212151.0,  1126123662.0,  2683531371.0,  3607910475.0,  3794681135.0,   234317218.0},
-  { 125160275.0,   810068984.0,  1458842621.0,  1332370413.0,  3276822923.0,  4211205006.0},
-  {3365192192.0,  4164780557.0,  3272875209.0,  2852957812.0,   177030731.0,  1720356131.0},
-  {3731846486.0,  1255095938.0,  2954980236.0,  1497731185.0,  3844475066.0,  2580930622.0},
-  {2109111329.0,  3620282545.0,  3027997524.0,  3376615341.0,  2053580261.0,   527500389.0},
-  { 803645486.0,  1941468204.0,  1614891414.0,   384973493.0,  3536967372.0,   880854463.0},
-  { 906546342.0,  1714727201.0,  3574471043.0,  2191442739.0,   360077925.0,  3388925493.0},
-  {1889406905.0,  1413613088.0,  4189091765.0,  3112564171.0,  1972507961.0,  4128483809.0},
-  {2824157692.0,   399668434.0,   775729301.0,  1853622663.0,  2701079103.0,  1104097600.0},
-  { 418809035.0,  2183371067.0,  2528199461.0,  1206168117.0,   692019262.0,  2712246792.0},
-  {1025782160.0,   917056704.0,  1628880222.0,    96019324.0,  3465497986.0,   524209743.0},
-  { 493130405.0,   242024098.0,   188539737.0,  2025084921.0,   705929463.0,  2297088190.0},
-  {1859739963.0,  3614869593.0,  2588204224.0,   755758770.0,  1032790626.0,  2903708526.0},
-  {2360424409.0,   887100037.0,  1158793448.0,  2907994324.0,  2140988034.0,  3898300683.0},
-  {2203335283.0,   719130100.0,   496982192.0,  2885113321.0,  4276589151.0,   316192881.0},
-  {4238958193.0,  1514160461.0,  1469412922.0,  2911734295.0,  1712256412.0,  1726038877.0},
-  {3812905137.0,  2106518572.0,  2206003606.0,  4048757765.0,  3359439589.0,   178182857.0},
-  {2971344570.0,   974211037.0,   381528624.0,  4215721421.0,  1699505165.0,  3288904870.0},
-  {1604616815.0,  2467948885.0,   481506319.0,  2254626968.0,  1462834663.0,  1023963368.0},
-  { 143874687.0,  3867510656.0,  2767456774.0,  2576504348.0,  2933701761.0,  3474269261.0},
-  { 906901571.0,   762132535.0,  1257335647.0,   311398004.0,  3752160803.0,  2971608671.0},
-  { 402319738.0,  1304201303.0,   399006949.0,  1379936450.0,  3958640021.0,  2944169288.0},
-  {2821581850.0,  3833767539.0,  3164297908.0,  2500047708.0,  2434981012.0,  1270834808.0},
-  {3674758679.0,  1465931215.0,  3108264506.0,  2504409933.0,  3074107032.0,  2619662170.0},
-  {3835475668.0,  1749738319.0,  1252257650.0,  3690102270.0,  1763929919.0,   290056285.0},
-  {2115335887.0,  2832041770.0,  1549803188.0,  1332718507.0,  3843616101.0,  3426003819.0},
-  {2838810813.0,  3766472589.0,  2971938913.0,  4262525698.0,  3455695365.0,  1797717332.0},
-  {2605434997.0,  3529319937.0,  2717046534.0,  1039362459.0,  3937824956.0,   313231120.0},
-  {2064505129.0,  2148618149.0,  1338883668.0,  3793279726.0,  1656257857.0,  2613560900.0},
-  {1244861183.0,  3939839388.0,  3320353619.0,   291937054.0,  2228698895.0,  2679020622.0},
-  {3331470275.0,  4094836625.0,   726405652.0,  4148821005.0,  1301355358.0,  2831043366.0},
-  { 622243829.0,  2672323331.0,  3154667983.0,  2026269154.0,   516574581.0,  2056753810.0},
-  {2453938045.0,  1077936662.0,  3135996352.0,  2801436436.0,  2448574713.0,   397811655.0},
-  {3911946896.0,   171217033.0,  2615591104.0,  1249287293.0,  3049759655.0,  3869851242.0},
-  {3073933128.0,   923631932.0,  4196364795.0,  3474144514.0,  1665752523.0,  3037134367.0},
-  {2665397336.0,  2981789095.0,  1653329441.0,  2787118795.0,  1194458869.0,   108265862.0},
-  {1533524677.0,  2154333118.0,  1876525112.0,  1679789904.0,  3240143479.0,   945938320.0},
-  {3969460481.0,  2751914688.0,  2118998331.0,  2466231372.0,  3755513301.0,  3184624306.0},
-  {3788324813.0,  3795166005.0,  3764851981.0,   778874545.0,   506087342.0,  1128622232.0},
-  {2047095687.0,  2318173218.0,  3920412193.0,  3663652836.0,  1142965086.0,   180863247.0},
-  { 833914187.0,  3030977416.0,  2101657248.0,  2077303763.0,  1881704464.0,  3365999589.0},
-  {1757667809.0,  2065065091.0,    22064847.0,   926510587.0,   766031814.0,   459980158.0},
-  {  13520050.0,  2642346873.0,  3713921414.0,  4000491811.0,  2006381132.0,  1560510328.0},
-  {2538475787.0,   556873240.0,  3081831258.0,  3011532636.0,   164154603.0,  3198208278.0},
-  {2330130538.0,  4046238501.0,  2598471274.0,  3997219871.0,  2168266256.0,  2596427390.0},
-  {1457631005.0,  3037150714.0,  2105168613.0,   755754975.0,  2075067659.0,  3150011797.0},
-  {2080152821.0,  2950838825.0,  1462384384.0,   890487493.0,  3182631611.0,  1989402927.0},
-  {2981934446.0,     1481614.0,  2445598545.0,  3476603503.0,   907939307.0,  1804278860.0},
-  {1461269694.0,  3366254950.0,  3998637589.0,  2505700963.0,  3725632633.0,     7160986.0},
-  { 106570506.0,  1531669030.0,  2689889336.0,  3255682635.0,  2904458723.0,  2714911819.0},
-  {2869905590.0,  3488590556.0,  3844996902.0,  3442477177.0,  2201494480.0,  2078588239.0},
-  { 670805219.0,   731333226.0,  2811068273.0,  3349403492.0,  2342318294.0,   650124544.0},
-  {3860062831.0,  2170202288.0,   661622754.0,  2521179578.0,  4005449810.0,  2057269257.0},
-  {3012731123.0,   918889299.0,  2267178132.0,  4015283585.0,  3562195148.0,  1613299808.0},
-  {3678960747.0,  2006298269.0,  1066865787.0,  3778630550.0,  1927430710.0,  1674339381.0},
-  {3094095805.0,  4148138255.0,  1043880525.0,  1370239620.0,  1036185719.0,  4236958754.0},
-  {2368900604.0,  1084545117.0,   741297228.0,  3556382513.0,   126946879.0,   214764602.0},
-  {2904102578.0,   273557610.0,  3973961251.0,   710153245.0,  3100928404.0,   532892345.0},
-  {4104354987.0,  1674264142.0,  3812699998.0,   418070231.0,  3179092648.0,  1010612509.0},
-  {3763937583.0,   942145504.0,   931364986.0,  1194690661.0,  2583765864.0,  2551014920.0},
-  {1074771908.0,  2149389775.0,  1881154037.0,  3225277614.0,   570489555.0,  3704352907.0},
-  {2800749042.0,  2139017032.0,  1592409082.0,  1385217871.0,  3652371816.0,  3419179099.0},
-  { 292386100.0,  1821623798.0,  1547089743.0,  4289593099.0,  3765513383.0,  1824247772.0},
-  { 344079747.0,  3725834383.0,  3575860155.0,  2369255061.0,  4026811363.0,  3546406039.0},
-  {2408817500.0,  4196481900.0,   849267388.0,  1593257853.0,  1609777890.0,   627554592.0},
-  {1198032261.0,  3968740625.0,   951895467.0,  3964530670.0,  3055177586.0,  2231726633.0},
-  {1936005342.0,  1634307976.0,   688594988.0,  1481549789.0,  1278268689.0,  1515626546.0},
-  {1932239577.0,  3241518226.0,  4069188122.0,  4161311138.0,  3390650317.0,  1415931283.0},
-  {2060945087.0,  3322949048.0,  2833361061.0,   750742945.0,  2203217513.0,  2617360107.0},
-  { 810068743.0,  3868325853.0,   672025149.0,  4042254089.0,  2661751023.0,  2164509020.0},
-  {2440981977.0,  2045853343.0,  3943702598.0,  3722691471.0,  1184095005.0,  2137878561.0},
-  {2026768903.0,  1963785104.0,  2403704003.0,  3803783992.0,   722395427.0,  2318255445.0},
-  {3052878242.0,  1972621558.0,   840024616.0,   909068369.0,  2737582848.0,  3475363371.0},
-  { 494797551.0,  3077035433.0,  3686205208.0,    95699761.0,  2147772766.0,  3915467436.0},
-  {3022575973.0,   590236691.0,   651662934.0,  4147407345.0,   959369282.0,  2564841462.0},
-  {1241824376.0,   623098340.0,  1218831680.0,  1137784890.0,   709515751.0,  1177274974.0},
-  {2519212412.0,  1779086266.0,  1910042581.0,  4055919073.0,   708978116.0,  3617926218.0},
-  {3089262452.0,  3504116701.0,  1271406048.0,  1958848230.0,  2992517999.0,  1444765181.0},
-  {1632925654.0,  2520628865.0,  3546998848.0,  1595278236.0,  3400510541.0,  3722249176.0},
-  {4087886269.0,  1004735320.0,  2766274926.0,  2663504245.0,   869007285.0,  3215960617.0},
-  {1629603111.0,  1947659409.0,   122255177.0,  1573041885.0,  1491062887.0,  3356449991.0},
-  { 735044222.0,  1841557791.0,  4243696552.0,  3385023620.0,  3722004635.0,  2292564700.0},
-  {2288060180.0,  1974419554.0,   297972578.0,  2114389014.0,   537867321.0,  1432861510.0},
-  {3083869621.0,    59186273.0,  1102531990.0,   651056264.0,  1747278632.0,  2051458811.0},
-  {1373430056.0,  2544447174.0,  2605851249.0,  2518177440.0,  1597526605.0,  3391408016.0},
-  {2993451476.0,   855873057.0,    49825390.0,  2836081674.0,  3953549012.0,   576641752.0},
-  { 562402612.0,  1744417379.0,   806046087.0,  1070856024.0,  2947588070.0,  3368381544.0},
-  {3583035333.0,  3828757508.0,  1779629224.0,  2826752415.0,  1874575081.0,  1603885290.0},
-  {1071431450.0,  3632699576.0,  1971098788.0,   986971481.0,  2905173479.0,  2519697869.0},
-  {1761488748.0,  2450844956.0,  3536109595.0,  3976387161.0,  2105161799.0,  1232365971.0},
-  {2757900379.0,   625517343.0,  2380496211.0,  1589990364.0,  3386143497.0,  1302341287.0},
-  {1689618760.0,  3533764665.0,  2874300324.0,  2659496943.0,  3933560110.0,  2351982617.0},
-  { 756565550.0,  3675672836.0,  3912659930.0,   954225782.0,  1881696657.0,   942236305.0},
-  {1883647340.0,  1329589843.0,  2048016215.0,  2001875448.0,   821555526.0,  2017525818.0},
-  {1616643961.0,  3940422805.0,  4256997931.0,  1437716168.0,  1963183431.0,  1225392445.0},
-  { 705992684.0,  3320510232.0,  3367863641.0,  1159977045.0,  2183580050.0,  3180674154.0},
-  { 157135563.0,   146729450.0,    35646179.0,  1804178554.0,  1731408574.0,  1703619671.0},
-  {4007568018.0,  2315097959.0,  1601668757.0,  2981889874.0,  1781697332.0,  3963692773.0},
-  {4142967194.0,  1522599667.0,  3627318007.0,  3171413206.0,  1007621812.0,  2340547348.0},
-  {1188877054.0,  3050770742.0,  2189056539.0,  2985498320.0,  2033081052.0,  1378726787.0},
-  {3674296161.0,  1291195725.0,   340345143.0,   893835592.0,   301086364.0,  3104691057.0},
-  {2207489873.0,   589848280.0,  4125477917.0,  2546628531.0,  1131668373.0,   782957373.0},
-  {3403918918.0,  2531441202.0,   696761116.0,   287983077.0,  2795514236.0,  1643730829.0},
-  {2571455514.0,  2497847384.0,  2182824154.0,  2909388752.0,  3712734709.0,  2239597622.0},
-  {2320876782.0,  1600613546.0,   997440823.0,  3481033514.0,  2289991489.0,  2700415035.0},
-  {3315385899.0,  1708769425.0,  2912159344.0,  3359444521.0,   353815871.0,  3086591409.0},
-  {3286297109.0,  2555219830.0,  2680273173.0,   713517935.0,  2311747130.0,  1014296334.0},
-  { 345043303.0,  3582536115.0,  1504444238.0,  1318891729.0,  3043420229.0,  2232114281.0},
-  { 920285703.0,  3446671501.0,  1421328032.0,   726680821.0,  1894857714.0,   123108432.0},
-  {3048169057.0,   194187860.0,  3265887580.0,  2148374965.0,  3417036799.0,  1468893796.0},
-  { 445722777.0,   519437013.0,   303054093.0,  2599982684.0,  3506252211.0,  1249022910.0},
-  {1764672748.0,   868711362.0,  1352031664.0,  4234165958.0,  2191358140.0,  4237395746.0},
-  { 876373495.0,  3089677589.0,  2507190287.0,  3768109689.0,  3410487083.0,  2830419918.0},
-  {2530453947.0,  3085110356.0,  3981546838.0,   674059640.0,  3181705868.0,  3982922230.0},
-  {2216454062.0,  3190368339.0,  2447448766.0,  2606944918.0,  4258473143.0,  3273047399.0},
-  {3672515185.0,   425015929.0,  2412482282.0,  3390389996.0,  2305120168.0,  2694673019.0},
-  {1901584422.0,   426461105.0,  1750421878.0,  1527290243.0,  3406630005.0,  1750507567.0},
-  {3118099931.0,  3466978172.0,  2253871432.0,  1623388014.0,  3038157608.0,   702157751.0},
-  {2717684009.0,  3284241242.0,  1625045049.0,  2365735331.0,  3968429373.0,  1930861635.0},
-  {2884557582.0,  1693548527.0,   206807882.0,  1464771881.0,  2335495598.0,  1973884341.0},
-  {2290111718.0,  3685208272.0,  2011168641.0,  4260101616.0,  2010382538.0,  1513989849.0},
-  {4167460750.0,  4080595278.0,  1807878087.0,  2020749626.0,  2983649558.0,   904893075.0},
-  {1774401822.0,   224175656.0,  1100194381.0,  2969224120.0,  1240836388.0,  2753390009.0},
-  { 865808677.0,   206563937.0,   639384917.0,  1456522460.0,  4034788773.0,   243113191.0},
-  {3709172559.0,  4065780201.0,   973425345.0,  1544798221.0,  2361846507.0,  2331964142.0},
-  { 542747718.0,  3548363544.0,  3623158217.0,  1949025382.0,   536106092.0,  4126487236.0},
-  {1115120454.0,  1193679746.0,  1852725126.0,   300755022.0,  1748101941.0,  2662476338.0},
-  {1872352006.0,  1363542668.0,  1808191362.0,  4115866170.0,  2343881700.0,  2642334583.0},
-  { 459938109.0,  1422270867.0,  4022667100.0,  2032864790.0,  2502229767.0,  2643517831.0},
-  {3790405954.0,  3722207411.0,  1057626805.0,   576206975.0,  3611216705.0,  3086842507.0},
-  { 857630762.0,  1545084820.0,    98426225.0,  3395038923.0,   688133173.0,   604438735.0},
-  { 383697224.0,  3656491768.0,   384613669.0,  3934752725.0,  1574993169.0,  3967020185.0},
-  {2627357308.0,  4122100991.0,  3374129211.0,  1379544581.0,  3361440586.0,  4024903098.0},
-  {1153255690.0,  3428431343.0,  4140019308.0,  4084330715.0,   701746019.0,   567616245.0},
-  {1289873320.0,  3426200444.0,  1602876024.0,  3274988593.0,  3519569303.0,  1619431339.0},
-  {1351364832.0,   253686350.0,  1787744259.0,   457802870.0,  1484108727.0,  3823736120.0},
-  {3669025989.0,  1797752554.0,  1875624486.0,  1876120159.0,  1932067012.0,  3315304981.0},
-  {3598191722.0,  3630365214.0,  2123199004.0,  2842830660.0,   102249870.0,  1864706643.0},
-  {1633589581.0,  2614201653.0,  1102586097.0,  1533993945.0,  3072490953.0,   437695847.0},
-  { 697029012.0,  4133889007.0,  2922908337.0,  1050136567.0,   865126850.0,   586282009.0},
-  {1702195494.0,  1206459958.0,  2131676926.0,  3220687842.0,  1998918083.0,  4036948728.0},
-  {2050619068.0,  3456352003.0,  1945824853.0,  3849229546.0,  2567191675.0,  2362596289.0},
-  {2508478772.0,  3017645802.0,  2537413085.0,  2613169607.0,  1872287624.0,  4111583964.0},
-  { 120656884.0,  3358264213.0,  4255149763.0,  3196836751.0,  4102693471.0,  2015957820.0},
-  { 497839476.0,  2835329474.0,  2366701724.0,   362429302.0,  1477155323.0,  3074245129.0},
-  {2517681589.0,  2781836867.0,  3063069268.0,  4208333826.0,  3137368592.0,       98393.0},
-  {2499890335.0,  2598813783.0,  2190736995.0,    26278736.0,  2377975662.0,  4205022350.0},
-  { 399538117.0,  3181248457.0,  3744991939.0,  2597828636.0,  1655947201.0,  1334906284.0},
-  {3142164897.0,  2852623108.0,  1538386784.0,  1953083131.0,  3041033426.0,  3124887634.0},
-  {1841198023.0,  2253280935.0,  2879153364.0,  2487643388.0,  1292323937.0,  4186278728.0},
-  {1580539735.0,  4171128696.0,  2770679804.0,   808051481.0,  1537678840.0,  2352313842.0},
-  {3229478695.0,   892712329.0,  3901322069.0,  3321686971.0,  3982185302.0,  3573989667.0},
-  {1151712052.0,   306028964.0,   134658943.0,  3754438035.0,  3354398546.0,  1464335445.0},
-  { 940311090.0,  1757956433.0,  4281426972.0,   638430880.0,  4224430738.0,  1960292514.0},
-  {3608800447.0,  3047202785.0,  1277649939.0,  2891119061.0,  3392343774.0,   445539245.0},
-  { 700183626.0,  1457278831.0,    80905938.0,  2438727983.0,  2266216716.0,  1319709502.0},
-  {2161152108.0,  2116236344.0,  2484791707.0,  4149484682.0,  1762754751.0,  1386559735.0},
-  {1703878973.0,    89269188.0,  1193854389.0,  1651958629.0,  4198734294.0,  3000227363.0},
-  {2006269305.0,  1048129981.0,  3742113658.0,  4181881598.0,  3099562336.0,  3235203867.0},
-  { 903954699.0,  2232899358.0,  1210987719.0,  4085979439.0,    85948663.0,   178885687.0},
-  {1804223054.0,  1177624130.0,  3886927969.0,  1158749060.0,  2401743917.0,  1573077914.0},
-  { 374428025.0,  1511047583.0,  3960545470.0,   603440965.0,  3311337149.0,  1716034430.0},
-  { 423343323.0,   134433896.0,  3508359141.0,  1357982922.0,  1828125200.0,  1872688221.0},
-  {2570922604.0,  2464295350.0,  1733068784.0,  1322635582.0,  3970377438.0,  1403821854.0},
-  {1073985750.0,  3898588421.0,  1991050355.0,    22201496.0,  1470865269.0,  1590916294.0},
-  {1023880423.0,  1859370519.0,  2953686802.0,  4001899237.0,  3055545328.0,  1585471874.0},
-  {1266801245.0,  2072464667.0,  3422893026.0,  1953559784.0,  2723280196.0,    57443429.0},
-  {4225729705.0,   896750808.0,  3732295397.0,  2897004607.0,  1681929485.0,  2496100703.0},
-  { 342336054.0,  1541710924.0,   551362133.0,  3602285531.0,  1530347728.0,  4081234313.0},
-  {1423911684.0,  1575616160.0,  1824335982.0,  3295644197.0,   732249525.0,  3292642691.0},
-  { 591332282.0,  1332089631.0,  1195772158.0,  1844489980.0,  1813584930.0,  3608385825.0},
-  {1953509270.0,   922619309.0,  3437199521.0,   436977407.0,   570934907.0,  2184523660.0},
-  { 980073091.0,  4281193113.0,  2579194223.0,  1551896973.0,  3832111848.0,  1705238993.0},
-  {1470510395.0,  3129858885.0,  1850291148.0,    25969495.0,  2885085675.0,  1065707190.0},
-  {1329733277.0,  2859963021.0,  3428518784.0,   503543030.0,  3636361844.0,   564388991.0},
-  {1948771893.0,   590827687.0,  3742151542.0,  3614074295.0,  2773796454.0,  2427510685.0},
-  { 344352330.0,  1103638604.0,  1930433590.0,   312653235.0,  1982026887.0,   908749242.0},
-  {4220706283.0,  2550829526.0,   194365139.0,  2379345865.0,  3611301684.0,   354128658.0},
-  { 930834520.0,  3948360188.0,  3461130751.0,  2881932184.0,  1191892745.0,  3966829206.0},
-  {1644415876.0,  1844223905.0,   144676873.0,  1912321982.0,  3266929852.0,   887302470.0},
-  {3170799611.0,  2967974444.0,  1774123265.0,  1445525888.0,  1345190977.0,  3124508767.0},
-  {1707054523.0,    37718215.0,  1752806237.0,   468944536.0,  1106992769.0,  3284685544.0},
-  {3548199773.0,  1695816979.0,  2939728999.0,  3670277065.0,   744744740.0,  1537098892.0},
-  {3478480213.0,  1526986598.0,  3613292311.0,  2182336988.0,    14975962.0,  1336877910.0},
-  {3660748776.0,  2668224056.0,  3317578529.0,  3673727113.0,  3967180417.0,  1330381319.0},
-  {3213189916.0,  2892658928.0,   825757591.0,  2770000973.0,   339871084.0,  1765301693.0},
-  {1956929874.0,   893739847.0,  3178207854.0,  1768846841.0,  4037402231.0,  2184029226.0},
-  {1461664264.0,   415809987.0,  1129847435.0,  2399268197.0,   178639142.0,  3390521454.0},
-  {1080370432.0,   171265172.0,   650737362.0,  3187093546.0,   779902182.0,  4115249943.0},
-  {   7204256.0,  2944274171.0,  3165410382.0,  2797138009.0,   341430839.0,  1513442718.0},
-  {4092539426.0,  2432497413.0,  3764480611.0,  1603628500.0,   527963235.0,  2836716944.0},
-  {1223671718.0,   765158955.0,  1493512751.0,   998910537.0,  3309970161.0,  3497359596.0},
-  { 478213702.0,  1053511663.0,  3887083026.0,  2409402483.0,  3581773205.0,   962723304.0},
-  {1024198225.0,  1641077090.0,  2997965076.0,  3856681366.0,  2033820802.0,  2091450581.0},
-  {  21440752.0,  2920756029.0,  3200945764.0,  1121443338.0,  4237498289.0,  3579300966.0},
-  { 185336465.0,   287602657.0,  1902442431.0,   285001808.0,  3253954686.0,  3105063153.0},
-  {2332163529.0,  3462754964.0,  3264791416.0,  1651454300.0,  3039998337.0,  2768607043.0},
-  {3455982765.0,  1791545143.0,   121489297.0,  2122407090.0,  3648855800.0,   791254876.0},
-  {3885540547.0,  4292062121.0,   225957440.0,   388288575.0,   618916762.0,  2127591767.0},
-  { 249924009.0,  1001787762.0,  3311784354.0,   992333613.0,  2996929434.0,  1064745319.0},
-  {1179217372.0,  3046240666.0,  3829458518.0,   807401125.0,  4101292279.0,  3486268615.0},
-  {3663955771.0,  1087640193.0,  2122633707.0,  1080762917.0,  4008502001.0,  2407236619.0},
-  {2718156214.0,  1904012306.0,  2501194641.0,   146607083.0,  1358789338.0,  3969845076.0},
-  {2431690814.0,  2791201405.0,  3200289744.0,   844957971.0,  1021392100.0,  2098811471.0},
-  {3582645205.0,  1237701157.0,  2697355964.0,  2804287748.0,  3830173549.0,   266423866.0},
-  {1858735894.0,  2485722883.0,  1428397257.0,   505521952.0,  2807106280.0,  3922248780.0},
-  {4052884152.0,   571763579.0,  2158279577.0,  1514535930.0,   728897910.0,  3052643922.0},
-  {3175380167.0,  3697730689.0,  4054879982.0,  1207338381.0,  1201965258.0,  2525142255.0},
-  {3030181001.0,   314893023.0,  1609076303.0,   310480409.0,  2969836549.0,  2662705898.0},
-  {2636021680.0,   333957846.0,   562121982.0,  1194066988.0,  1085277110.0,  3773303335.0},
-  {3924189725.0,  3877252891.0,   916299010.0,  2153513028.0,   782584725.0,  3732207155.0},
-  {3586671183.0,  2371158465.0,  2757917756.0,  3344389979.0,  3255338806.0,  3037330008.0},
-  { 266602264.0,  2746743380.0,  3943973006.0,  2643152866.0,  2441616201.0,  3476223904.0},
-  {3599000989.0,  1774852941.0,  3834924807.0,   376310773.0,  2077847929.0,  3307436205.0},
-  {1835008208.0,  2010982961.0,  2231353518.0,  3796528819.0,  1496898585.0,  3586575966.0},
-  {3867483295.0,  2944741222.0,  2466061967.0,  3893303655.0,   453543846.0,  3249607181.0},
-  {2626482586.0,  3722355222.0,   246321463.0,  1502726667.0,  3481597751.0,    64541038.0},
-  { 136656749.0,  2001360340.0,  3346433708.0,  1596889837.0,  2792398398.0,   657855317.0},
-  {1498017300.0,   234497274.0,  1464041173.0,  2479345852.0,  3067539414.0,  2892103572.0},
-  { 385542739.0,   558992777.0,  4049072868.0,  3293997387.0,   439818385.0,  2926154050.0},
-  {1867777735.0,  2543489539.0,  2283348234.0,  2453955000.0,  3065679477.0,  3284122691.0},
-  {3072426331.0,  3190237890.0,  4156797801.0,  2416803825.0,  1105892503.0,   812446840.0},
-  {3798051210.0,  2851441897.0,   347850759.0,  3907217824.0,   500162562.0,  2315310560.0},
-  {3642001655.0,  1295829848.0,  2650456336.0,  3757694892.0,   159108577.0,   181274963.0},
-  { 412149497.0,  1962621865.0,   417065093.0,   714380210.0,  2873496255.0,  1523251786.0},
-  {1720680603.0,   783860933.0,  1388540912.0,  1603176227.0,   123257763.0,  2314963029.0},
-  { 198292679.0,   627710510.0,  1580975246.0,   282185200.0,  3889552966.0,  3976566038.0},
-  { 215697159.0,   599971029.0,  2898480301.0,  1091824877.0,  3871814881.0,  3196339115.0},
-  {2427348882.0,  2045211748.0,  2643665609.0,   707440361.0,   712653168.0,  2467948487.0},
-  {3963019114.0,  3675864433.0,   332500108.0,  2992389392.0,  2022490994.0,  2565880678.0},
-  {4121822909.0,  1761967180.0,  3220915475.0,  2938462788.0,   583404044.0,  1926288658.0},
-  {3251364016.0,  1956058616.0,  1545667225.0,   533014457.0,  4282049588.0,   652804944.0},
-  { 736107837.0,  3886188884.0,  1085864615.0,  3554853389.0,  3276152547.0,   648498949.0},
-  {2151670663.0,  3136066712.0,  2002499518.0,  2584499724.0,   337512962.0,   495037244.0},
-  {3119441617.0,  3546251097.0,  3840713438.0,  3246705209.0,  2623268627.0,  1986900193.0},
-  {1142654957.0,   599968310.0,  2000052440.0,   942845610.0,    84046174.0,  3700643020.0},
-  {2614280391.0,  3359658516.0,  2274433751.0,  1047236411.0,  1693122275.0,  2633602367.0},
-  {2533106436.0,  3793995078.0,  1906208615.0,  4153749422.0,  2725636496.0,   421124011.0},
-  {4016391721.0,   502207052.0,   789804352.0,   209039475.0,  1405709417.0,  1227278037.0},
-  {4212397029.0,  1092654253.0,  2374097654.0,  2780048596.0,  2603504105.0,  3804128299.0},
-  {2396299988.0,  1796543199.0,  1985897550.0,  2634913075.0,  1895640293.0,  3397324865.0},
-  {1061753733.0,  3475621289.0,  2251879552.0,  2251232760.0,  3374268932.0,   289175024.0},
-  {2986521844.0,  1557165625.0,  3068437017.0,  2626514292.0,  3262923328.0,  1753204127.0},
-  {3130834338.0,  3482292315.0,   268803867.0,  2250091271.0,  2287756662.0,  3627856405.0},
-  {4294610028.0,   294533908.0,   486250968.0,    60908860.0,   847199256.0,  4196066167.0},
-  { 177468683.0,  2000584439.0,  1220348717.0,   633864101.0,  4139429657.0,  2491249034.0},
-  {1622257437.0,  1359120316.0,  2406684439.0,   787782254.0,  1003865702.0,   595168100.0},
-  {1116175589.0,  2752218963.0,   683367566.0,   400251364.0,  4158024610.0,  1124849407.0},
-  { 277031009.0,  3705140627.0,   723563955.0,  1296817519.0,   159227536.0,  3498327868.0},
-  {3858896541.0,   942026518.0,  1474934007.0,   131122561.0,  1677764963.0,  3370536030.0},
-  { 959968378.0,  2217112483.0,   441253234.0,   370285933.0,  3615387397.0,  2708328335.0},
-  {3951256791.0,  2866405829.0,  1758966724.0,  1852315395.0,  1008255070.0,  2510962819.0},
-  {3770405717.0,   524847495.0,   433185835.0,  1654079652.0,  2016566264.0,  1174055427.0},
-  {3941912661.0,  1457432156.0,    10653736.0,  3971660462.0,  1460531074.0,  3178215539.0},
-  {3090200474.0,  1104476844.0,   832941544.0,  1621994803.0,  3458124763.0,   990758585.0},
-  {2277728001.0,    33091200.0,  1481904505.0,  3137221901.0,  3740437743.0,  4284906939.0},
-  { 113787939.0,  1580805269.0,  3463103399.0,  1682957922.0,   797036640.0,  3531882113.0},
-  {1180352289.0,  3322610694.0,   343319974.0,    97764708.0,  2226123791.0,  1225352129.0},
-  {3603556866.0,  2796047824.0,   209269683.0,  2938233502.0,  2472009263.0,  2896137890.0},
-  { 709388797.0,  1240073720.0,   776542125.0,  1287922618.0,    68843737.0,  2324921282.0},
-  {4038758401.0,     5337550.0,  2810814129.0,  1007877741.0,  2994535097.0,  3952727662.0},
-  {2034925345.0,  2998516183.0,  3178074574.0,   206658286.0,  2432555809.0,  1576295246.0},
-  {1694572867.0,  3634115955.0,  2714454708.0,  2598759600.0,  1299166159.0,   140690154.0},
-  {3024284183.0,  2045981587.0,  2247497802.0,   936767148.0,   949137374.0,   276314512.0},
-  {2036677803.0,  1821083052.0,  1221845585.0,  2122297619.0,    90243290.0,  1032286340.0},
-  {1043441015.0,  4101625461.0,   352729724.0,  3476203603.0,  2433346122.0,  2910044624.0},
-  {3764750643.0,  3159090382.0,  1821119682.0,   187555493.0,  3363309050.0,   293583812.0},
-  {1343252124.0,  1890556127.0,   161258394.0,   188664311.0,  4220703023.0,  2772833032.0},
-  { 790685376.0,  1140020580.0,   680789579.0,  2523611422.0,   643029730.0,  3059807892.0},
-  {  90261459.0,  2510251686.0,  3434123649.0,   719308235.0,   690016994.0,   483858877.0},
-  {2574237688.0,  2797895644.0,  3080674458.0,  3330636964.0,  2596489355.0,  2950134490.0},
-  {4078710059.0,  4189634999.0,  3716368706.0,  2664434790.0,  2656139672.0,   630417139.0},
-  {3572973974.0,  1964879383.0,   167970694.0,  3158780945.0,  1010668751.0,  3722359240.0},
-  { 838808289.0,  2636494817.0,  3468067455.0,  3922680322.0,  1079869449.0,  3800716951.0},
-  { 362481617.0,   216560365.0,  1660790248.0,    63587620.0,   998025835.0,  2379786239.0},
-  { 531315024.0,    84165232.0,  2043125827.0,  3791305852.0,  2878741192.0,  2931514695.0},
-  {2030945396.0,  4001815888.0,   891566519.0,  2540168995.0,  2349744285.0,  1018131471.0},
-  {1547767762.0,  1118280728.0,  3201643092.0,  4095092018.0,  3281039501.0,  1683183307.0},
-  {4092761235.0,  2354771654.0,   733040258.0,  2343334540.0,  3972365654.0,  3505997515.0},
-  {2906834205.0,   375115484.0,   796878917.0,   376634649.0,   104679014.0,  3823310154.0},
-  { 460435804.0,  3834000904.0,  1381083062.0,  3694329902.0,  2745823766.0,  1752959333.0},
-  {3094538979.0,  3414261237.0,  1846536204.0,  2023091172.0,  1357324027.0,   566819056.0},
-  {3649430580.0,   904815396.0,  4039235453.0,  3862119451.0,  3066260707.0,  3380457987.0},
-  { 378617445.0,  2214659179.0,  1743805421.0,  1924624399.0,  3709602817.0,   830735202.0},
-  {3122622648.0,  3100075979.0,  2153217460.0,  2619815034.0,   441435691.0,  1358185339.0},
-  { 333329737.0,   702079789.0,  3025701020.0,  4156137746.0,   477912752.0,  2173573315.0},
-  {1216487379.0,   231515448.0,   243429041.0,  3493098863.0,  1524856640.0,  2117990606.0},
-  {3984177029.0,  4119783294.0,  3718502640.0,   656477134.0,  2856267033.0,  1420370978.0},
-  {2381380582.0,  3098294411.0,   882028914.0,   118660883.0,   903025721.0,  2766118850.0},
-  {3768871321.0,  2727202449.0,  1405471582.0,  2821588529.0,  3184893909.0,  3289075374.0},
-  {2127945694.0,   356135867.0,  3756710844.0,  3468808274.0,  2971866131.0,  1793302517.0},
-  {1908409658.0,  3491910954.0,  2622107622.0,  1503039550.0,  2752487130.0,  3291596743.0},
-  {1202700426.0,  2478286230.0,  2306361430.0,  2645169019.0,   179236527.0,  3984739604.0},
-  { 971930858.0,  2126320670.0,  2440340310.0,  3283303907.0,   744901573.0,  2645141901.0},
-  {2953751754.0,  2245379264.0,  1921431403.0,  1002096739.0,  3101053111.0,   891170509.0},
-  {1598238867.0,   823649529.0,  2387968706.0,   454602878.0,  4178810809.0,   319312119.0},
-  {2225777100.0,  2216178054.0,  3965964619.0,   516156567.0,  1606592025.0,  2282640996.0},
-  { 675551326.0,  4137095117.0,  2668699810.0,  3328401372.0,  1672626919.0,  2446146020.0},
-  {3990078828.0,  3533408732.0,  1986747907.0,   346502253.0,  1159677215.0,  1840118614.0},
-  {3619415002.0,  2300097174.0,  4165001624.0,  2989854630.0,  1511740430.0,    14741485.0},
-  { 841724698.0,   170783938.0,  1112518816.0,  2634290756.0,   393704701.0,  1443154515.0},
-  {3506899602.0,   424062148.0,  2994016300.0,  1241270006.0,  3346806714.0,  3780229635.0},
-  { 327165974.0,  2829417499.0,   373287285.0,  2308285679.0,  4250452953.0,  3435504991.0},
-  { 123233600.0,  1932032003.0,  4163072044.0,   170885611.0,  1385128182.0,  4083243103.0},
-  {1491193618.0,  2133695780.0,  2663125709.0,  4117549555.0,  2872875498.0,  3848812479.0},
-  {3174267874.0,  1543737090.0,   998655572.0,  3528312390.0,  2119904709.0,  1067965016.0},
-  {2392916032.0,  1610098697.0,  2035303549.0,  1444485222.0,  2272972169.0,   589138887.0},
-  {3998897338.0,   564375585.0,   620903210.0,   903172170.0,  3474015384.0,  1850881497.0},
-  {3127916710.0,  2247728498.0,  1982296457.0,  2924553363.0,  1486013547.0,  3766611478.0},
-  {2165130725.0,  3553855384.0,  3510719973.0,   452470158.0,  2568510408.0,   358290575.0},
-  {3061334657.0,  2907175682.0,  3304511651.0,  1660227513.0,  1431184587.0,  3236836954.0},
-  {3004946059.0,   848784055.0,   424303335.0,   271597693.0,  2466147947.0,  1677470445.0},
-  {1963748056.0,  2462063878.0,  2099230138.0,  1694314904.0,  3800255665.0,  1301737672.0},
-  { 868626732.0,  1729450093.0,  4262860674.0,  1799295335.0,  3702376548.0,  2103137733.0},
-  {1211893786.0,  1664407012.0,   393744319.0,  1787034038.0,  2107225277.0,  3524439505.0},
-  { 923734884.0,  2405391541.0,   833489103.0,  2801009936.0,  1118094572.0,  3445149167.0},
-  {1539436702.0,    46993392.0,  3110352957.0,  1038314236.0,  1875563781.0,  4266134992.0},
-  {2371896850.0,  2316407005.0,   801003612.0,  3350121498.0,  1512091558.0,  2233792338.0},
-  {2187482004.0,  1456234759.0,   553730171.0,    30618690.0,  2768388099.0,   969002001.0},
-  {2396984636.0,   784715092.0,   976281347.0,  2392786950.0,  2675301573.0,  2398430130.0},
-  {2616736969.0,  1754281644.0,  1219719140.0,  3583056908.0,  4111455152.0,   849693233.0},
-  {2000823228.0,   869963013.0,  4198695050.0,  2926264280.0,  1790117483.0,  3901268863.0},
-  {1676531604.0,  1910810646.0,  1721758373.0,  1369964078.0,  3552522254.0,   917609420.0},
-  {2551252699.0,  2309122195.0,   486854588.0,  2509469194.0,  3250127459.0,  2136599783.0},
-  {2944766570.0,  4156764986.0,  1484429983.0,  4250082200.0,  3143766519.0,  1068380570.0},
-  {3972910300.0,  3135051834.0,  2990321265.0,  1847578030.0,  1617812814.0,  2451851838.0},
-  { 126189104.0,   126956555.0,  2621273874.0,   441146352.0,   881843239.0,  1044303428.0},
-  {3936510073.0,  4209231658.0,  3738634152.0,   743878687.0,  3891675031.0,  2676068856.0},
-  {2556201367.0,  3512936223.0,  2290111552.0,  1314704834.0,  3638327734.0,  3548701699.0},
-  { 412729949.0,  3148568249.0,  3744883795.0,  3162114456.0,  3900380023.0,  4074386195.0},
-  {2019750928.0,  2088375114.0,  3825355908.0,   602420644.0,   914959501.0,  3213893899.0},
-  {2406244383.0,   982813902.0,  4288452727.0,   711376163.0,  4177011783.0,  4043924933.0},
-  {1913899141.0,  1248951069.0,   508155543.0,  4135660779.0,  3414145890.0,   428496049.0},
-  {1224412787.0,  3901568474.0,  2312826321.0,  3793036126.0,  1476254500.0,  1845175036.0},
-  {3938895915.0,  3692120966.0,  3893744070.0,  1055132429.0,  1690139573.0,  2592330198.0},
-  {2432085801.0,  2188642000.0,  4029279768.0,   556940242.0,  1428845634.0,  2797759400.0},
-  {1029969693.0,  2306971623.0,  2509594985.0,  1437002816.0,  2083846162.0,  4269405004.0},
-  {2446100175.0,  3847694066.0,  3995932040.0,  1929529612.0,  2631879961.0,   256413852.0},
-  {3631952164.0,  4023299619.0,   171545721.0,  3616020041.0,   806510842.0,  2620517029.0},
-  {1115508396.0,  4157222236.0,  3880708130.0,  3121708428.0,  1784954776.0,  3198889253.0},
-  {3254574259.0,  4061692490.0,  3780296385.0,  3296194018.0,  1372649747.0,  2251581072.0},
-  { 684325407.0,   854816584.0,  3552690741.0,  2256889342.0,  2332745201.0,  1143098475.0},
-  {2498602580.0,   109761647.0,  2242699505.0,  3822009648.0,  2436565607.0,  3010073160.0},
-  {2673826643.0,  1833616562.0,  1627062143.0,  4154935879.0,  1775625763.0,  3908200582.0},
-  { 572281333.0,  4051485451.0,  2956597248.0,  3986411180.0,   480259777.0,  2902474846.0},
-  {1823223642.0,  4282048695.0,  1974640539.0,  4123183012.0,  3682158360.0,  1180844425.0},
-  {2297039398.0,   497190488.0,    44881551.0,  3658501928.0,  2026958750.0,  2530927921.0},
-  {3787248069.0,  3227213293.0,   242524179.0,  3195259885.0,  1707173602.0,  4148466921.0},
-  {3871046216.0,  2726459410.0,   794938128.0,  1259386245.0,   566527997.0,  3740131939.0},
-  {2558071633.0,  1082396661.0,  1671034324.0,  3720262987.0,  4129515898.0,   855484277.0},
-  {3753961151.0,  2366874100.0,  2091196750.0,  1738819343.0,  1638348837.0,  3880981592.0},
-  {1009421487.0,  1804643897.0,   783547462.0,  2233030642.0,   705173410.0,  2132457865.0},
-  {4019208734.0,  1679401262.0,  2610511654.0,   244268356.0,  2372314789.0,  4088838693.0},
-  {1412503124.0,  4195316213.0,  3490893607.0,  2949967830.0,  1950921273.0,  2074433020.0},
-  {2344607933.0,  4198514108.0,   399986608.0,  2170623881.0,  1956564968.0,   230587723.0},
-  {2945302183.0,  2695778116.0,  3205969078.0,  2559484362.0,  2407708501.0,  3588573958.0},
-  {1468287370.0,  4263050262.0,   313371944.0,  4211199459.0,  3614723479.0,  3317678253.0},
-  { 126437466.0,  3303083563.0,  1114904186.0,   390340649.0,  1989869939.0,  1863738346.0},
-  {3489078511.0,  1167763517.0,  2215848624.0,  3370820135.0,   183848776.0,  1644694665.0},
-  { 642587728.0,  2218831075.0,   750890816.0,  1329300499.0,  3377385485.0,  1547616324.0},
-  {4132693130.0,  2430343333.0,   188945359.0,  1546841016.0,  3753413813.0,  1623424344.0},
-  { 721050934.0,  1864069386.0,  2139729638.0,  1269080020.0,   901921354.0,  3038636452.0},
-  {2820948323.0,  2397667965.0,  2651998460.0,  2761362078.0,  2319177945.0,   468157630.0},
-  { 833391701.0,  3108207551.0,   151223296.0,   938672760.0,  4279326788.0,  3013650194.0},
-  {  22399049.0,   377088984.0,  4125073090.0,   305519357.0,  1415818029.0,   500239380.0},
-  {4273155969.0,  4252289762.0,  3099257727.0,  2086540033.0,    12317936.0,  2805646342.0},
-  {1521536009.0,  2292482996.0,  3417248433.0,  3797657509.0,  2773244875.0,   600374738.0},
-  { 278510167.0,  1213741823.0,  2011648371.0,  1776047674.0,  2873056711.0,   537266311.0},
-  {3824651074.0,   999375744.0,  4089761034.0,  1515367787.0,  1509331181.0,  1154766903.0},
-  {4045327793.0,  2813660489.0,  3118405796.0,  1025292158.0,  3236289088.0,  4086416017.0},
-  {1229964209.0,  1390395918.0,  2864426761.0,   544611538.0,  2564106010.0,  1253311864.0},
-  {3157930369.0,   137058990.0,   668167194.0,  2717821741.0,  3280998315.0,  3659499388.0},
-  {3608203873.0,  3254797088.0,  2233623578.0,   437281387.0,  1665742042.0,  3501965425.0},
-  {3961813959.0,  2769233605.0,  3238673224.0,   965134247.0,  3071124828.0,  2826722215.0},
-  {1845113433.0,  4167230523.0,  2740815371.0,  1372226287.0,  2091152014.0,  2609339964.0},
-  {3082164244.0,  4153039109.0,   159265882.0,  1428185591.0,  1665281308.0,  3086363083.0},
-  {1911091348.0,   199289891.0,  2821513463.0,  3532935386.0,  1704821730.0,  4218117628.0},
-  {1332896706.0,  2638945220.0,  1381930000.0,  1470773744.0,  2392747267.0,  3957076044.0},
-  { 619558487.0,  4122846817.0,  2222291842.0,   681840093.0,  3969317043.0,  1787247076.0},
-  {3141255221.0,  3027760618.0,  1771160194.0,  3207628591.0,  2973320896.0,  2267801378.0},
-  {3648444149.0,  3158887592.0,   626214954.0,     5301921.0,  3582493109.0,   247295182.0},
-  {1531712558.0,  2232151246.0,  1292068779.0,  3229849718.0,  2390375945.0,  2002957746.0},
-  {2272159855.0,  3903721186.0,  3321430257.0,  1029142139.0,  4097341224.0,  1974949256.0},
-  {1037147772.0,  1549677034.0,  2218573283.0,  3961977087.0,  1952871803.0,   666290790.0},
-  {3534355544.0,  2448051590.0,  1198677153.0,  2437914653.0,  2286020902.0,  2586687644.0},
-  { 817016152.0,  3349748797.0,   481182971.0,  3748135797.0,  2144133117.0,  1670869283.0},
-  {3505611630.0,  2525333930.0,  4175784245.0,  3237715468.0,  1017783576.0,  3746250324.0},
-  {2255219652.0,   729548109.0,  3890178199.0,   556555303.0,  2487287465.0,  3144791970.0},
-  {4006205580.0,   365194062.0,    74439164.0,  2298887082.0,   123447004.0,  1767506150.0},
-  {3023471409.0,   165367127.0,   624227456.0,  2227656914.0,  3973619100.0,  4175575901.0},
-  {2239605376.0,  1856425506.0,   762484796.0,   427626012.0,    80994139.0,  1269783416.0},
-  {1961195756.0,   606485695.0,  1525601798.0,  3019948837.0,  4055138783.0,  2626050829.0},
-  {1873373283.0,  2165672244.0,  3556888364.0,  3478412252.0,   142791345.0,   315997942.0},
-  { 639405333.0,   190568718.0,  4123946479.0,  3564028533.0,  1172340535.0,  2115762845.0},
-  {2200996218.0,  2025841946.0,  1185882271.0,  3187112925.0,  4011474213.0,  3635819704.0},
-  {4001071387.0,  1935425346.0,  2569502716.0,  2843613632.0,  1391350969.0,  3143604249.0},
-  {3451916410.0,  1699285848.0,  3287651299.0,  3056721863.0,  3862299633.0,   840823727.0},
-  {3918908825.0,  2865401817.0,  4224669765.0,  2227636504.0,  3122840154.0,  3311614841.0},
-  {1584971742.0,  2338847481.0,  1062112504.0,  3038469677.0,  2783368799.0,  2821614566.0},
-  { 915648651.0,  4064412017.0,  3745609914.0,  3875058322.0,   526375273.0,  3742456425.0},
-  { 974237011.0,  2114590450.0,  1980452433.0,  3135363772.0,  1890130616.0,  2917742735.0},
-  {2784419024.0,   566483517.0,   446500027.0,  3291575059.0,  3400559469.0,  1258330948.0},
-  {1145789816.0,  3478580075.0,  3558230146.0,   955707550.0,   976686175.0,  1899026874.0},
-  {2794340471.0,  1353541517.0,  2670512824.0,  2696182266.0,   459296047.0,  2009367362.0},
-  {4220739192.0,   158679804.0,  2585996419.0,  4147331996.0,  2021872442.0,  2207448418.0},
-  {1391605994.0,   533500865.0,  1158323658.0,  2302684325.0,  1744424983.0,  1237324397.0},
-  {2947646611.0,  3631908135.0,  3035170354.0,  1493803103.0,   551830022.0,  2324515503.0},
-  {1425279878.0,  3094141581.0,  4233410682.0,  2770600932.0,  1888648231.0,  2993856661.0},
-  {3960125598.0,  1749116667.0,  3132251047.0,  2184711796.0,  1759113507.0,  4264337669.0},
-  {2279305267.0,  1331230320.0,  1650918284.0,  3353326537.0,  1116077591.0,  3452768724.0},
-  {3403948572.0,  3493199050.0,   393333101.0,   739816144.0,  1873788865.0,   630083588.0},
-  {1899072597.0,  2352316959.0,  4283782701.0,  1776813077.0,  3753039717.0,   513808792.0},
-  {2668539126.0,  3119935656.0,  3735918135.0,  3593997882.0,  2707837448.0,  2591424257.0},
-  {2860896726.0,  3532266173.0,  4082500102.0,  1877799941.0,  1198174803.0,  4239067565.0},
-  {4249774804.0,  1847454723.0,  3716466906.0,  1592092906.0,  4132691728.0,  1422840512.0},
-  {2024424896.0,  3497885914.0,  3594234281.0,  1876407793.0,  1023631912.0,   690972001.0},
-  {2628869168.0,  2521939777.0,  3308808593.0,  2071598336.0,    36012690.0,  2823287931.0},
-  { 901364070.0,  3441956976.0,   731191920.0,  3493910825.0,    72079446.0,  1829016087.0},
-  { 865781048.0,    67413324.0,  3895688425.0,  2074646037.0,  1283334776.0,  3622863275.0},
-  {2588826833.0,  3115921758.0,  3032333001.0,  3294662064.0,   621873836.0,  3520785999.0},
-  {3633840683.0,  2821667179.0,  4201535464.0,   544750386.0,   763846125.0,  3147784099.0},
-  {2568730426.0,   272255974.0,  1536703914.0,  4213900953.0,  2511471219.0,  1834961949.0},
-  {2591783935.0,  4041371770.0,  2498492748.0,  2189266772.0,  3611775448.0,  3332999714.0},
-  {3527664745.0,  4153197505.0,  3396137552.0,  2615847224.0,  2686677288.0,  1374433550.0},
-  {1508320196.0,    67206315.0,  1872205446.0,  2764618119.0,  1036429444.0,  2093595873.0},
-  {3282279117.0,   455876302.0,  1337406284.0,   926314195.0,    64055027.0,  3086663019.0},
-  {3118976937.0,  2082902463.0,  1668084408.0,  1005968577.0,  2267005245.0,  1531598392.0},
-  {1255473726.0,  4281431922.0,   233309469.0,  4131403189.0,  1739241452.0,  1286589381.0},
-  {1489726666.0,  3628498601.0,  1594723285.0,  1066470982.0,   608965061.0,  4246720512.0},
-  { 554923486.0,   659769429.0,  3991853900.0,  2979031082.0,   528434775.0,   596654148.0},
-  {1450509342.0,  2422538173.0,  1923435622.0,  1413518805.0,   612929112.0,  3793871943.0},
-  {1477895085.0,  3256328210.0,  4260902322.0,  2600252108.0,  3011650980.0,  4035814657.0},
-  {1218489490.0,  1252774258.0,  2001135291.0,  2231485081.0,   977084876.0,   116832482.0},
-  {3354231130.0,  3503005693.0,  2005041974.0,  1695546886.0,  3332962846.0,   249655455.0},
-  {  98376219.0,  2976255347.0,  1923005424.0,   929659431.0,  3684144449.0,  2551813504.0},
-  { 534634478.0,  3413823570.0,  1060028378.0,  3344671248.0,  1169032509.0,  1968440013.0},
-  {1086058483.0,  3677591644.0,  4230828339.0,  3991204636.0,  2565046939.0,  1121990616.0},
-  {1988984840.0,  2694813538.0,   563870773.0,   446361601.0,  2313314997.0,  3608438687.0},
-  {3608747404.0,  3740562914.0,  3713515171.0,  3477872131.0,  4195637940.0,  3855923094.0},
-  { 944439498.0,  2129658822.0,   118880019.0,   928218033.0,  1061904348.0,  2908493842.0},
-  {1391897860.0,  1745577611.0,  4189036924.0,  2846991787.0,  3139091632.0,   273084646.0},
-  {4145293382.0,  2079888761.0,  1213913571.0,    71321837.0,  2949143426.0,  2999374654.0},
-  { 611951022.0,  3869491822.0,  3059116919.0,  1510370959.0,  2614470715.0,  3600773850.0},
-  {1348614658.0,  1377744583.0,  4094559123.0,  4213443599.0,   486163007.0,   658794486.0},
-  { 164672800.0,  1566687969.0,  3317385486.0,   513415556.0,  1123975993.0,    74741892.0},
-  {1885897845.0,  3167161187.0,  1095125566.0,  3075008189.0,  2552775793.0,   501622656.0},
-  {2192215177.0,  1803123388.0,  3729174460.0,    95549266.0,  3575184185.0,  2111824727.0},
-  {3545231358.0,   725219877.0,  3456424923.0,   505520382.0,  3575166617.0,  2469569074.0},
-  {1909093433.0,  2749548304.0,  3572748339.0,  2187021936.0,  2121791728.0,  2529219608.0},
-  {2472969576.0,  2656042476.0,  4077244754.0,  1477197427.0,   811939748.0,  4070764834.0},
-  {2507883660.0,  3531197387.0,  3802752812.0,  3472929988.0,  2008294733.0,  2950217433.0},
-  {2782824435.0,  3751776181.0,   603451456.0,  4215235404.0,  1929806970.0,  3255551491.0},
-  {1970957054.0,  1525934853.0,  1763952735.0,  2705608123.0,   929331348.0,   381963936.0},
-  { 879054117.0,  1099686711.0,  2222733936.0,   657579747.0,  1500567515.0,  2627120283.0},
-  {1241401998.0,  3620084477.0,  2755821189.0,  3111373594.0,   668929241.0,  1432921702.0},
-  {1375789944.0,  3955051944.0,  2080526931.0,   840231845.0,  2290341046.0,  3070105649.0},
-  {3722351825.0,  1929662807.0,  4232985292.0,  1444371608.0,  1600071636.0,  2508625963.0},
-  {1131741483.0,  3808130126.0,  1722720473.0,  1542321723.0,  2275848137.0,  1151832493.0},
-  {2602589691.0,  2616969236.0,  1323784118.0,   287071602.0,  2282670760.0,  3735166603.0},
-  {  51649279.0,  3985770681.0,  2400438704.0,   937559738.0,  2034311756.0,  3895846242.0},
-  { 695729986.0,  1977585969.0,   119070462.0,  3004655729.0,    38336158.0,  3488681059.0},
-  { 344352298.0,  3716042813.0,  2954206999.0,  2562050994.0,  1830158398.0,  1037243718.0},
-  {3050990745.0,  1605478237.0,  3839030444.0,  2371979685.0,   608363113.0,  2560112825.0},
-  { 832983129.0,   865924509.0,  2541312012.0,  1173493945.0,  1683091697.0,  4294843572.0},
-  {4168235617.0,  1536733374.0,  1011522695.0,    69362765.0,   413976049.0,  1574215232.0},
-  {3705459363.0,   820731079.0,  2480445874.0,   240310638.0,  1937134366.0,  3691290989.0},
-  {2041184946.0,  1071472201.0,  4086235213.0,  1682227832.0,  1234367863.0,  2684844994.0},
-  {2354280963.0,  1195230149.0,  1798012031.0,  2882109379.0,  3135758217.0,  1069237874.0},
-  {3729230080.0,  1622877443.0,   427676040.0,  2267587281.0,  2076550859.0,   369569641.0},
-  {1836060328.0,  2879430824.0,  3683520773.0,    54241546.0,  3076449176.0,   797392397.0},
-  {3379892429.0,   843105023.0,  2836428348.0,   294974288.0,  1860515717.0,  1819224916.0},
-  {3583727302.0,  2533803045.0,  4037035333.0,  3209397642.0,  3219709660.0,  1305532149.0},
-  { 102144752.0,  1761084242.0,  1865097840.0,   843830444.0,  1041589725.0,  2238242973.0},
-  { 226738987.0,   802802925.0,  1597788968.0,    19401302.0,  1234488511.0,     7471180.0},
-  {4002743867.0,  2542615001.0,  2213203507.0,  4216283834.0,   106733382.0,   976278100.0},
-  {2591918064.0,   362739846.0,  3304946576.0,  2681894260.0,   905972751.0,  1226018694.0},
-  {2972976560.0,  3762483269.0,  4061749970.0,  2743945424.0,  2188862571.0,   501975924.0},
-  {1741867357.0,  4028874568.0,  1904316881.0,    88141526.0,  3362769901.0,  1074946124.0},
-  { 225002986.0,  3513211238.0,  1177630189.0,  1021580686.0,  1733417087.0,  2812968330.0},
-  {2512885019.0,  1809001715.0,  1751891285.0,  1064061397.0,  1991294590.0,  4120312202.0},
-  {1417724991.0,  2051563058.0,  2579713895.0,  1093595892.0,   144909719.0,   915339510.0},
-  { 588530587.0,  4181488669.0,  3108143810.0,  2947681961.0,  1103813683.0,  3862082962.0},
-  {1280401002.0,  1212522152.0,  3859394198.0,  2201705479.0,  1911492689.0,  1680787824.0},
-  {1938603463.0,   923839944.0,  1986921902.0,  2406911525.0,  3885551658.0,  1204649346.0},
-  { 610722460.0,  3505579802.0,   261404167.0,  1819289741.0,   978115166.0,  3943384785.0},
-  {3256171927.0,   400232881.0,  4112333094.0,   912827834.0,   868808501.0,  3651764396.0},
-  {2079094404.0,  2305942878.0,  1154263886.0,  1927802617.0,  2403632931.0,  2390223265.0},
-  {1677443232.0,  4153918365.0,  3926163687.0,  1605019800.0,   373673478.0,  3976186517.0},
-  {3648086390.0,  3666361145.0,    90026629.0,   228179855.0,  2318224762.0,  2557091519.0},
-  { 279673195.0,  2040479488.0,  3299058937.0,  2736772884.0,  3600188932.0,  1749216885.0},
-  {1652961370.0,  3509175179.0,  2409968752.0,  2633199823.0,  3404785600.0,  2111327580.0},
-  {1268733400.0,   809145947.0,  4194596314.0,  1738494818.0,   491311036.0,   527742216.0},
-  {1413297711.0,   610655733.0,  4101886733.0,  1673032066.0,  1708630251.0,  1973968708.0},
-  {1890047617.0,  4132705326.0,   933134821.0,  2085187812.0,  2747977264.0,  2954146885.0},
-  {1547041437.0,   556704529.0,  4284826860.0,  1417202590.0,  4002238532.0,   688962409.0},
-  {4247922504.0,   827106433.0,  2489546868.0,  2325269706.0,  1673390132.0,  4073009169.0},
-  { 528419566.0,  3235699549.0,  1913332096.0,   892334899.0,  1684601909.0,   644841916.0},
-  {3034270637.0,  3120706402.0,  4293154751.0,  2111055688.0,  1610985038.0,   873160578.0},
-  {3973401007.0,  4006510649.0,  2951868941.0,  2860841314.0,  1401134141.0,  1942224196.0},
-  {4181366546.0,  3736175195.0,   354640323.0,  2623921373.0,  3849683876.0,   674760179.0},
-  {3358074607.0,  1018057893.0,  2003158734.0,  2657815839.0,  3343546357.0,  4250338609.0},
-  { 808601313.0,  3913098083.0,  3598635671.0,  1990630928.0,  3538206228.0,  3894244757.0},
-  {3022697131.0,  3316753751.0,  3328990810.0,  3411229947.0,  4131360556.0,   131760657.0},
-  {3693850278.0,  4278653038.0,   608110312.0,  2323502719.0,  1369673931.0,  3257351894.0},
-  {3038142322.0,   601078387.0,  2260783410.0,   762442104.0,  3633480118.0,  4099866048.0},
-  {1815527521.0,  2686437815.0,   860155357.0,  3428843245.0,  2088221557.0,  1695649556.0},
-  { 900934230.0,  1522549383.0,  2582037817.0,   635752557.0,   899713266.0,  3295025492.0},
-  {2772633949.0,  2667568493.0,  4240595533.0,  1857701750.0,   758466917.0,   716190401.0},
-  {3056303486.0,   325353922.0,  1858156407.0,  2746920298.0,  3236302904.0,  2648744209.0},
-  {2655019703.0,  1339379040.0,  1671832630.0,  4114130880.0,  1201570866.0,  2325529239.0},
-  {3803408475.0,  1855172634.0,   721133804.0,  3135293318.0,  1084954015.0,  1949861505.0},
-  {2347662009.0,  1551678357.0,   568994755.0,  1235165081.0,  3818839073.0,  2723626512.0},
-  {1987363024.0,  1399174723.0,   376147205.0,  1483635310.0,  3637836664.0,   705264590.0},
-  {2748341519.0,  2561299314.0,  1995204557.0,  3424995168.0,  2444649937.0,  3259001693.0},
-  {2809188753.0,  2503920575.0,  2230014097.0,  2009443648.0,    97198668.0,  4149251344.0},
-  {2323724428.0,  2353507721.0,  1180844030.0,  3078910499.0,    52784281.0,  1651786970.0},
-  { 393436631.0,  1530811664.0,  1468240372.0,  1670335572.0,  4195752492.0,  3473786297.0},
-  { 504405409.0,  2179583544.0,   540433706.0,   669214680.0,  1610312627.0,  4023149242.0},
-  {4222146546.0,  4206218688.0,  2564004609.0,  2916109459.0,  1440499695.0,  2912199718.0},
-  {1623966925.0,  3892973197.0,  3259113108.0,  3839181053.0,  2257650392.0,  1036274098.0},
-  {2563205837.0,  1093347478.0,  3825500237.0,  3273975995.0,  3514569484.0,  2792258505.0},
-  {  21786831.0,  1533415641.0,  2299197671.0,  1051173668.0,  1417056197.0,   581325457.0},
-  {2143401588.0,   871684975.0,  3775081601.0,   186264767.0,  4009063560.0,  3821977257.0},
-  {1621089141.0,   524916469.0,  1184735436.0,  1418884813.0,   451005801.0,   829525809.0},
-  {2354140856.0,  1947303645.0,    67155762.0,  2899671378.0,   225265925.0,   316953586.0},
-  {1354719052.0,  3092371578.0,   196737061.0,  4141035353.0,  3444039778.0,  1359598378.0},
-  { 179142776.0,  1926037059.0,  1521094981.0,  3053512746.0,  1346239071.0,  3684015920.0},
-  {1437530903.0,  1728420910.0,  1723024895.0,  3128060179.0,   538359857.0,  3774436998.0},
-  {1659300713.0,  4035638175.0,  2950787144.0,  4132339092.0,  2657858264.0,  2566152288.0},
-  {3897136134.0,  4021490188.0,  1444133979.0,  2252494196.0,  4107575809.0,  3346132136.0},
-  {2842891356.0,  2451216076.0,   381593644.0,  1641295475.0,  3367507166.0,  1233257835.0},
-  {3423127298.0,  1518921466.0,  3748751854.0,  1036577390.0,  1630792566.0,  4258811767.0},
-  {2117870418.0,  2444171960.0,  2679029535.0,  3423513841.0,  4286662519.0,   150255225.0},
-  {1445623884.0,  2743807022.0,  1843679435.0,   665189958.0,   516801750.0,  2606342096.0},
-  {3739069333.0,   656041286.0,  3952971161.0,  2472414158.0,  4269695400.0,  1006664673.0},
-  {3636335300.0,  2877867165.0,  3738266116.0,  3697625049.0,  1341441241.0,  2966567623.0},
-  { 614877380.0,  1547932175.0,  3866469054.0,  4252980330.0,  3787075158.0,   395286854.0},
-  {2202607753.0,  4120161834.0,  1202860917.0,   472981950.0,  2442222282.0,  1087770964.0},
-  {3719035585.0,   173705271.0,  2198691840.0,  2442396744.0,  3102961895.0,   296333396.0},
-  {2264116135.0,   414423313.0,   396256597.0,  1595965187.0,   697419695.0,  3831107243.0},
-  {2594463629.0,    47228524.0,  2701926889.0,  3868224657.0,   843532009.0,  3508600476.0},
-  {2663108507.0,   508572857.0,  1696946873.0,  1374426223.0,   289057817.0,  1283307848.0},
-  {4267168913.0,  3037415664.0,  1587859469.0,  2403912565.0,  3001286937.0,  2455294456.0},
-  {1328343807.0,  3374232375.0,  4205604393.0,   517209157.0,  1539457148.0,  3777180011.0},
-  {1595914054.0,   309513271.0,  2896597958.0,  4166995733.0,  1471078199.0,  1612564769.0},
-  {2343127395.0,  3723203549.0,  2223109273.0,  1064291756.0,  1990107960.0,  1167476480.0},
-  {2697840689.0,  3880420799.0,  2661580185.0,  2455572998.0,  1634899558.0,  4212290757.0},
-  {3266784657.0,  3854552991.0,  2173812756.0,  2770996532.0,  3097658273.0,  3504898481.0},
-  {2368636263.0,  2226516841.0,  3251717397.0,   900943078.0,   467239514.0,  2829851633.0},
-  {4195807496.0,  1003857795.0,  1015241932.0,  2649854043.0,  2403319169.0,  2775765564.0},
-  {2666595018.0,  1602344758.0,  2034530586.0,  2837502434.0,   988087406.0,  3550015242.0},
-  { 474619834.0,   860560851.0,   776031352.0,  1981075001.0,   532166715.0,  2992371158.0},
-  {1095441881.0,   331407526.0,   476242116.0,   751762005.0,  3587116280.0,  3286000851.0},
-  {4270221942.0,  1052258092.0,  3869069592.0,  1741912349.0,   893024790.0,  1896601828.0},
-  {2253844005.0,   305729950.0,  1486848347.0,  4238135055.0,  4045164870.0,  3608759643.0},
-  { 886169379.0,   186438358.0,  3301706757.0,  1327198687.0,   160240307.0,   364785190.0},
-  {3932031335.0,  2092229587.0,  3143546425.0,  3134142316.0,  1367631744.0,  3717095250.0},
-  {4094215155.0,  2720520315.0,     6968237.0,  1732662471.0,  2672919659.0,  2143056979.0},
-  { 793481048.0,  2584537792.0,  2297563645.0,  2132889757.0,   810299344.0,  2006616237.0},
-  {1027913641.0,  1099835378.0,   348384782.0,  3814930094.0,  4160663026.0,  2977355357.0},
-  {2833482734.0,  3054783520.0,  1938847445.0,  2807432966.0,   843765875.0,   398376786.0},
-  {2691111733.0,  2514908290.0,  2952074391.0,   166718596.0,  2276402225.0,  1201068074.0},
-  {3870000590.0,  3188072132.0,  3297771247.0,  2013987972.0,   331381338.0,  3244031807.0},
-  { 377689202.0,  1865971885.0,   228056400.0,  2471578827.0,  2520747419.0,  1869903370.0},
-  {  50402290.0,  3897258641.0,  2788919357.0,  4047643971.0,  1080071114.0,  3810808803.0},
-  {1545230483.0,  2335745932.0,  2818644443.0,  1897140124.0,   873385784.0,  1203900640.0},
-  {1903342832.0,  1297373800.0,   483096585.0,  2163529767.0,   961336338.0,   411691237.0},
-  {2290833442.0,   471785968.0,   326051171.0,  2463425140.0,  1831740308.0,  1515267147.0},
-  {3602566891.0,  4188658489.0,  2999933689.0,  2275047493.0,   936335922.0,  1896612078.0},
-  {2074632516.0,  3965887507.0,   878958281.0,  1453816398.0,  2089487657.0,   875250189.0},
-  {1849677385.0,  1373841744.0,  3700268910.0,   994230016.0,  3955949809.0,   903426397.0},
-  { 403313532.0,  1038426993.0,  4078898080.0,   847353334.0,  1923906120.0,  3108649084.0},
-  {1327331589.0,  3574081090.0,  3407432616.0,  3400731899.0,  1642689593.0,  2117459830.0},
-  {2237695293.0,  3808814895.0,  1204908459.0,  2303956005.0,  3756808828.0,  1280535549.0},
-  { 341395447.0,  3661935820.0,  3002545186.0,  1883223249.0,  1516308800.0,   826246620.0},
-  {1762670157.0,     2003994.0,  1973860782.0,   435093721.0,  1136103635.0,  3374947876.0},
-  {2780114412.0,  3061684303.0,  3118388560.0,  1425833373.0,  2004573823.0,  1956192659.0},
-  {3874954441.0,  3651322052.0,  1976043320.0,  1126022446.0,  3077503215.0,  3950768675.0},
-  {2972725229.0,  3505438923.0,  1814050395.0,  2277599372.0,  1690063913.0,  2956736377.0},
-  { 617440665.0,  2217182958.0,  3120468280.0,  3952053492.0,  1170633241.0,  2174490784.0},
-  {3148211969.0,   456476312.0,   834818738.0,   869312836.0,  4291088967.0,  1826482994.0},
-  {1561371206.0,  3817119472.0,   859517057.0,  2803997753.0,  2564360878.0,  1299180320.0},
-  {2644642473.0,    52597298.0,  1714522024.0,  4029609657.0,  1715888731.0,  1369329233.0},
-  {3141704481.0,   381021762.0,   185357647.0,  3983183302.0,   384776396.0,   571150398.0},
-  {3021381829.0,  2061703218.0,  3060604365.0,  2917966146.0,  3112919811.0,  3729571351.0},
-  { 217398541.0,  2029156709.0,   811007343.0,  3926389686.0,  2445621038.0,  4114728341.0},
-  {1566964112.0,   634208751.0,   293377579.0,  3802038914.0,  2080709608.0,  1865756301.0},
-  {2290630792.0,  3496677667.0,  3102739668.0,  3192223604.0,  2386394058.0,    84214436.0},
-  {2777496931.0,  2687883469.0,  2666979986.0,  3483111599.0,   876326135.0,  3853900117.0},
-  {2737222312.0,  1524567851.0,  2676775428.0,  2088112046.0,  3951345738.0,  2579070261.0},
-  {3703189924.0,  3350370266.0,   594977839.0,  3941798566.0,  2506426151.0,  3137467217.0},
-  {1371744477.0,  2376110174.0,  1810722477.0,  2948465483.0,  3122207353.0,  3242375820.0},
-  {3458369350.0,  1365751610.0,  1950454722.0,  2112776806.0,  1880897145.0,  2809013922.0},
-  {1946251745.0,  2011798320.0,   715056915.0,  3393712537.0,  1503838692.0,  4047170448.0},
-  { 943053953.0,  1196989998.0,  1468982218.0,   937074255.0,  3990301197.0,  4210166476.0},
-  {2885676226.0,  3294854617.0,  2155919380.0,  1482205400.0,   475193588.0,  3271746868.0},
-  {3727713086.0,  1907512733.0,  3983107512.0,  1176469787.0,  2370811121.0,  1786352023.0},
-  {1207638319.0,   308426296.0,   677645560.0,  1515792344.0,  3689710360.0,    99693046.0},
-  {3731398520.0,  1865765587.0,  2061672043.0,   513558246.0,  2805633137.0,  2419447103.0},
-  {3168495159.0,  3705175673.0,  1814478260.0,  1302805160.0,  2872997778.0,  2900191057.0},
-  {1342146665.0,   371075743.0,  3334040015.0,  1325586193.0,  1566908956.0,  1788242343.0},
-  { 528361855.0,  2362878687.0,  2592134216.0,  4167805621.0,  1662528810.0,  1795837971.0},
-  {2063393125.0,  2675864855.0,  1468036763.0,  3859647045.0,  3779577474.0,  2149696283.0},
-  {1611748845.0,  1915610307.0,  3449282163.0,  1334179112.0,  3452729552.0,  4209950364.0},
-  {3033662350.0,  1914021091.0,  2544764604.0,  1450105659.0,  3767045237.0,  1240253676.0},
-  {1633433992.0,  4005893070.0,   161492383.0,   926769266.0,  4234860883.0,  2998273984.0},
-  {3211523025.0,  4193229089.0,  3150198400.0,  1015804038.0,  2726144524.0,  3810470768.0},
-  {1536646161.0,  3946536913.0,   504322094.0,  3070674017.0,    56009720.0,  4072549961.0},
-  {1216157043.0,  3497167780.0,   262588087.0,  1837956670.0,    99733669.0,  1491120741.0},
-  {2414934836.0,   799208787.0,  2669027106.0,  1864742276.0,  3756939733.0,  1060468255.0},
-  {1979976355.0,  1159553389.0,  3885681305.0,  3464487405.0,  1167046054.0,  3161596940.0},
-  {1969586386.0,    75262489.0,  2181516417.0,  1259278248.0,  1831080782.0,  2938110597.0},
-  {3008974035.0,   235583904.0,  1077513776.0,  4051455641.0,   852816406.0,   750088129.0},
-  {3367548362.0,  3222495575.0,  2573335730.0,  3483352004.0,  3911635233.0,  4255039780.0},
-  {1570369127.0,   514546456.0,  3832204027.0,  2102586869.0,  1828561881.0,  1654757741.0},
-  { 662040346.0,  4258204817.0,  2807926679.0,   314717363.0,  1916301331.0,  1572303242.0},
-  {1445703197.0,  4018910600.0,  4270723062.0,  3569636183.0,  1674573452.0,  2508320724.0},
-  {3960284809.0,  1234301837.0,  3478386572.0,  2264152081.0,  4053992388.0,  3617277677.0},
-  { 844603266.0,  2774194116.0,   444464711.0,  2818255609.0,  3816323225.0,  2979675281.0},
-  {1419763667.0,  1067271645.0,  3428898692.0,  2145759340.0,  1244064418.0,  3850217517.0},
-  {3715877670.0,  2548400503.0,  1051840812.0,   680846031.0,  2405181794.0,   612183004.0},
-  {1168965775.0,  2855967674.0,  2760706952.0,   889310544.0,    25416391.0,  2802722251.0},
-  {1505321520.0,  1322097799.0,  1798388154.0,   726676408.0,    71242590.0,  3047730915.0},
-  {1666842412.0,  1784307243.0,  3427469585.0,  1805709796.0,  1648068230.0,  4157314811.0},
-  {3100431747.0,  3693822340.0,  1478639407.0,  1042986966.0,  1832594177.0,  2485693468.0},
-  { 960776054.0,  3119050562.0,    62189452.0,    24964360.0,  3076024594.0,  2663955187.0},
-  {3991603054.0,  3394194842.0,  1584952174.0,  3787381581.0,  3000941069.0,  2718074540.0},
-  {2446138038.0,   545102319.0,  1107387256.0,  1233806850.0,  1449412721.0,  2592781873.0},
-  {1462599027.0,  1867805665.0,  2584935819.0,  1429179177.0,  2221884204.0,  1164458873.0},
-  {4126670829.0,  2830450436.0,  1064707297.0,  2854612906.0,  4120765082.0,  1687012762.0},
-  { 279538830.0,   576179473.0,  1007960135.0,   904818365.0,   747308981.0,  1055216697.0},
-  {3049737360.0,   820947655.0,  3343505219.0,  1527383936.0,   148974913.0,  2133718172.0},
-  { 267011951.0,  2950483988.0,  4096661933.0,  1083342426.0,  1567859394.0,  3991435686.0},
-  {3853419980.0,  1815573379.0,  3590771666.0,  2662825892.0,  2854585897.0,  2784410216.0},
-  {3959716621.0,  1875744601.0,  2528206234.0,  2710197191.0,  2414877109.0,   244798412.0},
-  {2135108911.0,  2722405744.0,  1749894460.0,  3114123315.0,   707650427.0,  4035782099.0},
-  { 622978820.0,  2873454213.0,  1576081449.0,  2915109800.0,  4040523105.0,  2578295498.0},
-  {2748057482.0,   886090712.0,  1646549080.0,   386959316.0,   160776562.0,  1140012458.0},
-  { 370897398.0,  3556271520.0,  4231139217.0,  2889634508.0,  1303509885.0,  3104906082.0},
-  {1446535576.0,  3656744165.0,  3967741634.0,  3843229197.0,  2297521734.0,  3136813346.0},
-  {1630549641.0,  1900550346.0,  3862933937.0,  1753497221.0,   334691291.0,  2993189417.0},
-  {1508377681.0,  3447636139.0,   306784769.0,  1677794001.0,  3906604620.0,   949271635.0},
-  {1330092666.0,  2642462828.0,   760821892.0,   684418260.0,  1960684947.0,   225743429.0},
-  {3648726985.0,  3769894131.0,  3906525873.0,  2440469706.0,  2767029117.0,  3274051983.0},
-  {1483977181.0,  3371784736.0,  2734865978.0,  1697817765.0,  2996406636.0,  1404094393.0},
-  {1587344912.0,  1372353101.0,  1348468612.0,  2732455732.0,  1818112818.0,  2835334711.0},
-  {2222327798.0,  2031834428.0,  1278349835.0,  1423825078.0,   711841731.0,  3514312387.0},
-  {2625753084.0,  3447542689.0,  3455133014.0,  2719633966.0,   415201266.0,  3378293338.0},
-  {1748699188.0,  1713957614.0,  1209880654.0,  2877950998.0,  2554200445.0,  3724812435.0},
-  {2317285646.0,  1382330205.0,  3879470408.0,  2968332434.0,   720914859.0,  2771772446.0},
-  {1998036908.0,  2583092763.0,   468839760.0,  1411283792.0,  1872204992.0,  3419633013.0},
-  { 424925945.0,  3441575406.0,  1610631442.0,   445995969.0,    39751435.0,  1053338806.0},
-  {2886057326.0,  1771945166.0,  1266405220.0,  1579631385.0,  2307708292.0,  3535843238.0},
-  {2850349891.0,  2236323837.0,  3817495476.0,    82955815.0,  4272982978.0,  3253131515.0},
-  {1923160950.0,  3066201969.0,   941729126.0,  3298340688.0,  4244911177.0,  1396659658.0},
-  {1650558858.0,   437676737.0,  3139640330.0,  1798694176.0,  1843855845.0,   658540248.0},
-  {1738587875.0,  1128795734.0,  4225445768.0,  2690981125.0,  2198451187.0,  2769939798.0},
-  {3322544834.0,  3393894720.0,  2579719372.0,  4205439783.0,  2143015091.0,  1215065477.0},
-  {4031800757.0,   658528306.0,  4233321702.0,   391988391.0,  2179624797.0,   450710755.0},
-  { 838111321.0,  3855524062.0,   406595776.0,   104995995.0,  3419682835.0,  2524465056.0},
-  {3136219567.0,  2175050735.0,  3942632366.0,  1135987131.0,   976785130.0,  2615121321.0},
-  {2622569567.0,  3404659020.0,  4230196233.0,  3292588558.0,  3393599567.0,   809645586.0},
-  { 638592950.0,  2435172263.0,  1290014806.0,  3828503965.0,   735692622.0,  2339776858.0},
-  { 730073515.0,  3041825946.0,  1049889288.0,  2306133884.0,  2193880910.0,  2004454329.0},
-  {1032756130.0,  4075781699.0,  4181504505.0,  2501370533.0,   362063083.0,  2277478863.0},
-  { 559754750.0,   714206277.0,   538845554.0,  3952397145.0,   852497123.0,   303365418.0},
-  {2061297359.0,  1197312459.0,  1930416343.0,  1348212714.0,  2883803146.0,  1584093399.0},
-  {4138073029.0,  2319308910.0,  2858170647.0,  3051623272.0,  2660281327.0,  4092466294.0},
-  { 900241110.0,   965396207.0,  3057938876.0,  3942454480.0,  3557744414.0,   517255428.0},
-  {4109826319.0,  1857463412.0,  3522942520.0,  1916306177.0,  2157007146.0,   875751650.0},
-  {3210877510.0,   537065136.0,  3653737327.0,  2695003859.0,   745885372.0,  3332024039.0},
-  { 777704206.0,  2334889581.0,    42344249.0,   394372522.0,  2320432122.0,  1680685068.0},
-  {1743694124.0,  3192631089.0,     4881752.0,  2023195826.0,  1790913282.0,  3563905476.0},
-  {3099435444.0,  2518230556.0,  3153511021.0,  3342275362.0,  4052261653.0,  1883991455.0},
-  {1218252409.0,  3923382959.0,    16092442.0,  3810800307.0,  1532855837.0,   607697081.0},
-  {3217931286.0,  1948201518.0,  1875415108.0,  1058186044.0,  3947731640.0,  1338960199.0},
-  {3663490245.0,  4241986231.0,  1658821303.0,  1194944138.0,  3993917884.0,  1650151860.0},
-  {1419869832.0,   576927475.0,   389730821.0,   103574994.0,  2747347855.0,  3547803865.0},
-  {1689493015.0,  4083944432.0,  4242206262.0,  4001612600.0,  4095715611.0,  3044414013.0},
-  { 867425043.0,  1220485565.0,  3263580243.0,  3056365365.0,  1528078197.0,  1748954665.0},
-  {3128044615.0,  4000457326.0,  3605643508.0,  3194383586.0,  3282155981.0,   838605721.0},
-  {1217874536.0,  1490835618.0,   932584116.0,  2335730971.0,   877819679.0,  3697368637.0},
-  {4107144784.0,  2751665035.0,   809897484.0,  2889880926.0,  3136529910.0,  1925023062.0},
-  {3149350774.0,  2774184866.0,  2534573618.0,   304557663.0,   293387791.0,  3540557071.0},
-  {3876142121.0,  1668899453.0,   316171158.0,  1082814563.0,  3068210482.0,  2229804403.0},
-  {1283770547.0,   757854720.0,  4121105008.0,  1491705840.0,  3423259749.0,  3443177864.0},
-  {2884125348.0,   374096601.0,  1992850607.0,  3146634556.0,   457646576.0,  1606496118.0},
-  {1812088820.0,  4044696759.0,  2138063950.0,  1888299930.0,  1352963744.0,  1204341101.0},
-  {1323762162.0,   529192384.0,   957182048.0,   512167699.0,  3198063649.0,   754039664.0},
-  {1186705533.0,  3171903302.0,  3329182294.0,  1037538670.0,  3258476634.0,   101095022.0},
-  {4289585869.0,  1067139881.0,  2483805760.0,  1109225055.0,   668258093.0,  3024256847.0},
-  {1735691120.0,  3590020304.0,  3655285656.0,   323537988.0,  2894263066.0,  3569133981.0},
-  {3547991679.0,  3975513923.0,  2105964828.0,  4216319219.0,   927175539.0,  1704660153.0},
-  { 754787423.0,   489211261.0,  3046125281.0,   162462039.0,  4107728990.0,  3473730707.0},
-  {2162716900.0,  2467620938.0,  1351403716.0,  2598272592.0,  1949001207.0,  1952948936.0},
-  { 107370185.0,  1470574573.0,  3349846948.0,  3330295423.0,  2117338215.0,  2827950937.0},
-  { 527313149.0,    87430724.0,   590338345.0,  1566056685.0,   495947553.0,  3117137323.0},
-  {1816311180.0,  1221930586.0,  4132983602.0,  3322845950.0,  3902127730.0,    18786278.0},
-  { 408523343.0,  2038123886.0,  1465536435.0,   437752102.0,  1488813337.0,  1412029420.0},
-  {1883652671.0,   734935024.0,  2012570632.0,  4074494525.0,  3501504861.0,   862462592.0},
-  {1313925929.0,  3219669945.0,  1551777868.0,  3484843358.0,  1232698609.0,  2761116000.0},
-  {1122619447.0,   632621231.0,  3464675897.0,  2058312920.0,  3599996141.0,  3554828494.0},
-  {3699250309.0,  2428246155.0,   313807137.0,  1956242828.0,   427773222.0,  1232881208.0},
-  {1063506127.0,  2339833183.0,  4212847393.0,  4031441502.0,  1159408381.0,  3018293743.0},
-  {4043045695.0,  1531897913.0,   809016056.0,  2046846125.0,  1460352280.0,  3012757111.0},
-  {2459802821.0,  1155292860.0,  4032812613.0,  1766321374.0,  3850308046.0,  1924275791.0},
-  {3743995484.0,  2216558623.0,  4085643773.0,  2273880374.0,  1661928909.0,  2144473921.0},
-  {1562563117.0,    20064305.0,  1869202651.0,  3404980353.0,  4201181161.0,  3579716911.0},
-  { 659598420.0,   749960807.0,   213466626.0,  2178386943.0,  3732775618.0,  1619714832.0},
-  {3901063196.0,   620761888.0,   110154724.0,  1201507349.0,  1752682925.0,   934559230.0},
-  {1282992524.0,  2297885890.0,  3511131224.0,  2035806515.0,  1285525040.0,   707142588.0},
-  {4151425291.0,  2199093426.0,   596538397.0,  4024041694.0,   736669649.0,  2333629915.0},
-  {  17132986.0,  4255632116.0,  1307248497.0,  3041345166.0,  1968285423.0,  3628866008.0},
-  {2043463208.0,   685059274.0,   797918947.0,  2752001130.0,  3388586534.0,  2552828174.0},
-  {1345133926.0,  3482766135.0,  3653749512.0,  3524613026.0,   290906762.0,  3447115139.0},
-  { 996227435.0,   479894230.0,  1768244139.0,  3731956269.0,   168255409.0,  3291190265.0},
-  { 866704426.0,  2307652432.0,   132207329.0,    31041169.0,   146527816.0,  1677838930.0},
-  {1694306924.0,  1823098281.0,  3297944348.0,  4016937912.0,  2304249277.0,  3370706579.0},
-  { 445465378.0,  4118074293.0,  1010674007.0,  3846730217.0,   522811391.0,  2079666110.0},
-  {2210875306.0,  3979047557.0,  3943871229.0,  4057482895.0,   460818337.0,  1693331841.0},
-  { 445884244.0,   115137225.0,  1440738171.0,  1694802903.0,   840148440.0,  3400685765.0},
-  {1431071519.0,  2827005686.0,   694073776.0,  2375521531.0,  3687418253.0,  1905658802.0},
-  {2698006454.0,  4134313441.0,  4019074854.0,  2657897671.0,  4227063137.0,  3211587920.0},
-  {3664077866.0,  3575266690.0,  1910661807.0,  1030805436.0,   885071408.0,  2622069669.0},
-  {3811204348.0,  2182483996.0,  3282093155.0,   293058701.0,  4107681607.0,  1483618227.0},
-  {2877025698.0,  2652015030.0,  3391188136.0,  2888081874.0,  3556745055.0,   592741816.0},
-  {1168886914.0,   477556882.0,  3387817883.0,   945664893.0,  3065016383.0,  1446723396.0},
-  {2275131718.0,   653973374.0,   670582258.0,  3337677258.0,  3795075127.0,   290474336.0},
-  {2868185236.0,  1711049354.0,  1928928261.0,  3934117683.0,  3232374300.0,  1550735369.0},
-  {2542547822.0,  3235303511.0,  4174704625.0,  2941151804.0,  2467730847.0,   217636064.0},
-  {2638251907.0,  1458697587.0,  2204160609.0,  3474269253.0,    90203389.0,  1003879353.0},
-  { 586195437.0,   708671537.0,  3252590876.0,     4039653.0,  3251145177.0,  3696945010.0},
-  {3996324520.0,   324038821.0,  3252822405.0,  1416718180.0,  1662429926.0,  2633709301.0},
-  {4182305957.0,   805494140.0,  1092587463.0,  2491477825.0,   648019871.0,   420134175.0},
-  {3789789308.0,   773586041.0,  1491699887.0,  3611237719.0,  3461722437.0,  1109448438.0},
-  {4280053352.0,  1699586315.0,  2695652204.0,  2379456061.0,  3331518730.0,   494127903.0},
-  {3064908579.0,   393364284.0,  3720882674.0,  2048716159.0,  2442711903.0,   757441828.0},
-  {3199401824.0,   840488917.0,    17906466.0,  2587223927.0,  1517777923.0,  2226160145.0},
-  {4284079407.0,    26932663.0,  1244108996.0,  3526712095.0,  1524593284.0,  3689423655.0},
-  {4059101713.0,  2167247245.0,  4017071343.0,   824772568.0,   982806098.0,   558089829.0},
-  {2941103168.0,   666003646.0,    32381310.0,  4118517092.0,  1489381967.0,  3741680798.0},
-  {  82297678.0,  1716614615.0,   345789440.0,  2699258093.0,  3846118241.0,  3270168203.0},
-  {1155630502.0,   848623258.0,   229532023.0,   861339454.0,  1045875814.0,  3080995996.0},
-  {2641521351.0,  1865877461.0,  2120795161.0,  3970108339.0,  1618934100.0,  3823913118.0},
-  {1594682146.0,  3222946110.0,  4213084667.0,  2926926615.0,  3544427771.0,  2285078144.0},
-  {1797543876.0,  3762368565.0,  2825847876.0,  2257772639.0,  2079425707.0,  3535991869.0},
-  {1136851025.0,  1782424485.0,  2630588697.0,   918546242.0,  2085696243.0,   560799289.0},
-  {2088060056.0,  2377658616.0,  1291946364.0,  4126149256.0,  3364323439.0,   452408151.0},
-  {2296271760.0,  3498504118.0,  3188946720.0,  1566693966.0,  2337459304.0,  1313615160.0},
-  {3385063221.0,  2275512274.0,   720000552.0,  3598093225.0,  2287524435.0,  1195730858.0},
-  {4179228655.0,   837997591.0,   731815840.0,  2331626681.0,  1836767316.0,  3583944841.0},
-  {1914792715.0,  3935875938.0,  2407906247.0,   272810559.0,   457228779.0,   405588361.0},
-  { 140559980.0,   834242840.0,  1642322531.0,  3558147814.0,   894841624.0,  1016523570.0},
-  {4249822593.0,   657141609.0,  2791107607.0,  1201266774.0,  3053063212.0,  3681024970.0},
-  {1272092958.0,  3020958951.0,  2877151221.0,  2645269045.0,  2741253893.0,  1850521660.0},
-  {2577025741.0,   967061909.0,  3228376933.0,  3460067597.0,   924710212.0,  3127033414.0},
-  {3743940359.0,  3086517863.0,  2660712528.0,  2977827542.0,   548915738.0,  2154698045.0},
-  {1819501423.0,   910060316.0,  2760145640.0,  1139175917.0,  2414730818.0,  1086860165.0},
-  { 363692061.0,  2905923200.0,  1711409272.0,  2358183061.0,  3817583419.0,  1157541461.0},
-  { 285048228.0,  3956304421.0,   474955037.0,   876536975.0,   310199876.0,   548213897.0},
-  {2298028642.0,   250707066.0,  3617734318.0,  3360168457.0,  1761090392.0,  2695118162.0},
-  {2680454059.0,  3188281238.0,  2260794782.0,  2232151704.0,  2133529842.0,  3800243821.0},
-  {1776208306.0,  3879468439.0,  2821383714.0,  1991567237.0,  3022588145.0,  3865828325.0},
-  {3379909717.0,  1484740716.0,  3637748257.0,   669000885.0,  1613346958.0,  2842343340.0},
-  { 746146350.0,  1623089967.0,  1320348915.0,  1652168053.0,  2689886381.0,  3797565315.0},
-  {2102951267.0,  2760445428.0,  2043621366.0,  2991389998.0,  1849060744.0,  1745917928.0},
-  { 707316439.0,  2652109727.0,  1245641714.0,    89381764.0,  2411773873.0,   272836303.0},
-  {1605385110.0,  2677726188.0,  2145817405.0,  2581781646.0,  4137223692.0,  2310238541.0},
-  { 105216835.0,   542925897.0,  4227280485.0,  1420083371.0,  2893805976.0,  3347014616.0},
-  {3849175265.0,  1161598711.0,  2746134386.0,  1140578304.0,  1955205459.0,   267740942.0},
-  {2821205175.0,  3718882714.0,    49056553.0,  3281441748.0,  4008293624.0,   949524844.0},
-  {3261992349.0,  1816135492.0,   717700665.0,   824970232.0,  3860696115.0,  3128575380.0},
-  {1751681995.0,  3116447332.0,   541348253.0,  2117770072.0,  1562926724.0,  3222061722.0},
-  {3770972199.0,   917886406.0,  3854869117.0,  2974204375.0,   763185131.0,   265133819.0},
-  {1963425466.0,  2981553537.0,  3917167319.0,  1318481623.0,  2347270007.0,    81160101.0},
-  {2851600790.0,  4112082753.0,   623010945.0,  3692394442.0,  3979823160.0,  1942475935.0},
-  {3875537876.0,   707925420.0,  2820570397.0,  1088304742.0,  3818966116.0,  3596377050.0},
-  {3207342050.0,   181487141.0,   741253094.0,  2944315280.0,  4137929902.0,  3937030071.0},
-  {2234193122.0,  3446281074.0,  3742770587.0,  2280529149.0,  3950461744.0,   966052616.0},
-  {4177880780.0,  3718763635.0,  1518816465.0,  2735314335.0,   320681056.0,  1673923858.0},
-  { 425743630.0,  1432602560.0,  1422007568.0,  3856945538.0,  4167032295.0,  1580634049.0},
-  {3381808242.0,  3528789327.0,  1932557058.0,  3021104134.0,   687148704.0,  3528355910.0},
-  {1782549648.0,  1701982466.0,  1648045619.0,  2137687431.0,  3967071643.0,  1056301125.0},
-  { 487342524.0,  3554055355.0,  3724695994.0,  3158783013.0,  2204415522.0,  4240392439.0},
-  {2841837666.0,  1675156341.0,  4196279372.0,   697547341.0,  3293012675.0,   667622965.0},
-  {1432312142.0,  4076880518.0,  1624762716.0,  1401279369.0,  2458703036.0,  1867923082.0},
-  {  51946794.0,  3359652529.0,  2242628513.0,   984515087.0,  3368543104.0,  3319742134.0},
-  { 331390471.0,  3258027629.0,  1608329774.0,  3068177052.0,    65270134.0,  4016741516.0},
-  {1017873979.0,  2109786428.0,  1844063850.0,  1800156091.0,  4218943581.0,  2856109667.0},
-  { 857924744.0,  3998852529.0,  1587581002.0,   649753066.0,  1010924036.0,  1648348702.0},
-  {4070471399.0,  2719900500.0,  3207446510.0,  2685687250.0,  1629765932.0,  1362670580.0},
-  { 855447810.0,  1246115455.0,  2452654799.0,   180744417.0,   462365399.0,  2712265474.0},
-  { 159979380.0,  3537962923.0,  2980083353.0,  1216272773.0,  3079784415.0,  3212029130.0},
-  {2124329707.0,  4275720456.0,  3463387937.0,   457050915.0,  1046959832.0,   157305025.0},
-  {3152123057.0,  1552193308.0,  2320693991.0,  4059586832.0,  3221301054.0,  1420359359.0},
-  {1735631463.0,  2208884464.0,  3998379657.0,  3643406470.0,  2971772845.0,  3747652568.0},
-  {3824554696.0,   861364823.0,  2304595720.0,   125005562.0,  1049265332.0,  2313706035.0},
-  {1427531743.0,  4113589463.0,  3846589834.0,   216069600.0,  2268458906.0,  3357141180.0},
-  {1384364989.0,  2024714835.0,  3150505899.0,   774402064.0,  4058083974.0,   440693222.0},
-  { 108827253.0,  1045097693.0,  1357749051.0,  2110571837.0,   854169106.0,  3349543088.0},
-  {4126234545.0,  1562206862.0,  2028973385.0,   901637264.0,  1651892098.0,  2660941007.0},
-  {  80863190.0,   291036508.0,  1248594292.0,   367646496.0,  2042613135.0,  1438712976.0},
-  {1213714595.0,   144254297.0,  2617047803.0,  2088077186.0,   101727130.0,  2196724665.0},
-  {  51908307.0,   332593637.0,  1729398805.0,  3743517989.0,  1155874014.0,  3609484364.0},
-  {2070032940.0,   706603701.0,  3206592907.0,  2459508397.0,  1675196230.0,  2716736483.0},
-  {2547928747.0,  2299200010.0,  3025679399.0,  4187125331.0,   314291168.0,   884865060.0},
-  {1007234085.0,  4062781508.0,   113395769.0,  1590117931.0,  4256546355.0,  1021420204.0},
-  {2825523488.0,    71457535.0,  3286573022.0,   102722304.0,  2424980062.0,  3162469668.0},
-  {3840232347.0,  1083453616.0,   579973099.0,  2706708631.0,  1094560895.0,  1504935036.0},
-  {2595208932.0,  3689991019.0,   659152998.0,  1915068038.0,  4035862881.0,    57375498.0},
-  { 811468924.0,  1278974136.0,  4293297154.0,   364370379.0,  3937175208.0,  2094891098.0},
-  {2250616956.0,   110989047.0,    31909894.0,  1450541009.0,  3712194965.0,   335257561.0},
-  {2050151566.0,  1896618053.0,  1508633909.0,  3673514398.0,   696455465.0,  3364707499.0},
-  {2626052929.0,   631225368.0,  3958447817.0,  3180574654.0,  3307220199.0,  3005014968.0},
-  { 799125649.0,   441605225.0,  2720601720.0,  2075872439.0,  2553453163.0,  1232250655.0},
-  {2171704822.0,   895699195.0,  3277027890.0,   385163224.0,  2109836765.0,  4170369436.0},
-  {1542734531.0,   105195848.0,  3289941607.0,  2757245625.0,  1070078637.0,  3500350200.0},
-  {1274303536.0,  1405801533.0,  1236261061.0,  2431449205.0,  2365549876.0,  2044144786.0},
-  {2097309431.0,  1132149258.0,  1302792517.0,   243146573.0,  1193771852.0,  3753717929.0},
-  {1076974761.0,    97719245.0,  1895283097.0,  1865840931.0,  2482102688.0,  1796656537.0},
-  {3842639915.0,   790649652.0,  3765197284.0,  3558015744.0,  4095605012.0,  3023666320.0},
-  {1869132997.0,  3411217504.0,  4246800601.0,  2727299193.0,  2124744171.0,  2208018226.0},
-  { 192103776.0,   603841892.0,  1206463270.0,  1307054888.0,   585108683.0,   505921438.0},
-  {3362387345.0,  1246758846.0,  2439705653.0,  3282273677.0,  1846884910.0,  4042554473.0},
-  {2956059795.0,   872772047.0,  1550335345.0,  2646215061.0,  2763033689.0,   222176245.0},
-  {2386489756.0,   600956040.0,  3457767976.0,   498761542.0,   871231316.0,   619566245.0},
-  {2362903454.0,  2228373760.0,   728714296.0,  3437315428.0,  2434180373.0,  4251186364.0},
-  {  33021992.0,   807258559.0,   541347581.0,  3478732903.0,  3414177967.0,  3969966436.0},
-  {3890206709.0,  1381446643.0,  1328096991.0,  2982354742.0,  1015171024.0,   290790653.0},
-  {1707313054.0,  2656385954.0,   541560669.0,   394169606.0,   195411056.0,  3143434169.0},
-  {3972497222.0,  2822684522.0,  2481894056.0,    97151615.0,  2671516792.0,  1239273277.0},
-  {1535948984.0,  3940462390.0,   298474995.0,  2345666810.0,   769603744.0,   136006561.0},
-  {1330818931.0,  3826284593.0,  3048149949.0,  3734764683.0,   351960233.0,    23421913.0},
-  {3590614629.0,  3389257320.0,  3697700849.0,  2466178730.0,   299157165.0,   498953091.0},
-  { 940598699.0,  3639392346.0,  1947777198.0,   571641162.0,  3927699487.0,   413236692.0},
-  {2888952348.0,  3069669524.0,  2946066488.0,   760286961.0,  1541548521.0,  1414106715.0},
-  {2184968132.0,   545942986.0,  2779459199.0,  4101268230.0,  3781613275.0,   763753485.0},
-  {3700732395.0,  2024288230.0,  2951322543.0,   472607826.0,  1274603429.0,  2530610394.0},
-  {3706863998.0,   334059775.0,  1832952116.0,  1386301378.0,   257490215.0,   930012917.0},
-  { 646350902.0,  3397339693.0,  1461451337.0,   663608859.0,  3577325466.0,  2542607690.0},
-  {3426916567.0,  3967735324.0,   757085473.0,  4274086389.0,  1956455371.0,  1745638721.0},
-  {1670744174.0,  3382556913.0,   809109021.0,  3430490549.0,   471120211.0,  1824824269.0},
-  { 436744620.0,  3780318066.0,  3293839574.0,  2036693981.0,  1668945424.0,  4154918577.0},
-  {1995724432.0,   758679285.0,  1176017035.0,  2129851964.0,  2335928152.0,  1570797378.0},
-  {1261602594.0,  3619566459.0,  3319631938.0,  3230240454.0,  1298778757.0,  2420964577.0},
-  {4049982154.0,  1635384254.0,  3328103224.0,   561201154.0,  3246878758.0,   972264563.0},
-  {3977266900.0,  1865580901.0,  3314697001.0,  1131386066.0,   767993645.0,  3321259098.0},
-  {3093617237.0,   595396920.0,  3219463410.0,  1054194287.0,   825396400.0,   786170282.0},
-  { 166242657.0,  3204625681.0,  1342528447.0,   389235421.0,    92339287.0,   836385974.0},
-  {2470524049.0,   730461612.0,  2908147154.0,  3655658160.0,   149822176.0,  3120905767.0},
-  { 958553911.0,  2165325440.0,  1925560851.0,  1568047952.0,   847592939.0,  1995409484.0},
-  {3055366776.0,  3598776502.0,  1118378324.0,  3971630629.0,  1922109309.0,  1305990217.0},
-  {1767032089.0,  3459970060.0,  1961233971.0,  1142832835.0,  1032034544.0,  1460156712.0},
-  { 808185188.0,  1945012916.0,  2292607970.0,  3896250302.0,  3025084202.0,  2396167046.0},
-  {2478523772.0,   728349230.0,  4180274101.0,  3799778080.0,   254815766.0,  1752787003.0},
-  {2587178719.0,  1661900149.0,   884065766.0,  2692394728.0,  2645092663.0,  3230235941.0},
-  {3820886392.0,   423022883.0,  3212157431.0,   638172051.0,   156508009.0,   358046940.0},
-  {3492642704.0,   841311315.0,  2551031728.0,   949519443.0,   323912192.0,  2506526497.0},
-  {4128262142.0,   912865647.0,  3660725338.0,   948862190.0,   912684182.0,  3171835775.0},
-  { 193561975.0,  2086264400.0,  3826932231.0,  1176674595.0,  2448325642.0,   346037620.0},
-  {2039259077.0,   830434922.0,  3169666800.0,   823408850.0,  3922401657.0,  2076039337.0},
-  {2051188874.0,  3194298244.0,  4238355332.0,  1244940048.0,  1609714248.0,  4111225695.0},
-  {1256808673.0,  3106422462.0,  1736581658.0,  2571795186.0,    25733840.0,  3240547533.0},
-  {1406070585.0,  2100519143.0,   746139302.0,  3111918857.0,  2442510478.0,  2346069436.0},
-  {3762820951.0,  1097238705.0,  1277414245.0,  1524338255.0,  1759102930.0,  3381328361.0},
-  {1077189266.0,   193927394.0,  1291146533.0,  2104270530.0,  2471875930.0,  3161263559.0},
-  { 929330519.0,  3527894929.0,  2091568737.0,  1573375611.0,  2668731659.0,   866411439.0},
-  {3127011499.0,  2092761839.0,   164512495.0,   869518907.0,  3277758807.0,  1764882057.0},
-  {3774016982.0,  3402735474.0,   339326945.0,   367096726.0,   325100978.0,  3375234756.0},
-  { 252299468.0,  1809925440.0,   180869726.0,  4279289270.0,  3167383812.0,  3396795725.0},
-  {2825612615.0,  2303992462.0,   266082989.0,  3276472619.0,   139561945.0,   533712179.0},
-  {4112997648.0,   277877173.0,   485928516.0,  4123112008.0,  3006146561.0,  3045717297.0},
-  {4044528274.0,  1001022125.0,  3163398571.0,  2319952554.0,  1574259649.0,  2286785886.0},
-  {2417145631.0,  1093916929.0,  3331751396.0,  1639823002.0,  1554945490.0,   585529504.0},
-  {3997874010.0,   636971662.0,  1539771254.0,  4031954238.0,  1665944117.0,  1623971331.0},
-  {1389714135.0,  2241152115.0,  1552670185.0,   179569026.0,  1000167865.0,  1159239763.0},
-  {1251434741.0,  3169664983.0,   253164451.0,   244592193.0,   924530562.0,  3916267537.0},
-  {1479948944.0,   710322581.0,  1833749923.0,  2070073443.0,    96195155.0,  3819520093.0},
-  {2995614519.0,   122157928.0,   881467854.0,  1626638743.0,   603757224.0,  3830806226.0},
-  {1338535543.0,  2585546699.0,  1128893143.0,   998702728.0,  1889491106.0,  2987423295.0},
-  {1120823296.0,  1654816876.0,  2821694248.0,  1047881093.0,  3293088278.0,  2597215373.0},
-  {2366427279.0,  4149558320.0,  1125954695.0,  1270926191.0,   795654578.0,  3217216245.0},
-  {3951337286.0,  3420720105.0,   910742762.0,  4060573220.0,  2486028771.0,  2711337169.0},
-  { 656036426.0,    64477768.0,  1393213981.0,  4288658775.0,   725783816.0,   300593445.0},
-  {3484393230.0,  1284521245.0,  1644105843.0,  2906898953.0,   584856467.0,  2806360205.0},
-  {3278561113.0,  3163688717.0,   759829179.0,  1586342163.0,  2818037134.0,  1961339848.0},
-  {  71028939.0,  3499356703.0,  2095811228.0,  3114912980.0,  2515308273.0,  2269799105.0},
-  {2042690865.0,  4107689735.0,  3573921747.0,   195938969.0,  3361897667.0,  3603640682.0},
-  { 132969763.0,  3126150773.0,  2588997509.0,  1840184638.0,  2463915819.0,  3348476551.0},
-  { 725563069.0,   788630472.0,   954901656.0,  3087105598.0,   435945607.0,   895238151.0},
-  {1401066748.0,  1697586830.0,  3467131028.0,  3976688601.0,  2200436160.0,  3512420129.0},
-  {2869187979.0,  1099590900.0,  2198263637.0,  3810533442.0,   407919959.0,   496728659.0},
-  {1626551803.0,  3749180952.0,  3716553553.0,  3399243378.0,  1509977116.0,  1333928399.0},
-  {2796544005.0,  3803301900.0,   227768709.0,  1751795403.0,  2203140028.0,  2472213905.0},
-  {3965648374.0,   570374679.0,  1720800354.0,  2461603736.0,    95733897.0,   198470670.0},
-  {3463355505.0,   811570786.0,  1218319908.0,  2517046301.0,  3628539659.0,  3102506238.0},
-  {2608408872.0,  3127805847.0,  3072930345.0,   414530027.0,  3512948759.0,  1129044436.0},
-  {4122359133.0,  4238236858.0,  1022264969.0,  2632573313.0,  4206095433.0,  3451197254.0},
-  {  74769791.0,  2063325156.0,  3340676977.0,    18389349.0,  3869442822.0,  3178231094.0},
-  {2187368099.0,  1058480870.0,  3663929160.0,  3067467704.0,   628396321.0,  3124372782.0},
-  {4005002002.0,   902093294.0,  1389278272.0,   490687399.0,  2977913312.0,  3750363186.0},
-  {  71616924.0,  3624181757.0,  2421939569.0,   205624440.0,  1277306021.0,  1639043104.0},
-  {1709684526.0,  2258577116.0,  3957095301.0,  1296296102.0,   248368260.0,     7476887.0},
-  {1957824754.0,  3604966352.0,  1023574818.0,  1592319788.0,  1732269145.0,  1065708441.0},
-  {4268503735.0,  4139131232.0,   562532566.0,  2172590170.0,  2534028056.0,  3826522945.0},
-  {2784630589.0,  2784559557.0,   646145054.0,  3994325919.0,   540583981.0,  3816114916.0},
-  { 621521726.0,  3202282132.0,  1787067171.0,  3467133912.0,  2208160413.0,  3022184836.0},
-  {3816957288.0,  3238718270.0,  3842954333.0,    82383037.0,  2504094452.0,  2093930173.0},
-  {1172016654.0,   508414877.0,   813727083.0,  2815459466.0,  1938811880.0,  3315153813.0},
-  {1291254032.0,  1297843896.0,  1249498790.0,  4016249839.0,   477961120.0,  1369793770.0},
-  {3515862346.0,  4016942816.0,  3571974705.0,   767054678.0,   362127552.0,  1192004639.0},
-  {3683373171.0,  3107138060.0,  1549433379.0,  2038980864.0,  2258207582.0,   977479605.0},
-  {1641822908.0,   614407938.0,  1332673048.0,  4248375105.0,   210622386.0,  3302259832.0},
-  {1809560385.0,   946738900.0,  3409410752.0,  3977115366.0,  3082848965.0,  1704176143.0},
-  {2165873337.0,  2070146750.0,   758033833.0,  1704325510.0,  2487144298.0,  4213886591.0},
-  {3928413661.0,  1951836573.0,   654371843.0,  3154432208.0,   796848343.0,  1266425211.0},
-  {2105477208.0,  2621828300.0,   458084988.0,  1095160780.0,   490299921.0,  3398635424.0},
-  { 389445800.0,  1452907134.0,  2319668471.0,  2590378643.0,  3545669343.0,  2587675433.0},
-  {2998127404.0,  2163077512.0,  1278928530.0,  1838388746.0,  4284603504.0,   729306439.0},
-  {2464834075.0,  4186663434.0,  3520361110.0,  3015333355.0,  4101591506.0,  1344127035.0},
-  {3535342670.0,  2510967955.0,   667543291.0,  3743714868.0,  4206464980.0,  1191609324.0},
-  {2063764962.0,   595075740.0,  3817451245.0,  1596995120.0,  1681514392.0,   230100418.0},
-  {1575535972.0,  2112617841.0,  1200512069.0,  4178670713.0,   696875206.0,  3690826567.0},
-  { 127408110.0,  2438290026.0,   848284696.0,   550822678.0,  4138547399.0,   486365958.0},
-  {2990024594.0,  2780011077.0,  3166524788.0,   977503869.0,  2583013812.0,   849610023.0},
-  {4015591388.0,  3511583148.0,  2398880225.0,  3387487581.0,  2950030221.0,  1400933374.0},
-  { 421572431.0,  2855224322.0,  3353716233.0,  3022334834.0,   450222178.0,  3920673851.0},
-  { 810988747.0,  2847887443.0,  4222145627.0,  2033094220.0,   253848436.0,   380194482.0},
-  { 960519694.0,  1953471340.0,  3154331873.0,  2127022692.0,  1154246065.0,  4254627828.0},
-  { 413661786.0,  4067523437.0,  3797578170.0,  1546658950.0,  3095436071.0,  2399055211.0},
-  {2401891535.0,  1175530067.0,  1823167021.0,  1592245297.0,  3828191894.0,  1626715588.0},
-  {2585842168.0,  1733468473.0,  2121009784.0,  3733894867.0,   629453245.0,  2246973305.0},
-  {1498488325.0,  4241609607.0,  1741298629.0,  2563745185.0,   477532383.0,  4237049970.0},
-  {1314572316.0,     7288821.0,  2900885893.0,  1636597847.0,   942113023.0,   327040018.0},
-  {1229979759.0,  2997277141.0,  1882785575.0,  2966406615.0,  3108789742.0,  3587640527.0},
-  {2113038969.0,  1667948232.0,  3274050802.0,  3374789090.0,  3153332173.0,    42784842.0},
-  {3464970195.0,  4214022954.0,  1169721604.0,  3356986763.0,  3294952207.0,  3370023539.0},
-  {1280770564.0,  1265238630.0,  1898833576.0,  3888981392.0,  1280565231.0,  1189894348.0},
-  {1688021473.0,  1667079950.0,  3972994461.0,  2817630240.0,  1163110301.0,  2033298733.0},
-  { 146705187.0,  2423442477.0,  3396784122.0,   112139856.0,  1522652818.0,  2536903231.0},
-  {4119734557.0,  2509279955.0,   153489233.0,   579685763.0,  4167098214.0,  3958872498.0},
-  {2374853893.0,  1070102405.0,  4041023405.0,  1110504724.0,  3812278492.0,  2919537165.0},
-  {2973552993.0,  3666730851.0,  4138422808.0,  2627141450.0,  1817672688.0,   276985304.0},
-  {2954182691.0,   125032263.0,   612517677.0,   696883378.0,  2650572944.0,  3051316102.0},
-  {1964587154.0,  1269738899.0,  2271365828.0,  3742288322.0,  1670599625.0,  2690356365.0},
-  {2330610960.0,  4098736728.0,  4040014382.0,  3282057381.0,  3780914751.0,  2139496745.0},
-  {3352166102.0,  1034342576.0,  2083540301.0,  2571176969.0,  3896700833.0,   199449473.0},
-  { 491475278.0,  2870485810.0,   859991108.0,  1298362069.0,  2136080420.0,   447772123.0},
-  { 656820494.0,  3463543198.0,  2625298610.0,  2882551128.0,   376519185.0,  2357494502.0},
-  {2811631691.0,  2571820931.0,    71196563.0,  2601054011.0,  3444315232.0,  1010773994.0},
-  {2356922344.0,  3305196676.0,    25420893.0,  2191391963.0,  1670101489.0,  3362139395.0},
-  {3244569385.0,   760185996.0,   182306040.0,  1386240052.0,  1975921236.0,  2037601092.0},
-  { 419653990.0,  1360934691.0,  1541731299.0,  4011200817.0,  3030253685.0,  3476611977.0},
-  {2693573488.0,  2885118842.0,  2723788600.0,  3470606719.0,  3660922506.0,  3446021797.0},
-  {2168869376.0,  1106077057.0,  2319340366.0,  2774111985.0,   215206339.0,  3968897576.0},
-  { 881973947.0,  1576669843.0,   485495056.0,    86944277.0,   368797497.0,  3896841419.0},
-  {2143059593.0,   402049363.0,   726488004.0,  4247321354.0,  2895399098.0,   365977404.0},
-  {4001109589.0,   211763726.0,  2272391091.0,  1970396786.0,   931654087.0,  1963071356.0},
-  {1478128355.0,  2371532751.0,   103990140.0,  3349522959.0,  3069388337.0,  1036343178.0},
-  {2232169965.0,   585901189.0,   828845020.0,  1189539914.0,  2595527485.0,   887110046.0},
-  {1375955244.0,  2448528589.0,  2354833007.0,  3910230214.0,   238828220.0,  2251010211.0},
-  {  81021947.0,  2036376354.0,  1489414132.0,   924748155.0,  1349173585.0,  2744249149.0},
-  { 536105336.0,  4061125151.0,  4078986004.0,  4005972197.0,  4122669963.0,  4147777749.0},
-  {3827920990.0,  3637665420.0,  4148889995.0,   368721336.0,  3329669484.0,   365818450.0},
-  {1382042368.0,  2016489304.0,   295776788.0,    74145134.0,  3886100084.0,   606604933.0},
-  {1121708214.0,   827266950.0,  1638059549.0,  1969186089.0,  2122910304.0,   775550772.0},
-  { 546202669.0,  3244285617.0,  2869336607.0,  3839389232.0,   184156380.0,  3247187967.0},
-  { 605454913.0,  4057142016.0,     6820171.0,   292655863.0,   281317726.0,  2364277571.0},
-  {3882576267.0,   659781894.0,  3469081948.0,    49617968.0,  3876970872.0,    92770661.0},
-  {2045933407.0,  1113463472.0,   481339969.0,  3182821518.0,  3138914486.0,  1301835088.0},
-  { 974684163.0,   295842808.0,  2938828528.0,   626539024.0,  3839945455.0,  3830188874.0},
-  {3242177551.0,  1211095798.0,  2622400591.0,  3835340811.0,   830442270.0,   835899489.0},
-  {3001351516.0,  1180263865.0,   112914290.0,  2219355059.0,  1896887702.0,  2771651802.0},
-  {2575373902.0,  3432509413.0,  1533015524.0,  1529854267.0,  3874734177.0,  2963709081.0},
-  {3584983087.0,   832894642.0,   101924466.0,  1276211377.0,  2908179383.0,  3920393878.0},
-  {1473602937.0,  2064826867.0,  4170251345.0,  3732985086.0,    42310161.0,  1180495914.0},
-  { 903940727.0,  2223349197.0,  2961204239.0,   150965336.0,  3258551869.0,  2191559917.0},
-  {3700028647.0,  3496735859.0,  2084072425.0,  2644555181.0,   101495863.0,  2327507110.0},
-  {2386126066.0,  3170412912.0,   920053012.0,  2142935050.0,  1663172722.0,   970947998.0},
-  {3391436104.0,  2127784864.0,  2468918640.0,  1567240235.0,   653675678.0,  4251054876.0},
-  {2822556689.0,  1620509332.0,    14563521.0,  3236610523.0,  3340199180.0,  1528604173.0},
-  {3138909228.0,  2924197874.0,  3503373170.0,  2401597295.0,  1015288549.0,  3737382713.0},
-  {  96891425.0,  1322016893.0,  3074496529.0,  3602256011.0,  3577476732.0,  1706073792.0},
-  {2210062506.0,  3265662024.0,  4200365103.0,  2574255891.0,  2710064686.0,  3351956419.0},
-  {1932635440.0,  2372571428.0,  1928679531.0,  2665266652.0,  2601012107.0,   473051926.0},
-  {1777628419.0,  4120393745.0,  2767566421.0,  1228017335.0,  3919772492.0,  3715067296.0},
-  {2712719084.0,  2746150520.0,  1635421090.0,  2823495457.0,    13904555.0,  1086119835.0},
-  {3445299049.0,  1380710842.0,  1428915899.0,    39499706.0,  1871303801.0,  1339398832.0},
-  {1051670372.0,  2194663137.0,  3798437895.0,  3530206369.0,     6292518.0,   684829028.0},
-  {2855145416.0,     3536461.0,  2509828638.0,  3906595809.0,   342965637.0,  3686290840.0},
-  {1049152347.0,  2554956312.0,  3281671647.0,  3473298962.0,  1443546781.0,  2978511136.0},
-  {1015313856.0,  1304318150.0,  4170149672.0,  1803726835.0,  3692283032.0,   676189246.0},
-  {2060686697.0,  1970068852.0,    24045114.0,    66003331.0,  3900157483.0,  2360501885.0},
-  {2984971849.0,  2584831843.0,  3196200706.0,   979117347.0,  4037961902.0,  2231233526.0},
-  {1242885237.0,  2934862802.0,    54219947.0,  4133004016.0,  4028856409.0,   294987887.0},
-  {1500464320.0,  3270889687.0,  3056919605.0,  1966166983.0,  1199923925.0,   881871687.0},
-  {2054009450.0,   151776097.0,  2890875028.0,  1800121177.0,  4036680009.0,  3787551675.0},
-  {1130142262.0,   549399231.0,  3101893176.0,  3405076838.0,  1572662325.0,  2387308296.0},
-  { 333510795.0,  2489680410.0,  4276928124.0,  3543807167.0,  1225463047.0,   521582788.0},
-  {1196896981.0,  1055294485.0,   103552777.0,   802214257.0,  2848620353.0,  2440898694.0},
-  { 637656554.0,   386971741.0,  3488363790.0,  3050693722.0,  1727571715.0,   378200243.0},
-  {2337883896.0,  4107587397.0,    69557483.0,   637089133.0,  2849572881.0,    49700789.0},
-  {1579819290.0,  2346865644.0,  2158118831.0,  2418663783.0,  1273653567.0,   580304810.0},
-  {3934704170.0,    88471213.0,  2383570702.0,  3290737697.0,  1208544609.0,   551833012.0},
-  { 993768195.0,  1888275250.0,  2198829958.0,  2120156344.0,  1151403423.0,  3153466062.0},
-  {2815364670.0,  4009542957.0,   397065016.0,  2860004670.0,  1934675686.0,  2903286665.0},
-  {2385926659.0,  2802867492.0,  2423590307.0,  2817144552.0,  2175031518.0,  1383429313.0},
-  {1611083701.0,  4243747864.0,   854229991.0,  1956710729.0,  1328349691.0,  3050168310.0},
-  {1028245421.0,  1216244134.0,  3055130900.0,  3664449768.0,  1671014884.0,  3992442103.0},
-  {4040340305.0,  1839845051.0,  1324789632.0,   807082108.0,  2597163281.0,  1866034821.0},
-  {2406090224.0,  3395043853.0,  4023232132.0,  1153085551.0,  1963332099.0,  1834223037.0},
-  { 414264130.0,   309296261.0,  2073574386.0,  4075760688.0,  1028722567.0,  1448663014.0},
-  {1250756743.0,  2457030080.0,    93661298.0,  3398729605.0,  4228813263.0,  1496307663.0},
-  { 577906045.0,  4221466420.0,  1182078375.0,    16523819.0,   803328953.0,  3887700199.0},
-  {3101753155.0,  2308253034.0,   404698440.0,  4175852336.0,  2322438376.0,  2792600117.0},
-  {1316647624.0,  3538472387.0,  2938835586.0,  4080303791.0,  1274189140.0,  4160691369.0},
-  {1591080658.0,  2221060671.0,  3176736694.0,  2013961399.0,  2607578931.0,   249809604.0},
-  {3692528741.0,  3574246086.0,  1238390150.0,  1629238729.0,  3088231875.0,  2153385343.0},
-  {3757434484.0,  3014973666.0,  1674842570.0,  1635333277.0,    78340766.0,  3764014800.0},
-  {1805886495.0,  1355947552.0,   731211900.0,   541474405.0,  1779111507.0,   702345420.0},
-  {2141486713.0,  3525829081.0,  4287246223.0,  2573087889.0,  4197123207.0,  2374081246.0},
-  {3228195681.0,  4161264765.0,  2421682571.0,  2085634526.0,  2052774301.0,  2107262864.0},
-  {3640225188.0,   908960249.0,   227572084.0,  3573941278.0,   574664870.0,   231431413.0},
-  {4169051962.0,      940780.0,   890975217.0,    63760967.0,  2421050332.0,   169094402.0},
-  {2259979959.0,  3868046088.0,  3366247597.0,  4146280713.0,  1853852157.0,  1811993661.0},
-  {1380120538.0,   206960412.0,  3043165653.0,   576056766.0,   588627843.0,  1619693962.0},
-  {3240741176.0,  3213179321.0,  1924864044.0,  1233098622.0,  2401407271.0,  1249394465.0},
-  {3449774050.0,  1028598142.0,  3068670665.0,  1392241467.0,  2540030365.0,  2186494503.0},
-  {1951711242.0,  3296163457.0,  1940492721.0,   897572453.0,  3783370082.0,  3791179145.0},
-  { 609952834.0,  1522022489.0,  3225236619.0,   274082515.0,  1184289852.0,   706711075.0},
-  {3892723525.0,  1799753479.0,  4129498091.0,  1757110080.0,  2188956153.0,  1037323159.0},
-  {1472419792.0,  1812084043.0,  1193836045.0,   763222369.0,  3857469260.0,  3828701486.0},
-  { 429590172.0,     1483001.0,  1553708994.0,  2221527328.0,   345606884.0,  3831355930.0},
-  {3428614020.0,  1514561525.0,   670730317.0,  2833349040.0,  4046527209.0,   363406345.0},
-  {4045244396.0,  4158120422.0,  2139605256.0,    29560485.0,  2039833520.0,  1547991020.0},
-  { 215057511.0,  3843964963.0,  1847581020.0,  2480808567.0,  2501980440.0,   728904205.0},
-  { 750864452.0,  2970653891.0,  1930965475.0,  2937405522.0,   793648440.0,  1264489886.0},
-  {4004503534.0,  1277290069.0,  2424639159.0,   475496752.0,  2186651834.0,  4071906356.0},
-  {1291188393.0,  3940150473.0,   126490750.0,  3958586211.0,  1014150452.0,  2122056836.0},
-  { 475972566.0,  2857036775.0,  3262919263.0,  1919801476.0,  1119236074.0,  1613960119.0},
-  {1423283951.0,  1471474102.0,  2643813173.0,   760894104.0,  2084706857.0,  1690656610.0},
-  {2001873771.0,  2886334327.0,  1114432567.0,    65339150.0,  1190173551.0,  2088946532.0},
-  {1753856323.0,  1332538828.0,  1669661023.0,  1064589348.0,  3264789150.0,   572619806.0},
-  {1619970083.0,  2704176171.0,   220576883.0,  1273168949.0,  1560439969.0,  2400938501.0},
-  {3905252445.0,  4103547480.0,  1681562794.0,   485360110.0,    19487881.0,  2565521092.0},
-  { 105687164.0,  1398420335.0,  3946581459.0,  1565862254.0,  2458198411.0,   362442317.0},
-  {3410413032.0,  1190105799.0,  2313388659.0,   268914261.0,  1684585783.0,  3309568700.0},
-  { 987102901.0,   363237140.0,  3338084444.0,  1834522707.0,  2549179134.0,  1149410139.0},
-  { 115768789.0,   835485743.0,  3222663674.0,  4095620374.0,  1152421572.0,   106577310.0},
-  {3399615385.0,  1548399277.0,  2859156384.0,   430744080.0,  2181146344.0,  1788112019.0},
-  { 494080951.0,  3488458066.0,   158296421.0,  4142284065.0,  3165946964.0,  2962075699.0},
-  {3100747509.0,   748777653.0,  2006390343.0,   610826821.0,  1738112414.0,   628766394.0},
-  { 144611525.0,  2105393910.0,  2617800576.0,  3339609569.0,  3330576802.0,  2854480315.0},
-  {4144698313.0,  4117398432.0,   972231724.0,  2804064927.0,  2442599638.0,  2756549792.0},
-  {1407000688.0,  2815500955.0,   819380899.0,   741868580.0,  1075431262.0,  4195681364.0},
-  {3764472246.0,  2468602146.0,  2569390908.0,  3474430607.0,  4101630062.0,  4180155359.0},
-  { 705769571.0,  3956084492.0,  2475302236.0,  2921705212.0,  1626872704.0,  3237586569.0},
-  {3483760083.0,  1025038781.0,  3366567830.0,   432224271.0,  1953166412.0,  3394423618.0},
-  { 269444994.0,  3539354798.0,  3763379867.0,  3912259566.0,   489195383.0,  2650250877.0},
-  {1801971825.0,  3767862506.0,   880709999.0,  1388001014.0,  4124891067.0,  1680421318.0},
-  {2137019219.0,   802228183.0,   659487707.0,  1564677129.0,   581946049.0,  1995287384.0},
-  {2320930886.0,  1222437930.0,  2142614760.0,  3204316224.0,  3843561364.0,   383661641.0},
-  {1760105960.0,  2878609580.0,   361890931.0,   412084276.0,  3080832141.0,  1061502237.0},
-  {3792940706.0,   688240462.0,  3937365547.0,  3160540123.0,  2443120993.0,  4035763802.0},
-  {4012865938.0,  2363853607.0,   209450944.0,   827354901.0,  1868246938.0,  2052812050.0},
-  {2862647395.0,  2201323059.0,  3630570047.0,  2287023570.0,  3465382835.0,  3074298652.0},
-  {4104079158.0,  2532319908.0,   326565951.0,   315527177.0,  3953281656.0,  2046899177.0},
-  {2547222170.0,   163574102.0,  1535595748.0,  2358361418.0,  2127319979.0,  2338997709.0},
-  {  25968354.0,  3576995746.0,  3494921850.0,  4124356104.0,  4194652511.0,   930503881.0},
-  {1045614607.0,   330254751.0,    39425112.0,  1006258126.0,  2543630422.0,  1940863863.0},
-  {2988852356.0,  3958400678.0,  1556648355.0,  3835095018.0,  3759475373.0,  1327356634.0},
-  {1426745804.0,  2069685655.0,  2173480159.0,  3026647842.0,  3268611445.0,  3981554879.0},
-  {1387980919.0,  2884615110.0,  3709993085.0,  3453526784.0,  3024205360.0,   689074546.0},
-  { 992855727.0,   860036479.0,  3376967288.0,  3588893430.0,  1966617805.0,  2357384603.0},
-  {1909473312.0,  2023425092.0,  1071723917.0,  1925825166.0,  3160266115.0,   943883297.0},
-  {4250412426.0,  2492112128.0,  2141985895.0,  3971640513.0,  3745451616.0,  3033544033.0},
-  {2624608653.0,  1621994412.0,   740972225.0,  1721173006.0,  1667924479.0,  2136093920.0},
-  {2664281037.0,  1359041755.0,  1714341822.0,  2019831950.0,   397816504.0,  3272929657.0},
-  { 449985696.0,   904279708.0,   915312456.0,  2758602889.0,  3696415932.0,  1745283283.0},
-  {1384762029.0,  2561880246.0,   928791253.0,  2093835064.0,  1559052030.0,  3362052800.0},
-  {4073349882.0,   381934261.0,  3610999303.0,  1464380645.0,  2491277693.0,   873289935.0},
-  {2629369504.0,  2839870363.0,  2670688550.0,   543826196.0,  4013962142.0,   300065624.0},
-  { 707631018.0,    50212769.0,  2861039718.0,   735784282.0,  1431627539.0,  3049487986.0},
-  {1566841168.0,  2989884228.0,  1800467920.0,  2645754895.0,  3165687130.0,   984723204.0},
-  { 385209827.0,   902281489.0,  1626547245.0,  1742695717.0,    90790199.0,   361135850.0},
-  {1731345052.0,  3127764733.0,  3088035894.0,  2992407024.0,  1874632825.0,  4119722365.0},
-  { 710324041.0,  3990489051.0,  2322369255.0,  4187512507.0,  4159974719.0,  1265801548.0},
-  {2078770276.0,  3058488068.0,   823397051.0,   465659863.0,  4273969321.0,  4107826078.0},
-  {2335679260.0,  1603102705.0,  2560402150.0,  1959893532.0,   681934075.0,  1477151782.0},
-  {2815357155.0,  1915260125.0,  1518625134.0,    18941392.0,   641694336.0,  2214113906.0},
-  { 775692772.0,   689083393.0,  2468419841.0,    31910586.0,  1524212093.0,  2369081075.0},
-  { 749499037.0,  2054630531.0,  3920275524.0,  2762119514.0,   417588877.0,  1132924493.0},
-  {  24697670.0,  2631148411.0,  2223582826.0,  2331774623.0,  3629192434.0,  1656536328.0},
-  {1011048093.0,  1971190992.0,  1844121066.0,  4045472820.0,  1872601085.0,  3780403586.0},
-  {4254151779.0,   779088319.0,  3310417468.0,   376938428.0,   908257922.0,  4007028012.0},
-  {  43050867.0,  2026836652.0,  4042468516.0,  2881264559.0,  2142805816.0,  2781169000.0},
-  {1344447240.0,  4116181050.0,  1495707609.0,  1117948595.0,  2054789889.0,   553019929.0},
-  {3900119785.0,   397983844.0,   813433766.0,  2463643921.0,  3653401107.0,  1748047751.0},
-  {1554367978.0,  2928873161.0,  3257991566.0,  3251304250.0,  3653716671.0,  3632050604.0},
-  {4037840051.0,   807757471.0,   913210473.0,   820062815.0,  3814112549.0,   118922895.0},
-  { 418992125.0,  1160847342.0,  3563491614.0,  2494668450.0,  2218391366.0,  2885367528.0},
-  {1643973413.0,  1102254022.0,   148059355.0,  3531187162.0,  2203202965.0,  3158125422.0},
-  { 429338850.0,  3797156674.0,   999268119.0,  1613601744.0,  2046306442.0,   403414563.0},
-  {4122291273.0,  1504718295.0,  2218776130.0,   152796196.0,  2479852435.0,  1917657086.0},
-  {2324017623.0,   855357288.0,   771503600.0,  1874142554.0,  1178525727.0,  3023354153.0},
-  {   4583573.0,  3852178083.0,   887737160.0,  1411055758.0,  3817559974.0,  1564709601.0},
-  {3558989104.0,  3728028176.0,  4028889228.0,  2606112618.0,  1222716379.0,  1529108686.0},
-  {1260375615.0,   311056276.0,   918728610.0,   235008965.0,  2814123381.0,  2845648136.0},
-  {1221356378.0,  1263290559.0,  4143413039.0,   804417134.0,  2199501975.0,  3367998402.0},
-  {2275708015.0,  2364270095.0,  3995195544.0,   839226700.0,  2296800437.0,   798394658.0},
-  { 389202368.0,  2723386922.0,  1331557082.0,   188080455.0,   219958554.0,    38031154.0},
-  {2042369096.0,   343102284.0,  1812423361.0,  3260720086.0,  1910387167.0,   716015883.0},
-  { 445495622.0,  2035179628.0,  1275311572.0,  3470173869.0,    17946937.0,  3815997683.0},
-  {1215585467.0,  4048468287.0,    47685747.0,  2908112750.0,  3941595898.0,  3802156906.0},
-  { 425737691.0,  1529529265.0,  2820803697.0,  2574558693.0,    67046687.0,  3992612429.0},
-  { 195053655.0,  1219483629.0,  3218951953.0,   198717832.0,  1804508700.0,  1549232600.0},
-  {2573387726.0,  3434393298.0,  1878537801.0,  3039872973.0,  3974579281.0,  2774752671.0},
-  {3724664021.0,   250992937.0,  3796283851.0,   240670018.0,  2756837866.0,  1293436200.0},
-  { 203216373.0,   308515204.0,   808033598.0,  3547170979.0,  2419201983.0,  2225783885.0},
-  {2052593595.0,  1700044205.0,  2164213407.0,  3468520026.0,   260051787.0,    54257100.0},
-  { 564932766.0,  4193877696.0,   439201239.0,  1126919846.0,   453939867.0,  1750518743.0},
-  {3455904704.0,  2177817282.0,  3677080536.0,  3976458120.0,  1529153176.0,  2721134644.0},
-  {    837271.0,  1090704480.0,  1974077454.0,   255748260.0,  3933296160.0,  2323656545.0},
-  {1582450063.0,   342990486.0,  2246266613.0,   233968441.0,  3672627207.0,   388390285.0},
-  {1934492713.0,   326258200.0,  3219705438.0,   791474922.0,  2328388052.0,  4105688499.0},
-  {2073294662.0,    83942544.0,   990988223.0,   850974549.0,  3350366846.0,   523611439.0},
-  {2471866431.0,  1545608527.0,  2939064326.0,  4043963572.0,  3570736114.0,  1190781139.0},
-  {1417991816.0,  2165586139.0,   332411793.0,  3052304951.0,  1152123994.0,  2741173573.0},
-  {2584894458.0,   299160712.0,  1507897297.0,  2497623975.0,  3021512229.0,  2232964453.0},
-  {3878821634.0,  3692137292.0,  2863668588.0,  1833090497.0,  2345132117.0,   370063657.0},
-  {3688067181.0,   483290617.0,  3703552200.0,  2553924459.0,   716525887.0,   758213129.0},
-  {1738980514.0,  3422833088.0,   223079200.0,   708988023.0,  3680245593.0,  2268686443.0},
-  { 293820549.0,  4292052494.0,  1908797290.0,  3135200791.0,  3994534702.0,  1063785241.0},
-  {3421079050.0,  3128564367.0,   207621239.0,  3282063694.0,  2777459408.0,  2706038527.0},
-  {2963317967.0,   688571538.0,  3952098888.0,  1768022372.0,  4142211366.0,  1893321026.0},
-  {2002366012.0,   748084317.0,  2710128245.0,  4045218418.0,  1121836457.0,  3537454135.0},
-  { 690867740.0,  2841925227.0,  1080016578.0,  2507523869.0,  3085730518.0,  2243988794.0},
-  { 933953502.0,   476524927.0,  2320977449.0,   588527139.0,   918375988.0,   361284190.0},
-  {3125699426.0,  3997936336.0,  3560531838.0,   346918922.0,  1633347116.0,  3759678885.0},
-  {3681288400.0,   588106925.0,  3967198616.0,  3088913600.0,   779160033.0,   327874263.0},
-  {3535663290.0,   546185391.0,   196771751.0,    64399808.0,  1722813062.0,  3099158152.0},
-  {1742115182.0,  3157252262.0,  3253650191.0,  1209567539.0,  1590595321.0,  3692116395.0},
-  {1278594450.0,  1930080299.0,   594165998.0,  3818120972.0,  2722448631.0,  2180924943.0},
-  {2872020708.0,  3855215664.0,   296894141.0,  4119030370.0,  2065278804.0,  1755659884.0},
-  {3741503242.0,  2348811516.0,  2664942076.0,   928673648.0,  2685432136.0,   527200144.0},
-  { 182852956.0,  2598081583.0,   815006399.0,    57775709.0,  1497380626.0,   892950173.0},
-  { 257493294.0,  1822152696.0,  3619522885.0,  3825696535.0,  4181810903.0,  1265052547.0},
-  {2857583770.0,  1886482985.0,  2496406019.0,  3003190801.0,  1183795662.0,  4042482827.0},
-  { 227419881.0,  4009550630.0,  3539521952.0,  3924960889.0,  1640700615.0,   378061213.0},
-  { 226788548.0,   908854103.0,  4284893099.0,   437927769.0,  3088633509.0,  3818660304.0},
-  {3988794345.0,  1068692675.0,  3354079936.0,  1521920718.0,  2595710397.0,  2309525977.0},
-  {3902685451.0,  1715924654.0,  1736531821.0,  1986949098.0,   795539284.0,   654400725.0},
-  {4266586050.0,  3682491816.0,  3150550356.0,   513487823.0,  1127216553.0,  1134740629.0},
-  {3875256745.0,  2632683634.0,  2472384015.0,  3479639524.0,   454996556.0,  1816265767.0},
-  {1619154315.0,   705533307.0,  2383967838.0,  1204303108.0,  2314517475.0,  2271288404.0},
-  {1001377684.0,  2941681802.0,  2224899252.0,  4143265413.0,  1696615771.0,  2533963047.0},
-  {2318008985.0,   440153346.0,   110826746.0,  1222244485.0,    37743343.0,  1500261834.0},
-  {1805386720.0,    98953903.0,   793154014.0,  2744187026.0,  1569597899.0,  4219619711.0},
-  {2117194150.0,  4247540215.0,  2720802994.0,  3109633486.0,  2501896041.0,  1863509155.0},
-  { 336484203.0,  4012359356.0,  3508651786.0,  4015678271.0,  2481634735.0,  3606379191.0},
-  {3922187532.0,  2267235306.0,  2582582444.0,  2791804369.0,   904754763.0,   327142317.0},
-  { 750036516.0,  3311972385.0,  2337809094.0,  2748620987.0,  3579530146.0,  1974459242.0},
-  { 518959810.0,  1658997792.0,  2237390067.0,  3857291463.0,  1505679733.0,  1095483566.0},
-  {1187289364.0,   792268955.0,  3371777052.0,  3989413571.0,  2073135412.0,  4219497528.0},
-  {1273360909.0,   737585398.0,  2485701499.0,  1128532048.0,  1491573935.0,    76354080.0},
-  {3571906020.0,  3474913121.0,  4218899909.0,  3526088374.0,  2756904429.0,  2113923037.0},
-  {1929575763.0,  3712511115.0,  3831938405.0,  1239660288.0,  1235114805.0,  3498507371.0},
-  { 626562947.0,  2933421985.0,  1053765194.0,  2172663829.0,   741854873.0,  2500279317.0},
-  { 693523177.0,  1910559597.0,   122003312.0,  2067815601.0,   547535401.0,  2228501018.0},
-  {4012914725.0,  3345495510.0,   104402497.0,  3774928048.0,  3973924075.0,  1959983842.0},
-  {2136339372.0,   441458080.0,  2456991240.0,   973861706.0,  1476690771.0,  3312984041.0},
-  {1703095683.0,  2268831855.0,  2208478140.0,  2986236161.0,   446658134.0,  1381591968.0},
-  {1456956064.0,  2501315671.0,  2458894231.0,    94704220.0,  1147355030.0,  1699600599.0},
-  {2838785822.0,  3245258197.0,  2069242150.0,  1072167231.0,  3020230077.0,   566772229.0},
-  {1757101575.0,   796722908.0,  2745640062.0,  3541210912.0,  3199745975.0,  1955124643.0},
-  { 990048979.0,  1274982704.0,  1162042072.0,   283424020.0,  3681097546.0,  1086017414.0},
-  {2752258776.0,  1713790514.0,  3116449953.0,  1520457891.0,  1755935266.0,  2214756283.0},
-  { 532372809.0,  4036806281.0,  2153777523.0,  1926913498.0,   982063333.0,    67463042.0},
-  {3699932619.0,  2820510948.0,    87261706.0,  2641086911.0,   608659076.0,  2170277111.0},
-  {1239824328.0,  3519904695.0,  1866553495.0,   928759657.0,  1094300988.0,   451235990.0},
-  {1825915769.0,  2120176551.0,  3873504085.0,   959568643.0,   740741388.0,  1550694896.0},
-  { 154416721.0,  1866404454.0,  1572250452.0,  3221467660.0,  3387446390.0,  3410958362.0},
-  {2976418524.0,  2592399587.0,   432656270.0,  3178848037.0,  1204372663.0,  4059122760.0},
-  { 394488412.0,  2027780999.0,  4089636748.0,  3114609136.0,  1804274820.0,  4104732125.0},
-  {1282015940.0,  2519387514.0,  3499797662.0,  3318255208.0,   964700995.0,  3334909378.0},
-  {3757617136.0,  2201992420.0,   239310331.0,  2125639279.0,   830408680.0,  3992029107.0},
-  {2761086152.0,  1100237490.0,  3105339494.0,  1975712438.0,  1918151810.0,  2046445809.0},
-  { 261979678.0,  4251129377.0,  3008901458.0,  3004498031.0,  1896232095.0,  3217219716.0},
-  {1517288442.0,  2329383951.0,    19777965.0,  1413896024.0,  2495409988.0,  3202507187.0},
-  {2570071027.0,  3345159672.0,  1240206154.0,  1223010778.0,  2788637723.0,  3268982473.0},
-  {1202059388.0,  3218783122.0,  3023134692.0,   474924808.0,  2312773391.0,  3373223831.0},
-  {3713001024.0,  4089337710.0,  2261622108.0,  2650855215.0,  3877371118.0,  1991255195.0},
-  { 695723307.0,  2863271580.0,  1524368447.0,  2024478170.0,  2778492825.0,  2775757060.0},
-  {3766140031.0,  2415576579.0,  2014031032.0,  3999759734.0,  2267549361.0,  2110343263.0},
-  {3417766219.0,  3434328348.0,  2248776133.0,  3135524220.0,  2277032306.0,  4065264594.0},
-  {2331039663.0,  3102359018.0,  1702210111.0,   987534746.0,   829619678.0,  1998369965.0},
-  {4288045355.0,  3694126179.0,  3421672231.0,   316871802.0,  4203880182.0,  1042846879.0},
-  { 897267819.0,  2534888005.0,  2985588767.0,  1501852868.0,  2372366793.0,  2998976816.0},
-  {  98698129.0,   570650960.0,  3225804657.0,  4280540570.0,  2206748131.0,  1624608733.0},
-  {1834419283.0,  3860411400.0,   988408843.0,  3352274100.0,  2701593797.0,  1852458046.0},
-  {2638002685.0,   314142769.0,  1738129003.0,  2122055333.0,  3077797613.0,   208429799.0},
-  {2133602088.0,  3486029183.0,  4186726775.0,  1832742487.0,  2012126366.0,  1778776330.0},
-  { 992252581.0,  3048856569.0,  1771100171.0,   766268999.0,  3353857647.0,  2447572409.0},
-  {2847547057.0,  2035430143.0,  1158649231.0,   233155130.0,  2091066182.0,  4083528428.0},
-  {  25817712.0,  2082037169.0,  3402265511.0,  1466721712.0,  1170281096.0,  2896093164.0},
-  {2258787200.0,  2966196589.0,  1590317073.0,  1215342692.0,  1501506849.0,  4081525459.0},
-  {3900346518.0,  2401920236.0,   981469851.0,  2893681515.0,  1385104648.0,  4283557676.0},
-  {1756379213.0,   262581932.0,  3590455964.0,  3263928615.0,  2917801851.0,  3369376546.0},
-  {2613679187.0,  4266977202.0,  1855873790.0,  4173973080.0,  3758433811.0,  3574837805.0},
-  {2926550148.0,  2609910340.0,   270147629.0,  2196952350.0,  3404250741.0,  3651868094.0},
-  {2051824051.0,  3172101796.0,  2962779715.0,  3188990576.0,  1466284897.0,  3871617146.0},
-  { 299924896.0,  3591368497.0,  3451482452.0,  1066611638.0,  3696484175.0,   699068153.0},
-  {1138250114.0,   882385976.0,  2054792963.0,  3580006041.0,  2144916547.0,  2457660707.0},
-  {2634645680.0,    95930206.0,    11717045.0,  2751055838.0,   735778002.0,  1158910163.0},
-  { 299010185.0,  2341687219.0,  2153421587.0,  3732685422.0,  3258304099.0,  2997386625.0},
-  {2377307088.0,  3467556012.0,   878835353.0,  2600450311.0,  3638103516.0,   372985399.0},
-  {1767992101.0,   210222674.0,  4031734533.0,  2219406418.0,  2394832189.0,  3513936414.0},
-  {3758412971.0,  3002311471.0,  3753613671.0,  3438612529.0,  1651935064.0,  2836379045.0},
-  {3384126758.0,  3493480623.0,    67108297.0,   820974729.0,  1398340672.0,  4116426643.0},
-  {3649846542.0,  2980773232.0,   562083853.0,  1361859759.0,   383438486.0,   237047123.0},
-  {  74387434.0,  1317977362.0,  4264210363.0,  4080919746.0,  1966469874.0,  2511673943.0},
-  {2549025971.0,  1255462040.0,  1037740160.0,  2971983518.0,  3012054793.0,  3545864979.0},
-  {3327957837.0,  3319075762.0,  1584044276.0,  2695600465.0,  2362829255.0,  3417332982.0},
-  {2215133596.0,  3605107291.0,  3936179281.0,  3227631768.0,  3665760785.0,  3638110295.0},
-  {1423415658.0,  4246847184.0,  4102746635.0,  2249393109.0,  2952271032.0,  2345173648.0},
-  {3989716949.0,  2951508528.0,  2445377985.0,  1666888859.0,  3828303699.0,  3545525293.0},
-  {3946688715.0,  3185410637.0,  2214600125.0,  2811700180.0,  1248055894.0,  1813167325.0},
-  {1267943871.0,  2863300804.0,  1559346929.0,  3905047605.0,  3818844515.0,   329589444.0},
-  {1436473155.0,  2695122825.0,  2617583404.0,   163276195.0,  1554947623.0,  1281475971.0},
-  {3580546558.0,  1306243548.0,   589031318.0,  3205366805.0,  1634994077.0,   574070365.0},
-  {3317620758.0,   700240900.0,  1727080012.0,  3986847443.0,  2027867463.0,    49483132.0},
-  { 220408240.0,  3030706951.0,  2108156345.0,   678037442.0,  3724589992.0,  3460205352.0},
-  {4263226589.0,  3737768093.0,   729394726.0,  3420494167.0,  2514527340.0,   507684421.0},
-  { 705588054.0,   650216691.0,  2935529918.0,   882788420.0,  2669449377.0,  3550573996.0},
-  {1611539218.0,   195060361.0,  1642733128.0,  3658134989.0,   271607939.0,  3659242158.0},
-  {2093756680.0,  4040201757.0,  4149311422.0,  1374481490.0,   569059581.0,  3129479746.0},
-  {3619233700.0,  3514687313.0,  1015522357.0,  1782384639.0,  2371946183.0,  3973165040.0},
-  {2870834408.0,  1911487276.0,   721425747.0,  1338501364.0,  1973218275.0,  1253119475.0},
-  {1781746597.0,  2185044110.0,   293613149.0,  3777806319.0,   610252693.0,   105391918.0},
-  {1813792170.0,  2242791832.0,  2499963472.0,  3107534512.0,  3030930032.0,  2981373317.0},
-  {3644411262.0,    94079282.0,  1286742175.0,  2430153157.0,   227450494.0,  1742167392.0},
-  { 400521957.0,  2443473110.0,  1769109646.0,  3054743574.0,  3419060774.0,  2442169665.0},
-  { 349136974.0,  2318751847.0,  2130017378.0,   305464158.0,  1177231913.0,   266943174.0},
-  {2534516661.0,  3392823319.0,  2126521932.0,  1644640541.0,  2064925845.0,  1553045961.0},
-  { 724343775.0,   387985717.0,  1695770431.0,  2804457130.0,   565902390.0,  3172476973.0},
-  {4186982437.0,  1154940371.0,  1260266261.0,   639557537.0,  1655897808.0,  3249007092.0},
-  { 304159440.0,  3648839862.0,  2306796913.0,  2688401614.0,  2309870995.0,  3780281090.0},
-  {1705984318.0,  2928035721.0,  2141298994.0,  2009413486.0,  3026081896.0,  2326885496.0},
-  {4137086655.0,  3843621170.0,  4276905134.0,  3535377689.0,  2848158245.0,  1334661151.0},
-  {4056775242.0,   895783968.0,   190377463.0,  1576148997.0,  1490855151.0,  2115313549.0},
-  {1397194254.0,  3886098269.0,  4086487968.0,  1223422395.0,  3606298332.0,  2598119715.0},
-  {1505964592.0,  2665332243.0,  3802036536.0,  4233544677.0,   462584594.0,  4090876717.0},
-  {1241447957.0,  2910541633.0,  3940264711.0,  1428892809.0,  3606337797.0,  3562300366.0},
-  {2635564024.0,  1773894898.0,  3514969562.0,  2948358395.0,  3080086616.0,  2296244080.0},
-  {2663115450.0,  3713504510.0,  2915612769.0,   760594097.0,   650689730.0,  3987397253.0},
-  {1410839028.0,  4122037990.0,  2668057703.0,  2499758233.0,  1495150061.0,  2035042479.0},
-  { 257775522.0,   257622138.0,  4218635429.0,   447259957.0,  2513457292.0,  1369199738.0},
-  {1951948313.0,   523367094.0,   629394432.0,   507296377.0,  2183051817.0,  3081225209.0},
-  {1169340298.0,  2348645308.0,  2560583614.0,  3607568543.0,  2428615416.0,  4291009664.0},
-  {1731942225.0,  4177502351.0,  2659177563.0,  1279419273.0,  2922781572.0,  1092485994.0},
-  {2375599526.0,  2244332900.0,   668196502.0,  3003949408.0,  3092989159.0,  2652270976.0},
-  {2747382011.0,  3905979837.0,  1690552725.0,  3015500566.0,  3327900984.0,  1012833176.0},
-  {1601987798.0,  2609097575.0,  4219991923.0,  1567116609.0,   766375144.0,  2574956695.0},
-  { 560885991.0,  1888395999.0,  2671905266.0,   851641468.0,  2975871667.0,  1384539381.0},
-  {2074349076.0,  3362039940.0,   538133734.0,  1767176271.0,  1552792325.0,  1402367902.0},
-  { 592881871.0,  3108395663.0,   998989477.0,   276966024.0,  3448139625.0,  2749170572.0},
-  {2023593900.0,  2558167340.0,   474831752.0,  2189627643.0,   307660081.0,   246793281.0},
-  {3330843138.0,  2125681987.0,  1114252980.0,  2132026618.0,  2073702404.0,  4209894563.0},
-  {1453868641.0,  1094715599.0,   437926163.0,  3520200411.0,  2149804521.0,  1840036768.0},
-  {1183262234.0,  3962679442.0,  1979551141.0,  3267032420.0,  2985575098.0,  2049206270.0},
-  {4243865326.0,  4140583827.0,  2320676874.0,   959057901.0,  3514644256.0,   137380429.0},
-  {3463266142.0,  3037313138.0,   687188213.0,  3188262200.0,  1823494834.0,  3653042247.0},
-  {3092990470.0,  1319253913.0,  3974322245.0,   159510393.0,  2483231141.0,   474702100.0},
-  {2309553868.0,  1997246356.0,  2565099702.0,  3835186742.0,  3583276434.0,  3809936252.0},
-  {3945414587.0,   713655473.0,  1460527425.0,   223617910.0,  1055655316.0,  1738775643.0},
-  {3383891637.0,  3866079408.0,  2878643955.0,  3146407462.0,  2523940415.0,  1415507550.0},
-  {1042409759.0,  4241165358.0,  2314378522.0,  2456911609.0,  2968655434.0,  1349599111.0},
-  { 703693032.0,  2268029257.0,  2979603541.0,  2638927411.0,  2347879434.0,  1507240816.0},
-  { 205338661.0,  2143821007.0,  1246011160.0,  1363259726.0,   413215804.0,  1538079862.0},
-  {4212654710.0,  1339838568.0,   958209795.0,  3775399992.0,  3474060340.0,  2224191699.0},
-  {2847238646.0,  1556123542.0,  1306375013.0,  2496087862.0,  3806067477.0,   602262875.0},
-  {2525551886.0,     8332078.0,  2777950485.0,   356937771.0,  3082261692.0,   515619797.0},
-  { 533458976.0,  2889432872.0,  2094435919.0,    82103650.0,  2471006436.0,   517010711.0},
-  {1232293137.0,  1311562353.0,  2121599857.0,  2947598351.0,  3527336545.0,  2445546855.0},
-  {3271806097.0,  1630281731.0,  3308307049.0,   508313060.0,  3749759141.0,  3976348168.0},
-  {2836400161.0,   366149236.0,  4192357346.0,  3111893180.0,  1131479117.0,  1516520642.0},
-  {4286806749.0,  1092966544.0,  1344589014.0,  2349506567.0,   293948767.0,  2016953493.0},
-  {1101246577.0,  1884211694.0,  2614351713.0,  2529829096.0,  1653893622.0,  1112771856.0},
-  {3459839475.0,  1066795605.0,  1394070654.0,  3766656959.0,  1629064142.0,  3362086685.0},
-  {4256952326.0,  1278084525.0,  1589345124.0,  3014575418.0,  3290009099.0,  2426524329.0},
-  {1888696863.0,   688589033.0,  1322828382.0,  1865253168.0,  3908870673.0,  3655752847.0},
-  {2809843025.0,   554759434.0,  2672021621.0,  1778846305.0,   785841793.0,  3484097370.0},
-  {3199531668.0,  2722325168.0,  1638027063.0,  2941376716.0,  2617936992.0,  3176750105.0},
-  {3673671845.0,   183520853.0,  2333114700.0,  4221752214.0,   992818965.0,  1935014072.0},
-  { 630635618.0,  1171938283.0,  3128688985.0,  2168121115.0,  3494626767.0,  2062714791.0},
-  {1983124148.0,  3421286272.0,  3854662865.0,  4137045710.0,   488714903.0,   925472433.0},
-  {4199773210.0,  1933070616.0,  2259605870.0,  1116021153.0,   813347872.0,   109466923.0},
-  {3315050213.0,  4186153720.0,  3153387190.0,  1486804560.0,  4203377601.0,  2123311451.0},
-  {3792778157.0,  1993380592.0,  3247643022.0,  2139230199.0,   588132527.0,  2423822794.0},
-  { 862776858.0,  1956944546.0,   654141610.0,  1496246341.0,  4254871534.0,  3192228233.0},
-  {4100796563.0,  4205003380.0,  1727727353.0,  2887194190.0,   324584559.0,   126207505.0},
-  {2565173733.0,   964323116.0,   508188717.0,   931529299.0,  3806733677.0,  1791031516.0},
-  {3036460645.0,  2639707572.0,   298459178.0,  2989065994.0,  3103991207.0,   273109756.0},
-  {4019461000.0,  2165969423.0,  1192375489.0,  4196597609.0,  1462496870.0,  1731042575.0},
-  { 174166846.0,  1657794740.0,  4211500499.0,   592307913.0,  1023823441.0,  3510605644.0},
-  {1826879738.0,  1640132312.0,  2101084111.0,   834868292.0,   675498652.0,   948596657.0},
-  {3979944195.0,  4266354357.0,   289237148.0,   216289671.0,  3806486995.0,   445485256.0},
-  { 775397058.0,  3979628182.0,  3210903894.0,  4153186795.0,   695449344.0,  1499365712.0},
-  {  23065511.0,  2526419494.0,  1127706280.0,  3778844638.0,  3625700765.0,  2790176850.0},
-  {3301603850.0,  3390353474.0,   303583579.0,  4059339602.0,  2033488037.0,  4256271169.0},
-  {3387644545.0,  3111341664.0,  1723589650.0,  2050554360.0,  2917082044.0,  2478862138.0},
-  {3670677047.0,  3735090977.0,  3158176504.0,  2397955111.0,  1471599417.0,  2198659845.0},
-  {1335791675.0,   819865523.0,  3043139676.0,   196934363.0,  2791674909.0,   257272418.0},
-  {1021115490.0,  4026693158.0,   367841895.0,  1582953139.0,  2443624194.0,  1565995091.0},
-  {2460095533.0,  2384992762.0,  2834378568.0,  3964480376.0,  3554029217.0,  1508511160.0},
-  {1670366370.0,  1352551957.0,   724138308.0,  2063911879.0,   179031828.0,  2907944294.0},
-  { 812538047.0,  2389021060.0,  3810623446.0,  3422541911.0,  2255422833.0,  3610863262.0},
-  { 592806125.0,  1396371812.0,  4209787601.0,  3317206559.0,   427984777.0,  3161520408.0},
-  {1242028577.0,  3711443793.0,  3260155319.0,  4091820974.0,  1545972312.0,  3104883555.0},
-  {1024941743.0,  1022387988.0,  2363165221.0,  2830995270.0,  1884170222.0,  2608025209.0},
-  { 954815600.0,  2739908479.0,  1659944017.0,  1842556492.0,  3210468565.0,  2391964524.0},
-  { 759561183.0,   861891716.0,  2257325103.0,   960688442.0,  2767431770.0,  2563518220.0},
-  {2719943774.0,  1035660794.0,  4005865975.0,  1823867581.0,  2150175013.0,  2097888319.0},
-  {2240023297.0,  2739797405.0,  1269849300.0,  3098825978.0,  3172442441.0,   620925863.0},
-  {2213021746.0,  2430787452.0,   684807399.0,   505783502.0,  2108646056.0,  2047977627.0},
-  { 464272143.0,  2715976811.0,  1889125166.0,  3733018033.0,  3930073692.0,  3524075009.0},
-  {2044112570.0,  1309370521.0,  1576047956.0,  2047034992.0,    46841229.0,  1950643409.0},
-  {2304351210.0,  2190259549.0,  2059156108.0,  3231625757.0,  2412904271.0,  3352832666.0},
-  {2433153534.0,   532977135.0,   700898221.0,  2475029990.0,  3089595102.0,   345961173.0},
-  {2714871381.0,   414726147.0,  1984663513.0,   953184833.0,  1559907535.0,   284547384.0},
-  { 896730376.0,   579046243.0,  1594483836.0,   589696740.0,  2520928170.0,  3748586013.0},
-  { 859745901.0,  2473636318.0,  2277780827.0,  3383665228.0,  3603236116.0,  2536151205.0},
-  {4244933742.0,  2370910330.0,  1481537639.0,  3167047478.0,  1936906017.0,  3878864533.0},
-  {3884517828.0,  2767179497.0,  2486328486.0,  2260029379.0,  1398716959.0,  2624614805.0},
-  {1625486033.0,  3373340652.0,   232680497.0,  1707623621.0,  2403000817.0,  2780326539.0},
-  {3068296524.0,  1531938141.0,  3885553811.0,  2743327142.0,   306690244.0,  1832539015.0},
-  { 129250188.0,    34318231.0,  1382443952.0,  1574789119.0,  1476408625.0,    14036364.0},
-  {1692340139.0,  2272883022.0,  3516866067.0,  1756441241.0,  2723957437.0,  3608024821.0},
-  {2096455372.0,  1039560643.0,  1058649428.0,   640039495.0,  2452400504.0,  3547520235.0},
-  {2728907051.0,  4037906161.0,  4057985699.0,  3975350106.0,  2556491317.0,  2952365482.0},
-  {2049065236.0,  2015248372.0,   256777047.0,  1832779683.0,  1045802840.0,   958876844.0},
-  {2548728294.0,  3834827024.0,  1114567317.0,  2533819780.0,  4259012616.0,   280420059.0},
-  { 203374273.0,  2265326916.0,  3858800139.0,  2702753053.0,  3808346569.0,   253129348.0},
-  {3395101655.0,  3872638032.0,  3904571899.0,  1511026249.0,   560807695.0,   350425436.0},
-  {3105222063.0,   404789048.0,  3540140244.0,  3996689118.0,  3220099939.0,    20606138.0},
-  { 505595979.0,  1542451676.0,  4103959495.0,  2152910741.0,  2781632387.0,  1076977097.0},
-  {2138737173.0,  2854526981.0,  1619821162.0,  3616703868.0,  2004439439.0,  3340990273.0},
-  {2531654973.0,  3670909829.0,  3727945960.0,  3005246837.0,  3620117618.0,  2376326916.0},
-  {1809903733.0,  3964655457.0,  4201718297.0,  2124876718.0,  3120160676.0,  3527662192.0},
-  {1544446026.0,  1553589409.0,   185410553.0,  2180640399.0,   567398936.0,   924939669.0},
-  {1720402281.0,   882945387.0,  2988817344.0,  2276315296.0,   116028293.0,  3818638379.0},
-  {2930152963.0,  4003329384.0,  2283738399.0,  3980309423.0,  3856852145.0,  2043171568.0},
-  { 690636436.0,  3160530803.0,   964911626.0,  1394519011.0,  2074087448.0,  2420893404.0},
-  {3755454172.0,  4173816519.0,  2188647219.0,  2696707567.0,  3727571965.0,  2689373299.0},
-  {2895487624.0,  2399079148.0,  3038388937.0,  3161276522.0,    89556277.0,  1929473595.0},
-  {2832007234.0,  2828518583.0,  1809282135.0,   159150215.0,  3180574197.0,  3726541935.0},
-  {1651917134.0,  3606451007.0,  3808586388.0,  4111994695.0,  1274819360.0,    71915214.0},
-  {2261458078.0,  1312810542.0,  2766279586.0,  3544363243.0,  2079108076.0,  1586143912.0},
-  {4221836838.0,    94144684.0,   765688510.0,  2747160251.0,  1775898924.0,  2589813759.0},
-  {1759024192.0,  3215765988.0,  3141425261.0,   402786959.0,  4245967089.0,   593992195.0},
-  {2737737062.0,   198994532.0,  2460322229.0,  2400070206.0,  4024520493.0,  2844787921.0},
-  {2889939596.0,  2892076132.0,  3871342309.0,    99415642.0,  3828489341.0,  1985189114.0},
-  {2119114529.0,  3778404044.0,  3451891414.0,  4268205667.0,  4214330269.0,  3999356574.0},
-  {3990679386.0,  2504982315.0,  2785456071.0,    36214366.0,  2393622087.0,  3428662609.0},
-  {3745114983.0,  4030104369.0,  3978756263.0,  3342932869.0,  4246357704.0,  2591951565.0},
-  {2470059171.0,  4005433417.0,  1991188429.0,  1375829027.0,  2356716092.0,  2724561887.0},
-  {3549346240.0,   762898826.0,   949159286.0,  1106914760.0,  4101527238.0,  2398215692.0},
-  { 739415353.0,   343780066.0,  2287917014.0,  2613590017.0,  3750598144.0,  2841510091.0},
-  {2276267827.0,  1896545299.0,  2112560264.0,  2574860005.0,  3751550457.0,  1246734402.0},
-  {1930339934.0,  1688009749.0,  2600394077.0,  2766401199.0,  3716885225.0,  2438748659.0},
-  {3077976849.0,   917105241.0,   738770674.0,  3540976060.0,   170731943.0,  3213509464.0},
-  {1897950012.0,  2831857827.0,  3315389685.0,  3598306773.0,  2233127828.0,  2755511871.0},
-  { 285647165.0,  3871784095.0,   692679828.0,  3680709520.0,  3336155431.0,    51267431.0},
-  {1915052076.0,  1021909701.0,  2841430023.0,  2413672739.0,  1551751950.0,  2410433064.0},
-  {3833298316.0,  1486094454.0,   110472800.0,  2317100709.0,   524951374.0,   856031695.0},
-  {2394842532.0,  3961838792.0,  3654423934.0,  1783094643.0,   275919428.0,  1256556724.0},
-  {1625994343.0,  1244852737.0,  1870936249.0,  3101418233.0,   230063315.0,  1760348026.0},
-  {1598777022.0,  3256132191.0,  3055753884.0,  3962659419.0,   770535466.0,  1419080562.0},
-  {1788814600.0,  3943410287.0,   571402740.0,    42521150.0,  1949043836.0,   873816821.0},
-  {1707010885.0,    90655999.0,  3694125649.0,   132343370.0,  1782717352.0,   766032737.0},
-  {  87046168.0,  3240704950.0,  1668755447.0,  3418462805.0,   967752254.0,  1482869106.0},
-  {2458425789.0,  1662468508.0,  2941240219.0,  1269496496.0,  2526878525.0,  2201307595.0},
-  { 330632007.0,  1930291695.0,  2256996414.0,  2441385288.0,  1687991044.0,  3157147882.0},
-  {4028587388.0,  1235711990.0,  2366747806.0,  2404613980.0,  3467099190.0,  2225833178.0},
-  {1288873229.0,   502399802.0,  3429112764.0,   468547991.0,  3731947068.0,  2387552587.0},
-  {2553278748.0,  2828587753.0,   445686825.0,   205701914.0,  1574271647.0,  1136620139.0},
-  {1119425437.0,  3756204856.0,  4222083974.0,  2545703267.0,  2912285150.0,  1922532562.0},
-  { 824397469.0,  2416558849.0,   486377771.0,  1690073170.0,  1203698413.0,  1552444578.0},
-  {2472980962.0,   630469293.0,   151770659.0,  2608036343.0,   732185163.0,   566287260.0},
-  {1119438728.0,  2078413788.0,   140314147.0,  3691381203.0,  2447647335.0,  1263417118.0},
-  { 834684812.0,  2820809336.0,   102322906.0,  3481159322.0,  1537399463.0,   204506013.0},
-  { 546021433.0,  1907956265.0,  2019510351.0,  3867315516.0,  2111631804.0,  1563826891.0},
-  {  24795400.0,  3367715022.0,  3653171640.0,  1797919332.0,   626105930.0,  3733441534.0},
-  {2827971527.0,  2556259128.0,  2008630208.0,  1418576776.0,  1553664837.0,  1167022698.0},
-  {2083251496.0,  4083066030.0,  1285240746.0,     6886774.0,   881028869.0,  2747662968.0},
-  {1450472752.0,  1712948548.0,   902840212.0,   264910203.0,  1140653556.0,  1468293996.0},
-  { 804243833.0,  1559758066.0,  2132312462.0,   531270208.0,  1617765994.0,  3265290993.0},
-  {4061719038.0,  2570579703.0,  1263026470.0,  2243861932.0,  3482440149.0,  3101822050.0},
-  {2123240533.0,   518115300.0,   651833508.0,  2315054727.0,  1928793097.0,  3843972246.0},
-  {3682030756.0,   177022633.0,  1985324556.0,   797353829.0,  2759051624.0,  3981333057.0},
-  {1595805034.0,  3086728970.0,   113840689.0,  2132113286.0,  1214855778.0,  2712528344.0},
-  {1876820026.0,  2710829033.0,  3157518537.0,  1474342948.0,  1186152535.0,  3385424725.0},
-  { 668544159.0,  3005510258.0,  2320601972.0,  2827025428.0,  4154913498.0,  2819296907.0},
-  {3237089617.0,  3655652050.0,  3294124969.0,  2538001511.0,  1432541735.0,  2078720238.0},
-  {1592252615.0,  2518809977.0,  1188678784.0,   404805369.0,  2765211383.0,  3442796774.0},
-  {4248898599.0,   206357856.0,   513647349.0,   585670091.0,  2545667317.0,  1436022449.0},
-  {1967670889.0,  1266393855.0,   109552201.0,  2778267144.0,  3665597169.0,  2442095028.0},
-  { 682752089.0,  1715343856.0,   888180957.0,   283622017.0,  2057883249.0,   587496007.0},
-  {3925129777.0,  3837234244.0,  1008751677.0,  2366056894.0,  1774532653.0,  1772231842.0},
-  {1549535979.0,  1512270779.0,  3849659821.0,  3849489403.0,  4027693670.0,  2208554929.0},
-  {1321344760.0,  1275508794.0,  2506993331.0,   938761718.0,  1005178777.0,  4148252633.0},
-  {3724269568.0,  1548131939.0,  2408646448.0,  1975139857.0,   264530064.0,   840385007.0},
-  { 817147243.0,  1363159516.0,  2222885973.0,  1529316543.0,  1694264873.0,   966721104.0},
-  {4087742352.0,   586941035.0,  1898423875.0,   138264481.0,   469690974.0,   321231519.0},
-  {    211891.0,  1741354035.0,  1342393242.0,   708890144.0,  2108027264.0,  1687548485.0},
-  {3805442454.0,  1925016232.0,  2899167471.0,  1127563304.0,    84863557.0,  1561558668.0},
-  {3273767952.0,  3574643582.0,  3035104458.0,  3170078453.0,  2568567922.0,  2995802703.0},
-  {2861008767.0,  3193995081.0,  3248419357.0,   802307804.0,  1359841054.0,   601264535.0},
-  {2101490796.0,  2686659099.0,  1694668332.0,   945173201.0,  3756545699.0,  2058029805.0},
-  {1838197421.0,   138610489.0,  2090827805.0,   297532831.0,  1673380494.0,  2902537001.0},
-  { 304129688.0,  1282320303.0,  1125499546.0,  3390276313.0,  3987592409.0,  2031707447.0},
-  { 482988466.0,  1838128643.0,   558548393.0,  3601190831.0,  3758698701.0,  3827088520.0},
-  {1447243485.0,    90103016.0,  3614914203.0,  2157818223.0,  1914920674.0,  4012515147.0},
-  {2317733826.0,  3751763647.0,  3457545986.0,  3863296407.0,  3013786025.0,   857127886.0},
-  {4014117485.0,  3092488316.0,   860594544.0,  2381419416.0,  1906913399.0,   772004930.0},
-  {2605137037.0,   994561415.0,  2836939003.0,  2564858611.0,   802608050.0,   365408022.0},
-  {4273312872.0,  3717803597.0,  2370420519.0,  2232882309.0,  1705970272.0,  1421085410.0},
-  {3847916722.0,   507892276.0,  1063203550.0,  1745465965.0,  2177898362.0,  1688793534.0},
-  {2695575565.0,  2298619094.0,  1985871933.0,  3338053676.0,  1157978550.0,  2013358236.0},
-  { 614082689.0,  2176571073.0,  2867075734.0,   302967377.0,  1762647499.0,   242423810.0},
-  { 849897841.0,  1256714738.0,  3749652689.0,   681076041.0,  3324792036.0,  2760772146.0},
-  {2080168813.0,  1676149829.0,    96119419.0,  3303269249.0,  3293814111.0,  3823857247.0},
-  {2091154525.0,  2838943151.0,  3517299708.0,  2874697681.0,  1508835268.0,  2826207965.0},
-  {1200450524.0,  2607668406.0,  4171258380.0,   751677966.0,  2131666623.0,   166462405.0},
-  {1998918161.0,   847900446.0,  2648112816.0,   302711426.0,  1711818945.0,  3078257741.0},
-  { 276956484.0,  1882278028.0,  3722014694.0,  1602507069.0,  1655261645.0,  1299031364.0},
-  {4017171943.0,  2491286883.0,  3544835558.0,   320186889.0,  2305864923.0,    81412519.0},
-  {3990194960.0,  1520576411.0,  4097947505.0,  1283166405.0,   902771217.0,  2919713968.0},
-  {1768868683.0,  4199774116.0,  2705926482.0,   145577526.0,   413212043.0,  1115074987.0},
-  {1753537788.0,  3765249182.0,  2996648591.0,  2669099697.0,  1940439434.0,  3297063547.0},
-  {4214706014.0,  1554767796.0,  2809756869.0,  2145015519.0,  3716649245.0,   657008234.0},
-  {3934294608.0,   506965443.0,  1038921107.0,  3753966341.0,  1585039654.0,  2347032494.0},
-  {1398792984.0,  1620096886.0,  1458263010.0,  4162878257.0,  2834006827.0,  3337589054.0},
-  {3810063338.0,  2508345952.0,  2128752929.0,   203682913.0,   459894409.0,  3146442226.0},
-  { 571544715.0,  3423424747.0,  2203102845.0,  1576705116.0,  2283630052.0,  2419689236.0},
-  {1454213374.0,  4261328302.0,  1084697160.0,   752820920.0,  3292913624.0,   255838870.0},
-  {1547311873.0,  4112431501.0,   246100285.0,  3098089663.0,  1194930898.0,   192713017.0},
-  {1643408966.0,  3943807104.0,  1257163166.0,   294466665.0,   664862507.0,  3954216318.0},
-  {1654764661.0,  1405033907.0,  2404459756.0,  1864068119.0,  3753017035.0,   458943330.0},
-  {2188502505.0,  2837578167.0,  3180423984.0,  3622618825.0,  2248002659.0,  2962062274.0},
-  {2538576443.0,  1414694921.0,  3326978756.0,  2534096740.0,  1367100663.0,   918951629.0},
-  {3578583593.0,  1036715512.0,  2331400326.0,  4263556013.0,  1927627583.0,   835018748.0},
-  {3931914007.0,   414906550.0,    14063203.0,   847567707.0,  2702788791.0,  3392917259.0},
-  {3736622244.0,  3259435108.0,  1134426843.0,  4218222257.0,  4093240909.0,  2452690878.0},
-  { 348682961.0,  1602454277.0,   905998141.0,  1063070569.0,   937781073.0,  2454486058.0},
-  {3753315288.0,  2003200997.0,  2039219609.0,  3506946010.0,  3621355464.0,  3799456282.0},
-  {1764253144.0,   317478767.0,   741471913.0,  1521058643.0,  2831081701.0,  2941376445.0},
-  { 864403440.0,   404030689.0,  3601955781.0,  2346190099.0,  1125489296.0,  2944078161.0},
-  {2922471368.0,   564483943.0,  2007623335.0,  4013727103.0,   903390159.0,  3516025674.0},
-  {2095419632.0,  3528484636.0,  2515838591.0,   787044158.0,  2052294221.0,  1055085172.0},
-  {1907524414.0,  1834546605.0,  2526229378.0,  2562555277.0,  3545412232.0,  2488671220.0},
-  {2073893566.0,    61897607.0,  1329221139.0,  2091552927.0,   884201005.0,   247201254.0},
-  {2514700342.0,  4092795525.0,  2234964848.0,   892418395.0,  1284581365.0,  3131871063.0},
-  { 476963689.0,  2818170738.0,   111968275.0,  2773521413.0,   435281708.0,  2683712230.0},
-  { 276153915.0,  2760865572.0,  2559966407.0,  3911200904.0,  3151287291.0,  2734982772.0},
-  {1462998075.0,  3841141927.0,   815069390.0,  1378992995.0,   787238713.0,  3341259540.0},
-  {2435499394.0,  1005853150.0,   369843346.0,  3484923021.0,   986314131.0,  1749826411.0},
-  {4119326132.0,  3563716202.0,   817280871.0,  1060361180.0,   150574112.0,  2147462923.0},
-  {2380756953.0,  1094488658.0,  1303011102.0,  3414160159.0,  2637427552.0,  1988533969.0},
-  { 256758437.0,  1328765981.0,  3462241958.0,  1706864370.0,  3859983375.0,  1666242098.0},
-  {1587586413.0,   193971777.0,  2212514309.0,  3635538955.0,  4200093262.0,  2816529871.0},
-  {1813099288.0,  1902783289.0,  1855737723.0,  1512138162.0,  3251662863.0,  3363779231.0},
-  { 210387349.0,  1029944161.0,  3324276210.0,   415484285.0,  3765303940.0,    73214995.0},
-  {3635028892.0,   747606592.0,   836098373.0,  2211099989.0,  3746542547.0,  1184804368.0},
-  { 552920387.0,  2097614431.0,  2812862862.0,  3959291099.0,  3409372754.0,   599912004.0},
-  {2520997787.0,  1559322077.0,  2362817058.0,  1788767982.0,  1739480900.0,  1022333552.0},
-  {1265019197.0,  1171453839.0,  4024801380.0,  3708567451.0,  1125950510.0,  1595308714.0},
-  { 707170236.0,   267892161.0,  1518084541.0,  2940465764.0,  2846566133.0,    48969788.0},
-  {3748170320.0,  3006827957.0,  1344319874.0,  2336631966.0,   545166552.0,  1001527379.0},
-  { 347791768.0,  3981196582.0,   386394465.0,  1693777789.0,  3751224472.0,  3367441808.0},
-  {3694543083.0,  1867217735.0,  4289722530.0,  2393404853.0,  4110722414.0,  2273110327.0},
-  {1919891970.0,   732229507.0,   719300964.0,  1252331020.0,  2817192001.0,  4184753012.0},
-  {  20393486.0,  3434919653.0,  1384782509.0,   457241823.0,  1445554913.0,  2103145248.0},
-  {3927480783.0,  1442025978.0,  2670002124.0,  3813370170.0,  2091286413.0,  3917306067.0},
-  {3149416434.0,  2190235889.0,  1670982898.0,  3234574172.0,  3630863908.0,  2150085001.0},
-  {1188000138.0,  1674438880.0,  2767351478.0,  4249269399.0,   740020531.0,   194226396.0},
-  {2673581115.0,  2997291421.0,   315109965.0,  3151795615.0,  3112118581.0,  3913033755.0},
-  {3360942304.0,  1633642370.0,  2750691545.0,  2179184559.0,  1830137882.0,  3152385977.0},
-  {2297158710.0,  1807100626.0,  3270467895.0,  2748291641.0,  3069822107.0,  3027979794.0},
-  {2303220861.0,  1872247083.0,  1426952581.0,   783453887.0,  3304568478.0,  2349980393.0},
-  {1310316156.0,  3289582319.0,   152193776.0,  1653430731.0,    85301115.0,  1610069374.0},
-  {1276206695.0,  4044988955.0,  3036515649.0,  3600069517.0,  2898046516.0,  1720574984.0},
-  {1694301926.0,  3684371703.0,  1984891155.0,     7682943.0,   121477240.0,  2815953085.0},
-  {1165318681.0,  3224533256.0,  3254015153.0,  3094441671.0,  2958919608.0,  3744445221.0},
-  {1356335976.0,  2226815302.0,  3523732859.0,   394094735.0,  1276332046.0,  3313806337.0},
-  {3714484347.0,  2404580073.0,  3478941313.0,  3435363352.0,  1574279224.0,  4145524892.0},
-  {3937446847.0,  1658725608.0,  1215939581.0,  1160305612.0,  4193585761.0,  2670697794.0},
-  {1215448636.0,  3696910146.0,  3577508906.0,  2285204699.0,  1094019009.0,  1774417984.0},
-  {2773014753.0,  2780578512.0,   167556929.0,  3191595517.0,  3498391184.0,  3621579479.0},
-  {1787377121.0,  1655267109.0,  2670889204.0,   337454887.0,  3103865044.0,   266236416.0},
-  {3956103007.0,  3772131594.0,  2543751702.0,  2913282799.0,  1998793787.0,  3899383175.0},
-  {4209990664.0,  2514644822.0,  3282618224.0,  2333310294.0,  3964400714.0,  1377337537.0},
-  {3854078864.0,  3441506417.0,   968166473.0,    97356449.0,  1992601686.0,  1887893254.0},
-  {2964126005.0,   400203215.0,  3050265265.0,  3638107646.0,    67270256.0,  1309401077.0},
-  {2284327043.0,  2970675089.0,   494916098.0,   823319965.0,   746503141.0,  1553175162.0},
-  {2368529750.0,   446856423.0,   772653809.0,  4204703156.0,  1091263911.0,  1581075299.0},
-  {2862100189.0,   363318906.0,  3421952955.0,   327462976.0,  3028606014.0,   706485592.0},
-  {3937514256.0,  2219207545.0,  2349095757.0,  1341097236.0,  2087846763.0,  1980088089.0},
-  { 496589941.0,  2807572798.0,   938284830.0,  3538580800.0,  3054519977.0,  1128539402.0},
-  { 274258154.0,  3598334860.0,  3496325833.0,  3748485976.0,  3357588507.0,  2808504416.0},
-  {1077901877.0,  2928689426.0,  1351393954.0,  1628555273.0,  3237634344.0,  1742335582.0},
-  {2636815038.0,   231959587.0,  2687173944.0,  2265308984.0,  2354062787.0,    71785797.0},
-  {1641140471.0,    94486430.0,   259911346.0,  2220429906.0,  2268901008.0,  3753961207.0},
-  {3805388930.0,   742645209.0,  1160450193.0,  1941439992.0,  1633476882.0,   261574752.0},
-  {3583869129.0,  2121400996.0,  3962447723.0,  2666794277.0,  3226017133.0,  2988581564.0},
-  {2625127613.0,   492484515.0,  3312069227.0,  4146443120.0,  3245023798.0,  1239434858.0},
-  {2138781493.0,    93060495.0,   148101673.0,  1812649764.0,  1220175960.0,   227392536.0},
-  {2949810485.0,   892042943.0,  3465998606.0,  4145246801.0,  2042310072.0,   597677639.0},
-  {2818394550.0,  1032927727.0,     6711001.0,  2407672570.0,  2500767746.0,  1438461654.0},
-  { 329141737.0,  2244309434.0,  3854119119.0,   924328673.0,  1868866975.0,  3115887003.0},
-  {2042251095.0,  3131457142.0,  4282416942.0,  3169006944.0,  4152451978.0,  2556659276.0},
-  { 236422376.0,  2000726618.0,  2286684874.0,  1957638254.0,  2068149064.0,   483349051.0},
-  {3567291471.0,  2000658101.0,  3449544957.0,  1314055466.0,  3021408193.0,  3147877252.0},
-  { 924022315.0,  4115260415.0,  1949266599.0,  3980620819.0,  4045214956.0,  1155383332.0},
-  {3237244914.0,   172527555.0,  3043005441.0,  2194003139.0,  2549694589.0,  2444189361.0},
-  {3223122518.0,  2793488101.0,  3748048475.0,  2300459569.0,  1947657203.0,  1828803406.0},
-  {1332309267.0,  2447274759.0,  3420981337.0,   311842414.0,  3009263852.0,   606376730.0},
-  {3593522843.0,  2947003233.0,  4217956870.0,  2499200226.0,  1595052754.0,  3925250652.0},
-  {1704553591.0,  3539406798.0,  2808512439.0,  3598054629.0,   785061955.0,   127663086.0},
-  { 335090545.0,  1535811405.0,  1287567409.0,  2407419421.0,  4102806286.0,   155745541.0},
-  {  56713915.0,   209354168.0,  3426744943.0,   872924512.0,  2625543358.0,   504148253.0},
-  {3326759655.0,  1079693800.0,   722813774.0,  3418422852.0,  3503476361.0,  3679414347.0},
-  {2518473718.0,  3145153323.0,  2712054911.0,  2944591945.0,  3200427547.0,   275460486.0},
-  {1737696116.0,  2611554314.0,  1515565362.0,  1106632643.0,  1039874049.0,  3890329990.0},
-  {1275831182.0,  3911980916.0,  1632785495.0,   504702383.0,   731692145.0,   608133994.0},
-  {1656415597.0,  3448234407.0,  4073822244.0,  3619460486.0,  2244425341.0,  2707388385.0},
-  {1516225814.0,  3942032296.0,   148240834.0,  1796650203.0,   821201466.0,  2590677299.0},
-  { 247519678.0,  2902298989.0,  2355998065.0,  3135990695.0,  1607585136.0,   706961654.0},
-  {1867432653.0,  3176400121.0,  2384867365.0,  2058025324.0,  2702466824.0,  1871897007.0},
-  {1514968023.0,   659534180.0,  1632648571.0,  2513715916.0,  3707434747.0,  3472606057.0},
-  {2759630636.0,  2783831959.0,  3832789533.0,    93892302.0,   231725096.0,  3843329099.0},
-  {1236757823.0,  1290878160.0,    67405033.0,  3430485417.0,  4169502434.0,  4292262074.0},
-  {1412995811.0,  3749570751.0,   321171159.0,  4023912109.0,  3142136564.0,  2112199921.0},
-  {1443161505.0,  3709493928.0,  4023049229.0,  3893655047.0,  3102639941.0,  1385930009.0},
-  {3875211279.0,  4254404615.0,  2859104611.0,   658818110.0,  3959797804.0,  3110196558.0},
-  { 866122687.0,  3313426185.0,  3231485721.0,  3022340409.0,  4019688948.0,  1510693166.0},
-  { 562142689.0,  4269929599.0,  3899839012.0,  2719697175.0,  4273284952.0,  2177366693.0},
-  {1540994585.0,  1748628535.0,  4225444901.0,  1740630072.0,  1757079793.0,  1359760608.0},
-  {1927294381.0,  3918877466.0,   898264501.0,   152805874.0,  4270397499.0,  2388793023.0},
-  { 208516649.0,  1159511654.0,  2345624146.0,  2700833398.0,  1728655979.0,  2970910659.0},
-  { 321831138.0,  2513261002.0,  3158817632.0,   548848962.0,  3747010403.0,  4151524440.0},
-  { 701839829.0,  1403288631.0,  2055422031.0,   893209998.0,  2912457844.0,  3672565206.0},
-  { 704811999.0,  1124794448.0,  3516183460.0,  1758330402.0,   592662265.0,   765559082.0},
-  {1085731539.0,  4103114603.0,  4156395482.0,   411259576.0,   498030627.0,   155443403.0},
-  {2244520492.0,  2910412598.0,  1481795896.0,  4241773632.0,  2237020034.0,  3117066281.0},
-  { 744981119.0,   461482313.0,   660915978.0,   432619229.0,  3504103644.0,  2793472261.0},
-  {2769269715.0,  3434801616.0,  3947587393.0,  3943109712.0,  2131571133.0,    43827034.0},
-  { 221332762.0,  1961372074.0,   860148956.0,  2379176020.0,   708630942.0,  4010308873.0},
-  {3514518392.0,  1324219238.0,  2552209082.0,  3147700511.0,   449238468.0,  1070672072.0},
-  { 424110506.0,   437243633.0,   326823840.0,   280555021.0,  2587874155.0,    31540078.0},
-  {1598518743.0,   925313881.0,  4231941442.0,  2885179408.0,  4157519437.0,  3138864072.0},
-  {4212218458.0,  2818883859.0,   221476852.0,  1698341339.0,   430578679.0,  3025019161.0},
-  {2771085460.0,  3191744413.0,  3643367960.0,   728202977.0,  2846191061.0,  3941079866.0},
-  {1844407534.0,   713506037.0,  3904241368.0,  1863539380.0,  2307868432.0,  3912446738.0},
-  {3783960449.0,  1668771274.0,  3184653542.0,  3340516963.0,  3991449024.0,  2556572959.0},
-  {2208768792.0,  2338246571.0,   930305701.0,  3693415791.0,  3581316786.0,  2820575273.0},
-  {1874449618.0,  3071675829.0,  1026862196.0,  1704667772.0,  1302340100.0,   440904496.0},
-  {1614362313.0,  1296957884.0,  1510104030.0,   846701318.0,  2232418685.0,   156669424.0},
-  {1507370895.0,  4243781949.0,    22402579.0,  3841096049.0,  2713492596.0,  1180926356.0},
-  {1701475874.0,  2211010140.0,   103167136.0,  3701955201.0,  3682365312.0,  1072930351.0},
-  {1370633317.0,   730445161.0,  3094374496.0,  3293222623.0,   887252210.0,  3277905678.0},
-  {3037736840.0,  3453471630.0,   414222490.0,  3154616995.0,  1797572939.0,  3104961699.0},
-  {2898761938.0,  4028117281.0,   853896785.0,  4162634293.0,  3952897176.0,  4015398770.0},
-  {3909911726.0,  3122792549.0,  2304368768.0,  1948271262.0,    65066876.0,  1118398845.0},
-  {1521838080.0,  2466108265.0,  3936932588.0,  3196554451.0,  2448191224.0,  4104758602.0},
-  {1515958018.0,  2283219805.0,   659851559.0,  1835950617.0,  2849744905.0,  4034886096.0},
-  {2661020957.0,  3712161561.0,  2930297914.0,   563833320.0,  1274961737.0,  3465912073.0},
-  { 398653193.0,  4212431026.0,  2191641494.0,   791843104.0,  2704122410.0,  4212302944.0},
-  {3573396793.0,  2451959981.0,  1448882380.0,  1864903354.0,   277245740.0,  2161921499.0},
-  {4209537162.0,  2151212113.0,  1495661748.0,  1619965510.0,  2682253747.0,  1617332761.0},
-  { 385842876.0,  3479793961.0,     9682862.0,  1571765702.0,   849764095.0,  3392979260.0},
-  {3451300493.0,  3745423172.0,  1186197528.0,  3913825286.0,  2991930000.0,  2010750847.0},
-  {2690472989.0,  4169869242.0,   930063190.0,  2960080546.0,  2356173666.0,  4179805657.0},
-  {2325798283.0,  3313418282.0,  3863238644.0,  3956077957.0,  1732118681.0,  1559964723.0},
-  {3618410968.0,   117604305.0,  1554903813.0,  3923318061.0,  2383759714.0,  3419783191.0},
-  {1588149873.0,  1277964143.0,  2705676537.0,  4195614379.0,  3001312347.0,   891174066.0},
-  {2335405240.0,  1177595411.0,   757711067.0,  1458979012.0,  2978475955.0,   418977436.0},
-  {3709171844.0,  1319514762.0,  1030533605.0,  1377940685.0,  1238820097.0,  3942679605.0},
-  {1114098033.0,   261832302.0,  1147995283.0,  4226165699.0,  2938800031.0,   296072189.0},
-  {4089659578.0,  3791431823.0,  1668560680.0,  2247371041.0,  3147116212.0,  1754561725.0},
-  {1893756265.0,  2638591337.0,   712790657.0,  3349958239.0,  1803210297.0,  2784649251.0},
-  {1629280732.0,  3965769520.0,  4012735007.0,  2142570383.0,  2929658310.0,  3045926344.0},
-  {1722163110.0,  3760522608.0,   379587281.0,  3510272490.0,    50813060.0,  3446113378.0},
-  {2685452552.0,  2510212398.0,  2478703264.0,  1309810608.0,  2522401486.0,  1700285669.0},
-  { 999163958.0,  2626345584.0,  4213234379.0,   422849324.0,  1927536687.0,  2537506784.0},
-  {4208050980.0,  2360227923.0,  2150871407.0,  4083331601.0,  2317377066.0,  2953485083.0},
-  {2479411089.0,  2547267806.0,  4163681791.0,   605587577.0,  3607297469.0,   581236761.0},
-  {2396564518.0,  2076173946.0,  1924862597.0,  1107847812.0,    67847699.0,  1458072931.0},
-  {3318727873.0,  1073389189.0,  1423742946.0,  4130646429.0,   307824828.0,   984982409.0},
-  {3331527132.0,  1971780948.0,   951052068.0,  3071057510.0,  4173447399.0,  1708016892.0},
-  {  35727489.0,  3672679259.0,  1553509614.0,  1438233795.0,  2203903929.0,  2767488169.0},
-  {2432617549.0,  3749006092.0,  3240656572.0,  3422295764.0,  1824061812.0,  4206540576.0},
-  {4233939329.0,  3319874571.0,  2072751152.0,  2310173907.0,  2500828304.0,  2435674053.0},
-  {1008105551.0,   319639064.0,  1370748780.0,  1011201881.0,   447174109.0,  1768375582.0},
-  { 218376410.0,  3031026172.0,  3361612836.0,  2010704305.0,  2676383292.0,  2987943268.0},
-  {3465024910.0,   789098610.0,  2989632808.0,  3569080154.0,  1217107813.0,    89108291.0},
-  {1866208293.0,  2049795770.0,  2315537685.0,  4068743545.0,  3956293873.0,  3836850975.0},
-  {1971215869.0,   860913647.0,   715513525.0,  3653666495.0,  1163335865.0,  3977696592.0},
-  {2083094284.0,   981107631.0,   244298082.0,  4033056415.0,  3384576309.0,  4211203736.0},
-  {1609248403.0,  1798296052.0,  1609413725.0,  4184435501.0,  1730287655.0,  1323535720.0},
-  { 823712243.0,    48564123.0,  1456161775.0,  3278232329.0,  4040533425.0,  3021870443.0},
-  {2261838521.0,  1231856600.0,   356597007.0,  4230910213.0,   924105240.0,  2961154809.0},
-  {4170492308.0,  2581531594.0,  1333250171.0,   619214930.0,   801568342.0,   651282166.0},
-  {3698158445.0,  2186806062.0,  3330984675.0,  3495754344.0,  1447851777.0,  4113573806.0},
-  {3092147624.0,  4169798518.0,  2273802671.0,  2637225182.0,    69145495.0,  2433479146.0},
-  { 453714724.0,  4215847458.0,  3846212012.0,  2832692845.0,  2712649809.0,  1383973794.0},
-  { 946929817.0,   434785114.0,  3056838058.0,   177031459.0,  3379817759.0,   220850376.0},
-  {1766323703.0,  3822009479.0,  3679480158.0,  1890609468.0,  1405550077.0,  1554351791.0},
-  {3826522005.0,  1376091120.0,  1169804257.0,   614224027.0,  4140430174.0,    44757635.0},
-  {2787768648.0,  1427295646.0,   249239522.0,   856257961.0,  1135691710.0,  2516822699.0},
-  {3232327249.0,  2581343190.0,  4080870973.0,  3572645452.0,  2470260219.0,  3365164149.0},
-  {1616596035.0,  2359020236.0,   406723157.0,  2523084961.0,  2071519856.0,  1532719111.0},
-  {4138120178.0,  4188683526.0,  3439654640.0,  1871655280.0,  3924006352.0,  1092049192.0},
-  {1241604270.0,   805309636.0,  3771526783.0,  1374532928.0,    90551464.0,  4172002208.0},
-  {3806566691.0,  2535210384.0,   168417216.0,  3166873965.0,  2024618234.0,  3370594335.0},
-  {1682400689.0,   194261210.0,  3609468865.0,  2183378581.0,  3613639800.0,   259474474.0},
-  { 178242062.0,  3396613822.0,   696889306.0,  3258643533.0,  4001868149.0,  1532031130.0},
-  {3200262062.0,  3289110607.0,   618958757.0,  2460471441.0,  3602633741.0,  2107153358.0},
-  {2881373420.0,  1724218952.0,  3290466596.0,   333104145.0,  2295247705.0,  3543740199.0},
-  {1042750036.0,  2049037127.0,  2181822101.0,  1197263546.0,  2495598293.0,  3716977102.0},
-  { 313087204.0,  4088446978.0,  1998613040.0,  3312601455.0,  2878097284.0,  2655065141.0},
-  {2945495624.0,  4061767243.0,   246229157.0,   149159959.0,  3014934213.0,  2350936446.0},
-  {3795552868.0,  2497644924.0,  3648596074.0,  4030916745.0,  1222454884.0,   362576900.0},
-  {2556483554.0,  1026587911.0,  1537922180.0,  2368262184.0,   952053592.0,  4182490416.0},
-  {1977951023.0,  1356157215.0,  3587063932.0,  3972109573.0,   670953942.0,  2050433094.0},
-  { 945537214.0,  3586884690.0,  3884087719.0,  1270363069.0,   231597262.0,  4102896206.0},
-  {3292390928.0,  1169586793.0,  2985241169.0,   631720146.0,  2665145120.0,  3843322231.0},
-  {4016055875.0,   114454685.0,   985742782.0,    38387647.0,  1833544518.0,  2351549424.0},
-  { 462284279.0,  2388571632.0,   881661678.0,  1332691094.0,  3298846473.0,   350772557.0},
-  {3322206988.0,  1834622451.0,   925698691.0,  1223114873.0,  2739607997.0,  3526223592.0},
-  {3262692966.0,  3392322112.0,   132875725.0,  1739453389.0,  1706953443.0,  1667802773.0},
-  {2327889897.0,     2050004.0,  1840139363.0,  2525236816.0,  2349668607.0,  3136114355.0},
-  {1800400151.0,   511503837.0,  2745197853.0,  3097030275.0,   934771442.0,  1610284679.0},
-  {2444790737.0,  1986547091.0,   452731858.0,  3777164063.0,  3060026013.0,  1708866718.0},
-  {2762038515.0,  4043395865.0,  3670947718.0,  4199172175.0,  1379230039.0,   127547614.0},
-  {  69872068.0,  1484555969.0,  3698345532.0,  2576397201.0,  4271070423.0,  3057536977.0},
-  { 830536694.0,  1593460367.0,  2200251000.0,  4199662048.0,  2521034768.0,  1203551240.0},
-  {2317536025.0,  3356264106.0,   922814208.0,  2145729274.0,   810435371.0,  3084602356.0},
-  {3806340615.0,  1060505455.0,   600435799.0,  2648206428.0,  3911306340.0,   524813290.0},
-  {1453579591.0,  4185480305.0,   777156828.0,  2778147916.0,  4133806026.0,  2311377820.0},
-  {3457043041.0,  2047221003.0,   177300377.0,  4029989592.0,  1146287203.0,   179064306.0},
-  { 611275034.0,   232106735.0,  1448047320.0,  4140234161.0,  3548185425.0,  2986261542.0},
-  { 976635274.0,  1297997404.0,  2260279429.0,  2209770811.0,  3544783222.0,   651713704.0},
-  {2611004660.0,  3886064695.0,  1466480800.0,  1105017513.0,  3972343242.0,  2441328895.0},
-  {4007207023.0,    81162557.0,  3935232176.0,  3940888405.0,  3612168481.0,  1498242539.0},
-  {1240894392.0,   206858877.0,  2293835539.0,   834847232.0,  1688680932.0,  1115253882.0},
-  {2117241156.0,  4240415556.0,   460291894.0,   486571263.0,  3918481617.0,  3882985509.0},
-  {2927384295.0,  1717601997.0,  2619136670.0,  3769615584.0,  3567750253.0,  1785321821.0},
-  {2526307913.0,   989545826.0,  1881422579.0,  3082787592.0,  1562382953.0,   798206688.0},
-  { 152393690.0,  4061047603.0,  4075992204.0,   113185684.0,  2899537074.0,  4227412556.0},
-  {2382138120.0,  3212226369.0,   333763062.0,   599571605.0,  2862200393.0,  3159417893.0},
-  {1128851738.0,  3518347291.0,  3571840225.0,  2657212351.0,  2739898944.0,  4065545392.0},
-  {1394216189.0,  3645491550.0,  4128882886.0,  3246480915.0,  1670253214.0,  2148934487.0},
-  {1980311302.0,  3883726529.0,  2223885042.0,  2727806184.0,  2687869281.0,  2345205144.0},
-  {1406757880.0,   294486553.0,     1341281.0,  1018141930.0,  3324762035.0,  3884917864.0},
-  {1407651376.0,  2522786698.0,  1000541406.0,  3215035902.0,  4042587041.0,  1442270047.0},
-  {3180586690.0,  3101343774.0,  1010986581.0,  1614092478.0,  1306474218.0,  1662995058.0},
-  {2392030284.0,  2963398581.0,  3599322100.0,  2195502719.0,  3626507240.0,  2240704183.0},
-  {2617208037.0,   707763287.0,  1212558751.0,   133875805.0,  2593442870.0,  2691469564.0},
-  {1862522493.0,   802895127.0,  2382593001.0,   337654346.0,  3071414114.0,  1621418698.0},
-  { 606606089.0,  2511788162.0,  1652929701.0,  1048739844.0,  1417994833.0,  2232334013.0},
-  {1437090472.0,  3668816032.0,   351234958.0,   134104027.0,  3814746303.0,   908191094.0},
-  {3715766446.0,  1026514796.0,  2218830043.0,  3817876838.0,  1910114323.0,   403793847.0},
-  {1416273149.0,   571519047.0,  1873153210.0,  3872648064.0,  3354114661.0,  3220443683.0},
-  {1253137167.0,  3910504304.0,  2007159831.0,   433690818.0,  1619689736.0,  1420647400.0},
-  {1185576772.0,  1128136703.0,  2361211282.0,    67880136.0,   641690708.0,  2623386855.0},
-  {1949119912.0,  3107408696.0,  1561138002.0,  3603701378.0,  3846620293.0,  2906517095.0},
-  { 473944485.0,  1109535172.0,   285583520.0,  1861885430.0,  1644768363.0,  3777932493.0},
-  {3694153789.0,   721836398.0,  2511664933.0,   191550341.0,   434607873.0,  2503312681.0},
-  { 881519779.0,  3898820719.0,  3625131092.0,  3778818234.0,   723055580.0,  3370589995.0},
-  { 664664019.0,  2283364892.0,   234849234.0,  1890720502.0,  1900809146.0,  2563780640.0},
-  { 113462054.0,  2576982297.0,  3853175741.0,  1104574116.0,  1098462393.0,  2711387496.0},
-  {1465693067.0,  2297951175.0,  4025672584.0,  3889572915.0,  3568352106.0,  1972083649.0},
-  { 620953447.0,  3606696885.0,  2341350483.0,  2743561799.0,  3805913425.0,   749796565.0},
-  { 930384033.0,   622157392.0,  2527626067.0,  2182522180.0,  2045330690.0,  1934372730.0},
-  {1456278789.0,  2070928023.0,   277468862.0,   330220320.0,  2953252949.0,   890776687.0},
-  {2529302545.0,   181431478.0,  2718123193.0,  4200049742.0,  2633368366.0,  1044939001.0},
-  { 538603557.0,  1219579899.0,  1099005911.0,  2396852452.0,   446119790.0,  4284781460.0},
-  {4143775482.0,  3872621028.0,  3166270143.0,  1736971524.0,   471932221.0,  2946081227.0},
-  { 924360563.0,  1270894737.0,  1318790505.0,   559977105.0,  1731323553.0,  1087095161.0},
-  {4285498249.0,  1009869999.0,  1945771443.0,   970062144.0,  1222550322.0,  2526246359.0},
-  {3711507128.0,  3658041075.0,  1732724216.0,  2827811352.0,  3899843311.0,  3845035395.0},
-  {3959996925.0,  1018460876.0,  1870886391.0,  2867628400.0,  1194201996.0,   535235948.0},
-  {  47854913.0,   303392918.0,  4100723271.0,  1764288943.0,   604523601.0,   271443830.0},
-  { 784142533.0,  1128477891.0,  3105349992.0,  2165361184.0,  4133400304.0,  1466122828.0},
-  {3113696231.0,   998353424.0,  2953471338.0,  2015231138.0,   751191116.0,  3422523043.0},
-  {  11713936.0,  3459657211.0,   848615725.0,   722661284.0,  1543357280.0,  3110159853.0},
-  { 789757336.0,  1828514965.0,  2856826435.0,  3080200828.0,  1965211467.0,  3488959917.0},
-  { 395618697.0,  3380751255.0,  1709734683.0,  2203263358.0,  2762660510.0,  3273288271.0},
-  { 425738239.0,   915204920.0,  1540652287.0,  1265356742.0,  3657264365.0,  2834478536.0},
-  { 254328989.0,  3351293845.0,  2683963990.0,  2648861813.0,   129403293.0,  4041347411.0},
-  { 715092224.0,   775320914.0,  4160920740.0,  1018041111.0,  2109168310.0,  1188762316.0},
-  {3032891242.0,   811684429.0,  3660428003.0,  2620931455.0,  2389234341.0,   547367413.0},
-  {2279214697.0,  2894547019.0,  2895495422.0,  3498558796.0,  1213090509.0,  4028722192.0},
-  {3697784344.0,  2089167225.0,  1032986011.0,  2235587694.0,  3859027602.0,  1369870532.0},
-  {  63099301.0,  2142466881.0,  1212944745.0,  3940022394.0,  2352907954.0,  2440530477.0},
-  {3502080701.0,  2240876528.0,   616832783.0,  3379251874.0,    63783332.0,  1657838339.0},
-  { 419347276.0,   206600722.0,   879383533.0,  3867550833.0,  4264878227.0,  2256772096.0},
-  {2466119652.0,  4020055056.0,   583227065.0,  3164897292.0,  1656236046.0,  3332402830.0},
-  {2582509813.0,  1576349886.0,   984093457.0,  1727645382.0,   635765791.0,  1390439224.0},
-  {2599048832.0,  3839198353.0,  3113946619.0,  1186969351.0,   563986881.0,  2170985370.0},
-  {  33231038.0,   413837681.0,  3263169487.0,   464257001.0,  2136813394.0,  1981868381.0},
-  {1191824080.0,  3897997885.0,  2688297248.0,  1020076890.0,  2789813324.0,  2274556676.0},
-  {3725261670.0,  4087008954.0,  2049367763.0,  3867685122.0,  2971636571.0,  2102450323.0},
-  {3894031845.0,  1562908085.0,  1919087548.0,   863278014.0,   550935804.0,  1782568493.0},
-  {1336588123.0,   161418925.0,  1181528961.0,  1189320244.0,   937173739.0,   953567487.0},
-  { 586546610.0,  1674386618.0,  3456369668.0,  3994351449.0,  2937055107.0,  4108522969.0},
-  {2166775392.0,    27582546.0,  3147315497.0,   386426694.0,  1007240956.0,   387895513.0},
-  { 322259851.0,  2125431527.0,  3581424731.0,  2153771283.0,   199556110.0,   738161488.0},
-  {1584768787.0,  3949965303.0,   260742039.0,  3512141001.0,  1275785221.0,  1050368056.0},
-  { 258173096.0,  1277716502.0,  1845538759.0,  1891705347.0,  1907645307.0,    82902409.0},
-  {1383687089.0,  3853894157.0,  1792040101.0,  3375468514.0,  1401810827.0,  4146113203.0},
-  { 226775039.0,  2423450971.0,  3833722005.0,  3548571367.0,  3659039312.0,   934716093.0},
-  {2522801204.0,  2278776812.0,  2605869476.0,    84369614.0,  1880675207.0,  2803981622.0},
-  {3826365455.0,  4152945197.0,  2252371044.0,  3343422197.0,  3018320252.0,  1329428187.0},
-  {3682843016.0,   296728027.0,  1213598597.0,  1973192745.0,  3834394838.0,  1346522836.0},
-  {1303290336.0,   144520875.0,  2990827414.0,   757692194.0,  1879484602.0,  2579293113.0},
-  {2899183696.0,  3851206334.0,  1285326552.0,   425640908.0,  2293492128.0,  1718341840.0},
-  {4066792583.0,  2421722396.0,  1059034597.0,  2654179092.0,  3881951376.0,  2614290540.0},
-  {3364098430.0,  2884107112.0,  1214127246.0,  2007698954.0,   885106855.0,  1729706678.0},
-  {1708956702.0,  3678235702.0,  2833841605.0,  2479955168.0,  1109637403.0,  1811358865.0},
-  { 441144794.0,   851699594.0,  1018769915.0,   115718386.0,  3588138746.0,  3429409411.0},
-  {1734552237.0,  1790316967.0,  1211129022.0,  3450039974.0,  2610296796.0,  2344845470.0},
-  {3402949081.0,  2652760931.0,  2351610500.0,    50516238.0,  1220475958.0,  2319809912.0},
-  {1576549983.0,  2893184850.0,  2018715535.0,  3636721605.0,  1253791067.0,  2448758915.0},
-  {1548201340.0,  4040145578.0,  2938185755.0,   219665811.0,  4181233919.0,  1549393140.0},
-  {2279059019.0,  1527442584.0,  2728425667.0,  2853242745.0,  3089113514.0,  4126139140.0},
-  {2488475342.0,  1224348081.0,   197067183.0,   834247809.0,  1073543330.0,  1423868894.0},
-  {3548839168.0,   941583659.0,  1353548080.0,  2429557173.0,   306181902.0,  2300182244.0},
-  {3447014077.0,   170871806.0,  3687302169.0,  1260076896.0,  1520536698.0,   335294354.0},
-  {1213836935.0,   652603444.0,  1733656903.0,  2881868502.0,  1203556008.0,  3759577909.0},
-  { 642009823.0,  1199378081.0,  4268785086.0,  1591056325.0,  3111113792.0,  2858064928.0},
-  {3766140436.0,  3089482938.0,  1581176817.0,  1472956455.0,  3731596350.0,  4208732635.0},
-  { 962092716.0,   430462741.0,   785742333.0,  3190634366.0,  3746675372.0,  1188116625.0},
-  { 581160054.0,  3985142659.0,   130874926.0,    27672422.0,  3830866987.0,  1628939570.0},
-  {3931405933.0,   219631638.0,  4049016062.0,  2967981155.0,   375123461.0,  1774577180.0},
-  {4235693690.0,  3346681259.0,  4172368080.0,  3947046631.0,  1901632627.0,  3954942529.0},
-  {3217634450.0,  2764082770.0,  3139206540.0,  1784412993.0,  1589304637.0,  2434343381.0},
-  { 907311383.0,  2826985145.0,  2019815668.0,  2385338620.0,  3012196051.0,  3837245808.0},
-  {3872588839.0,  2791986114.0,  2482559421.0,  2862990984.0,  2726255887.0,  2875430981.0},
-  { 501725759.0,   990549438.0,  2374356888.0,     2109853.0,  2620555651.0,  1804743150.0},
-  {2175234094.0,  2174503232.0,  4219681129.0,  1676701565.0,   641084431.0,    30468130.0},
-  {1812750748.0,  2706309576.0,  2795640946.0,  2922862663.0,   756152086.0,   100275718.0},
-  {1402329264.0,  1895822308.0,  2819844817.0,  3387469555.0,   394392943.0,   520717629.0},
-  {1105812497.0,  2909366712.0,  1522242669.0,  3489422471.0,  2571211354.0,   560587170.0},
-  {3108310532.0,   825041387.0,  1088887210.0,  1509417773.0,  3847309684.0,  2365936086.0},
-  {2838246673.0,  3462789568.0,  4249073626.0,   418066577.0,   635969285.0,   705169352.0},
-  { 472757359.0,  4092360937.0,  2259114787.0,  1170525192.0,  2160075289.0,  2948641294.0},
-  {3485288179.0,   215764663.0,   448764886.0,  4159946768.0,  3032919908.0,  3189704835.0},
-  {1873881585.0,   754762482.0,   801960918.0,  1840413261.0,  1815466379.0,  3684603047.0},
-  {3793944759.0,   425953850.0,   818664350.0,  4230794662.0,   562174630.0,   921434029.0},
-  {1805385182.0,  3202125526.0,   849502833.0,  1348916753.0,  2674668017.0,  2436399550.0},
-  {2556961424.0,  1957842517.0,  2905196202.0,  2777129513.0,  3256653131.0,  4167289514.0},
-  {2193569315.0,  3133882374.0,  4048388172.0,  3941797376.0,  2309452930.0,   375861830.0},
-  { 707310236.0,   403829440.0,  3280635212.0,  4044481493.0,  3696898916.0,  2930323669.0},
-  { 526485111.0,  1293183825.0,   190828390.0,  1719571221.0,  1583681607.0,  3636371188.0},
-  {1359450056.0,  3015545028.0,  3434563414.0,  3074560745.0,  2600156170.0,  3558975781.0},
-  {1280255410.0,  1540247884.0,  4047457305.0,  1230314017.0,  2818730797.0,  3275211559.0},
-  {1879981606.0,  3892693370.0,  2974459736.0,  3625030903.0,  2705605462.0,  2567370731.0},
-  {2700354790.0,  1599210272.0,  3765514867.0,   334451168.0,  2202010838.0,   890143543.0},
-  { 696345925.0,  1396336631.0,  1318762592.0,  4252878092.0,  1583140229.0,  2989838708.0},
-  {1228322910.0,  1716046609.0,   857701857.0,  1982912514.0,  4255141399.0,  4197003213.0},
-  {2634679534.0,   753891722.0,  2779656251.0,   195114317.0,   900036256.0,  2982864291.0},
-  {1171407834.0,  1891310257.0,  2225588650.0,  4003970820.0,  3651852861.0,  3207096534.0},
-  {2583971310.0,   113884290.0,  2239686251.0,  2244079979.0,  4064710213.0,   962628613.0},
-  {1464808581.0,   999271622.0,   227582304.0,  2406919740.0,   710552453.0,  4106913355.0},
-  { 934649596.0,  2988068167.0,   101193087.0,   480641526.0,  1655689778.0,  2826465639.0},
-  { 389212002.0,  4026855941.0,  1497449168.0,  3925854521.0,  3424426379.0,  3877132249.0},
-  { 828127110.0,  1167326972.0,   106210184.0,   511849320.0,   495201652.0,  1116325058.0},
-  {1760300546.0,  2862982755.0,  3784642973.0,  2163514656.0,   898130703.0,  4049208029.0},
-  {4031287581.0,  2709828801.0,  2949758685.0,   699639617.0,  3645657011.0,   866865294.0},
-  {4080374798.0,  4055301933.0,  3808904393.0,  4132907339.0,  4170686999.0,  3027253734.0},
-  {2014960739.0,  3055866088.0,  3333024724.0,  3003069634.0,   213624677.0,  3167649274.0},
-  {4269104176.0,  2863590773.0,  2841591668.0,  2923010937.0,   989077425.0,   230044462.0},
-  { 658458519.0,  1686470221.0,  2358380687.0,  3571432046.0,  1980562622.0,  3218903917.0},
-  {1384438857.0,   682092814.0,  4291825824.0,  3589728392.0,  2276171039.0,  2204913466.0},
-  {4223396133.0,  2067765181.0,  1229263104.0,  2009125270.0,   700151236.0,   880124307.0},
-  {2629232666.0,  3408839412.0,  3201316826.0,   515616593.0,  2983029085.0,   672820890.0},
-  {2667359458.0,  3661802679.0,  2780939068.0,  3183412824.0,   396920665.0,   516494729.0},
-  { 605862613.0,  3639661419.0,  2276361414.0,  3533854495.0,  1666169453.0,  1055894947.0},
-  {3286107927.0,   197275368.0,  2367939136.0,  1345061335.0,  3562311865.0,  2284894453.0},
-  {1446817483.0,  2934189412.0,  2890982521.0,  1149006057.0,     7157354.0,  1128177178.0},
-  {1940349799.0,  3794667473.0,  2883349622.0,  3801311067.0,  2868957945.0,   361408308.0},
-  {4225536514.0,  4282441847.0,  3646929773.0,   438908824.0,  1805952065.0,  1629627086.0},
-  { 985991817.0,  1612610215.0,  1103967764.0,  1591547642.0,  3995794982.0,  1009352727.0},
-  {3290246274.0,  3024883091.0,  4095268924.0,  3422572455.0,  2350842342.0,  2879826540.0},
-  {4203434736.0,  3084820399.0,  3109912605.0,  1364361417.0,  4045736139.0,  1055531818.0},
-  {3188479341.0,   789731715.0,  2624825339.0,   842886378.0,  1958604150.0,  3730051135.0},
-  {3932721919.0,   256273991.0,  1720091772.0,  2710412965.0,  3664545616.0,   953989294.0},
-  { 373299411.0,  2070133347.0,  2226166805.0,  1855276659.0,  2221767263.0,  2406096944.0},
-  { 958548616.0,  2373989296.0,  2000229872.0,  2977235804.0,  1085701222.0,  3593775525.0},
-  {1482198757.0,  3281591921.0,  1176254360.0,   318116614.0,  3332060020.0,  1711543478.0},
-  {2883583257.0,   126452507.0,  1733050759.0,   138395263.0,  1901793169.0,  4207036618.0},
-  {3329013558.0,  3818994215.0,  1035595729.0,  1634677809.0,  3720779350.0,  1496459185.0},
-  {3383855877.0,   563182131.0,   411439632.0,  3587890145.0,  1177365702.0,  3705018389.0},
-  {3297119986.0,  2377473675.0,  2876446209.0,   301337445.0,  3744150836.0,  2793760793.0},
-  {1429766244.0,   903365836.0,  3725017307.0,  4174784548.0,   369679350.0,  3263689996.0},
-  {2527895397.0,  2929128117.0,  3582758769.0,  2090339633.0,  2846680959.0,  3856055559.0},
-  {1143917783.0,   716411141.0,  1315323711.0,    94249028.0,   633572941.0,  1500610705.0},
-  {1296181356.0,  1613063102.0,  2025712361.0,  1281836821.0,  3833124279.0,   433407742.0},
-  {1602039756.0,  1898876105.0,  2637273353.0,  3126993203.0,  1095768152.0,  3509089185.0},
-  {3783334148.0,    71025544.0,  1192425730.0,   735397154.0,  3965004440.0,  1067775120.0},
-  {2624861421.0,  3725426699.0,  2089014146.0,   260074074.0,  3630144442.0,  1809398343.0},
-  { 860529269.0,   547793003.0,  1248232738.0,  2908915566.0,  3888017240.0,  2242612391.0},
-  {1609878691.0,  2270804134.0,  1089424925.0,  1116369645.0,  1687277056.0,  3298650740.0},
-  {3486393417.0,  1698928020.0,  2366984403.0,  3802564023.0,  4020819569.0,  2187429069.0},
-  {1141490153.0,  4044779719.0,  1388025493.0,  1224477249.0,   804395090.0,  2907671304.0},
-  {1577630512.0,  1698015750.0,   867397738.0,  1711526592.0,  2330043411.0,  1627133899.0},
-  {1497292620.0,  4023124262.0,  4110730681.0,  2496333001.0,   150323227.0,  3931557309.0},
-  {1845307204.0,  3902734374.0,  2499694792.0,  1036557792.0,  1403166304.0,  2893733189.0},
-  {3652476127.0,  1218201443.0,   539786805.0,  4089700570.0,  3106464396.0,  2797885957.0},
-  {2447207671.0,  1270338807.0,  1846548106.0,  1753791141.0,  3907160679.0,  3497625915.0},
-  {1276533926.0,  2595184689.0,   384902641.0,  4161144399.0,   361049723.0,  2756000060.0},
-  { 644003117.0,  2909720911.0,  4284358438.0,  1186576227.0,  1265319592.0,  1188409783.0},
-  {2892820847.0,  3087098176.0,  2139272139.0,  2812858283.0,  4240047525.0,  3927671193.0},
-  { 801218529.0,   501551480.0,  3302516343.0,  3948411489.0,  2550615840.0,  1422360562.0},
-  {1853445097.0,  4294040725.0,  4285339906.0,  1359622734.0,  2517433225.0,  2343233267.0},
-  { 201223027.0,  2280840292.0,   393266492.0,  1702933901.0,  1945536973.0,   617486705.0},
-  {1688910570.0,  3763346413.0,  1246127248.0,  1392935950.0,  2302692297.0,   371043670.0},
-  {3945747522.0,  1124237767.0,  1309693066.0,  1449848800.0,  4079470312.0,  1939010452.0},
-  {2161567835.0,  3911311678.0,  1877826733.0,  1594807501.0,   442926875.0,  1906104932.0},
-  {2434901954.0,   132964498.0,  1583359035.0,  2582812562.0,  2313823338.0,  3263505500.0},
-  {3975496620.0,  1781269489.0,   716398131.0,    92579934.0,  1128363186.0,  2350565416.0},
-  {1889218758.0,   665020135.0,  2019201892.0,   971140586.0,  3089177191.0,   202426593.0},
-  {3431790111.0,  1164714273.0,   950109607.0,  1066320517.0,   251780984.0,  1894035484.0},
-  { 835520750.0,  1914163419.0,  2824211757.0,  4205954214.0,   952345014.0,   347143019.0},
-  {1703936780.0,  1428032666.0,  1550172689.0,  1178564559.0,  2277447700.0,  2210756524.0},
-  {3431241330.0,  1572040644.0,  1816844589.0,  1985280117.0,  2706845891.0,  1247141175.0},
-  {3867544479.0,  2093239206.0,  2268188780.0,  1574795631.0,  2507495911.0,  2363591380.0},
-  { 520793729.0,   434350111.0,  3267067386.0,    19017174.0,   835677938.0,  2235516919.0},
-  {3175395757.0,  1755819643.0,  2226648873.0,  1802202141.0,    48949683.0,  3232603985.0},
-  {2021230967.0,  3216985427.0,   917109811.0,  3003403425.0,  1617382350.0,   330455031.0},
-  { 477507193.0,  2453912513.0,  4037628846.0,   192468246.0,  4139726559.0,  2016974726.0},
-  {2745243390.0,  1749282675.0,  1066067550.0,  3025472830.0,  3553082389.0,   952110327.0},
-  {3730718445.0,  2432853804.0,  3002404771.0,  1462595970.0,  1891077572.0,  1585859040.0},
-  { 628436628.0,  1551202305.0,  2855837672.0,  3047267525.0,  2998810077.0,  2130071936.0},
-  {2357788908.0,  1109020106.0,  1295852094.0,  1679801597.0,  2985446048.0,  1168583519.0},
-  {1864366934.0,   725529603.0,  2623346546.0,  1115354463.0,  3246667506.0,  2521726518.0},
-  { 619617776.0,   513786032.0,  3765557741.0,  2074031747.0,  4257818958.0,  3620255790.0},
-  {2425201422.0,   680442645.0,  2400705816.0,  3695400118.0,   375128906.0,  1222628923.0},
-  {3159887992.0,  2823470748.0,  3578526887.0,   335300139.0,   687738127.0,  2378758189.0},
-  {3065054889.0,   843919690.0,  1891254930.0,  3491884637.0,  3581962226.0,  3438868914.0},
-  {1373079208.0,   940249299.0,   656410461.0,  1713120250.0,  1900944709.0,  1507798419.0},
-  {3749999113.0,  1642095467.0,  2352792295.0,  2378726405.0,   715577982.0,  1108882858.0},
-  {2200382984.0,  2909342312.0,  3269699620.0,  2673958912.0,  2229539036.0,  2532270389.0},
-  {2426694261.0,  2356830212.0,  3052999531.0,   600583995.0,  4290421676.0,  3868702612.0},
-  {4087734073.0,  3448697914.0,  2338405418.0,  1229205358.0,   235895709.0,  3923648530.0},
-  {1313403404.0,  1729133856.0,   235781226.0,  3489275414.0,  4284187630.0,  2101733592.0},
-  {3286747248.0,  3234414242.0,  2911812754.0,  3488295962.0,  1598657358.0,  3299635825.0},
-  {4045608775.0,  1510319170.0,  1794246235.0,  2169129087.0,  3413012603.0,  1425327281.0},
-  { 898184868.0,  2830257172.0,  3475189610.0,  4154405351.0,  1533884947.0,   478403267.0},
-  {1088167588.0,  3548385978.0,  3513304812.0,   943717381.0,  2111547679.0,  1953606241.0},
-  {2264907110.0,   366819817.0,   521220868.0,  1678192411.0,  3965328614.0,  1477943662.0},
-  {1562907290.0,  3250078280.0,   184560072.0,  2972084425.0,  1889264737.0,  2599121537.0},
-  {1692642052.0,  2279174540.0,    68861425.0,  1431073641.0,  3342094666.0,  3491263305.0},
-  { 260121956.0,  1623035459.0,  3539659082.0,  2266098911.0,  1335340526.0,  3200505903.0},
-  {2411696429.0,  1200346734.0,  1974145146.0,   905426096.0,  2329950478.0,  3619919379.0},
-  {1905181339.0,  1423388635.0,   437924185.0,  3246410106.0,   570539738.0,  2664753663.0},
-  { 485036053.0,   261059398.0,  2791210730.0,  4287549093.0,  3060198497.0,  2547283169.0},
-  {4142436515.0,  3064293952.0,  4269982256.0,  2077564951.0,  3327400843.0,  1580148235.0},
-  {1706416897.0,  2559501581.0,  2797670369.0,   302847739.0,  3758946010.0,   515405377.0},
-  {1704278176.0,  3849784115.0,  4266223751.0,   112352691.0,  1677494577.0,  1144492327.0},
-  { 346670654.0,  2434822755.0,  3529188181.0,    56102073.0,   531897583.0,  1057222515.0},
-  {  36381814.0,  2933707603.0,    84623874.0,    12398444.0,   414184836.0,  2093707147.0},
-  { 499477186.0,  4110120176.0,  2362178817.0,   904445493.0,   988430718.0,  4211339391.0},
-  {4123585066.0,  4204385533.0,  3383571347.0,  2475386563.0,  4193952084.0,  3446640686.0},
-  {4262121486.0,   346828735.0,  2997249160.0,  1975916878.0,  3881238813.0,  2131865725.0},
-  {3087878552.0,  1629908890.0,    99466171.0,   987208461.0,  1023840202.0,  2170411308.0},
-  {1826584001.0,  3535565480.0,  2432167770.0,   211387004.0,  4288041270.0,  4048374470.0},
-  {4232102523.0,  3672062527.0,   164213389.0,  2432890025.0,  2970755000.0,  2785770347.0},
-  {3115284376.0,  1311736842.0,  2368870422.0,  2779536356.0,  1776777492.0,   953352106.0},
-  {3686169863.0,  1351660651.0,   338313583.0,  2362540813.0,  3204603396.0,  2517661523.0},
-  {1348893828.0,  1306518523.0,   738938251.0,  2491537367.0,  1991320798.0,  1241664306.0},
-  {1880114176.0,  1911980480.0,   591943212.0,   682102555.0,  2210682356.0,   997209254.0},
-  {2503273115.0,  4117297687.0,  1346822821.0,  2793182792.0,  2241993548.0,  1693807491.0},
-  {1748924741.0,  2696919831.0,   813156194.0,  1386765184.0,  3735965705.0,  3291915047.0},
-  {1806660421.0,  3371814411.0,   365328440.0,  1641747281.0,  3619285385.0,  2151809529.0},
-  {2751725716.0,   581165257.0,  1754058800.0,   437061529.0,  3516490389.0,  2465971674.0},
-  { 168539061.0,  1327249564.0,  1417623235.0,  2927048640.0,  1953704701.0,  2315372364.0},
-  {2961882229.0,  3474865540.0,  2524779191.0,    82291999.0,  2361300103.0,  4117183343.0},
-  {2763521838.0,  3916820470.0,  2321885017.0,  2260491162.0,  2809548537.0,  1817050433.0},
-  {2044875775.0,    53779114.0,  4176086797.0,   907394975.0,   962272199.0,  2272954534.0},
-  {4131468589.0,  1196814446.0,  1437773887.0,  4187119145.0,  3296571133.0,  1404298600.0},
-  {3254234373.0,  1630511232.0,  2207311375.0,  3432482157.0,  3545196591.0,  3180183051.0},
-  {1418909020.0,   103446679.0,  3213776405.0,   690250327.0,  3267569552.0,  1681941299.0},
-  {3381985843.0,   958243574.0,   653115132.0,   779077295.0,  1749513339.0,  2052950114.0},
-  { 740812351.0,   310980335.0,   193084876.0,    98613114.0,   732405616.0,  1812127979.0},
-  {1311318226.0,  3337589993.0,  4008016933.0,  3578990555.0,   601174454.0,  4183342307.0},
-  { 646669637.0,   497491304.0,  2513661280.0,    75183436.0,  1533741158.0,  2928523899.0},
-  {1932315506.0,  2186097952.0,  1559523069.0,  2805849986.0,  3010462899.0,   461653776.0},
-  {2926653376.0,  1136676976.0,  2536841653.0,  2361354989.0,  3224583143.0,  1015409619.0},
-  {2366102686.0,   294060490.0,  2838614195.0,  3972911491.0,   536685760.0,  3911567415.0},
-  {1447446954.0,  2637262071.0,  1144673719.0,   875561546.0,  3672061468.0,  3075653189.0},
-  { 395585982.0,  1555391019.0,  3666837591.0,  3331412217.0,  3042482689.0,   613788860.0},
-  {3596724352.0,  1747255301.0,  2882665629.0,  3521177863.0,  3215119449.0,  4009266404.0},
-  {1650414429.0,   849089097.0,  1656459946.0,  2884184415.0,  1092124989.0,   138528498.0},
-  {3709770462.0,  2830033290.0,  2801035430.0,  3015157619.0,  4120255942.0,   616390514.0},
-  {4078197346.0,   248873827.0,  1113249594.0,  1394553153.0,   331589577.0,  3813885527.0},
-  { 530322779.0,  2390497782.0,  1081150351.0,  2542176295.0,   708825763.0,  2610998228.0},
-  {2325243300.0,  3611699245.0,  4219269266.0,  2738744295.0,  1274537084.0,  4163249245.0},
-  {2133316470.0,   899421925.0,  1395378324.0,  1654966753.0,  3122988652.0,  3914419035.0},
-  {4237884975.0,  2909836258.0,  1121738101.0,   395359251.0,  3839031537.0,  4246845674.0},
-  {3471652599.0,   302857406.0,  3570167403.0,  3175710379.0,  1674887366.0,  2179263760.0},
-  {3526767039.0,  3573631495.0,   482581332.0,  2887355920.0,    14024175.0,  2031946336.0},
-  {1473344610.0,  3013854715.0,  3119134133.0,  2110145889.0,   266478349.0,  3826161804.0},
-  {2053286239.0,  3113820628.0,  4022913069.0,  4007821527.0,  1112834204.0,  1015637918.0},
-  { 493103837.0,  2223935638.0,   961813968.0,   316379722.0,   637641869.0,  2863359826.0},
-  {1830680533.0,   135007288.0,  3206160107.0,   434580256.0,  2008774211.0,  4094571888.0},
-  {2643530538.0,  3572586884.0,  3083240061.0,  1469134093.0,  2635384141.0,  2012251505.0},
-  {2876002603.0,  2670932338.0,   102048341.0,  3408767145.0,  1434008596.0,  1423479879.0},
-  { 565999579.0,  1600983341.0,  1887422847.0,   294174555.0,   123396396.0,  3783528046.0},
-  {2998701926.0,   533635800.0,  3995134203.0,  4255935903.0,  2011320117.0,  1235036288.0},
-  {  95976873.0,  3546504999.0,  3051695180.0,  4196934995.0,  2829362990.0,  3579773022.0},
-  {3299877421.0,  3220646307.0,   597577245.0,  3055036919.0,   476990766.0,  1488426726.0},
-  { 347440184.0,   985234876.0,  2040421558.0,  1329513104.0,   771669665.0,  1170602988.0},
-  {1774758364.0,  1459369411.0,  3880422170.0,  3532973166.0,   646759427.0,  3952851081.0},
-  { 795182572.0,  2533305580.0,  2628269559.0,  3434368052.0,  3963733290.0,  2715834394.0},
-  {1342272298.0,  3356142715.0,   583718855.0,   817061376.0,   493822993.0,  3414670633.0},
-  {3665024100.0,  2675161083.0,  2474188924.0,  3559729243.0,  1760545131.0,  3954205849.0},
-  {3514108927.0,  4006444937.0,   210356038.0,  3083578462.0,   494970239.0,  1068695193.0},
-  {1860913799.0,  3389031837.0,  2704021864.0,   402772698.0,  2595873814.0,  2501788178.0},
-  { 353161501.0,  2481866186.0,  1182756747.0,  2804108602.0,  2569981746.0,  2321705975.0},
-  { 740161986.0,  2838365040.0,  3612603855.0,   546810195.0,   819816398.0,  3987557374.0},
-  {1697541320.0,   762068366.0,   249327283.0,  2217903941.0,  2532974788.0,  2315661133.0},
-  {2153643503.0,  1278119836.0,  3701858778.0,  3370786740.0,  2691068511.0,  3817706930.0},
-  {4220644004.0,  3297350814.0,  2870215318.0,   733053366.0,  4130842571.0,   445249631.0},
-  { 902019507.0,  2930048897.0,  1781604181.0,  1394514105.0,  2034113079.0,  2629567776.0},
-  {1470544627.0,  3726058708.0,  3098269479.0,  2069780746.0,   827456330.0,  2173271965.0},
-  { 959498582.0,  2682624728.0,  3052896033.0,  1610615335.0,  4238105858.0,  4187055708.0},
-  { 308593117.0,  3583527673.0,  2449811141.0,   485388952.0,   745327543.0,    99849334.0},
-  { 457940539.0,   269253189.0,  2229082746.0,   839882715.0,  4294063927.0,  2847522929.0},
-  {3130112605.0,  2142543445.0,  3193157187.0,  4031283544.0,  1569840917.0,  1553509045.0},
-  {2677244995.0,  2387973414.0,  3431297896.0,  3848274659.0,   774901019.0,  3381860802.0},
-  {1804223384.0,  2452254447.0,  2350756614.0,  2831075342.0,  3033432268.0,  2591853790.0},
-  {2649343259.0,  2767391429.0,  3759425819.0,  3946862334.0,  3595032028.0,  1849199654.0},
-  {2978119443.0,  3623515903.0,  1822306676.0,  1169870870.0,  4080179279.0,   540513498.0},
-  {1855971398.0,  1026959300.0,  4247732580.0,  2769150599.0,   794941024.0,   779557952.0},
-  {3891625812.0,   708458218.0,   163316030.0,  2574769282.0,   107411173.0,  1508007303.0},
-  { 759836859.0,   672213390.0,  3029715659.0,  3035196027.0,  1227744646.0,  2442247427.0},
-  { 954643341.0,  1309231316.0,  3801539770.0,    55550624.0,  1361749717.0,   750000765.0},
-  {2329570795.0,  1281659226.0,  2244452036.0,  2118071308.0,   839643665.0,  1438016021.0},
-  {1356458046.0,   958919704.0,  1255372183.0,  2118213246.0,  1890934561.0,   397248615.0},
-  { 889029703.0,  3772314323.0,  1895459295.0,   668221672.0,  3601329260.0,  4176560701.0},
-  { 970377147.0,  2006302139.0,  3212138276.0,  3182865228.0,  1622628057.0,   722368198.0},
-  {2917691300.0,  4205721622.0,  2785775243.0,  3453008060.0,  2664897874.0,  2292900753.0},
-  {1446467186.0,   766644618.0,  4042716794.0,  2421376377.0,  2175187165.0,   352362443.0},
-  {3282158063.0,  2667044459.0,  2881716089.0,  2323341470.0,  3877815081.0,  4209217501.0},
-  { 317836763.0,  4200310700.0,  2922294224.0,  2006603327.0,  2735537388.0,  3566197679.0},
-  {2217573488.0,  1183813692.0,    11143511.0,   537830269.0,  2743009553.0,   379082409.0},
-  {1640924505.0,  3374532956.0,  4249841015.0,  1007565772.0,  1061546519.0,   363262026.0},
-  { 121846111.0,  2550008014.0,   874249905.0,  2819575807.0,  1789291684.0,  2930281339.0},
-  {4268575011.0,  1479907152.0,  3769201023.0,   993579048.0,   609507084.0,   228163077.0},
-  { 361512202.0,  3439573936.0,  3127608046.0,  2401655380.0,  3311211015.0,  2481694380.0},
-  { 247633100.0,  1798352020.0,  1349948900.0,   492072393.0,  2717742601.0,  3683281971.0},
-  {3025275751.0,   852345800.0,  3167720682.0,   660328153.0,   789955061.0,  2682693304.0},
-  {2691106655.0,  2472028891.0,  3203032675.0,  2321810942.0,  3009299282.0,  2108553522.0},
-  {2861550692.0,  3900550680.0,  3238877688.0,   157588619.0,  4150118198.0,  2433664982.0},
-  {2512132871.0,  3489271520.0,  3358855283.0,   984994003.0,  4012562566.0,  2683325366.0},
-  { 210131215.0,  2618124922.0,   617054118.0,  3111361221.0,  3228602269.0,  1203966910.0},
-  {1082418748.0,  4201092162.0,  3827826779.0,  2932751358.0,  3800757265.0,  2848212560.0},
-  {3869821123.0,  3830411008.0,  2075252781.0,  2615548781.0,  3188356010.0,   204492941.0},
-  { 895906002.0,  2442375211.0,  1617627366.0,   788983752.0,   738604861.0,  3076177442.0},
-  {2848373338.0,   753097754.0,   500612011.0,  1960540747.0,   298444645.0,  3802650513.0},
-  {3196521607.0,  3794935284.0,    77571894.0,  1502141198.0,  2619276627.0,   488179660.0},
-  {1165662217.0,   668898025.0,  2506189105.0,  2691230302.0,   707024437.0,  1889839006.0},
-  {1669541838.0,   170428864.0,  1392407223.0,   792701417.0,  3950416926.0,  1198333160.0},
-  {1554741964.0,   591177465.0,  3039225500.0,   995705583.0,   230793349.0,  1319770901.0},
-  {1979359375.0,  1393385069.0,  2453218883.0,  4080350198.0,  2232872891.0,  2310750328.0},
-  {2726852113.0,  2574575900.0,  2073832821.0,  3680683912.0,   381950742.0,  1388625151.0},
-  { 908362193.0,   904716116.0,  2619723522.0,  3545029305.0,   750789143.0,   630749455.0},
-  {2503324422.0,   690769669.0,  3091352695.0,  3971578385.0,  3890012082.0,  1232079696.0},
-  {4053149701.0,  1977482077.0,  2334881062.0,   500646606.0,  3981737316.0,  2031766722.0},
-  {1823785284.0,  3740987246.0,   420862234.0,  3065014647.0,   974128584.0,  3925274174.0},
-  {2223408936.0,  3856323102.0,  3745652403.0,  1171291148.0,  3707785562.0,  4080359674.0},
-  {4005953254.0,  2606653463.0,  3649181110.0,  2315554615.0,  4218313115.0,  2003947282.0},
-  { 391975185.0,  4048723194.0,   434789550.0,   623877336.0,  1159923388.0,  3376641281.0},
-  {2092363877.0,    16601345.0,  1288378178.0,  2712441423.0,  1274696086.0,  3215118679.0},
-  {1512873183.0,  2058284890.0,   495444598.0,  3997119798.0,   593512272.0,  2758664437.0},
-  {2276892509.0,   274519858.0,  2377689786.0,   869039717.0,   340100335.0,  3186189895.0},
-  {   5236690.0,  2195257477.0,  4168253594.0,  1283931211.0,  2371049975.0,  2974958046.0},
-  { 862607689.0,  1406361210.0,  1853783653.0,  2661344478.0,  4153088757.0,  2587606559.0},
-  {2714291216.0,  3109863152.0,  1541216166.0,    36312193.0,  2073743939.0,  1283371507.0},
-  {2836795401.0,  1227014390.0,  3720615461.0,  3319285684.0,  3133342449.0,  4219237205.0},
-  {2581787601.0,  3189652172.0,   429737791.0,  3397570833.0,  2087038504.0,  2902475414.0},
-  {1899820585.0,  2558053805.0,  2794779014.0,  1516557833.0,  3437666590.0,  3860270274.0},
-  {4201228021.0,   548003484.0,  1943616184.0,  4293960974.0,  3602272904.0,  1852213729.0},
-  {1195854984.0,   963947066.0,   448622957.0,  2097498899.0,  1072354352.0,  1307918145.0},
-  {2667374190.0,  2583594820.0,   786914042.0,  3911293959.0,  1625606454.0,   285054893.0},
-  {1198462194.0,   887250927.0,  4265140732.0,  2078050175.0,  3447175491.0,  3829610637.0},
-  { 828879635.0,  1750040392.0,  1519254878.0,  1497891557.0,    50793505.0,  2125508050.0},
-  {2043265669.0,    90441792.0,  2281244271.0,  1919080308.0,  1661726886.0,   457893420.0},
-  {2794671243.0,  2145742817.0,  1154622865.0,  1464072207.0,  1175115484.0,  3197190806.0},
-  {1420734127.0,  4253186539.0,  1196013748.0,  1091779315.0,  1283178409.0,   333955038.0},
-  { 617858057.0,  2947817534.0,  3947573124.0,  1451627471.0,  3397442685.0,  1779250401.0},
-  {4283878407.0,   998776788.0,   355971524.0,  3894906852.0,   216008927.0,  2208732962.0},
-  {3304780495.0,  2408651406.0,  3097295623.0,  4131190805.0,   555735192.0,   813696283.0},
-  { 863943687.0,   664904541.0,   571345163.0,     3131315.0,  2293639924.0,  1288738013.0},
-  {2467610497.0,  1157164449.0,    97324689.0,  1033069419.0,   472831117.0,   231417477.0},
-  {1362286340.0,   570232443.0,   141438399.0,  1190247281.0,  2835510966.0,  2950728523.0},
-  {2282822712.0,    19792511.0,  3514698869.0,  2322720902.0,  1292669285.0,  2879476981.0},
-  {2942200628.0,  2006006531.0,  3785604899.0,  3290744202.0,   598964317.0,  1579719360.0},
-  {3693190653.0,  2586611719.0,  3403275788.0,   190777125.0,  3948966912.0,  4066529518.0},
-  {1790483916.0,  1284662978.0,  3769884485.0,  3692127265.0,  1391166550.0,  3148134691.0},
-  { 660198846.0,  4262830491.0,  2546588734.0,   283385013.0,   607392002.0,   672040953.0},
-  {3855514009.0,   223329498.0,  3835924717.0,   724037620.0,  2734559009.0,  1587011615.0},
-  { 793107415.0,  1227589309.0,  1423637390.0,  1468545883.0,   991685430.0,  2197895258.0},
-  {1949308810.0,  1207045681.0,  1686441172.0,   567740510.0,  1974062418.0,  1515614782.0},
-  { 920553565.0,  2468405785.0,  1392132844.0,  1216006615.0,  2322905380.0,  3229618734.0},
-  {3514568028.0,  3087395488.0,  4202575792.0,  1333777942.0,  4224498896.0,  1406577402.0},
-  {3926648568.0,  1220279640.0,  1490476427.0,   804825808.0,  1456482871.0,  2196052265.0},
-  {2231149699.0,  3435826804.0,  1273068558.0,  2363264224.0,  2870321607.0,  2373470287.0},
-  {2201186736.0,  1860433124.0,   523671246.0,  3737105507.0,  3122703953.0,  1764674071.0},
-  {4268171289.0,  3288868268.0,  3877679458.0,  2115522067.0,    36180580.0,  2459898536.0},
-  {1807985560.0,  2406952385.0,  3770280222.0,   181339080.0,  2975049212.0,  2208592786.0},
-  {2924988261.0,  1846792929.0,   690166963.0,  3142827584.0,  1304173096.0,  3900572277.0},
-  {4010628841.0,  3760085445.0,   483151536.0,   699784881.0,  3294721858.0,  3704525333.0},
-  { 518494135.0,   454739535.0,  2040792618.0,  1033566285.0,  2311961495.0,  2941205380.0},
-  { 380519676.0,  2363423205.0,   821381154.0,  2501873176.0,   429257092.0,   196302792.0},
-  { 916445326.0,  3342973320.0,  2088656880.0,  3917864579.0,  3100215850.0,  2141595062.0},
-  {2969997905.0,  1911063607.0,  2387631895.0,   679047023.0,  1730491724.0,  3887225753.0},
-  {1549439324.0,  3822774864.0,  4169678793.0,  2777380632.0,  2068235502.0,  4172615546.0},
-  { 797725160.0,  2106149745.0,  3855395655.0,  3230186315.0,  3371199311.0,    24347334.0},
-  {1966181364.0,   607261468.0,  2544346248.0,  1601024645.0,  1394354134.0,  3235088384.0},
-  {1975313036.0,  3911260054.0,  3715855708.0,  2787082155.0,   215905838.0,  1531666127.0},
-  {3746718035.0,   108267849.0,   126185971.0,   626768723.0,  3193871702.0,  1795272406.0},
-  {1115817662.0,  4051658115.0,  1078195412.0,   899791809.0,   743661850.0,  3769779877.0},
-  {3309118496.0,  3577305092.0,  1633956629.0,   633725668.0,  2760190549.0,  1721256214.0},
-  {4241815577.0,  2159574113.0,  3577583286.0,  4162819833.0,  2297950622.0,  2691610450.0},
-  {1357740197.0,  1543344558.0,  1403651210.0,  1216777867.0,  1486547359.0,   794478731.0},
-  {2484905285.0,  1696503246.0,  2106003227.0,  2447021035.0,  2140655694.0,   262799931.0},
-  {4016934420.0,  3932786119.0,  2394899478.0,  3287348005.0,   668311765.0,  2002049695.0},
-  {1821548009.0,  4164089130.0,  1201609730.0,  3674944592.0,  1810972562.0,  3983950732.0},
-  { 961811677.0,  3227949290.0,    17956108.0,  3951340520.0,  3270337731.0,  4052666224.0},
-  {1245381588.0,  1383417918.0,  2187752588.0,  2724671426.0,   939591439.0,  2022755221.0},
-  { 827061423.0,  1724459102.0,  2260757000.0,  1683992170.0,  3419190682.0,   688930164.0},
-  { 205585761.0,  3961239641.0,  2236331142.0,  2374451198.0,  1885813572.0,   906429615.0},
-  { 670858251.0,  2097213299.0,  3802224707.0,  1285310841.0,  3950899814.0,  4238929575.0},
-  {3133936140.0,  1237407741.0,   844543644.0,   755684629.0,  2753619582.0,  3222315900.0},
-  {4101826078.0,  1579792566.0,  3136818843.0,  2474607727.0,   497667821.0,  1746486534.0},
-  {1195172454.0,   888416140.0,  2095949791.0,  2448912688.0,  1464631797.0,   558879401.0},
-  {3889791517.0,  3297996226.0,  1129189763.0,   712568526.0,  1836300435.0,   261275382.0},
-  {4109470267.0,  1370531685.0,   809815135.0,  4026549296.0,  1796366375.0,  3274943248.0},
-  {3316306174.0,  2639910245.0,  3493406910.0,  3211735334.0,   131133874.0,  1079466466.0},
-  {2158487696.0,   896808378.0,  4032373961.0,  3286609633.0,  1289526880.0,  1210631862.0},
-  { 563763670.0,   359009343.0,   974081717.0,  2597787186.0,  1434793860.0,  1664077096.0},
-  {2364665819.0,  1736140394.0,  4222187167.0,   493496676.0,  3470169251.0,  2411012589.0},
-  {  20807184.0,  1151680850.0,  3811369982.0,   436426306.0,  2104515189.0,  1055195170.0},
-  { 106187711.0,  2466791491.0,  3281038279.0,  3436706392.0,  1197871753.0,  2039453766.0},
-  {2516420245.0,   480192090.0,  1434022063.0,  1900507534.0,   918856240.0,  3397988273.0},
-  {1391694535.0,  3393114293.0,  1195398782.0,  1686460141.0,   210654590.0,  2888581770.0},
-  { 718828705.0,  4189295953.0,  4043004535.0,  1706716977.0,  1148839657.0,  1744563353.0},
-  {3159161467.0,  2917568187.0,   562187916.0,    88839922.0,    66027691.0,   922449626.0},
-  {3326476022.0,  2953677470.0,  1699535613.0,  4268271604.0,  3674116499.0,  2355235043.0},
-  {2645202621.0,  1417679111.0,  2098551575.0,  2219983495.0,  3298257833.0,  1650992701.0},
-  {2913214273.0,  2552338690.0,  3058918089.0,  3846007412.0,   635825328.0,  2873881201.0},
-  { 931156960.0,  1368870830.0,  2132061812.0,   637395050.0,   531306780.0,  1982617994.0},
-  {2206060593.0,  2053432492.0,   260330258.0,  3522497349.0,  1116988588.0,  1579614851.0},
-  { 345828195.0,  3420867442.0,  1105524881.0,   578757085.0,  4164616051.0,  4008178843.0},
-  {1128782096.0,  1190526222.0,  1519712902.0,   422503053.0,   618057469.0,  1681126143.0},
-  {1170582362.0,   409413062.0,  2981043143.0,   179083516.0,  2679971185.0,  1358878375.0},
-  {3496620408.0,  1980699362.0,   350310299.0,  2392433825.0,   482268378.0,  3095484306.0},
-  {4018322305.0,  2226258796.0,  2143964286.0,   219530209.0,  2983546506.0,   612276713.0},
-  { 492316202.0,  3577544632.0,  3949248208.0,  2550128766.0,  1347965716.0,  3171595312.0},
-  {3501341457.0,  1098993413.0,  3884834643.0,  2000578197.0,  1047166202.0,  2088716734.0},
-  {2965927019.0,    82528511.0,   503986687.0,   639512492.0,  2770945759.0,  1136080664.0},
-  {3438078634.0,   548440760.0,  1408236928.0,  3818765334.0,   137916041.0,  4100863231.0},
-  {3062172443.0,  3862586714.0,  2621060643.0,  2277837642.0,  3191160139.0,  3712913179.0},
-  {3039548280.0,  1397908155.0,   274208857.0,   411950871.0,  3330211777.0,  1813272046.0},
-  {2009251171.0,  1131687694.0,  1848383906.0,   705113574.0,  2799668382.0,  3955940979.0},
-  { 657871706.0,  3364874358.0,  3201156526.0,  4231505743.0,   752810539.0,   142186100.0},
-  { 750079044.0,  2249097705.0,  2530145618.0,  3729537714.0,  3363742222.0,  2537640904.0},
-  {3650449853.0,  2772878241.0,  2365835435.0,  1429720384.0,  1168868247.0,   125519034.0},
-  {1562956254.0,   609600257.0,   274615755.0,   595115051.0,  2356583657.0,  3977118289.0},
-  {3911685669.0,  3926774734.0,  2240424382.0,  1316502032.0,   158769162.0,  1182188168.0},
-  {1929116960.0,  3220547906.0,  2346483912.0,  3976534145.0,  2449090167.0,  2592213604.0},
-  {4119867056.0,  2617520008.0,  2370198366.0,   757732900.0,  2286261099.0,   969060152.0},
-  {2959641864.0,  3377416308.0,  3476203899.0,  1776542350.0,  1939377091.0,  2936395667.0},
-  {2193865610.0,  3775140457.0,  3872507799.0,  3737512909.0,  2762788163.0,  3130275710.0},
-  {1399282566.0,  2013784733.0,   413007780.0,  1613813047.0,  1686790409.0,  1676308614.0},
-  {4233916706.0,  1427011106.0,  4123878575.0,  2979093352.0,  1629025876.0,  2437556427.0},
-  {2724720340.0,  3813204700.0,  1958954732.0,  3811269035.0,  4071670277.0,  4017149140.0},
-  {3022230762.0,  3787768524.0,  1364711450.0,  2245303129.0,  3491435758.0,  2069668018.0},
-  {2445535125.0,  4138750152.0,  3555972970.0,  2288143772.0,  3645492291.0,  3914602494.0},
-  {2089877244.0,  2281796225.0,  2037791996.0,  3584988824.0,  3860172239.0,  3537820930.0},
-  {4161153018.0,  2164947619.0,  3372780766.0,  2565668289.0,  4103470489.0,  1972562873.0},
-  {1376820441.0,    81828432.0,  1690880767.0,  4259074741.0,  2791670128.0,   430445652.0},
-  {3374261126.0,   991568706.0,  4165775340.0,   106305372.0,  1960261325.0,  1080670581.0},
-  {1198895048.0,  4237422750.0,  1689270112.0,   869089320.0,    86703347.0,  2258606349.0},
-  {2271210826.0,  3753857155.0,  2646926462.0,  3113188141.0,  3037910707.0,  3972782996.0},
-  {3056884071.0,  3816624143.0,  2220904541.0,  3878639137.0,   643791769.0,  3574684144.0},
-  {2961287941.0,  3461558450.0,  2302525218.0,  3351239183.0,  4105707065.0,  1076291113.0},
-  {2383065961.0,  3934554204.0,  1769502842.0,  3704514805.0,  1317965564.0,  2581509990.0},
-  {3249464768.0,  1013316130.0,    95001434.0,  4037454024.0,  2267794790.0,  1495136404.0},
-  {4242482811.0,   443955823.0,  1793280833.0,  2926735501.0,  2341423546.0,  3121511202.0},
-  {3310198243.0,  1311355944.0,  3376815701.0,  3814518182.0,  2132411273.0,  2304792454.0},
-  {4224453184.0,  2986558446.0,   438814131.0,  3912827259.0,  3334511230.0,  4283259673.0},
-  {1498187435.0,  3063187416.0,  3996908065.0,  2911344276.0,  3619985386.0,  4239340028.0},
-  {1053446265.0,  3372355950.0,   972730380.0,   412362627.0,  2410517100.0,    41191403.0},
-  { 756925831.0,  3396786115.0,  2326592169.0,  1199750255.0,  2780227331.0,  3559165487.0},
-  {1466351655.0,  4003184418.0,  2250875554.0,  1260954760.0,  1261208465.0,  2090670783.0},
-  {4260340802.0,   329016576.0,   888993581.0,  3074434283.0,  3420253770.0,   465626149.0},
-  {2072744437.0,   497800017.0,  1956787752.0,  1080899919.0,  2068399989.0,  3400560112.0},
-  {3746249704.0,  2547618900.0,  2371409553.0,  2887076326.0,  1814191143.0,   724231351.0},
-  {3980420753.0,  4249717874.0,  3655455662.0,  1924089020.0,  3315727908.0,  2381388592.0},
-  { 694345647.0,  4233074724.0,   388111382.0,  1554772151.0,  3591427077.0,  2692776515.0},
-  {2319550629.0,   116425274.0,  1280581794.0,  1646087753.0,   200798599.0,  2101499436.0},
-  { 487023963.0,  3006488462.0,   714082023.0,  2176129297.0,  2711704203.0,   116248957.0},
-  {4157839312.0,   656943433.0,  1559315821.0,  2640281822.0,  2348516353.0,  1472833768.0},
-  {3846639500.0,  2694209763.0,  3768517270.0,  3928597755.0,  1320888151.0,  3920944424.0},
-  {3172093710.0,  1594798369.0,  2228289829.0,   620050550.0,  1845705869.0,  2921812349.0},
-  {3076229459.0,  2767088291.0,   249426137.0,  2676238734.0,  2002067594.0,  1200087220.0},
-  {2084051944.0,  2624872890.0,  3556888684.0,   255137568.0,  4120270727.0,  1212090960.0},
-  {4021898908.0,  2256081570.0,  4196844759.0,  3937910651.0,  3972304601.0,  2239382413.0},
-  {3048259355.0,  1487429994.0,   169891806.0,   264327193.0,  2545918100.0,  1791835853.0},
-  {3318537303.0,  3280386512.0,   840441988.0,  2747676198.0,   852351266.0,  3747627632.0},
-  { 319052633.0,  2016040900.0,  3598996987.0,  2858744135.0,   180703266.0,  1566579060.0},
-  {3297907812.0,  1454559228.0,  2484523362.0,  2150646665.0,  1962390832.0,  2747600600.0},
-  {1012349988.0,  4281670516.0,  2957864983.0,  3257183542.0,   381959232.0,  1945515938.0},
-  {2538582970.0,  3682022080.0,  2766046519.0,   289971258.0,  1802579963.0,  2822871614.0},
-  { 649230797.0,  3734153267.0,  3307917145.0,  1566419083.0,  4284574967.0,  1389128325.0},
-  { 709663094.0,  1144536076.0,   619340236.0,   117366493.0,   154264780.0,   582950785.0},
-  {2323169284.0,  1624467142.0,   340140962.0,  3429768560.0,  2219439112.0,  1109457160.0},
-  {3216576642.0,  1833230360.0,  3068236962.0,  1721071708.0,  2120329461.0,    31773143.0},
-  {3610055371.0,  2654513477.0,  1383656422.0,   174652926.0,  2728373899.0,  2385485642.0},
-  {3472466947.0,  3152371210.0,  2130719934.0,   332353037.0,   148495613.0,   819260191.0},
-  {3977568801.0,  1584414560.0,  2134517719.0,   284002653.0,  1345139810.0,   935474788.0},
-  {3791514014.0,  2575692194.0,  2072720653.0,  2028294608.0,  1603793152.0,  3018571903.0},
-  {1214889457.0,  3687497190.0,  2347568498.0,  4154364390.0,  3735341890.0,  1993111545.0},
-  {2071637946.0,  4095461853.0,   839247973.0,  3189921332.0,   544991775.0,  3648103626.0},
-  { 809757909.0,   661150660.0,  2183067463.0,   754138918.0,  3674458578.0,  2272362935.0},
-  {1247562352.0,  1763620117.0,   273678262.0,  2612178853.0,   743376724.0,   151435255.0},
-  {2918751714.0,  3221048328.0,    50473114.0,  2937370806.0,  3526759824.0,  1738857172.0},
-  {2986929440.0,   248750828.0,  3326910162.0,  1841065392.0,  3648723806.0,  2496144657.0},
-  {2001051275.0,  2664476973.0,  1322230921.0,  3902117127.0,  2884209940.0,   356365727.0},
-  {3564220829.0,  3016885384.0,   563030767.0,  4208733532.0,   321489301.0,   935567605.0},
-  { 475800900.0,  2191317846.0,  2542211128.0,   362463924.0,  1828531785.0,  1119068910.0},
-  {3967139368.0,  1894372289.0,   287725379.0,  1615040283.0,  3679611145.0,  3283864395.0},
-  {4250571373.0,  1045416492.0,  1103513940.0,  2664556706.0,  1149994159.0,  1082809829.0},
-  {1545293868.0,   607304236.0,  1006083535.0,  2941349059.0,  2774367597.0,  3869403542.0},
-  {4036870288.0,  3785403155.0,   145823332.0,  2674187740.0,  1294306443.0,  3128552859.0},
-  {2362558357.0,  3705693639.0,  3357590511.0,   508951299.0,  2873081500.0,  3043274647.0},
-  {1752077478.0,  1742432512.0,  1957538505.0,  1618918052.0,   765091898.0,   766753025.0},
-  {3752298141.0,  2164811383.0,    87125888.0,   532066926.0,  1624932941.0,  2912832341.0},
-  {4139046258.0,  2867479943.0,  2211902784.0,  2780800177.0,   632222663.0,  3042195360.0},
-  {1176548126.0,  2126705551.0,  4130061915.0,  1013006077.0,   125002242.0,  4106379492.0},
-  { 203767634.0,   660867519.0,  3549015901.0,  1269026823.0,  2512216204.0,   754055064.0},
-  { 982190050.0,   602039437.0,    49576645.0,  1031084806.0,  3079555346.0,  3620190475.0},
-  {3404128154.0,  1455366204.0,   876053072.0,  3412838261.0,  2999835490.0,  2664985365.0},
-  {3813421780.0,   356503329.0,   812909201.0,   429174537.0,   774429290.0,  1565280979.0},
-  {2935817366.0,  3530625275.0,   661779189.0,  1437907554.0,  1940413587.0,  3640878054.0},
-  {2773176078.0,  2699055283.0,  3314529069.0,  2401295150.0,  1808918393.0,  1281472053.0},
-  {4067528505.0,   947826343.0,  2724160457.0,  3779244991.0,   758152626.0,  3584274654.0},
-  {3107876227.0,  2963682693.0,  1676311994.0,  1752261399.0,   861971824.0,    47566501.0},
-  {3223845205.0,  3416951145.0,  2878703729.0,   225984859.0,  4188380555.0,  4174272743.0},
-  { 463873297.0,  1603929565.0,  2150920167.0,  1039819380.0,  1079011541.0,  2667842184.0},
-  { 658435426.0,  2864334025.0,  3157178632.0,  3236745516.0,  3437605987.0,  3160502246.0},
-  {2579649133.0,  2897276998.0,  4083404164.0,  1787657536.0,  2509122502.0,  3244915527.0},
-  {1321877183.0,  3460817715.0,  2966901615.0,   364122213.0,  2253921649.0,  1203613292.0},
-  {3797479382.0,  3936075546.0,  1170732157.0,  1416737348.0,  3352483797.0,  3796625603.0},
-  {2138282305.0,  3141163611.0,    15997228.0,  1297880640.0,   596832063.0,  3643046261.0},
-  {3120129338.0,  2325928525.0,   523016654.0,  2381603908.0,  3799113523.0,  1222543757.0},
-  {3361990312.0,  2805038520.0,  2347330065.0,  2230477579.0,  3394448156.0,   177671803.0},
-  {3588077445.0,   755495138.0,  1517460104.0,  1251348528.0,   682498523.0,  1345938207.0},
-  {3028880448.0,  1574604645.0,   643845875.0,  3664357575.0,  4031963432.0,  4200683359.0},
-  {3643989882.0,   511900407.0,   980633776.0,   870511652.0,  3578062369.0,  1212340081.0},
-  { 906361602.0,  2804758153.0,    61880755.0,  4292946801.0,  2089964810.0,  2030050481.0},
-  {1840899707.0,   867949713.0,   946726928.0,   562520096.0,  3191918461.0,  1167767867.0},
-  {3057764821.0,  3495866685.0,   922113089.0,  4114694540.0,   737902763.0,   355551525.0},
-  {2243276211.0,  2901985477.0,  2678890918.0,  2599807441.0,  3926983675.0,  1684736989.0},
-  {4198645384.0,   947332272.0,   139872942.0,  1471119933.0,  2533455386.0,  1369950405.0},
-  {1451992806.0,  3089360563.0,  2939285075.0,   541633331.0,   938727523.0,   423776510.0},
-  {2808128078.0,   586899274.0,  3696575452.0,  1621047444.0,  3807579860.0,  1452100927.0},
-  {3124351060.0,   218057846.0,   495446257.0,  3502877749.0,  4100144223.0,  3713354988.0},
-  {2414783332.0,   643478261.0,  2432426332.0,  2277346920.0,  2269676601.0,  1632676202.0},
-  {4235276929.0,  3588696161.0,  3856888696.0,    30142383.0,  2205486506.0,   429174739.0},
-  {1371599451.0,  4236099395.0,  4094951423.0,  3999688151.0,  1426570093.0,   611039932.0},
-  {3569536606.0,  1091958157.0,  3528449919.0,  1403233112.0,  2382293827.0,  2417820607.0},
-  { 227034275.0,  3416052661.0,  1661710798.0,   661013906.0,   545968717.0,  1758750608.0},
-  {2463587077.0,  1875022056.0,   434936682.0,  2688535264.0,  2784876435.0,  4069452989.0},
-  { 641282433.0,  4275086294.0,  1255271152.0,  1248037691.0,    87814717.0,   651080983.0},
-  { 481433064.0,  1903017470.0,  3727850229.0,   421623164.0,  2908494743.0,  1958693555.0},
-  {2289018218.0,  2428158170.0,  2966648543.0,   841073738.0,  3592242466.0,   201363367.0},
-  {1962656610.0,  4240726183.0,  2351724879.0,   282972604.0,  3423229453.0,  3962143192.0},
-  { 464140915.0,  3952705443.0,   124642129.0,  1810048807.0,  2638444494.0,  2698103550.0},
-  {1867426988.0,  2799437267.0,     4135144.0,  2955755796.0,  3832529204.0,  3207404309.0},
-  { 541898922.0,  1442428181.0,  3551529170.0,  4179174038.0,  3891321220.0,  1464168133.0},
-  {3391413135.0,  2622391160.0,   537739930.0,   776459724.0,  1317008935.0,  2635748987.0},
-  {4053640879.0,  3460846943.0,  3000129650.0,   587990416.0,   495409766.0,   807846766.0},
-  { 418925487.0,   274948238.0,  2010346799.0,  3826769485.0,  4164115386.0,   882135598.0},
-  { 933550430.0,  1653517636.0,  4196829665.0,   946352104.0,    80866595.0,   618453894.0},
-  {4146093629.0,  1325747600.0,   197054796.0,   386623299.0,   149843113.0,  3412795930.0},
-  {2999487580.0,   230452210.0,  2429369374.0,  2883958854.0,   497571784.0,  3576149563.0},
-  {2252269389.0,  3919891925.0,  2909747244.0,  2153670272.0,  1170328805.0,  1143222828.0},
-  {1997134908.0,  1150313486.0,  1854227844.0,  4026078065.0,  1828414448.0,  3248451067.0},
-  {4124522542.0,  1290608950.0,  3481754372.0,  2412494019.0,  1296411240.0,  3027272348.0},
-  {2342491743.0,  3847073824.0,  4135533405.0,   321493421.0,  4190536265.0,  3619601750.0},
-  {3388770929.0,  3160400353.0,  3687751957.0,  1167634256.0,  1902550505.0,  1873992334.0},
-  {3759717847.0,  3213212374.0,  2445162396.0,   221020753.0,   533695449.0,  2775761058.0},
-  {2854211309.0,  1584197265.0,  2480546675.0,   425594695.0,  1136793499.0,   238094769.0},
-  {3350517708.0,  4253046309.0,  1328749306.0,   194004358.0,  3754481882.0,  1785889189.0},
-  { 494130791.0,  3008493071.0,  3590828152.0,  2314315515.0,  1180937358.0,  3462973905.0},
-  {3049286595.0,     3948136.0,  3491383506.0,  4266628748.0,  3272230423.0,   108533379.0},
-  {1378593768.0,  2670486781.0,  2070102186.0,  2696217500.0,   911298870.0,  1078017659.0},
-  {  12901094.0,  3787827642.0,  3688496300.0,  1212136156.0,   628434025.0,  1261405780.0},
-  { 271703989.0,   524245772.0,  2197066219.0,  3244959869.0,  1887915084.0,  2875825909.0},
-  {2482153750.0,  2112647088.0,  4202873856.0,   925454909.0,  1455807555.0,  1218071863.0},
-  {1362605131.0,  3363685363.0,  1463640294.0,  3672639110.0,   654966893.0,  1448058852.0},
-  {3938389649.0,  1253768665.0,  1914988782.0,   772200871.0,  4131213167.0,  1909221553.0},
-  { 206614789.0,  4264719645.0,   236485817.0,  4084287148.0,  3314905090.0,  3755411648.0},
-  { 676632103.0,  2532501888.0,  4275885085.0,  3658517363.0,   425615357.0,   602934262.0},
-  {1956024667.0,   460611777.0,  4035431772.0,  2633123204.0,  1938738252.0,  1883319355.0},
-  {2832098041.0,   884189530.0,  2081408232.0,  2445456502.0,  4215852099.0,  2882745928.0},
-  {3985090099.0,  4202977301.0,    32459739.0,  2255342584.0,  3086827318.0,  3042375014.0},
-  {3874305609.0,   118067981.0,   863202821.0,  2900464577.0,  1728573182.0,  1722844467.0},
-  {1814231805.0,    28624892.0,  3161617545.0,  3151183959.0,  3283768216.0,  3123510444.0},
-  { 605262933.0,   591984300.0,  1033405596.0,  3617733144.0,  1709517125.0,  3382700353.0},
-  { 359675016.0,   302003813.0,  3305985073.0,   450161633.0,  3564906935.0,  2347440271.0},
-  {2281878569.0,  2413658924.0,  1106721264.0,   152078019.0,  1141090709.0,  2846227135.0},
-  { 629859650.0,  2536209463.0,  2637135672.0,   755468053.0,  3242706820.0,  2748599625.0},
-  { 542618152.0,  3691848157.0,  3832512964.0,  3625109208.0,  3317129913.0,  1255694435.0},
-  {1007645013.0,  2875173034.0,  3414806068.0,   352784783.0,   464249984.0,   743651193.0},
-  {2743258772.0,   201620562.0,  2744314056.0,  2468585228.0,  1735297255.0,  2627357574.0},
-  { 615289585.0,  3550774033.0,  3260834107.0,  1169423787.0,  1464349699.0,  3160775612.0},
-  {2089632903.0,  2689541001.0,   458431986.0,  3231605395.0,  2958608764.0,  1392192548.0},
-  { 512443411.0,  1633745733.0,  3593422217.0,  3070178896.0,  3063601273.0,  3718648316.0},
-  {2059200915.0,  3401374821.0,  3181189815.0,  3554168599.0,  3485006773.0,  1700004218.0},
-  { 695250905.0,  3286151945.0,  2376232595.0,  3707052570.0,  1341567785.0,  1884427362.0},
-  {1373269901.0,  4184388936.0,  3857035811.0,  3908860835.0,  1476390320.0,  4288540981.0},
-  { 891684624.0,  1715316827.0,  4279803560.0,  4257092602.0,   978121063.0,  2795008526.0},
-  {2228053336.0,  2820897326.0,  1186743962.0,  3812148280.0,  2876786178.0,   828135213.0},
-  {1064551364.0,  2529768177.0,    97292177.0,  1526535668.0,  2895749156.0,  3359698555.0},
-  { 862193760.0,  2271890791.0,  3370552772.0,  2839716094.0,  3826729835.0,  3242635093.0},
-  { 515070459.0,  2653937110.0,   177385904.0,  2403130528.0,  1120505592.0,  1393960514.0},
-  {1723328106.0,  3041845811.0,  1620050142.0,  2739217498.0,  1890863869.0,   353642478.0},
-  { 993858693.0,  2216442630.0,   967355584.0,  2681160943.0,  2036747334.0,   332367843.0},
-  {1267277493.0,  1494825420.0,  1243139709.0,  4158811179.0,  3132493850.0,   833002646.0},
-  { 934685652.0,   290486306.0,    56536114.0,  3802562147.0,  1855639785.0,   880758271.0},
-  { 901871607.0,  3193482534.0,  2243757339.0,  3622640266.0,  3683571219.0,  1190455968.0},
-  { 533030785.0,   435598850.0,   881196698.0,  2204599703.0,  3357972135.0,  4229217479.0},
-  {3254772538.0,  2688831529.0,  2657010794.0,  1607232508.0,  2217154803.0,  2246636999.0},
-  {3419481628.0,  2148754477.0,  2436898848.0,   967517242.0,  3759229936.0,  3202764261.0},
-  {  41562598.0,    71666820.0,  2761083499.0,  2686584275.0,   343735536.0,   796430878.0},
-  { 710619262.0,  2808130450.0,  1605823713.0,  1745744190.0,  1011986994.0,  3979843543.0},
-  {2224293517.0,  2688398418.0,  1394629523.0,  2582715113.0,  2124747055.0,  1262321501.0},
-  {4228445180.0,  4133772077.0,   591582341.0,  1759001410.0,   660039537.0,  3256439755.0},
-  {3337955896.0,  3992001188.0,   526079332.0,  1258493241.0,  3052872740.0,  1258108447.0},
-  {2229362902.0,  2585368541.0,  1071420700.0,   952926931.0,  2238535533.0,   239828374.0},
-  { 882765648.0,  3801324461.0,  3776981681.0,  1215204556.0,   389558287.0,  1563531656.0},
-  {  40987241.0,  3521978414.0,  2374686255.0,   440076856.0,  1532863469.0,  1018771130.0},
-  { 599949072.0,  3909823043.0,  1562754491.0,  3620773082.0,  2371134703.0,  1900873019.0},
-  {2141348246.0,  3095274538.0,  3455679039.0,  2322973759.0,  2658743697.0,  3253045895.0},
-  {3960340797.0,  3676128972.0,  1632229246.0,  1950192755.0,   458492417.0,  1978882094.0},
-  {1008527080.0,   876095021.0,  2434443399.0,  2140187281.0,   171706337.0,    70678448.0},
-  { 148011215.0,  1952654014.0,  1527097033.0,  3252855985.0,  1622725642.0,  1735069628.0},
-  { 202751234.0,  2340271294.0,  1295899197.0,   234555967.0,  3927720675.0,  2050727898.0},
-  { 336036036.0,  2179941381.0,  3604785521.0,   201589774.0,   119665719.0,  4223771519.0},
-  { 301333505.0,  1684680876.0,  2362489409.0,  2166802943.0,  1035021309.0,  1074120246.0},
-  {3162036157.0,    24888119.0,    38984105.0,  1458392530.0,  2805088390.0,   407680477.0},
-  {3058159131.0,  2827656233.0,   932712750.0,  3978623565.0,  3681776236.0,   661416555.0},
-  {4103067783.0,   580997924.0,   274822529.0,  2020566200.0,   576366389.0,  2392479788.0},
-  {3749112782.0,  2238409614.0,   303976447.0,   321877606.0,  2174437690.0,   490565860.0},
-  {1761373319.0,  2327482249.0,   619349908.0,  1264030889.0,  3996836257.0,  1658977437.0},
-  {2915458691.0,   642246446.0,    44268955.0,  3397990247.0,   966209018.0,  3838572398.0},
-  {1178964412.0,  4214139862.0,  3748834543.0,  3462925639.0,   131920978.0,  1667919959.0},
-  {4290681595.0,  2348018960.0,  3964034763.0,  2398569806.0,  3039885261.0,  4194206532.0},
-  {3466892066.0,   638208989.0,  4049974204.0,   993895522.0,  1538865211.0,  2411161440.0},
-  {4039878920.0,  1810893530.0,  2063891536.0,  4015728155.0,  1498510938.0,   333410094.0},
-  {3657535120.0,  2629811916.0,   621345869.0,  3371679352.0,  1520363735.0,  1654259954.0},
-  {2080656341.0,  2150334421.0,  3767375157.0,  1852214765.0,   102862724.0,   437464171.0},
-  { 594579819.0,  3741988613.0,  2037010022.0,  3126874363.0,  1860251484.0,  1519608210.0},
-  {3388754348.0,   501570461.0,  1825865628.0,  3283159057.0,  3964932520.0,  1450168132.0},
-  {3502200594.0,  3190777728.0,  1626480583.0,  3709421918.0,  3404537598.0,   841507093.0},
-  {1497981565.0,  3171382460.0,  2553573914.0,   539601440.0,   636520685.0,  2607068141.0},
-  {1785861599.0,  2317260784.0,  2011249928.0,  1640818796.0,  1263567890.0,   433925534.0},
-  {2548730897.0,  3392896499.0,  3366978463.0,  1477983217.0,   114805941.0,  1926906274.0},
-  { 502447086.0,  1676067047.0,  4293014815.0,   440255078.0,  2997203862.0,  1910233671.0},
-  {1298946738.0,  4233667680.0,  1957900192.0,  2289370031.0,  2700157335.0,  3199442894.0},
-  { 375383680.0,   847343187.0,  1730038885.0,  3098968270.0,  1719745154.0,  3323117781.0},
-  {1128438177.0,  4174289271.0,  2619084673.0,  1040055615.0,  2639984000.0,  2047597960.0},
-  {2444716104.0,  3680469249.0,  1384289495.0,  2751335136.0,  3774393720.0,  1221940723.0},
-  {1197793826.0,  4017357699.0,  4064549170.0,  3128484955.0,  3075673549.0,  1267800159.0},
-  {1591938835.0,  2403186451.0,   954513200.0,  1503596877.0,  3805953979.0,  3843402673.0},
-  {1663284919.0,  2950994342.0,   770299692.0,  2597321102.0,  2343097653.0,   426462407.0},
-  { 538288979.0,  3934337918.0,  1176786217.0,  2641405614.0,  2860201990.0,  2927873192.0},
-  {4092617407.0,  1910131505.0,   418750627.0,  1704973464.0,  2940419689.0,   782292003.0},
-  {3853956343.0,   205980237.0,  2877128937.0,   348044784.0,  2437371638.0,  1568212422.0},
-  { 317171160.0,  3358678458.0,   394476748.0,  2311113367.0,  1836718110.0,  4197276594.0},
-  {3887298454.0,  1607251275.0,  1428322120.0,  1997154648.0,  4063405934.0,  3105205364.0},
-  { 909707545.0,  1865558846.0,  2534892911.0,  3372944806.0,  1421067633.0,    18390196.0},
-  {3240282549.0,  2295529414.0,  1454367152.0,   584252641.0,   927514300.0,   236264458.0},
-  { 425666054.0,  1639728578.0,  1255553540.0,  2594557364.0,  3454933504.0,  3696531306.0},
-  { 282606485.0,   757206554.0,  3753922295.0,  1685381600.0,  1984242810.0,  3364873889.0},
-  { 890947088.0,  1122565180.0,  3890598779.0,  3462633621.0,  1151230134.0,  3590618841.0},
-  { 837330114.0,  2015750705.0,   399514338.0,  2558742648.0,  4070824207.0,  4000712030.0},
-  {3893459939.0,  1790745303.0,  2049370346.0,  1506694517.0,  3311103341.0,   658366210.0},
-  {4184201498.0,  4172409201.0,  2805894169.0,  1004555008.0,  2557620879.0,  4044721959.0},
-  {1746217655.0,  1825967437.0,   200423406.0,  2441311076.0,  2970516165.0,   827428405.0},
-  {3717501695.0,  2009138188.0,  1322767286.0,  2327227896.0,  3941566135.0,  2721323241.0},
-  {2899713745.0,  1369267631.0,  1558151294.0,  3081769237.0,  1765783618.0,  3393246336.0},
-  {4140931791.0,  1903903701.0,  4004599081.0,  1404695629.0,  3628471988.0,  2536500042.0},
-  {2139795265.0,  2112531871.0,  2482525138.0,   786586753.0,  1940069818.0,  2908958838.0},
-  {1561851405.0,  2487023212.0,  2046210082.0,  3874101837.0,  1940814075.0,  2003991993.0},
-  {3134352879.0,  2618304183.0,  3012371093.0,  1233656355.0,  3345475989.0,  2899732248.0},
-  {1417089712.0,  2712362615.0,   606822605.0,  1180111248.0,  4145058311.0,  2916049523.0},
-  { 424676823.0,  3804033320.0,  1642831330.0,  3962679519.0,  1957865322.0,  1449421781.0},
-  {3927500681.0,  4241127340.0,  1374876378.0,   508477919.0,  3872829373.0,  2166228287.0},
-  {3100033314.0,  2582563910.0,  2675778485.0,  3519476081.0,  2687157800.0,  3506734957.0},
-  {4117162527.0,  3726173728.0,  2362045798.0,  3083376779.0,  1882413881.0,  3476777697.0},
-  {3631284867.0,  2981196168.0,  2384917905.0,  3309069948.0,  1883847653.0,  1939462629.0},
-  { 325583953.0,   455513743.0,  1989359873.0,  3477393950.0,  4094002704.0,  2183246162.0},
-  {1058465634.0,  1719425242.0,  2372197263.0,  1175621807.0,  1249271443.0,  1165856520.0},
-  { 643698765.0,  2682063159.0,   325705131.0,  3043213236.0,  1492336351.0,   581358052.0},
-  {1945966319.0,  2791746089.0,   547105503.0,  1184554607.0,   235280346.0,   879973831.0},
-  {1825493211.0,  2800779257.0,  4113200388.0,  3996362816.0,  1479067202.0,   957336137.0},
-  {1717719629.0,  3916624632.0,  1773561382.0,    65293695.0,  4205418605.0,  3066771584.0},
-  {  81239760.0,  2301680097.0,   784349379.0,  2321479690.0,  2754003084.0,  3373516224.0},
-  { 273439524.0,  1626251299.0,  2700497390.0,  2576487881.0,  3602376489.0,  1129314795.0},
-  {2689176250.0,  3940215388.0,  4047625229.0,  1869304357.0,   282060264.0,  2699077086.0},
-  {3855137869.0,   190415859.0,   391877786.0,  3061050572.0,   578160013.0,  3908697641.0},
-  {3985631699.0,  3261255406.0,  2657026857.0,  1036961866.0,   404779710.0,  2303580527.0},
-  { 474049461.0,  4090196268.0,  2103081388.0,  3612293516.0,   762851623.0,  3796945341.0},
-  { 192020585.0,  3449551219.0,  3813775718.0,  1511270125.0,  3168109964.0,  3852586914.0},
-  {2867163910.0,   325171386.0,  3017916514.0,  2462602349.0,  2650947494.0,  1300542838.0},
-  {  16559445.0,  4152518297.0,  3347180287.0,  3459883462.0,  3275867034.0,  1190868188.0},
-  {1051373259.0,  3561095326.0,  2995944263.0,  4154285194.0,  3395811951.0,  2135586162.0},
-  {1080447608.0,  3377836442.0,  2526036073.0,  1368857579.0,  3855430530.0,  1529622592.0},
-  {2186830787.0,  2273754678.0,  3234674558.0,  1760540049.0,   267100789.0,  2705516449.0},
-  { 569713173.0,  1997270543.0,  1762330487.0,  4237660160.0,   876437978.0,   384311785.0},
-  {1451447972.0,   947114401.0,  1480026678.0,  2872716914.0,  1363877522.0,   368679058.0},
-  { 457894344.0,  3522574967.0,  1927388899.0,  1615248633.0,  3157409771.0,  1081157582.0},
-  {1985070290.0,  3814227328.0,  1170785760.0,  1761144369.0,  3747009538.0,   827183444.0},
-  { 322865858.0,   271320731.0,    48853205.0,  1789482524.0,  3780673545.0,  2398962315.0},
-  {2617130435.0,  2027098304.0,  3789321053.0,  2594595210.0,  1291432256.0,  2987705261.0},
-  {1452655197.0,  2790110915.0,   908858822.0,   199957044.0,  4188082398.0,  3938490889.0},
-  {2218177967.0,   439384508.0,  3823989312.0,   117764431.0,  4106989717.0,   924942160.0},
-  {3210051782.0,  4113250965.0,  4191866528.0,  4016544080.0,  1792347725.0,  3944417847.0},
-  {1806991732.0,  3704699106.0,   631583861.0,  2258787948.0,  3640073174.0,  1491339336.0},
-  {4147219047.0,  1770900887.0,  3236328320.0,  1070048606.0,  3295491283.0,  2559757188.0},
-  {2993822812.0,   673373717.0,  2177299044.0,   347508239.0,  2890119952.0,  1118728717.0},
-  {2417835709.0,  2151631901.0,   910618052.0,  1138193705.0,     6401226.0,   695957358.0},
-  {4149835859.0,  3560104503.0,  1798094000.0,  2738355364.0,  1471088341.0,   249794890.0},
-  { 541482619.0,  4224660497.0,  3451969264.0,  4092010499.0,   209927180.0,  1042913322.0},
-  {1549494111.0,  1835598582.0,  1690755570.0,  1729157758.0,  3129478695.0,  4040921980.0},
-  { 356987483.0,   454555191.0,   645517146.0,   820225297.0,  3680398375.0,   939139214.0},
-  {1735468741.0,  3113744697.0,  2053937208.0,   793874707.0,  3062511595.0,  3386339513.0},
-  {2580136100.0,  2045869832.0,   464734262.0,  1024397156.0,   996234690.0,  4245925097.0},
-  {2823376710.0,  3917489660.0,   754830180.0,  2585179295.0,  1653820026.0,  3744309672.0},
-  { 718435847.0,  2106493842.0,  3484773407.0,  1333109354.0,  1506284542.0,  3796148844.0},
-  { 775622208.0,  1547457092.0,  2994971880.0,     7682896.0,  1387670368.0,  2028676436.0},
-  { 136321307.0,  3346498863.0,   736946291.0,  1273521433.0,  4125835926.0,   834346335.0},
-  {1590790769.0,   798327267.0,  3296504845.0,  1799765576.0,  4129690966.0,  4137869587.0},
-  {1434053555.0,  2911134536.0,  1703461407.0,  1142276590.0,  3035367672.0,  1671065772.0},
-  {2848757103.0,  2810433468.0,  4170252862.0,   321968749.0,  2048355870.0,  2348580948.0},
-  {3408462865.0,  1644172479.0,  3468337314.0,    17773538.0,   433785119.0,  3810126310.0},
-  {1301903545.0,  3353455459.0,  1476226613.0,  4275788483.0,  3154786914.0,  1470817047.0},
-  {2339709500.0,  3699717735.0,    89319325.0,  4029830551.0,  2797038428.0,  4235558775.0},
-  {2660619449.0,   739866491.0,  1523313346.0,  1754164860.0,   656162706.0,  3755724112.0},
-  {2791994910.0,   650868612.0,  1726521483.0,  3680427334.0,  3007447057.0,  2533503620.0},
-  {3423944165.0,  1759610451.0,  3594691882.0,  2507291905.0,   748987663.0,  2839460898.0},
-  {2621716418.0,  3425093151.0,  3546193211.0,  3842886799.0,  4201461247.0,   515587915.0},
-  {2581471711.0,  1504775512.0,  2135852448.0,  3062421929.0,  2259528299.0,  3532703425.0},
-  {4196879163.0,  1812562847.0,   907799293.0,  1298792606.0,   278466343.0,  3917372905.0},
-  {1087663164.0,  2938691312.0,   846821016.0,  2504234369.0,  1536154943.0,  2124437298.0},
-  {4278656507.0,  1047215931.0,  2594038458.0,   920122700.0,  3392363390.0,  1075474434.0},
-  {2539944450.0,   365353276.0,  1334260223.0,   358982152.0,   430180316.0,  2624306457.0},
-  {3180356019.0,  2898317889.0,  2842200794.0,  1946092311.0,  3717325314.0,  3837544294.0},
-  {1858256068.0,   586112658.0,  3241236271.0,  3131642194.0,  3244678401.0,  2434191051.0},
-  { 682033211.0,  2543407756.0,  4290264995.0,  2298530562.0,   159123385.0,  3393378652.0},
-  {3409838375.0,  2607992561.0,  3295931756.0,  1217467410.0,  3139950448.0,   857001992.0},
-  {3919809124.0,  2895189152.0,   191423932.0,  3264733051.0,  2916906700.0,   690671997.0},
-  {2047008709.0,  1204075524.0,  3017615537.0,   645907368.0,  1407478697.0,  2318635932.0},
-  {1429180207.0,  4042035625.0,   848598735.0,  3092527302.0,  2206393691.0,  1319522514.0},
-  {2504272548.0,  1251736583.0,    68283748.0,   361404078.0,  4133969874.0,  1649005721.0},
-  { 796957317.0,   893092718.0,  1405909275.0,  3879343156.0,   579622218.0,  3253282592.0},
-  {4058877588.0,  1718873747.0,  3299841770.0,  1311405724.0,  3761352263.0,   569382864.0},
-  {3967793890.0,   298970737.0,   987427027.0,  2155644996.0,  2374266952.0,   999931401.0},
-  {1292521992.0,  3610670871.0,  2831192788.0,   223270463.0,  3584117387.0,   487643399.0},
-  {2270208586.0,    33686469.0,  2418985323.0,  1342918447.0,  1147416754.0,  4278992712.0},
-  {2327891219.0,  1537475968.0,  2424555488.0,  1945777935.0,   481086915.0,  1398031047.0},
-  {2736905344.0,   646216216.0,  1952533257.0,  1368363230.0,  3970188472.0,  2881440660.0},
-  {2736189834.0,  2001535041.0,   341855139.0,  1246115884.0,  2451152358.0,   488877446.0},
-  {1326434096.0,  3278393816.0,  4223650123.0,  3644129271.0,  3401253187.0,  1775891313.0},
-  {3285722079.0,   648456784.0,  3912618406.0,  4271843102.0,  1939972217.0,  2925485935.0},
-  {2272103293.0,  3264207314.0,  2223053110.0,  3715138064.0,  1159400994.0,  1919872520.0},
-  {2955370502.0,  2568599115.0,   834662268.0,  3723818649.0,   708127026.0,  2011906581.0},
-  {2897115441.0,  2591029456.0,  1575274229.0,  3148206230.0,   722252923.0,  3940445619.0},
-  {3334140750.0,  1280880821.0,  2042645084.0,  1958673849.0,  2795716913.0,  3345042296.0},
-  {3743608878.0,   333584168.0,  2168654941.0,  3623905212.0,  1838790779.0,  2546258394.0},
-  {2230826851.0,  1428363353.0,  3313412132.0,  2204267021.0,  2451829586.0,  3871542123.0},
-  { 349296659.0,  1157075772.0,   540841025.0,  1673980750.0,  1547022393.0,  1160416519.0},
-  {3887165175.0,  2527237398.0,  2946474041.0,  3540708425.0,  1195696736.0,  2525628225.0},
-  {3841472496.0,  1655806647.0,  3704417363.0,  3228154436.0,  1026191310.0,  1862055414.0},
-  {1194772198.0,  3256636125.0,   741927990.0,  2974851767.0,   377057391.0,  1787286058.0},
-  {4293869351.0,  2738158954.0,  2625054903.0,   895851839.0,   403486504.0,   827457362.0},
-  {3077703940.0,  1761256050.0,  3265905451.0,  3161808719.0,   444016440.0,  2436525985.0},
-  {1957335067.0,  2439841821.0,  2764089401.0,  1839043647.0,  1460956462.0,  4225947283.0},
-  {3027765609.0,  1789722266.0,    21832532.0,  1888906418.0,  2061187813.0,  2419610985.0},
-  {3180035894.0,  3914026247.0,   614198387.0,  2485587848.0,  1079313367.0,  2301000204.0},
-  {2634051623.0,  2273048567.0,  2410828347.0,   669655185.0,   436776455.0,  3617779489.0},
-  {2560844640.0,  1755410620.0,  3101491992.0,  1100112342.0,   350342577.0,   252079473.0},
-  {3405300022.0,  3828755421.0,  1193171556.0,  3151730808.0,   516113736.0,  3345674767.0},
-  { 573554725.0,  1718025510.0,  3373837967.0,   798383089.0,  3196131940.0,   133381848.0},
-  { 582076198.0,  2860475574.0,   104135208.0,   167239098.0,  4251322676.0,  2332155888.0},
-  {1796706287.0,  1656772293.0,  3884316050.0,   494536528.0,  2408119061.0,  2811213980.0},
-  {2366073121.0,  1767458261.0,  2798239540.0,  3370540892.0,  1165589192.0,  2524322534.0},
-  {4218773313.0,  1338252441.0,  1514079443.0,  4145123082.0,  1557090255.0,  3927393547.0},
-  {2165318873.0,  3399467992.0,  1943595235.0,   981459262.0,  3857323060.0,  3330436102.0},
-  {2637248798.0,  4197050143.0,  4055949221.0,  2633707665.0,  4044226511.0,  1240087339.0},
-  {2130931971.0,   249920340.0,  2130335751.0,  2057432467.0,  1019654012.0,  2541047640.0},
-  {3009990512.0,  3894978694.0,  1494287117.0,  1765697985.0,  2888294617.0,  1371040151.0},
-  {4088480533.0,  2330756812.0,  3011797060.0,  3184651469.0,   542291631.0,  1085890946.0},
-  {1128962358.0,  2154136329.0,  4162736640.0,  1071839690.0,  2273383523.0,  2724447374.0},
-  {2675339078.0,  3820792658.0,  3981226619.0,   185771621.0,  2614763964.0,  3875479631.0},
-  {2836614839.0,  2722285795.0,   757328757.0,  4185406548.0,    12027403.0,   865728148.0},
-  {2395154723.0,  1163540359.0,  1875251691.0,  1687587572.0,  2051568694.0,   439228440.0},
-  {1385162601.0,  2198738943.0,  4034385169.0,  2860991370.0,  3153904770.0,  3873017287.0},
-  {1825101308.0,  2939484033.0,  3303579977.0,   600071498.0,  3334764908.0,  1769835740.0},
-  {2250412096.0,  1416535464.0,   281547301.0,  1567226180.0,   725763306.0,  1521329024.0},
-  {2592586006.0,   444968027.0,  2347121214.0,  1056059298.0,   958601786.0,  2989473595.0},
-  {4000180820.0,  3258897613.0,  1313887811.0,  3798913293.0,  3405057546.0,  1052951675.0},
-  { 598009393.0,  3191619940.0,  1421043347.0,  1907497173.0,   976656687.0,  3479704048.0},
-  {3063793252.0,  4071958431.0,  2905113964.0,  3395837759.0,  2046975386.0,   476492682.0},
-  {1305683883.0,   227524202.0,   154839268.0,  2376425810.0,  2708836997.0,   420611167.0},
-  {4135356407.0,   482492990.0,  4056683243.0,  2248871194.0,  4043999165.0,   877585840.0},
-  {3422441354.0,  3074850785.0,  1502720580.0,  2161112764.0,  1551347504.0,  1199811192.0},
-  { 830455435.0,  2456885701.0,  1272206308.0,  1472213231.0,  3489707362.0,  2119372569.0},
-  {3562512411.0,  3564690487.0,   449937598.0,  1145641453.0,  3609786659.0,  1974084445.0},
-  { 905657511.0,  2167570736.0,   554845564.0,  2470624194.0,  1710493583.0,  1926533065.0},
-  {1347421801.0,  2089399932.0,  2956374979.0,   176523507.0,  2859402931.0,  3107277493.0},
-  { 456663715.0,  3314868222.0,  3542196414.0,  1936447396.0,  2626422045.0,  1219959982.0},
-  {2367683075.0,  2187609661.0,  1717204646.0,  2448671955.0,  2112989714.0,  3059302932.0},
-  {2031843000.0,  3481487100.0,  3907334284.0,   781222111.0,  2393349216.0,  2139317630.0},
-  { 663854753.0,  2408651988.0,   371526762.0,  2434041469.0,   968420535.0,  2803919921.0},
-  { 375733315.0,   230455798.0,  2554002812.0,  2963921438.0,  2659499977.0,   888611947.0},
-  {2455065014.0,  1218491293.0,  1823923773.0,   423320814.0,  2212076267.0,  2500852991.0},
-  {3578631464.0,  2313119678.0,  1419974295.0,    88278758.0,  4160451023.0,   485185053.0},
-  {4174071608.0,   534548534.0,  2301346752.0,  1492362395.0,  2040929292.0,   273005877.0},
-  {3481223303.0,  3683780622.0,  2814295013.0,  2185357943.0,   198461528.0,  1445637037.0},
-  {1169784885.0,  1126238782.0,  2136904463.0,  1059507888.0,  3458192559.0,  3871165228.0},
-  {1909535977.0,  4105421794.0,  4004685090.0,  2316003071.0,  3897900711.0,   535558399.0},
-  { 897625994.0,  1103066635.0,  1001726243.0,  2392586846.0,  1621086768.0,    65680831.0},
-  {3931587446.0,  3319542358.0,  1265250698.0,  3401541694.0,   857408826.0,  3065313868.0},
-  { 944076567.0,  3024799059.0,  3679936876.0,  2674405303.0,  2924905078.0,  4247905389.0},
-  {   2711440.0,  3176876007.0,  3951572137.0,  2421002468.0,  3221390068.0,  4157639675.0},
-  { 196771823.0,  2679586890.0,  3094614176.0,  3988739518.0,  1194163067.0,  2298585027.0},
-  {4289660606.0,  3817157985.0,  3903989612.0,  2306234006.0,   370506003.0,  1281770665.0},
-  {2094172964.0,  1207013882.0,  2099625025.0,  3319664104.0,  3729119989.0,  2284178546.0},
-  {2497116432.0,   853269256.0,  2771508096.0,   247293292.0,  2722329274.0,  3728230272.0},
-  {1094730031.0,    43585620.0,  3769988681.0,  3861928494.0,  4187849575.0,  2718016102.0},
-  { 932644926.0,  2673010277.0,  3367243931.0,   794126928.0,  2394465562.0,  3587774044.0},
-  {1431658589.0,  2286341279.0,  1904842570.0,  2258077320.0,  4161071825.0,   660188478.0},
-  { 416746604.0,    83244088.0,  3447336230.0,  4242896861.0,   829053252.0,  1419290670.0},
-  {3771075968.0,  1416790525.0,  3732508757.0,   501837852.0,   479973730.0,  3182857801.0},
-  { 902442561.0,  1046903762.0,    58355306.0,   937411296.0,  3262400710.0,  1483431601.0},
-  {1089156574.0,  3740398304.0,  1606986176.0,  3584281319.0,  1819928947.0,  1250323678.0},
-  {2596076615.0,  2002436719.0,   107885344.0,  3187863784.0,  1581300986.0,  3794973885.0},
-  {3181408954.0,  1147526847.0,   472879824.0,   580779608.0,  1154448826.0,  2829169156.0},
-  {1753682051.0,  4243536472.0,  2569320353.0,  1897302786.0,  4087585400.0,  1171250628.0},
-  {3147611449.0,  2620088986.0,  2968110424.0,  3429835803.0,  3769899494.0,   791690207.0},
-  { 630601617.0,  3091609742.0,  3607374257.0,  1671107281.0,  2876287260.0,  3310299383.0},
-  {3603618426.0,   251951437.0,  1235984013.0,  1430903386.0,  2987263413.0,  4056739525.0},
-  { 744517689.0,  4185894206.0,  2935720364.0,  2203750657.0,  3947342475.0,   661166798.0},
-  {1283826915.0,   586151741.0,  3904861423.0,  4055118309.0,   931982480.0,    17130091.0},
-  {2943320785.0,  4182925785.0,  2057798841.0,   505667064.0,  2901247073.0,  3891463298.0},
-  { 848159701.0,  2268418208.0,  3792800927.0,  1421453597.0,  2221821591.0,  4036670930.0},
-  {3788957388.0,   298305948.0,    28016636.0,  1082397307.0,   300372351.0,  3405751462.0},
-  {1208015555.0,  1660719873.0,  2421849286.0,  3985432447.0,  2015346380.0,  2906117857.0},
-  {3697734188.0,  2856812626.0,  4101439506.0,  3029692937.0,   367297563.0,  2038826091.0},
-  { 576649332.0,    87915207.0,   739860436.0,  4140776647.0,   897267896.0,  2042143977.0},
-  {2163281959.0,   517755722.0,  2878809596.0,  4050421866.0,  2216563643.0,  1680318602.0},
-  {3125181225.0,  1139649609.0,   503125967.0,  3541260427.0,  1066816633.0,  4038356660.0},
-  {3798714590.0,   573658154.0,  1451015045.0,  3103984931.0,   496064191.0,  2062627034.0},
-  { 235149681.0,  2285944212.0,  4174848730.0,   616484819.0,   720056478.0,  1716490888.0},
-  {3302760427.0,  1995465771.0,   984927285.0,  2708641994.0,    27202719.0,  3884824710.0},
-  {1335962018.0,  3571942910.0,  1601745687.0,    91345032.0,   228125261.0,  1994893297.0},
-  {1214496544.0,  3985328598.0,  3939744012.0,  3729315371.0,   619167372.0,   555631663.0},
-  {3236414038.0,   798357710.0,  3617925523.0,  2569652870.0,  4120829099.0,  4038818122.0},
-  {4220556251.0,  3754971651.0,  2073549678.0,  2003832686.0,  3098860360.0,   595800618.0},
-  {3680856315.0,  3845771399.0,  3965714510.0,  3761111104.0,  1064862571.0,   574889971.0},
-  { 710407553.0,  3564171465.0,  1828772707.0,  2975717848.0,   232213387.0,  1876321663.0},
-  {3462476960.0,  2720313049.0,   139357759.0,  2134699216.0,  1170027416.0,   458154570.0},
-  {2736286438.0,  3555944963.0,  1616240749.0,  2087912628.0,  3856508485.0,   248739178.0},
-  {3988386464.0,  2056397954.0,  3646648531.0,    22230156.0,   592382991.0,   926409273.0},
-  {1077306850.0,   340567885.0,  1504011608.0,  2850499029.0,   707023135.0,  2901600293.0},
-  {3315553110.0,  1492905196.0,  3861427225.0,   382462534.0,  1620455723.0,   646816756.0},
-  {2058405220.0,  2999819881.0,  1268734840.0,    19779323.0,  2011080349.0,  2217856637.0},
-  {3432627780.0,  1400673751.0,   103431249.0,  3454003166.0,   178475023.0,  2043190015.0},
-  {2948433028.0,  2754842187.0,  4112404491.0,  1968096388.0,    72391511.0,  3652679689.0},
-  {3872840661.0,  3740145362.0,   762035336.0,  4229308498.0,  2302983650.0,  3049007953.0},
-  {3989671836.0,  1648952770.0,  3235499686.0,  3467857918.0,  1834300470.0,  3534877151.0},
-  {3541362754.0,  4265524355.0,  1741881267.0,   726363723.0,  1946654101.0,  2528798707.0},
-  {3924000994.0,  3991588544.0,   199297628.0,   884684643.0,   926444742.0,  2874891550.0},
-  {4145564558.0,  4174177173.0,  4232807334.0,  2228812555.0,   607438020.0,  2875303655.0},
-  { 912474989.0,  4152684439.0,   309493194.0,   919779640.0,   305355414.0,  1226614470.0},
-  {2975959931.0,  3840506002.0,   955881629.0,    43474673.0,  3479181401.0,  1819028332.0},
-  {2070675805.0,  3543227541.0,  3790620780.0,  2665079516.0,  3884489435.0,   557112889.0},
-  {3511087867.0,  3777855834.0,  2140023960.0,    31885320.0,   899671978.0,  1660242740.0},
-  {2850633838.0,  4204376486.0,   126203166.0,  1794812597.0,  3827037883.0,  1462570561.0},
-  {3179495172.0,  3200915400.0,  2291900735.0,  1414067526.0,   781571115.0,  3451102864.0},
-  {3488452079.0,  1429440471.0,  2982922442.0,  4103448328.0,  2866625005.0,   209921361.0},
-  {4212331636.0,  1286719168.0,   658533104.0,  3354497223.0,  2135771679.0,  1670254581.0},
-  {4011600437.0,  2497965197.0,  4257946217.0,  2845953983.0,  1624668136.0,  1182907064.0},
-  {1060669241.0,  2789082113.0,  3758524425.0,  1221287922.0,   854817450.0,  1691516658.0},
-  {3163050820.0,  3748858825.0,  4028904742.0,  1795560715.0,  4085748866.0,  2621448918.0},
-  {2523878609.0,  3722251112.0,  3316885487.0,  3718189592.0,  4076161136.0,  3765048769.0},
-  {1542028708.0,  3891105156.0,  4066495067.0,   833291062.0,  3216744247.0,  4030763650.0},
-  {3124840224.0,   783250942.0,  3183812115.0,   891083210.0,  3317403702.0,  1275278961.0},
-  {1473108976.0,   299984934.0,  1734024667.0,   871307300.0,  2836297547.0,  2073202924.0},
-  {1686445048.0,  1720167336.0,  2141665326.0,  2714867518.0,   126830467.0,  2538836675.0},
-  {2190709566.0,  2914306104.0,   329390770.0,  1820195945.0,  2466222571.0,  4148500677.0},
-  {3198479313.0,   706123945.0,   816158539.0,  3192855939.0,  3961712337.0,  3396092732.0},
-  {2909255439.0,  1836753969.0,  3520245974.0,  2805046417.0,  2836713120.0,  1037536854.0},
-  {4204888721.0,  3150025581.0,  1009195501.0,  1621240207.0,  1391955195.0,   554655038.0},
-  {1320815333.0,  3717822383.0,  2982438832.0,  2170006981.0,  1437987601.0,   366913157.0},
-  { 956145690.0,   554663276.0,  2651955896.0,  1726523688.0,  3631128900.0,  2970248943.0},
-  {3967084151.0,  2757371988.0,  3448781057.0,   536529178.0,  2551322931.0,  2920854194.0},
-  {3920737178.0,   609743544.0,  3003572460.0,   781114293.0,  2329668221.0,  3559002233.0},
-  {2855179294.0,   423359002.0,  3337701809.0,  4198425888.0,  2003410692.0,  1516192522.0},
-  {1647889391.0,   194993094.0,    26969843.0,  4007711768.0,  1691211761.0,  2430799517.0},
-  {2190517485.0,  3561871861.0,  1655041990.0,  2311127618.0,  2620242093.0,   951676882.0},
-  {3462948979.0,  1794901729.0,  1118876650.0,  2031408578.0,  3990933298.0,  3883223641.0},
-  {3422265443.0,  1784662843.0,   378259699.0,  2501000670.0,   152515145.0,  4066959772.0},
-  { 468653962.0,  3297789577.0,  2696645620.0,  2291661222.0,   466861773.0,    64282811.0},
-  {  84791907.0,  2980519464.0,  3981132204.0,  1304396299.0,   275933808.0,  3704250690.0},
-  {2931603822.0,  3431672300.0,  3604627684.0,  4152858077.0,  3893854809.0,   872989699.0},
-  {2266227519.0,  2379240391.0,  3268105700.0,   170950984.0,  2794315630.0,  1784036601.0},
-  { 559585581.0,  2660916816.0,  1556279368.0,   667873824.0,   319289253.0,  2677695625.0},
-  { 919976214.0,  3646274224.0,  4241429374.0,   747689002.0,  3844648275.0,  1382620217.0},
-  { 747317678.0,  2262683220.0,  4133413693.0,  1504539852.0,  3646185243.0,    46030270.0},
-  {1320451207.0,  3264679962.0,   563720005.0,  2071296158.0,  2704203071.0,  2494673692.0},
-  {3276071819.0,  3132662499.0,  2645232441.0,  3804964560.0,  4015779396.0,  2920246194.0},
-  {1030824586.0,  1761322132.0,   357254325.0,  4096094257.0,  2940402680.0,   539564763.0},
-  { 304950453.0,  1857863510.0,  1871665378.0,   629829170.0,  1495322636.0,  3898433719.0},
-  { 375726440.0,  1124956035.0,  3235689363.0,  4171270662.0,  1434683350.0,   303787411.0},
-  {3807237778.0,   163165617.0,  1964999928.0,   497187901.0,  4011909594.0,  2623204567.0},
-  {3261160233.0,  3710328380.0,  2121825365.0,  4221673200.0,  4035329079.0,   506863608.0},
-  { 506261070.0,  1050475538.0,  2693078591.0,   920321913.0,  4058017623.0,   360125043.0},
-  {4226563994.0,  1871919306.0,  1027083419.0,  2839142043.0,  1437085438.0,   447409210.0},
-  {4187828149.0,    60049970.0,  1909012126.0,   732442156.0,    14888955.0,  1339308092.0},
-  {3581290729.0,  1252096962.0,  1437066211.0,  1160304044.0,  2641988754.0,   984582294.0},
-  {2475587807.0,  4090201015.0,   783128349.0,  3916967135.0,  4250883767.0,   884681463.0},
-  {2215970904.0,   525969142.0,  1681530363.0,  1586992710.0,   489458249.0,  3258736476.0},
-  {2859532622.0,   166371955.0,  3304957712.0,   977907114.0,  3365730487.0,   609764986.0},
-  {2782586690.0,  3221436527.0,  3683189403.0,  2769482651.0,  1980777371.0,  1996037754.0},
-  {2899269871.0,   706978245.0,  3695688172.0,  4049940209.0,  4270996865.0,  3871713188.0},
-  { 498531288.0,  1695173333.0,  2335723280.0,   515863601.0,  1519261247.0,  3610345071.0},
-  {1977371213.0,  2686561089.0,  1884923384.0,  1536138846.0,  4101197460.0,   650643781.0},
-  {2727708552.0,   301976287.0,  1822679329.0,  3880899801.0,  1213608658.0,  3737614352.0},
-  {3207713877.0,  1515192642.0,  3168391274.0,  3058655878.0,  2235337339.0,  3042700801.0},
-  {2253993529.0,  3588669150.0,   362927418.0,  1202952116.0,  2109398828.0,   594288686.0},
-  {3588911990.0,  1801851902.0,  1053024243.0,  1764424476.0,  3255332806.0,   992019447.0},
-  {2138925513.0,  1480501276.0,  1713293051.0,  1819373853.0,    24689397.0,   961462416.0},
-  {4153839856.0,  1753279570.0,  1184886646.0,  2054293885.0,  1251826977.0,   964950929.0},
-  {3864544726.0,   158123359.0,  3843465575.0,  1065847363.0,  2753170952.0,  1726540503.0},
-  {2464771221.0,  4241621719.0,   298477568.0,  1581539390.0,  3810520160.0,  2454472203.0},
-  {1777206610.0,   507581964.0,  1390043975.0,  3195166058.0,  3704014027.0,  3148486930.0},
-  {3383027026.0,  3260827426.0,  4188905819.0,  1903409116.0,  3681725015.0,  3374730765.0},
-  {   4845606.0,  3229999272.0,  3702026424.0,  2838634592.0,   896263470.0,  1306064374.0},
-  {3348816538.0,  3469614505.0,  2952185493.0,  2030429733.0,  4185158912.0,   533576889.0},
-  {2895640493.0,   593028285.0,  3705006295.0,  3632081384.0,   273282566.0,  2384723769.0},
-  {1549090757.0,  3126568103.0,  3497484266.0,  1277023402.0,  1149134035.0,  2374837136.0},
-  {2158144687.0,  2497341733.0,   768268437.0,   965613873.0,  3551159507.0,  1347763285.0},
-  { 155889014.0,  1617422703.0,   870016072.0,  3002744122.0,   490653016.0,  2195858692.0},
-  { 440952789.0,  2271184322.0,  3414352132.0,  3395804066.0,  3855648664.0,  2105348948.0},
-  {1739316655.0,  4213996293.0,    21968583.0,  2565222544.0,  4004594919.0,  2215313462.0},
-  {1359781560.0,  1122986728.0,  3245666483.0,   217792150.0,  3249536779.0,  1721238085.0},
-  {3247687024.0,   372624298.0,   756891602.0,  2832288208.0,  2698078160.0,  3743398960.0},
-  {1032887422.0,  1168085426.0,  1616217091.0,  1731762363.0,  1753822025.0,   404159245.0},
-  {  24241093.0,    75921008.0,  3794356246.0,  1923887982.0,   670758795.0,   215412908.0},
-  {4189717186.0,  1400748691.0,  3470020011.0,  4137205654.0,  2713853670.0,  3567394762.0},
-  {3256756525.0,   568312956.0,  1709608081.0,  2433365048.0,  3276486969.0,  1237784866.0},
-  {3940738327.0,  3276959868.0,   281121812.0,  1854044821.0,  3281854444.0,  1422187222.0},
-  { 264214002.0,  1018835162.0,   958502117.0,  2766390974.0,    18592347.0,  3285388008.0},
-  { 370673437.0,  1271949995.0,  3747354239.0,  1762776974.0,  3799255877.0,  2467807397.0},
-  {3015844294.0,  1268663301.0,   840021577.0,  2704008921.0,  1846833228.0,  3615476669.0},
-  {1778056226.0,  2053432178.0,  2179021760.0,  3186783648.0,  1270479025.0,  1352285122.0},
-  {3557758012.0,  2183272163.0,  1299098170.0,  3846815497.0,  2743571450.0,  4073949615.0},
-  {1732876294.0,  4117748571.0,   771071178.0,  3622855920.0,  3247916538.0,   956483487.0},
-  {1266458966.0,  1205313061.0,  4292507034.0,  2011531599.0,  3992945088.0,   799812398.0},
-  {1982849541.0,   445048911.0,  1842888988.0,   587399401.0,  2567889317.0,  2074712071.0},
-  {2767611010.0,  1151803667.0,  3403746795.0,  1921896548.0,   196241278.0,   131171074.0},
-  { 129327436.0,   883339594.0,   971645111.0,  2065342740.0,  4000944586.0,   454763380.0},
-  {3638480462.0,  2235385838.0,  2447382063.0,  2913909405.0,  1067832221.0,   376604703.0},
-  {1334632553.0,  1711998559.0,  2892398372.0,  1084085605.0,   542170904.0,  3187669853.0},
-  {2228111832.0,   360646595.0,  4212119462.0,  2964207743.0,  4263497288.0,  1747881995.0},
-  {1279753101.0,  3995695602.0,   345267719.0,   626185163.0,  1286444963.0,  1347236279.0},
-  {1704535580.0,  1256346211.0,  1549412053.0,  2768559060.0,   464559701.0,  2151258255.0},
-  { 625368392.0,  4006842317.0,  1186700376.0,   483154190.0,  2808947426.0,   598109870.0},
-  {1462282400.0,  3105098299.0,  1531689313.0,  1333931751.0,  2221485749.0,  1903130214.0},
-  {2004836375.0,  1783894714.0,  2853793695.0,  2936906730.0,   102415628.0,  1244330098.0},
-  {3096373606.0,  1486938783.0,  1008221210.0,  3575397703.0,  3737393530.0,  3287012901.0},
-  { 145149070.0,  1428803042.0,   541163713.0,  4225637916.0,   520335980.0,  3977052401.0},
-  {3878458787.0,  3134996912.0,   721010728.0,  2118095041.0,   335357282.0,  3026722997.0},
-  {3922013859.0,  2917135733.0,  1381282290.0,  1543745564.0,  2366633531.0,  3866305193.0},
-  {3122688522.0,   200116996.0,  3923952991.0,  3918982290.0,   715338970.0,  1087263129.0},
-  {  98343020.0,  2358708676.0,  3712314001.0,  2943785238.0,  1106900094.0,  3956610398.0},
-  { 635580276.0,    45009790.0,  1771514162.0,  3736836167.0,  2696177505.0,  2894576749.0},
-  { 946604926.0,   512535937.0,  2646332146.0,   390720885.0,   753107685.0,  2294538462.0},
-  { 218434720.0,  4094531390.0,  1812116885.0,  3310867140.0,  1201166964.0,   552002363.0},
-  {2815979203.0,  3003873731.0,  4183012892.0,  1158695030.0,  1358234020.0,   316498217.0},
-  { 435840283.0,   117117270.0,  2791161620.0,  1067331971.0,  1081563627.0,  2330981580.0},
-  {2324383500.0,  2353063901.0,   277872438.0,  3014848341.0,  3600765574.0,  1800151655.0},
-  {1237501609.0,   488779643.0,   324459815.0,  4107273960.0,  4192543817.0,  2695767613.0},
-  { 188544079.0,  3010400390.0,  4033509556.0,  1963905858.0,  1184297736.0,  2578810437.0},
-  { 296467543.0,  1495856171.0,   143942290.0,  2027175721.0,  1302307357.0,  2899076856.0},
-  {4213811483.0,  2012993309.0,   795711826.0,  3109109666.0,  2707271737.0,   315884297.0},
-  {1763315883.0,   701290166.0,  2986970424.0,  2803046765.0,   235357576.0,  3951669689.0},
-  {3923073619.0,  1796855661.0,   775357465.0,  3669696024.0,  1465882085.0,  2719349737.0},
-  {2772498224.0,   123303608.0,  1306365766.0,   369960296.0,  3040067157.0,  4239574684.0},
-  { 473347504.0,  3052706142.0,  3892314589.0,   324145513.0,  2940853916.0,  3371523804.0},
-  {3867887011.0,  2397816657.0,  4009067596.0,  2743977916.0,  1409894740.0,  1546651890.0},
-  {2846786308.0,  1240633996.0,   897870422.0,  3244636973.0,    75286275.0,   425648584.0},
-  {1462661842.0,  1417990417.0,  3107910637.0,  2984972187.0,   615706498.0,   549961107.0},
-  {1527639212.0,   975247786.0,  2240327039.0,   968066490.0,   879799951.0,  3695707849.0},
-  {1132188841.0,  2611665514.0,  2849914395.0,  1549585410.0,  3217943109.0,   298794365.0},
-  {4144627711.0,  4255032695.0,   675767077.0,  3232877841.0,  2894818051.0,  4264016423.0},
-  {1122075449.0,  1635560816.0,   326878622.0,  2564778919.0,  3517008788.0,  3730152330.0},
-  {  69252450.0,  1896972459.0,  3396667178.0,   710534219.0,  1107747396.0,   262866172.0},
-  {1732864588.0,  2425304091.0,  1904091516.0,  2854346779.0,  4233519865.0,  3100958328.0},
-  {2245940122.0,  2714744795.0,   339691505.0,  1512473499.0,  2577658685.0,  2689357152.0},
-  {1190601540.0,  4022976751.0,   665618990.0,   704392737.0,  2187646540.0,   870380831.0},
-  {3658565828.0,  1922583249.0,  1150763299.0,  1751270822.0,  3966758790.0,  2312469428.0},
-  {2900934543.0,  2747298626.0,  3973804251.0,  1063259896.0,  3884551127.0,    55689501.0},
-  {2130472429.0,     2214942.0,  4272450742.0,  2160605110.0,  2195915984.0,  1973086531.0},
-  {1058544951.0,  4030529297.0,  1741492563.0,  2578103452.0,  3315980961.0,  3509525785.0},
-  {2339296683.0,  3285312215.0,  2333763414.0,   984135811.0,  1498213774.0,  4243158508.0},
-  {1133275091.0,  1541186773.0,  1797300781.0,   685792685.0,  3439282263.0,   587792617.0},
-  {1858713014.0,  2248553086.0,   845430537.0,   993998314.0,  1877920048.0,  3539209236.0},
-  {3012476649.0,  2412325405.0,   787982098.0,    35331781.0,  3700618230.0,  1618128511.0},
-  {1747775440.0,  3665663793.0,  2995022621.0,  1438702877.0,  2122228654.0,  1314173804.0},
-  {2314624303.0,    33727629.0,  1705132088.0,  3414179549.0,  2102945334.0,   483799515.0},
-  {2900680578.0,   700099133.0,  3133866995.0,  4071994892.0,  3881488712.0,  1466832027.0},
-  {2130819039.0,  2007745259.0,  2600730083.0,  1202704736.0,  3454226538.0,  3543961333.0},
-  {3845976534.0,   353728242.0,  1767055828.0,  1651983946.0,   252518427.0,  1740780919.0},
-  { 356534182.0,  3025769712.0,  3281468323.0,  2675704869.0,   345811886.0,   982200788.0},
-  {2190003437.0,  2977373284.0,  2432232373.0,  1654363050.0,    39448586.0,  1640431911.0},
-  { 135787952.0,   733770321.0,   447742781.0,   328454352.0,  2215011124.0,  4080013154.0},
-  {3212189995.0,  2169646045.0,  3421825908.0,  1042335378.0,   241271064.0,  2374900195.0},
-  {1176383722.0,  3449518526.0,  1615807373.0,  3175461987.0,  1501895398.0,  1252770042.0},
-  { 586100257.0,    44637074.0,    26186220.0,  3148495500.0,  1031963281.0,  1936461931.0},
-  {2142225952.0,  2102848501.0,  3354363855.0,   974118557.0,  3587787990.0,   236539897.0},
-  {3366998730.0,  2775315855.0,   775069793.0,  2174220835.0,  2282810406.0,  1072820678.0},
-  {3978325026.0,  2788969182.0,  3321168599.0,  2486108798.0,     3782572.0,  1881072235.0},
-  {2717607184.0,  1414246653.0,  1148639440.0,  2881911491.0,  1911978108.0,   355402652.0},
-  { 499150684.0,  3132270988.0,  4259723165.0,  3831889606.0,  1834048774.0,  3843245460.0},
-  {3831988883.0,  1693497200.0,  4043772725.0,  4150426056.0,  2839646532.0,  4168120907.0},
-  {2864754632.0,  3426201803.0,  4028938192.0,  2550835418.0,  3202425671.0,    45583990.0},
-  {1622947844.0,  1680694589.0,  4075245804.0,   892281712.0,   298419188.0,   740541143.0},
-  {2593219978.0,  2442282461.0,   454885309.0,   114990460.0,   224033474.0,   276328173.0},
-  { 564454885.0,   378170040.0,  1258521008.0,   341638128.0,  4206449258.0,   302854102.0},
-  {1189031627.0,  1251691677.0,  1074031260.0,  1389266991.0,  3190518080.0,  3215533801.0},
-  {4219542362.0,   267714103.0,  2037208803.0,   729597617.0,  4134412340.0,  2457388524.0},
-  { 479528179.0,  4023491783.0,  1107780558.0,  1505273604.0,  1999590668.0,   279588665.0},
-  {2474306189.0,  1196791612.0,  4030309659.0,  1029565355.0,  4175553475.0,   245083972.0},
-  { 906631797.0,   657770409.0,  4118184781.0,  2175186980.0,  3662757847.0,  2830648544.0},
-  {1508439397.0,   182388968.0,  1201725972.0,  1617436472.0,  2404970602.0,  3601100487.0},
-  {2934899569.0,   164781885.0,  3473282267.0,  1458863778.0,  2295642047.0,  2949125745.0},
-  {2278842779.0,  3840689620.0,   783126282.0,   154989744.0,  3176952807.0,  1812324025.0},
-  { 498486966.0,  1918794354.0,  3118705885.0,   337378604.0,  1867695482.0,   167769086.0},
-  {3389809995.0,   405431647.0,  2813651560.0,  2614029793.0,  3213695406.0,    67055915.0},
-  {3178157377.0,  3296585009.0,  3091143046.0,   992084368.0,  3345135762.0,  2077562839.0},
-  {3756323883.0,  4124610666.0,  2689082733.0,  1986146004.0,  3438532382.0,  2845479998.0},
-  {1721395212.0,  2658818706.0,  3478903617.0,  1646282270.0,   107320130.0,  2913007081.0},
-  {1361624474.0,   248105441.0,  1136919354.0,  1433625290.0,    93408390.0,   286698746.0},
-  { 372925941.0,  1858727459.0,  1876363786.0,  1949470280.0,   883115393.0,  2232625894.0},
-  {2391564354.0,  2775389014.0,   576284543.0,  1908331603.0,  1798102968.0,  1010461689.0},
-  {1704581020.0,  3223169649.0,   652719307.0,   230168447.0,  1505963587.0,  3847909362.0},
-  {2913871873.0,  3854712538.0,  3326507624.0,  3354910522.0,  2377147254.0,    76150167.0},
-  { 133267177.0,  1016680894.0,  3222425011.0,   488307709.0,  2762146309.0,  1927631590.0},
-  {2864185520.0,  3661045192.0,  3369405457.0,  2579105422.0,    83203159.0,  4122759714.0},
-  { 314912090.0,  2907369144.0,  1684346445.0,  2140709108.0,  3486144209.0,  2041778207.0},
-  {4136111942.0,   568867548.0,  2286107964.0,   618329301.0,  3738560553.0,  2405592719.0},
-  {1137611054.0,  4265792236.0,  1047992605.0,  1432461339.0,  1334319065.0,  2886815797.0},
-  { 285519793.0,  1090699335.0,   194477874.0,  3281517296.0,   567104142.0,   155762993.0},
-  {2865716704.0,  3781945886.0,  3637439636.0,  3635508220.0,   452825248.0,  3119003427.0},
-  {1949053203.0,  1431539360.0,  1838776255.0,  1980240999.0,  2783202711.0,  2026230032.0},
-  {1658718643.0,  4137772525.0,  3628816288.0,   661886003.0,    26636241.0,  1718352286.0},
-  {  56167028.0,  4161842345.0,  1850284959.0,   678334285.0,  3344187557.0,  1411660397.0},
-  {3887561428.0,  3212252067.0,   307315911.0,   196102436.0,  2018745782.0,  4231392928.0},
-  {2386541374.0,   489292467.0,  2915324123.0,   404619720.0,  1427445548.0,  2250822418.0},
-  { 843374798.0,  4214679829.0,  1601187539.0,  1014275606.0,  1227585230.0,  1375803490.0},
-  {3794575854.0,  3733972420.0,  2630740941.0,  3803963921.0,  2162216943.0,  1864269651.0},
-  {3582305660.0,  3858360491.0,  2902441465.0,  2834341518.0,  3082294879.0,   493073631.0},
-  {1985892571.0,   476923742.0,  1820902041.0,  4232920537.0,  2289856114.0,  1696553147.0},
-  {1394439360.0,  3188837630.0,  1399895145.0,  2935718929.0,  3759581823.0,  3177400297.0},
-  {3436449115.0,  3739553789.0,  1011290605.0,  3159873325.0,  3767376480.0,  3363204463.0},
-  {1241781149.0,  1844322130.0,  3366325186.0,   487381392.0,  2390116824.0,  4141295114.0},
-  { 451547256.0,  2358410065.0,   343168858.0,  4237378684.0,  2154515578.0,  3835708372.0},
-  {1397558918.0,  2050362637.0,  2996811734.0,  3430362949.0,  1254555649.0,  2554037169.0},
-  {2785113176.0,  1972340174.0,   775420101.0,  1975462343.0,  1622062920.0,  2863762762.0},
-  {3494434588.0,  2186454802.0,  1318635591.0,  2941773306.0,   454207241.0,  2202346449.0},
-  {1560429060.0,  2423481211.0,  2477575413.0,   509778407.0,  1042335601.0,  1968533249.0},
-  {2169750319.0,   879820615.0,  3643422744.0,  1211933946.0,  1060959235.0,  3892825411.0},
-  {1906653259.0,   634662040.0,  3806249604.0,  2150587971.0,  3720666895.0,    90770590.0},
-  {1412790709.0,  4106400014.0,  2084076184.0,  1182740336.0,  2674779417.0,   514981387.0},
-  {2561610233.0,   985541692.0,   831640623.0,  3227610734.0,   978286277.0,  3835395255.0},
-  {1682247720.0,  1602239176.0,   992152986.0,  2399742192.0,  3672031424.0,  1654852733.0},
-  {2036108031.0,  1850834189.0,   760693651.0,  2902977278.0,  2792999418.0,   636506542.0},
-  {2082168752.0,  4076188073.0,  1480210649.0,  3256899406.0,   417310810.0,  2516529518.0},
-  { 306372908.0,  1206758974.0,  3664903384.0,    55970269.0,  3830606645.0,  3724864793.0},
-  { 499976455.0,  2735876339.0,  1941087122.0,  2666938374.0,  2329767471.0,   235601306.0},
-  {1709913802.0,  3750345883.0,   731918751.0,  3272997279.0,  1171397278.0,  2387023218.0},
-  {2387906216.0,   572849077.0,  3149007243.0,     2275970.0,  3683741768.0,   313932454.0},
-  {1466309187.0,  4182273377.0,  4071211722.0,    45014053.0,  1759707241.0,   524529358.0},
-  {2737443485.0,  3706669205.0,  2518406674.0,   152783730.0,  3107970266.0,  3303482034.0},
-  {1197363901.0,  1277294107.0,  3059613845.0,  1151294489.0,  4085659917.0,  4023715916.0},
-  {1319451599.0,  2433926029.0,  3961190076.0,  2458519822.0,  2056999744.0,  3668096371.0},
-  {2424563826.0,   160692235.0,  2063232482.0,  1507472925.0,  2696175223.0,  3496053777.0},
-  { 135348246.0,  1487660235.0,  1049808270.0,  2539773033.0,  1245371605.0,  2888026193.0},
-  {2321469164.0,  1317741791.0,  3499538193.0,  1995517567.0,   430686408.0,   772387854.0},
-  { 846418173.0,  3090294747.0,  2959090495.0,  1175177695.0,  3721515118.0,  1144319209.0},
-  {2835330209.0,  2877300148.0,   447520475.0,  3292656878.0,  3315889511.0,   406735862.0},
-  {2710789916.0,  3300534757.0,  4231295050.0,  3196996316.0,   691253075.0,  1783121527.0},
-  {3548195727.0,  3608626684.0,   124728941.0,   165662057.0,  1594748018.0,  4164052152.0},
-  { 198833039.0,   282798386.0,  2133008430.0,  1969778816.0,   478435222.0,  4150008961.0},
-  {1698097738.0,  3355912135.0,  1266643374.0,  3686753186.0,   575726210.0,   324811330.0},
-  {3242780469.0,  3138368586.0,   159174470.0,  1970856896.0,  3665079976.0,  3481522128.0},
-  {1114702855.0,  3879350118.0,   890501072.0,  3299800259.0,  1706304353.0,  4289055647.0},
-  {2289101200.0,   634670897.0,   861076070.0,  2540920858.0,   259683582.0,  3023736310.0},
-  {3776988294.0,   409447854.0,  2152100356.0,  2476405819.0,  1516337036.0,  1143931845.0},
-  {  12655571.0,  2297551440.0,  2508136321.0,   492563089.0,  1829915997.0,  3527665334.0},
-  {3574295482.0,  3994268323.0,  3044845636.0,  4114617365.0,  3113038304.0,  2383353525.0},
-  {1787795274.0,   900809325.0,  1059505497.0,  2651738121.0,  2863290811.0,  3216222200.0},
-  {3211213755.0,   102885696.0,   434733902.0,  3552335771.0,  1345324063.0,   892796331.0},
-  { 582350209.0,   672590992.0,  3931879799.0,  3089623110.0,  1340782203.0,  2574855354.0},
-  {4187848612.0,  4001106826.0,  1645939913.0,   889516390.0,  2762464836.0,   302330161.0},
-  {1141660233.0,  3003983505.0,   141719195.0,  3853907887.0,  2304623939.0,  2541389774.0},
-  {2129194718.0,  3402706955.0,  3200123025.0,  3206367276.0,  3908944639.0,  3205369146.0},
-  { 924553428.0,  2056807665.0,  3578741743.0,  2980091782.0,  1497457750.0,  2162514120.0},
-  {3438877879.0,   537726281.0,  4077754214.0,  1442658034.0,  2838419244.0,   190909208.0},
-  {2772237724.0,  3514750402.0,  2132846773.0,   568076421.0,   962262825.0,   234064406.0},
-  {3157340399.0,  2269084748.0,  1330270506.0,  2740960693.0,  2327245677.0,  2829731490.0},
-  { 428959635.0,    47291924.0,   802324652.0,  4186871293.0,  2298394560.0,   917095037.0},
-  {2009901227.0,   955184214.0,   370499485.0,  3649074978.0,  4238908238.0,   538520879.0},
-  {3919229774.0,  4163544369.0,   143661318.0,  2171945877.0,  2085662498.0,  2163430318.0},
-  {2032542173.0,  1872904966.0,  1312330698.0,   359466085.0,   809101381.0,  2048844847.0},
-  {1740219817.0,  3524623043.0,  1303646460.0,  3214394013.0,  3723914788.0,  2693161672.0},
-  {3662146337.0,  3175980438.0,  3768055234.0,  3735505767.0,   257684379.0,  1772775897.0},
-  {2278759048.0,   315292591.0,  1382488379.0,  3395273585.0,  1671563433.0,  4216177450.0},
-  {1995908964.0,   537643845.0,  3608356574.0,  2566068008.0,  3694933783.0,  3899105475.0},
-  {4223459180.0,  1662811274.0,  1495490271.0,  2211575756.0,    55582274.0,   530944185.0},
-  {2815477752.0,  1957711315.0,   320599867.0,   190444625.0,  2992031846.0,   106802568.0},
-  {1154203238.0,  1061424542.0,  1385552817.0,  2980532811.0,  1989361158.0,   587530205.0},
-  {3101614206.0,  2640254711.0,  1682367300.0,  1555920269.0,  2003054998.0,  2367838254.0},
-  { 674964839.0,  1171212812.0,  3004364804.0,   766293617.0,  3492955032.0,   187262484.0},
-  {2750594855.0,  3437524354.0,   808384391.0,  3318224698.0,   539686169.0,  2766654239.0},
-  {3505632343.0,  1769629910.0,   284101455.0,  2311109936.0,  2080811287.0,  2061411871.0},
-  {3874804004.0,  2189986989.0,    98756338.0,   380777339.0,   235101772.0,  2131219086.0},
-  {2469187799.0,  1905928855.0,  2088896162.0,  3323604314.0,  3019985094.0,  2514630530.0},
-  { 998109137.0,  2934871872.0,   340458738.0,  1890919319.0,  2711463992.0,  3004860253.0},
-  {1643300576.0,   517665911.0,  2312891749.0,   992373900.0,  2720502017.0,  2436566942.0},
-  {1732777777.0,  1089607727.0,   294405560.0,  1968479790.0,  1355246927.0,  3439373888.0},
-  { 826258272.0,  2205681283.0,  3766413506.0,   266237630.0,   373062188.0,  2337452274.0},
-  {3964342648.0,  1793260538.0,  2000732329.0,  1739240378.0,  1450092856.0,  2893630473.0},
-  {1917896465.0,  4191815601.0,   722375843.0,  1280273402.0,   111255560.0,  3253672186.0},
-  {1216737709.0,   763506730.0,  3418912862.0,  3568848938.0,   743085430.0,  3441631942.0},
-  { 949731317.0,  2071388909.0,  3861024373.0,  2732685531.0,  3688160261.0,  3177724357.0},
-  { 685989840.0,  3803564237.0,  2772306499.0,  3016003959.0,  1990824001.0,   856590217.0},
-  {3746949784.0,  3858988491.0,  3159855270.0,   520542829.0,  2626320994.0,  2964542157.0},
-  { 170918030.0,  2197487157.0,   832966266.0,  1514074998.0,  2163393332.0,   632122308.0},
-  {4075501966.0,  2164640782.0,   276307167.0,   331298500.0,  4285670612.0,   277253446.0},
-  {1777907366.0,   264953342.0,  1944405393.0,  3069975921.0,  2029534183.0,   615800567.0},
-  {4282409254.0,  3082887464.0,  1427866575.0,  1638573276.0,  2194990699.0,   412198593.0},
-  {3821583187.0,  2053512114.0,  3298303109.0,  3834085923.0,  3018160831.0,  3096187150.0},
-  {1871882152.0,  1371878486.0,  1514719316.0,  4181653624.0,  2899623008.0,  3901908550.0},
-  {4125136723.0,  2512136743.0,  2973688748.0,  3189229528.0,  4077765110.0,  2298376344.0},
-  { 176542789.0,   840453668.0,    62346085.0,  4285902182.0,  3363469551.0,  1965245196.0},
-  {1048067742.0,   582807590.0,   906907540.0,  3173759460.0,  1693901067.0,  2606285203.0},
-  {3156912867.0,  2019649314.0,  1644241017.0,  1179945904.0,  1612952690.0,   580160207.0},
-  {1796192928.0,  1129704359.0,   590397321.0,  1812712978.0,   250431085.0,  3540749510.0},
-  {4114865570.0,  1275353380.0,  3655913118.0,  1109709664.0,  1564792226.0,  3701263603.0},
-  {2624718087.0,  3956037071.0,   605880704.0,  2285945076.0,  1725824149.0,  2303969382.0},
-  {2349664036.0,   207279879.0,  4197492428.0,   588249255.0,  1028157263.0,   470182123.0},
-  {1303103998.0,   413353764.0,  2299845309.0,  1256231763.0,  2195135855.0,   187259845.0},
-  {2962512192.0,  3042831588.0,   582022418.0,  3950766571.0,  3190761193.0,  1784731645.0},
-  {1807546967.0,  3719303866.0,  2334488804.0,  2187555807.0,  3871760572.0,  1401589763.0},
-  {2621787058.0,  3917760854.0,  1097139915.0,  1617203917.0,  1293962827.0,  1404717237.0},
-  { 547555399.0,  4048495012.0,  3491932115.0,  3566600680.0,  1502897581.0,  4092421072.0},
-  {1206836663.0,  4128349387.0,  3558769970.0,  3909878769.0,  3676572293.0,   762970996.0},
-  {1323506529.0,   929244522.0,  1564267453.0,  3216715426.0,  2375831265.0,   870584287.0},
-  {3226680481.0,   414090554.0,  2024127835.0,   581120032.0,   503291939.0,  2975894064.0},
-  {2206395647.0,  1029490270.0,  1594193275.0,  3555417424.0,  1211569858.0,  2661369105.0},
-  {1198732482.0,  2839984135.0,   128860141.0,  4177942393.0,  2995142310.0,  1139397926.0},
-  { 311800858.0,   729370718.0,  3235213874.0,  3849840602.0,  2500332285.0,  2654603897.0},
-  {2257649379.0,  4277072908.0,  2663831008.0,  1911569669.0,   745329787.0,  1416611987.0},
-  { 907270920.0,  3609415916.0,  2115315097.0,   561835004.0,  2882551530.0,  2216617516.0},
-  {3155578058.0,  2520944890.0,  3372230835.0,  4162621536.0,    71406637.0,  2790647499.0},
-  {2455881094.0,  3610586984.0,  2746979334.0,  1036091350.0,  3415159132.0,   703666257.0},
-  {1949746632.0,  2974372571.0,  1961117963.0,  2619470624.0,  3160140580.0,  2045521473.0},
-  {2608823397.0,  3358770178.0,   114290189.0,  3215820972.0,  2784455117.0,  1282266229.0},
-  { 573158654.0,  1664326966.0,  3435536098.0,  2446574139.0,  3412707813.0,  1833113382.0},
-  {1610740378.0,   729559844.0,  1969777519.0,  3129676914.0,  1960781972.0,  3851308679.0},
-  {1146428631.0,   987284466.0,  2575193520.0,   600507487.0,  3178232920.0,  2319109332.0},
-  {3605561703.0,   684239759.0,  3590039148.0,  3979345990.0,  3112265514.0,  1867530452.0},
-  {2925128823.0,  2806423272.0,  1685059693.0,  1324236855.0,  1282928845.0,  2380035355.0},
-  {1244340497.0,  3494272721.0,   417033515.0,  1573041201.0,   201806056.0,  3496813165.0},
-  {2548508147.0,   606049170.0,   103372720.0,  3586974609.0,   425498058.0,   247518311.0},
-  {3793724627.0,  1393985506.0,  3205795505.0,  1632231528.0,  4012795049.0,  4139178362.0},
-  { 241148674.0,  1529493727.0,  3049652218.0,  3436434625.0,  3772151748.0,   775965159.0},
-  {3542989548.0,  2374955982.0,  3904747153.0,  1478858612.0,  4202847100.0,  3345558707.0},
-  {4190605618.0,  3756499705.0,    52006112.0,   315813182.0,   235351612.0,  3768973508.0},
-  {2303095141.0,  1832304523.0,  2582868276.0,  1823803076.0,  2048424633.0,  3748500857.0},
-  { 244423481.0,  1965594277.0,  1819156499.0,  1395029956.0,  3367995983.0,  1214570928.0},
-  {4200113734.0,  1802159377.0,  3419755052.0,  3486015981.0,  3837889966.0,   977237711.0},
-  { 215552547.0,  3970134066.0,   860461841.0,  2527571348.0,  2434411451.0,  2241097013.0},
-  {2512203484.0,  3019192406.0,  1437511126.0,   647455832.0,  3009713182.0,  1753127451.0},
-  {1172329500.0,   261936797.0,  1611289667.0,  3166886190.0,   115188633.0,  2218472882.0},
-  {4094454840.0,  1694778910.0,  1856889661.0,  2600905145.0,  3271753218.0,  2234208474.0},
-  { 966262337.0,  1844539083.0,  3733632946.0,  2220079304.0,  2677961448.0,  2931914094.0},
-  {4082358330.0,  3775235268.0,  2028836202.0,  2698014963.0,  4231297025.0,  1349160982.0},
-  {2924340234.0,  2278975966.0,  2173274353.0,  2308607147.0,  3578794225.0,  2053902888.0},
-  {1413338803.0,  4114610020.0,  1659625315.0,  1528602133.0,  3249786384.0,  2003932642.0},
-  { 338415466.0,  2061264987.0,  3553487147.0,   841802876.0,  3661038184.0,  1578253142.0},
-  { 640668076.0,  2164735007.0,  4255561259.0,   516436590.0,  4111496195.0,  1295896333.0},
-  { 362461254.0,  1496277798.0,   673256276.0,  2330521821.0,  2009024350.0,  2846620301.0},
-  {2156168671.0,  1815125235.0,  3532776133.0,  3878471038.0,  2990371626.0,  3158495093.0},
-  {1678967134.0,  3218061868.0,  1989182008.0,  3397919196.0,  3722566941.0,  2770701969.0},
-  {1026220876.0,  1817624313.0,  1905220327.0,  1476576714.0,  1443432841.0,  1940543828.0},
-  {1094845557.0,  1099205015.0,  1491293695.0,  3063725537.0,   931804162.0,   586376776.0},
-  {3375390852.0,   526212191.0,  4044167794.0,   805503893.0,  2282411411.0,  3513521355.0},
-  {3690437166.0,  3340205455.0,  1559319416.0,   810428902.0,  3052935750.0,  2578182879.0},
-  {2755914468.0,   631258069.0,  3899973069.0,  4205913703.0,   403717267.0,  1030002178.0},
-  {3103840206.0,  2377342867.0,  3110724356.0,  1207488743.0,  1718789793.0,  3780162835.0},
-  {2764308650.0,  1093846096.0,   589176899.0,  1423201552.0,  3532676289.0,  3170682942.0},
-  {3370051646.0,  2351773946.0,  3578192525.0,  2668422752.0,  4168309552.0,   337611966.0},
-  {3827718612.0,  2347907533.0,  1138730090.0,  1774469243.0,   435367739.0,  1803308653.0},
-  {4036601622.0,  3505775264.0,   123244374.0,  2583738925.0,  3149268165.0,   928852748.0},
-  { 810182085.0,  2313958596.0,  1477103925.0,  1520601365.0,  1161985614.0,  2784367847.0},
-  {2414769172.0,  1551336227.0,  1223900065.0,  2274955756.0,   526947240.0,   491773971.0},
-  {3103815593.0,  1953924312.0,  2012901424.0,  1229613249.0,  4079017659.0,  2387809697.0},
-  {3732193691.0,  2633225827.0,  2456397989.0,  3598552421.0,    50705048.0,  1813087421.0},
-  { 297715310.0,  3431890322.0,  3924101317.0,  1075443461.0,  3516839455.0,   806200772.0},
-  { 204781671.0,   797021526.0,  3876868794.0,  4042516185.0,  3472769474.0,  2566787264.0},
-  {1393381696.0,  1023248224.0,  2239769770.0,  3393285566.0,  3764786334.0,  3526256213.0},
-  {2145087847.0,  3963377508.0,  4090606456.0,   649736264.0,  3552527155.0,  1779583190.0},
-  {3861427254.0,   263380545.0,  1076173537.0,   369216060.0,  1310712090.0,  2944623651.0},
-  {3806782015.0,  1364592773.0,    66288958.0,  1836218046.0,  2433726156.0,   951414194.0},
-  {1024808968.0,  1751495195.0,  1240826890.0,  1273004456.0,  3511153750.0,  1898921872.0},
-  {1814111157.0,  1937502067.0,  3765963318.0,   137952113.0,   753890461.0,  3828259932.0},
-  {3805629777.0,  2922570533.0,  3299794079.0,  2023897537.0,  2507694738.0,  1525292303.0},
-  {2040764740.0,  3130341567.0,  2591761955.0,  1632116816.0,   304489281.0,   533147842.0},
-  {2896920511.0,   419664965.0,  1328388693.0,  2416350213.0,   619381893.0,   667268665.0},
-  {2389626247.0,  3878276144.0,  2648162648.0,  1464242567.0,  3802297081.0,  1180571419.0},
-  {1055700593.0,  3530738812.0,  3716889405.0,  3531344565.0,  3669552666.0,  3537402124.0},
-  {1565471947.0,  1268520572.0,   398479322.0,   460260162.0,  2763226221.0,  1713893193.0},
-  {2934619138.0,  2042201388.0,   920878726.0,  2662406681.0,  1325056735.0,  3317898064.0},
-  {1203852881.0,   941186355.0,   377980528.0,  2991957225.0,  2092337795.0,  2241937042.0},
-  {1332709118.0,   899383621.0,  1549213993.0,  3362184370.0,  1655265086.0,  1104626740.0},
-  { 874618914.0,  1210976411.0,   891289587.0,  2679696600.0,   787940882.0,   217044925.0},
-  {2305642497.0,  2111931607.0,  1416487734.0,  3913603630.0,   492436027.0,  2360151832.0},
-  {3490617750.0,   866730953.0,  3285885080.0,   579835122.0,  2338171433.0,    92045932.0},
-  {1028545901.0,  2238522133.0,  2291583325.0,  1385332119.0,  1930406279.0,   649329779.0},
-  {2493161208.0,  3196630099.0,  3166497485.0,   321515668.0,  3551929782.0,   153165562.0},
-  {1619365116.0,  2056683350.0,  1121145678.0,  4086216869.0,  1277376457.0,   266469697.0},
-  {3872507051.0,   520120163.0,  2703414523.0,  2443737044.0,   225248102.0,   586426334.0},
-  { 328913618.0,  2191263714.0,  2695778514.0,  2109145364.0,  1867077586.0,   543403744.0},
-  {1010424697.0,  3757045549.0,  3639185183.0,  1168640129.0,  2946042782.0,  1761176288.0},
-  {1479052219.0,  4048737914.0,   493426483.0,   371111527.0,  1827931320.0,  2976654085.0},
-  {1283792142.0,  3267442866.0,  1106784956.0,  2250834244.0,  4003400669.0,   124405248.0},
-  {1060808781.0,  2635136582.0,  3397325155.0,  2676199908.0,    86809077.0,  3365023653.0},
-  {1793127036.0,  2294635254.0,  1579599019.0,  3977403930.0,  1462371834.0,  4248774208.0},
-  {1930902441.0,  2383533725.0,    83030953.0,  2135065640.0,  3064219688.0,  3796574771.0},
-  {2792934168.0,  4230906812.0,  3996262018.0,   586009257.0,  3954819686.0,   702225565.0},
-  {3863947027.0,  4149650423.0,  3945431954.0,  2096476520.0,  3033947345.0,  1906545707.0},
-  {3950465777.0,  2240154582.0,  4270481417.0,  1031635628.0,  3155594166.0,  1407786750.0},
-  {3136682094.0,    43422277.0,  3529246047.0,  1217662753.0,  2209113825.0,  3609353751.0},
-  {1479500429.0,   890606351.0,  2190051360.0,  3411488385.0,  1945393999.0,  1876580872.0},
-  {1699502859.0,  4005529456.0,  1188350139.0,  3684183047.0,  1649905159.0,   863113087.0},
-  {3466004863.0,    64445335.0,  1008710939.0,  1945404981.0,   485541274.0,  2168966635.0},
-  { 377836115.0,  3638530143.0,  1579507428.0,   427720087.0,   272842646.0,   942045563.0},
-  {4160582451.0,  2673100292.0,   837116854.0,  3583664930.0,  1703528778.0,  2985805086.0},
-  { 361202901.0,   142303064.0,   847915955.0,  1007093849.0,   515494992.0,  1499212231.0},
-  { 399266340.0,    96494219.0,   521248678.0,    21680860.0,  2069839908.0,  3867683142.0},
-  {3482739377.0,  4292425837.0,   755470981.0,  2836951712.0,  2359397802.0,  3058290399.0},
-  { 984457890.0,   141927009.0,  2738378828.0,  3051621989.0,  3151298560.0,  3699303487.0},
-  {2354425869.0,  4042177634.0,   696865634.0,  1222345417.0,  1621508643.0,  3970657003.0},
-  {3670139021.0,  1663067811.0,  2701256972.0,   928943984.0,  3470160807.0,  3872337081.0},
-  {3678041330.0,  2472956009.0,  2692302447.0,  1433049524.0,  2540647619.0,  2559709013.0},
-  { 596488905.0,  1367205169.0,   604673516.0,  1533811179.0,  3796586241.0,  3750542935.0},
-  {2981567525.0,  2547510058.0,   168315058.0,  2549137208.0,   156658466.0,   708682092.0},
-  { 775458179.0,    76874527.0,  2682210868.0,  1393358902.0,  2965368033.0,   378868292.0},
-  {3047250458.0,  4130979282.0,  1055078631.0,  2940086331.0,  2313995801.0,  3355591535.0},
-  { 796053558.0,  1971004589.0,  1178120568.0,  1454229069.0,  2525917773.0,  2483751412.0},
-  {1213310615.0,  1785628440.0,  2200796824.0,  1781034467.0,  2197580199.0,  3038685887.0},
-  { 122265392.0,   460120701.0,  1190618850.0,  2849421999.0,  2363642101.0,  4217947202.0},
-  {2470262928.0,  1774209421.0,   472545189.0,  2447508859.0,  2633223610.0,  3850644599.0},
-  { 408026744.0,  1613774586.0,  2910427330.0,  1253674220.0,  3194347978.0,  2983445564.0},
-  {4264331954.0,  2174298724.0,  3113934227.0,  2536167740.0,  2863115988.0,   930525469.0},
-  {2533761848.0,  4292928159.0,  3027944905.0,   380798071.0,  1748642828.0,  2561888131.0},
-  {4226417150.0,   106881075.0,   511787655.0,  1947568138.0,  3271443917.0,   984291197.0},
-  { 979873464.0,   893158545.0,  3234103820.0,  2316897882.0,   719370266.0,  2570663704.0},
-  {3100026959.0,  3776865641.0,   998512912.0,  2418589146.0,   575136328.0,  4068987956.0},
-  {2989278324.0,  3708453670.0,    30379135.0,  1144795171.0,  3378970088.0,  3109246058.0},
-  { 689740693.0,  1749576679.0,  1694036867.0,  2868710828.0,    72345174.0,  1062216887.0},
-  {3640814968.0,   831190285.0,  2592208094.0,  1756756378.0,  4238349734.0,  1676567478.0},
-  {2238228124.0,  2261052114.0,  1328835051.0,  1779611529.0,   215654643.0,  1434008778.0},
-  {2115368369.0,  1474854760.0,   570764555.0,  4156203530.0,  1685419877.0,   998263470.0},
-  {1116479564.0,  2292944190.0,  3377411512.0,  1728452471.0,  2479516414.0,   868971504.0},
-  { 416283803.0,   135884800.0,  2560715855.0,  2001394670.0,  2456322505.0,  4270724889.0},
-  { 386641225.0,  2449826351.0,  3220419180.0,  2134396792.0,  4091123765.0,   903881881.0},
-  {1730006754.0,   742694704.0,  3488334960.0,  1878240560.0,  3321531339.0,  1735287865.0},
-  { 458553427.0,  3174994448.0,  3986819078.0,  3419203666.0,    31044977.0,  2684675202.0},
-  { 231415648.0,   473212532.0,  2305139227.0,  1308970316.0,  2069296666.0,  2980571159.0},
-  {1817563284.0,   678638646.0,  1136780909.0,   832055715.0,  3358959242.0,  4236642159.0},
-  {3205193426.0,  2059553733.0,  3995726184.0,  3483632468.0,  3830341893.0,  3267252873.0},
-  {3550198778.0,  3529732573.0,  2859171322.0,  2235285132.0,   278961045.0,   269694493.0},
-  {2112299016.0,  3032314128.0,  1210112464.0,  3816989961.0,   387001465.0,  3583745755.0},
-  {  61951486.0,  1563889063.0,  3983896550.0,   893358382.0,  3936188105.0,  3313625177.0},
-  { 841889911.0,  2751775126.0,   525993010.0,  1382334723.0,  3946680009.0,  2523176280.0},
-  {3568708029.0,  3380051960.0,  3938338179.0,   818721877.0,   247679740.0,   255363750.0},
-  {1494403244.0,  2317288004.0,  2944803783.0,  3033769836.0,  3991070001.0,   681103720.0},
-  {2387423083.0,  3588734303.0,  1527970590.0,  2493608480.0,  1905951931.0,  1021217988.0},
-  {1228496374.0,   410184446.0,  1570366980.0,  3304921365.0,  3921534459.0,   959890381.0},
-  {3959035206.0,  2933598619.0,  3551689003.0,  2310463979.0,  3196683025.0,  1662599453.0},
-  {4234243097.0,  3829302348.0,  2745489524.0,  1276894920.0,  3913032319.0,  1607892387.0},
-  {  95733248.0,  3125110543.0,  2737809900.0,  2550543515.0,  3795540184.0,   316088965.0},
-  {1946523010.0,  2392626024.0,  2682973237.0,  2650136331.0,  2272160224.0,  2884153240.0},
-  {3380021000.0,  3482180598.0,   772711289.0,  3824177779.0,  1296933050.0,  4266513615.0},
-  {1362573362.0,  2389955798.0,  1313113981.0,  3920625931.0,   243120553.0,  4161484676.0},
-  { 804814785.0,  3689389868.0,  3463810643.0,  1809061546.0,   513172377.0,  1226091359.0},
-  { 610822493.0,   163059910.0,  3585687935.0,  3409444447.0,  2812281161.0,  1608966644.0},
-  {3689219879.0,  3420938750.0,  1408339629.0,  3356131986.0,  2150678850.0,   235888816.0},
-  {1092590364.0,     4583394.0,  2013512313.0,  1685307296.0,  3319011169.0,  1973484882.0},
-  {1228947820.0,  4287545357.0,  2735765492.0,  3132649963.0,  3316580629.0,  3704862277.0},
-  {2982435583.0,  1572746127.0,  3953359628.0,   516348672.0,   170699870.0,  1516184721.0},
-  {2976971810.0,   351919839.0,  4128616889.0,  3304841677.0,  1792265564.0,  2330558665.0},
-  {3283290265.0,  2413895246.0,  1612426947.0,   680355848.0,  2139877741.0,   730017665.0},
-  { 259772700.0,  3146686099.0,  2959363201.0,  2751627099.0,  1371030448.0,  2720988792.0},
-  {3610383837.0,  3024288814.0,   965301624.0,  1778274977.0,  1195039575.0,  3951298703.0},
-  {2812137221.0,   896615005.0,  2699793929.0,  2643735430.0,  2632722215.0,  3302276324.0},
-  {1914781097.0,  2844359734.0,  3946096707.0,  2245185296.0,   510626049.0,  3139312558.0},
-  {1161195453.0,  2820617287.0,  3697075627.0,  1735468861.0,  2680311895.0,  2212917799.0},
-  { 953952498.0,  1393161009.0,  1489470321.0,  3422624561.0,  1177990691.0,   231309060.0},
-  { 219576293.0,   252969207.0,  3090179797.0,  2505822715.0,  1021711869.0,   676832469.0},
-  {3316440291.0,  3591361493.0,  1807658340.0,  1782988676.0,  2531381001.0,  4246646733.0},
-  {4293273741.0,  1864866217.0,  4012253690.0,  3797042374.0,  2542843369.0,  4035445540.0},
-  { 262207373.0,  3244768143.0,  1345942137.0,   772531852.0,  4105955039.0,  1816636525.0},
-  {1786242111.0,  3712969480.0,   187614284.0,   126490716.0,  2291745139.0,  4221992941.0},
-  {3485234596.0,  1442187642.0,   839526260.0,  1291250885.0,   537054861.0,   836056740.0},
-  {1030658844.0,  3215972188.0,  2267658232.0,  1694276306.0,  3660808764.0,  2896160847.0},
-  {2595993453.0,  3535605314.0,   301837007.0,  4252810424.0,   163418593.0,  1711347555.0},
-  {4073533568.0,  4071292047.0,  2760112149.0,  4108931632.0,   781755866.0,  3895740232.0},
-  {2103149937.0,   161804698.0,  1466982225.0,  2359745563.0,  1182979440.0,  3585963109.0},
-  {2798405265.0,  1872288584.0,  2053392479.0,  1792223135.0,  2396899363.0,    13571885.0},
-  {2955016312.0,  2598318598.0,  1339993369.0,  3636907603.0,  2747100191.0,   579842714.0},
-  {1962072270.0,   385041474.0,  2482712276.0,  3944265183.0,  1285942634.0,  3139276048.0},
-  { 161007512.0,    44656108.0,  2289072134.0,   313022711.0,  1276809223.0,  2624790028.0},
-  {2167265268.0,  1191473504.0,  1794037808.0,  3189396026.0,  4074285117.0,  2599459764.0},
-  {1647526075.0,  1709534838.0,  1293225802.0,   723280322.0,  2579817236.0,  2531810334.0},
-  {2146282074.0,  2263067130.0,   835193200.0,  2199777795.0,   836040170.0,  3473750182.0},
-  {1575199516.0,  1520064343.0,  3916332594.0,  3048927973.0,    25218510.0,  1053432922.0},
-  {1272946352.0,  2423570723.0,  2167078989.0,  1727427326.0,  4149742328.0,  1006272629.0},
-  {3370499812.0,  2654283342.0,   346461725.0,   816116394.0,  2280339743.0,   661673736.0},
-  { 347319341.0,  2113722645.0,  2761816264.0,  1041661529.0,  3447469799.0,  1894909746.0},
-  {1461330294.0,  2811131790.0,  2243137372.0,  3465257714.0,  3461410208.0,  1148385091.0},
-  {2415823110.0,  1048756408.0,  2646088982.0,  1880304621.0,  2387086243.0,   648296367.0},
-  {3064521064.0,  3317423594.0,  3346127843.0,   194030776.0,  2735115899.0,  3511617764.0},
-  { 156127762.0,  1829712963.0,  2596089207.0,  1477585712.0,   911360654.0,  3270347981.0},
-  {3838628193.0,  3052408442.0,   806474933.0,  3037004003.0,   865214355.0,  1583481944.0},
-  {2421764014.0,  2887543808.0,  2393118847.0,  1277343854.0,  1229973136.0,  1029375939.0},
-  {1464580364.0,  1488335437.0,  3569005885.0,  1093915991.0,  1964364894.0,  2254315180.0},
-  {4075610760.0,  1560453200.0,  3715913215.0,  3021843976.0,  3572723908.0,  3857376948.0},
-  {4122705910.0,  3039250353.0,  4293814366.0,   232822952.0,  1103524456.0,  2940866493.0},
-  { 164286882.0,  3329787222.0,  1427182830.0,  1872123347.0,  1268637873.0,  3413754787.0},
-  {1316153592.0,  3732826732.0,  1342809510.0,  2738913574.0,  1463929465.0,   734776489.0},
-  {3228554915.0,  2888278180.0,   613414097.0,   322149550.0,  1048598259.0,   894801538.0},
-  {1402468838.0,  2578569271.0,  3382644564.0,  1238866295.0,   221760634.0,    93579952.0},
-  { 517085334.0,  3290651635.0,  1709079286.0,  2478448337.0,  1954714947.0,  3444456968.0},
-  {1429345184.0,  1988401507.0,    57051493.0,  1339485037.0,  2214409329.0,  2449202916.0},
-  { 173361246.0,  1731374635.0,  3135221518.0,  3847195817.0,  1204686557.0,  4057205876.0},
-  {1340730536.0,  3786170787.0,  1995156146.0,  1055540475.0,  1060275911.0,  3750245558.0},
-  {1672325882.0,  1870319985.0,  2257214690.0,  2826534508.0,  2802555020.0,  2625929280.0},
-  {2139045936.0,  1529707157.0,  1839946083.0,  3722548992.0,  2296742736.0,  2744314305.0},
-  { 785823865.0,  3853655016.0,  2490684304.0,  2073601296.0,  1812975524.0,  2206948623.0},
-  {2676494687.0,  2237550051.0,  2859482333.0,   631952711.0,  1192926673.0,  3867424040.0},
-  {3060335544.0,   883395962.0,  2760850283.0,  1832905679.0,  2877453438.0,  1227960668.0},
-  {3239938486.0,  1706989441.0,  3930569395.0,  4105654742.0,  1628659309.0,  1713452914.0},
-  {2061280439.0,  2650036496.0,  3218042367.0,  1538663960.0,  2158266535.0,  4209762521.0},
-  { 533425262.0,  3568626978.0,  2717702992.0,  2027352490.0,  1473513230.0,   152989835.0},
-  {2567389244.0,   296654382.0,   328505959.0,  2806125515.0,  3709148507.0,  3688734014.0},
-  {1195885212.0,   689159648.0,  3181616811.0,  2975285817.0,   598484933.0,  2648035179.0},
-  {4010500924.0,   179153279.0,    68654456.0,  1494724399.0,  3046540060.0,  3900177025.0},
-  {2725455904.0,   830124068.0,   714200876.0,  4083855012.0,  1807801376.0,  3594338032.0},
-  {4232708226.0,   457432595.0,  2723740929.0,  2020371381.0,  1224448561.0,   512092479.0},
-  {1742461194.0,   257760482.0,   556097737.0,  3461202317.0,   390445651.0,   602402286.0},
-  { 671434945.0,  2787926796.0,  3435881682.0,  2354358294.0,  3897997259.0,   660622454.0},
-  { 782448775.0,   334928619.0,  3389202884.0,  4139375849.0,  3093257543.0,  1796787955.0},
-  { 425545494.0,  3752275082.0,  3096898833.0,  2854648239.0,  3633129237.0,  2050370854.0},
-  {2525948483.0,  3615012975.0,  4039355600.0,  1030552099.0,  2800879763.0,  1539138175.0},
-  {3316316360.0,  3095262611.0,  4147236474.0,  1419524826.0,  2321738391.0,  1365203055.0},
-  {2650595991.0,  2684935497.0,  2003355673.0,  3293643878.0,  3147280988.0,   443470620.0},
-  {3690871424.0,  1645099408.0,  4164704201.0,   220451202.0,  2826274138.0,  4177701850.0},
-  {1573022421.0,  2856043779.0,  4032503222.0,  1056724172.0,  3849695400.0,   758332912.0},
-  {3508097218.0,  2395093608.0,  1122643269.0,  4285666450.0,  1103478721.0,  4287556414.0},
-  {3990476227.0,  2146080389.0,  2747027294.0,  2074542677.0,  3596729255.0,  2316139905.0},
-  {1132453831.0,  1881789935.0,  4090051760.0,  2107972461.0,  2551319877.0,  1904143755.0},
-  { 327306670.0,  3790337076.0,  3526722955.0,  2831746543.0,   940430649.0,  2146247235.0},
-  { 905446557.0,  3758187595.0,  2148329389.0,  3170371856.0,  1273645305.0,  3132391005.0},
-  { 951533814.0,  1560123673.0,  1435290724.0,  3194145015.0,  3084064687.0,  4129567898.0},
-  {2632607221.0,  2294218439.0,   601508288.0,   218004058.0,  2582064492.0,  2354218702.0},
-  {1894222804.0,   499853719.0,  3337431325.0,  3351687206.0,  3643260516.0,   770235505.0},
-  {3548322249.0,  2313584178.0,   381929436.0,  2206716544.0,  3362040016.0,   498240300.0},
-  {3839748743.0,  2586927019.0,   135399161.0,  1326067324.0,   476597485.0,   933707978.0},
-  { 978482805.0,  4008205771.0,   300885486.0,  1167166326.0,  2285763775.0,  1492149783.0},
-  {1244906216.0,  2698562113.0,   645471238.0,  1079122374.0,  2953960491.0,  2465658237.0},
-  { 364677831.0,   754184713.0,   546785829.0,  2327922758.0,  3560877661.0,  4145827749.0},
-  { 819291645.0,  4056263908.0,   959212705.0,  1040347494.0,  2957523841.0,   717511793.0},
-  {2724210721.0,  2327206563.0,  2394410089.0,  2768713747.0,   734918443.0,  1093520262.0},
-  {3779692765.0,  2797193091.0,  2145936055.0,  3546494150.0,  1463634323.0,  3351537204.0},
-  {1965946435.0,  2297567105.0,  3026490839.0,  1255754067.0,  2394082550.0,   304550632.0},
-  { 794421118.0,  3056954055.0,  2822547983.0,  4085463544.0,    36249359.0,  1747991107.0},
-  {3624814238.0,  3752039895.0,  3000394110.0,  3186695431.0,  2497601465.0,  1585081745.0},
-  {3621767194.0,  2898574039.0,  3815508553.0,  1045675410.0,  3076265381.0,  1478076007.0},
-  {2664607473.0,  2069536312.0,   839785277.0,  3697922498.0,   267320398.0,  2186060667.0},
-  {3303037224.0,   449663089.0,  1239825958.0,  1219625986.0,  4125913298.0,  4234400674.0},
-  {2676364525.0,  2601404829.0,  2765189257.0,  3356953497.0,  3375937256.0,  3515994907.0},
-  {1876987839.0,  1498267344.0,  2265476925.0,   367889907.0,  3919074660.0,  1648550670.0},
-  {1620468799.0,  3043895285.0,  1298260739.0,   317184987.0,  2022064146.0,  3494156830.0},
-  { 830552756.0,  4225407548.0,   962273376.0,  2627560635.0,   344206200.0,  3826965285.0},
-  {4204182220.0,  1111444347.0,  1327886577.0,  3179961125.0,   472103598.0,   362335920.0},
-  { 849169057.0,  2252454610.0,  2116354422.0,  2660385506.0,  2688032257.0,   415209234.0},
-  {2112313517.0,  1876700874.0,   392556227.0,  1425663721.0,  1850176903.0,  1886503568.0},
-  {2440571332.0,  3810933251.0,  2143812876.0,  2595484778.0,  1991533579.0,   223995138.0},
-  {2237306375.0,  3307954859.0,  2169212455.0,   624527001.0,  4192483096.0,   358876803.0},
-  {1061217270.0,  3077062334.0,   617560776.0,  2697441960.0,  4285912803.0,  3413943158.0},
-  { 284118317.0,  3038226279.0,  1807353250.0,  1132493703.0,  2571590892.0,  3583837185.0},
-  {3370619702.0,   539480811.0,   344432748.0,  2573304276.0,  4249375878.0,  2944742501.0},
-  {1777725919.0,   464132616.0,   188278079.0,  1630558768.0,  1072710719.0,   337983860.0},
-  {3613329302.0,  1891093225.0,  3748516706.0,   726723249.0,   552150555.0,  2077675725.0},
-  { 623623758.0,  1858802822.0,   213596251.0,  3619743051.0,  1932885430.0,  2554112044.0},
-  {3216844256.0,  1985463865.0,   277369900.0,  2832449950.0,  1069734324.0,  3112472403.0},
-  { 170364628.0,  3609915876.0,  2363699219.0,   443641698.0,  2778864690.0,   123663923.0},
-  { 286113310.0,   452903416.0,  4224284037.0,  3940024184.0,   343885949.0,   444571293.0},
-  {1261439016.0,  2648817663.0,  4270200685.0,    47436867.0,   265727534.0,   471083230.0},
-  {1348529338.0,  2146664924.0,    96903858.0,  1859855177.0,  3099311047.0,  3645364345.0},
-  {3187843443.0,  2371694820.0,  2626172479.0,   976522266.0,   358266233.0,   983488737.0},
-  {1852759717.0,  2398293234.0,   206129900.0,  3765600533.0,  1036012982.0,  1773395139.0},
-  {1423216957.0,   388523242.0,   950222769.0,  2575070352.0,  2372691011.0,  2834671062.0},
-  {1414114513.0,  1366247733.0,  3721300525.0,   179320341.0,   751416015.0,   532417066.0},
-  {3336503294.0,  1394662641.0,  2697160335.0,  4059078023.0,  4062508631.0,  2536751532.0},
-  { 514778639.0,   362847413.0,  3072902020.0,   124821305.0,  2314096641.0,  1912778957.0},
-  {2662748482.0,  1385524251.0,  4090963984.0,  2825765499.0,  2720870111.0,  2008864452.0},
-  {1652302460.0,  3324537938.0,  1148366442.0,  2072823051.0,   308121380.0,  1059390875.0},
-  { 592053108.0,  3501371062.0,  1862217989.0,  3780371122.0,  3607049836.0,  4195799604.0},
-  {1986831742.0,  2530494653.0,  3205871211.0,  1046250478.0,  1948317923.0,  1710279979.0},
-  {3884712341.0,   117043039.0,  2551469345.0,  2288096096.0,  1419050379.0,   932796197.0},
-  {3148217360.0,  3209377456.0,  3365959402.0,  2017953488.0,  2442340405.0,  2834023413.0},
-  {3427287347.0,  3475628104.0,  3941554677.0,  3187541784.0,  2596709862.0,  4026015481.0},
-  {3909374267.0,  1467178357.0,  1636288800.0,  4040377940.0,  2468623195.0,  3865660444.0},
-  {2251891621.0,  3217161084.0,  3985058102.0,  1074989309.0,  3074829683.0,  1448017088.0},
-  {3075508867.0,  3362052402.0,  2196101914.0,  2704315383.0,   489114285.0,  2429809682.0},
-  { 499813232.0,  3164386519.0,   373607011.0,  3017628857.0,  3286215945.0,  1898684606.0},
-  {1148137255.0,  1559527257.0,   560170544.0,   480664152.0,  4194106873.0,  2708165810.0},
-  { 308777994.0,  1605842659.0,  3228452121.0,  3285402548.0,  3292442465.0,  3046600146.0},
-  {1616709911.0,  2146896708.0,  1930381795.0,  2861445427.0,   229028791.0,  1357903430.0},
-  {1073704264.0,  1758275667.0,  2187234813.0,  3704609336.0,  1858703938.0,  2333371734.0},
-  {3515194586.0,  2135063212.0,   933327518.0,  1995594766.0,  2675827786.0,  2422964937.0},
-  {2209342030.0,  4015663835.0,  3481310139.0,  1440400777.0,  2285743697.0,  3653016669.0},
-  {2567871084.0,  1400912378.0,  3869699720.0,  2721698861.0,  3485550843.0,  3366488888.0},
-  {1595827021.0,  2778874761.0,   464963448.0,  1288308378.0,  1777281910.0,  3595463193.0},
-  {1623131775.0,   670166312.0,  1977984136.0,   617721182.0,  3161394125.0,  2784773451.0},
-  { 902345592.0,  4233541014.0,  3790230141.0,  1553937811.0,   788890837.0,  1240730686.0},
-  { 487573044.0,  2628474896.0,  2097267765.0,  2287004099.0,  2691078369.0,   903893021.0},
-  { 389149274.0,  3199131500.0,  3430304205.0,   424170807.0,  1046774103.0,   433707329.0},
-  { 480610973.0,    68730646.0,  1307697297.0,  3892435526.0,   194947920.0,  1285768943.0},
-  {1284657047.0,  1256331707.0,    99477712.0,  3240252930.0,   526183629.0,  3795951564.0},
-  {3894792689.0,  3712959257.0,  3019293779.0,  2846613219.0,  2642670629.0,  3777781936.0},
-  {  22716752.0,   378300573.0,   347348156.0,  3514309797.0,  3830069637.0,  3898194397.0},
-  {2542426151.0,   846478665.0,  3215419628.0,   733320210.0,  2334467740.0,  3851559167.0},
-  {3565567346.0,  2544076050.0,  3967075721.0,  1592625633.0,  3478107110.0,  2212887523.0},
-  { 310754472.0,  2850008540.0,  2710293250.0,  1067189868.0,  2313401279.0,  2852423238.0},
-  { 448214273.0,   595529297.0,  2651858218.0,  3031660544.0,  4237781009.0,  4212106941.0},
-  {2052655309.0,  3378775715.0,  4189915312.0,  1898294219.0,  2321516603.0,  1952748618.0},
-  { 758387305.0,  2203078494.0,   430532005.0,  3791319877.0,  1088975514.0,  2146942777.0},
-  {4013005102.0,  3007996013.0,  3139568486.0,  3673836561.0,   373748435.0,    16585688.0},
-  {4168762924.0,  2873741737.0,  3180326529.0,   852184942.0,  2848182834.0,  2428126276.0},
-  {4170428027.0,  2225762322.0,  1057113797.0,  2721534346.0,  3146284460.0,  3782558583.0},
-  { 566222278.0,  4214800352.0,  1317557287.0,   374005309.0,  3096189813.0,  1764478923.0},
-  { 246664343.0,  2554834955.0,  3045686641.0,  1824525570.0,  3150282310.0,  3887195738.0},
-  {2415692605.0,  2573980639.0,  1535440999.0,   677050493.0,  2672330373.0,    57644208.0},
-  {  71535034.0,  2400073021.0,   291158368.0,  1159045227.0,  1611066057.0,  2318484401.0},
-  {1555272833.0,  2321712442.0,   502986380.0,  2333761685.0,  1765334266.0,   210156878.0},
-  {1460637057.0,   574678417.0,  3821604018.0,   222194493.0,  2713824177.0,  2611936976.0},
-  {1996562868.0,  1582287862.0,  1297674147.0,   543747440.0,  1629134641.0,  4121501212.0},
-  {3300032229.0,  2593901194.0,  2708450252.0,  1899392915.0,   764742998.0,   396861368.0},
-  {2737821854.0,  2958355405.0,  2065307334.0,  2885214855.0,  3839298628.0,  1742443743.0},
-  {3655317476.0,  1365562827.0,  2522764970.0,  4214734244.0,  1435542929.0,  1481101301.0},
-  {1103578754.0,    21273879.0,  2189280972.0,  3003137196.0,  2362656626.0,  2996537415.0},
-  { 143043432.0,  3280688552.0,  1618545887.0,  1040020463.0,  2710768915.0,  2229949166.0},
-  {1186815609.0,  3366660091.0,  1586917161.0,  3021917985.0,  4047868572.0,  1237740359.0},
-  {1822346667.0,  4279477136.0,  3977991530.0,  4140356510.0,  2253610581.0,  3132736045.0},
-  {  69504757.0,  2428376474.0,  1502664549.0,  1475568354.0,   267054566.0,  2175307837.0},
-  {  84508055.0,  3759702069.0,   130475856.0,  1358478684.0,  2832527710.0,  1839693402.0},
-  {4185671881.0,  2318233026.0,  3651622922.0,  2271898556.0,  3814578192.0,  1807435167.0},
-  {3913487356.0,  3602250580.0,   499528023.0,  3946823882.0,  1572976367.0,  2080946266.0},
-  {  34055852.0,  3148392021.0,   895443174.0,  3954610705.0,  3378432594.0,  2830823963.0},
-  {1027356081.0,  1673355864.0,   798247312.0,  2145468993.0,  1383365136.0,   766001476.0},
-  {1457679859.0,  2509463491.0,  2350032143.0,   769776897.0,  3684191143.0,  3451854781.0},
-  { 910096038.0,   998677542.0,   109790215.0,  2670913565.0,  1195688678.0,  3206051403.0},
-  {3154770804.0,  1631397301.0,    92437531.0,   581944926.0,  2160177943.0,   749303888.0},
-  {3594925975.0,  2495474193.0,    32119830.0,     8309863.0,  1188909486.0,   192042071.0},
-  {4028940647.0,  2266497288.0,  1348545681.0,   310863694.0,   692799134.0,  3647928448.0},
-  {1216787192.0,   949756435.0,  2828479579.0,  2723603575.0,  4150296553.0,  2955372059.0},
-  {2198046202.0,  2877909514.0,  2564575766.0,   730447699.0,  1866130585.0,  3195984645.0},
-  {2366015389.0,  3432433897.0,   751669731.0,  4189968611.0,   879636283.0,  1860262844.0},
-  { 216608313.0,  2902440256.0,   428172571.0,  3645874494.0,  3236661468.0,  2712402867.0},
-  {2296003721.0,  1865850021.0,   397325776.0,  1240865784.0,  3435980009.0,  2008315743.0},
-  {1800341700.0,  2117661641.0,  2496477680.0,  2421569492.0,  2539749283.0,   365548651.0},
-  {1888808742.0,  2948509522.0,  2128036350.0,  1471389490.0,   635442872.0,  2706344497.0},
-  {3765378023.0,  2446881072.0,  3471465451.0,     9932420.0,   180807759.0,  1420456916.0},
-  {1212391146.0,  2260996066.0,  1891190459.0,  3672995904.0,  1676602820.0,  2927478447.0},
-  {1616320744.0,  3461806817.0,  1132318016.0,  2841226247.0,   985333802.0,   298446377.0},
-  { 621399270.0,  2325544451.0,  3462005729.0,  1694028704.0,   181288484.0,  1349584393.0},
-  { 859461033.0,  2645260639.0,  3174009121.0,  1291576931.0,  3927279180.0,  3544518086.0},
-  {4001857869.0,  1928072106.0,  2771901152.0,  1084307125.0,  4278035844.0,  4076723613.0},
-  {1612976093.0,   982534353.0,   149444476.0,  2201781145.0,  4112753020.0,  3691609587.0},
-  { 595720654.0,  2795325713.0,   327033695.0,   509335221.0,  1518293087.0,   620747160.0},
-  {3773865409.0,   639823214.0,  1856509195.0,   470021167.0,  4286922946.0,  3230054827.0},
-  {2407695705.0,  1616607911.0,  1899704051.0,  4003205001.0,  1462057876.0,  2501048596.0},
-  {4199403578.0,   599170256.0,  1196093532.0,  4062805763.0,  1709543229.0,  2778971928.0},
-  { 857263440.0,  1330570179.0,  2942946560.0,  1626620279.0,  3997622819.0,  4220625490.0},
-  {1254297547.0,   516614371.0,  3099297836.0,  2639748765.0,  3956672787.0,   886993962.0},
-  {2874418179.0,  2718402325.0,  4051505039.0,   776617086.0,   782027760.0,    34381095.0},
-  { 361145974.0,  1709285142.0,  2935138248.0,   520542504.0,  4200397837.0,   577276857.0},
-  {3634139709.0,  4277579036.0,  2093528544.0,  4085175454.0,  2388631144.0,   870344456.0},
-  {3409862124.0,  4079726874.0,  1512644722.0,  2623222854.0,   945634120.0,  3317638018.0},
-  {1312160061.0,   116870158.0,  2900219183.0,  2830380501.0,  2254980741.0,  3698154223.0},
-  {3114493575.0,   586616941.0,  3372627488.0,  2823936551.0,  3182789005.0,  3892418438.0},
-  { 172888702.0,  2742912415.0,   324497803.0,   776679644.0,  1819129798.0,  1107177905.0},
-  {  61158986.0,  3439411412.0,  1357444221.0,  2486060858.0,  3222792163.0,  1709547360.0},
-  {2653352176.0,  4198145871.0,   297040167.0,  2351288226.0,  4237784701.0,  2421903375.0},
-  {1509706924.0,   741488058.0,  3389086751.0,  3673212679.0,  1009885160.0,  2759918187.0},
-  {2290998878.0,  4165171272.0,  4277524818.0,  1127625265.0,   490346939.0,  3022297930.0},
-  {2379616953.0,  1957930406.0,  1009323672.0,   425529505.0,  2465414961.0,  4177328691.0},
-  {1535050471.0,   205259579.0,  1138432521.0,   174904625.0,  1150480251.0,  4162868817.0},
-  {2091183457.0,  3095121355.0,   852383460.0,  1255501169.0,  2109414379.0,  2816663951.0},
-  {4041482143.0,  4105836758.0,  1715237511.0,  4144657832.0,   769161682.0,   793338649.0},
-  {2634729229.0,   824270252.0,  2081166572.0,  2056841376.0,  1146119424.0,  1539527553.0},
-  {3143334995.0,  3355121028.0,  2222362113.0,  1544034508.0,  2662952856.0,  2649581069.0},
-  {2022495198.0,   191335762.0,  1864623409.0,  4141567408.0,  1800359856.0,   963756409.0},
-  {1281793579.0,  3227472576.0,   344343982.0,  1906127333.0,   664565645.0,  2647466526.0},
-  { 849094294.0,   169414882.0,   623204924.0,  1827467304.0,  2062291263.0,  2149400142.0},
-  { 868449678.0,     1329300.0,   784048146.0,  2890365326.0,  2432086385.0,  1863932546.0},
-  {2795534741.0,  3501626395.0,  2996408061.0,  3024307585.0,  4246907165.0,  2436993335.0},
-  {1125079741.0,  1901301673.0,   355917598.0,  3279757573.0,  1200782823.0,   243420303.0},
-  {3134429784.0,   558648801.0,   511540772.0,  1940687583.0,  2400760801.0,  3935237053.0},
-  { 394348952.0,  1984759116.0,  4065067427.0,  2896131585.0,  2642760802.0,  2764111011.0},
-  {1670990134.0,  3076661984.0,  3717278105.0,  3686657598.0,  2560002030.0,  2486737057.0},
-  {3605008764.0,   711639349.0,  2930668111.0,  1144066603.0,  1334230250.0,  4081543931.0},
-  {3693490142.0,  2299958928.0,  2897321413.0,  1228353395.0,  4158885954.0,  1807071706.0},
-  {  29447256.0,  1338644113.0,  3746130342.0,  3704087795.0,  1889549207.0,  3411481540.0},
-  {2329660613.0,   818290923.0,   315255992.0,  2573235101.0,  4212394297.0,  1697632381.0},
-  {3599266502.0,  3346757542.0,  1243086796.0,  3028917682.0,   268264192.0,  4248373027.0},
-  { 822266896.0,  3715176857.0,  1378512965.0,  1324416727.0,  1589029736.0,  2081751026.0},
-  {1622243378.0,  3572061853.0,   795637184.0,  1488813169.0,  3862672732.0,   811758990.0},
-  {3504965683.0,  2544365837.0,  2740344548.0,  3972139361.0,  1538818870.0,  1779600287.0},
-  {4100842876.0,  3293669663.0,  4025719527.0,  2557962505.0,  3227875123.0,   647440755.0},
-  {1355533782.0,   447309103.0,    14304448.0,  1771538706.0,  3888859349.0,  3247602379.0},
-  { 790935303.0,  1738176595.0,  3792256520.0,  4191116567.0,   754992251.0,  3197243026.0},
-  {3404667817.0,   949626336.0,   410801946.0,   985874981.0,  1958126054.0,  3870529098.0},
-  {3719747524.0,  3953107150.0,  3111720710.0,  3410004463.0,   387345002.0,  2599429619.0},
-  {3802229859.0,  1879275672.0,  3012469321.0,  1270899899.0,  3469136444.0,  4139676786.0},
-  { 999459478.0,  3329147702.0,  1080769212.0,  1459627146.0,  2636740380.0,  2477731833.0},
-  { 113159666.0,  1431903314.0,   268865106.0,  1114757786.0,  2485241148.0,  1304047277.0},
-  {3185293040.0,  3701391231.0,  4036134019.0,   527750097.0,  1666128667.0,   567150503.0},
-  {2607036762.0,  1443621927.0,   440486455.0,  3830754344.0,  2638523286.0,  2830073062.0},
-  {2615421776.0,  1640206496.0,  1612897042.0,  2719863852.0,  2697202341.0,  1885095876.0},
-  {3404280017.0,  2047655539.0,  1709051397.0,   371506757.0,   878013368.0,  4194786378.0},
-  {1822174164.0,  2726051755.0,  1672779029.0,    80135120.0,  3453241998.0,  3130344013.0},
-  {2601688135.0,  3773865298.0,  3016339318.0,  2569995298.0,   339116268.0,  2260115186.0},
-  {3772695985.0,  2475366368.0,  1926294573.0,  2800832672.0,  2208092404.0,  1189120818.0},
-  {1711040530.0,  4254805134.0,  3665702542.0,  3842921779.0,  4221766719.0,  2342004301.0},
-  {4075087035.0,  4175460611.0,  3659246192.0,  3965809560.0,  2238786956.0,  2773291408.0},
-  {1928285807.0,  3033533641.0,  3074856939.0,  3161049670.0,  2608521306.0,  3930353671.0},
-  {2571515253.0,  2085552066.0,  4194037957.0,   511973480.0,  2499380540.0,   944195594.0},
-  {4180792335.0,  3743557037.0,  2280547658.0,  1850744142.0,  1521526298.0,  3059563815.0},
-  {1015532926.0,  2147466773.0,  3427059515.0,  3131036326.0,  1867868090.0,  3232970999.0},
-  {3852547188.0,   693721535.0,  2091266059.0,  3188691140.0,  1661412903.0,  3475173062.0},
-  {4130036801.0,   571226058.0,   117615426.0,  2972527569.0,  2032544684.0,  2406499012.0},
-  {4115181329.0,  2067643243.0,  3094569315.0,  2822415764.0,  2218541712.0,  3684725605.0},
-  {3462974996.0,   464208135.0,   605994560.0,  2458207916.0,  2858223078.0,  3934673418.0},
-  {1935489361.0,   378929675.0,   172415536.0,  1769981989.0,   591121985.0,  2229910726.0},
-  {4261953279.0,  1332016129.0,  4222767231.0,  3201597084.0,   203037517.0,  1601882355.0},
-  { 781058504.0,  3891916536.0,  3568745584.0,  1991658462.0,   107329491.0,   472259933.0},
-  {3676563766.0,   446878072.0,   642852298.0,  1899001774.0,   838669806.0,   653467021.0},
-  {2101023706.0,   206611966.0,  1595600115.0,  1616591920.0,  4224249385.0,  3246745620.0},
-  {2071796976.0,  3405613580.0,  1608271185.0,  4091624060.0,   801790673.0,  4283900258.0},
-  {  82343951.0,   783605951.0,   683002059.0,  2002417266.0,   936920854.0,  3484142676.0},
-  {3180180901.0,  2869711856.0,  2471388517.0,   997211345.0,  2823009280.0,   433086067.0},
-  {2848465143.0,  1936509574.0,   516892963.0,  1958134098.0,  3419122943.0,  1832282764.0},
-  {2512447557.0,  1417563637.0,   294901197.0,  1670989804.0,  3005116175.0,  3022893523.0},
-  { 582243748.0,  3593130119.0,   976733859.0,  1395093680.0,  1817437630.0,  2330353596.0},
-  {3930967331.0,  2737585872.0,  3032409765.0,  3092721354.0,  1065337966.0,  1251414820.0},
-  { 916623326.0,  2077292298.0,   395995498.0,  2550472462.0,  2797783377.0,   795879098.0},
-  {2733219989.0,  2500566562.0,   270286102.0,  4002215531.0,  3936098543.0,   496998143.0},
-  {2281125753.0,  3498677177.0,   764788956.0,   159898809.0,  1660990008.0,  1541077028.0},
-  {4246043148.0,   603605509.0,   899341978.0,  2809616720.0,   676177330.0,  2832048003.0},
-  {3924207300.0,   495378455.0,   201555053.0,  1988648479.0,  1056297493.0,  3991293597.0},
-  {1404275089.0,   383079708.0,  4222422742.0,  1548278394.0,  3283938152.0,  1372745408.0},
-  { 838243958.0,  2755156191.0,  2316938131.0,  2584700269.0,   471727909.0,  2224130719.0},
-  {2294277431.0,  2369124831.0,  2109942119.0,   370697567.0,  1377753093.0,  2550567262.0},
-  {3870370125.0,   599298091.0,  1303496645.0,  3237575757.0,  3113466090.0,  3618922888.0},
-  { 519508304.0,  3587756588.0,  2258990681.0,   203345601.0,    91535557.0,   969849140.0},
-  {2291356926.0,  1250905121.0,  2334442063.0,  3407231458.0,  2252443027.0,   322070264.0},
-  {1357109122.0,   633800327.0,  3210172433.0,  3002781024.0,  4183025681.0,  1575153727.0},
-  {2542544389.0,  1855743410.0,  3060162824.0,  1236197534.0,  1282557344.0,  3016668861.0},
-  {2174604750.0,    23908394.0,   681658101.0,   537064161.0,  2501731678.0,  1536286270.0},
-  {2872347311.0,  1281239349.0,   586541560.0,  1959219596.0,  1046209534.0,  1018338763.0},
-  {1276499355.0,  2286354884.0,   726156767.0,  1378208131.0,    97112787.0,  2821784117.0},
-  { 936136809.0,  3147630878.0,  3805143872.0,  2972816609.0,  1319190863.0,  1736632475.0},
-  {1973581109.0,  1425660984.0,  2126944171.0,  2071656274.0,  1703258686.0,    29343300.0},
-  {3015177650.0,  3382201673.0,  3732562020.0,  2515171840.0,   656875886.0,  3019164621.0},
-  {2741073651.0,  2144085178.0,  3420925789.0,   382258311.0,  2535476949.0,  2582507031.0},
-  {3629353314.0,  1538693175.0,  1254657212.0,  2245177877.0,  3770656720.0,  1352128744.0},
-  {1790882525.0,   867578027.0,  2364506578.0,  1368027273.0,  1743562898.0,  3778781081.0},
-  {3576537185.0,   778948138.0,  2549347781.0,  1662814869.0,  3397621888.0,   285259933.0},
-  {4147635618.0,   263524358.0,  3316574690.0,  3880248657.0,  1155880784.0,  1578561702.0},
-  {3993236667.0,  3922811875.0,  1261905771.0,   593503073.0,  2644670866.0,  2025933743.0},
-  { 143456450.0,  2353586959.0,  2912872917.0,  1402576367.0,   577066513.0,   331304989.0},
-  {2239872153.0,   521822184.0,  1843583474.0,  2795789400.0,  1699725961.0,  2466052069.0},
-  {1640961861.0,  3605195187.0,  2849626108.0,   563329912.0,  3632066803.0,   955556963.0},
-  {1212763395.0,   930215731.0,  1916221857.0,    37031083.0,  3951269627.0,  2683575442.0},
-  {1860018359.0,  3873194583.0,  1396622807.0,  1205448629.0,  2917531341.0,  2935324393.0},
-  {1928095429.0,  2841954087.0,  3856334280.0,  2824252342.0,   797712414.0,   840794584.0},
-  {2925979994.0,  3563208682.0,   135927275.0,  4128049473.0,  4040917978.0,  3866783142.0},
-  { 536443286.0,  1540488742.0,  3093019791.0,  3529228602.0,   358356128.0,  2785952915.0},
-  {2381020483.0,   186346999.0,  1367649629.0,  1639779263.0,  3732541776.0,  1266582110.0},
-  {3940357229.0,   819622590.0,  3464884833.0,   786203927.0,  2910632440.0,  1987712170.0},
-  {1817502354.0,  3115656915.0,  3089075030.0,  3386376201.0,  3252971751.0,  3230338991.0},
-  {2535126588.0,  3330129830.0,    74643585.0,   553408912.0,  3475402431.0,  1037848350.0},
-  { 352661153.0,  3399302189.0,  3286975549.0,  2181832290.0,  4035855336.0,  1020046106.0},
-  {1051904362.0,  3898599528.0,    29277910.0,  3650780514.0,  1637318512.0,  1994702789.0},
-  {3871250515.0,  2806587771.0,  2097657919.0,  4009148701.0,  1474748364.0,  1126574905.0},
-  {2639218051.0,   755051211.0,  3683338849.0,  3141710644.0,  3751510973.0,   889230029.0},
-  {1237329728.0,   833459958.0,   392945970.0,   449430315.0,    64642744.0,  2195931272.0},
-  {1401142943.0,  4099049128.0,   780970851.0,  3953993883.0,  2733310615.0,   104700104.0},
-  {1118812605.0,  2280822118.0,  3194085371.0,  1112123419.0,  2448605642.0,  1902745994.0},
-  {4063571582.0,  3178219388.0,  2970224427.0,   724274611.0,  1412286093.0,   615767996.0},
-  {3085676126.0,  3513150461.0,  3137712329.0,  2143830960.0,  2850353785.0,  1212305547.0},
-  {  74852197.0,  2445551769.0,  1005362461.0,   941641287.0,  4052871852.0,  1092002414.0},
-  {2725865524.0,  2526413613.0,  1059555426.0,  1076946550.0,  3538510762.0,  2329057682.0},
-  {3511187788.0,  2849411922.0,  1139811627.0,  3061395323.0,  2116084564.0,   381685341.0},
-  { 816400517.0,  2165110498.0,   980734239.0,   386657644.0,  1571390551.0,   390323586.0},
-  {2331707082.0,  3558875544.0,  3506959807.0,  3520038727.0,   686379125.0,  2895121099.0},
-  {3330964124.0,  2016046547.0,  2650541376.0,  2207051533.0,  2260443202.0,  1493558613.0},
-  {2471201440.0,  1122187202.0,  3266482314.0,     1868021.0,  1221442941.0,  1952304867.0},
-  { 384028932.0,  3165256251.0,    12527618.0,  3977181174.0,  1492907780.0,  3009556627.0},
-  {3977583863.0,  3379813604.0,  1889781080.0,  4259888740.0,  2420970822.0,  1699427027.0},
-  {1175377122.0,  2202096630.0,  1770224295.0,  1171211600.0,  2455140285.0,  4053182825.0},
-  { 944758496.0,  1597909858.0,   463061874.0,  2232532298.0,  2411223999.0,  1139588852.0},
-  {3796531775.0,  4105629343.0,  1637691674.0,  2527454876.0,  1536808133.0,  2852654071.0},
-  {3896204661.0,  4070277420.0,  1143892920.0,  1475779675.0,  3721192605.0,   365494379.0},
-  {2240105858.0,  1898622869.0,   456838428.0,   207756399.0,   946240179.0,   206948081.0},
-  { 271800717.0,   199415206.0,  3356828747.0,   814588650.0,  2060454121.0,  3182382772.0},
-  {3750581551.0,  4102053057.0,  3276262693.0,  1208904500.0,   539003542.0,  1862037122.0},
-  { 973099642.0,  1499447226.0,  3614841299.0,  2517497890.0,  3230388048.0,  3482919703.0},
-  { 723407579.0,  3926681154.0,   622624116.0,  3904307605.0,  4166741301.0,  3107571573.0},
-  {2235705219.0,  2945309222.0,  1708269882.0,  1036309815.0,  4167741176.0,  2195231503.0},
-  { 848597511.0,   765355692.0,   296229400.0,  3545225635.0,  1918164295.0,  2057010462.0},
-  { 581446345.0,   442851392.0,  3230075566.0,  3728924474.0,   449187706.0,   114639649.0},
-  {3705662639.0,  3074346106.0,  2226582939.0,  3729645923.0,  3935242945.0,  2309924481.0},
-  {1741852893.0,  3814741953.0,   525025638.0,  2216236049.0,  3979473501.0,   421912565.0},
-  {3033475582.0,  1325270585.0,  3801952106.0,  2693236538.0,    22208203.0,  1467190946.0},
-  {2542324081.0,  2570807058.0,  2751078654.0,  4083489366.0,  3018407987.0,  2071390148.0},
-  {3738953616.0,  3956048845.0,  2211559693.0,  3862511950.0,   430120904.0,    64326780.0},
-  {2293129246.0,  1517867649.0,  2770831408.0,  3098716545.0,   183585007.0,  1845552118.0},
-  { 390403222.0,  1162688848.0,  2889236814.0,   407679451.0,  2855660430.0,   420489025.0},
-  {2643393158.0,  1875049493.0,   424036486.0,  4111953626.0,  4253158843.0,  2961056342.0},
-  {2309869438.0,  4123989838.0,   175919189.0,  2887790791.0,  3866644744.0,  3326340064.0},
-  { 632304229.0,  2991469835.0,  3322737047.0,   708702870.0,  2988425985.0,  2829771284.0},
-  {1523181631.0,  2527240962.0,  2640616941.0,   688164131.0,   338605364.0,    87517713.0},
-  {3754193722.0,  1377558772.0,   337662800.0,  1487208076.0,  2325128420.0,  1934865177.0},
-  {2875201548.0,  1352387826.0,  3143927189.0,  1037189485.0,  1055525799.0,   407904414.0},
-  {3710121883.0,  1040366139.0,   874244021.0,   703814052.0,   774455800.0,  3811807466.0},
-  { 839242786.0,  1194176659.0,  1419320144.0,   498708910.0,  3089671285.0,  1161094660.0},
-  { 238148702.0,  1804469148.0,  1747063815.0,  3013853053.0,  2231179061.0,  2898003259.0},
-  {1442375647.0,  2109263241.0,  2145268407.0,   178546186.0,   238635795.0,   499268376.0},
-  { 486625745.0,  3046669688.0,  2828766431.0,  3074672917.0,   349843002.0,  1313292480.0},
-  {3908442651.0,  3724956816.0,  3212179813.0,    83624531.0,  2169929907.0,  3825124193.0},
-  { 193375308.0,  3198139592.0,  3570643537.0,  2989754139.0,  4047510071.0,   434353242.0},
-  {1650149464.0,  1179606754.0,    49953833.0,  4026100689.0,  4243831993.0,  3512275996.0},
-  {1113188382.0,  2088852879.0,   465263763.0,  3332078346.0,   336106143.0,  1651549264.0},
-  {3204904151.0,  3183389320.0,  1092655450.0,  2926527994.0,  3492339855.0,   574309614.0},
-  {  98507761.0,   969703112.0,    44345394.0,  3511994644.0,  3118924378.0,  1319864374.0},
-  { 702727724.0,   995079335.0,   419087034.0,   562711223.0,  2662464081.0,  2558429782.0},
-  {3572071170.0,  3375881754.0,  1471854996.0,   253249227.0,  2425588467.0,   580767733.0},
-  {3137280469.0,  1634309807.0,   978285263.0,  1844504430.0,  3199882524.0,   817960461.0},
-  {1352360984.0,  3596142264.0,   830961296.0,  1734683034.0,  1581853387.0,  1212770001.0},
-  {1614721151.0,   648750139.0,   244923711.0,   773579549.0,   955934474.0,   467854313.0},
-  {1474873247.0,  4181382394.0,   281538129.0,  3799010667.0,  4222967255.0,  1854767500.0},
-  {2124756647.0,  3999995576.0,  1127287394.0,  4001234395.0,  3743570651.0,  2842658396.0},
-  {3397737099.0,  1185009615.0,  3133872849.0,  1396296382.0,  1346366157.0,  2899317580.0},
-  { 866432252.0,   468586107.0,  2875124331.0,  1295914846.0,   394440694.0,   934963917.0},
-  {2556626790.0,  1877075961.0,  3123161114.0,  1292838783.0,  1879676239.0,   457177063.0},
-  { 433304087.0,  3331322297.0,   383103863.0,  3485407751.0,  1250484883.0,  1170071844.0},
-  { 441485963.0,  3543581914.0,  1982298251.0,  4249365123.0,   344212536.0,  3970909841.0},
-  {1717508150.0,  2284202754.0,  3634754158.0,   274570737.0,  2641341540.0,  1758214478.0},
-  {2500647437.0,  3487295683.0,  2359669822.0,  3609102617.0,  1735187948.0,  3074233986.0},
-  {1376909520.0,   359703637.0,  1116596426.0,  3900372815.0,  3214141768.0,  2392663321.0},
-  {1002272123.0,  3774288810.0,  2761154042.0,  3061309599.0,  3627796635.0,  4091039436.0},
-  {1635530677.0,   851099203.0,  1545654027.0,  1939046055.0,  1831642698.0,   785528978.0},
-  {3310687475.0,   654213097.0,  4092184789.0,  2220416855.0,  3446037347.0,   868553190.0},
-  {3565446852.0,   679203235.0,  1924692916.0,  2493153164.0,   355954564.0,  2276481792.0},
-  {2015048115.0,  1705620779.0,  2798094220.0,  2461858984.0,  2100851563.0,  3975761973.0},
-  { 158457629.0,   685607782.0,  3725711933.0,  3341731355.0,  2516273098.0,   762735153.0},
-  {1856696078.0,  2002797523.0,   899371219.0,  1081356743.0,  3075613203.0,   921542687.0},
-  { 678207955.0,  2700061961.0,  1539496426.0,  2107145159.0,  1891059555.0,  1330785482.0},
-  {2027986378.0,  3013110804.0,  4051671089.0,  1292616417.0,  2029970969.0,  2782117132.0},
-  {1100081696.0,  2618672869.0,   571066633.0,  2777339598.0,  1894975020.0,  2908532667.0},
-  {3754462205.0,   893643138.0,  2987301968.0,  1209802551.0,  2626292508.0,   368186672.0},
-  {2752353354.0,  4227352596.0,  1815496647.0,  1395156245.0,  3656522944.0,   591539754.0},
-  { 227837719.0,   172314071.0,  3968807181.0,  3235901995.0,   414406665.0,  1254292788.0},
-  {3430616454.0,  1011330657.0,  1093823932.0,  2077907406.0,  4225377577.0,  3470139592.0},
-  {4214275271.0,  1864474371.0,  1239944690.0,   277434671.0,   668256860.0,   851402703.0},
-  { 269146227.0,  3608576036.0,   306561328.0,   637916055.0,   328503754.0,  1182872920.0},
-  {2496713049.0,  2870234737.0,  1138530125.0,  3663924297.0,   942413631.0,  1643043796.0},
-  {1500063476.0,  1838818672.0,  3047733503.0,  3727101554.0,  1524461636.0,  1750260055.0},
-  {2500012255.0,  1423257151.0,  4288426177.0,  4162410522.0,  2321689396.0,  2848946495.0},
-  {2121028605.0,  2625872309.0,   513584923.0,  1239464261.0,  1917720050.0,  3250545325.0},
-  {2121146694.0,  3151940222.0,  2191863909.0,   865931964.0,   586332119.0,  3563052577.0},
-  {1939928449.0,   209869832.0,  1737837992.0,  3652120840.0,  3253175653.0,   626463420.0},
-  {2088004265.0,   324050558.0,  2499110141.0,   190990746.0,  4070894084.0,  1180420592.0},
-  { 288285864.0,  4143632145.0,  1213345422.0,  2171772484.0,  2735325298.0,  2487876662.0},
-  { 817797728.0,  3542229393.0,  1661612211.0,  3853880785.0,  1903112045.0,  2211136958.0},
-  {4229973096.0,  3934296093.0,  2017937683.0,  1701583029.0,  2867910911.0,  1952962126.0},
-  {2218120897.0,   391498315.0,  1922393632.0,  1836782326.0,  4116989016.0,   619955432.0},
-  {1322948293.0,  3089639532.0,  2131079992.0,   393428184.0,  2724424973.0,  3524517528.0},
-  {3541111121.0,   738561409.0,  1791117834.0,  2301355750.0,  2321123145.0,   925395337.0},
-  {1492239258.0,  3331397753.0,  1342569086.0,  3944026722.0,  2842951129.0,  2931276516.0},
-  {3742354486.0,     3030172.0,  3927681470.0,  2286004850.0,  1062378285.0,  1887676814.0},
-  {2441344744.0,  1775154441.0,  4220183767.0,  2952417397.0,  3748295167.0,  1543055858.0},
-  { 628237509.0,   857701432.0,   517538599.0,   831539125.0,    33930395.0,  1383403546.0},
-  {1026559897.0,   286569105.0,   579008531.0,  1675232333.0,   874455592.0,  1620980393.0},
-  { 883072518.0,  2899336565.0,  2356509468.0,  2734728140.0,  2519756835.0,  4280957773.0},
-  {1288945959.0,  1553420449.0,  1256898872.0,   511903866.0,   628923414.0,   157625413.0},
-  { 801753079.0,  1053157281.0,  3143374566.0,  4201753809.0,  2762737338.0,  3163930922.0},
-  {2491827906.0,  1649444925.0,  2569984203.0,  2115589290.0,  3295133390.0,  2827146286.0},
-  { 208484930.0,  3914886612.0,  1330492083.0,   867856478.0,  4223929065.0,  4234992473.0},
-  {1521226297.0,  3948665610.0,   563462025.0,  3586311094.0,  2913581933.0,  3722449010.0},
-  { 646927618.0,  2039014007.0,  2171892743.0,  1436136797.0,  3127082741.0,  3292247596.0},
-  {3546091236.0,    99564913.0,  1908293258.0,  4151746490.0,  4226865204.0,  3083801348.0},
-  {3510826166.0,  2671177047.0,   938419497.0,  3180378491.0,  1169049140.0,    17742673.0},
-  {3265088809.0,  3700450378.0,  1419928462.0,  3934238187.0,  1926904571.0,  1495296292.0},
-  {1997592025.0,  3451255489.0,  1082563396.0,  2810668966.0,  1744767105.0,  2194989135.0},
-  {3147700690.0,   537211103.0,  4285675261.0,  3381533328.0,  3639054670.0,  1661367045.0},
-  {2576492154.0,    70580777.0,  4006824903.0,  2241051423.0,  2928020929.0,  3953433785.0},
-  {3924696879.0,  4184899467.0,  3495748468.0,  1476473360.0,  2301803984.0,  2106198436.0},
-  {1591316976.0,  3875849555.0,  3576553758.0,  3171493827.0,   465318360.0,  3632476371.0},
-  {1408089568.0,   291155017.0,  1865080066.0,  1276161913.0,  4289818155.0,  3404257880.0},
-  {4148343813.0,  4094770428.0,  1642179686.0,  3537040458.0,   297689520.0,   420234650.0},
-  { 920980189.0,  2333001610.0,  2674729472.0,  3121055833.0,  1338370168.0,   216923715.0},
-  {1556952763.0,  1365504817.0,  2033486773.0,   380576627.0,  1468459222.0,  2968503350.0},
-  { 940698214.0,  2714747808.0,  3262058109.0,  1104844280.0,  3370682448.0,  1319165327.0},
-  {3301205855.0,  3032433026.0,  4260178144.0,  3325716893.0,  2200977245.0,  2898343462.0},
-  { 351070049.0,  2003064435.0,  3205089424.0,  2804874866.0,  1779009959.0,  2638900657.0},
-  {1600693405.0,   796576793.0,  3151281018.0,  3367963324.0,   854983101.0,  4128925175.0},
-  {2450770784.0,  1924002481.0,   579308207.0,  3117586963.0,  3919724533.0,   691943386.0},
-  { 757599247.0,  2684236234.0,  3206719957.0,  2699904438.0,  2042608971.0,  2393779404.0},
-  {2277929892.0,  1572153148.0,  3774023818.0,  2027946732.0,  2960559026.0,  2005732955.0},
-  {2499434119.0,    64947910.0,  2565434311.0,  3810956926.0,  2440824010.0,  1898551064.0},
-  {3263545052.0,  3177313383.0,  3648451964.0,  2840383280.0,  2928494464.0,  2166830613.0},
-  { 608806474.0,  3621293591.0,  3427131904.0,  3382345060.0,   788934427.0,  3865305670.0},
-  {3577314770.0,  3167941655.0,  1279163642.0,  1729569331.0,     1207214.0,  2950916794.0},
-  {3864512111.0,  3389192771.0,   752046548.0,  1515434426.0,   997690216.0,  3505659794.0},
-  {3895272529.0,   296425808.0,   643127582.0,  1972601734.0,  3639530407.0,  4141670406.0},
-  { 361172069.0,  3539059435.0,  1817178915.0,   598761762.0,  1469523986.0,  3193159294.0},
-  { 866293938.0,  3237019262.0,  2869836955.0,  4269123698.0,  3235076247.0,  1368621222.0},
-  {2250886150.0,  2561607496.0,  3559629909.0,  3273087555.0,  4053333755.0,   178486588.0},
-  {3632843181.0,  2812010694.0,  3263314562.0,   824634745.0,  2301264245.0,  2456133525.0},
-  {1675599338.0,  3315118423.0,  1393985525.0,   980789663.0,   476702784.0,  2178950433.0},
-  { 500698754.0,  3010869880.0,  3060303247.0,  4071704276.0,   460352586.0,  3223821211.0},
-  { 913376882.0,   803906269.0,  2619703404.0,  1584684712.0,  2696900624.0,  3274299619.0},
-  {3985978667.0,  2034982218.0,   239903217.0,  1984838672.0,  3578536305.0,  3043720666.0},
-  { 615211137.0,   101600950.0,   715721157.0,  3437061955.0,  3747376403.0,    42140530.0},
-  { 635982506.0,  3242725442.0,   520431252.0,  1639259861.0,   107858406.0,  1331489288.0},
-  {1921043255.0,  1505095515.0,  3690620561.0,  1183750794.0,   769017706.0,  1510911966.0},
-  {3746425517.0,  1855035567.0,  2898406359.0,  2577489192.0,  4179395842.0,  3515582410.0},
-  {1663833699.0,  3973486507.0,  2792376276.0,   183910268.0,  3320717824.0,  1077842671.0},
-  {3699934121.0,  2186863283.0,  2896820892.0,    58178520.0,  2689129967.0,  1922412142.0},
-  {1393645920.0,  1995231082.0,    32894555.0,   425964777.0,  1889855384.0,  4097774513.0},
-  {1154833833.0,  2430117478.0,  3918657985.0,  1545458579.0,  1081887548.0,  3861723175.0},
-  {2822689576.0,   115712318.0,  2694016307.0,   356684833.0,  1219712168.0,  2574748899.0},
-  { 800070925.0,   289749088.0,  2837537096.0,   892499662.0,  1452443641.0,   415426445.0},
-  {1425990069.0,  1872742740.0,  2215820852.0,   177457044.0,  1100613269.0,  3599109967.0},
-  { 907079945.0,  1453357583.0,  1202390484.0,  3544213622.0,  3654317420.0,  2409493986.0},
-  {2772374320.0,  2530100139.0,  1229944185.0,   389394062.0,  3333084479.0,  1833509362.0},
-  {1359547362.0,  3963650481.0,  3538647430.0,  3885901231.0,  1938234575.0,  3237698574.0},
-  {1095164929.0,   451340437.0,  1130039945.0,   443106097.0,  3257138446.0,  3744804616.0},
-  {3629646878.0,   473803546.0,  2398508292.0,  1894729953.0,  1093255142.0,   900439630.0},
-  {3954936601.0,  1566486586.0,   467405763.0,  1017012785.0,  2117790258.0,   188793275.0},
-  {1680981424.0,  3599914171.0,  4142257509.0,  2896085394.0,   557240418.0,  1923809286.0},
-  { 447938253.0,  1735752973.0,  3115225541.0,  2235420031.0,  1355422930.0,  1783837467.0},
-  {3290559863.0,   575293648.0,  3297683274.0,    42874588.0,  1663833294.0,  2015945376.0},
-  {1643208162.0,  2344037430.0,  2160719220.0,  2465921836.0,  3896515851.0,  3991012157.0},
-  {3815943328.0,   268294775.0,  4243904347.0,  2415519497.0,    19455403.0,   378112243.0},
-  {2605757292.0,  2287102565.0,  2245037683.0,   808256055.0,  4278667668.0,  2159373078.0},
-  {1454796439.0,  2198491427.0,  1225175406.0,  3745409665.0,   137477630.0,  2695485599.0},
-  {2414237566.0,   933981095.0,  2662326363.0,  1747663035.0,  1504515725.0,  3085241372.0},
-  { 361665789.0,  2345472403.0,  1148425120.0,  2097015246.0,  3842949763.0,  1848305680.0},
-  { 288048475.0,  4132106109.0,   519617865.0,  3597944069.0,  3337092561.0,  2972671666.0},
-  {2228405632.0,   517749907.0,  2943198792.0,  3771566845.0,  1895335285.0,  2401261476.0},
-  { 810876082.0,  3839081991.0,   624182451.0,   254961217.0,   639746743.0,  1407040878.0},
-  {3110626871.0,  2455685679.0,   604247482.0,   150546190.0,  1255401003.0,  1753571529.0},
-  {3050750002.0,  3549498251.0,  3913973870.0,  3536333818.0,  4105242633.0,  1835557928.0},
-  {1763259727.0,  4250754451.0,  4140524204.0,  3692083635.0,  3006956770.0,  1074101598.0},
-  {2933586203.0,   535035668.0,  1795971882.0,  1714325059.0,  1293581371.0,   580289863.0},
-  {1123881481.0,  1190664137.0,  3700342517.0,  4025085872.0,  3211899352.0,   948846146.0},
-  {1937873168.0,  2704414723.0,  1407200795.0,  1713499416.0,  2624391995.0,  2655295862.0},
-  {3426311077.0,  1264157065.0,  2812340154.0,   642485737.0,   333443271.0,  2677708380.0},
-  { 879358299.0,  1391153382.0,   720197301.0,  2023684818.0,   570560170.0,  3511415508.0},
-  {1567749152.0,  4009773330.0,  2806119776.0,   777587027.0,  2009630676.0,  2469740750.0},
-  {3727540828.0,   835384616.0,  2268496103.0,   525405700.0,  1811150914.0,  3223115141.0},
-  { 342004968.0,  3757915048.0,  4180484379.0,   570089809.0,  3349936441.0,  3687197747.0},
-  {3282099785.0,  2983185937.0,    78078534.0,  2643239794.0,  1756561209.0,  1974892167.0},
-  { 974083433.0,   973264248.0,  4237854382.0,  3704853235.0,  3742006177.0,   807497594.0},
-  { 634769922.0,  3955247283.0,  3151943895.0,  1985439529.0,  1641635804.0,  2285305024.0},
-  {3797394921.0,  1134335831.0,  2140795995.0,  1476262462.0,  2258124972.0,  1957698352.0},
-  {3296214193.0,   153548571.0,  1204699054.0,   265882911.0,  3474381251.0,   209496848.0},
-  {1086862158.0,  3755700704.0,  3855669916.0,  1916847215.0,  3843984825.0,   425255623.0},
-  {1651569974.0,   888638305.0,  2358433222.0,   364069493.0,  2763643527.0,  2069300581.0},
-  {2319559404.0,  2870554337.0,   311344724.0,  3648800678.0,  3289791952.0,   707401797.0},
-  {3074177958.0,  3850167347.0,  2288028887.0,   616132856.0,   810903254.0,  3580373522.0},
-  {3488049832.0,  3143672686.0,  2692525474.0,  1644820370.0,  3125945713.0,   237224859.0},
-  {1157459071.0,  2057495106.0,  4182168061.0,  1116407876.0,   240729864.0,  3824454200.0},
-  {1723719020.0,  1236382758.0,  3431939370.0,  2224266607.0,  4204346937.0,  3363328485.0},
-  {2237374042.0,    71191996.0,  3061999551.0,  2403460118.0,  1372439412.0,   862282158.0},
-  {3148690741.0,  4286323139.0,  3710979391.0,   578548364.0,   186542282.0,   683598959.0},
-  {2087196436.0,   247803495.0,  1142699289.0,    59847742.0,  1204840302.0,   187014583.0},
-  { 250152825.0,  3340800210.0,  1087595108.0,   330866103.0,  2835314845.0,  1642882435.0},
-  {2804105338.0,  2812995513.0,  3981828822.0,   747480815.0,  3842247017.0,  2841337852.0},
-  {3482887777.0,  4203629376.0,  3365222002.0,  1072888913.0,   680143767.0,  2204166447.0},
-  {1884715701.0,   674917415.0,  1473734371.0,  3945503110.0,  3596620161.0,  3334748118.0},
-  {3300084893.0,  2492957302.0,  3049412021.0,   994277436.0,  3206050306.0,  1944412199.0},
-  {3601293051.0,  2514820405.0,  2230227227.0,   724778748.0,  2245829713.0,    39132111.0},
-  { 806880163.0,  4008326252.0,   533738425.0,   885550631.0,  1520895408.0,  2302360135.0},
-  {1873093507.0,  3955474775.0,  2800071814.0,  2313530461.0,  1124954732.0,   867180261.0},
-  {1457885723.0,  2314766908.0,  3543981099.0,  2966626280.0,   667902968.0,  3883416168.0},
-  { 414357406.0,   752110526.0,  1070440292.0,  4077655817.0,  1100791910.0,   236406864.0},
-  { 909802337.0,  3479887861.0,   649520604.0,  2423476243.0,   286998915.0,  3431368157.0},
-  {3437717636.0,  1760728864.0,  2542241473.0,    66366565.0,  1242149946.0,  3442593908.0},
-  {1408586695.0,  1438600814.0,  3011452729.0,  2660448380.0,    23595657.0,   629611930.0},
-  {3732298805.0,  3760589089.0,  3528948952.0,  4240739491.0,   109242076.0,  3150487645.0},
-  {2423120261.0,  3717383267.0,  1844131905.0,   438982756.0,  3407683931.0,  2387567970.0},
-  { 268556391.0,   565221627.0,  3770099810.0,  1707904397.0,  2923141830.0,  2482448093.0},
-  { 191328508.0,  3383811202.0,  3381816866.0,  3134155565.0,  2674448387.0,  1238678975.0},
-  {2170436545.0,  3629871948.0,  2623332598.0,  3813943246.0,  1740549543.0,  1408134015.0},
-  {3434471595.0,  2462042097.0,  1307167232.0,   575549549.0,  4249762247.0,  3761316935.0},
-  { 883104213.0,  2329505383.0,  1188052589.0,  1475541834.0,  1801130757.0,  2148292509.0},
-  { 681291508.0,   142225748.0,   173993155.0,  3007218784.0,  1976344952.0,  2005760891.0},
-  {1811605462.0,  1609972396.0,  4195278419.0,  1425001355.0,  2757109763.0,   834425523.0},
-  { 545013189.0,   769411186.0,  3172004663.0,  4124444609.0,  3802264321.0,   448359697.0},
-  {1100129839.0,   258535169.0,  3953302339.0,   270747164.0,   308236855.0,   524889094.0},
-  {1851320094.0,  3369178833.0,   213712271.0,  3304309355.0,  2134560308.0,  2774538520.0},
-  { 311491702.0,  1814805675.0,  3712168021.0,    21768287.0,   904842645.0,  4126509201.0},
-  {3823951997.0,  1316958430.0,  1455576646.0,  3096105169.0,  4044969918.0,  1284052253.0},
-  { 846980168.0,   591303280.0,  2686083819.0,  3992045645.0,  3114265890.0,  1042335392.0},
-  {4081432386.0,   989483005.0,  1971232107.0,   486767349.0,  2030679048.0,   883373589.0},
-  {2403191840.0,  2862473751.0,  1065332708.0,  1338048139.0,  4109789661.0,    57155867.0},
-  {1659183950.0,   787634289.0,   754296835.0,  2594934024.0,  1032043664.0,  1093409479.0},
-  {3504049169.0,  3064356791.0,  1152719159.0,  1761080497.0,  1667729582.0,  1436165815.0},
-  { 626662336.0,  3233415496.0,  4273368940.0,  1670716724.0,  2256715057.0,  3863206376.0},
-  {3792517389.0,  3177041971.0,  2760736768.0,  3145039908.0,  3923207379.0,   665413968.0},
-  { 702173878.0,     9328426.0,   880869195.0,  1487706853.0,  3545249773.0,  4230235865.0},
-  {  65515209.0,  3224216548.0,   944580818.0,   624833788.0,  3840687245.0,  3362824547.0},
-  {4164227892.0,  3167684237.0,   139232760.0,  1463199728.0,  4016008678.0,  1700906202.0},
-  { 748486853.0,   915047742.0,   259661584.0,  3194165678.0,  3861330628.0,  3220616686.0},
-  {4041546998.0,  3570521945.0,  1667321530.0,  4223951408.0,  2444758086.0,  2641828603.0},
-  {4276356901.0,    38913498.0,  4149588176.0,  3954865993.0,   522184291.0,  1273797019.0},
-  {1578771845.0,  2780867933.0,  3279439478.0,  3602931718.0,   913716068.0,  3134853337.0},
-  {1683607560.0,   945019770.0,  2361087003.0,     9275724.0,  3902384121.0,  2095502874.0},
-  {1883929364.0,  2242244668.0,  2535321479.0,  2892550374.0,  2392127565.0,  1903195543.0},
-  {3035540274.0,  1447638267.0,  3085293725.0,  3124523785.0,  1194853006.0,   626685088.0},
-  {1572514856.0,  2348981666.0,  2567565287.0,  3595568879.0,  1027475886.0,  3981345480.0},
-  {3474560614.0,   313379860.0,  2313036220.0,  3272093374.0,  1723905545.0,  3605594221.0},
-  {4278402458.0,  3106094709.0,  3660962189.0,  2276473004.0,  4152820705.0,  2821237048.0},
-  { 751159090.0,  1445331702.0,  2536994808.0,  3190831176.0,  1139630724.0,  1867231404.0},
-  {2748568981.0,   569612501.0,  3088352550.0,   809921908.0,  3895020814.0,   726374409.0},
-  {3490486399.0,  3524137776.0,  2683694643.0,  3866915654.0,  2325089664.0,  1077448516.0},
-  {2786608262.0,   403812955.0,  1115729138.0,   101650505.0,   764604386.0,  1139325243.0},
-  {4085798343.0,  1802041598.0,   647865270.0,  3171701613.0,   837367508.0,   516189547.0},
-  { 438483395.0,  1501007190.0,  2269635276.0,  4260018027.0,  3044250824.0,  2406411723.0},
-  {2390227831.0,  3002330984.0,  1031985942.0,    23660078.0,  3912581373.0,  3395845422.0},
-  {3600925050.0,  1421096467.0,  4270657414.0,  2800038724.0,   636426862.0,  2405397120.0},
-  {2223257306.0,  2424520736.0,  1588833155.0,  3129747855.0,  2817628947.0,  2502587310.0},
-  {3783799729.0,  3719036529.0,  3710741047.0,  3390091952.0,  4054771701.0,   235845340.0},
-  {2651477570.0,  2520603447.0,  3216105904.0,  1361901482.0,    33884401.0,  4180263994.0},
-  { 660596015.0,  2731607942.0,  3902049159.0,  1502822597.0,  2034011243.0,   325242280.0},
-  {3909921622.0,  2000681693.0,  3755635634.0,   251961710.0,  3470651776.0,  1921306581.0},
-  {1781151016.0,  2900860521.0,  4150641703.0,  1656038107.0,  1734712603.0,   746924759.0},
-  {4052044672.0,  2385307182.0,  3916445825.0,  2677310482.0,  3658883238.0,   933331015.0},
-  {  32024562.0,   616255080.0,  3005148466.0,   783579841.0,    17521483.0,  2775112113.0},
-  {3224936893.0,   208168772.0,  2078102609.0,  2485224226.0,  3789939930.0,  2414304282.0},
-  {4156278493.0,  2737951388.0,  2911830211.0,  2394240861.0,  1590306578.0,  2456781349.0},
-  {3697633457.0,  1839958827.0,  1039986577.0,   633352680.0,  2859419272.0,  2182815620.0},
-  {1376226267.0,    10834770.0,  1871577558.0,   151050864.0,  1364664990.0,  1532269991.0},
-  {3805494143.0,  2770543190.0,  2043449529.0,  1505592242.0,  1444924366.0,   240651465.0},
-  {1690405391.0,  3016103695.0,  3416626087.0,  3632284954.0,  3541945081.0,  3905383460.0},
-  {3450580627.0,  1361531205.0,   231218864.0,   856359863.0,  2785677417.0,  2084374719.0},
-  {1552089808.0,  2413885848.0,   502684948.0,  3846029119.0,  2707042453.0,   664407949.0},
-  { 450793237.0,  1158929427.0,  1949808884.0,  2136814318.0,  3303807308.0,  2614587997.0},
-  {1043281075.0,  3223002016.0,  3780899369.0,  2386208475.0,   201455342.0,   368989242.0},
-  { 679681379.0,  1867478980.0,  3409628508.0,  1364035240.0,  2098991495.0,  1989023392.0},
-  {1581511070.0,  3438178537.0,   261573010.0,  2588120236.0,  2049289684.0,  2007902063.0},
-  {3372179515.0,   239989250.0,  2815082631.0,  3697214999.0,  2096229009.0,  3057303801.0},
-  {2273012231.0,  2849535627.0,  2186293383.0,  1129196001.0,   629519887.0,   933965566.0},
-  {4239889167.0,  1293232488.0,   528736153.0,  3589630852.0,   766893297.0,  2172017583.0},
-  {1269658703.0,    99263987.0,  2838607341.0,  3693145804.0,  1491690192.0,  1710571360.0},
-  {2106881207.0,  3635911228.0,  3446853723.0,  1455174657.0,  2161012243.0,  3520475281.0},
-  { 564464004.0,  3221888436.0,  4150296173.0,  1172512853.0,  2155499846.0,  3425313116.0},
-  {3782453990.0,  3160109417.0,   447534083.0,   733888430.0,   216078664.0,   214275918.0},
-  {1525064002.0,   848853503.0,  1375124965.0,  3857733718.0,  1270217070.0,  4222175854.0},
-  {2226932959.0,  2809857209.0,  2719990969.0,  2776966874.0,  2644493270.0,   870672343.0},
-  { 721743562.0,  2402626906.0,  2358575584.0,  3920051545.0,  2699711047.0,  3974358555.0},
-  {1504729556.0,   280326379.0,  3415635123.0,  1265256164.0,  4094694982.0,  1701940683.0},
-  {2606979359.0,  1249502955.0,  1352082100.0,    75675686.0,  3440409236.0,  4265222622.0},
-  { 787258760.0,  2742139147.0,  2767209119.0,   445092106.0,  2361768459.0,  1986251979.0},
-  {2261499196.0,    93646066.0,  1484415332.0,  2894206512.0,  3405858830.0,  4232514153.0},
-  {2320032844.0,  1369898852.0,  1103510882.0,   240159181.0,  2446740387.0,  2486608436.0},
-  {2158963462.0,  1925317362.0,   331261060.0,  1483691761.0,  4235450833.0,    60114721.0},
-  {3322696330.0,  1565083741.0,   492845943.0,  2067574776.0,  1707630257.0,   227032853.0},
-  {3809956125.0,  3950314742.0,  1255107295.0,  1019288142.0,  1255491855.0,   902520967.0},
-  {3084394974.0,  2085800422.0,  2838881822.0,   340278125.0,  1631783806.0,   928614252.0},
-  {4102671860.0,  2385563817.0,   158937695.0,   903716727.0,   354605864.0,  2221080000.0},
-  {3178464598.0,  3170929467.0,  1917868805.0,   247729772.0,  2292748577.0,  2021205963.0},
-  {2942955689.0,  1434451668.0,   589385792.0,   852687088.0,  1154051615.0,   346114462.0},
-  {4265719525.0,  4082211598.0,   434675639.0,  2027224937.0,  2267962864.0,  2178210510.0},
-  { 172554777.0,  3212288996.0,   182462349.0,  1471949269.0,  1973405413.0,   772940711.0},
-  { 261897589.0,  3092948203.0,  2424987648.0,   290932119.0,  2888073913.0,  3164739275.0},
-  {3242313374.0,   408896851.0,  3845785296.0,   303134419.0,   790320191.0,  2363222397.0},
-  {3777315683.0,   553429321.0,  2243165396.0,  3479151831.0,   900371128.0,   213823631.0},
-  {1910639190.0,  2649726240.0,   818765778.0,  2404376109.0,  3656101590.0,  1359321165.0},
-  {2546092268.0,  1460005015.0,  1550887646.0,  3849962840.0,  3988937907.0,  3172110575.0},
-  {3749278781.0,  3013187070.0,   671892698.0,  2233705261.0,  1135748714.0,  2130972486.0},
-  {2370039482.0,   574011390.0,  2921853092.0,  1394472893.0,  1624771609.0,  1775529187.0},
-  {2332777048.0,  2093702831.0,  1563721527.0,  1247960119.0,  1097299063.0,   580343564.0},
-  {4235950689.0,  1328701184.0,  3806240286.0,  3346730786.0,  2932898531.0,  2597979039.0},
-  {4234163138.0,   657401798.0,  1196043296.0,   115468284.0,   559966634.0,  3275735118.0},
-  {2578926497.0,   690927982.0,  1847837413.0,   529222804.0,  1266753493.0,  3658296002.0},
-  {1852240142.0,  3855751308.0,  3984703700.0,   793957380.0,  1111811009.0,  4048721914.0},
-  {2645129908.0,   862712810.0,  2889734755.0,  2057568742.0,  2494971781.0,  1961335942.0},
-  {3985646264.0,     5192896.0,  2501666301.0,  1253760307.0,  2346879750.0,  3886955909.0},
-  {3458779824.0,  3319692426.0,  1968242341.0,     5938904.0,  3519454323.0,  1511850370.0},
-  {2154396947.0,  3514931618.0,  1731140164.0,   757296844.0,  1138377737.0,  3764626791.0},
-  {  30004139.0,  2702115864.0,  1794002472.0,  2423639224.0,  4129352675.0,   724726711.0},
-  { 388778292.0,  3614419981.0,  1722790984.0,   340623199.0,   123562953.0,  2605216380.0},
-  {2578431212.0,  3811202537.0,  2592557041.0,  4242381046.0,  3854655936.0,  3687045114.0},
-  {1151111959.0,  1761464488.0,  4171964976.0,  2631870783.0,   125006901.0,   453781437.0},
-  {2117090244.0,  2193615619.0,  3444987836.0,  2210571237.0,  1967036455.0,  3825853890.0},
-  { 396061674.0,   980867866.0,  3782646502.0,  2197558279.0,  2667405014.0,  4105135077.0},
-  {1683470601.0,   701973913.0,  2093839207.0,   673695051.0,  3047488588.0,  3873592680.0},
-  {2402992749.0,  3584163094.0,  1185530564.0,  3061690387.0,  4042525967.0,   707756466.0},
-  {3006230811.0,  3987870233.0,  1696456634.0,  1939955053.0,   166170567.0,  1762935806.0},
-  {2734876327.0,  3327243950.0,   685121034.0,   353588787.0,  1445587128.0,   926233911.0},
-  {2555022042.0,  1057067647.0,  1827303534.0,   135753234.0,  1546061427.0,  1533504778.0},
-  {3873503049.0,  1524202594.0,   803114285.0,  3100519466.0,  2516417355.0,  3373285176.0},
-  {2375679431.0,  1846684408.0,   679084866.0,  1111888067.0,  4171507393.0,    19210277.0},
-  {2044877635.0,  2486642704.0,  2965311038.0,  4148658661.0,  3572918945.0,   886331942.0},
-  {2425674208.0,  3003710333.0,  3204275932.0,  1531940781.0,  1013818408.0,  2826822113.0},
-  {3736111809.0,  1987868351.0,   950427723.0,  1603803350.0,  1384347257.0,   621893640.0},
-  {4090910414.0,   555638813.0,  2213415609.0,  2371355935.0,  2829888049.0,  1007691152.0},
-  {  96750201.0,   622751859.0,  3526863423.0,  1060683439.0,  3034662684.0,  2081596198.0},
-  {1275241754.0,  1048345345.0,  4188245606.0,  2567514265.0,  3435608183.0,  1036145275.0},
-  {1554997137.0,  2199690057.0,  1304350185.0,  1702674190.0,  2325222139.0,  1804738818.0},
-  {3400008378.0,    95706437.0,  2346672321.0,  1191916944.0,   444727163.0,   300071481.0},
-  { 620258706.0,  2136444312.0,  2604421090.0,  3903494986.0,  1343172383.0,  1262638026.0},
-  {3019976591.0,  3179081202.0,  3673348077.0,  2257591759.0,  3680805794.0,   221133916.0},
-  {2501388411.0,  4069258355.0,   885815125.0,  3995144728.0,  1178237768.0,  3393037033.0},
-  {2891451867.0,  1938182670.0,   850373909.0,  2109324863.0,  2643507145.0,   562954144.0},
-  {1500104259.0,  1854193060.0,  4011399872.0,  1018740612.0,  3740653743.0,  1227897056.0},
-  {4126715123.0,  1766711451.0,  1127461239.0,  2489664685.0,  1109779491.0,  2669896441.0},
-  { 900767494.0,   846598638.0,  2009380143.0,  3431497692.0,   389879006.0,  2390956504.0},
-  {1244750865.0,  1303393897.0,  1744005919.0,  3634257118.0,  4046782612.0,  1837192595.0},
-  {1379364441.0,  3120969003.0,  1897266488.0,  2810456293.0,   554203059.0,  3995426095.0},
-  { 568832747.0,   940691457.0,  1728829166.0,  1047197191.0,  3528677487.0,  3417138327.0},
-  {3198541904.0,  1044132580.0,  2827295774.0,   346471337.0,  3505376742.0,  2453104900.0},
-  { 945976006.0,  3924019707.0,  4131094508.0,  2763827180.0,  3322627604.0,   426885210.0},
-  { 988096797.0,  3045837896.0,  1692575009.0,  4227279427.0,   632881847.0,  3680280699.0},
-  {4004302160.0,  2033183950.0,  2211048211.0,    79137199.0,   231555105.0,   181202729.0},
-  {3688803690.0,  2069227957.0,  3862664696.0,  1049938814.0,  2545905026.0,  1591195989.0},
-  {2529092608.0,  2617636671.0,   651927520.0,   609941401.0,  3811369022.0,  1375286563.0},
-  {2028945637.0,  2562191914.0,  2234113722.0,  2254394253.0,  1503170392.0,  1100255559.0},
-  {1153325397.0,  4236450482.0,  1167308956.0,  3822086357.0,  4285012206.0,  3347645633.0},
-  {3580474221.0,  3004925192.0,   368580930.0,    51205725.0,    64251985.0,  3188091747.0},
-  {3599428684.0,  4270847736.0,  1746625266.0,  2883853335.0,  2393640592.0,  3196058140.0},
-  { 882246908.0,  1192055876.0,   973025285.0,  2782510696.0,  3960776897.0,  2976857727.0},
-  {3284292048.0,  2613828801.0,  4216585935.0,  2417722198.0,  2701497312.0,  2236471925.0},
-  { 132749968.0,  2382023530.0,  3327627214.0,   673628988.0,  1995617700.0,   988864577.0},
-  {1508226349.0,  2206976691.0,  3868041904.0,  1613452233.0,  1383230224.0,  3450746537.0},
-  {1132804144.0,  3890563598.0,   318519492.0,  1451924841.0,  1698751718.0,  1347417252.0},
-  {1791075993.0,  2513056767.0,  2232626953.0,  2969972589.0,  2109460286.0,   156741403.0},
-  {3658305727.0,  1187756131.0,  1077745686.0,  1423065416.0,  1779852123.0,  2295868991.0},
-  { 755806601.0,  1250766930.0,  3450839168.0,   151212166.0,   208794819.0,     1466720.0},
-  {3382758496.0,  1311312118.0,  2973326177.0,  2406121262.0,  1499057232.0,  2545927910.0},
-  {1646405878.0,  1034518627.0,  4148117052.0,   569134800.0,  2751066904.0,    43887414.0},
-  {1565515472.0,  3792225514.0,  4058887432.0,  4217557041.0,  2327742657.0,  3179991567.0},
-  {1260083625.0,  1167282817.0,  3990142564.0,  1435407342.0,   405863253.0,  3203534670.0},
-  {  44379526.0,  2312406181.0,  1836026590.0,  3733987294.0,  3920228115.0,  2002788554.0},
-  {2161200172.0,  3387042312.0,   628483448.0,  3747496886.0,  3464748618.0,  1509442993.0},
-  { 976088233.0,  4004118649.0,  3566108895.0,  2237752265.0,  2575230329.0,  3920495434.0},
-  {1317838946.0,   442001424.0,  1445463671.0,  2060858498.0,  3294876179.0,  3689410804.0},
-  { 705201577.0,  3473663947.0,  1836739616.0,  1538637092.0,  1239757490.0,  1500207413.0},
-  {4013102504.0,   235589498.0,  2687755037.0,  2741834085.0,  2967653086.0,   154396227.0},
-  {2019622079.0,  1534593793.0,  1469608471.0,  2665213940.0,   833910048.0,  1705149390.0},
-  {4237238917.0,  3027733044.0,  2152840614.0,  1192206146.0,  2910287504.0,  4091800744.0},
-  {2505978168.0,  1875063047.0,  2940693630.0,  3598785973.0,   425501754.0,  2412193972.0},
-  {1593508017.0,  3455151597.0,   457247704.0,  2670614884.0,  3736031702.0,  3679629926.0},
-  { 595741867.0,   981572277.0,  4241646695.0,  3495572242.0,   524853597.0,  2259819996.0},
-  {3808535919.0,    30441493.0,  1300135434.0,  2483571470.0,  2876110200.0,  3317014145.0},
-  {3418422471.0,  3745957411.0,   379071689.0,  3902214587.0,  1501100918.0,  3200828474.0},
-  { 122774414.0,  2473194565.0,  3988645291.0,   516963094.0,  2640728796.0,  1517393291.0},
-  {2402817535.0,   248739692.0,   887398003.0,  2311821679.0,  3815990105.0,  3732231306.0},
-  {1399781945.0,  2407425465.0,  1322134259.0,  3404992605.0,   691945778.0,  4034875021.0},
-  {1959549195.0,  2272983034.0,  3489058506.0,   488621013.0,  1701849300.0,  1391118750.0},
-  {4081222094.0,   160216218.0,  1646395542.0,  3321648490.0,  2763291671.0,  2119006161.0},
-  {3910197045.0,  3396867263.0,  1027752709.0,   368907038.0,   345221585.0,  3548379282.0},
-  { 444442041.0,  1406386332.0,   829049025.0,  2527263790.0,  2265235291.0,  1828181477.0},
-  {3517656188.0,  3834456527.0,    55163354.0,  3941027558.0,   673578748.0,  1788598186.0},
-  { 658227963.0,   168652057.0,   673823241.0,  1308596904.0,  1498225191.0,   991858299.0},
-  {2759550672.0,  1014132946.0,   922393607.0,  2635912204.0,  2596353958.0,  3656447759.0},
-  {2558731152.0,  4110060697.0,   928438052.0,  1464950271.0,  3925445314.0,  1252075899.0},
-  {1305664419.0,  1573243235.0,  2320678840.0,  3886210169.0,   122301739.0,  2068781537.0},
-  {2515395832.0,  2452338074.0,  3752720214.0,  2563447825.0,  2234552926.0,  1659802802.0},
-  {1986831103.0,  3926806338.0,   884424543.0,  4278396810.0,  3742708394.0,  2168468796.0},
-  {2513826208.0,  1266733357.0,  2827328192.0,    85293077.0,  2622687567.0,  2318725244.0},
-  {1593173155.0,  2293156079.0,  4242847036.0,  1202776362.0,   480088590.0,  2132241909.0},
-  { 498832666.0,  2288136022.0,  4154377670.0,  2013486448.0,  1114203614.0,  1555877357.0},
-  {3943680890.0,  2117871265.0,  3246485824.0,  3222728643.0,   454742541.0,  4188201953.0},
-  {2896997557.0,   193940809.0,   959553080.0,   718091880.0,  2777589678.0,   859610617.0},
-  {2359019466.0,  3003809323.0,   179724614.0,  1833492767.0,  1604116412.0,   238156066.0},
-  {2211501127.0,  2498628458.0,   314559621.0,  4212929565.0,   344285354.0,  3450696440.0},
-  {4006644686.0,  2219988793.0,  2798918366.0,   761660944.0,   698431024.0,  4147393097.0},
-  {1383932121.0,  1213118780.0,   235749498.0,   363531848.0,  2520989186.0,  4150506019.0},
-  {3245066498.0,  2791097887.0,  1988674620.0,  4208674908.0,  3425177885.0,   737893655.0},
-  { 707161534.0,  3730970032.0,  2197599711.0,   924790226.0,  2958738919.0,   531111823.0},
-  {1372911914.0,   743764127.0,  2544063706.0,    76837069.0,  2141462691.0,  3238566848.0},
-  {1630076981.0,  2530782625.0,  1727080513.0,  2105263528.0,  3951256738.0,   614943665.0},
-  {3759131864.0,  3585872958.0,   393699868.0,  3008591614.0,   870402609.0,  3129345356.0},
-  { 816814576.0,  3549092961.0,   165912748.0,  3325143621.0,  2173068822.0,   156004208.0},
-  {2903601807.0,  2110296858.0,  4294393845.0,  1225068880.0,  1763442853.0,  2428268955.0},
-  { 589230533.0,   359327353.0,   147038945.0,   137710073.0,   537989099.0,  2273358559.0},
-  {2999324269.0,  3507931563.0,  1970157214.0,  1225965729.0,  1693458016.0,  1532461659.0},
-  {2346607493.0,  2977836253.0,  3381992304.0,  2463800517.0,   263316491.0,   437719986.0},
-  {4232218517.0,  1035961418.0,  1792557091.0,  1204703860.0,  3921669022.0,   967562347.0},
-  {  92870924.0,  3295471471.0,    79729186.0,  3851243658.0,  1019293442.0,   380536694.0},
-  { 896366581.0,   583940236.0,  1953927855.0,   746406966.0,  1379719930.0,  1527126875.0},
-  {2472337415.0,  2531080512.0,  2028571282.0,  2608826303.0,  3660424927.0,  1505179344.0},
-  {1770658030.0,  1753097481.0,  2651786783.0,  3524855630.0,   898074208.0,  3515113117.0},
-  {3351596623.0,  4013033211.0,   746276211.0,  4285992493.0,   223483201.0,  1897014498.0},
-  {4177201751.0,  3635496728.0,  1973154262.0,   783699889.0,  3042360988.0,   667315812.0},
-  { 879876820.0,  4106438835.0,  2279270181.0,  3051564240.0,   643348007.0,  1069167956.0},
-  {1409327638.0,   396765644.0,  2960239248.0,  2880851044.0,  1012093546.0,  4119316417.0},
-  {  65592211.0,  3459759703.0,  2001235847.0,  3009132267.0,  3415976227.0,  3606514679.0},
-  { 372191376.0,  2637520633.0,  3984273382.0,  1807236338.0,  3443956131.0,  1980629633.0},
-  {2864487138.0,  1309163140.0,   847529137.0,   917001288.0,  3178493071.0,  2469706944.0},
-  {3773929725.0,  1820380155.0,   531508861.0,  4217122807.0,   917268997.0,  4152299825.0},
-  {1315758393.0,  3445501131.0,  3167643353.0,  3644478699.0,  3116276902.0,  1905697288.0},
-  {3666925393.0,   259160752.0,  3241164278.0,  1998197351.0,  1370922082.0,  2765486244.0},
-  {3105144786.0,   890449163.0,  2770618409.0,  3656845793.0,  2974753033.0,  1729780315.0},
-  {2844541822.0,  3267018748.0,  2173616453.0,  3628543462.0,  3245262205.0,  1203658275.0},
-  {3224112819.0,  2523985094.0,   884313423.0,  1672560650.0,  1620154596.0,  1359033602.0},
-  {3539418919.0,  4266126437.0,   188678819.0,   408989780.0,  3845283475.0,   877422267.0},
-  {1659757363.0,  4060942861.0,  4167908746.0,  3785487416.0,  4041399128.0,   348042164.0},
-  {3267331972.0,  1027904684.0,  3833272880.0,  1217431466.0,  1199963870.0,   126539891.0},
-  {2900547287.0,   917806409.0,  1002238434.0,  2059651337.0,  1392938787.0,  4058636676.0},
-  {1965728367.0,  2186804519.0,  2265248680.0,  2491009318.0,   206397646.0,  1634706496.0},
-  {2973151088.0,  4243334151.0,  2902245363.0,  2357312218.0,  1878643281.0,  3217785963.0},
-  {2241441216.0,  2517859861.0,  1766284782.0,  3505365449.0,  1230375002.0,  1857298196.0},
-  {3268435106.0,  2751098701.0,  1872562755.0,  3869973045.0,  1116111385.0,   865725463.0},
-  {2775872977.0,  1169891705.0,  1243540355.0,  2583027576.0,  1754691853.0,  4096529680.0},
-  { 971934788.0,   905034741.0,  2612212097.0,  2176353486.0,  4283797163.0,  4037087215.0},
-  {3371539536.0,   524559983.0,   158024202.0,    34712165.0,   870465418.0,  3382426287.0},
-  {1831146344.0,  3552402336.0,  3211233153.0,  1541478666.0,  3479117151.0,  1940447733.0},
-  {1594005108.0,  1666749664.0,  1568432517.0,  1746814296.0,  1677638339.0,  1207628586.0},
-  {1138995186.0,   187583164.0,   785542390.0,  1801817358.0,  3173831812.0,   500823633.0},
-  {3997164378.0,  2743459007.0,   901016827.0,  1685091914.0,  3243174301.0,  3241334470.0},
-  {3316076964.0,  3871444228.0,  2361063201.0,   111381706.0,  2945360806.0,  3891174114.0},
-  {1478649675.0,  1140960131.0,  3152029106.0,  1369799518.0,  2891012905.0,  2413822914.0},
-  {3930825062.0,  3293787661.0,  2635365793.0,   718286279.0,  3566430583.0,   174056305.0},
-  {1791498356.0,  1585079913.0,  1780394720.0,  2184482204.0,  1398851669.0,   868706054.0},
-  {3476215658.0,  2745104721.0,   426417438.0,   854431052.0,  2215367012.0,  1441963221.0},
-  {1447801373.0,  3653332065.0,  2441789402.0,  2477433637.0,  3453543791.0,  2079606392.0},
-  { 578597327.0,    64086601.0,  1212071459.0,   640259149.0,  3363461205.0,  2199977424.0},
-  {3853506308.0,  4287695679.0,  3989969967.0,   151189945.0,  2233078482.0,  2224095587.0},
-  {1522349394.0,  3932079692.0,  2364024683.0,   433514490.0,   926255117.0,  2740515008.0},
-  { 106584268.0,  1600934465.0,  3149563034.0,   422741932.0,  3803346337.0,  3250097944.0},
-  {  54450248.0,   557998876.0,   544665582.0,   726259215.0,  4192434773.0,   494436089.0},
-  {2139623387.0,  2009943591.0,  4040798211.0,   921516446.0,  2299706273.0,   210442088.0},
-  {3276093897.0,   769585225.0,   924827249.0,   477086550.0,  3146232007.0,  3347978585.0},
-  {3845814080.0,  3593361849.0,   915981303.0,  3808156424.0,  3016143209.0,  2214035117.0},
-  {1062972283.0,  1371280291.0,  1351543961.0,  1186324042.0,  1812722618.0,  3020397755.0},
-  { 667181437.0,  2204196385.0,  1817302220.0,    17676685.0,  4103561403.0,  1484571701.0},
-  {3490704554.0,  3494162464.0,  1764571438.0,  1298424415.0,   698430692.0,  3210672002.0},
-  {3027726163.0,  3421806790.0,  1690838348.0,  3389858400.0,   996916817.0,  3008193705.0},
-  { 214210361.0,  1127026179.0,   545042672.0,  4256120702.0,   612964901.0,  3470989692.0},
-  { 840241486.0,  2552266631.0,  1066979226.0,  3233625473.0,  2099845453.0,  2108446961.0},
-  { 749000084.0,   330237449.0,  4144558717.0,  3214940933.0,   948525813.0,  1589851409.0},
-  {3454009982.0,   186579733.0,  3820100895.0,  1851519493.0,  2700571259.0,  1204411507.0},
-  {2674020268.0,  1756427774.0,   650137794.0,    64817346.0,  4029896036.0,   257349152.0},
-  {1322255153.0,  2807524056.0,  2075265204.0,  4122799426.0,  1429683394.0,  3163383198.0},
-  {2354635939.0,  4215903991.0,  3278049507.0,  2959906766.0,   320736959.0,  3770359537.0},
-  {3252586732.0,    72496528.0,  2979196855.0,  4178781103.0,  2731680682.0,  4059669395.0},
-  {3446668819.0,  2699554651.0,  1681306297.0,  2450750783.0,  2838649855.0,  2224836685.0},
-  { 354909541.0,  2220550885.0,  3389899419.0,  3408625322.0,  1505896878.0,  2142206628.0},
-  {2767873552.0,  3971041321.0,   344582162.0,  1570711399.0,   805172451.0,   548926044.0},
-  {1499500266.0,   422460688.0,  2633305416.0,  1455505685.0,  3893960209.0,  2924136695.0},
-  {4230763410.0,  2730249127.0,  2636887857.0,   787542958.0,  1647771238.0,  2519853502.0},
-  {2710119047.0,  1324743783.0,  2517940819.0,  1260713034.0,  3810821182.0,  1235366098.0},
-  {1240939541.0,   980308212.0,   772775160.0,  1320457185.0,  1144882729.0,  1825637288.0},
-  {3282551815.0,  1825023904.0,  2584904586.0,  3372148425.0,  4162079874.0,  3798351668.0},
-  { 984497630.0,  3556035257.0,  3411742409.0,  4236738715.0,  2353075086.0,  3558752744.0},
-  { 480717188.0,  3479120927.0,  2639974334.0,  2387965887.0,  3654167583.0,  1666290180.0},
-  {3299032418.0,  2574933973.0,  4289335033.0,  3399992844.0,  2258722091.0,  3167175790.0},
-  {2342763868.0,  2636037505.0,  2995676300.0,   719100735.0,  2170255343.0,   702177586.0},
-  { 477009153.0,   556280605.0,   665637843.0,  1890553741.0,  3793476074.0,  2113051959.0},
-  {1904261192.0,  1257074209.0,  3155923910.0,  2817457013.0,   761529186.0,  2252346671.0},
-  {3703806273.0,  2619399630.0,   454656361.0,  1777254803.0,  3343258493.0,  3713854285.0},
-  {2831351924.0,   510073778.0,   479145367.0,   220809361.0,   186151913.0,  4170908009.0},
-  {2797738436.0,  2598106945.0,    51153627.0,  4233945118.0,  1447762183.0,  1119664902.0},
-  {2185538801.0,  4153565207.0,  1033834580.0,  2497403247.0,  2094527631.0,   787814239.0},
-  { 803057758.0,  1272201033.0,  1630215394.0,  3685165010.0,  2042749337.0,  1773835138.0},
-  {1223155063.0,  1640317543.0,  2334964506.0,  3320609388.0,  4281767537.0,  1526500708.0},
-  {  48208878.0,  1303675955.0,   472766157.0,  3543041959.0,    14244269.0,  2433334928.0},
-  { 770199640.0,  2200231255.0,  2721802229.0,  2879521413.0,  2729797552.0,   568998650.0},
-  {2533541313.0,  3664770007.0,  4194223919.0,  2884291718.0,  1444250162.0,   677471947.0},
-  {1961915397.0,  3694854414.0,   938863273.0,   186898875.0,  3124399529.0,  3317176130.0},
-  { 604398502.0,  4081719762.0,  3781001319.0,   831807187.0,  2675646950.0,  2571352360.0},
-  { 921793167.0,  2382042176.0,    53262528.0,  2462808566.0,  2163795237.0,  2317565082.0},
-  {1596698957.0,  1619303184.0,  2036946769.0,   229994907.0,  3333722013.0,  2402333786.0},
-  {3250460774.0,  3452633092.0,  1600687534.0,  3448124335.0,  1508439311.0,   699110235.0},
-  {1970657383.0,  1036651348.0,  2661425751.0,  3652068719.0,  4153508387.0,  1701025044.0},
-  {1076383114.0,  3864377969.0,   228774143.0,  3718038147.0,  1304349057.0,  3346811358.0},
-  { 598800122.0,  2483509189.0,  1400614991.0,  1112416227.0,  2363318609.0,  3746232699.0},
-  {2363407393.0,  4098847168.0,  2410162626.0,  4098931719.0,  1281538357.0,  3380189263.0},
-  { 902505173.0,   411405846.0,  1474414966.0,  2994224270.0,  1514822084.0,  2102312650.0},
-  {3041383341.0,  3626397956.0,  1633465629.0,  1118053794.0,  3454583704.0,   808912432.0},
-  {4095112774.0,  3456159257.0,  1591916033.0,  1667570752.0,  2184163244.0,  2760532952.0},
-  { 893560134.0,  1210604451.0,  1936176399.0,  3503171179.0,  3815495248.0,  2885539724.0},
-  {1100785613.0,  2262396737.0,  1742402411.0,  2290770923.0,   377943844.0,  1314129888.0},
-  {1688477976.0,  2236330209.0,  3909410526.0,  2213975849.0,  4097881674.0,  2323755815.0},
-  {3342085673.0,  2212773739.0,  2614696263.0,  3681225802.0,  2936453664.0,  3690150435.0},
-  { 541519463.0,  2119961635.0,   858328395.0,  2985338925.0,  2900465672.0,   603968496.0},
-  {1793230314.0,  3419618278.0,  3175545713.0,  2903654597.0,  1438612115.0,  3106600415.0},
-  { 451066846.0,   173879137.0,   890035675.0,  4269156223.0,  2956792330.0,  2960495725.0},
-  {3724917895.0,  2825140444.0,    51469298.0,  1549583321.0,  3580618410.0,  1593427411.0},
-  { 201778802.0,  3063828982.0,  3618676652.0,   938627846.0,  3102621535.0,  3005232888.0},
-  {3353462646.0,  1999409631.0,  1630451444.0,  1565090905.0,  2902067522.0,  1604776105.0},
-  {1311696417.0,  1647827470.0,  3525496549.0,  1872602659.0,  2273670336.0,   564994325.0},
-  {2947668268.0,  2266982994.0,  3996922804.0,  3547670195.0,  1049540428.0,  1473266487.0},
-  {3832314044.0,  3355864263.0,  3535205017.0,  2620416191.0,   480500704.0,  1235834183.0},
-  {4221263457.0,  3810824137.0,  1545398417.0,  3705320297.0,   850001018.0,  3548700799.0},
-  {3941840771.0,    92244321.0,  2289805435.0,   510662370.0,  3080092470.0,  1857489582.0},
-  {3446447340.0,   858688886.0,  2163160226.0,   108715579.0,  3542595336.0,  2356444137.0},
-  {3137696858.0,  1541932889.0,    11903959.0,   148046686.0,   347029598.0,  3542538598.0},
-  { 135922534.0,  2821356082.0,    27643292.0,  2624381586.0,   515926971.0,  1685526487.0},
-  { 872330304.0,   540782625.0,  2549435414.0,  4152072859.0,  1300614103.0,  3278970374.0},
-  { 457381205.0,  2086873104.0,  4128702179.0,   911775600.0,  3592774129.0,  1682100503.0},
-  { 109270553.0,  2276904481.0,  3143019738.0,  2850357724.0,  2835408851.0,  3210796067.0},
-  { 157310963.0,  1541965115.0,   513272215.0,  2508346789.0,   502687367.0,  3189981290.0},
-  {1722537429.0,  3070785815.0,     6514582.0,  3715374243.0,  2632775479.0,  2236870453.0},
-  {1537679681.0,  3947849815.0,  3990744208.0,  2529192359.0,  2018222891.0,  3109715088.0},
-  {2129317061.0,  3793259276.0,   509375393.0,   504054864.0,  1255257068.0,  1773766986.0},
-  {4212517322.0,  3157615516.0,  1052411543.0,   252572617.0,   219837324.0,  3965722529.0},
-  {3248448954.0,  2485937560.0,  2166463145.0,  2486095242.0,   332400566.0,    67109288.0},
-  { 680405686.0,  1818443170.0,   784159823.0,   526927840.0,  2982079385.0,  2665465105.0},
-  {1430814048.0,  2528471058.0,  3146721771.0,  2982621796.0,    29816990.0,  3791618894.0},
-  {2797469958.0,   963939021.0,   601304329.0,  2333024985.0,  2081117509.0,   813855420.0},
-  {2443856368.0,  2695737095.0,  2036845635.0,   698412948.0,  1249280571.0,  2279455490.0},
-  {2708647965.0,  3628722070.0,  1561570582.0,  3409650323.0,  2654237222.0,  2018843271.0},
-  {1991827548.0,  3062185005.0,  1305008269.0,  1117300905.0,   914691618.0,  2369231160.0},
-  {  84981260.0,  2707069034.0,   589128007.0,  1510781386.0,  1250733073.0,   313448049.0},
-  {1879001897.0,  2013770989.0,  1921966687.0,   497585646.0,   417777080.0,  1263357879.0},
-  { 630257812.0,  1364922638.0,  3967673473.0,  2124483291.0,  2223645865.0,  2958220767.0},
-  {2979330458.0,  2017800880.0,   348284908.0,  1633894117.0,   589878972.0,   424266418.0},
-  {1179800513.0,   413313667.0,  3307217703.0,   853421044.0,  1278691428.0,   808664969.0},
-  {2634053925.0,  1665125270.0,  2162942836.0,  2451560431.0,  4265968311.0,  2631293329.0},
-  {1771437025.0,  1212037468.0,  2038499639.0,   101070165.0,  2368797792.0,  2266310640.0},
-  {3036261099.0,   591196812.0,   338115255.0,  1641322654.0,  2688799559.0,  1821839105.0},
-  {2681889135.0,  2183771119.0,  1706583481.0,  3504268514.0,  3516570352.0,   911961852.0},
-  {2508166859.0,   493301460.0,  2225935207.0,  2859390251.0,  1354603532.0,   105868764.0},
-  {3679279896.0,   873974150.0,  3625347557.0,  1874348695.0,  3256082008.0,  1768737701.0},
-  {2964565917.0,   445365969.0,  2432470146.0,  3621861700.0,  1052080025.0,  2127075930.0},
-  {1243108823.0,  1279088579.0,  1018589338.0,  2388217657.0,  2392596775.0,  1617550228.0},
-  {1255355052.0,  1242613417.0,  1274899567.0,   494174658.0,  2527600988.0,  4039348188.0},
-  { 551927005.0,  4128131432.0,  2776437724.0,   659913227.0,  1612018412.0,  1747693421.0},
-  { 808662064.0,  4148999823.0,  3870135528.0,  1084665652.0,  4082445059.0,  2329945600.0},
-  {1040023796.0,   124958124.0,  3808227561.0,   848830087.0,   565570896.0,   883273740.0},
-  {2481230993.0,  3086936972.0,  1820303617.0,  1458997503.0,  1208445817.0,   463845707.0},
-  { 565316237.0,  3298314542.0,  2701677261.0,   447852973.0,   634278467.0,  2467537081.0},
-  {1048419987.0,  3398636304.0,  2514547048.0,   769935461.0,  3132625140.0,  1768715658.0},
-  {3227945143.0,   718798623.0,  1800636910.0,  3156788317.0,  4092177992.0,  3701105284.0},
-  { 923345136.0,  1007179371.0,  4266377422.0,   801592704.0,  2364799388.0,  2135279432.0},
-  {3717959386.0,  2237146531.0,  2510471969.0,   894378674.0,   695006888.0,  4192056299.0},
-  {3349227507.0,  1194770026.0,  2681382014.0,   571663819.0,  1496505568.0,   121814656.0},
-  {2276258468.0,  1876988543.0,  4151757195.0,   688476177.0,  2705304873.0,  4054050951.0},
-  {1903161960.0,  2199026999.0,  4066732635.0,  2142748513.0,  4024114806.0,  2438519381.0},
-  {2235636834.0,   425501587.0,  2455595792.0,   230044753.0,  1459218315.0,  2519839046.0},
-  { 138638784.0,  2090861919.0,  1358745624.0,    87251375.0,  3048750436.0,  4090066573.0},
-  {3682750578.0,  2519479751.0,   257583924.0,  3305933976.0,  3729887277.0,  2144664874.0},
-  {1510696902.0,  2862244478.0,   652590665.0,  3832516683.0,  3763047148.0,   945905491.0},
-  {4026472767.0,   242562993.0,  1072023431.0,   314947932.0,   868182067.0,   531817435.0},
-  { 496284543.0,  3331604109.0,  1094723926.0,  1700106776.0,  1611692780.0,  3854525462.0},
-  { 754206190.0,  1875011963.0,  1877015087.0,  1287483248.0,  3341314774.0,  4095431886.0},
-  {3419343816.0,   940801795.0,  3193275997.0,   913409537.0,  1413583534.0,  2673560685.0},
-  {2963906352.0,  3551541063.0,  2254200457.0,  3259608086.0,  4170063702.0,  2936910369.0},
-  {2767713426.0,   362288456.0,  3685008601.0,  2244999436.0,  1857368314.0,  3225050050.0},
-  {3980322150.0,   524820069.0,  2009008926.0,  2777900188.0,  1610151126.0,  3763046681.0},
-  {4012982600.0,  1681097301.0,   473513161.0,  3101944461.0,   107427659.0,  1383236059.0},
-  {2311663784.0,   635058214.0,   420512396.0,  3997997619.0,   803364095.0,  3678353094.0},
-  {1446459193.0,   872178321.0,  4210237618.0,  2851364792.0,  3836323208.0,  2256004046.0},
-  {3269232285.0,  3966041711.0,  1845917516.0,  2832835939.0,  2265312584.0,   878885138.0},
-  {3953559253.0,   549021096.0,  2008255535.0,  3545338865.0,  2823609129.0,   974038776.0},
-  {3973701999.0,  2845698751.0,  3849871949.0,  2111893421.0,  3069611578.0,  1349778373.0},
-  {4200162722.0,   996505462.0,  2298300001.0,  2156637950.0,  2229125505.0,  2275207578.0},
-  {2974669047.0,   865836415.0,  2457483496.0,  3917710061.0,  4133141948.0,  3072596236.0},
-  {3170005385.0,  1043455778.0,  1855965067.0,  3589714415.0,  2064505191.0,   982380402.0},
-  {2365129697.0,  2237754427.0,    77344828.0,    37438868.0,  3336325013.0,  3828506329.0},
-  {2236458162.0,  3118159783.0,  2509400537.0,  2780214842.0,  1721453477.0,   589639268.0},
-  {1523996917.0,  3335148532.0,  1979051744.0,  1607517274.0,  2507300904.0,   873873976.0},
-  {1010006755.0,  1414383471.0,  3070345493.0,  3786731029.0,  1561495252.0,  3971328686.0},
-  {2911914257.0,   262665357.0,   920758422.0,  1949953543.0,  3291138004.0,  1154539520.0},
-  { 827413912.0,   123304572.0,   434179341.0,  1510566347.0,  2779225254.0,  3266328055.0},
-  {1598355703.0,   559226119.0,   421495869.0,   487040893.0,   945670381.0,  1256306761.0},
-  {3903159947.0,   814669108.0,  1315847693.0,  2700683445.0,  1749715396.0,  3436209069.0},
-  {2579254111.0,   667973434.0,  3901751068.0,  3494069537.0,  2674834752.0,   550794796.0},
-  {3911605691.0,  2728761799.0,  4086274675.0,   592765712.0,  3108347409.0,  1944626628.0},
-  {3224140109.0,  4064378650.0,  1794630001.0,  1314268182.0,   485028198.0,  2450199386.0},
-  {1914134002.0,   907293509.0,  1976643173.0,   219415320.0,   210701969.0,  3181201063.0},
-  {2502410325.0,  3835218769.0,   754041860.0,  3265308555.0,   349225236.0,   818601698.0},
-  {1687626719.0,  1829160899.0,  1912425486.0,  1384136032.0,  3166360600.0,   240691258.0},
-  {1735663210.0,  2575347126.0,  1339299839.0,  2671273235.0,  1918519299.0,  3913442712.0},
-  {1108463995.0,  2607478834.0,  3984990735.0,  3186305867.0,  1531753796.0,  2907461767.0},
-  {3926698262.0,   559946340.0,  3658326982.0,  3804421052.0,   925597546.0,   604235510.0},
-  {2714377112.0,  1986295097.0,  2504713739.0,  2983424602.0,  4260545099.0,   369870907.0},
-  { 871582738.0,   139444578.0,   368356477.0,  1517671052.0,  1378040113.0,  2483978883.0},
-  { 323404284.0,   548853156.0,  3971029681.0,  2870005916.0,   796624451.0,  4154124219.0},
-  {2190638001.0,  2765636887.0,  2224553235.0,  3503539624.0,   705291621.0,  3250014196.0},
-  {3828952623.0,   260497531.0,   949500776.0,  3996866160.0,   509890513.0,  1710461253.0},
-  {2346815616.0,  1225560873.0,  3627729542.0,  2985658652.0,  2139331701.0,  2993017364.0},
-  {4083539805.0,  2032051792.0,   704806873.0,  4246691283.0,  1052948936.0,  1706574470.0},
-  {2284051477.0,  3193640894.0,   416822332.0,   103500658.0,  1608750419.0,  1565953361.0},
-  {4018236432.0,  1439606629.0,  1105188214.0,   526228666.0,  1574825788.0,   802175607.0},
-  { 894127385.0,  2391158995.0,   972958562.0,    42150721.0,  2703512831.0,   694037025.0},
-  {1516395401.0,   712684515.0,  2145197764.0,  1667221871.0,  3936450844.0,  3678226379.0},
-  {2395567344.0,  1432787662.0,  1658594209.0,  2839235525.0,    45014678.0,  4087776200.0},
-  { 656709174.0,  3452688793.0,  3462946608.0,  3015015680.0,  1003755863.0,  4078316032.0},
-  { 530854877.0,  4021924444.0,  2232113674.0,  3457288455.0,  2857763856.0,  3390621689.0},
-  {1020463146.0,  2846901527.0,  1207589851.0,  3667157619.0,  1521858143.0,   927859121.0},
-  {  53724939.0,  1924452902.0,  2485848307.0,  1461747052.0,  3034202033.0,  2870927429.0},
-  {1366597569.0,  2925690498.0,   342246497.0,   821073791.0,  1157799203.0,  3934633452.0},
-  { 370995021.0,  3412119893.0,  2628849307.0,  1835966947.0,  3318103375.0,  1671913187.0},
-  { 811805309.0,   788538264.0,   221529506.0,  3012394917.0,  1171627156.0,   581953169.0},
-  { 526284717.0,  3825237783.0,  2897423365.0,  3261710071.0,  3726807971.0,  1895452389.0},
-  {2502727351.0,  2336448189.0,  4286634271.0,  4102081299.0,  2123530254.0,   447264852.0},
-  {1236006124.0,  2358195177.0,  1366807442.0,  2452052175.0,  3756721675.0,   263660929.0},
-  {2042451299.0,  3889092742.0,  1480446119.0,  1698143642.0,   783740024.0,  2539733075.0},
-  {2875277271.0,  4223603873.0,  3596398623.0,   719373411.0,  1266670430.0,  1383635865.0},
-  { 762429035.0,  3303676584.0,  3921048192.0,   609980990.0,  2888230901.0,  3886666772.0},
-  { 487289762.0,  1139443827.0,   925959847.0,  1749707597.0,  1922808180.0,   830495203.0},
-  { 981084534.0,  2292610431.0,  1101101618.0,  1504006044.0,  1117166424.0,  1744903370.0},
-  {2839803096.0,   778657232.0,  1903147420.0,  3590699247.0,  2395011170.0,  2691799071.0},
-  {1209869230.0,  3339612791.0,  2511709978.0,  1114621340.0,  3886393257.0,  3247068721.0},
-  {1546166269.0,  3434880334.0,   424319680.0,  4259260514.0,  1836719335.0,   386078606.0},
-  { 401450440.0,  3486387545.0,   621583673.0,  2833156876.0,  1857536171.0,   806709126.0},
-  { 989820605.0,   755283868.0,   731421888.0,   251410231.0,  2386395930.0,  1626818439.0},
-  {3516057665.0,  3605816030.0,  1542107145.0,  2882655921.0,  3198710645.0,    55981602.0},
-  { 803906278.0,  3704397224.0,   568859344.0,  1142741194.0,  2361774046.0,  3210511265.0},
-  {4272083914.0,  4143618527.0,  3552458710.0,   236321925.0,  1482906168.0,  3858003592.0},
-  {3244963561.0,   756274169.0,  2566142275.0,  2425050230.0,  3602027961.0,  3013800886.0},
-  {1459856051.0,  1619804618.0,  3647133469.0,   714946562.0,  2220915441.0,   454377977.0},
-  {2203679642.0,   251707035.0,    16738810.0,  4240524854.0,   462926627.0,  2877785063.0},
-  {2379791242.0,  2971293405.0,  1844884571.0,  1871493860.0,  2576429965.0,  1377094711.0},
-  {2309112359.0,  4024857204.0,  3682692651.0,  1570060589.0,  3072613980.0,  1429605224.0},
-  {2920765680.0,  3503567890.0,  1916167010.0,  2889616315.0,  3340662182.0,   554636192.0},
-  { 745358030.0,  3410643291.0,  3709633675.0,  2467843899.0,  1312139744.0,  1808220190.0},
-  {4282384988.0,  1483026288.0,  4177596955.0,   924375062.0,  1938463291.0,    49389268.0},
-  {1610182164.0,   291591546.0,  4080255439.0,   516136742.0,  2679883386.0,  4021059225.0},
-  {4130324342.0,  2163167679.0,   567164566.0,   648676077.0,  1928796745.0,  2336437176.0},
-  {4214050237.0,   658335941.0,   723631414.0,  1958884700.0,   833582459.0,   255683696.0},
-  {2836285445.0,  3606714399.0,   169343590.0,  2219687131.0,  2747282773.0,   110764293.0},
-  { 152194854.0,  2097165532.0,  1079540219.0,  2513446984.0,   467049999.0,  2360914443.0},
-  {1003499778.0,  3579529215.0,   811293555.0,  1369577192.0,    32897746.0,  1234460621.0},
-  {2069603839.0,  2059396960.0,  2137289760.0,  1651500106.0,  2113709146.0,  1356792818.0},
-  {4215093031.0,   119782214.0,   601070935.0,  3549588056.0,  3880411408.0,  2686871901.0},
-  { 266427004.0,  1901162996.0,  3531811170.0,  1319059514.0,  2423491813.0,  3334053313.0},
-  {1547206936.0,   308663620.0,   787649172.0,  1261286194.0,  3248976330.0,  2656856492.0},
-  {3034966982.0,   768621193.0,  2859076311.0,  1694647448.0,  3245023385.0,   166042843.0},
-  {2532247996.0,  3876820307.0,  1445600446.0,  2485771042.0,   357119716.0,  3141377841.0},
-  {1534515087.0,  1102144204.0,    64683322.0,  4062402772.0,  3440305629.0,  2727272800.0},
-  {4239538822.0,  2287582866.0,   183439360.0,  1775375479.0,    28039128.0,  3423097248.0},
-  { 856925199.0,  4167742521.0,   162029051.0,   171635113.0,  2249809155.0,  3333020785.0},
-  {2894037692.0,  1296799585.0,  2280694620.0,  2154972923.0,  1711238209.0,  3074116072.0},
-  {1206584525.0,  2839452896.0,  1987810282.0,  2960008243.0,   612613357.0,     2977351.0},
-  {3635536916.0,  1322724883.0,  3215594424.0,  2434665106.0,  1056796133.0,  2156680140.0},
-  { 211672696.0,   295761235.0,  3330659810.0,  2700751657.0,  2426967958.0,   831295643.0},
-  {2311804963.0,  3281946395.0,   220527926.0,  1488023632.0,  1865895085.0,  2038081055.0},
-  {1767252152.0,  1275669712.0,   273102818.0,  4293030261.0,   504150468.0,  1079959992.0},
-  {4288512688.0,  1710567874.0,  1320023539.0,   725058381.0,  3648231399.0,  2619732999.0},
-  {1410966485.0,   456324458.0,  1170608590.0,  3907046448.0,  2227578190.0,  2553801101.0},
-  {1025291479.0,  3595640235.0,  2048446125.0,  3442685178.0,   314280003.0,  2504767912.0},
-  {4099748949.0,  4009865897.0,  2705121788.0,  4003828010.0,   178749489.0,  2584041908.0},
-  {1169122150.0,  4281035575.0,  2965000733.0,  2286182535.0,  1735535509.0,  1136491545.0},
-  {2267143220.0,  3124182284.0,  2944028422.0,  3709446386.0,  2711728200.0,  1731533546.0},
-  {4018769960.0,  1748247089.0,  2517602888.0,   428129765.0,  3120527932.0,  2900516528.0},
-  {3590267375.0,  2934780328.0,  2951153536.0,  2629366664.0,   822224942.0,  2447929572.0},
-  { 767207754.0,  2381347233.0,   302607950.0,  3670763204.0,  1417059702.0,   463281176.0},
-  {1304426177.0,   964781004.0,  2954259826.0,    64027472.0,  2389487055.0,  2593217336.0},
-  {3662252809.0,   183404264.0,  3796218507.0,  3906023859.0,  2591724645.0,  2310284331.0},
-  {2770584994.0,  3318498875.0,  3347546564.0,  1395607506.0,  2794166631.0,  1903719692.0},
-  {3554684078.0,  1257996044.0,  3890995457.0,   528451993.0,  2578377485.0,  3829391446.0},
-  { 591299318.0,  1479296023.0,  4100923639.0,  3888220725.0,  1003391994.0,   276173447.0},
-  {1260262548.0,   945493832.0,  3602642222.0,  3949747742.0,  3767957779.0,  2204951765.0},
-  {1708213851.0,  1053199622.0,  3976995637.0,  4286548488.0,  4012207411.0,  3785606420.0},
-  {1225391243.0,  3965894718.0,  3442461204.0,  2357649447.0,  3196244463.0,  2975843505.0},
-  {2704797876.0,  1935322665.0,  2900065627.0,  2034684524.0,  3493403237.0,  2385804557.0},
-  {1658872129.0,  1076292294.0,  2390586389.0,  1710131466.0,   520290931.0,   697961803.0},
-  {1668231652.0,  3574740536.0,  1060257414.0,     8900563.0,  2712335636.0,  1244023479.0},
-  {1967595084.0,  2949586037.0,  1985221619.0,  2517648140.0,  1108133593.0,  2542172841.0},
-  {1120366572.0,  1667491065.0,   732835392.0,   569460820.0,  1761695045.0,  2546710579.0},
-  {3691228839.0,  1551309723.0,  2259490622.0,  3207440847.0,  3108066696.0,  1071795340.0},
-  {1588646622.0,  1360448978.0,  3480169614.0,  2244387809.0,  4247185211.0,  3506145448.0},
-  {2719532850.0,  1335623996.0,  2567781930.0,  3230591160.0,  3793436380.0,   138177529.0},
-  {1444166795.0,  1945797591.0,   781263168.0,  2551617498.0,  2406758260.0,  3625259725.0},
-  {1846697836.0,  2941622183.0,  2112364364.0,  2802275834.0,  1190410801.0,   421440405.0},
-  {3925566908.0,  1210607367.0,  4132710947.0,  1910623083.0,     8618991.0,   801277575.0},
-  { 259656417.0,  3046745360.0,  3483244962.0,   507174518.0,  2031472460.0,   310720687.0},
-  {3152791308.0,  2391707170.0,   189887527.0,  1789651632.0,  2754204687.0,  1015767102.0},
-  {1039906174.0,   524578580.0,  3974666508.0,   842928363.0,  1301714130.0,  1176278396.0},
-  { 402875884.0,  1536483812.0,  2145464800.0,  3107007409.0,  2120861075.0,  2530147487.0},
-  {4002100945.0,  1514905342.0,  2893152886.0,  1281917030.0,  2610219603.0,  1585154621.0},
-  {1848369472.0,  3687292455.0,  2013246103.0,   590368550.0,  1342661748.0,  3114663057.0},
-  {3934624491.0,  4265938621.0,  2592064098.0,  3461278988.0,  1315378985.0,  3308394321.0},
-  {3424333819.0,  2917231407.0,  2298782009.0,  4241834415.0,  2382298031.0,  4201908656.0},
-  {3114976772.0,  1117540370.0,   304458431.0,  1597749408.0,   101950630.0,   902493880.0},
-  {1979470899.0,  1599676048.0,  3253902798.0,  2043885120.0,  3175392517.0,  2805055832.0},
-  { 675542206.0,    38247071.0,    72098047.0,  3495969241.0,   109506254.0,  1646974332.0},
-  {1643562217.0,  3223693810.0,  3366360037.0,    44136417.0,  3110057378.0,  2399106034.0},
-  { 916311820.0,  2471764144.0,   294745144.0,  3354931219.0,  1277290134.0,  3941313882.0},
-  {3213340447.0,   608832443.0,    22801092.0,   134781390.0,  4069001552.0,   590748444.0},
-  { 953925482.0,  3136900844.0,  1737183385.0,   486265796.0,  3942900397.0,  1357716956.0},
-  {2619148418.0,  3718466544.0,  1309454608.0,  3922614679.0,  3990912815.0,  2221980060.0},
-  {3638663280.0,  1833713210.0,  2440361469.0,  3495513232.0,  2036690120.0,   622462554.0},
-  {2292364839.0,  2825295359.0,  3259047656.0,  4083785327.0,  1865936174.0,  2314036816.0},
-  { 427184292.0,  2594960604.0,  3292105426.0,  3910613285.0,  2204640028.0,  2708771092.0},
-  {2275438104.0,  1795814888.0,  1144414061.0,  3063176786.0,  2414403230.0,  4211909698.0},
-  {2254067148.0,   596913918.0,  2957390692.0,  1054838859.0,  1725351940.0,  1269693940.0},
-  {2022583021.0,  3508542692.0,  2281672972.0,  2203776851.0,  1027259768.0,  3188079145.0},
-  {2188682240.0,  4140025842.0,   236216698.0,   829593407.0,  4160551058.0,  2823055940.0},
-  {2874921565.0,  1768550634.0,   821649713.0,  3647849179.0,   771344482.0,   973798498.0},
-  {  70975103.0,  4144347238.0,  3679309686.0,   204800912.0,  3347185098.0,  1727862042.0},
-  {3850912272.0,  4202607374.0,   916769964.0,  3973187929.0,  1059475080.0,  3873115252.0},
-  {2832101443.0,  2306716583.0,   520150809.0,  3476740595.0,     1203314.0,   957866951.0},
-  {1496349739.0,  2823907017.0,  1945397757.0,   337039604.0,  1009236984.0,  2353739266.0},
-  {2401899558.0,  3116459936.0,  1206953034.0,   928176859.0,  3504008315.0,   652367509.0},
-  {3848202306.0,  1666965541.0,  2166508644.0,  4096936079.0,  3544684332.0,  4274609353.0},
-  {2333633578.0,  2943471119.0,  1093738671.0,  2244371744.0,  4195584936.0,   833095870.0},
-  {1054727903.0,   923221295.0,  3491033290.0,  2673554526.0,  3963208960.0,  3425122098.0},
-  { 665879437.0,   580062212.0,  3423463544.0,  3391684435.0,  3065051013.0,   349554940.0},
-  {2354663223.0,  3656904037.0,   534720581.0,    17934120.0,   374961292.0,  1646587296.0},
-  {1963152624.0,  2333814158.0,  1636011957.0,  2149886752.0,  3489945240.0,  2778622526.0},
-  {3937723964.0,  3327970405.0,  1223150083.0,  3130843845.0,  2631514211.0,  3940374142.0},
-  {1490674375.0,  3539162722.0,  1729253319.0,  3644892989.0,   477354963.0,  4252071190.0},
-  {2969210871.0,  2185501117.0,  4024180606.0,  3725841155.0,   310484362.0,  2592359553.0},
-  {1920411328.0,  2775179813.0,  4075484846.0,  1147018129.0,  2036802288.0,   605741405.0},
-  {1295630100.0,  3513384592.0,   505329670.0,  1172809561.0,  1500738560.0,  3862814154.0},
-  {2607504876.0,  1468035453.0,  1105454438.0,  4085999541.0,  3806263398.0,  3172382260.0},
-  {2257477599.0,  3448076418.0,  1554742586.0,  3583796372.0,   660517910.0,  1083852567.0},
-  {1697766477.0,  3928951061.0,  2138126620.0,  1347825719.0,  1998413531.0,  3658843093.0},
-  {  84621752.0,  3587266049.0,  2799833556.0,  1834040349.0,  1003749815.0,   146419639.0},
-  {1779641235.0,  4212558583.0,  3395292229.0,  2254212997.0,  1273581391.0,  2865331344.0},
-  {3377911216.0,  4118352472.0,  1789843786.0,  2394396206.0,  3783751286.0,  3413756130.0},
-  {2256026955.0,   316600132.0,  3048322555.0,  3546911034.0,  3509972829.0,  2333493342.0},
-  { 556406191.0,  2630012897.0,  1772437954.0,   191758752.0,  3954416592.0,  1251368560.0},
-  {2588823135.0,   320219756.0,  3139315210.0,  2728439196.0,  3467798831.0,  2238284721.0},
-  { 591829398.0,  1992183615.0,  3537570306.0,   962790917.0,  1167512288.0,  3654554920.0},
-  {1861099470.0,  3770033088.0,  2003561033.0,  3378474152.0,    34251367.0,  3198458839.0},
-  {2150128423.0,   439878714.0,  2552010945.0,   984221459.0,  1636324028.0,  2456500979.0},
-  {1855052793.0,  3142490196.0,  3874567333.0,  2171475402.0,  2672234903.0,  2964660371.0},
-  {3629918550.0,  3729886757.0,  1399508060.0,  2733517834.0,  2002750412.0,   458066275.0},
-  {3663873688.0,  1455690567.0,  4246276684.0,  3284672964.0,  3117135579.0,  1919322523.0},
-  { 256592493.0,   758078210.0,  2259872903.0,  3722778821.0,  3294499885.0,  1887319814.0},
-  {2474276071.0,  3445586090.0,  3461913706.0,  4135725851.0,   874015396.0,  4198167777.0},
-  { 827452154.0,  1859233234.0,  2916748521.0,   215810740.0,  2871630186.0,   114038080.0},
-  { 512531467.0,  1671332119.0,  3853877508.0,  1365010575.0,  2049418166.0,   631643367.0},
-  {4100204636.0,  3521944427.0,  1983292459.0,  2072108138.0,  2020908871.0,  1101440509.0},
-  {2751118852.0,  1733298715.0,  2679554145.0,  3875753040.0,  3717184524.0,   772514244.0},
-  { 649282664.0,   835431143.0,  2180351799.0,  1497251571.0,  2739040569.0,     3545212.0},
-  {1147208441.0,   526953401.0,   168252744.0,  1329474377.0,  3265463386.0,  2632241729.0},
-  { 980377477.0,  3054476709.0,   206230264.0,  1160904850.0,  1912466558.0,  4037267242.0},
-  {2936076088.0,  2350191590.0,  1462639279.0,   234538705.0,  2914896533.0,  3158986718.0},
-  { 113845794.0,   141786100.0,  2217631949.0,  2632092954.0,   116419840.0,  3825506992.0},
-  {2800424523.0,  1126081212.0,  3252676932.0,  2462106296.0,  1830518845.0,  3633311117.0},
-  {1909212335.0,  3307619541.0,  2960004711.0,  2854437858.0,  4197150517.0,  1943853034.0},
-  {4136930722.0,  2577346923.0,  2640412464.0,  3569499754.0,  4084310100.0,  2385865072.0},
-  {1010893733.0,  2557320992.0,   677205386.0,   751674701.0,  2439203456.0,  3996918572.0},
-  {2934852455.0,   691176781.0,  2198173335.0,  2092742450.0,  2950541563.0,  4080896852.0},
-  {2961740496.0,  1516839526.0,  1471485901.0,  2139082473.0,  2819537859.0,  2778595682.0},
-  {1264926573.0,  2384268780.0,  3807851486.0,  1451185849.0,  2506247297.0,   873124035.0},
-  {4210312564.0,   119778481.0,  1817206986.0,  3382650472.0,  1891081761.0,  2319376373.0},
-  {3572512976.0,  3768326513.0,  2887670434.0,  2447727570.0,  2904367003.0,  2017760488.0},
-  { 584357260.0,   888710704.0,  2255935371.0,  4109592800.0,  3404485878.0,  1233064929.0},
-  {2955045696.0,  1941912750.0,  1131493918.0,  1742524763.0,   347983255.0,  3683021517.0},
-  {4130049292.0,  4011082522.0,  2302660252.0,  2043362170.0,  1228429479.0,  4209187799.0},
-  {3890748418.0,  2767972099.0,  3630458185.0,  2217258072.0,  2653864225.0,   804987387.0},
-  { 685379634.0,  3171119378.0,   113607886.0,  2804699555.0,  2114513222.0,  3954537541.0},
-  { 340227606.0,   824744097.0,  2279082662.0,   435155374.0,   691141181.0,  2366430003.0},
-  {1744369619.0,  3484562279.0,  1461998072.0,   842194495.0,   794715376.0,  4266035558.0},
-  { 343530913.0,  4184096984.0,  1443056556.0,  3335691016.0,  2516290659.0,  1638047898.0},
-  {1708306354.0,  3910336485.0,  3482563875.0,  2002799839.0,  2864363020.0,   310831196.0},
-  {2601914310.0,  1105359536.0,  1542811401.0,   127056713.0,  2510291666.0,  1860347196.0},
-  { 491245446.0,  3178391400.0,  1858151334.0,  1111751608.0,   501235893.0,  2060989127.0},
-  {3562497427.0,  1167563793.0,  1798945234.0,   565237621.0,  2077538090.0,  2283771669.0},
-  {1533475001.0,   663987258.0,  2999826185.0,   354825203.0,  1378648559.0,  2129527373.0},
-  {3848618142.0,  3157001827.0,  2921817307.0,  1202594924.0,    65616359.0,  4007473508.0},
-  {4130081839.0,  1235982335.0,  2316782199.0,  2040778868.0,  3493704504.0,  1920899283.0},
-  { 843184643.0,  1402277514.0,  2763834474.0,  2594281329.0,  1588905625.0,  2962392675.0},
-  {3282838098.0,   290649669.0,   298779651.0,  1417504586.0,  4221503096.0,  2607446681.0},
-  {1845132915.0,   454048673.0,  3930901824.0,   212312673.0,   358172769.0,  1766828557.0},
-  {3968039172.0,  2363474409.0,   888568229.0,  2609858236.0,  3244618144.0,  3122834710.0},
-  {3316570886.0,  2105741912.0,   271616484.0,  4263222957.0,  2804411385.0,  3697183069.0},
-  {1159842066.0,  2162521108.0,  2372334341.0,  2749316521.0,   355313195.0,   257908273.0},
-  {2671387229.0,   567220236.0,  3686674862.0,  2972131839.0,  3207082420.0,  4114725541.0},
-  {  25882786.0,  3603059360.0,  2149029658.0,   392876100.0,  3028253918.0,  1562118166.0},
-  {1216741989.0,  3660424625.0,  4161138295.0,   391475372.0,   396987442.0,  4063916889.0},
-  { 699199575.0,  1257701274.0,    24598179.0,  3094718528.0,  1501314960.0,   455707738.0},
-  {2095724174.0,  4236538593.0,  3139199834.0,  3499518443.0,   514889564.0,  1558533549.0},
-  {2833914310.0,  3870882234.0,  1836241791.0,  1881041274.0,   211606431.0,  2129658849.0},
-  {3631802443.0,  1509153957.0,  2507152870.0,  2279451584.0,  1334348012.0,  1322291007.0},
-  {3802046300.0,  2924015934.0,  2889567788.0,   696138995.0,  3867983597.0,   763827683.0},
-  {1551698826.0,  1159315035.0,   243697125.0,  1376939295.0,  3884500798.0,  1337448668.0},
-  {2628455834.0,  1899404600.0,  3225603434.0,  3924126597.0,  3076007865.0,  2530594119.0},
-  { 992275245.0,  3985334153.0,  1341310499.0,  2698277247.0,   953053951.0,  1996916686.0},
-  {3508674116.0,  4210582678.0,  2202118588.0,  1806095290.0,  4183147654.0,  2170246992.0},
-  {1786257496.0,  2452389033.0,  1272535991.0,  2991709833.0,   142634487.0,  1617468035.0},
-  {3727626522.0,  3907163034.0,  1280079323.0,   771388186.0,  4153855138.0,  3805676173.0},
-  {3876860448.0,  4274766844.0,   266998985.0,   756411747.0,  1400053582.0,  1482697488.0},
-  {1384270772.0,   290670860.0,  1413346572.0,   709895994.0,  2042547789.0,   330863988.0},
-  {1828977986.0,   403032196.0,  1690909587.0,  3643500284.0,  2041410707.0,  2924295410.0},
-  {3436644392.0,  3048886445.0,  3544497164.0,  1174264440.0,   153654054.0,   960430111.0},
-  { 470074646.0,  2363897906.0,  2021358318.0,  2547132039.0,  3707708456.0,  3857806745.0},
-  { 204142623.0,  1927899281.0,  3214785131.0,  4038015497.0,  1996127332.0,  1842021017.0},
-  {1428989680.0,  3625171098.0,  1586192789.0,  3756472101.0,  2376332774.0,  1810848554.0},
-  { 373485119.0,   903069448.0,   601827054.0,  3550012868.0,   851261787.0,   229699714.0},
-  {1088909322.0,  2113227341.0,   292211009.0,   313121766.0,  2795523546.0,  1109426628.0},
-  {3220134087.0,   637688913.0,  3755101766.0,  2576010367.0,   278234912.0,   506758051.0},
-  {2369810475.0,  1591020375.0,  1377782413.0,  3903721728.0,  2897651553.0,  3367086247.0},
-  { 711808440.0,   962923500.0,   129871912.0,  1335103355.0,  2443493774.0,  2683315770.0},
-  {3192592207.0,  3824306959.0,  4150372719.0,  3379571717.0,  3536927056.0,  1841551781.0},
-  { 778556568.0,  2027995225.0,    16965320.0,  3855269757.0,  3668521703.0,  2984691504.0},
-  {1283266536.0,   728046800.0,   460316539.0,  2304153786.0,  3500710330.0,   750582785.0},
-  {3925699065.0,  2196132352.0,   709111308.0,   518930721.0,  3071707566.0,  2819783641.0},
-  {4197853470.0,  1391717922.0,  1684759821.0,  3239300777.0,  4243755928.0,  3816322461.0},
-  {1416715221.0,   348462279.0,  2484989992.0,  2871580552.0,  1130248565.0,  1215198767.0},
-  {1858176121.0,  3851999923.0,  1795838143.0,   495036592.0,   258425842.0,   948592948.0},
-  {3330600994.0,  1136783120.0,   948433577.0,   400669400.0,  1154030699.0,  2984911575.0},
-  { 987901738.0,  3186810988.0,   171369818.0,  3469476390.0,  2170156834.0,  1383594489.0},
-  { 865069835.0,  3021796472.0,  2237262984.0,  2840676084.0,   337490729.0,   624804677.0},
-  { 884707755.0,   427110448.0,  1752113645.0,   681418481.0,  3842035846.0,  1997742709.0},
-  {2631149059.0,  2508232432.0,  2278408420.0,  2943866887.0,  2531927723.0,   787710743.0},
-  {3913944668.0,  3106609075.0,  3236915519.0,  3293716623.0,  2967283937.0,  3409966755.0},
-  {2598920916.0,  3387769200.0,  2295417025.0,   911988009.0,  4082853074.0,    50488036.0},
-  {3512438319.0,  1630505906.0,  3173288543.0,  2246838493.0,  1450413092.0,   897366185.0},
-  {3421301963.0,   110868209.0,  2691421800.0,  1190949287.0,  3809103195.0,   841764362.0},
-  {3460603030.0,  1307420200.0,  1405839683.0,   763054298.0,   665057232.0,  1397879790.0},
-  {1996063277.0,  1109498632.0,  1630510569.0,  4133215917.0,  3663103188.0,  2688694289.0},
-  { 627244352.0,  4293441686.0,  2016280515.0,  1321839578.0,   917615404.0,  4228778825.0},
-  {1961520341.0,  1830998393.0,  4107873205.0,  1735694824.0,  2858893114.0,  2501372977.0},
-  {2999928346.0,  2733844411.0,   433871833.0,  1351040925.0,  4195098458.0,  2077561674.0},
-  {1497556835.0,  4134184482.0,  2686695468.0,   660172991.0,  1298092293.0,  1356169663.0},
-  { 941947345.0,  3749152318.0,  1227087624.0,   268652026.0,  2311111427.0,    60951630.0},
-  {  74935230.0,    53486198.0,  2244481192.0,  1624150700.0,   644305278.0,  1295744683.0},
-  {4192889473.0,   442665068.0,   129877384.0,  2490789119.0,  3749288009.0,  1098691814.0},
-  {3091142326.0,  1755397119.0,  1467889865.0,  1090333993.0,  3175803517.0,  3340801536.0},
-  {2103059289.0,  4225025615.0,  2600492247.0,  4101972176.0,  2049247752.0,  2751173898.0},
-  { 605705337.0,  2206931617.0,   885042311.0,  3056136695.0,  3953049544.0,  3132514084.0},
-  {3784426447.0,  1680648854.0,  3244286915.0,  2933362276.0,  3015755435.0,   474545310.0},
-  {2988548219.0,  3156290784.0,  3781918425.0,  4076739992.0,  2517094490.0,  2740563463.0},
-  {2107188144.0,   174857287.0,   904868466.0,  2632627211.0,   356824769.0,  2229685608.0},
-  {2714017433.0,  1707395125.0,  2732886838.0,  1029119744.0,  1173394196.0,  2739119038.0},
-  {1166874755.0,  3669686855.0,  3553288259.0,  3076076553.0,  2959692434.0,  2901555677.0},
-  {1467509811.0,  1130363181.0,   705349528.0,   800715959.0,  3772270572.0,  2812661987.0},
-  {3542573725.0,  4181573853.0,  4152837201.0,  2885391266.0,  1487047224.0,  2569608386.0},
-  {3493243299.0,  1831212635.0,  1295830946.0,   855783150.0,  1388801842.0,   956655862.0},
-  {1899453487.0,  4022595488.0,   759663849.0,  2451030992.0,   417766410.0,  4135431163.0},
-  {1464565699.0,   926700778.0,  2100887550.0,   762207927.0,  3143895233.0,  3264732726.0},
-  {3702642844.0,  2738063637.0,    78363574.0,  2867574550.0,  3915540680.0,   499277907.0},
-  {2077575048.0,  3137056244.0,  2603364530.0,  1682726817.0,  1174229518.0,  2802523764.0},
-  {3616323742.0,  4103799825.0,  4115697727.0,  3758176345.0,  4155475206.0,  3303748828.0},
-  {2126728337.0,   161393533.0,  3408678774.0,    22741509.0,   362320220.0,  2047685288.0},
-  {2933064125.0,   971878433.0,  2267608154.0,   895228559.0,  2127221208.0,   196392954.0},
-  {2777212738.0,  1063018061.0,  3200898933.0,  3953512589.0,   690740394.0,  3329650865.0},
-  {2540139182.0,   268037981.0,  1666179128.0,  1867594897.0,  3859060867.0,  4041837964.0},
-  {  49353514.0,  4107496137.0,  2562329966.0,  1689665719.0,  1878708724.0,  2368274091.0},
-  {4262843880.0,  3561783973.0,   104418401.0,  3556845620.0,  2910395516.0,  4111043290.0},
-  {3045733391.0,   364886756.0,  2805757757.0,  3697317245.0,  1737992799.0,  3261830977.0},
-  { 639142315.0,   994778024.0,  1843517272.0,   619237652.0,   106655100.0,  4194671067.0},
-  { 502036345.0,    68011703.0,  2196803174.0,  3296500002.0,   742789547.0,  3116139577.0},
-  {3157264370.0,   678308300.0,  2388905036.0,  2170721803.0,    33782323.0,  3254330647.0},
-  {3612940585.0,  3080546643.0,  1920153796.0,  2461085284.0,   157570972.0,  1944086661.0},
-  {3425988768.0,  1317752483.0,  3424024549.0,   780678235.0,  3104275919.0,  3288743294.0},
-  {4099353264.0,  4170834826.0,  3295041796.0,  3801699014.0,   128421484.0,  2464331992.0},
-  {3971641893.0,  3576100278.0,  4136056856.0,  1085781799.0,  3667902604.0,   985410762.0},
-  {2129624993.0,   153874737.0,  2013448328.0,   972247729.0,  1549101829.0,  3689234577.0},
-  {1318540115.0,  1633123175.0,  4146049675.0,  3150023059.0,  2801067609.0,  1687463900.0},
-  { 637262163.0,  1584921968.0,  1835678795.0,  3379976587.0,  2956155266.0,  1270397149.0},
-  {2059515999.0,  2854488758.0,  3575269613.0,  4145121104.0,  1482658567.0,   758560608.0},
-  {3491975381.0,  1687025221.0,  2166226814.0,   295480834.0,  2765916494.0,  3060605408.0},
-  {3496220288.0,  2679404675.0,  3146577373.0,  3432027822.0,  3276274961.0,  4268728788.0},
-  {2084721717.0,  3457681570.0,  2829661498.0,    16620596.0,  4169311579.0,  2532924469.0},
-  {1839823974.0,  1189433349.0,  1826046568.0,  4140146573.0,  3029987956.0,  1726724723.0},
-  {2252493948.0,  3501781126.0,   553619023.0,   950051541.0,   250294595.0,  2194281021.0},
-  {4248392463.0,  3448097110.0,  2506397509.0,  3690198224.0,  3068381513.0,   162950967.0},
-  { 402083389.0,  2663583434.0,  2581820581.0,  1660040124.0,  3505460447.0,  1199419242.0},
-  {  32176534.0,  3413905847.0,  3390089581.0,   391059601.0,  2501977510.0,  1030998484.0},
-  {4099228137.0,  1462502402.0,  1118604273.0,   921765795.0,  2041234799.0,  1603351031.0},
-  { 318877519.0,  2475211683.0,  2676079909.0,  3854618616.0,  1013880393.0,    40933915.0},
-  { 927238348.0,  2098093642.0,  1200042608.0,   765417825.0,  4202494464.0,  3899262959.0},
-  { 635733540.0,  2634672625.0,  2738266356.0,  2613119706.0,  3096414851.0,  3671361871.0},
-  {2581397682.0,  2084099411.0,  2066969711.0,  2969988937.0,   988155476.0,  1095914418.0},
-  { 734100962.0,   218318199.0,   210464497.0,  3419112902.0,  4183508209.0,  2629018026.0},
-  {2909583204.0,  2722636813.0,   965546168.0,  2855419449.0,   532998148.0,  2242551387.0},
-  {3071133220.0,  2393253490.0,  3436532526.0,   572571459.0,  2639231895.0,  3140723331.0},
-  { 288447265.0,  2727082842.0,  2768159305.0,  4223847479.0,  1255404630.0,  1283511200.0},
-  {2101728670.0,  3944749270.0,   268225831.0,  1269547051.0,  3283271473.0,  3572358432.0},
-  {3305089447.0,  1511502328.0,  3266319920.0,  4028167839.0,  4068511280.0,  1986714885.0},
-  {3179444215.0,   277241661.0,  1035600195.0,  3215314539.0,  3980953289.0,   222118336.0},
-  {1089654417.0,  3295617334.0,  2941268851.0,  2472203121.0,  1538166449.0,  3120112186.0},
-  {1251364367.0,  4022604748.0,  3855223214.0,  3038230349.0,  2344657977.0,  4154885314.0},
-  {2109810433.0,  3984129627.0,  1215515048.0,  2416611244.0,  1420131440.0,  3107192253.0},
-  {1714469040.0,  3936852245.0,  2268422009.0,  3349772107.0,  1654658485.0,  3627900181.0},
-  {3986275697.0,  2926391101.0,  2755576892.0,  4242051946.0,  2487609689.0,  3304250005.0},
-  { 719245446.0,  1579953562.0,   904642367.0,  3312781782.0,   801549956.0,  3667156877.0},
-  {3818280288.0,   786261844.0,  2211988421.0,   996599469.0,   856344204.0,   741502639.0},
-  {2989005185.0,  2104256348.0,  2401151839.0,  3760759842.0,  3767337095.0,  2848488032.0},
-  {3083203269.0,  1588021580.0,  4251515708.0,  1405681833.0,  1873278737.0,  1784618821.0},
-  {1587830529.0,  3023910226.0,  3956116635.0,  2458492350.0,  1477428900.0,   835732989.0},
-  {3463515626.0,  2388643735.0,  2118645035.0,  3330158093.0,   826842045.0,  2579907955.0},
-  {3593872737.0,  3379012349.0,  1259689203.0,  2693643335.0,  2369782066.0,  4195992120.0},
-  {4179613104.0,   937913090.0,  1060681645.0,  1610607020.0,  3233111841.0,  3061470721.0},
-  {3090248567.0,  2583086232.0,  1216538717.0,  2676525354.0,   247693143.0,  1795182786.0},
-  {3776721671.0,  2417848546.0,  2589319820.0,  3838147737.0,  1899912164.0,  3770133373.0},
-  {1174228712.0,  3818333373.0,  4152847299.0,  3942064006.0,  1650764039.0,   701381549.0},
-  { 253985561.0,  1969188930.0,  3905675357.0,  3386216180.0,  1546915456.0,   251863964.0},
-  {1086531396.0,  2326504329.0,  3702142684.0,  2334701654.0,  3871904212.0,  2124016157.0},
-  { 694215939.0,  3503434976.0,  1685820267.0,  1487743640.0,   997364744.0,  3871228662.0},
-  {1551140770.0,   662575041.0,  4087201741.0,  3886660856.0,  3953771710.0,  2830980137.0},
-  {3389830820.0,  1484624437.0,  4159277529.0,  1772742587.0,  1052348453.0,  2483102935.0},
-  {1718570618.0,  4230302086.0,   779681916.0,   592889283.0,  1887947513.0,   535787990.0},
-  {3356964454.0,  2712701411.0,   381759597.0,   682108087.0,   758027259.0,  1142267312.0},
-  {2770571820.0,  3186577855.0,  2441740444.0,  2990335912.0,  1740114734.0,  1983367494.0},
-  {1885612763.0,  3242520977.0,  2287239981.0,  1173787245.0,   937807146.0,  2070224579.0},
-  {1351129001.0,  1954246767.0,    65697306.0,  3239475987.0,  2514885617.0,  2075846855.0},
-  {3994571270.0,   103508033.0,  2292140261.0,   609235464.0,  1971359700.0,  3972023057.0},
-  {2741864690.0,   280548520.0,  4122841575.0,  2217703878.0,   242305660.0,  1084553775.0},
-  {3455472902.0,  1254190647.0,  1187279240.0,   958317608.0,    72444843.0,  2032996850.0},
-  { 423027232.0,  1523352602.0,  3615236785.0,  3409656083.0,  2989556731.0,  1422813532.0},
-  {2025635048.0,  3088774509.0,   768920925.0,  2648893658.0,  1901947613.0,  2032318427.0},
-  { 294391483.0,  4038329067.0,   136119492.0,  2278527297.0,   741174783.0,  2738871543.0},
-  {  83512684.0,  2520550216.0,  3244294173.0,  2823311462.0,  3340336227.0,   946338721.0},
-  {2150073167.0,    21976014.0,   557456528.0,  2080250366.0,  3739491585.0,  4008342002.0},
-  { 940021011.0,  1730860933.0,  1651887678.0,  3192375312.0,   917849760.0,  3624987065.0},
-  {1721813615.0,  1709824331.0,  4286030212.0,  1243867293.0,  3363808182.0,   884216319.0},
-  {2633480808.0,  3158389363.0,  3687456372.0,   161731575.0,  1107318826.0,  3749063189.0},
-  {4255664085.0,  1834690089.0,   886357521.0,  1981018831.0,  2004506216.0,  3314058144.0},
-  {2735392911.0,   259673457.0,  3596440818.0,  1882351717.0,    70671281.0,  3759780506.0},
-  { 809403212.0,  3359510080.0,   968023450.0,   999739902.0,  2597614923.0,  3397894075.0},
-  {3723433083.0,   299705855.0,   138043865.0,   735342651.0,  2454368498.0,  2239235718.0},
-  {  87901516.0,  3282550877.0,  3464791022.0,  3696504272.0,  4118020119.0,  2234689013.0},
-  {3305943961.0,  2006945306.0,  3384391587.0,  1639836346.0,  2113094716.0,  2242879663.0},
-  {4225509748.0,  1513149275.0,   303233222.0,  2839278249.0,  3452602836.0,  3568323565.0},
-  {4079061502.0,  3008401384.0,  1006040111.0,  4173724040.0,  2341531999.0,    37610404.0},
-  {3558662921.0,  2532360499.0,  2361893769.0,  3236506487.0,  3130053532.0,  2412642491.0},
-  {2692542909.0,    11276981.0,  3246557547.0,  1130361718.0,  1586684171.0,  1991366571.0},
-  {  40961608.0,  3546304670.0,  2092829632.0,  2514068778.0,   914297465.0,  1472731336.0},
-  {1058849911.0,  2175759479.0,  4160184205.0,   180444828.0,  3799714775.0,   113956941.0},
-  {1273573918.0,   987696211.0,  1602851577.0,  1350726555.0,  1906036381.0,  3150296629.0},
-  { 908795215.0,  1940963449.0,  2106935780.0,   489834637.0,  2429014440.0,  1330456419.0},
-  { 104319636.0,  1582749995.0,     6779341.0,   354097130.0,   496240720.0,  3856077502.0},
-  {3930119453.0,    47023682.0,  1408275609.0,  3134827963.0,  1735226679.0,  3404039559.0},
-  {4072969885.0,  1061747709.0,  1473859425.0,  2858202063.0,  1507799610.0,  1138818447.0},
-  {2094664960.0,  4147275218.0,  4009162432.0,    56019570.0,  1972646776.0,  3622609531.0},
-  {1146905124.0,  4141367041.0,  2215439349.0,   833403820.0,  3653217625.0,  1457641593.0},
-  {2928662361.0,  2878718129.0,  1904317619.0,  1003507079.0,  3292762720.0,   877045842.0},
-  {2790037966.0,  3065217719.0,  1967415795.0,  1593498011.0,  1979423159.0,  1894914977.0},
-  {2572630192.0,  3899915792.0,  3549311841.0,  3244859227.0,  3602634800.0,  2403870892.0},
-  {1625657972.0,  1798381601.0,  1137962870.0,   541954583.0,  1132973115.0,  3224448166.0},
-  {2287504214.0,  4087527805.0,  1279916618.0,  3444744312.0,   671482552.0,  3089312727.0},
-  { 903533436.0,  4078916347.0,   636396348.0,  2132376079.0,  3360541344.0,  3994866684.0},
-  {3103536023.0,  2752597030.0,  1182385843.0,  2644933610.0,  2479602615.0,   814026942.0},
-  {1714252808.0,  1432537138.0,  2143279509.0,  1251406345.0,  1376578444.0,   719055494.0},
-  { 834712050.0,  3039708875.0,  1345303761.0,  2369351360.0,  4283343930.0,  1379140984.0},
-  { 342977031.0,   359286351.0,  1723644426.0,  1523021164.0,  3478120827.0,   310037302.0},
-  { 195617010.0,  4053173941.0,  1697125557.0,  2169364528.0,    76435590.0,  2697268821.0},
-  {3435228660.0,  3124073575.0,  1129922419.0,  2212716358.0,  3363025659.0,  1652541679.0},
-  {2172394276.0,  1173059543.0,  3265038505.0,   694953098.0,  3170687198.0,  3810645331.0},
-  { 263415152.0,   857236000.0,  3421608100.0,  1727778511.0,  2583445142.0,  3145817536.0},
-  { 377319837.0,  3409536670.0,  1926492543.0,  2355475629.0,   413121367.0,  2213707904.0},
-  {3986634763.0,  2059901238.0,  2520395684.0,    76846953.0,  3331023820.0,   971071471.0},
-  {3546309726.0,  4096076408.0,  1649587718.0,  2717036808.0,  1841785841.0,  4181304587.0},
-  {1533144836.0,  3308604736.0,  1411277261.0,  1771526914.0,   104076710.0,  3838134771.0},
-  {2928892651.0,   735776620.0,  1488298478.0,  2666856977.0,  2313407503.0,  2436389639.0},
-  {1951859430.0,    54741992.0,  2449426666.0,   240452445.0,  3878109673.0,   212257614.0},
-  {2360107098.0,  2332661066.0,  2278551705.0,  2047173863.0,   683441820.0,  1341329786.0},
-  {1147697896.0,  1160605490.0,  3986586092.0,  3931995782.0,  2476729314.0,  3316636054.0},
-  {2837554268.0,  2903949421.0,  2351040041.0,  2197419139.0,  3886316668.0,   263978582.0},
-  { 646291845.0,   896890784.0,  3896851143.0,  3771375716.0,  1748245444.0,  1816708569.0},
-  {2255149527.0,   421796766.0,  3582542071.0,  2552020526.0,  1306059730.0,  2501733001.0},
-  {4100091536.0,  3023898362.0,  3600294955.0,  1568131723.0,  1457011739.0,  3706683200.0},
-  { 598936988.0,  3147124895.0,   239712227.0,  4225281914.0,  3608475701.0,  2949405669.0},
-  {3201067024.0,  1884877846.0,   244453976.0,  3115336800.0,  2340488752.0,  2867785943.0},
-  {3898578503.0,  2618944328.0,  3102593169.0,  1331041864.0,  3572275350.0,  4219113298.0},
-  {2873328633.0,  2315599255.0,  1299757588.0,  1609700927.0,  2540536653.0,  2745389863.0},
-  { 283193773.0,  2550357134.0,  3581583200.0,  2373915065.0,  3284763094.0,   564886905.0},
-  {3443520709.0,  3641755572.0,  2666307133.0,  1849788684.0,  2102464170.0,  2322126877.0},
-  { 679471432.0,  1874094132.0,  3662573554.0,  3181191846.0,   577888807.0,  1657530719.0},
-  {3453773790.0,  1354950150.0,  1678230549.0,   859406861.0,  1644956036.0,  1395680283.0},
-  {4121174214.0,  1854846080.0,     5437917.0,  3520004182.0,   984907614.0,  3485648819.0},
-  {3748845822.0,  3266055060.0,   893610642.0,  3916200375.0,  3319445508.0,  3664075573.0},
-  {3339719896.0,  1343760502.0,  1974456411.0,  1363156046.0,  3112898544.0,  3438709472.0},
-  { 142190096.0,  2237078346.0,  3551059349.0,   693744786.0,  4188010881.0,  3649512140.0},
-  {1975286182.0,   473581801.0,   868700075.0,  1268283562.0,   204790700.0,  3454669618.0},
-  {2687726795.0,  2566500552.0,   296190947.0,  4027908157.0,   725217743.0,  4243870789.0},
-  {2152070063.0,  3378752072.0,  2515450445.0,  3381211353.0,  2752420957.0,  2719731687.0},
-  {1923105746.0,  1631215005.0,   137231008.0,  3509239638.0,     6106148.0,  3461576786.0},
-  {2033157020.0,  3455933148.0,  1081786889.0,  3886284081.0,  2507809717.0,  3602684245.0},
-  { 330273685.0,  2515598845.0,   544105652.0,  3623566172.0,  2627947196.0,  3784251557.0},
-  {2318571245.0,  1263925150.0,  2545992192.0,   911559442.0,  1494986165.0,  3871663619.0},
-  {2770568095.0,  1631611630.0,  1712102624.0,  3915254484.0,  3099324404.0,  1815955394.0},
-  {3615789999.0,  1385757200.0,   536384049.0,  3227936388.0,  1887119048.0,   151850029.0},
-  {3960098922.0,  1858972954.0,  3818025022.0,   337785633.0,  4188973891.0,  2120785637.0},
-  {2332221588.0,   944149424.0,  2765093809.0,   393925097.0,  1933066675.0,   983350806.0},
-  { 245665742.0,  3821346866.0,  1002843054.0,  1999965195.0,   657780767.0,  4167606562.0},
-  { 563816569.0,  3124071732.0,  3798173241.0,   246049590.0,  1567202817.0,  3707458972.0},
-  {2027288295.0,  1640979480.0,   782464172.0,  3667958194.0,   911633795.0,  3679343346.0},
-  {1449424798.0,  2682618000.0,  4046196220.0,  3133050348.0,  2852607839.0,  1933117433.0},
-  {1401786506.0,  2896442732.0,  3430145027.0,  3103839746.0,  1475552558.0,  3677154149.0},
-  {1737916016.0,   940621492.0,  2515191469.0,  2216715453.0,  1176960328.0,  4279936310.0},
-  {2735503356.0,  2012624171.0,  2552241624.0,  4090193854.0,  4162715108.0,  4272785173.0},
-  {3657395067.0,  3207826805.0,  2692364684.0,  1249301015.0,  3836083669.0,  1230681178.0},
-  {1892055842.0,   893382874.0,   932700030.0,  1635399190.0,  3387407403.0,  4186823902.0},
-  {2099642108.0,  1850990678.0,   664986517.0,  3893729544.0,   948327448.0,  1305844811.0},
-  {3378554024.0,  1439037234.0,  3749161100.0,  3142282469.0,    74323748.0,  4198841564.0},
-  {2881113972.0,   217524134.0,   155934167.0,  1211387945.0,   208291719.0,  2635267314.0},
-  {3008459638.0,  2361680772.0,   281745830.0,  2985285284.0,  3093548299.0,   553866143.0},
-  {3987327260.0,  4168586631.0,  1805711675.0,  3381279505.0,  2654025320.0,  1574326194.0},
-  { 115562846.0,  3112272217.0,    32457575.0,  2767667796.0,  2540721067.0,  2897066935.0},
-  {2147302151.0,  3268182102.0,  1356238033.0,  3750780104.0,  1842595272.0,  3908063445.0},
-  {3770782155.0,  2235106368.0,   238877190.0,  1874163139.0,   532737207.0,  4072668978.0},
-  {3414125956.0,  1019334199.0,  1738936464.0,  1567482585.0,  1332854455.0,  1209001507.0},
-  { 526897055.0,  1547360210.0,   961183049.0,  4119668671.0,  4054728779.0,   943615069.0},
-  { 412471089.0,  3648321340.0,  2185214890.0,  2928747663.0,  2485705068.0,  4186506773.0},
-  {1120156565.0,  1996332723.0,  4228592660.0,  3852298920.0,  2774996965.0,  4278872919.0},
-  {3623050896.0,  4173443904.0,  3063137549.0,   657232028.0,  1829591565.0,   342218294.0},
-  {1613932207.0,   409134985.0,  3814696614.0,  2965348418.0,  4178457502.0,  3187803928.0},
-  {1591372012.0,  3351373529.0,  4103504014.0,  1061282409.0,   843657391.0,  2847878593.0},
-  {3928765556.0,  2677326006.0,  2061040931.0,  2424129572.0,   713840509.0,  1848163072.0},
-  {1037698007.0,   215340459.0,  3945232688.0,  1861163823.0,   396006392.0,  2650518932.0},
-  {  79627340.0,  3415441458.0,  3413271591.0,   473197890.0,  3006227528.0,  1471297605.0},
-  { 486381688.0,  2231336264.0,  2436210862.0,  1185868022.0,  2767113128.0,   170579824.0},
-  {2399541703.0,  3480164631.0,  2172579889.0,  3594678368.0,  3548902382.0,   654918455.0},
-  {3349554180.0,  2470531358.0,   211435367.0,  1394657474.0,  2732152917.0,  3564946690.0},
-  { 400499760.0,  2049489360.0,   922478533.0,   966914065.0,    38530731.0,  2712722812.0},
-  {1377680504.0,  1533744334.0,  2688034595.0,  1504995473.0,  3242731904.0,  2091987155.0},
-  {1454172881.0,   946086944.0,  2214233267.0,  3895309856.0,  2583466362.0,  1999365068.0},
-  {1660526673.0,  2816894605.0,  4155849072.0,  2926058278.0,  4240462280.0,  2778682072.0},
-  {3482040093.0,  2304536434.0,  2170072293.0,  2636668612.0,  2667622096.0,  2041372441.0},
-  {3600970341.0,  3656557349.0,  2175571620.0,  2467719828.0,  2631223892.0,   293512986.0},
-  { 971025542.0,  2814940036.0,  1809658544.0,  1887225534.0,  4221257423.0,   546583335.0},
-  {1047202580.0,   559200412.0,  1451798951.0,  3854292504.0,   575421941.0,  1133767536.0},
-  {1121215924.0,  2781902945.0,   616074854.0,  2222300381.0,  2485020186.0,  2667819787.0},
-  {2595708996.0,  3703534119.0,   545230305.0,  3788402200.0,  2157012686.0,  1214232068.0},
-  {4046348610.0,  3578824457.0,  2420659250.0,   519448739.0,  2407544093.0,  3148236729.0},
-  {2302542600.0,  2727082529.0,  3825068801.0,   707292885.0,  2761407575.0,  1041458070.0},
-  {1170567257.0,   764112976.0,  3297953437.0,  2781187994.0,   865073288.0,   479654246.0},
-  {2515619172.0,   176437757.0,  3840579790.0,  2541236083.0,  2749711201.0,  1463192366.0},
-  {2507331757.0,   801151602.0,  3509884376.0,  2413258578.0,  1176085825.0,  2676147471.0},
-  {2987731823.0,  2181061418.0,  3003454753.0,    68778769.0,  2506873391.0,   327607123.0},
-  {2581268437.0,  3688883105.0,  1088066606.0,   550906651.0,  1099887628.0,   139379281.0},
-  {3661901736.0,   785303695.0,  3049531761.0,  3783769109.0,   446414739.0,  2454862501.0},
-  {3147459833.0,  2445361542.0,    52512573.0,  1840784731.0,  1675642139.0,  3473863470.0},
-  {3117573365.0,   838810906.0,  1112331625.0,   685627650.0,  3244397261.0,    87768610.0},
-  {3567603123.0,  2147565041.0,  2384683859.0,  2024017930.0,  3388512581.0,  1962728779.0},
-  { 157733533.0,   104208760.0,  1404334574.0,  2204319410.0,  3363097167.0,   748440505.0},
-  { 992416444.0,   226273861.0,  2316994842.0,   927783125.0,  3906885104.0,  2968686523.0},
-  {2868165930.0,  1332766198.0,   596142952.0,  2128907021.0,  3020255176.0,  2716568548.0},
-  {1447425617.0,  1672526623.0,    52237257.0,  1295813109.0,  2038137927.0,  2169384886.0},
-  { 409459361.0,  1170718595.0,  3724958711.0,  1701489839.0,  2173752066.0,   337027919.0},
-  {1685536986.0,  1918317674.0,  1462686676.0,   372560909.0,  2685651916.0,  1306789426.0},
-  {1187563292.0,  3509146760.0,   281493155.0,  1954403443.0,  1411248758.0,   774179291.0},
-  { 384339999.0,   164286968.0,  3327153719.0,  2581598674.0,   769215272.0,  2355855957.0},
-  {2143049662.0,  2081593655.0,   964329196.0,  3258726322.0,   566774405.0,  3616818334.0},
-  {4021870451.0,  3987672071.0,  1323209315.0,  3189264276.0,  1272376473.0,  2544363770.0},
-  { 942252136.0,  1433707567.0,  1568337843.0,  1915564314.0,  3630743038.0,  2719851406.0},
-  {1427813303.0,  2147051835.0,  1253516370.0,  2091735348.0,   919450974.0,  1753871541.0},
-  {1717800027.0,  3617832332.0,  1255290288.0,  3553061415.0,   485897951.0,  3548338803.0},
-  {2987493393.0,  1143018854.0,  3222663887.0,  3550014798.0,   234603878.0,   429508627.0},
-  {3713451246.0,  2036708735.0,  1800265160.0,   540289926.0,  1172923702.0,  1869745268.0},
-  {1218528179.0,  3895994059.0,  1014578409.0,  3228837443.0,  3971189791.0,  2854293013.0},
-  { 113922139.0,  2603412509.0,   413104739.0,  2145725015.0,  3312595293.0,  1400770151.0},
-  {1372972868.0,   904685857.0,  2467670559.0,  1999533346.0,  4058058960.0,   828110452.0},
-  {2200499108.0,  3890637205.0,  3555832709.0,   477147631.0,    10570523.0,  3246426924.0},
-  {1409838834.0,  3241408001.0,  3926856505.0,  1742801442.0,  1307102513.0,   690908422.0},
-  {2850235664.0,   696200820.0,  3642295616.0,  1887744508.0,  2673079693.0,  2682326918.0},
-  {1943130389.0,   884519495.0,  3574442719.0,    15422122.0,  2105868524.0,  1918104302.0},
-  { 394309477.0,  2630741781.0,  1987619438.0,  4030664964.0,  1463367737.0,   388302161.0},
-  {1580829687.0,  2802121198.0,  1088683020.0,  3744418727.0,  2759660254.0,  2200906700.0},
-  { 470974546.0,   411645505.0,  1665409544.0,  2365537517.0,  3107994705.0,  2012173041.0},
-  {3806407260.0,  3703708967.0,  3520193659.0,  4096653787.0,   616243365.0,  4011088526.0},
-  { 941188131.0,  2818494081.0,  3991330267.0,  4251349477.0,   261778674.0,  1923068337.0},
-  {4238474374.0,  2657396630.0,  2124531725.0,  3150962310.0,  3429704211.0,  1051199572.0},
-  {1729629162.0,  4093159775.0,   818033975.0,  3611103081.0,  3197945068.0,  1840517063.0},
-  {  95587418.0,  3616575080.0,  1740981864.0,  4224899313.0,   631122810.0,  1502834698.0},
-  { 340357566.0,  4090141911.0,  1878907182.0,  4293560544.0,  4237260710.0,  3048432171.0},
-  { 208550559.0,  3272963745.0,  1607154832.0,  3049717256.0,  1805176754.0,  2996541061.0},
-  {3647699678.0,  3812812132.0,  4224112889.0,  2960787161.0,  1297917816.0,  2450186258.0},
-  { 401906234.0,  1108535070.0,   774437341.0,  3053411545.0,  3778888536.0,     6310882.0},
-  {2649078209.0,   277011412.0,   541977401.0,   579222531.0,  3395743576.0,   267232179.0},
-  {1719669745.0,  2599050345.0,  2289764577.0,  1149561724.0,   358528838.0,  2795573167.0},
-  {3843423316.0,   631791882.0,  4072474296.0,  1810386471.0,  1975622147.0,   196746007.0},
-  { 450179142.0,  3058917431.0,  3817535551.0,  1683023543.0,  2258787503.0,  2751793471.0},
-  {2466986367.0,  1803636483.0,  2383404607.0,  3184459524.0,  4130547883.0,  2862877529.0},
-  {1724388789.0,  3754511885.0,   209023543.0,    71927225.0,  2463633143.0,   174625540.0},
-  {3848834373.0,  3276700002.0,  1738186855.0,  2958585857.0,  2674107381.0,  3918129466.0},
-  { 165758374.0,   546091168.0,  3510865446.0,  1591730119.0,  3353291201.0,   288761430.0},
-  { 448255280.0,  3473708715.0,  2823002917.0,  3107911081.0,  3622325583.0,  3006795867.0},
-  {2312342780.0,  2908313369.0,  1478808735.0,   700153440.0,  1595613652.0,  1853328840.0},
-  {3357416121.0,  1811564483.0,   186133757.0,  3164166153.0,  2197514495.0,  1249245979.0},
-  {1929266015.0,  2387526450.0,  1898376537.0,  2133263867.0,  1989762547.0,  2968269308.0},
-  { 386457138.0,  2279746551.0,  3917376548.0,  2300627986.0,  3430840148.0,  2853668942.0},
-  {  94333569.0,  3326649310.0,  3633856180.0,  3068182382.0,   592878780.0,  2757063322.0},
-  {3339021980.0,  4161408276.0,  2546475533.0,  2462514163.0,  3028726526.0,  1244207519.0},
-  {3997382253.0,  3745478099.0,   345081365.0,  2437065000.0,  3486247758.0,  3206373467.0},
-  {2888481585.0,  2663705074.0,  1174870019.0,    13911564.0,   660464234.0,  3054963890.0},
-  { 900901482.0,  2516311671.0,  1356665320.0,   523083722.0,  2409043936.0,   444590341.0},
-  { 382768999.0,  2268499639.0,  2918773309.0,  3855115461.0,  1372637795.0,   371385687.0},
-  {3138540716.0,   246386496.0,   450012453.0,   129476415.0,  2660113411.0,   377219861.0},
-  {  43440239.0,  3801743733.0,  1687817868.0,  2286954671.0,   284520259.0,  2198004622.0},
-  {4013909423.0,  1162155482.0,  3712272739.0,   524164817.0,  3490624376.0,  3967023063.0},
-  {2539045509.0,   631981489.0,  2784601464.0,  3006212293.0,  3740711523.0,  4258325554.0},
-  {3788603424.0,  1003981369.0,  1276771922.0,  1156543871.0,  1195570872.0,  1560398214.0},
-  {2547390322.0,  2834763696.0,  2507057017.0,  4131403896.0,  1172112048.0,    82331525.0},
-  {2550600497.0,  1142442754.0,  1419281622.0,  2800261374.0,  2651318651.0,  1037401531.0},
-  {3364669048.0,  2160093456.0,  2385011925.0,  1512428357.0,  2961766692.0,  1981498610.0},
-  {1683755698.0,  1017587034.0,  2460610533.0,  1467799685.0,  1730941942.0,  1895427187.0},
-  {4268759296.0,  1090014819.0,  2886746530.0,  1287146633.0,   301377325.0,  1688788879.0},
-  {2521957916.0,  2209909225.0,   368906481.0,   198496257.0,  4055804722.0,  2271070026.0},
-  {2299149495.0,  4280987129.0,  1073569844.0,  2598420881.0,   380844097.0,   870142374.0},
-  { 291014867.0,   647365921.0,  2419397657.0,   724287575.0,    25324525.0,  2117657675.0},
-  {4217438766.0,  4156102275.0,  1209513371.0,  2676454356.0,  3280262549.0,    55248685.0},
-  { 364196010.0,  3459354979.0,   160638173.0,  3767297036.0,  3112928202.0,   980260442.0},
-  {3295042547.0,  3032274860.0,  3062571240.0,  2429562833.0,   510339678.0,  1467466629.0},
-  {3902529984.0,  1691182070.0,   143152589.0,    66377933.0,  1015454268.0,   230918550.0},
-  {3152518034.0,  2470844890.0,  3424912676.0,  2665015868.0,  2726336677.0,   445389758.0},
-  {2219126401.0,   431551003.0,  2208927269.0,  2560403022.0,  3460186280.0,  1041409629.0},
-  {1806087702.0,  3980774480.0,   651562001.0,   313627557.0,  2284901366.0,  2893490660.0},
-  {1548562101.0,  3480187585.0,   174344465.0,  2552748880.0,   926827480.0,  2979721435.0},
-  {1469551462.0,  1001077615.0,   823942011.0,  3917949391.0,  2574017513.0,  3001099160.0},
-  {4038636868.0,  2051843610.0,   957751343.0,  1332101862.0,  2142552612.0,  3101251595.0},
-  {2010060504.0,  2817510269.0,  3934372892.0,  2953379967.0,  2902332463.0,  1708792972.0},
-  {3487515356.0,  4103560737.0,  3575774427.0,  2518343239.0,  2577054351.0,  2838739444.0},
-  {2989399400.0,   205540738.0,  3677073240.0,  2029515720.0,  2498416321.0,  1872133140.0},
-  {3147146769.0,  3138220076.0,   657739176.0,  3549369012.0,  2819642167.0,  3286175242.0},
-  {1517685655.0,  4242953902.0,  2100414801.0,  3877180281.0,  1648062815.0,  1020265030.0},
-  { 404338347.0,   737011651.0,  3303124833.0,  1862934687.0,  1379655558.0,  1073782152.0},
-  {4272415572.0,  3448911757.0,    24437157.0,  2389817612.0,  1351713793.0,  4241988223.0},
-  {4244738695.0,  3768240976.0,  2319818775.0,  4273993419.0,  4024586933.0,  2909502338.0},
-  {3626022764.0,  1123908901.0,  3472404531.0,  2719750914.0,  1260249932.0,  3915161776.0},
-  {3416596591.0,   898449845.0,  3014042830.0,  1411192926.0,   535612273.0,  2646339548.0},
-  {2053942413.0,    52967473.0,  2018783885.0,  1293282561.0,   258900011.0,   135931909.0},
-  {4209806809.0,  1149152190.0,  1808810027.0,   332725360.0,  3618372399.0,   562136348.0},
-  {1732398281.0,   390960254.0,  2441563445.0,  3475825182.0,  1501439529.0,   306593604.0},
-  {2684871244.0,  3766901311.0,  2308331074.0,   127118739.0,  3845841481.0,  3757758749.0},
-  {3973880271.0,  2793169200.0,  4077259651.0,  2340283303.0,  4235079684.0,  1520181096.0},
-  { 893198142.0,  3903431686.0,  4205149035.0,  3878434307.0,  2295969116.0,  1256764100.0},
-  {3610267786.0,    42016757.0,  4096318602.0,  3345065168.0,   129184364.0,  2321211388.0},
-  {2451632441.0,   199355310.0,  2347778753.0,  1606612649.0,   617895007.0,  2813397020.0},
-  {2973791671.0,  2238341698.0,  3439721067.0,  1349828130.0,  3379835027.0,  3647367077.0},
-  { 225667474.0,  3647970468.0,  2023565361.0,  2838696816.0,  2879972126.0,  2145106622.0},
-  {3699793310.0,  1975147058.0,  1445038525.0,  1542358611.0,  3511236084.0,  1478012558.0},
-  {1772358156.0,   661519373.0,  1850416445.0,  2189139743.0,  1061907664.0,  2168707340.0},
-  {2797849510.0,  1327355771.0,   742992108.0,  3821514174.0,   127496218.0,   570311104.0},
-  {3892723711.0,  2745088364.0,    16195705.0,  3039973112.0,  4153563712.0,  1918382353.0},
-  {1006002730.0,  2757332506.0,  2592081295.0,  1760138897.0,  1465674296.0,  2368935821.0},
-  { 351468888.0,  2745983392.0,   385698768.0,  4011252299.0,  2451202038.0,  3963345511.0},
-  {3611009389.0,    81505031.0,  3188318231.0,   378940444.0,  3412376545.0,  1271585582.0},
-  { 996428319.0,   497891601.0,  3668700709.0,  1623009845.0,  2995540228.0,   380790498.0},
-  {1614202038.0,  2465148032.0,  1999313596.0,   255228766.0,  2646438489.0,  2225501992.0},
-  {3571966984.0,  1854579900.0,  1304338783.0,  3389640069.0,  1635912911.0,  3839204488.0},
-  {2934079519.0,  3511278977.0,   227596856.0,  1714954354.0,  2018496039.0,   888865893.0},
-  {1992692866.0,  1766221087.0,  1650884929.0,  2744457199.0,  1186619750.0,  1548088594.0},
-  {2760565209.0,  1097013722.0,   823879641.0,   524115747.0,  3200133144.0,  2238938553.0},
-  { 838265240.0,  1709841663.0,   167919430.0,  1914921657.0,  2517889461.0,  3309716606.0},
-  {1156106157.0,  3175175789.0,  1834090588.0,  3316929321.0,  4282902878.0,   967125630.0},
-  {4237778079.0,  1002221652.0,   745012517.0,    47448623.0,  3218372677.0,  2870859576.0},
-  { 242257704.0,  3311215393.0,  3102980159.0,    36858765.0,  1468540941.0,   713144745.0},
-  { 332719071.0,  2645798648.0,  3290820183.0,  2043709226.0,  1642358022.0,  1581196686.0},
-  {3016247004.0,  3465334457.0,  1880789413.0,  1387894639.0,   475465367.0,  2662719887.0},
-  {4224871170.0,  2589792195.0,  2285688544.0,  4013774920.0,  2822723230.0,  1190555610.0},
-  { 467922681.0,   812808496.0,  3132266105.0,  2418083124.0,  1519065707.0,  2432690968.0},
-  { 446381283.0,   717603391.0,  1556505260.0,  3084495298.0,  3424565287.0,  1292714762.0},
-  {3965278375.0,  2608738579.0,  2212169594.0,  1202698521.0,  2077913706.0,  2789832265.0},
-  {3696762390.0,  1701936848.0,   245506312.0,   902621099.0,  2005591173.0,  1673542787.0},
-  {2700649837.0,   343335783.0,  4069369296.0,  2852951643.0,  1405534779.0,   980537524.0},
-  {2979555229.0,   730671549.0,  1419049786.0,  1223520328.0,  1928841230.0,  2779735312.0},
-  {2076286796.0,  2129306967.0,  2527334103.0,  3464197567.0,  3265805946.0,  1823459672.0},
-  { 653044632.0,  3564612879.0,   279241545.0,  3663330103.0,   186928824.0,  4131272039.0},
-  {2578097914.0,  2366397142.0,   746076997.0,  1328164758.0,  1997139063.0,  1834780379.0},
-  {1827852032.0,  4174305360.0,  1750109936.0,   397939140.0,  1178125279.0,  2479105985.0},
-  {3837201543.0,  2694578113.0,  2173131860.0,  2424285819.0,   810295923.0,   559107460.0},
-  {2744295152.0,  2319127585.0,   300405377.0,  4057780990.0,  3691089024.0,  2165508189.0},
-  {1651670342.0,   791519932.0,  1013750016.0,  3438220071.0,  3270351438.0,  3543331459.0},
-  {1410717875.0,  2813404085.0,  1790359694.0,  3576853530.0,  1334271506.0,  1198898861.0},
-  { 765440864.0,   779072182.0,  3227589483.0,  4146308130.0,  2956509865.0,  1181239836.0},
-  {1520221664.0,   227067247.0,  3617890216.0,  2787986691.0,  1504252626.0,  4114333483.0},
-  {2397334275.0,  2500590299.0,   887610116.0,  1017282527.0,  4069218810.0,  2497472625.0},
-  { 127956655.0,  1075846893.0,  3154382171.0,  1557058798.0,  1421186247.0,  3434751863.0},
-  { 631802472.0,  1455044898.0,  1662133930.0,  2656378099.0,  1953951151.0,  3871178372.0},
-  { 439369021.0,  2033251423.0,  1838705928.0,  1145147120.0,  2392396122.0,  3709761412.0},
-  {1013140352.0,  2662046165.0,  4220945806.0,  3974171703.0,   197078087.0,  1275910365.0},
-  {2330960437.0,  3519068800.0,   264254434.0,  2694918818.0,  3959029062.0,  2393099014.0},
-  {3649377099.0,   939993792.0,  3837379779.0,  1101746879.0,   785467061.0,  4010450097.0},
-  {3015917577.0,  2922370211.0,  2190146187.0,   545540142.0,  1959562350.0,   870907665.0},
-  {3303176123.0,  3516900397.0,  2408409327.0,  3327241036.0,  1058015763.0,   716483089.0},
-  {1601463554.0,  1421607279.0,    56787793.0,  3690816890.0,  4236947127.0,  4253784731.0},
-  {2605718679.0,  2762462389.0,  3423952861.0,  3141560370.0,  4113741267.0,  3121500422.0},
-  {3826190367.0,  2014326820.0,   335843014.0,  2175351137.0,  4121187864.0,  3337094965.0},
-  {3496226347.0,  2759155171.0,   387573809.0,  2458849830.0,  3162364581.0,  1962632124.0},
-  {3634086012.0,   857799838.0,  3482834139.0,   864613912.0,  1578247745.0,  1355972865.0},
-  {1110938734.0,  4017148952.0,  1261141919.0,  1654385588.0,  3442044193.0,  3939561746.0},
-  {1413588682.0,   679106237.0,  2916470193.0,  1959250753.0,  1719418078.0,  3379826939.0},
-  {2942125194.0,   309396666.0,  3055486985.0,  2001049249.0,  2575247039.0,  3130374123.0},
-  { 797345523.0,  2168163463.0,  4120248908.0,  1406208245.0,     3617958.0,  3347101644.0},
-  {4254147938.0,  2561312781.0,  1153693850.0,    62541271.0,   649647194.0,   479536156.0},
-  {2982159366.0,  1406838922.0,  3375674252.0,   311767356.0,  1919005423.0,  3746931313.0},
-  { 550097756.0,  1088455358.0,   357539590.0,  1838714308.0,  1777204572.0,   315794070.0},
-  {1623658338.0,  3794872770.0,  1609129340.0,   721801108.0,   585695236.0,  3982110647.0},
-  { 745153757.0,  3963367211.0,  3577025562.0,  2419584431.0,   292982676.0,  2025188198.0},
-  {3497427063.0,  1689427733.0,  3789940051.0,  1058668638.0,  3574299357.0,  3942376747.0},
-  {3019951394.0,   331036712.0,  3551523588.0,  4140135966.0,   354737129.0,  1386877317.0},
-  {  83313330.0,  4268764406.0,  2442258912.0,  2301359306.0,  3476037366.0,   302634499.0},
-  { 196702527.0,   832451487.0,  1579136958.0,   811596449.0,  4216367967.0,  3070377681.0},
-  {2822920387.0,  1608895492.0,  2190229632.0,  3240881007.0,   190572137.0,  1042755947.0},
-  {3741735376.0,  1824524043.0,  3558524805.0,  2030118864.0,  1259568112.0,   349380527.0},
-  {3803864161.0,  1801026620.0,  3652649520.0,  2657705780.0,  1653778571.0,   643706518.0},
-  {2910358936.0,   302584304.0,  2825540732.0,  1305829852.0,  1428182627.0,  3185800133.0},
-  {2366456788.0,  2625478922.0,  1163114135.0,  1784516391.0,   994045567.0,  2171947407.0},
-  {1962347898.0,  2289497082.0,  1411329991.0,  3190693796.0,  1143030875.0,  3817650332.0},
-  { 535460445.0,   654462994.0,   773460547.0,  2639416523.0,   480581138.0,  1732594704.0},
-  {2226695902.0,  1374427071.0,     9848356.0,  4083193033.0,  3065351043.0,  3952369089.0},
-  { 228699644.0,  1505752230.0,  4198819383.0,   928571602.0,   357653051.0,  2538912638.0},
-  {3431004575.0,  3016233060.0,  2143369982.0,  3428861569.0,  1349925645.0,  2850184509.0},
-  {3763749588.0,  2685611192.0,  1235961591.0,   225673059.0,  3602279966.0,  2283023344.0},
-  {4145241372.0,  1888898062.0,   583624546.0,   573324873.0,  2984696300.0,  2736047856.0},
-  {1057350502.0,    89119719.0,  2641104754.0,  4109176847.0,  1069415863.0,  2565022970.0},
-  { 600532413.0,  2059450891.0,  2595804227.0,  4065687747.0,  1003409639.0,  4144944734.0},
-  {1566308598.0,  2826553001.0,  3424630141.0,  4023750405.0,  3444842654.0,  2116704247.0},
-  {3118732301.0,  3933317735.0,  1273147677.0,  4095097422.0,  2847657132.0,  2218530962.0},
-  {1593959097.0,  3424681498.0,   928888132.0,  1261450759.0,   776034774.0,  3650975498.0},
-  {2791297551.0,  2976016695.0,  1158395670.0,  2600452600.0,   895987284.0,   770523957.0},
-  {3332988018.0,  3155216489.0,   240248765.0,  1199159213.0,  3445829484.0,  3212249543.0},
-  {2060716683.0,   793302143.0,  4283039722.0,  1160127738.0,  2114516556.0,  2335321579.0},
-  {2555221981.0,  3493645505.0,  3424149392.0,  3191278518.0,   117965737.0,   396564272.0},
-  { 718350790.0,  2742242149.0,  3762461940.0,   488528961.0,  1809549019.0,  2070700790.0},
-  {3673467450.0,  1910627498.0,  1535547129.0,  2030958574.0,  2342566485.0,  1366566727.0},
-  {2056960075.0,  1790577007.0,  1212858857.0,  3706143918.0,  3479295556.0,  3538671990.0},
-  {3022865500.0,  1102673214.0,  3594468870.0,   917056759.0,   665700028.0,  2171359285.0},
-  {1025886555.0,  1948506846.0,  3348923634.0,  2276571410.0,  1721035499.0,  4279569185.0},
-  { 596794712.0,  2871355999.0,   840756915.0,  2263553120.0,  3492398849.0,  4055710782.0},
-  {  63777883.0,  3358412533.0,   376921369.0,  2026231628.0,  3010808168.0,  3824693792.0},
-  {3898821864.0,  4204016904.0,  2968347973.0,  3397799373.0,     5506924.0,  2442047782.0},
-  {3222532176.0,  2202335579.0,  2247390373.0,  1360937276.0,  2882312553.0,  4140013061.0},
-  {1861233056.0,    12532129.0,  3785519075.0,  2540801042.0,  1877762647.0,   919442579.0},
-  { 277806049.0,  2615510840.0,  4261610943.0,  3108736063.0,  3035109676.0,  3677874694.0},
-  {4066942453.0,  4141397609.0,  3161970480.0,   354949511.0,  4145242460.0,   261114076.0},
-  { 212301442.0,   101956603.0,  1369393592.0,  2595543807.0,   228107290.0,  2073390205.0},
-  {4126350787.0,  3283870699.0,  3374994046.0,   410882838.0,  2311278814.0,  1396655340.0},
-  {3254620695.0,  2475762236.0,  1930240785.0,   106682648.0,  1895684648.0,   589139785.0},
-  { 678780222.0,  3547548714.0,  4127386675.0,   162188218.0,  2267651663.0,  1556067600.0},
-  {2144038986.0,  3275742597.0,   905985696.0,  1402312097.0,  2661405468.0,   689880403.0},
-  { 187261909.0,  3448084241.0,  1790590120.0,  2821299520.0,  1145451508.0,  3115970511.0},
-  {3651763187.0,  1351035783.0,  1133832229.0,  2000153715.0,  2950784535.0,  1850824559.0},
-  { 757842913.0,  2376333182.0,  1349661657.0,  3821582692.0,  1086412735.0,   486093205.0},
-  {4230793848.0,  2450252810.0,  1877698831.0,  1433705396.0,  2043744409.0,  1423498072.0},
-  {1735367547.0,  3833892985.0,  3084771545.0,  2612062892.0,  2351553218.0,   771975761.0},
-  { 668369643.0,   343242190.0,   148339263.0,   464986473.0,   389975109.0,  3861772198.0},
-  { 104124888.0,  3441053919.0,  3160809096.0,  1451195981.0,  2241576985.0,  3952785743.0},
-  { 558752309.0,  2316836274.0,   743035219.0,  2288089819.0,  2537946136.0,  3021060703.0},
-  {2932329972.0,  2921801802.0,  3711740956.0,  3873587978.0,  3521502416.0,  3471411429.0},
-  {2448890538.0,  1388083125.0,   709822954.0,  3482759078.0,  4233664644.0,   695797885.0},
-  {3190430640.0,  3938688721.0,  3376241719.0,  1846222591.0,  4238419954.0,  1299909098.0},
-  {1683961621.0,  1331195250.0,  1933169776.0,  3352393739.0,  2080486401.0,  2509201801.0},
-  {2573487044.0,  1750803748.0,   517336575.0,  4050153463.0,  2901461921.0,  3017296277.0},
-  {2859595515.0,  2395720819.0,  2193977400.0,  4143077117.0,  2320195557.0,  2039469638.0},
-  {2717440846.0,   603703811.0,   298382181.0,   717318857.0,  4293037301.0,   497463312.0},
-  { 874172552.0,  1041249640.0,   805622818.0,  1570528954.0,   597309466.0,  3742416837.0},
-  {3305490578.0,  4270895874.0,  1535208502.0,  1819242215.0,  2770831709.0,  3762508779.0},
-  {2221427370.0,  2660311160.0,  2920826180.0,  4183405756.0,  2492377450.0,  1070319062.0},
-  {3067319658.0,  1738556925.0,  2861203707.0,  2687496151.0,  2726168165.0,  1999250514.0},
-  { 874669228.0,  1345474511.0,  2610327327.0,  3203601432.0,   498767773.0,  1738576114.0},
-  {1242126782.0,  2422632144.0,   443179713.0,  1437557025.0,  4287148888.0,   941649796.0},
-  { 756192449.0,   261569633.0,  1490547632.0,   357757222.0,  2944866285.0,  2818329048.0},
-  {3902201915.0,  1777755294.0,   855683063.0,   158993971.0,  1768214660.0,  3224286413.0},
-  {1962543683.0,  1272429899.0,  4101796941.0,  3098318808.0,  1336374168.0,  1880907190.0},
-  { 530855688.0,  4192985342.0,  1102085136.0,  1454743747.0,  3731585113.0,   894337655.0},
-  {1894902771.0,  1419146789.0,   377240971.0,   501895900.0,   311718474.0,  3983909456.0},
-  { 227823375.0,   272247244.0,  1385154649.0,  3740294100.0,  3523305771.0,  2219165431.0},
-  {3490907920.0,  3717974896.0,     7313338.0,  1024837640.0,   740615823.0,   291280627.0},
-  {1612201593.0,  2990695409.0,  1569043272.0,  1373948066.0,  3733126785.0,  4066190153.0},
-  {2743521684.0,  3584986863.0,  2299807227.0,   438426165.0,  1792695081.0,  4109030674.0},
-  {4077835283.0,   995068497.0,  1026654683.0,  3326247584.0,  2217545313.0,  3923098720.0},
-  {2638526545.0,  3196849308.0,  2599583502.0,   416972522.0,  1860977939.0,  1277294938.0},
-  {4101609852.0,   492350875.0,  4128829934.0,  2538519811.0,  3640760407.0,  3893392201.0},
-  { 473464953.0,  2621797184.0,  3838821009.0,  2933293137.0,  1463522982.0,  3101593755.0},
-  {3621405506.0,  1557381302.0,  1257244268.0,  3801691492.0,  1869130876.0,  4108740703.0},
-  {2815877692.0,   879443175.0,   474262020.0,  1194599538.0,  1643074013.0,   760986474.0},
-  {2141710859.0,  3964536190.0,  1461234855.0,  1284771443.0,   340804597.0,  1372265028.0},
-  {1155493205.0,   664655406.0,    22592474.0,   349983254.0,  1512858870.0,  1563506765.0},
-  {1895420977.0,   394518181.0,   771770207.0,  1212728155.0,   446200329.0,   701387443.0},
-  {2543381443.0,  3750569046.0,  3852039925.0,  2513925409.0,  3455067629.0,   328528478.0},
-  { 492719194.0,   587668940.0,  2502803840.0,  1706853491.0,  3625723359.0,  2165782031.0},
-  { 877767300.0,  2500251996.0,  3501422983.0,  2351034112.0,   464476248.0,   975391591.0},
-  {1606002591.0,  3468430018.0,   975381645.0,  1052690276.0,  2188438974.0,  4155349154.0},
-  {3087519153.0,  1154570287.0,   935768832.0,  3594458622.0,  3745279563.0,   994161354.0},
-  {1385963995.0,   695994657.0,  2944537081.0,  3301188587.0,  2575892184.0,  2417350404.0},
-  {2764483553.0,   674255493.0,  2589329217.0,   434209104.0,   805258637.0,  3272140735.0},
-  {4145298019.0,  2543939359.0,  2800315034.0,  2798313909.0,   454210707.0,  1854636572.0},
-  {3671219934.0,  2755479585.0,  3645225066.0,  3552052552.0,  2184089317.0,  2879070279.0},
-  { 972963728.0,  2368186726.0,  3610313102.0,  4024103239.0,   596161203.0,  2942492834.0},
-  {  13450311.0,  1836433235.0,  2528077193.0,  2985507028.0,  1584178008.0,  1141885521.0},
-  { 122529054.0,  2378798505.0,  1693234899.0,   417715610.0,   834182142.0,  3208246061.0},
-  {3705797533.0,   624097560.0,  3546412422.0,  3826918487.0,  2580590550.0,  2207805142.0},
-  {2420462785.0,   605336635.0,  2904478533.0,    44639122.0,   272251827.0,  3740370649.0},
-  {1477723647.0,  3924469829.0,  2407697128.0,  2658630019.0,  1715411239.0,  2784908696.0},
-  {3557453897.0,  3454053480.0,   839502932.0,   609144933.0,  2425025234.0,  3840883780.0},
-  {2206844992.0,   301381564.0,  1195303513.0,  3358047585.0,  2413584026.0,   133698300.0},
-  { 433282768.0,  1631058511.0,  3194031083.0,  3047166923.0,  2025282695.0,   385300184.0},
-  { 135418281.0,  1893374957.0,  1581189342.0,  2897436006.0,  1993477459.0,  3925344282.0},
-  {4098466359.0,  2824346981.0,   313076289.0,  1205901755.0,  2471050480.0,  4259661360.0},
-  {  90662194.0,   627969692.0,   520530838.0,  3130223474.0,  1568849916.0,  3205917337.0},
-  {4006207361.0,  2021681214.0,  2668990292.0,   463767584.0,  2913076262.0,  2121643508.0},
-  {1673093563.0,  1876606063.0,  3536276552.0,   772368307.0,  2253541158.0,  3960496659.0},
-  {3247518823.0,    71978311.0,   692076650.0,  2000589703.0,  2262717564.0,  1556756806.0},
-  {1251872861.0,  3813632390.0,  1118734083.0,  1189270349.0,  1574791035.0,   744548509.0},
-  {3975655607.0,  3616941312.0,  3112642095.0,  2589795214.0,  3986782566.0,  4080030497.0},
-  {2161743402.0,  1996074726.0,  1980721068.0,  3566943044.0,  3728295470.0,  3801777536.0},
-  { 880220050.0,  1199593730.0,  2961089884.0,  3480460320.0,   944631293.0,   288967516.0},
-  {3200272728.0,  1994298587.0,  2657802845.0,  1849821589.0,  2465031922.0,   802512420.0},
-  {3488448796.0,  1681127574.0,   276536328.0,  2802945632.0,   232312986.0,  2422228668.0},
-  { 887171205.0,  2851082348.0,   579895915.0,    48339219.0,   490555893.0,   258980702.0},
-  {4119489384.0,   867036243.0,  1840679504.0,   170513002.0,  1545874425.0,  2806115503.0},
-  { 838153667.0,  2638525146.0,  2371458095.0,   401375893.0,  1626801316.0,   738056398.0},
-  {1733932520.0,  1670281316.0,    39002503.0,  1605907038.0,  1599401854.0,  2612112049.0},
-  { 449528034.0,   683962631.0,  2736578883.0,  2126684123.0,  4009577728.0,  1569421042.0},
-  {3925458767.0,  1471015208.0,  3787932718.0,   747200999.0,  2318785472.0,  1905069706.0},
-  {1872442595.0,  3942497220.0,   446954830.0,  2308511942.0,   808205390.0,    66633948.0},
-  {1792326855.0,   692842493.0,  1453687626.0,  1201017396.0,   926647270.0,   707238396.0},
-  {3973194160.0,   616712844.0,  3169108122.0,   908982816.0,  3611537427.0,   806859184.0},
-  { 428449617.0,  1061354254.0,  1593032350.0,  3842759954.0,  2058367859.0,  2137480395.0},
-  {3378375391.0,     8947584.0,   103881883.0,  3256828590.0,  3134815173.0,  2468933423.0},
-  {2679202623.0,   616969133.0,   172985508.0,  1510436035.0,   426490295.0,  3356870849.0},
-  {3108975725.0,  4266713351.0,  2474534125.0,  2695450710.0,  2414791029.0,   600617564.0},
-  { 126643442.0,  3765645680.0,  2348624684.0,  3890745668.0,   867360493.0,  2956924437.0},
-  {1897526867.0,  4292720596.0,  3469539234.0,  4037957812.0,  3177177154.0,  4090021946.0},
-  { 265655556.0,  3778318520.0,  3681689555.0,  3154730181.0,  3960714126.0,  1223898419.0},
-  {  96486030.0,  1835174706.0,  4164848686.0,  2159839949.0,  3926269277.0,    28843861.0},
-  { 735630956.0,  2668349170.0,   137017918.0,  3636449323.0,  3798446486.0,  3915340690.0},
-  { 600881639.0,  1952854348.0,  3391921148.0,  1352615629.0,  2502793544.0,  4211425005.0},
-  {2920403325.0,   920831271.0,  3184348422.0,  3313905244.0,  3288781937.0,  3159819915.0},
-  {2623512711.0,   440419134.0,  2259226960.0,  1970650746.0,  3590396303.0,    73132708.0},
-  { 316033179.0,   637322278.0,  3662278776.0,  4066492427.0,   687676317.0,  3574605022.0},
-  {1826273477.0,  2862373394.0,  1466361030.0,  2981514703.0,  3001328756.0,  1702415679.0},
-  {1407816173.0,  2000949958.0,   825910551.0,  2796665758.0,   926530770.0,  2805753170.0},
-  {3048600408.0,  3083827164.0,  3989154043.0,  1268280060.0,  3699889651.0,  2511966688.0},
-  {3837843550.0,  2043424730.0,  3225603379.0,  1347091970.0,  3393281543.0,  2410205635.0},
-  {2192257091.0,  2938054392.0,   321865762.0,  3718313809.0,  3953456402.0,  1701734405.0},
-  {3642324317.0,   479241225.0,  4015522392.0,   898116532.0,  2548028441.0,  1935220768.0},
-  { 830100444.0,   426335006.0,  3199290964.0,  3780062329.0,  1219387181.0,  3260587882.0},
-  { 568233503.0,  4146387690.0,  2326203957.0,  4153457223.0,  2326311873.0,  4056713891.0},
-  {3920773058.0,  4251980567.0,   886451491.0,  3149232346.0,  2347179304.0,  2128920853.0},
-  { 555927048.0,  2971981214.0,  1236375355.0,  2707707954.0,  1357997841.0,  3955422217.0},
-  {3875282218.0,   573950460.0,  1234341497.0,   493044106.0,  3817937787.0,   781999610.0},
-  {1686605039.0,  4254909645.0,   440774898.0,   221701819.0,  1679231996.0,  3742385361.0},
-  {1222083567.0,  3724072560.0,   687551304.0,  3658937285.0,  1586461446.0,  2964661583.0},
-  {3360299725.0,  2600695287.0,   377799577.0,   826936260.0,    23109273.0,  4039708505.0},
-  {1383780846.0,  2803331485.0,  2306758277.0,  1267695502.0,   642672755.0,  4064908688.0},
-  {3376300825.0,  3103089818.0,  3616527900.0,  1725891662.0,   453352897.0,   262781384.0},
-  { 670748829.0,  4096158061.0,  2117410251.0,  3110751987.0,  3659518640.0,  1533927947.0},
-  {3930990922.0,   915381334.0,  4192187216.0,  3678936983.0,  3281799965.0,  1093940278.0},
-  {2440455119.0,  4026932757.0,  3662111300.0,   351668571.0,  3019902105.0,   868947273.0},
-  {4203738176.0,  2738587760.0,  3473259573.0,   331098432.0,  3477454330.0,  3247349932.0},
-  {4006228112.0,   482790013.0,  1033454200.0,  3105270255.0,   708992330.0,  2065567260.0},
-  {3920427967.0,   534720058.0,   195646323.0,   326121859.0,  3518640643.0,   479006797.0},
-  {3010420920.0,  1104793703.0,  1168058321.0,  1149581871.0,   438448262.0,  3010673205.0},
-  {3421769784.0,  4106626938.0,  4258269223.0,  2771200154.0,   396665042.0,  2503362368.0},
-  {1065697916.0,  2624178112.0,  3856235041.0,  2928216435.0,  1892579327.0,   404049978.0},
-  {2454288141.0,  4137198454.0,  1885902426.0,   882711834.0,  2950050997.0,  2193165097.0},
-  { 268111563.0,  1990548412.0,  2430932706.0,  1980890029.0,  2497857184.0,  3250160185.0},
-  {4208282018.0,   422919626.0,  4195930333.0,   249358135.0,   214870828.0,  3613592687.0},
-  {4213174577.0,   595750452.0,     9482046.0,   914706557.0,    58661423.0,  2795951341.0},
-  {1537607324.0,  4077165348.0,  3188871198.0,  2518318503.0,  1807574101.0,  3168578298.0},
-  { 499855544.0,   878109670.0,   901033603.0,  3934958629.0,  3193914599.0,  3866587578.0},
-  {2199831415.0,  2203571134.0,  2195321414.0,  3472998376.0,    83326270.0,  1977193770.0},
-  {1518345956.0,  3831389008.0,    31985401.0,   949131745.0,  1210778186.0,  2835379672.0},
-  {2760253357.0,  2838794834.0,   154324274.0,  2330929811.0,  4160856381.0,  1065057979.0},
-  {1708106898.0,  1448175088.0,  2380509893.0,  1994433223.0,  1702074894.0,  4109805139.0},
-  {2025537118.0,  1649847152.0,  4256198650.0,  4277213779.0,  2490383086.0,  2701487604.0},
-  {3587224403.0,  3760488239.0,  1091407530.0,  1797105469.0,  1300453870.0,  1872979025.0},
-  {2293292995.0,  2612418214.0,  1578248037.0,  1812241697.0,   439629995.0,  3902781300.0},
-  {2321487087.0,  2211533848.0,   536156808.0,  3526323053.0,  2145554551.0,   196882410.0},
-  {3155712380.0,  2764059232.0,   415441514.0,   109464725.0,  3325256667.0,  4121294685.0},
-  {2411030698.0,  3655020169.0,  1855203861.0,   383593569.0,  2395968586.0,  1839531886.0},
-  { 683476190.0,  2637608511.0,  4125028620.0,   240602801.0,  3734832970.0,  1904301217.0},
-  {1134234398.0,  2717870494.0,   121483367.0,  1111068419.0,  3065102273.0,  2491268326.0},
-  { 453204705.0,  2290788075.0,  3605289511.0,   881244811.0,   756073080.0,  2926488020.0},
-  {1602820357.0,  3267702277.0,  1960152271.0,   100602448.0,  1055783054.0,  3111787311.0},
-  {3707809297.0,  4105301124.0,  1812857018.0,    59026257.0,  3654514023.0,  1751920936.0},
-  {1264709809.0,  3030717862.0,   952184931.0,  2547692476.0,  2691305121.0,  3981357774.0},
-  {3746733571.0,  1544866751.0,   735621321.0,  3135518983.0,   121420230.0,  3484832453.0},
-  {2379446379.0,   916956381.0,  2765258185.0,   916830431.0,  3314077134.0,   198019015.0},
-  {2950972262.0,  2414791524.0,    92512017.0,    60651311.0,  1092876404.0,   933185357.0},
-  {2402402981.0,  3626699590.0,  2446858275.0,  2760247411.0,  1521417484.0,   891225365.0},
-  {2196931335.0,  3513654196.0,   562733388.0,  3284472835.0,   343570682.0,   729436369.0},
-  { 166832458.0,  3515616777.0,  1162076870.0,   874124597.0,  3443710848.0,  3759720106.0},
-  {3623583021.0,   541374660.0,   672187879.0,  1011207521.0,  2660403068.0,  2447479013.0},
-  {2651021318.0,  1351367725.0,  2425542251.0,  1780036541.0,  3828229681.0,   814264758.0},
-  {3061583178.0,  3364271759.0,  1698134382.0,  1166931063.0,  2002729514.0,  4178813748.0},
-  {2526004946.0,  3120568897.0,  3555880747.0,  4205607836.0,  1434382300.0,   774781898.0},
-  {1339095652.0,   160416470.0,  2935081542.0,  2748234339.0,  1283474440.0,  1953889456.0},
-  {2512108347.0,  3649153982.0,  3993671919.0,  3500036123.0,  1303184824.0,   620873071.0},
-  { 491955541.0,  3385137623.0,  1971496045.0,     5642845.0,  2083502369.0,  1732303026.0},
-  {3109058132.0,  3828896565.0,  1936683509.0,  2588562285.0,  2253590421.0,   726285171.0},
-  {3357825728.0,  2733160600.0,   615638044.0,   168338733.0,  2113804873.0,  3623602093.0},
-  {3729590644.0,  2949648329.0,  4250918964.0,  2850181347.0,  2126864029.0,   248073064.0},
-  {4060447414.0,  3157945335.0,  3844009036.0,  3498707958.0,  2018560445.0,  3879907547.0},
-  {1448289047.0,  3702456932.0,  3101521913.0,  1480456321.0,   708730410.0,  1250899596.0},
-  { 558099663.0,  1254654218.0,  2149102579.0,  2703697864.0,  3215326759.0,  3542862872.0},
-  {1054514371.0,  3580675504.0,  3559062397.0,  1456405253.0,  2625474946.0,  1500759519.0},
-  {3080984111.0,  1784885721.0,  2073836436.0,  3015652857.0,  2150661033.0,  2114394838.0},
-  {  10727963.0,  1079208799.0,  1694805403.0,  2607370502.0,   680503869.0,  2686886765.0},
-  {3293596574.0,  3507228247.0,  2058116387.0,  2726822085.0,  4119110485.0,  3997000096.0},
-  {2955767544.0,  3024993603.0,  3919064435.0,  1702684862.0,  3111590268.0,  2520935278.0},
-  { 749359792.0,  3777643581.0,  1681815322.0,  1624923537.0,   542179025.0,  2093658292.0},
-  {3587178428.0,  2766824162.0,  4027285379.0,  2041843618.0,   884814042.0,  1993810546.0},
-  {3113158935.0,  2178905570.0,   823372298.0,  3750124475.0,  2452209263.0,  4134437049.0},
-  {2475759723.0,  1743260987.0,  4218733207.0,  3656101455.0,   810389388.0,  1462614968.0},
-  {1772023102.0,  2456374535.0,   805040435.0,  2805004589.0,  2382918630.0,    10736765.0},
-  { 853467735.0,  2514122550.0,  3193289162.0,   669266683.0,  3052642269.0,  3638721283.0},
-  {3325116752.0,   308583098.0,  3451095839.0,  3673331788.0,  1278494658.0,  2378645942.0},
-  {2056422218.0,  2373908944.0,  2985626669.0,   372653203.0,  2902116643.0,  2758097227.0},
-  {2449668083.0,  1028661574.0,  3983477168.0,    76884059.0,  1284344283.0,  1067620393.0},
-  {3083082235.0,   472489612.0,  1752972372.0,  2262215006.0,  2875724646.0,  4233756850.0},
-  {2592216911.0,    26685641.0,  1678521398.0,  3649237678.0,  2030132217.0,  3201182000.0},
-  { 305311445.0,  3147627757.0,  3314072095.0,   767695949.0,   159399616.0,   592868857.0},
-  {2964320544.0,  3591531829.0,  3092518782.0,  2775984734.0,  2722517658.0,  2868607609.0},
-  {1410203785.0,  2712975019.0,  3497685072.0,  1678109918.0,  2739154027.0,  3466463274.0},
-  {3474823845.0,   109817205.0,  1310566818.0,  2548128512.0,  2962818012.0,  3060161588.0},
-  {2897202151.0,  2993673025.0,  3364783936.0,  1034545751.0,  1217754494.0,   282665353.0},
-  { 717145248.0,   326266669.0,   962902742.0,  1042473593.0,  1176420128.0,  2465226236.0},
-  {2349097947.0,    86934196.0,  4256281513.0,  2723392382.0,   122090417.0,  1492556139.0},
-  { 194367205.0,  1261786529.0,  2731967502.0,  2279602290.0,   563235526.0,   747462020.0},
-  {2094848621.0,  3294035382.0,  1296419918.0,  2256033811.0,  2030964119.0,   738424429.0},
-  {1745607675.0,  1126325079.0,  4228409676.0,  2503671672.0,  2971754233.0,  1880547706.0},
-  {2428616683.0,  1273926490.0,  1742083930.0,  2862855914.0,  1512174487.0,  2182475639.0},
-  {3416467315.0,  2436314417.0,  4089338622.0,  2676247666.0,  1318987180.0,  2773727722.0},
-  { 380848380.0,  4237094143.0,  3461745678.0,  1056832329.0,  3078114330.0,  2160419345.0},
-  { 208609004.0,   493820162.0,  4064835151.0,  2634600117.0,  2528921741.0,  1178441420.0},
-  {1007389564.0,  3503858852.0,  4219499517.0,  1136357646.0,  2022671377.0,  3797042020.0},
-  {2549008643.0,  3495825189.0,  1448053573.0,   272217461.0,   816472989.0,  3591925394.0},
-  {3343083230.0,  3024198918.0,  3771956522.0,  1811216321.0,  1372484868.0,  2879122090.0},
-  {1042491960.0,  3091833510.0,  2657950617.0,  3432402082.0,  1211808843.0,  3175603824.0},
-  {3485028195.0,  1384341436.0,   801317143.0,  3608169536.0,  1875206472.0,  3673459632.0},
-  {3562428993.0,   317643099.0,  1063563480.0,  1552452690.0,  1820279091.0,  3900639450.0},
-  {1836197209.0,  3030987997.0,  1902742567.0,  1245383867.0,  2037931340.0,  4021247904.0},
-  {4268977607.0,  2726536339.0,  2734849286.0,   837801310.0,  1908428896.0,  3649399503.0},
-  {4140436479.0,  1083684228.0,  4179316257.0,  4120702302.0,  3378045444.0,  3068653411.0},
-  { 226595874.0,   414774681.0,  1085683940.0,  2270194070.0,  1580844218.0,  3378906951.0},
-  {1152967098.0,  4084414562.0,  1435306659.0,  1829610231.0,  2245506090.0,  3223116570.0},
-  {2186498065.0,   673694330.0,  4277289282.0,  2691351813.0,  2596752129.0,  3617405186.0},
-  {1658703123.0,  4092988096.0,  1101720968.0,   321366675.0,  2205094529.0,  3527434061.0},
-  {1249848627.0,  2249735015.0,  1109404321.0,   120778873.0,  4098352750.0,  1789813746.0},
-  { 321985997.0,   627459188.0,  1859945597.0,   121545236.0,   961410697.0,  3700636027.0},
-  { 699300448.0,  2592526689.0,  3074081201.0,  3300668882.0,    68157960.0,   330072381.0},
-  {1962440356.0,  1572106217.0,  3944459246.0,   610077944.0,  1396300675.0,  2556903320.0},
-  {3268870946.0,  1238201499.0,  3914400326.0,   875676514.0,  2113433444.0,   605663162.0},
-  { 611125215.0,  4234352513.0,  2799261786.0,  3118888483.0,   843816914.0,  3590641686.0},
-  {3248184339.0,  4125591599.0,  2137484019.0,  3000740189.0,  1069278238.0,   305006478.0},
-  {3513628870.0,  2703073650.0,  3221709128.0,  4183849598.0,  3376873574.0,   375025365.0},
-  {3269454026.0,  2136290061.0,  2920306192.0,  2449892592.0,  1616633978.0,  2738071720.0},
-  { 411100922.0,  3938947811.0,  3226847676.0,  2024576480.0,   196772272.0,  1242199975.0},
-  {1390781656.0,  2568768461.0,  2490852380.0,  2278609274.0,  3183711823.0,  2704919871.0},
-  {2321950624.0,   206021973.0,  3139137796.0,  1196575815.0,  2678506885.0,  1922610872.0},
-  { 559313324.0,  3039259603.0,  2878099540.0,   893232306.0,  2207423972.0,   924682438.0},
-  {1780247660.0,  3301831108.0,  2036912143.0,  3543095140.0,  1832112035.0,  3620334231.0},
-  {1727281807.0,    37017143.0,   838027353.0,  1667724534.0,  2136818030.0,  3951975078.0},
-  {1357229818.0,   276125370.0,  2815062209.0,  1773431184.0,   653275690.0,  3605087524.0},
-  { 626721364.0,  2160961295.0,  2001657802.0,  1994614993.0,  3901963348.0,  1514826386.0},
-  { 954009854.0,  4077325834.0,    47396454.0,  3161699033.0,  1021854625.0,  1019917415.0},
-  {1677500008.0,  4204868689.0,  3377651610.0,  2490193241.0,   422534149.0,  2229703046.0},
-  {1269393693.0,  3522186122.0,   928317212.0,  2088561547.0,  3527812465.0,    67940765.0},
-  {1640232485.0,  3051988684.0,  1257040994.0,  2320159111.0,  3833578780.0,  1379194272.0},
-  {3129779366.0,   670279316.0,    82869571.0,  1078802813.0,  2923923775.0,  1924497255.0},
-  {3356169558.0,  2865680313.0,  2377275714.0,   337579956.0,  1626658443.0,  1319075635.0},
-  {1484791415.0,  3028311375.0,  2530974838.0,   917973636.0,  3632285102.0,  1651970265.0},
-  {3908291411.0,  4130271979.0,  3095656616.0,   323615743.0,  3986532586.0,  2863763028.0},
-  {2297478146.0,  4166389714.0,  2655848806.0,  3650315152.0,  2484315599.0,   820473083.0},
-  {3920942105.0,  3638308705.0,  1657676501.0,  3717782551.0,    61667121.0,  1778776904.0},
-  {1621973092.0,  1572233004.0,   772146458.0,  3496226314.0,  1700959311.0,    87609379.0},
-  {1559192179.0,  3920314405.0,   262023782.0,  3240906344.0,  2279717064.0,    23287493.0},
-  {2998696109.0,  2110344078.0,  3597343895.0,  3858641798.0,   489646351.0,  1175880085.0},
-  {1182201246.0,  1857843451.0,   500424235.0,  3032649825.0,   836588942.0,  4076898524.0},
-  {2039586230.0,   759596110.0,  2112380261.0,   375768924.0,   713172614.0,  1395290162.0},
-  {3760547937.0,  2756910135.0,   780355152.0,  1649285267.0,  3742005301.0,  2708780470.0},
-  {2770407301.0,  2184967040.0,  4088925012.0,   196146577.0,  2826675335.0,   161930644.0},
-  { 582440587.0,  2461618232.0,   102321401.0,    69995575.0,  4085267154.0,  1282532063.0},
-  { 938891537.0,  2642713356.0,   915742030.0,   285483629.0,  1632964936.0,  3622984308.0},
-  {1136889067.0,  1820470683.0,   160207158.0,  4200066997.0,  3242994802.0,  3300920886.0},
-  { 853997524.0,  3483961780.0,  1801139954.0,   897456647.0,  3009736532.0,  1708241221.0},
-  {2245009102.0,  2717016586.0,  3972324023.0,  2800057009.0,   402816063.0,  4294399608.0},
-  {2048435692.0,  3162669173.0,   954040435.0,   607873780.0,   671885516.0,  3178309435.0},
-  {3969937493.0,  3630219980.0,  1959712426.0,   749343639.0,  2870378237.0,   755344990.0},
-  { 351686773.0,  1855646827.0,   288480267.0,  1376873021.0,  2794327525.0,  4147998787.0},
-  {4267869895.0,  3350462139.0,  1041004658.0,   559616239.0,  1983260770.0,  1579312682.0},
-  {3261383003.0,   946117449.0,  3860046581.0,   719231679.0,  1989405355.0,  2967711151.0},
-  { 109235254.0,  3731108490.0,  2119954381.0,   350551898.0,  1250496942.0,  2501369056.0},
-  {1594232488.0,  1739795472.0,  2387219817.0,  3709707136.0,   123978431.0,  3482876924.0},
-  {1274067902.0,  3724837390.0,  3134541997.0,   974707789.0,  1881852568.0,  3074445177.0},
-  { 484524776.0,  1586191510.0,   406642670.0,  3813543947.0,  3141604218.0,    49408542.0},
-  {  41306213.0,  3529426970.0,  1450266232.0,  3965453541.0,  2580406069.0,  3584299555.0},
-  {1616883474.0,  1884022262.0,  2863683515.0,  3050819122.0,  3388154937.0,  2432537449.0},
-  {4006801606.0,  3059235066.0,   374323249.0,  1964219442.0,  4044342066.0,  2954484600.0},
-  {4121343005.0,   303563652.0,  3332202960.0,   986860880.0,  2394079485.0,   665548954.0},
-  { 720719346.0,   244459885.0,  2170702231.0,  3082794305.0,  2229659912.0,  3812614789.0},
-  {3943380431.0,  1280837045.0,  1954739822.0,   777324040.0,  1446684354.0,  1195296331.0},
-  {2105395665.0,  2308219584.0,  2171205168.0,   616182061.0,  1569777252.0,  3354376403.0},
-  { 426183253.0,   476250528.0,  2057059195.0,  2233408776.0,   954304709.0,  1475408105.0},
-  {2028073212.0,  1636540757.0,  1519739600.0,  4145288914.0,  2867341344.0,  2084659620.0},
-  {  95628544.0,   231111315.0,   453324935.0,  2186847265.0,   485439079.0,  2271111630.0},
-  { 475704171.0,  3953112708.0,  2982117326.0,  4183997494.0,  1617335807.0,  2731174293.0},
-  {4094901153.0,  1371111253.0,   493641718.0,  1516197048.0,  1241446904.0,   373740418.0},
-  {  32722973.0,  4158133513.0,  2437027295.0,   591434220.0,  1931412866.0,  3615549377.0},
-  { 767154954.0,  3960566044.0,   281904084.0,  1254381532.0,  3030228609.0,  2196575083.0},
-  {4236300893.0,   288210211.0,  3033646852.0,  2081328346.0,  2203953442.0,  3800020759.0},
-  {3174824843.0,  3362850536.0,  2395247107.0,  3177493934.0,  2544783236.0,   702643247.0},
-  {2816564924.0,  3554137847.0,   343806682.0,  3951131694.0,  3097718047.0,   647780673.0},
-  {3240493506.0,  3761219993.0,   559688095.0,  1329780689.0,  3406500297.0,  2911238989.0},
-  {  67700781.0,  1409453539.0,  1328215239.0,  3549086975.0,   352117245.0,   660970322.0},
-  {2832380648.0,  3534971261.0,   637069795.0,    77684039.0,  3086426887.0,  3101792954.0},
-  {2343870745.0,  3225618513.0,   953833358.0,  2911862751.0,  1439242475.0,   770666569.0},
-  { 462917091.0,  3815473207.0,  2022302872.0,   512051077.0,  3726550599.0,  3553287490.0},
-  {3201173395.0,  4270813308.0,   409306316.0,  3569460346.0,  4255769308.0,  1746694224.0},
-  { 251487833.0,  2267660763.0,  3458946561.0,  2823128001.0,  1016343303.0,   110453002.0},
-  {2269079962.0,  2936012571.0,  1279756407.0,  1624420068.0,   765575941.0,   982464618.0},
-  { 906491520.0,  2937635406.0,  1075424345.0,   793742360.0,  3347253678.0,  2432260322.0},
-  { 175900848.0,  1264913395.0,  4055036659.0,   980829507.0,  4112598209.0,  1660707086.0},
-  {3108617497.0,  4074064566.0,   782991497.0,   869895459.0,  3202820292.0,  3312206117.0},
-  {2269079955.0,  2733520164.0,  4294288243.0,  2342939498.0,   399590759.0,   149085529.0},
-  {4150307385.0,  2710091399.0,  1310749621.0,   698216144.0,   832000497.0,  2190145965.0},
-  {3806199945.0,  3840929343.0,  2027828947.0,   440635423.0,  3809294867.0,  4112119091.0},
-  {4282225370.0,  2469315317.0,  3457691749.0,  3129901389.0,  1082836659.0,  4228595920.0},
-  {2360734803.0,   211685785.0,  3508078662.0,  3746820750.0,  1050477920.0,  2569841134.0},
-  {1934811659.0,  1740294986.0,  2787949658.0,  1006237014.0,   176116814.0,  3747810834.0},
-  {3318722358.0,  2527774643.0,  3521006639.0,   856700538.0,  1764060580.0,  3491133300.0},
-  {4047258851.0,  3931176788.0,  2987147664.0,  3888372653.0,   104193978.0,   430589726.0},
-  {1624692279.0,  3141583490.0,  2197093217.0,  3034471430.0,  1072596326.0,  2514208424.0},
-  {3250958919.0,  1919893178.0,  1864012433.0,  3573601847.0,  2738399122.0,   246326668.0},
-  {2165744782.0,  4129645042.0,  1719314779.0,  1209022018.0,  2804053529.0,  2557562793.0},
-  {2598978650.0,  3321801688.0,  2534088494.0,  3367173547.0,  1354460359.0,  3498863330.0},
-  { 391800366.0,  2880550362.0,   406205841.0,  2019869398.0,  3658534383.0,  3712623884.0},
-  {3496110180.0,  1430182567.0,   737137963.0,  3092391954.0,  4134785136.0,  3452186213.0},
-  { 775282021.0,  1626769905.0,  1831777187.0,  1532691621.0,  3593065272.0,  3580885846.0},
-  {2986348004.0,  2553718695.0,  3219688798.0,   481020763.0,   660801604.0,  3485144669.0},
-  {2648499389.0,  1588272346.0,  2980412780.0,  1951288798.0,  3245794588.0,   117903522.0},
-  {1345871275.0,  3680007277.0,   867944021.0,  2842819113.0,  1170635810.0,   682257529.0},
-  {1459569087.0,  2255200194.0,  2837720753.0,  2663411929.0,   195724297.0,  2552204766.0},
-  { 194539582.0,  2119029717.0,  1065456075.0,  1023266418.0,  1093224410.0,  1990118885.0},
-  { 813922283.0,  1853608302.0,   462509012.0,  2941732976.0,  1148166644.0,  2889879998.0},
-  {2723778619.0,  2377560179.0,  3521996439.0,  2990443104.0,  4200620777.0,   442619777.0},
-  {3965237725.0,   201383659.0,  3851835048.0,    43908185.0,  2739024784.0,  4277808250.0},
-  { 785766344.0,  3001009532.0,  2390970464.0,   660797470.0,  3325935362.0,   416644132.0},
-  {1805443387.0,  1100423789.0,  1031140412.0,  2302615280.0,  2951127326.0,  4163073762.0},
-  {1029575475.0,  1664990027.0,  1461200790.0,  2164719340.0,  2605697356.0,  2988261927.0},
-  {2338074803.0,  2504061826.0,  2950962372.0,  3838612126.0,    26686599.0,  2223210760.0},
-  {2390346364.0,  1245768019.0,   912056619.0,  4179687433.0,  4157038417.0,  4143057401.0},
-  {1519926170.0,  2656501636.0,  3136540082.0,  3351593505.0,  1815510867.0,  3151597520.0},
-  { 560800082.0,  2774877822.0,  4061139061.0,  1202165740.0,  2449321933.0,  3639674955.0},
-  { 305998075.0,  4249777410.0,  2648530812.0,  3215347344.0,  2813778204.0,  2576870163.0},
-  {1212062075.0,  2425828715.0,  3006689053.0,  4019030959.0,  4074781015.0,  1148173872.0},
-  {2456228901.0,   649490730.0,  3805183643.0,  4284344962.0,  3664469592.0,  3781755455.0},
-  {2806349151.0,  2230218806.0,  1085114944.0,  1144926343.0,  1272742413.0,  1569102399.0},
-  {2576571800.0,  4011133730.0,  4293379242.0,  1236548171.0,  1203192793.0,   551377264.0},
-  { 663720548.0,  1226326197.0,  1057540863.0,  3845398864.0,   380488339.0,  3861896260.0},
-  { 567752843.0,  4197111085.0,  1844938127.0,  1438280924.0,  2525477812.0,  1627278459.0},
-  {3636609121.0,  2368443154.0,  3064732627.0,  2182906457.0,  1918270053.0,  1806205500.0},
-  {3132333826.0,  2695453572.0,  3130869452.0,   340672726.0,   663883595.0,  1521755238.0},
-  {1190550793.0,  4030560248.0,  2861181097.0,  3282196306.0,  1788459431.0,  2808499035.0},
-  {3278091487.0,  1848744107.0,  3138220798.0,  1544714886.0,  1190978081.0,  2331229965.0},
-  { 157913651.0,  3240615098.0,  4179308888.0,  4160690445.0,  1157609413.0,  4080661293.0},
-  {1061281753.0,  1436330025.0,  1605606694.0,  2997533904.0,    60187700.0,  3437360600.0},
-  {2499396323.0,  1266146897.0,  2889456229.0,  3123404649.0,  2488687116.0,  3010476005.0},
-  {3444368640.0,  3467604074.0,   384175457.0,   949594241.0,  3146329179.0,  1050435120.0},
-  {4055252899.0,  3255758837.0,  3273127859.0,   399530484.0,  4177257178.0,  4030030465.0},
-  {3351432299.0,  3455985892.0,   264053456.0,  3607248627.0,  1517200217.0,    54143406.0},
-  {3308581440.0,   272552147.0,  3579883610.0,  1097085205.0,  4070327331.0,  3467928350.0},
-  {1806584468.0,   607855153.0,  2867586474.0,  3331061059.0,  3932879131.0,  3141158422.0},
-  {1734379244.0,   144584725.0,  1552648432.0,  1483303716.0,  1477465230.0,  2347993589.0},
-  { 934555704.0,  2227576295.0,  1302080544.0,  1970135724.0,  2594716992.0,  4268806881.0},
-  {1874689260.0,  1882591721.0,  3122126059.0,  2954185864.0,  4198044593.0,  2858043042.0},
-  {3420402995.0,  1206626637.0,  4093720414.0,  1566282829.0,   351550398.0,   103574671.0},
-  {4029403642.0,    10034884.0,  3814742527.0,  2369212405.0,  2016587647.0,  4250801863.0},
-  {2448937956.0,  2214435256.0,   627993480.0,  2698841053.0,   830460446.0,   695210943.0},
-  {2374994281.0,   423751071.0,  1744086363.0,  3938004718.0,  3278407003.0,  4114572694.0},
-  {3284042907.0,   873482141.0,  3485306313.0,  2121023967.0,   928433007.0,  2781839834.0},
-  { 587773655.0,  3621610137.0,  4179551789.0,  2368467886.0,  3672634784.0,   832703644.0},
-  {1394768711.0,  3464402751.0,  2678228112.0,  3691938470.0,  1943894795.0,  1888718163.0},
-  { 455615285.0,  3650329168.0,  1447921208.0,  4133461427.0,  2463547953.0,  2506917177.0},
-  {3831954249.0,  3578018595.0,  2103964053.0,   836354986.0,  4221599345.0,  1859082581.0},
-  {2853755116.0,     7442296.0,  1141729391.0,  3905355822.0,  3582310205.0,   940310566.0},
-  {1902793084.0,  1811831752.0,   770882200.0,   733649472.0,   590153048.0,  2273794870.0},
-  {3441062698.0,  2106150704.0,   142956248.0,   687732016.0,   397216443.0,  1644159995.0},
-  { 925765679.0,  4244930429.0,  3148811015.0,   725218501.0,  2155387076.0,  2061545097.0},
-  {2592292471.0,   784791060.0,  4225461652.0,  2430669441.0,  1047858704.0,  1279225990.0},
-  {2175258431.0,  3332401670.0,  1564303050.0,  1036620822.0,  1229224406.0,   401981811.0},
-  {3564655564.0,  3960732383.0,   300226480.0,  3066290209.0,  3555723143.0,  4198232664.0},
-  {4001749546.0,  1394783166.0,   732717170.0,   311371706.0,  4142499310.0,  2252371952.0},
-  {2813690963.0,   133708880.0,   663861476.0,  3358453748.0,   399670203.0,  1340232962.0},
-  {3000064350.0,  3580323033.0,  2412561427.0,  2302987992.0,  1278192156.0,  3437805628.0},
-  {3241151086.0,  3864113173.0,  3313160988.0,  2757384809.0,  1167586589.0,  3280230940.0},
-  {4133579400.0,  1887065086.0,   626193420.0,   133141392.0,   976277111.0,  3854716774.0},
-  {4089228694.0,  4195051535.0,  3798434904.0,  1563310051.0,  1881155284.0,  3392646027.0},
-  { 310671085.0,   425096531.0,  3885123529.0,  1229925769.0,   543771710.0,  2424698726.0},
-  {3622495822.0,   963444100.0,   503620777.0,   424606095.0,  1364647280.0,  1017103745.0},
-  {2637374212.0,    42944779.0,  1530318635.0,  2972686918.0,  2566542652.0,  3765896873.0},
-  { 317853171.0,  2683011942.0,  1375654578.0,  1891876768.0,  2164415717.0,  2263004518.0},
-  { 403523518.0,  3247617983.0,  1395206547.0,  1339903866.0,  1799688182.0,  3820618224.0},
-  { 816539193.0,  3282184867.0,  1417743569.0,  3801455634.0,  1473640169.0,   621877728.0},
-  { 392499376.0,   783939767.0,  2110913247.0,  4174420607.0,  2685155018.0,  2343249356.0},
-  { 165232083.0,   487490102.0,  1368596861.0,  3197082963.0,  1444685609.0,  1431334553.0},
-  {1017485690.0,  3916152561.0,   574847767.0,  4275278235.0,  1691847450.0,  2790656468.0},
-  {3393365698.0,  4207954011.0,  1606232462.0,  1375382828.0,  3642628535.0,  2547348825.0},
-  {1504183365.0,  3211366049.0,   854938135.0,  3514287130.0,    77428916.0,  3411863142.0},
-  {2212735888.0,  3227870156.0,  2612271720.0,    61035589.0,  1080441561.0,   911731343.0},
-  {3836066577.0,  4294858074.0,  3356070725.0,  3693713900.0,  2012129485.0,   958829040.0},
-  {  46850911.0,    73882199.0,  4118057530.0,  2262900573.0,  3246764565.0,  1284367250.0},
-  {3649307259.0,   755910393.0,  1967587953.0,  2876020673.0,  1077842806.0,  1528212967.0},
-  {3407435521.0,  1454298361.0,   966580029.0,  1469471875.0,  3848672391.0,  2705679842.0},
-  {3491296255.0,   866319524.0,   935142207.0,  1714425268.0,   734936156.0,  2447763891.0},
-  {3581392859.0,  3308577749.0,  1697268596.0,     1639087.0,  1979434668.0,  2255312160.0},
-  {3672809220.0,  1063048746.0,   238894597.0,  1975243690.0,  3680706510.0,   725018910.0},
-  {2576613108.0,  3943861744.0,  1679876745.0,  2135723606.0,   557263601.0,  4215792001.0},
-  {3313450927.0,  2145499664.0,  4255884965.0,   664504037.0,  3759697680.0,  2426898407.0},
-  { 217847067.0,  4109082343.0,  1220415205.0,     7956723.0,   526620318.0,  1031164141.0},
-  {1615304215.0,  2399608173.0,  1420594677.0,  2117590386.0,   134091251.0,  3050265199.0},
-  {3266390120.0,   407304877.0,  3723245586.0,  2820301320.0,   972669505.0,  3335837131.0},
-  {  47779199.0,  1827045126.0,   666442727.0,   171020159.0,  3465215211.0,  4199162086.0},
-  {2937142418.0,  2254955406.0,  1151786394.0,  4102540528.0,  1700759811.0,  1943053140.0},
-  { 511909914.0,  3114092983.0,  1043448789.0,  4273394590.0,   216187463.0,   255644497.0},
-  { 634975433.0,  3879061925.0,  4205035219.0,   408372840.0,  2720418974.0,  1027930214.0},
-  {2360364711.0,  2986576867.0,  2600454987.0,  2304130776.0,  3887638418.0,   334022651.0},
-  {3139014709.0,  2564854291.0,  1391136945.0,  3405035511.0,  3386928109.0,  3383928055.0},
-  {1462301666.0,  4138952036.0,  3198750967.0,  4109137425.0,  3759337494.0,  3867870360.0},
-  {3172187716.0,  1889519277.0,   712896719.0,   527235853.0,  1060776700.0,  1468758996.0},
-  { 658593572.0,  3983532948.0,  1561991830.0,  3438876810.0,   462145508.0,  1767522955.0},
-  {1703569491.0,  2152898411.0,    83065587.0,  4136771184.0,     9682471.0,  3105737726.0},
-  { 180296697.0,  2492989113.0,  3311323784.0,   460962921.0,  2087860448.0,  2227888310.0},
-  {2726976399.0,  2555665119.0,  1654421342.0,  3075757778.0,  3501052230.0,   130156079.0},
-  {1552647926.0,  4054693248.0,   909002860.0,   972934925.0,  3784342906.0,  2822748358.0},
-  {1480185312.0,  3197481965.0,  2759936375.0,  2695329503.0,  2572482252.0,   879622404.0},
-  { 263989595.0,  3257353123.0,  3540045738.0,  1575925900.0,  1358523682.0,  1857244774.0},
-  {1501708656.0,  3848105603.0,  4127759126.0,  3283789851.0,  1034504495.0,  3956258512.0},
-  {1602618558.0,  1625462884.0,  4000965668.0,  2293284611.0,  2443153275.0,  3520568997.0},
-  {2401560229.0,  3593526047.0,  3612004120.0,  4124015046.0,  3031656102.0,  2520117093.0},
-  {2885459852.0,  3591433229.0,  3157919186.0,  3394304536.0,  1675528354.0,  1285690369.0},
-  { 957061703.0,   791525457.0,   425431062.0,  3552508014.0,  2168770898.0,  2577351643.0},
-  {4193579889.0,  2993089329.0,  2784924266.0,  1857494390.0,  4041742672.0,   471787987.0},
-  {2166421454.0,  2229188002.0,   647368441.0,  2862884835.0,  2771222030.0,  3632142312.0},
-  {2992851242.0,  3840461682.0,  3456402132.0,   316698594.0,  2202646609.0,   180669275.0},
-  {1845876445.0,  3727275716.0,   978834946.0,  2707647927.0,  2541451538.0,  1524646501.0},
-  {2781313495.0,  3760213283.0,  2145730883.0,  3545584342.0,  1733481589.0,  3492420958.0},
-  {1447041085.0,  4139413245.0,  1441782833.0,  1438668657.0,  3364805445.0,  2687827857.0},
-  {3776616445.0,  2647468373.0,  2054072992.0,  2574096111.0,   707138868.0,   389276747.0},
-  {2044231856.0,  4183440860.0,   280227350.0,  3526259690.0,  1366575440.0,  3393389261.0},
-  { 113222309.0,  3300325992.0,   452155630.0,  1657849595.0,   689455903.0,   640686909.0},
-  {1082353307.0,  2786783025.0,  3448059472.0,  1113916370.0,   417235957.0,  2335056995.0},
-  { 397877152.0,  1054750399.0,  2854279874.0,  2863411095.0,  4134071851.0,  3303902266.0},
-  {3103242480.0,   129087174.0,  1691549976.0,   921303566.0,   812537880.0,  2031819537.0},
-  { 914542466.0,  3750931417.0,   140766023.0,  4167461885.0,  3702623826.0,    37799212.0},
-  {1022922499.0,  4254667169.0,  3055888820.0,  2486563342.0,   446932612.0,  3061260201.0},
-  { 631040451.0,  3942465080.0,  2339924743.0,  3983935343.0,  3347745458.0,  1000899355.0},
-  { 541810788.0,  1736853402.0,  3157073555.0,   898167563.0,  2586355964.0,  1693804799.0},
-  { 517422833.0,  2389675612.0,  3078519450.0,  3452490875.0,  2437020102.0,  2475276844.0},
-  {2872081572.0,  2405805743.0,   583865341.0,   259405867.0,  2603151127.0,   859904264.0},
-  {1286567138.0,  2789388184.0,  1725822974.0,  4171781793.0,  2010184724.0,   257214130.0},
-  { 387118989.0,  1882523754.0,  3205527014.0,  3619829235.0,  1155518160.0,   461720052.0},
-  { 940251236.0,  1515561087.0,  3246770983.0,  2539490392.0,   797901990.0,   861567958.0},
-  {3238394891.0,  2543164728.0,  2115321619.0,  2310591508.0,  3898606463.0,  2679122180.0},
-  {2632668058.0,  1166388220.0,  3312308198.0,  1580666781.0,   850364070.0,  2326451615.0},
-  {3970334353.0,  2730647589.0,  2313287445.0,  2604311514.0,  1496778671.0,  2504509987.0},
-  {1263942246.0,  1470069678.0,  1777560160.0,  3019090968.0,  1850335339.0,  2453206051.0},
-  {1458869308.0,  2560900457.0,  3351087457.0,  2821987891.0,  2361157354.0,  3051193907.0},
-  { 692033171.0,  4152432213.0,  3948057894.0,  1254760360.0,  3060636984.0,  2042859732.0},
-  {3039022090.0,  3516958455.0,  1990393192.0,  2497026102.0,  2191641045.0,   691469449.0},
-  {3125579682.0,   626244164.0,  2246000539.0,  1820078006.0,  4089488349.0,  1433684051.0},
-  {1063641111.0,  2563014587.0,   327380352.0,  4133078312.0,  3253962195.0,  1955044791.0},
-  {1104611732.0,  1210940004.0,  1103142828.0,  3819068160.0,   233820374.0,   832301335.0},
-  {1628844373.0,   896712195.0,  2367112248.0,  2222350999.0,  1392012153.0,  2458139335.0},
-  { 143576366.0,  1652835725.0,  3550790435.0,  3990147085.0,  1570221352.0,  2318603672.0},
-  {3616022718.0,  2586457924.0,  1424971197.0,  3807753648.0,   485274834.0,  1684296777.0},
-  {3709266605.0,   481457077.0,  1859298345.0,  1870125595.0,  3443195803.0,  1821314194.0},
-  {2599749626.0,  1521488706.0,   532980394.0,  1515630543.0,  2251282955.0,  2653017028.0},
-  { 726004788.0,  1638824031.0,    44681377.0,  1967402633.0,  3437962468.0,   235154296.0},
-  {1453784824.0,  2624092831.0,  4119195676.0,  2351179702.0,  2469290251.0,  3373701629.0},
-  { 679840065.0,  3351686991.0,  1728301356.0,  2329266280.0,  1103190207.0,  3143031408.0},
-  {2452878923.0,  1780136501.0,  2721692042.0,  1931477024.0,  3247350352.0,   697647556.0},
-  {1335829358.0,  1613894278.0,  1584430523.0,  3103478589.0,  2023973395.0,   439416430.0},
-  {2761008767.0,   194942734.0,  3141828413.0,  3866604032.0,  3239680361.0,  2038780812.0},
-  {3219516759.0,  1504053559.0,  2165674721.0,  3845714213.0,  4234654707.0,     7817849.0},
-  {1977669046.0,  1696743793.0,  2780767507.0,  1868534719.0,  3156821672.0,  3673620145.0},
-  { 126418590.0,   356066633.0,   338016572.0,  2123882403.0,   198319345.0,  4041439150.0},
-  {1312250086.0,  1169651897.0,  1140528677.0,   117653527.0,  3103174182.0,  1196539115.0},
-  {1100339945.0,  2379275863.0,   102028357.0,  4084184850.0,   844863519.0,  1560573487.0},
-  {2288423226.0,    21612921.0,  3517225840.0,  3744823781.0,   796565070.0,  4105038800.0},
-  {2903924046.0,  1953976942.0,  2396995900.0,  2268250101.0,  3764385024.0,   672772433.0},
-  {1140658751.0,  1960088733.0,   832399662.0,  1800810211.0,  2414153005.0,  2586744526.0},
-  {4273739308.0,  3900463576.0,   603042987.0,   916075709.0,  1469823075.0,  1835810148.0},
-  {2083209429.0,  2387470270.0,  1021220254.0,  3056313707.0,  1315543034.0,  1857426461.0},
-  { 626240634.0,  2862672630.0,  3078102966.0,  2403846234.0,  1786081249.0,  1145088313.0},
-  { 427426498.0,  3154781234.0,  2305503089.0,  4119640703.0,  3754888235.0,   520251375.0},
-  {3986946183.0,  1862597787.0,  1615808378.0,  1435447276.0,  2241860909.0,   753258166.0},
-  {3284931223.0,   730669955.0,  2289133483.0,  2001950244.0,  2040863924.0,  2870931600.0},
-  {3643355188.0,   464054260.0,   830951337.0,  1970170753.0,  4010187001.0,  2978622332.0},
-  { 116940172.0,   512390886.0,  4248578145.0,   340265102.0,  1494056745.0,  2859602919.0},
-  {3332569063.0,   485200535.0,   717179171.0,  1353928117.0,  3946290135.0,   386021347.0},
-  {  40572058.0,  2019286964.0,  3993810439.0,  3629479519.0,  2925345162.0,  2093512815.0},
-  { 823976493.0,   308229575.0,   215950663.0,  3452802903.0,    14222634.0,   959270640.0},
-  {3358689789.0,  2793111925.0,  2855324891.0,   217046036.0,  2156264215.0,   100909363.0},
-  {1484969156.0,  2835374654.0,  3241110774.0,  2076099730.0,   609954663.0,  3275596742.0},
-  {  20980073.0,   213895919.0,  2157864859.0,  1283264892.0,  2425081140.0,   651840023.0},
-  {2913791445.0,  2681281941.0,  1139827273.0,   409802535.0,   378568123.0,  2809755750.0},
-  {2319920682.0,  3619417700.0,  2284953804.0,   246122448.0,  3089057197.0,  1252664824.0},
-  {4258120651.0,   593457981.0,  3626568702.0,  3759273999.0,  3074237520.0,  2681261396.0},
-  {3281384457.0,  2145217565.0,   335874668.0,  1387401888.0,  2224762168.0,  2893724064.0},
-  {3381399169.0,  1316453399.0,   675242336.0,  3271942151.0,  2403638901.0,  3725240437.0},
-  {3344756055.0,  3040573989.0,   492809226.0,  3536379364.0,  1543566103.0,  2876698622.0},
-  {1264657349.0,  1850940530.0,  1012305753.0,  4283916324.0,  4200564615.0,  3163810490.0},
-  {1602648756.0,  2652959761.0,   925928538.0,  1247699108.0,  2988193869.0,  2290493570.0},
-  { 977629837.0,  1581463867.0,  3329769727.0,  3289573708.0,  3451191232.0,  3535484469.0},
-  {3398758901.0,  2368003710.0,  3449275769.0,  1599113851.0,   741832592.0,  2370037868.0},
-  { 973639300.0,   236757899.0,  2148033305.0,  3423892233.0,  1929771773.0,  2669787837.0},
-  {2606323677.0,  3643238326.0,  4152699413.0,  1676020073.0,  2395113257.0,  4142517173.0},
-  { 627984697.0,  1727991657.0,  2170028071.0,  2298847759.0,  1306315932.0,  3390279885.0},
-  {1788622567.0,  1343841354.0,  2416990800.0,  4080671444.0,  1762643996.0,  2645648441.0},
-  {1277235263.0,  2810180594.0,  3251750604.0,  4003684882.0,  2600822433.0,  2611302129.0},
-  {3579636785.0,  3074952419.0,    76953781.0,  2877012956.0,  2047627744.0,   874282477.0},
-  { 176504799.0,  1696120068.0,  1913734599.0,   584213464.0,     4300179.0,  1722857549.0},
-  {2288599452.0,   735142398.0,  2822605191.0,  1476281720.0,  3544118351.0,  4218551024.0},
-  {  84517151.0,   906498984.0,  1329021922.0,   766276083.0,  3942691538.0,  3108788483.0},
-  { 879280961.0,  2418883943.0,   914694947.0,  2269232480.0,  3672527032.0,  2772711548.0},
-  {  49368786.0,  2359417940.0,  1206360428.0,  2132962000.0,   624594571.0,  2830769174.0},
-  {2739474765.0,   294776444.0,  3588990197.0,  2040144341.0,  1932044650.0,  3551505135.0},
-  {2621430607.0,     3245788.0,  4104139032.0,  3684193793.0,  1827766387.0,  2915196354.0},
-  {4055860156.0,  2605626311.0,  1735103250.0,  2465245565.0,   646303467.0,  3869844262.0},
-  { 712044221.0,  3775311218.0,  3980577629.0,  2069327543.0,  3398087785.0,   856926052.0},
-  {2612795932.0,  2475442306.0,  1088924369.0,  1950843803.0,  2624151566.0,  4285204083.0},
-  {3774341249.0,  3206710703.0,  1724176558.0,  1773620891.0,  2660020845.0,  1700045356.0},
-  {1733512469.0,  2173306475.0,  1619062721.0,   312790104.0,  2466461936.0,  1908512107.0},
-  {4127862180.0,   669912277.0,  4174420453.0,  2895376887.0,  1371163486.0,   586014306.0},
-  {3888930367.0,  1211896413.0,  1522477899.0,  4008913246.0,  2180509512.0,  3688683307.0},
-  {3336523647.0,  3394146910.0,  2408660657.0,   226933434.0,  2879060791.0,  1122129894.0},
-  { 634375542.0,   322547344.0,  2396966104.0,  3849125244.0,   174103107.0,  3686405989.0},
-  {1023533506.0,  2794794985.0,  3800756338.0,  2663292061.0,  1317072930.0,  1928113305.0},
-  {1881653239.0,  1479687217.0,  1142681495.0,  1592567294.0,  1070315870.0,   991532504.0},
-  { 196726016.0,  1963425163.0,  1561369817.0,  2540135418.0,  1762898769.0,   519859683.0},
-  { 819603448.0,   403335199.0,   604175073.0,  1814810635.0,   685579656.0,   905466355.0},
-  {3354672364.0,   606150182.0,   687665113.0,  1120041140.0,  1227615629.0,   641066098.0},
-  {1132732548.0,  3641245586.0,   479655590.0,   488448286.0,  2775410072.0,  2639597676.0},
-  {3293397734.0,  3852741835.0,  3280898618.0,  1916076420.0,  2495031703.0,  4016618735.0},
-  {2249929038.0,   404729158.0,  1573978806.0,   269394850.0,  2843345148.0,  2079884246.0},
-  { 639273429.0,  3200009808.0,   163242692.0,  2962851039.0,  4102859732.0,   137720668.0},
-  {4220822992.0,  2571281666.0,   615285499.0,   689476507.0,  1228137211.0,  3484207157.0},
-  { 327397702.0,  2589411965.0,  2149792278.0,  2524183827.0,  2066787545.0,  3203017872.0},
-  { 435902570.0,  3716315274.0,   227203018.0,   894655827.0,   473640732.0,  1971042904.0},
-  {3927835844.0,  3647353155.0,   539181108.0,   618932075.0,  1397720191.0,   432631341.0},
-  {  41325100.0,  2268048102.0,  2392926712.0,  1102824043.0,   886486367.0,  1276579371.0},
-  {3566825124.0,  1048632522.0,  3038499757.0,  2231983965.0,  1187769404.0,  2234810449.0},
-  {2229627289.0,   491492904.0,  3032861785.0,  1488261718.0,  3895840951.0,  1706216479.0},
-  { 584815002.0,  3958526457.0,  1844013415.0,  1062017305.0,   471439646.0,  1207638707.0},
-  {1334428427.0,  3138905224.0,  2188569971.0,  2756372444.0,  1621698126.0,  1776535502.0},
-  {1389358468.0,  2149462010.0,  2336365564.0,    88370713.0,  2735968967.0,  3843322529.0},
-  {1904601350.0,  1387891278.0,  1530300994.0,  4292328929.0,  2516107613.0,     5166700.0},
-  { 451211000.0,  2815237931.0,  2106259866.0,  1910172518.0,  3240413856.0,  3630448967.0},
-  {3787149264.0,  2034723734.0,   501141782.0,   454346399.0,  3576222513.0,  1426237959.0},
-  {1959154691.0,  2573728388.0,    82972904.0,  2706109150.0,   932280687.0,  1012939132.0},
-  { 635408226.0,   211715956.0,  1380283247.0,  2476028698.0,  1430101210.0,   620966036.0},
-  {3015435570.0,    35840664.0,  1436070057.0,   968313758.0,   123697609.0,  3258203656.0},
-  { 877692777.0,  2136725624.0,    69511596.0,  1378106532.0,  1654977697.0,  4134808480.0},
-  {  90348520.0,  1486469553.0,  3773541942.0,  1626402088.0,  1628873156.0,  1186730401.0},
-  { 159659690.0,  1846216778.0,   995644325.0,  3067711513.0,  2025006494.0,  2898160853.0},
-  {2597211441.0,  1041335364.0,   931229542.0,  3737347078.0,  1482318587.0,    64023174.0},
-  {4267628624.0,  3671753474.0,  1209254215.0,   467101657.0,   345291559.0,  2347762125.0},
-  {1069489643.0,  2838559998.0,  1255044602.0,    53672625.0,  1335842403.0,  2864217853.0},
-  {2249870121.0,  3192756346.0,  2458423606.0,  1816217859.0,  2874119618.0,  3514483016.0},
-  {1481742271.0,  3625002501.0,  4136292831.0,   698192424.0,  1430316159.0,  1409541753.0},
-  {3055147613.0,  1525514302.0,  3388952720.0,  2577963447.0,  2362843660.0,  2089196901.0},
-  {1981124833.0,   941108613.0,  2823823004.0,  1117214568.0,  1898426561.0,  4211934657.0},
-  { 545456398.0,   556141690.0,  4287303707.0,  4057588786.0,  1095419920.0,   374708168.0},
-  {2973967010.0,  3054624577.0,  1176386472.0,   493548528.0,  3632802404.0,   355720548.0},
-  { 230111532.0,  1271175843.0,  3588395409.0,  2897017329.0,  2637748713.0,  4081562811.0},
-  {  58811575.0,  1777837475.0,  2373010508.0,  4127715193.0,  1491710910.0,    10867075.0},
-  {4015913624.0,  3610489023.0,   939976709.0,  3719881127.0,  1627681029.0,  2711486511.0},
-  {2974782878.0,  2369096469.0,   681412800.0,  1154043145.0,  3340112267.0,  2227785652.0},
-  {3071716729.0,  4286519908.0,  2570648781.0,  3850185760.0,   951019084.0,  3891472356.0},
-  {1347407110.0,   131317171.0,   784788683.0,  3523110012.0,  3232173272.0,  3835949380.0},
-  {3070684863.0,  2331054173.0,  3249469930.0,   463302616.0,  1355387480.0,   541237221.0},
-  {2908053511.0,  3741447109.0,  3269690380.0,   489054072.0,   728343149.0,   799538494.0},
-  { 663785398.0,  3772364275.0,   800994282.0,  4095849393.0,  4178290474.0,  1659943289.0},
-  {2880415465.0,  3768054988.0,  3619470295.0,  2532003096.0,  2302956581.0,  1465986007.0},
-  {3817591510.0,   574074886.0,  3209810270.0,  2074418517.0,  2698404091.0,  2965518771.0},
-  {1598356537.0,  3114719613.0,  2682408871.0,  3872299008.0,  3588628017.0,  2691646359.0},
-  {2603734140.0,  2742849194.0,   685026587.0,   788875517.0,  1127381583.0,  1924089022.0},
-  {1601787253.0,  3323064040.0,   590075257.0,  2657752589.0,   844982400.0,  3358622289.0},
-  {1174596310.0,  2638448726.0,  2897640884.0,    63681190.0,  3708770502.0,  4025223385.0},
-  { 505512332.0,  2986825399.0,   621079090.0,  2185128981.0,  1927423060.0,  4064529161.0},
-  {3546891799.0,  1964082072.0,  3602982421.0,  3629269794.0,   467746327.0,  1732664120.0},
-  { 743631412.0,  2702572524.0,  3442930257.0,  3811373050.0,  2877379493.0,  2219931853.0},
-  {3524067828.0,   439842362.0,  2583663166.0,  2813794937.0,  4116620856.0,  2272252658.0},
-  {2213494467.0,  1818277339.0,  2287189655.0,  4006762399.0,  1415796564.0,  4200403495.0},
-  { 467835752.0,   233601637.0,  1002732150.0,  3018158686.0,  2271203625.0,  1855112548.0},
-  {3478638528.0,  3589434850.0,   176508396.0,  1028578671.0,  2419712337.0,  1774120532.0},
-  {3135916958.0,  1854584072.0,   779171636.0,  3137520694.0,  2691904177.0,  1483304699.0},
-  {2359945449.0,  2280005866.0,  3506406958.0,  2346263716.0,  2325000737.0,   538899380.0},
-  {1982430821.0,  2105754651.0,  3178503723.0,  3309328162.0,  1098783519.0,  2840766482.0},
-  {2190017540.0,  1573363677.0,  1930569150.0,    54465437.0,  4017098756.0,   229375975.0},
-  { 135579857.0,   679624469.0,   182411196.0,   896060689.0,   449022716.0,  1230081497.0},
-  {4111788603.0,   768404696.0,  2147803981.0,  2109183347.0,  2226431062.0,    24489412.0},
-  {1589841842.0,  1241548534.0,  2016223461.0,  3631778326.0,  1906911631.0,  1402579416.0},
-  {3418184154.0,  2955263952.0,  3695973753.0,  1141198771.0,  2867253266.0,  1247587857.0},
-  {1748542006.0,  1161043442.0,  3642254249.0,  1838932045.0,  1648148699.0,   892967710.0},
-  {2532275287.0,  3520803170.0,  1714022270.0,  4109642903.0,   134167758.0,  3373071719.0},
-  {2153963981.0,  1528617084.0,  3855163419.0,  3099760787.0,  2442902232.0,   796455980.0},
-  {1001021345.0,  2685698914.0,  1313173499.0,  1440960381.0,  2807229807.0,  2791289757.0},
-  {1341365923.0,  3054388505.0,  3531914039.0,  4163292976.0,  4199182002.0,  1756998342.0},
-  {1913236535.0,  1653814254.0,  1434521038.0,  1815129806.0,  3011731685.0,  3154032624.0},
-  {3794347376.0,  1300739229.0,   911477665.0,  3155562717.0,  4117617068.0,   715623012.0},
-  { 601031764.0,   105802738.0,  3050411022.0,  4024668925.0,  1419821686.0,  2475104473.0},
-  {2570345643.0,  3547128098.0,  4221545311.0,  1502705717.0,  2445785937.0,   933497926.0},
-  {3157998290.0,  3112076023.0,   495936925.0,  1769984088.0,  2712034937.0,  2636019998.0},
-  {4073255715.0,  1809334860.0,   120117260.0,   507216885.0,   194741107.0,  3908704150.0},
-  {2217678037.0,   951019899.0,  1887756625.0,   703341206.0,   728401754.0,  2184022953.0},
-  { 130433854.0,  2275066115.0,  2079593684.0,  3634354807.0,  4157349762.0,  2349392933.0},
-  {1712956330.0,  3713673372.0,  2348874481.0,   386281045.0,  3948785018.0,  2449894159.0},
-  {3274446208.0,  3387270816.0,  2923287260.0,  1387429601.0,  2272198225.0,  3503978946.0},
-  {1065424548.0,  3319617967.0,  2328830599.0,  3163276941.0,  3773324031.0,    29321149.0},
-  {3130402875.0,  4189582082.0,  3574858813.0,  2829286137.0,  3213462104.0,  2319614029.0},
-  {  28879488.0,  1823198431.0,  2336657011.0,  1431250480.0,  1181142413.0,  4029113336.0},
-  {2820444255.0,  2235906512.0,  4055227951.0,  3614756903.0,  2679733812.0,  1422163861.0},
-  {3634012233.0,  1930574063.0,  3453687017.0,  2373619767.0,  3861622627.0,   918899546.0},
-  {2386716808.0,  1608967550.0,  3811029449.0,  1614842453.0,  3437055440.0,   816308423.0},
-  {3324535852.0,  3395675926.0,  3738827448.0,   903514409.0,  4267976658.0,   859873213.0},
-  {1369876458.0,  3133255560.0,  4268970486.0,   947392094.0,  4218189479.0,  3968358820.0},
-  {3525320434.0,  2082582160.0,  1532863412.0,  1228161948.0,  1130483553.0,  1389901380.0},
-  {4173973210.0,  1595931112.0,  1667884517.0,   644275199.0,   736252390.0,  4148655662.0},
-  {1870930208.0,  3595382574.0,  1650688663.0,   432672696.0,  4050188119.0,   969094305.0},
-  {2394306305.0,  3657871437.0,  2214183324.0,  4038480847.0,  3525253706.0,  2637767857.0},
-  {1120237087.0,  1208850604.0,  2638356534.0,  2970041781.0,  2051177067.0,  1828219254.0},
-  { 513640352.0,  1597801268.0,  3872343043.0,  1955055821.0,  2937407525.0,  1352953426.0},
-  {4090962461.0,  3662026595.0,  2328539603.0,  3916118684.0,  2385089508.0,  1738904063.0},
-  {2757714890.0,    49085619.0,  3596089321.0,  2109387695.0,  4135457394.0,   929352907.0},
-  {1272614665.0,  1230404847.0,  3609142432.0,  2296307496.0,  2047816031.0,  3655314916.0},
-  {2937858322.0,  1270886707.0,  1030977210.0,  2617264079.0,  2368105533.0,  2868619140.0},
-  {1622643853.0,   633993008.0,  1751301246.0,  2038545509.0,  3196707903.0,  3896022865.0},
-  {3757345938.0,  4174434955.0,  3836157037.0,   858185563.0,  3379160320.0,  3193275724.0},
-  {1842232008.0,   385760467.0,   594775006.0,  1303058980.0,  3205154109.0,  1414260765.0},
-  {2558268663.0,  3349412907.0,  2616262629.0,  3757989007.0,  2953403374.0,   311012265.0},
-  { 459275592.0,  1285262636.0,  3736352834.0,   892038880.0,  3156679673.0,  2690103345.0},
-  { 846948786.0,  3649578135.0,   406027104.0,   547231770.0,   393386909.0,   892206745.0},
-  { 808326428.0,  3923929242.0,  1617657628.0,  3389623123.0,  2218565781.0,   721520111.0},
-  {1189523988.0,  2521610785.0,  3640539070.0,   149280979.0,   826485375.0,  4061636026.0},
-  {3846760995.0,  1129580337.0,  3416018013.0,  1146491932.0,  1818086291.0,  1511583015.0},
-  {2770291678.0,  1764353267.0,  1707861784.0,  1504753529.0,  1911484250.0,  3474822918.0},
-  {2585888767.0,   809324312.0,   193412804.0,  2980471525.0,  1750441437.0,  4159294812.0},
-  { 414895546.0,  3752594901.0,  3789933176.0,   596957679.0,   610180122.0,  3478315637.0},
-  {3871267952.0,  4242887742.0,  3236444540.0,  1536666355.0,  3523601749.0,  1635036587.0},
-  {4042573091.0,  4142921104.0,  1477398935.0,   107352288.0,  1659872138.0,   883835875.0},
-  { 639472420.0,   997246351.0,  1409349357.0,  2104356472.0,  1611685666.0,  2412194553.0},
-  {1442892786.0,  3345540043.0,  3000910356.0,  1115804150.0,  2887131928.0,  3262147167.0},
-  {3382826149.0,  3931202851.0,  1514821785.0,   114508268.0,  3395963103.0,  1429540707.0},
-  {2255631667.0,  3886972947.0,  3686442970.0,  2289787580.0,  1266816337.0,   613509574.0},
-  {2471227565.0,  1828743349.0,  1763914395.0,   612688691.0,    94214661.0,  1153955368.0},
-  { 330448869.0,  2559540994.0,  2731332843.0,  1440498488.0,  4171679755.0,  4011854209.0},
-  {2670649126.0,  3384760997.0,  3032596287.0,  3431200121.0,   756373893.0,  1187154302.0},
-  {1103991674.0,  3810264747.0,  2317735311.0,  1201576456.0,  3907945796.0,  3878150044.0},
-  {3311016889.0,  1002261392.0,   789159190.0,  2880735409.0,  1593575575.0,  2999919892.0},
-  {3585100871.0,  3920917021.0,  3205302416.0,  3264505234.0,   492137408.0,  3246011204.0},
-  {1834002276.0,  1987385083.0,   855365138.0,  3758732392.0,   260735369.0,  2545374350.0},
-  {4049617724.0,   610657088.0,  1696925814.0,  2280424602.0,  2758017833.0,   770118073.0},
-  {3558544126.0,  2875435121.0,  4111044776.0,  2691714471.0,  3448401897.0,  2942377456.0},
-  {2571327202.0,  2397303925.0,  3302289558.0,  1543653594.0,  1756141018.0,  2547954339.0},
-  {2219330952.0,   369301476.0,   686189188.0,  1418403377.0,  3583831641.0,   874574089.0},
-  {1362583331.0,   379511824.0,  1159975086.0,  3708291290.0,  2326860826.0,  2156018824.0},
-  {2205465287.0,  1613550588.0,  3786231383.0,   317291434.0,  3241472320.0,  2068514097.0},
-  {2083645388.0,  2048552388.0,  2624250311.0,  3533931357.0,    10284472.0,   948607572.0},
-  {3119551251.0,  1056123407.0,   179924722.0,  2923609565.0,  2435473458.0,   848068002.0},
-  {4250351621.0,  3393317801.0,  2779591151.0,  3992637146.0,  3139951630.0,  2312734163.0},
-  {2799820182.0,  1192227067.0,  3770193335.0,  3955557501.0,  4191525945.0,  3059784903.0},
-  {4144088999.0,   806067635.0,  1781855316.0,  4035534401.0,   949981848.0,  1276438213.0},
-  {2317703084.0,  2543786053.0,  2397688085.0,  2790182563.0,  2265370403.0,  3875964018.0},
-  { 254942767.0,  2174921975.0,  4119791100.0,  4257102140.0,  2679833682.0,  2249250516.0},
-  { 940913674.0,  1525538350.0,   283057976.0,  1007757166.0,  3200300276.0,  3204397892.0},
-  {1990676840.0,   657582939.0,   273446523.0,  2292942275.0,   801226845.0,  2008151945.0},
-  { 122494711.0,  1558419187.0,   300268877.0,   816484083.0,   742668350.0,  2672761383.0},
-  {3801642039.0,  2782802635.0,  3034666495.0,  1119625997.0,   847471846.0,  3532296312.0},
-  {4094325409.0,  2610834585.0,   976078503.0,  3300270874.0,   370116220.0,  2835887224.0},
-  {2496521195.0,  2015156087.0,  1870679973.0,  1548486949.0,  1844051861.0,  1135861416.0},
-  {1360425591.0,  4290138389.0,  1253911917.0,  1026729401.0,  2812286247.0,  3672967631.0},
-  {2937771265.0,  4075059984.0,  2382727537.0,  2576137775.0,  1388388315.0,   195792410.0},
-  {2006604243.0,   784889079.0,  3995948708.0,  2853556591.0,  1998961140.0,   380454925.0},
-  {2942287240.0,  1171067186.0,   940210597.0,  3951537547.0,  3664883154.0,  2607298913.0},
-  {2131491015.0,  3367032542.0,  1291187851.0,  2694884038.0,  3153124494.0,   485462689.0},
-  {2532011893.0,  2222772195.0,   938235925.0,   450748198.0,   827220472.0,  1005653212.0},
-  {3471077996.0,  2715457308.0,  2013637700.0,  3510266219.0,  3697259716.0,  2838466380.0},
-  {2805571935.0,  4175459439.0,  2443278225.0,  1156438452.0,  1048028710.0,  1445285058.0},
-  { 165915417.0,  1003798662.0,  4158693849.0,  2173666000.0,  4222719233.0,  3651847485.0},
-  { 751125379.0,  2680584841.0,  3391563831.0,  2638947198.0,  2319638388.0,  3148767014.0},
-  { 778216919.0,  2870325922.0,  2445230704.0,   318758092.0,  1973902159.0,  3153660268.0},
-  {3835787726.0,  3484893522.0,   955610338.0,   652948912.0,  2334155276.0,  1243570278.0},
-  { 754832419.0,  2761633568.0,  3040979581.0,  1193506471.0,  3236248003.0,  2036712312.0},
-  { 454502744.0,  3365924731.0,     6939474.0,  4010804715.0,  4262813206.0,  1088892133.0},
-  {4185903687.0,  2724780562.0,  1247454016.0,   648756000.0,  2900994769.0,  1719769273.0},
-  {3165295308.0,   644859998.0,  2519707243.0,  2557328013.0,  3220073456.0,  4014827107.0},
-  {1616981521.0,  3304876967.0,  1442111018.0,  1045120447.0,  3704781147.0,  3893039422.0},
-  { 469119303.0,  2303872799.0,    35239466.0,  3279729391.0,  3105508930.0,  2715329921.0},
-  { 384105220.0,  2841661407.0,  1765145070.0,  1858635829.0,  2984762978.0,  1240788208.0},
-  {  31604300.0,   371030384.0,  4231519855.0,   431726905.0,  1426829776.0,  1015781194.0},
-  {1395776263.0,  1882881394.0,  4133311916.0,  4069196424.0,   309396895.0,  2293726207.0},
-  { 782427611.0,   577840131.0,  4119211509.0,   922228412.0,   261918180.0,  2167728907.0},
-  { 130789978.0,  3004143052.0,  2032043327.0,  3938943514.0,  1562452879.0,  3975959333.0},
-  { 807085963.0,   746421128.0,  1303963716.0,  1010335158.0,  1614685183.0,  2248668746.0},
-  {3424991115.0,   947169730.0,  3799729554.0,  3136791992.0,  2860584662.0,  1255243762.0},
-  {3843169584.0,   298301589.0,  1332650527.0,  2411531199.0,  3273548099.0,  2488781510.0},
-  {2368293953.0,  3211476517.0,   610285769.0,  3602821241.0,  1380513795.0,   597864088.0},
-  {1713534501.0,  1436634422.0,   811416322.0,  1897030865.0,  2999153494.0,  2746320011.0},
-  { 854785003.0,  4292666985.0,  3547235759.0,   484562909.0,  2190363696.0,  3079231548.0},
-  {4140786771.0,  4227233141.0,  4285548592.0,  1523574539.0,  3177233406.0,  3569625082.0},
-  { 959599231.0,  2449336213.0,   924529449.0,  4002933879.0,   209149229.0,  1937253251.0},
-  { 764506813.0,  2917551605.0,   388673805.0,  3225659952.0,  3358087602.0,  3512906619.0},
-  { 732990533.0,  3788535193.0,  4034544155.0,   276697794.0,   998295415.0,  2495732073.0},
-  { 324057754.0,  2188681981.0,   122474557.0,  2194877762.0,  1818491033.0,  4188406440.0},
-  { 349403136.0,  3172312881.0,  2964411152.0,  3812875869.0,  1912239061.0,  3047109684.0},
-  {4266507256.0,  2650583596.0,  4187647785.0,   908679242.0,  2601050638.0,  2886229592.0},
-  {2379050523.0,  1327255860.0,   746383056.0,  2090334192.0,  1877222373.0,   510897144.0},
-  {2539126624.0,  3868574945.0,  2830270587.0,  1949356041.0,  1040964745.0,   695192494.0},
-  {2882158414.0,  1627480004.0,   916151738.0,  3293889272.0,   517987741.0,   977890006.0},
-  {2581378138.0,  3324860267.0,   928929128.0,  3332575712.0,  2942904591.0,  4226109726.0},
-  {1771537612.0,  2687441719.0,   388221332.0,   760663940.0,  1611388232.0,   709999522.0},
-  {2032201018.0,  1586274056.0,  1588256539.0,  1860616301.0,   765681796.0,  3206901949.0},
-  {2025647229.0,    51002363.0,  1822299878.0,  1760247183.0,  3504190582.0,  2625432905.0},
-  { 163861727.0,   341279554.0,  3234601713.0,  3322452586.0,   236144155.0,  3899555534.0},
-  {3123325919.0,  4095048304.0,  2782827427.0,  3994220351.0,  3553239150.0,   735562868.0},
-  { 155618598.0,   509682903.0,   133205552.0,  1171607591.0,   765120387.0,  3530681061.0},
-  {2725789044.0,  1581645381.0,  1888946320.0,  1272212209.0,  1718127657.0,  1554694050.0},
-  {4068162219.0,   764373912.0,  4184897174.0,  1245136675.0,  3711717950.0,   643437100.0},
-  { 580044386.0,  3567359633.0,  3666043855.0,  3876055404.0,  1709082376.0,  1182094828.0},
-  {2552223768.0,  3013442338.0,  3525729666.0,  2482262564.0,   112977732.0,   275640732.0},
-  {2562696353.0,  1700051859.0,   904194816.0,  3008433441.0,  1013113747.0,  3251857507.0},
-  {1172617926.0,  3292471917.0,  4121242564.0,  1738674604.0,   420789208.0,  2784410123.0},
-  {3328961448.0,   453332527.0,  4263471437.0,  1373408775.0,   319413809.0,   173525687.0},
-  {1984247146.0,  2391434904.0,  3882742729.0,   890382528.0,  4289175251.0,  2086145800.0},
-  {2555949186.0,   265266661.0,  1128693061.0,  3247564800.0,  3048661130.0,   774258274.0},
-  {1086728065.0,  2165784919.0,  1298703142.0,  1862112053.0,  1969335284.0,  4130175491.0},
-  {3590581011.0,   476434529.0,  2061499763.0,  1046927315.0,  3265100786.0,  1698770489.0},
-  {  74597688.0,  1853883231.0,  2346401317.0,  4210660351.0,  2723035864.0,   349556804.0},
-  {1217614815.0,   260423486.0,  3189364764.0,  1882504028.0,  3121271384.0,  1626561768.0},
-  { 604881045.0,   804314112.0,  3215899715.0,  1377671090.0,  3432697240.0,  1931203560.0},
-  { 457795429.0,    76354905.0,  1732602830.0,  1187000593.0,  3172712078.0,   350921899.0},
-  {4278800374.0,   382563727.0,  1129130242.0,  2375930423.0,   834616482.0,  3231782114.0},
-  {2796320391.0,  2978279577.0,  3940802834.0,  3914697768.0,  3228086363.0,  1090396138.0},
-  {1268509365.0,  3286362658.0,   493696514.0,  2980022057.0,  1294554028.0,   527639925.0},
-  {2527872991.0,  4013567314.0,  3703875547.0,   684232464.0,   529311846.0,  3402111594.0},
-  {3151414480.0,  1161242065.0,  4098708928.0,  4206710994.0,   989558577.0,  3562454348.0},
-  {2288949584.0,  1023198081.0,  1629088830.0,  2506702293.0,  4172186947.0,  1435254509.0},
-  { 897556651.0,  2473154586.0,  2306981781.0,  3695645738.0,  2678001567.0,   412577674.0},
-  {4181576337.0,  3511682742.0,  1362212574.0,  4237447746.0,  3081327293.0,  1286411734.0},
-  { 618971737.0,  3708268099.0,  1563068399.0,  2870489298.0,  4201390561.0,  1771392303.0},
-  { 315457364.0,  2598045626.0,  1309096573.0,    40928339.0,  3295525631.0,  3566624858.0},
-  { 405298860.0,   279271405.0,  2221084083.0,  4187932637.0,  2045001350.0,  1098110917.0},
-  {1956178463.0,  2079617579.0,  3973621414.0,  3908144879.0,   972675809.0,  3636982476.0},
-  {3136497469.0,   975512050.0,  4091858631.0,  1172419837.0,  3364972089.0,  2512946742.0},
-  {1709746410.0,   152700462.0,   846939666.0,   945269806.0,  1501363486.0,  2905803320.0},
-  {1449648523.0,  3231256692.0,   501956782.0,  2460118585.0,   121663960.0,   693278826.0},
-  {1078329412.0,  3670185205.0,   625222510.0,  1464537179.0,  1065231095.0,  1273156146.0},
-  {2387364133.0,   808881186.0,  1598656916.0,  4204662327.0,  3795460455.0,  4241776950.0},
-  {1226407916.0,  3773220624.0,  3429190692.0,  1357741312.0,  1674101967.0,  1998910332.0},
-  {3693134077.0,  1025387579.0,   594896665.0,  1282804338.0,  2676503197.0,  1963826328.0},
-  {1525466312.0,  3255335208.0,  4170721516.0,  3351779778.0,  2975173410.0,  3968640688.0},
-  { 492165504.0,  3968560333.0,  3107350214.0,  1184933672.0,   412653904.0,  2484809516.0},
-  { 748900578.0,  2488206440.0,  3135736718.0,   715232477.0,  3122858023.0,   641510346.0},
-  {3056540044.0,   496673947.0,  2426237977.0,  4095643599.0,  1988719254.0,   372557543.0},
-  {2838524683.0,  2223785569.0,  3864091735.0,  4060772405.0,   290379280.0,  1819832960.0},
-  {2003128781.0,   677811576.0,  4170280537.0,  1098596626.0,   940399379.0,  2210106966.0},
-  { 158296878.0,   759814761.0,  1272712527.0,   103903840.0,  3197883532.0,  4175430770.0},
-  {3073615428.0,   618888206.0,  2185349890.0,  2246880191.0,  4224690250.0,   258646641.0},
-  { 913824942.0,  2527623482.0,   690302379.0,  3090042848.0,   466339578.0,  2547405494.0},
-  {3775843970.0,  2334756824.0,  1359372632.0,   942835118.0,  3111406467.0,   667567313.0},
-  {3089049952.0,  4148372014.0,   530266905.0,  3180965375.0,  2367379359.0,  3404728989.0},
-  {2504564158.0,  3382601461.0,  2192029319.0,    44550288.0,  3914327639.0,  2066129196.0},
-  {3542127636.0,  1928216444.0,  1438578846.0,  3721478050.0,  3662242905.0,  2852784593.0},
-  {4099147563.0,   630857028.0,  1877917495.0,   742294759.0,  2599304984.0,  1389124579.0},
-  {3302846929.0,  2642351532.0,   270218700.0,  1741617489.0,  4193422031.0,  2631474300.0},
-  {3727683887.0,   496330003.0,  2041905624.0,  3246028708.0,  3898123776.0,  4113875728.0},
-  {3396885111.0,   617403593.0,  3512554795.0,  1698982045.0,  2943576092.0,  1293306096.0},
-  { 144393349.0,  2971049734.0,   209559869.0,  1914679635.0,  3215619676.0,  3362025963.0},
-  {1723204602.0,  2046062775.0,   234400907.0,   877844517.0,  3372412107.0,  2200076759.0},
-  {4080215346.0,   579169081.0,  1509800763.0,   818593401.0,  2651699506.0,  2031570519.0},
-  {2127092797.0,  2831996408.0,   558976600.0,   199371616.0,  3698405498.0,  2486083593.0},
-  {1522319975.0,  1005083689.0,   623372341.0,  3048569472.0,  4287126224.0,  2272521309.0},
-  {1850918223.0,    25899989.0,  1523693755.0,   447046519.0,  1251173722.0,  3392825944.0},
-  {2253728426.0,  3739447667.0,  4193301141.0,  1358935359.0,   161135486.0,  2651968696.0},
-  {1689226161.0,  3908200329.0,   181574683.0,   671443142.0,   335480007.0,  1102567269.0},
-  { 181416583.0,  3630457261.0,  2447635268.0,  2134113912.0,  1573560116.0,    60875663.0},
-  {1378446772.0,  3106723178.0,  2837185431.0,  1408896901.0,   923450820.0,  3216392658.0},
-  {1852984398.0,  1156646617.0,  2815017130.0,  2795646867.0,   930492191.0,  2160729830.0},
-  {1520904083.0,  2887881727.0,   222554660.0,  1244272915.0,  1314659058.0,  2706016112.0},
-  {4290058696.0,  2617963747.0,  1754547144.0,  1185763018.0,  4240614689.0,   532116840.0},
-  {2990764036.0,  1991185861.0,  1355687257.0,   451276968.0,  2719683664.0,  1482741400.0},
-  {4012056299.0,   905171227.0,  1987275298.0,  3635618106.0,  1888100751.0,   907140689.0},
-  {2569454449.0,   177462564.0,  2046936677.0,  1167795411.0,  2580492821.0,  4281743610.0},
-  { 942153133.0,   640365513.0,  2325743831.0,   317453415.0,  3517205858.0,  2539714508.0},
-  {3316970802.0,   789331966.0,  1470209089.0,  3841720413.0,  2318241818.0,  3572261977.0},
-  {3734176622.0,  1113210689.0,  4004243497.0,  1248164591.0,  2237947978.0,  2731972534.0},
-  {4264279391.0,  3126321490.0,  2045732481.0,  3991499302.0,  2953989881.0,  3603479028.0},
-  {1083112727.0,  2601361330.0,  2110198718.0,   463373812.0,  3647307296.0,  3304293527.0},
-  { 680659529.0,  3452100024.0,   848001061.0,  2219180143.0,  3072589614.0,  1326533254.0},
-  {2384394632.0,  3599771497.0,  2811903748.0,  3512191718.0,   218811840.0,  3853999639.0},
-  {2667040287.0,   716703436.0,  2946237209.0,  3387940923.0,  2886714633.0,  3540435815.0},
-  {  66554827.0,    91261895.0,  1983933438.0,  1522111875.0,  3745593177.0,  2026296882.0},
-  {1967282656.0,  4139881748.0,  1078355030.0,   482617803.0,   890444756.0,     6092243.0},
-  {1693683076.0,  1745283653.0,   425887267.0,  2696758181.0,  4161589286.0,  1328971707.0},
-  {3130205797.0,  3859241295.0,   902151994.0,  3506436379.0,   577195358.0,  1561396424.0},
-  {2469096956.0,   554461524.0,  2651076513.0,  3791840013.0,  1953329924.0,  3870910033.0},
-  {1858959774.0,  3150524555.0,  4116034094.0,  3430719304.0,  3000546361.0,   454201082.0},
-  {2957671941.0,  3403800833.0,  3765078250.0,  2418877128.0,  3104566425.0,  2633420476.0},
-  {2480681345.0,  4266416260.0,  1893773979.0,   484636103.0,  4110943677.0,  4270289422.0},
-  {1535900456.0,  1001082810.0,  3767063388.0,  4054744534.0,  3739200465.0,    30305272.0},
-  {2858961945.0,    43747645.0,   122985095.0,  3863226408.0,  2378597959.0,  2566217200.0},
-  {1536330755.0,   634462806.0,  1867549641.0,  1384540743.0,  1374592628.0,  3324967464.0},
-  {2991366355.0,   446024983.0,  2228090524.0,  2267690039.0,   841752997.0,  2443305227.0},
-  {2459540657.0,  2462925286.0,  2479920041.0,  1061026378.0,   230490070.0,    13667986.0},
-  {  97380481.0,   355767056.0,  2854329722.0,   788158946.0,  4056698926.0,   508779055.0},
-  {2384429871.0,  2286832826.0,  1408415411.0,   850060740.0,  3574250911.0,  3823302437.0},
-  {2909891134.0,  3818396222.0,   213027537.0,  2365907097.0,  4171843582.0,  2155541001.0},
-  {1067338742.0,  3772238783.0,   804604304.0,   262673514.0,   446540126.0,  2356442156.0},
-  {1095226829.0,  1032648514.0,   442622014.0,   468102741.0,  4279275723.0,  3111073874.0},
-  {1727230525.0,  1627848162.0,  1228934620.0,   291370773.0,   190383470.0,  3911052455.0},
-  {1623212757.0,  2020205239.0,  2492223755.0,  2704714741.0,     1722184.0,  2825248003.0},
-  {1836685811.0,  1836080885.0,  1165813356.0,  1569294093.0,   474364436.0,  2432313534.0},
-  {3029767689.0,  3461712072.0,  1122067598.0,  3693876616.0,   246860620.0,  2260701859.0},
-  {1274640197.0,   992488166.0,  1502231140.0,    38978163.0,  3366126424.0,  1482561341.0},
-  { 875813873.0,  4044488029.0,  3879289949.0,  3776141481.0,   866957904.0,   256533443.0},
-  {2695915466.0,  3841863957.0,   183338480.0,  3916071277.0,  3041892356.0,  2859553609.0},
-  {3421857613.0,  2205682537.0,  3464601939.0,  2397962074.0,   683244778.0,   468052052.0},
-  { 835695744.0,  2580299169.0,  3818333644.0,  2055686362.0,  1547370993.0,  2884015448.0},
-  {3868962570.0,  1164317727.0,  4153491458.0,  2361773103.0,  2001823001.0,    33423505.0},
-  {4066635278.0,    28912783.0,  2892038836.0,  1455513569.0,  3791688336.0,   756704620.0},
-  {1031651320.0,  4116232924.0,  1980953396.0,  2529136712.0,  2448663622.0,    82569938.0},
-  { 881924414.0,  1332191083.0,  2019110568.0,  3038063267.0,   731964163.0,  3762480865.0},
-  {1292970307.0,  3281742721.0,  3435317904.0,  4128098281.0,   543947782.0,  4035476221.0},
-  {2791314810.0,  3461842532.0,  3858081987.0,   238211561.0,  2771382072.0,  2701920937.0},
-  { 905972456.0,   375373820.0,  2313047343.0,   699100646.0,  1707759283.0,  2710985079.0},
-  {3529810409.0,   852267830.0,  2133044910.0,  1686395245.0,  2460420564.0,   131075037.0},
-  {3105414038.0,  1991669928.0,  2600532268.0,  1370151905.0,  3320304460.0,  3654553356.0},
-  {1256225862.0,  1405427042.0,   406099000.0,  3156804548.0,  2532628496.0,  1344080841.0},
-  {2825192958.0,  4240407350.0,  3331949389.0,  4086585420.0,  4041614456.0,   891191813.0},
-  {2878182008.0,  3477469522.0,   643409461.0,   212148743.0,  1225423738.0,  2097936523.0},
-  {1798047324.0,  2803317782.0,   926707108.0,  3755782339.0,  2130490395.0,  1677918267.0},
-  {3114934003.0,  4005340584.0,   919893958.0,  1440435595.0,  3786199691.0,  3303453248.0},
-  {1768595998.0,  3962117228.0,  3372435612.0,  2942319851.0,  3372005150.0,  2545522861.0},
-  {2962348757.0,  3471196965.0,   927068606.0,   484588383.0,  2403425656.0,   885345211.0},
-  {1602735309.0,  3309188133.0,  1280525748.0,  1267629759.0,   899532465.0,  3970410176.0},
-  {1569429490.0,  3262484539.0,  1095404478.0,  2637895341.0,  3616872574.0,   208964957.0},
-  {1736550171.0,   200775052.0,  1536238807.0,  3081257664.0,   751785672.0,  1993666648.0},
-  {3532788486.0,  2841265199.0,  4194929818.0,  4160685772.0,  2565158463.0,   409714989.0},
-  {3783326076.0,  3395480957.0,   781557581.0,  3870293581.0,  4121613952.0,  2739649324.0},
-  {1229342118.0,   448049798.0,  4249119043.0,  3317770121.0,    93669476.0,  3486844352.0},
-  { 914436888.0,  1030688603.0,  2806211281.0,  2869950971.0,  1176874052.0,  2905116653.0},
-  {3682212035.0,  1020148297.0,   846910482.0,  2694756288.0,  1716771462.0,   307498169.0},
-  {3662126176.0,   598857483.0,  3072604552.0,  2372680915.0,  2056602026.0,  4189025064.0},
-  {3981842324.0,   298427878.0,   191704121.0,   104597052.0,  2485735278.0,  3591231443.0},
-  {3643497306.0,  2665482165.0,   616352397.0,  3160438880.0,   119584982.0,   460730321.0},
-  {3870470477.0,  1274064748.0,  1695248992.0,  3011495674.0,    32691333.0,  3140027046.0},
-  {  44792279.0,  1607991529.0,  3173445646.0,  1418417292.0,   124898497.0,  2705938730.0},
-  { 714083703.0,  3168712590.0,  2696119667.0,    93844724.0,  2928973429.0,  4064674958.0},
-  {1336995002.0,   123705384.0,   421424894.0,  4034092240.0,  2498524173.0,  1886579468.0},
-  {1763413221.0,   796163803.0,  3499211984.0,   210169431.0,  1557003143.0,  2256580111.0},
-  {1050354100.0,  3687589851.0,  3624124686.0,  1046007811.0,  1496928181.0,  1854033433.0},
-  {1183835024.0,  1068622730.0,  1228586877.0,  3065840926.0,  2481459589.0,  3071870562.0},
-  { 100430437.0,  1100874125.0,   656053681.0,  2789508369.0,  2648110069.0,  1591088098.0},
-  {1658774467.0,  1926349930.0,  3913971412.0,  3127277058.0,    21941677.0,  2872258120.0},
-  { 959029312.0,  1839814757.0,  3077188805.0,  1837571845.0,  1817827210.0,  3091325172.0},
-  { 864311947.0,  3921609541.0,  3863787252.0,  3981295762.0,  1830397963.0,  3941042209.0},
-  {3791872502.0,  1408778886.0,  3893691598.0,  1665316922.0,  2357136514.0,  3374303610.0},
-  {3428954591.0,  3367953140.0,  3438313696.0,  1207903575.0,   648652836.0,  3098717213.0},
-  {1378129535.0,  4137027581.0,  1033153230.0,  1116693175.0,  1567608597.0,  1631337358.0},
-  {1415054408.0,  4228036483.0,  1549937051.0,   916037018.0,    71027236.0,  3464447246.0},
-  {1824080796.0,  2467166995.0,  3249284516.0,   301602808.0,   805772622.0,  4197447204.0},
-  {1532308861.0,  3245412224.0,  1683596600.0,  3879751750.0,  2026927294.0,   925357855.0},
-  {2566143055.0,   898497479.0,   884859881.0,  3998047916.0,  1469046214.0,  3264846822.0},
-  {2226759284.0,  2158656300.0,  1037174570.0,  2442090639.0,  3816430425.0,  4146834974.0},
-  {3945372192.0,  4014567670.0,   742623210.0,  2723277983.0,   227496782.0,  2247994739.0},
-  {1836707202.0,  1246033654.0,   772476265.0,  1196702658.0,  3272241634.0,   681533964.0},
-  {4050051351.0,  1460320677.0,  4026551334.0,  1033519604.0,  4241476471.0,  2491033904.0},
-  {2549506671.0,  4255541269.0,  4288564656.0,  1508934138.0,  4113281578.0,   268456344.0},
-  {2892742428.0,   922951293.0,  2506652714.0,  1635098815.0,  3843139443.0,   433011612.0},
-  {1393270178.0,   173310823.0,  3435447704.0,  4065281094.0,  1904541655.0,   825500122.0},
-  {2596138538.0,  3322556856.0,  2658329288.0,   550148989.0,   105891017.0,  2553400718.0},
-  {2052049381.0,   219307557.0,   574681167.0,  1142657405.0,  1638207822.0,  3463018845.0},
-  {1531047422.0,  2840520095.0,  3919846522.0,  3610726354.0,   181640906.0,  1008902233.0},
-  {3377698896.0,   574516795.0,  1725497291.0,  3609679320.0,  3864625883.0,  4093999691.0},
-  {1394327779.0,  2229242855.0,   908901953.0,  4292336064.0,  2988825657.0,  3743050458.0},
-  {3250041172.0,  2624283203.0,  2039160201.0,   331549798.0,  2037618557.0,  2737075593.0},
-  {3525254662.0,   504854541.0,  3565040807.0,   858215119.0,  1081615289.0,  1546051268.0},
-  { 606943864.0,   318647735.0,  3471448089.0,  2984029710.0,  2786733498.0,  4056581330.0},
-  {3051849231.0,  2419214147.0,  1025327533.0,  2288136329.0,  3991620002.0,  1917349676.0},
-  { 177267967.0,  1675676596.0,  3972368064.0,  2681395401.0,  2689327667.0,   288723180.0},
-  {2735848725.0,   800354012.0,  2513453613.0,  1051079258.0,  1250478001.0,   655411394.0},
-  { 685489340.0,  4088130417.0,  1195300067.0,  1246698178.0,   533469140.0,   652235206.0},
-  { 847428780.0,   160028467.0,   262908580.0,  3828491221.0,  3329081287.0,  2386708497.0},
-  {3632767209.0,  1120077706.0,  1924029461.0,  1393081844.0,  1297513110.0,  2416004201.0},
-  {1231787449.0,   291802518.0,  2763631021.0,  2323288560.0,  2644666436.0,  2757584929.0},
-  {3337422573.0,  1578387681.0,  2787869670.0,  2809659331.0,   268331414.0,  1311812896.0},
-  {2165232715.0,  2891543027.0,  2312503649.0,  3240006418.0,    37928690.0,  3683725572.0},
-  {1042798707.0,  4065741503.0,  3192132967.0,   139573098.0,  2684984724.0,  3430041405.0},
-  {1335200286.0,  3452688625.0,  3709981021.0,  4176785384.0,   753834503.0,  2974238254.0},
-  { 659165431.0,  1316450387.0,  1425552726.0,  3768390906.0,    74630182.0,  3562833569.0},
-  {1734470752.0,   904047240.0,  3234728761.0,   184927806.0,  2545525647.0,  1792387477.0},
-  {2993893538.0,  3052116043.0,  1435026365.0,   528067212.0,  3591076282.0,  4033000444.0},
-  {2521571593.0,  2470908253.0,  2426099740.0,   981420424.0,   319869568.0,  3440841130.0},
-  {3071969275.0,  1166539936.0,  4014604157.0,  1097905603.0,   789505996.0,  1870904390.0},
-  {2530116545.0,  2098854402.0,  3027525549.0,  2658669611.0,  1570897524.0,  1694450200.0},
-  {3129220649.0,  3325653452.0,  2563379653.0,  1986978079.0,   665929546.0,  1435107356.0},
-  {3275382518.0,  1898439719.0,  4278097874.0,  3520602823.0,  1780072316.0,  3525886402.0},
-  {3685227986.0,  4127860577.0,  3641200325.0,   683106477.0,   164070365.0,   897116669.0},
-  {3511615770.0,  1537823889.0,  3492577742.0,  2245445923.0,  1440790846.0,  1216268733.0},
-  { 886887259.0,  1048045981.0,  2460616534.0,   981192165.0,  3193289156.0,  2534380725.0},
-  { 872174017.0,  2571927959.0,   221825485.0,  3141393697.0,  4279946874.0,  2121104747.0},
-  {2994702909.0,  4215428835.0,  1646231572.0,  2448121178.0,  2366224402.0,  1525411214.0},
-  {1448625709.0,  2977412651.0,   573154800.0,   168469422.0,  1109673149.0,  3068434969.0},
-  {2686100762.0,  1364613007.0,  1071816199.0,  3976463767.0,  2712528608.0,   305662154.0},
-  {2436312914.0,  1775810388.0,  1052086118.0,  1478994019.0,  2682485412.0,  2260448884.0},
-  {2257543319.0,  1396428891.0,  3109345607.0,  3617038329.0,  3075009355.0,  4271031852.0},
-  {2872100485.0,  1538659378.0,   798753182.0,   313424884.0,  1737983415.0,  4287462554.0},
-  {2253553557.0,   610759518.0,  1858998140.0,   377320014.0,  3648259981.0,  3323574287.0},
-  {1864183109.0,  2223572294.0,  4287550052.0,  3908087053.0,  1595765652.0,   751880775.0},
-  {2669423980.0,  1925375923.0,  3673954034.0,   387084641.0,  2431780959.0,  3369699907.0},
-  { 634025997.0,  2512693555.0,   254067150.0,  1046957178.0,  1491666681.0,  2246261141.0},
-  {3995296181.0,   883199869.0,   526593447.0,  1759110035.0,  3024976155.0,   445070397.0},
-  {1053696077.0,   350536256.0,  1404472906.0,  1232470601.0,  1045507188.0,  4098373137.0},
-  {1828080895.0,  1305438071.0,  3384267675.0,  4014696626.0,  3593332552.0,  1875025880.0},
-  { 458105187.0,  3940286596.0,   763596240.0,  4067711425.0,  3427358327.0,  3410103171.0},
-  {1319998521.0,  2294770360.0,  1082479184.0,  2416112718.0,   536650342.0,  3590076020.0},
-  {1626514517.0,   749829138.0,   314314059.0,     2638660.0,  2062369804.0,   525032321.0},
-  {2248068265.0,  3859988473.0,  3319319560.0,    21373640.0,  1377230103.0,   546713393.0},
-  { 679604006.0,  2300551604.0,   164132728.0,   640322525.0,   192037025.0,  3487139015.0},
-  {2892876248.0,   589507348.0,  3061957029.0,  2546444737.0,   635529984.0,   521759264.0},
-  { 338479149.0,   578317443.0,  3859622332.0,  3079789403.0,  1429406083.0,   349638765.0},
-  {3442322304.0,   136453563.0,  1937369284.0,  3503965258.0,  1485894445.0,  1846520117.0},
-  { 342365066.0,  4018833750.0,  1586062281.0,  3366429959.0,  1832215117.0,  3232660235.0},
-  {1759117604.0,  3823663637.0,  3645754037.0,  2207909200.0,   525250586.0,  1909897057.0},
-  { 934868154.0,  3928499703.0,   336476437.0,  3602977583.0,  3996989236.0,  1478942810.0},
-  {3684828970.0,  3126019740.0,  2416985277.0,  3845312273.0,  3905469413.0,  3250753044.0},
-  {2199383741.0,  1751624000.0,  1332248104.0,  3364132318.0,  3837215232.0,  4146531246.0},
-  {2542256338.0,  1606643799.0,  3861817581.0,   334828686.0,  3318568236.0,  2578078351.0},
-  { 254418406.0,  3845095500.0,  2397673005.0,  3193623330.0,  2354899819.0,  2679914093.0},
-  {1617262796.0,   506623653.0,  3805753512.0,  3502932934.0,  4077018863.0,  3212817162.0},
-  {2546555493.0,  3749522472.0,   880208663.0,  1785602254.0,  1908242967.0,   606685001.0},
-  { 151418363.0,   859297290.0,  1622541708.0,  2809966966.0,  3986597973.0,   762814617.0},
-  {3496417639.0,  3625422161.0,   530616650.0,  4155016768.0,  1565265377.0,  3422120060.0},
-  {1636818834.0,  3384514080.0,  1038675520.0,  2953454293.0,  4213582333.0,  2326185477.0},
-  {3911505685.0,  3943044110.0,   714840858.0,  1849890606.0,  1706337771.0,   297463021.0},
-  {1559260559.0,  3651658783.0,  4151383353.0,   442264703.0,  3116100636.0,  1918173388.0},
-  {2486121976.0,   815133595.0,  3290358563.0,  2526768663.0,  1557015087.0,  3051166946.0},
-  {1788857201.0,  4033891098.0,  1123267112.0,  2311597054.0,  3798129495.0,   943864259.0},
-  { 460686955.0,  1905142258.0,  2605217407.0,  4185080100.0,  2087749853.0,  1131910750.0},
-  {3024158242.0,   994256087.0,  1191885631.0,  1416623210.0,  1348110988.0,  3763051281.0},
-  {1396098437.0,  2803158933.0,   664441627.0,  2599833082.0,   458640874.0,  1877540486.0},
-  {1034128670.0,  3780032785.0,   699368732.0,  3848826445.0,  1572253969.0,  2881719071.0},
-  {3533776447.0,  3585702224.0,  4221433243.0,  2719002187.0,  1628374838.0,   952647887.0},
-  {2109139953.0,  3151357376.0,  3413050726.0,  2710093335.0,  3920601022.0,   528691369.0},
-  {1497860230.0,    66276081.0,  3357353977.0,  3889679439.0,  1844943324.0,  1613716319.0},
-  {2242246203.0,  3868848890.0,   268441711.0,    77326719.0,   215101498.0,  2642202616.0},
-  {2274220227.0,  2072258020.0,     7910808.0,  3566649590.0,  2038737568.0,  2466771426.0},
-  { 657385630.0,    46403091.0,   233945389.0,  2446717966.0,  1668875112.0,   413527740.0},
-  {1580099316.0,  4122809526.0,   970703094.0,  3132734791.0,  2278401103.0,  2588182476.0},
-  {2135886074.0,  1082512461.0,   112158291.0,   501414431.0,  1794097633.0,  2595908820.0},
-  {1977573681.0,   238342076.0,  2890140391.0,   920035042.0,  3090502958.0,  1654237195.0},
-  {2838713815.0,   958050176.0,  1193320032.0,  4222819350.0,  1695248601.0,  3974823710.0},
-  { 554916732.0,  2610242327.0,  2443296561.0,   813454764.0,   705387031.0,  4136892888.0},
-  {4235492882.0,  1115722296.0,  2137787888.0,  3883177844.0,  2335355213.0,  1721810170.0},
-  { 155989615.0,  1319582301.0,    23479189.0,  2659237295.0,   874830045.0,  2635749940.0},
-  { 733170665.0,  3616697690.0,  4039396606.0,   272572345.0,  3211285396.0,   888067244.0},
-  {4000421002.0,   312357422.0,  2322054444.0,  4281486471.0,   654548398.0,  1787394466.0},
-  {2741343005.0,  1331620175.0,   353082499.0,  2015076148.0,  3036326247.0,  2106738573.0},
-  { 696001174.0,  4262288630.0,   832215623.0,  1200728264.0,   574389006.0,    93254695.0},
-  {2553166506.0,  3855564180.0,  3065449024.0,  2566981806.0,  3283872679.0,  2823224976.0},
-  {3115474885.0,   690876085.0,  3021166191.0,  2964091544.0,  2011545908.0,  4139080081.0},
-  {3959749469.0,   564525517.0,  1339321835.0,  3741127873.0,  2052086309.0,   635131492.0},
-  {2616510868.0,  2516503016.0,   995942801.0,  3010121933.0,  2101175208.0,  2556127423.0},
-  { 163946745.0,  1780466956.0,  1537689476.0,    20268430.0,   193439057.0,   322749024.0},
-  { 277449370.0,  1271124353.0,  2498423789.0,   618716317.0,  1867249421.0,   867361880.0},
-  {1999593289.0,  2093802863.0,  1014460629.0,  1429767566.0,  1003860951.0,  2097137133.0},
-  {  69319180.0,  3841854714.0,  1553459565.0,  1399319118.0,  3171618305.0,   363651695.0},
-  {3918413430.0,  1204480241.0,  1403318218.0,  2580964942.0,  2131861955.0,  1098637374.0},
-  {2505333161.0,  2556473389.0,  1323184717.0,  4017843596.0,  2797096264.0,  1167667288.0},
-  {  76463744.0,  1312680918.0,  2702401466.0,  3814917674.0,  1058505955.0,  1047569293.0},
-  {3700955286.0,   839217516.0,  2976975507.0,    26564135.0,  1119595214.0,  3589635931.0},
-  {3632869056.0,  1292739998.0,  4242456844.0,  4206700034.0,  1585855712.0,  1024082969.0},
-  {3851156581.0,   629929210.0,  2460727210.0,  2274034248.0,   458183637.0,  3004918686.0},
-  { 167365901.0,  3386586757.0,  1605118920.0,  2242748723.0,  3098350751.0,   683674319.0},
-  { 594748553.0,   162183321.0,  1339141246.0,  1029653709.0,  2023588825.0,  1576732270.0},
-  {3873615838.0,  2565366869.0,  2305780113.0,  2503753048.0,  3805087132.0,  3314139237.0},
-  {3208189155.0,  2122231641.0,  2240932467.0,  1374600680.0,   705512372.0,  2897717605.0},
-  {2094820632.0,  1093629799.0,  4043984421.0,  2426155084.0,  3334364230.0,   684756172.0},
-  { 809542185.0,    94752427.0,  2698644211.0,  1771641606.0,  1119117261.0,  3150577859.0},
-  {3945425310.0,  2548716638.0,  2533421448.0,   550245572.0,  2354638589.0,  1374530774.0},
-  {1344445697.0,   562203822.0,  2745343659.0,  3010417009.0,   130552948.0,   315584214.0},
-  {1712124062.0,  3261879727.0,   182154411.0,  2253190108.0,  1458000818.0,  2829670134.0},
-  {3544314499.0,  2882689991.0,  2935096358.0,  3800077312.0,  3910678899.0,  2933069715.0},
-  { 314430528.0,  2408678408.0,  3233828437.0,  1431802403.0,  2801808944.0,  2435155806.0},
-  { 787059375.0,  2953775952.0,   841158135.0,  2159636882.0,  3562758340.0,  4057404468.0},
-  {2760199512.0,    59471422.0,   387865416.0,   602475431.0,  1882506211.0,   511097860.0},
-  { 436572314.0,  1121077626.0,    55519842.0,  2379674009.0,    36373142.0,  2577782048.0},
-  {3808465345.0,  1642597843.0,  2003340162.0,   915403751.0,  3475679750.0,   953399636.0},
-  {3077264749.0,  3990942596.0,   302224598.0,  2314239226.0,  2260063249.0,  2596817147.0},
-  {2350739177.0,  3146822126.0,  4058613543.0,  2831893039.0,  2478575460.0,  1033477894.0},
-  {3664916877.0,  2668044575.0,  1658463391.0,   122318966.0,   936474512.0,  3491054852.0},
-  { 560024289.0,  1830276631.0,   144885590.0,  1556615741.0,  1597610225.0,  1856413969.0},
-  {1031792556.0,  1844191084.0,  1441357589.0,  3147919604.0,   199001354.0,  2555043119.0},
-  {2023049680.0,  4184669824.0,  4074523931.0,   252765086.0,  3328098427.0,  1480103038} 
-};
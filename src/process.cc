@@ -30,45 +30,94 @@
 #include <cstdio>
 #include <iostream>
 #include <list>
+#include <unordered_set>
 #include "process.hh"
 #include "sqs.hh"
+#include "basic_process.hh"
 #include "logger.hh"
-
-// Time format string, used for logging
-#define TIMEFMT "%.2f"
+#include "stackPool.hh"
 
 int process::_idCount = 0;
+unsigned long process::_live = 0;
+vector< handle_p > process::_batch;
+
+//
+// Table of the names of the processes. Simulations usually create
+// many processes with a few distinct names, so each process only
+// keeps a pointer into this table. The table is never deleted, as
+// processes may be destroyed after the static objects of this file.
+//
+typedef unordered_set< string > nameTable_t;
+static nameTable_t* names = 0;
+
+const string* process::intern( const string& name )
+{
+    if ( 0 == names )
+        names = new nameTable_t( );
+    return &*names->insert( name ).first;
+}
 
 void process::main( void )
 {
     inner_body( );
+    finish( );
+}
+
+//
+// Marks this process as terminated, removing its event notice (if any)
+//
+void process::finish( void )
+{
     message( this, "Terminates\n" );
 
-    if ( 0 != _ev ) {
-        getSqs( )->remove( _ev );
-	delete _ev; _ev = 0;
-    }
-    _terminated = true;
+    if ( !idle( ) )
+        getSqs( )->remove( &_ev );
+    markTerminated( );
 }
 
-process::process( const string& name ) : 
-    coroutine   ( ),
-    shared      ( ),
+process::process( const string& name, size_t stackSize ) : 
+    coroutine   ( stackSize ),
+    link        ( ),
     _id         ( _idCount++ ), 
-    _name       ( name ),
-    _terminated ( false ),
+    _name       ( intern( name ) ),
     _s          ( simulation::instance( )->getSqs( ) ), 
-    _ev         ( 0 )
+    _ev         ( ),
+    _idle       ( 0 )
 {
+    _live++;
+}
 
+//
+// The process may have been passivated, or never activated: in any
+// case, it starts again from the beginning of inner_body( ).
+//
+void process::recycle( void )
+{
+    assert( idle( ) );
+    if ( 0 != _idle )
+        getSqs( )->idleRemove( this );
+    reset( );
+}
+
+//
+// A recycled process gets a new id, and belongs to the current
+// simulation, which is not necessarily the one it was created in
+//
+void process::revive( void )
+{
+    _id = _idCount++;
+    _s = simulation::instance( )->getSqs( );
 }
 
+//
+// A process in the sqs is referenced by it, so it cannot be destroyed
+//
 process::~process( )
 {
-    if ( 0 != _ev ) {
-	getSqs( )->remove( _ev );
-	delete _ev; _ev = 0;
-    }
+    assert( idle( ) );
+    _live--;
+    if ( 0 != _idle )
+        getSqs( )->idleRemove( this );
 }
 
 //
@@ -87,20 +136,17 @@ process::~process( )
 // and control is passed back to the scheduler, which will select the
 // next event notice from the sequencing set.
 //
-void process::hold( double dt ) 
+// The operations are defined in basic_process.hh, for any type of sqs.
+//
+void process::hold( simtime_arg dt ) 
 {
-    double now = time( );
-
-    assert( this == current( ).rep( ) );
-    assert( 0 != _ev );
-
-    message( this, "Hold " TIMEFMT " until " TIMEFMT "\n", dt, evTime()+dt );
-
-    getSqs( )->remove( _ev );
-    delete _ev; _ev = 0;
+    prepareHold( getSqs( ), dt );
+    suspend( getSqs( ) );
+}
 
-    _ev = getSqs( )->insertAt( this, now + dt );
-    detach( );
+void process::prepareHold( simtime_t dt )
+{
+    prepareHold( getSqs( ), dt );
 }
 
 //
@@ -122,118 +168,63 @@ void process::hold( double dt )
 //
 void process::passivate( void ) 
 {
-    assert( this == current( ).rep( ) );
-    assert( 0 != _ev );
-
-    message( this, "Pass\n" );
-
-    getSqs( )->remove( _ev );
-    delete _ev; _ev = 0;
+    preparePassivate( getSqs( ) );
+    suspend( getSqs( ) );
+}
 
-    detach( );
+void process::preparePassivate( void )
+{
+    preparePassivate( getSqs( ) );
 }
 
 void process::activate( void )
 {
-    double now = time( );
-    if ( 0 == _ev ) {
-        message( current(), "Act %s [%d] now\n", name().c_str(), id() );
-        _ev = getSqs( )->insertAt( this, now );
-    }
+    activate( getSqs( ) );
 }
 
-void process::activateAt( double t )
+void process::activateAt( simtime_arg t )
 {
-    double now = time( );
-    assert( t >= now );
-    if ( 0 == _ev ) {
-        message( current(), "Act %s [%d] at " TIMEFMT "\n", name().c_str(), id(), t );
-        _ev = getSqs( )->insertAt( this, t );
-    }
+    activateAt( getSqs( ), t );
 }
 
 void process::activateBefore( handle_p& q )
 {
-    if ( 0 == _ev ) {
-        message( current(), "Act %s [%d] before %s [%d] at " TIMEFMT "\n",
-                 name().c_str(), id(), q->name().c_str(), q->id(), q->evTime() );
-	_ev = getSqs( )->insert( this, q, pos_before );
-    }
+    activateBefore( getSqs( ), q );
 }
 
 void process::activateAfter( handle_p& q )
 {
-    if ( 0 == _ev ) {
-        message( current(), "Act %s [%d] after %s [%d] at " TIMEFMT "\n",
-                 name().c_str(), id(), q->name().c_str(), q->id(), q->evTime() );
-        _ev = getSqs( )->insert( this, q, pos_after );
-    }
+    activateAfter( getSqs( ), q );
 }
 
-void process::activateDelay( double dt )
+void process::activateDelay( simtime_arg dt )
 {
-    double now = time( );
-    if ( 0 == _ev ) {
-        message( current(), "Act %s [%d] delay " TIMEFMT "\n", 
-                 name().c_str(), id(), dt );
-        _ev = getSqs( )->insertAt( this, now + dt );
-    }
+    activateDelay( getSqs( ), dt );
 }
 
 void process::reactivate( void )
 {
-    message( current(), "React %s [%d] now\n", name().c_str(), id() );
-    double now = time( );
-    if ( 0 != _ev ) {
-        getSqs( )->remove( _ev );
-	delete _ev; _ev = 0;
-    }
-    _ev = getSqs( )->insertAt( this, now );
+    reactivate( getSqs( ) );
 }
 
-void process::reactivateAt( double t )
+void process::reactivateAt( simtime_arg t )
 {
-    message( current(), "React %s [%d] at " TIMEFMT "\n", 
-             name().c_str(), id(), t );
-    if ( 0 != _ev ) {
-        getSqs( )->remove( _ev );
-	delete _ev; _ev = 0;
-    }
-    _ev = getSqs( )->insertAt( this, t );
+    reactivateAt( getSqs( ), t );
 }
 
 void process::reactivateAfter( handle_p& q )
 {
-    message( current(), "React %s [%d] after %s [%d] at " TIMEFMT "\n",
-             name().c_str(), id(), q->name().c_str(), q->id(), q->evTime() );
-    if ( 0 != _ev ) {
-        getSqs( )->remove( _ev );
-	delete _ev; _ev = 0;
-    }
-    _ev = getSqs( )->insert( this, q, pos_after );
+    reactivateAfter( getSqs( ), q );
 }
 
 void process::reactivateBefore( handle_p& q )
 {
-    message( current(), "Act %s [%d] before %s [%d] at " TIMEFMT "\n",
-             name().c_str(), id(), q->name().c_str(), q->id(), q->evTime() );
-    if ( 0 != _ev ) {
-        getSqs( )->remove( _ev );
-	delete _ev; _ev = 0;
-    }
-    _ev = getSqs( )->insert( this, q, pos_before );
+    reactivateBefore( getSqs( ), q );
 }
 
-void process::reactivateDelay( double dt )
+void process::reactivateDelay( simtime_arg dt )
 {
-    message( current(), "React %s [%d] delay " TIMEFMT "\n", 
-             name().c_str(), id(), dt );
-    double now = time( );
-    if ( 0 != _ev ) {
-        getSqs( )->remove( _ev );
-	delete _ev; _ev = 0;
-    }
-    _ev = getSqs( )->insertAt( this, now + dt );
+    reactivateDelay( getSqs( ), dt );
 }
 
 handle_p& process::current( void ) const 
@@ -243,29 +234,18 @@ handle_p& process::current( void ) const
 
 void process::cancel( void )
 {
-    message( current(), "Canc %s [%d]\n", name().c_str(), id() );
-    if ( 0 == _ev )
-        return;
-
-    handle_p cur = current( );
-    getSqs( )->remove( _ev );
-    delete _ev; _ev = 0;
-    if ( getSqs( )->empty( ) )
-        detach( );
-    else
-        if ( getSqs( )->firstProc( ).rep( ) != cur.rep( ) ) 
-            detach( );
+    cancel( getSqs( ) );
 }
 
-double process::time( void ) const
+simtime_t process::time( void ) const
 {
-    return ( getSqs( )->empty( ) ? 0.0 : current( )->evTime( ) );
+    return time( getSqs( ) );
 }
 
-double process::evTime( void ) const
+simtime_t process::evTime( void ) const
 {
-    assert( 0 != _ev );
-    return _ev->evTime( );
+    assert( !idle( ) );
+    return _ev.evTime( );
 }
 
 void process::end_simulation( void ) 
@@ -296,3 +276,54 @@ void process::message( const handle_p& p, const char* fmt, ... )
     _logger->vmessage( 0, fmt, ap );
     va_end( ap );
 }
+
+//
+// The sizes of the objects are those of the base classes: the objects
+// of derived classes are larger. Stacks are counted by their size,
+// although only the pages which have been touched are resident.
+//
+static void memoryLine( const char* what, size_t bytes, unsigned long n )
+{
+    cout << "  " << what << bytes;
+    if ( n > 0 )
+        cout << " (" << (double)bytes / n << " per process)";
+    cout << endl;
+}
+
+void process::memoryReport( void )
+{
+    sqs* s = simulation::instance( )->getSqs( );
+    unsigned long n = _live;
+    size_t names_bytes = 0;
+    if ( 0 != names ) {
+        nameTable_t::const_iterator it;
+        for ( it = names->begin( ); it != names->end( ); it++ )
+            names_bytes += sizeof( string ) + it->capacity( ) + 1 + 2*sizeof( void* );
+        names_bytes += names->bucket_count( ) * sizeof( void* );
+    }
+    size_t notices = ( 0 != s ? s->size( ) * s->noticeBytes( ) : 0 );
+    size_t idle = ( 0 != s ? s->idleBytes( ) : 0 );
+    size_t stacks = stackPool::instance( )->inUseBytes( );
+    size_t saved = coroutine::savedBytes( );
+    size_t total = n * sizeof( process ) + notices + idle + stacks + saved + names_bytes;
+
+    cout << endl
+         << "Process memory usage:" << endl
+         << "  Live processes..............." << n << endl
+         << "  Process object size.........." << sizeof( process ) << endl
+         << "    coroutine.................." << sizeof( coroutine ) << endl
+         << "    shared....................." << sizeof( shared ) << endl
+         << "    simset link................" << sizeof( simset::link ) - sizeof( shared ) << endl
+         << "    event notice..............." << sizeof( absEvNotice ) << endl
+         << "    process fields............."
+         << sizeof( process ) - sizeof( coroutine ) - sizeof( simset::link )
+            - sizeof( absEvNotice ) << endl;
+    memoryLine( "Process objects.............", n * sizeof( process ), n );
+    memoryLine( "Sqs bookkeeping.............", notices, n );
+    memoryLine( "Idle list...................", idle, n );
+    memoryLine( "Stacks in use...............", stacks, n );
+    memoryLine( "Saved stacks................", saved, n );
+    memoryLine( "Names.......................", names_bytes, n );
+    memoryLine( "Total.......................", total, n );
+    cout << endl;
+}
@@ -27,63 +27,143 @@
 #include <cstdlib>
 #include <list>
 #include <string>
+#include <vector>
 #include <cstdarg>
 #include "coroutine.hh"
+#include "simtime.hh"
 #include "handle.hh"
+#include "simset.hh"
 
 class sqs;
-class absEvNotice;
 class process;
 class logger;
+struct idleNode;
 
 typedef handle<process> handle_p;
 
-class process : public coroutine, public shared {
+//
+// Event notice. A process has at most one event notice, so the notice
+// is embedded in the process, and it is never allocated or freed: it
+// is only linked into, moved within, or unlinked from the sequencing
+// set. While the notice is in the sqs, the sqs holds a reference to
+// the process, so that it stays alive.
+//
+// The notice has the fields needed by all the sqs implementations,
+// which use the ones they need; a notice can thus be moved from an
+// sqs of a type to another without changing its address.
+//
+class absEvNotice {
+    friend class process;
+    friend class sqs;
+    friend class sqsDll;
+    friend class sqsPrio;
+    friend class sqsCal;
+    friend class sqsHeap;
+    friend class sqsLadder;
+    friend class sqsWheel;
 public:
 
-    process( const string& name );
+    // Accessors
+
+    simtime_t evTime( void ) const { return _time; };
+    process*  proc( void )   const { return _proc; };
+
+protected:
+
+    absEvNotice( void ) :
+        _time( 0 ), _proc( 0 ), _prev( 0 ), _next( 0 ), _gprev( 0 ),
+        _gnext( 0 ), _bin( 0 ), _seq( 0 ), _index( 0 ), _level( 0 ) { };
+
+    simtime_t           _time;          // Event Time
+    process*            _proc;          // 0 if not in the sqs
+
+    absEvNotice*        _prev;          // In a list of the sqs
+    absEvNotice*        _next;
+    absEvNotice*        _gprev;         // In a group (sqsHeap, sqsLadder)
+    absEvNotice*        _gnext;
+    void*               _bin;           // Bin or bucket of the notice
+    long long           _seq;           // Order of the notices with the same time
+    unsigned int        _index;         // Heap entry, slot
+    int                 _level;         // Rung, level of a wheel
+
+private:
+    absEvNotice( const absEvNotice& );
+    absEvNotice& operator=( const absEvNotice& );
+};
+
+class process : public coroutine, public simset::link {
+    friend class sqs;
+public:
+
+    // A stackSize of 0 means coroutine::cStackSize
+    process( const string& name, size_t stackSize = 0 );
     virtual ~process( );
 
     virtual void main( void );
 
+    // Gives control to this process; called by the scheduler
+    virtual void dispatch( void ) { resume( ); };
+
     //
     // Modifiers
     //
     void activate( void );                      // put in front of the sqs
     void activateAfter( handle_p& q );          // activate AFTER q
     void activateBefore( handle_p& q );         // activate BEFORE q
-    void activateAt( double t );                // activate at time t
-    void activateDelay( double dt = 0.0 );      // activate with delay dt
+    void activateAt( simtime_arg t );           // activate at time t
+    void activateDelay( simtime_arg dt = 0 );   // activate with delay dt
 
     void reactivate( void );
     void reactivateAfter( handle_p& q );
     void reactivateBefore( handle_p& q );
-    void reactivateAt( double t );
-    void reactivateDelay( double dt = 0.0 );
+    void reactivateAt( simtime_arg t );
+    void reactivateDelay( simtime_arg dt = 0 );
 
     void cancel( void );                        // remove from the sqs
+
+    //
+    // Activates the idle processes of the range [first, last), which
+    // must not hold a process twice, at time t (now, if not given),
+    // with a single sqs::insertBatch( ). They keep the order of the
+    // range, before the processes already scheduled at time t: this
+    // is activateAt( t ) on each of them, from the last to the first.
+    // The range holds handles or pointers to processes.
+    //
+    template< class It > static void activateAll( It first, It last, simtime_arg t );
+    template< class It > static void activateAll( It first, It last );
     
     //
     // Accessors (const)
     //
-    bool        idle( void )       const { return ( 0 == _ev ); };
-    bool        terminated( void ) const { return _terminated; };
-    double      evTime( void )     const;
+    bool        idle( void )       const { return ( 0 == _ev._proc ); };
+    simtime_t   evTime( void )     const;
     int         id( void )         const { return _id; };
-    const string& name( void )     const { return _name; };
+    const string& name( void )     const { return *_name; };
     sqs*        getSqs( void )     const { return _s; };
-    absEvNotice* notice( void )    const { return _ev; };
+    absEvNotice* notice( void )          { return ( idle( ) ? 0 : &_ev ); };
+    const absEvNotice* notice( void ) const { return ( idle( ) ? 0 : &_ev ); };
+    virtual bool stackless( void ) const { return false; };
     static logger* getLogger( void ) 
     { 
-	return logger::instance( "libcppsim::process" );
+        // Looked up once, as the name would be allocated at each call
+        static logger* l = logger::instance( "libcppsim::process" );
+	return l;
     };
 
+    //
+    // Memory used by the live processes, broken down by component.
+    // Names are interned: processes with the same name share a single
+    // copy of it.
+    //
+    static unsigned long live( void )   { return _live; };
+    static void memoryReport( void );
+
 protected:
 
     //
     // Modifiers
     //
-    void hold( double dt );
+    void hold( simtime_arg dt );
     void passivate( void );
     void end_simulation( void );
 
@@ -91,23 +171,69 @@ protected:
     // Accessors
     //
     handle_p& current( void ) const;
-    double time( void ) const;
+    simtime_t time( void ) const;
 
     virtual void inner_body( void ) = 0;
 
-private:
+    //
+    // Scheduling operations of hold( ) and passivate( ), without the
+    // transfer of control to the scheduler
+    //
+    void prepareHold( simtime_t dt );
+    void preparePassivate( void );
+    void finish( void );
+
+    //
+    // Recycling (see recyclable.hh). recycle( ) is called when the last
+    // handle to the process is released, revive( ) when the process is
+    // handed out again.
+    //
+    virtual void recycle( void );
+    void revive( void );
 
     // Logging facility
-    void message( const handle_p& p, const char* fmt, ... );
+    static void message( const handle_p& p, const char* fmt, ... );
+
+    //
+    // The scheduling operations, on the sqs s of type Q. The operations
+    // above use them with Q = sqs, so that they work with any sqs
+    // through virtual calls; basic_process<Q> uses them with the actual
+    // type of its sqs, whose operations are final, so that the calls
+    // are direct. They are defined in basic_process.hh.
+    //
+    template< class Q > void activate( Q* s );
+    template< class Q > void activateAfter( Q* s, handle_p& q );
+    template< class Q > void activateBefore( Q* s, handle_p& q );
+    template< class Q > void activateAt( Q* s, simtime_t t );
+    template< class Q > void activateDelay( Q* s, simtime_t dt );
+    template< class Q > void reactivate( Q* s );
+    template< class Q > void reactivateAfter( Q* s, handle_p& q );
+    template< class Q > void reactivateBefore( Q* s, handle_p& q );
+    template< class Q > void reactivateAt( Q* s, simtime_t t );
+    template< class Q > void reactivateDelay( Q* s, simtime_t dt );
+    template< class Q > void cancel( Q* s );
+    template< class Q, class It > static void activateAll( Q* s, It first, It last, simtime_t t );
+    template< class Q > void prepareHold( Q* s, simtime_t dt );
+    template< class Q > void preparePassivate( Q* s );
+    template< class Q > static simtime_t time( Q* s );
+
+    // Gives control to the next process, or back to the scheduler
+    template< class Q > void suspend( Q* s );
+
+private:
+
+    static const string* intern( const string& name );
 
-    const int           _id;
-    const string        _name;
-    bool                _terminated;
+    int                 _id;
+    const string*       _name;          // Interned
     sqs*                _s;  
-    absEvNotice*        _ev;
+    absEvNotice         _ev;            // In the sqs, unless idle( )
+    idleNode*           _idle;          // In the idle list of the sqs, if any
 
     // Static members
     static int          _idCount;
+    static unsigned long _live;
+    static vector< handle_p > _batch;   // Used by activateAll( )
 };
 
 #endif
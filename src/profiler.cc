@@ -0,0 +1,166 @@
+/*****************************************************************************
+ *
+ * profiler.cc
+ *
+ * Profiling of coroutine switches and of the time spent in each class
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+#include "profiler.hh"
+#include "coroutine.hh"
+
+bool profiler::cEnabled = false;
+profiler* profiler::_instance = 0;
+
+profiler::profiler( ) :
+    _sliceStart ( 0 ),
+    _switchStart( 0 ),
+    _switchNs   ( 0 ),
+    _switches   ( 0 ),
+    _events     ( 0 )
+{
+
+}
+
+profiler* profiler::instance( void )
+{
+    if ( 0 == _instance )
+        _instance = new profiler( );
+    return _instance;
+}
+
+uint64_t profiler::now( void )
+{
+    struct timespec t;
+    clock_gettime( CLOCK_MONOTONIC, &t );
+    return (uint64_t)t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+void profiler::enable( bool e )
+{
+    if ( e && !cEnabled )
+        _sliceStart = _switchStart = now( );
+    cEnabled = e;
+}
+
+void profiler::reset( void )
+{
+    _stats.clear( );
+    _switchNs = 0;
+    _switches = 0;
+    _events = 0;
+    _sliceStart = _switchStart = now( );
+}
+
+void profiler::leave( const coroutine* c )
+{
+    uint64_t t = now( );
+    classStats_t& s( _stats[ &typeid( *c ) ] );
+    s.slices++;
+    s.ns += t - _sliceStart;
+    _switchStart = t;
+}
+
+void profiler::arrive( void )
+{
+    uint64_t t = now( );
+    _switchNs += t - _switchStart;
+    _switches++;
+    _sliceStart = t;
+}
+
+unsigned long profiler::slices( const type_info& t ) const
+{
+    stats_t::const_iterator it = _stats.find( &t );
+    return ( it == _stats.end( ) ? 0 : it->second.slices );
+}
+
+double profiler::switchTime( void ) const
+{
+    return ( _switches > 0 ? (double)_switchNs / _switches : 0.0 );
+}
+
+string profiler::className( const type_info& t )
+{
+    string result( t.name( ) );
+#ifdef __GNUG__
+    int status;
+    char* demangled = abi::__cxa_demangle( t.name( ), 0, 0, &status );
+    if ( 0 == status ) {
+        result = demangled;
+        free( demangled );
+    }
+#endif
+    return result;
+}
+
+typedef pair< uint64_t, const type_info* > byTime_t;
+
+void profiler::report( void ) const
+{
+    uint64_t total = _switchNs;
+    vector< byTime_t > byTime;
+    stats_t::const_iterator it;
+    for ( it = _stats.begin( ); it != _stats.end( ); it++ ) {
+        total += it->second.ns;
+        byTime.push_back( byTime_t( it->second.ns, it->first ) );
+    }
+    sort( byTime.rbegin( ), byTime.rend( ) );
+
+    cout << endl
+         << "Profile:" << endl
+         << "  Num. of switches............." << _switches << endl
+         << "  Mean ns per switch..........." << switchTime( ) << endl
+         << "  Time spent switching (%)....." 
+         << ( total > 0 ? 100.0 * _switchNs / total : 0.0 ) << endl
+         << "  Num. of events..............." << _events << endl
+         << "  Events per second............"
+         << ( total > 0 ? 1e9 * _events / total : 0.0 ) << endl
+         << endl
+         << "  " << left << setw( 30 ) << "Class"
+         << right << setw( 12 ) << "Slices"
+         << setw( 12 ) << "Time (ms)"
+         << setw( 8 ) << "%"
+         << setw( 12 ) << "ns/slice" << endl;
+    vector< byTime_t >::const_iterator b;
+    for ( b = byTime.begin( ); b != byTime.end( ); b++ ) {
+        const classStats_t& s( _stats.find( b->second )->second );
+        cout << "  " << left << setw( 30 ) << className( *b->second )
+             << right << setw( 12 ) << s.slices
+             << setw( 12 ) << fixed << setprecision( 2 ) << s.ns * 1e-6
+             << setw( 8 ) << 100.0 * s.ns / total
+             << setw( 12 ) << setprecision( 0 ) << (double)s.ns / s.slices
+             << endl;
+        cout.unsetf( ios::floatfield );
+        cout << setprecision( 6 );
+    }
+    cout << endl;
+}
@@ -0,0 +1,95 @@
+/*****************************************************************************
+ *
+ * profiler.hh
+ *
+ * Profiling of coroutine switches and of the time spent in each class
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#ifndef CPPSIM_PROFILER_HH
+#define CPPSIM_PROFILER_HH
+
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <stdint.h>
+
+using namespace std;
+
+class coroutine;
+
+//
+// The profiler timestamps every coroutine switch, and charges the
+// wall time between two switches to the class of the coroutine which
+// was running (a "slice"), and the time spent inside the switch itself
+// to the switch. The scheduler is a coroutine as well, so its time is
+// reported under the name of its sqs class; stackless processes run
+// on the scheduler stack, and are charged to the scheduler.
+//
+// When the profiler is disabled, each switch only tests cEnabled.
+//
+class profiler {
+public:
+    virtual ~profiler( ) { };
+
+    static bool cEnabled;
+
+    // Starts (or stops) profiling
+    void enable( bool e );
+
+    // Called on each switch, before and after it, if cEnabled
+    void leave( const coroutine* c );
+    void arrive( void );
+
+    // Called by the scheduler at the end of the simulation
+    void countEvents( unsigned long n ) { _events += n; };
+
+    void reset( void );
+
+    // Accessors
+    unsigned long switches( void ) const        { return _switches; };
+    unsigned long slices( const type_info& t ) const;
+    double switchTime( void ) const;            // Mean, in ns
+    void report( void ) const;
+
+    static profiler* instance( void );
+
+    // Demangled name of a class
+    static string className( const type_info& t );
+
+protected:
+    profiler( );
+
+    static uint64_t now( void );
+
+    struct classStats_t {
+        unsigned long   slices;
+        uint64_t        ns;
+    };
+    typedef unordered_map< const type_info*, classStats_t > stats_t;
+
+    stats_t             _stats;
+    uint64_t            _sliceStart;
+    uint64_t            _switchStart;
+    uint64_t            _switchNs;      // Total time spent switching
+    unsigned long       _switches;
+    unsigned long       _events;
+    static profiler*    _instance;
+};
+
+#endif
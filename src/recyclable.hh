@@ -0,0 +1,100 @@
+/*****************************************************************************
+ *
+ * recyclable.hh
+ *
+ * Recycling of process objects
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#ifndef CPPSIM_RECYCLABLE_HH
+#define CPPSIM_RECYCLABLE_HH
+
+#include <utility>
+#include <vector>
+#include "process.hh"
+
+//
+// Processes of class T which derive from recyclable<T> are not
+// destroyed when their last handle is released: they are reset, and
+// put in a free list of class T. T::create( args ) takes an object
+// from the free list, and reinitializes it by calling the public
+// method T::reinit( args ); if the free list is empty, it returns
+// new T( args ). A recycled process gets a new id and starts again
+// from the beginning of its body, but it keeps its name.
+//
+//     class job : public recyclable<job> {
+//     public:
+//         job( const string& name ) : recyclable<job>( name ), _t( time( ) ) { };
+//         void reinit( const string& ) { _t = time( ); };
+//     ...
+//     };
+//
+//     handle<job> j( job::create( "job" ) );
+//
+// Base is the class T actually derives from (process or coprocess).
+//
+template< class T, class Base = process >
+class recyclable : public Base {
+    template< class > friend class handle;
+public:
+    template< class... Args >
+    static T* create( Args&&... args )
+    {
+        vector< T* >& fl( freeList( ) );
+        if ( fl.empty( ) )
+            return new T( std::forward< Args >( args )... );
+        T* obj = fl.back( );
+        fl.pop_back( );
+        obj->revive( );
+        obj->reinit( std::forward< Args >( args )... );
+        return obj;
+    };
+
+    // Num. of objects in the free list
+    static size_t available( void )     { return freeList( ).size( ); };
+
+    // Destroys the objects in the free list
+    static void trim( void )
+    {
+        vector< T* >& fl( freeList( ) );
+        while ( !fl.empty( ) ) {
+            delete fl.back( );
+            fl.pop_back( );
+        }
+    };
+
+protected:
+    template< class... Args >
+    recyclable( Args&&... args ) : Base( std::forward< Args >( args )... ) { };
+
+    void dispose( void )
+    {
+        this->recycle( );
+        freeList( ).push_back( static_cast< T* >( this ) );
+    };
+
+    // Never destroyed, as handles may be released during the
+    // destruction of static objects
+    static vector< T* >& freeList( void )
+    {
+        static vector< T* >* fl = new vector< T* >( );
+        return *fl;
+    };
+};
+
+#endif
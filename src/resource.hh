@@ -26,7 +26,6 @@
 #define _RESOURCE_HH_
 
 #include "process.hh"
-#include <list>
 
 class resource {
 
@@ -42,7 +41,7 @@ public:
 protected:
 
     unsigned int _quantity;
-    list< handle<process> > _pending;
+    simset::head _pending;
 
 };
 
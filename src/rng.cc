@@ -19,9 +19,6 @@
  *
  *****************************************************************************/
 
-extern "C" {
-#include "mrand.h"
-}
 #include <cmath>
 #include <cassert>
 #include <iostream>
@@ -29,7 +26,9 @@ extern "C" {
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <algorithm>
 #include "rng.hh"
+#include "rngkernels.hh"
 
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -37,12 +36,87 @@ extern "C" {
 //
 //////////////////////////////////////////////////////////////////////////////
 
-rngUniform01::seed_t rngUniform01::_globalSeed = { 0.0, 0.0, 1.0, 0.0, 0.0, 1.0 };
+rngUniform01::seed_t rngUniform01::_nextSeed = { 12345.0, 12345.0, 12345.0, 12345.0, 12345.0, 12345.0 };
 const double rngUniform01::norm  = 2.328306549295728e-10;  /* 1.0/(m1+1) */
-const double rngUniform01::norm2 = 2.328318825240738e-10;  /* 1.0/(m2+1) */
 const double rngUniform01::m1 = 4294967087.0;
 const double rngUniform01::m2 = 4294944443.0;
-unsigned int rngUniform01::maxSeqLen = 1000;
+
+//
+// Jump-ahead. The state (s0, s1, s2) of a component is moved n values
+// ahead by the product with the n-th power of the matrix of its
+// recurrence, modulo m. The values are less than 2^32, so that their
+// products fit in 64 bits.
+//
+typedef unsigned long long jump_t[3][3];
+
+static const unsigned long long M1 = 4294967087ULL;
+static const unsigned long long M2 = 4294944443ULL;
+
+// The matrices of the two components
+static const jump_t A1 = { {          0,          1,          0 },
+                           {          0,          0,          1 },
+                           { M1 - 810728,   1403580,          0 } };
+static const jump_t A2 = { {          0,          1,          0 },
+                           {          0,          0,          1 },
+                           { M2 - 1370589,        0,     527612 } };
+
+// A1^(2^76), A2^(2^76): the start of the next substream
+static const jump_t A1p76 = { {   82758667, 1871391091, 4127413238 },
+                              { 3672831523,   69195019, 1871391091 },
+                              { 3672091415, 3528743235,   69195019 } };
+static const jump_t A2p76 = { { 1511326704, 3759209742, 1610795712 },
+                              { 4292754251, 1511326704, 3889917532 },
+                              { 3859662829, 4292754251, 3708466080 } };
+
+// A1^(2^127), A2^(2^127): the start of the next stream
+static const jump_t A1p127 = { { 2427906178, 3580155704,  949770784 },
+                               {  226153695, 1230515664, 3580155704 },
+                               { 1988835001,  986791581, 1230515664 } };
+static const jump_t A2p127 = { { 1464411153,  277697599, 1610723613 },
+                               {   32183930, 1464411153, 1022607788 },
+                               { 2824425944,   32183930, 2093834863 } };
+
+// v = A v mod m
+static void matVecModM( const jump_t A, double* v, unsigned long long m )
+{
+    unsigned long long x[3];
+    for ( int i=0; i<3; i++ ) {
+        x[i] = 0;
+        for ( int j=0; j<3; j++ )
+            x[i] = ( x[i] + A[i][j] * (unsigned long long)v[j] % m ) % m;
+    }
+    for ( int i=0; i<3; i++ )
+        v[i] = (double)x[i];
+}
+
+// C = A B mod m; C may be A or B
+static void matMatModM( const jump_t A, const jump_t B, jump_t C, unsigned long long m )
+{
+    jump_t x;
+    for ( int i=0; i<3; i++ )
+        for ( int j=0; j<3; j++ ) {
+            x[i][j] = 0;
+            for ( int k=0; k<3; k++ )
+                x[i][j] = ( x[i][j] + A[i][k] * B[k][j] % m ) % m;
+        }
+    memcpy( C, x, sizeof( x ) );
+}
+
+// B = A^n mod m, by repeated squaring
+static void matPowModM( const jump_t A, jump_t B, unsigned long long m, unsigned long long n )
+{
+    jump_t W;
+    memcpy( W, A, sizeof( W ) );
+    for ( int i=0; i<3; i++ )
+        for ( int j=0; j<3; j++ )
+            B[i][j] = ( i == j );
+    while ( n > 0 ) {
+        if ( n & 1 )
+            matMatModM( W, B, B, m );
+        matMatModM( W, W, W, m );
+        n >>= 1;
+    }
+}
 
 double rngUniform01::draw( seed_t s )
 {
@@ -68,40 +142,113 @@ double rngUniform01::draw( seed_t s )
         return ((s12 - s22) * norm);
 }
 
-//
-// Advance the global seed space
-//
-void rngUniform01::advance( unsigned int count )
+rngUniform01::rngUniform01( const string& name ) :
+    rng_impl( name )
 {
-    while( count-- > 0 )
-        draw( _globalSeed );
+    memcpy( _stream, _nextSeed, sizeof( _nextSeed ) );
+    memcpy( _substream, _nextSeed, sizeof( _nextSeed ) );
+    memcpy( _mySeed, _nextSeed, sizeof( _nextSeed ) );
+    matVecModM( A1p127, _nextSeed, M1 );
+    matVecModM( A2p127, _nextSeed + 3, M2 );
 }
 
-rngUniform01::rngUniform01( const string& name ) :
-    rng_impl( name ),
-    _seqLen( maxSeqLen )
+double rngUniform01::value( void )
 {
-    memcpy( _mySeed, _globalSeed, sizeof( _globalSeed ) );
-    advance( maxSeqLen );
+    _numDraws++;
+    return draw( _mySeed );
 }
 
-double rngUniform01::value( void )
+//
+// The values are drawn by rngKernels::lanes generators side by side,
+// each of them running a consecutive segment of len values of the
+// stream; the start of each segment is found by a jump of len values
+// from the start of the previous one. The result is the same sequence
+// of values as n calls to value( ), and the state is left where they
+// would leave it. Below minFillLen values per segment the jumps cost
+// more than they save.
+//
+static const size_t minFillLen = 32;
+
+void rngUniform01::fill( double* out, size_t n )
 {
-    double result = draw( _mySeed );
-    if ( 0 == _seqLen-- ) {
-        _seqLen = maxSeqLen;
-        memcpy( _mySeed, _globalSeed, sizeof( _globalSeed ) );
-        advance( maxSeqLen );
+    static unsigned long long jumpLen = 0;      // The jumps of the last fill( )
+    static jump_t B1, B2;
+    const size_t len = n / rngKernels::lanes;
+
+    _numDraws += n;
+    if ( len < minFillLen ) {
+        for ( size_t i=0; i<n; i++ )
+            out[i] = draw( _mySeed );
+        return;
     }
-    return result;
+    if ( len != jumpLen ) {
+        matPowModM( A1, B1, M1, len );
+        matPowModM( A2, B2, M2, len );
+        jumpLen = len;
+    }
+    double st[6][ rngKernels::lanes ];
+    seed_t s;
+    memcpy( s, _mySeed, sizeof( s ) );
+    for ( int l=0; l<rngKernels::lanes; l++ ) {
+        for ( int k=0; k<6; k++ )
+            st[k][l] = s[k];
+        matVecModM( B1, s, M1 );
+        matVecModM( B2, s + 3, M2 );
+    }
+    rngKernels::mrg32k3a( st, out, len );
+    for ( int k=0; k<6; k++ )
+        _mySeed[k] = st[k][ rngKernels::lanes - 1 ];
+    for ( size_t i=rngKernels::lanes * len; i<n; i++ )
+        out[i] = draw( _mySeed );
 }
 
 void rngUniform01::reset( void )
 {
     _numResets++;
-    memcpy( _mySeed, _globalSeed, sizeof( _globalSeed ) );
-    _seqLen = maxSeqLen;
-    advance( maxSeqLen );
+    resetNextSubstream( );
+}
+
+void rngUniform01::resetStartStream( void )
+{
+    memcpy( _substream, _stream, sizeof( _stream ) );
+    memcpy( _mySeed, _stream, sizeof( _stream ) );
+}
+
+void rngUniform01::resetStartSubstream( void )
+{
+    memcpy( _mySeed, _substream, sizeof( _substream ) );
+}
+
+void rngUniform01::resetNextSubstream( void )
+{
+    matVecModM( A1p76, _substream, M1 );
+    matVecModM( A2p76, _substream + 3, M2 );
+    memcpy( _mySeed, _substream, sizeof( _substream ) );
+}
+
+void rngUniform01::advanceState( unsigned long long n )
+{
+    jump_t B;
+    matPowModM( A1, B, M1, n );
+    matVecModM( B, _mySeed, M1 );
+    matPowModM( A2, B, M2, n );
+    matVecModM( B, _mySeed + 3, M2 );
+}
+
+void rngUniform01::getState( unsigned long seed[6] ) const
+{
+    for ( int i=0; i<6; i++ )
+        seed[i] = (unsigned long)_mySeed[i];
+}
+
+void rngUniform01::setPackageSeed( const unsigned long seed[6] )
+{
+    assert( seed[0] < M1 && seed[1] < M1 && seed[2] < M1 );
+    assert( seed[3] < M2 && seed[4] < M2 && seed[5] < M2 );
+    assert( seed[0] || seed[1] || seed[2] );
+    assert( seed[3] || seed[4] || seed[5] );
+    for ( int i=0; i<6; i++ )
+        _nextSeed[i] = (double)seed[i];
 }
 
 void rngUniform01::report( void ) const
@@ -135,6 +282,14 @@ double rngUniform::value( void )
     return U1.value( )*(_b - _a) + _a;
 }
 
+void rngUniform::fill( double* out, size_t n )
+{
+    _numDraws += n;
+    U1.fill( out, n );
+    for ( size_t i=0; i<n; i++ )
+        out[i] = out[i]*(_b - _a) + _a;
+}
+
 void rngUniform::reset( void )
 {
     _numResets++;
@@ -199,25 +354,101 @@ void rngDiscUniform::report( void ) const
 // with probability p[0], p[1], ... p[n]
 //
 //////////////////////////////////////////////////////////////////////////////
-rngDiscEmpirical::rngDiscEmpirical( const string& name, const vector<double>& p ) :
+rngDiscEmpirical::rngDiscEmpirical( const string& name, const vector<double>& p,
+                                    method_t method ) :
     rng_impl    ( name ),
     _p          ( p ),
+    _method     ( method ),
     U1          ( "U1_"+name )
 {
     assert( _p.size( ) > 0 );
+    assert( _method == alias || _method == inversion );
+    const size_t n = _p.size( );
+
+    // The cumulative probabilities, summed in the order of the linear
+    // search, so that the inversion gives exactly the same values
+    _cdf.resize( n - 1 );
+    double sum = 0.0;
+    for ( size_t i=0; i+1<n; i++ ) {
+        sum += _p[i];
+        _cdf[i] = sum;
+    }
+    if ( _method == inversion )
+        return;
+
+    // The probabilities the inversion gives, scaled by n
+    vector<double> q( n );
+    double prev = 0.0;
+    for ( size_t i=0; i<n; i++ ) {
+        double c = ( i+1 < n ? min( _cdf[i], 1.0 ) : 1.0 );
+        q[i] = max( c - prev, 0.0 ) * n;
+        prev = max( c, prev );
+    }
+    _cdf.clear( );
+
+    // Vose: each column below 1 is topped up by a column above 1,
+    // which becomes its alias
+    _prob.resize( n );
+    _alias.resize( n );
+    vector<int> small, large;
+    for ( size_t i=0; i<n; i++ ) {
+        if ( q[i] < 1.0 )
+            small.push_back( i );
+        else
+            large.push_back( i );
+    }
+    while ( !small.empty( ) && !large.empty( ) ) {
+        int s = small.back( ), l = large.back( );
+        small.pop_back( );
+        _prob[s] = q[s];
+        _alias[s] = l;
+        q[l] = ( q[l] + q[s] ) - 1.0;
+        if ( q[l] < 1.0 ) {
+            large.pop_back( );
+            small.push_back( l );
+        }
+    }
+    // What is left is 1 up to the rounding errors
+    for ( size_t i=0; i<large.size( ); i++ ) {
+        _prob[ large[i] ] = 1.0;
+        _alias[ large[i] ] = large[i];
+    }
+    for ( size_t i=0; i<small.size( ); i++ ) {
+        _prob[ small[i] ] = 1.0;
+        _alias[ small[i] ] = small[i];
+    }
+}
+
+int rngDiscEmpirical::draw( double u ) const
+{
+    if ( _method == alias ) {
+        const double x = u * _prob.size( );
+        int i = (int)x;
+        if ( i >= (int)_prob.size( ) )
+            i = _prob.size( ) - 1;
+        return ( x - i < _prob[i] ? i : _alias[i] );
+    }
+    // The first i with u < _cdf[i], or the last value
+    return upper_bound( _cdf.begin( ), _cdf.end( ), u ) - _cdf.begin( );
 }
 
 int rngDiscEmpirical::value( void )
 {
     _numDraws++;
-    const double tmp = U1.value( );
-    double sum = 0.0;
-    int i;
-    for ( i=0; i<(int)_p.size( )-1; i++ ) {
-        sum += _p[i];
-        if ( tmp < sum ) return i;
+    return draw( U1.value( ) );
+}
+
+void rngDiscEmpirical::fill( int* out, size_t n )
+{
+    const size_t block = 256;
+    double u[ block ];
+    _numDraws += n;
+    for ( size_t i=0; i<n; i += block ) {
+        const size_t m = min( block, n - i );
+        U1.fill( u, m );
+        for ( size_t j=0; j<m; j++ )
+            out[ i+j ] = draw( u[j] );
     }
-    return (int)i;
 }
 
 void rngDiscEmpirical::reset( void )
@@ -259,6 +490,13 @@ double rngExp::value( void )
     return (double)(-log( 1.0 - U1.value( ) ) * _mean );
 }
 
+void rngExp::fill( double* out, size_t n )
+{
+    _numDraws += n;
+    U1.fill( out, n );
+    rngKernels::negLog1m( out, n, _mean );
+}
+
 void rngExp::reset( void )
 {
     _numResets++;
@@ -292,9 +530,17 @@ rngWeib::rngWeib( const string& name, double a, double b ) :
 
 double rngWeib::value( void )
 {
+    _numDraws++;
     return _a*pow( -log( 1.0 - U1.value() ), 1.0/_b );
 };
 
+void rngWeib::fill( double* out, size_t n )
+{
+    _numDraws += n;
+    U1.fill( out, n );
+    rngKernels::weibull( out, n, _a, _b );
+}
+
 void rngWeib::reset( void )
 {
     _numResets++;
@@ -526,6 +772,36 @@ double rngNormal::value( void )
     return val[ _numDraws % 2 ];
 }
 
+//
+// The pairs are transformed a block at a time. A value left over from
+// the last pair (that is, an odd number of draws so far) comes first;
+// if n is then odd, the last pair is drawn by value( ), which keeps its
+// second value for the next draw.
+//
+void rngNormal::fill( double* out, size_t n )
+{
+    const size_t block = 128;
+    double u1[ block ], u2[ block ];
+    size_t i = 0;
+
+    if ( n > 0 && 1 == ( _numDraws % 2 ) ) {
+        _numDraws++;
+        out[ i++ ] = val[0];
+    }
+    while ( n - i >= 2 ) {
+        size_t pairs = ( n - i ) / 2;
+        if ( pairs > block )
+            pairs = block;
+        U1.fill( u1, pairs );
+        U2.fill( u2, pairs );
+        rngKernels::boxMuller( u1, u2, out + i, pairs, _mu, sqrt( _sigmasq ) );
+        _numDraws += 2 * pairs;
+        i += 2 * pairs;
+    }
+    if ( i < n )
+        out[i] = value( );
+}
+
 void rngNormal::reset( void )
 {
     _numResets++;
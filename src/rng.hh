@@ -38,6 +38,19 @@ class rng : public var< double, T > {
 public:
     typedef var< double, T > var_impl;
     virtual ~rng( ) { };
+
+    //
+    // Draws the next n values at once, as n calls to value( ) would.
+    // The generators below which override it compute the values in
+    // blocks, with the vector kernels of rngkernels.hh; the values
+    // are the same, except possibly for the last bits of those which
+    // go through a logarithm, an exponential or a sine.
+    //
+    virtual void fill( T* out, size_t n )
+    {
+        for ( size_t i=0; i<n; i++ )
+            out[i] = this->value( );
+    };
 protected:
     rng( const string& name ) :
         var_impl        ( name ),
@@ -57,6 +70,21 @@ private:
 //
 // Uniform distribution in [0,1]
 //
+// The combined multiple recursive generator MRG32k3a of L'Ecuyer,
+// with streams and substreams as in the RngStreams package (P.
+// L'Ecuyer, R. Simard, E. J. Chen and W. D. Kelton, An
+// object-oriented random-number package with many long streams and
+// substreams, Operations Research 50(6), 2002). Each rngUniform01
+// gets its own stream, which starts 2^127 values after the start of
+// the stream created before it; a stream is split in substreams of
+// 2^76 values each. The start of the next stream, and of the next
+// substream, are computed by a multiplication by a precomputed
+// matrix, so creating a stream takes constant time.
+//
+// reset( ) moves to the start of the next substream, so that the
+// replications of a simulation use disjoint substreams, and can be
+// reproduced by resetStartStream( ) and as many reset( ).
+//
 //////////////////////////////////////////////////////////////////////////////
 class rngUniform01 : public rng<double> {
 public:
@@ -65,25 +93,42 @@ public:
     rngUniform01( const string& name );
     virtual ~rngUniform01( ) { };
     double value( void );
+    void fill( double* out, size_t n );
     void reset( void );
     void report( void ) const;
 
-    static unsigned int maxSeqLen;
+    // Back to the start of the stream, of the current substream, or
+    // on to the start of the next substream
+    void resetStartStream( void );
+    void resetStartSubstream( void );
+    void resetNextSubstream( void );
+
+    // Skips the next n values of the stream, in time logarithmic in n
+    void advanceState( unsigned long long n );
+
+    // The state of the generator: the three last values of each of
+    // the two components
+    void getState( unsigned long seed[6] ) const;
+
+    // Sets the start of the next stream to be created. The first three
+    // values must be less than 4294967087 and not all 0, the last
+    // three less than 4294944443 and not all 0. The default is 12345
+    // for all of them.
+    static void setPackageSeed( const unsigned long seed[6] );
 
 protected:
 
     typedef double seed_t[6];
 
     double draw( seed_t );
-    void advance( unsigned int count );
 
-    seed_t              _mySeed;
-    unsigned int        _seqLen;
+    seed_t              _mySeed;        // Current state
+    seed_t              _substream;     // Start of the current substream
+    seed_t              _stream;        // Start of the stream
 
     // Static members
-    static seed_t       _globalSeed;
+    static seed_t       _nextSeed;      // Start of the next stream
     static const double norm;
-    static const double norm2;
     static const double m1;
     static const double m2;
 };
@@ -103,6 +148,7 @@ public:
     rngUniform( const string& name, double a, double b );
     virtual ~rngUniform( ) { };
     double value( void );
+    void fill( double* out, size_t n );
     void reset( void );
     void report( void ) const;
 protected:
@@ -125,6 +171,7 @@ public:
     rngWeib( const string& name, double a, double b );
     virtual ~rngWeib( ) { };
     double value( void );
+    void fill( double* out, size_t n );
     void reset( void );
     void report( void ) const;
 protected:
@@ -150,6 +197,11 @@ public:
         _numDraws++;
         return _mean;
     };
+    void fill( double* out, size_t n ) {
+        _numDraws += n;
+        for ( size_t i=0; i<n; i++ )
+            out[i] = _mean;
+    };
     void reset( void ) {
         _numUpdates = 0;
         _numResets++;
@@ -231,6 +283,7 @@ public:
     rngNormal( const string& name, double mu, double sigmasq );
     virtual ~rngNormal( ) { };
     double value( void );
+    void fill( double* out, size_t n );
     void reset( void );
     void report( void ) const;
 protected:
@@ -331,18 +384,41 @@ protected:
 //
 // Discrete Empirical Distribution
 //
+// Returns i with probability p[i], i = 0, ..., p.size( )-1; the last
+// value takes whatever probability the others leave, and the values
+// whose cumulative probability is beyond 1 are never returned.
+//
+// With the alias method (the default), the constructor builds the
+// alias table of Walker, with the algorithm of Vose, and each draw
+// takes constant time: one uniform value picks a column of the table
+// and decides between the column and its alias. With the inversion
+// method, each draw is a binary search of the uniform value in the
+// cumulative distribution, in time logarithmic in p.size( ); the
+// result is then a nondecreasing function of the uniform value, as
+// common random numbers and antithetic variates need, and the same
+// as that of the linear search of the previous versions.
+//
 //////////////////////////////////////////////////////////////////////////////
 class rngDiscEmpirical : public rng<int> {
 public:
     typedef rng<int> rng_impl;
+    enum method_t { alias, inversion };
 
-    rngDiscEmpirical( const string& name, const vector<double>& p );
+    rngDiscEmpirical( const string& name, const vector<double>& p,
+                      method_t method = alias );
     virtual ~rngDiscEmpirical( ) { };
     int value( void );
+    void fill( int* out, size_t n );
     void reset( void );
     void report( void ) const;
 protected:
+    int draw( double u ) const;
+
     vector<double> _p;
+    method_t    _method;
+    vector<double> _cdf;        // Inversion: cumulative probabilities
+    vector<double> _prob;       // Alias: probability of keeping each column
+    vector<int> _alias;         // Alias: the alias of each column
     rngUniform01 U1;
 };
 
@@ -361,6 +437,7 @@ public:
     rngExp( const string& name, double mean );
     virtual ~rngExp( ) { };
     double value( void );
+    void fill( double* out, size_t n );
     void reset( void );
     void report( void ) const;
 protected:
@@ -368,4 +445,53 @@ protected:
     rngUniform01 U1;
 };
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// Buffered generator
+//
+// Draws the values of the generator r in blocks of size values, with
+// fill( ), and hands them out one by one: value( ) returns the same
+// values as r->value( ) would, but the transforms of the variates are
+// done a block at a time. r is not owned, and should only be used
+// through the buffer. reset( ) resets r and empties the buffer. T
+// cannot be bool, whose vector has no contiguous storage.
+//
+//////////////////////////////////////////////////////////////////////////////
+template< class T >
+class rngBuffer : public rng<T> {
+public:
+    typedef rng<T> rng_impl;
+
+    rngBuffer( const string& name, rng<T>* r, size_t size = 256 ) :
+        rng_impl        ( name ),
+        _rng            ( r ),
+        _buf            ( size ),
+        _next           ( size )
+    {
+        assert( r );
+        assert( size > 0 );
+    };
+    virtual ~rngBuffer( ) { };
+    T value( void ) {
+        if ( _next == _buf.size( ) ) {
+            _rng->fill( &_buf[0], _buf.size( ) );
+            _next = 0;
+        }
+        this->_numDraws++;
+        return _buf[ _next++ ];
+    };
+    void reset( void ) {
+        this->_numResets++;
+        _rng->reset( );
+        _next = _buf.size( );
+    };
+    void report( void ) const {
+        _rng->report( );
+    };
+protected:
+    rng<T>*     _rng;
+    vector<T>   _buf;
+    size_t      _next;          // Next value of _buf to hand out
+};
+
 #endif
@@ -0,0 +1,286 @@
+/*****************************************************************************
+ *
+ * rngkernels.cc -- Vector kernels of the bulk random number generation
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include "rngkernels.hh"
+
+// The scalar and the vector code must round the same way: no fused
+// multiply-add
+#if defined( __clang__ )
+#pragma clang fp contract( off )
+#elif defined( __GNUC__ )
+#pragma GCC optimize( "fp-contract=off" )
+#endif
+
+#if defined( __GNUC__ ) && defined( __x86_64__ )
+#define CPPSIM_RNG_AVX2 1
+#include <immintrin.h>
+#elif defined( __aarch64__ ) && defined( __ARM_NEON )
+#define CPPSIM_RNG_NEON 1
+#include <arm_neon.h>
+#endif
+
+bool rngKernels::_vector = true;
+
+//
+// 2^52 + 1022 and 2^52 + 1023: adding 2^52 to a small integral double
+// puts the integer in the low bits of its representation
+//
+static const double magicExp = 4503599627370496.0 + 1022.0;
+static const double magicBias = 4503599627370496.0 + 1023.0;
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Scalar code
+//
+//////////////////////////////////////////////////////////////////////////////
+#define CPPSIM_RNG_TARGET
+
+namespace {
+namespace portable {
+
+struct ops {
+    typedef double V;
+    typedef bool M;
+    enum { width = 1 };
+
+    static V set1( double x ) { return x; };
+    static V load( const double* p ) { return *p; };
+    static void store( double* p, V v ) { *p = v; };
+    static V floor( V x ) { return std::floor( x ); };
+    static V trunc( V x ) { return std::trunc( x ); };
+    static V sqrt( V x ) { return std::sqrt( x ); };
+    static M lt( V a, V b ) { return a < b; };
+    static M le( V a, V b ) { return a <= b; };
+    static M eq( V a, V b ) { return a == b; };
+    static M orM( M m, M n ) { return m || n; };
+    static V select( M m, V a, V b ) { return m ? a : b; };
+
+    static uint64_t bits( V x ) { uint64_t b; memcpy( &b, &x, sizeof( b ) ); return b; };
+    static V fromBits( uint64_t b ) { V x; memcpy( &x, &b, sizeof( x ) ); return x; };
+
+    static V frexp( V x, V& e )
+    {
+        uint64_t b = bits( x );
+        e = fromBits( ( b >> 52 ) | 0x4330000000000000ULL ) - magicExp;
+        return fromBits( ( b & 0x000fffffffffffffULL ) | 0x3fe0000000000000ULL );
+    };
+    static V ldexp( V x, V n )
+    {
+        return x * fromBits( bits( n + magicBias ) << 52 );
+    };
+};
+
+#include "rngsimd.hh"
+
+} // namespace portable
+} // namespace
+
+#undef CPPSIM_RNG_TARGET
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// AVX2. Every function is compiled for AVX2, whatever the flags of
+// the compiler, by its target attribute, and is called only if the
+// processor has AVX2.
+//
+//////////////////////////////////////////////////////////////////////////////
+#if defined( CPPSIM_RNG_AVX2 )
+
+#define CPPSIM_RNG_TARGET __attribute__(( target( "avx2" ) ))
+
+namespace {
+namespace avx2 {
+
+struct ops {
+    typedef __m256d V;
+    typedef __m256d M;
+    enum { width = 4 };
+
+    static CPPSIM_RNG_TARGET V set1( double x ) { return _mm256_set1_pd( x ); };
+    static CPPSIM_RNG_TARGET V load( const double* p ) { return _mm256_loadu_pd( p ); };
+    static CPPSIM_RNG_TARGET void store( double* p, V v ) { _mm256_storeu_pd( p, v ); };
+    static CPPSIM_RNG_TARGET V floor( V x ) { return _mm256_round_pd( x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC ); };
+    static CPPSIM_RNG_TARGET V trunc( V x ) { return _mm256_round_pd( x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC ); };
+    static CPPSIM_RNG_TARGET V sqrt( V x ) { return _mm256_sqrt_pd( x ); };
+    static CPPSIM_RNG_TARGET M lt( V a, V b ) { return _mm256_cmp_pd( a, b, _CMP_LT_OQ ); };
+    static CPPSIM_RNG_TARGET M le( V a, V b ) { return _mm256_cmp_pd( a, b, _CMP_LE_OQ ); };
+    static CPPSIM_RNG_TARGET M eq( V a, V b ) { return _mm256_cmp_pd( a, b, _CMP_EQ_OQ ); };
+    static CPPSIM_RNG_TARGET M orM( M m, M n ) { return _mm256_or_pd( m, n ); };
+    static CPPSIM_RNG_TARGET V select( M m, V a, V b ) { return _mm256_blendv_pd( b, a, m ); };
+
+    static CPPSIM_RNG_TARGET V frexp( V x, V& e )
+    {
+        __m256i b = _mm256_castpd_si256( x );
+        e = _mm256_castsi256_pd( _mm256_or_si256( _mm256_srli_epi64( b, 52 ),
+                                                  _mm256_set1_epi64x( 0x4330000000000000LL ) ) )
+            - _mm256_set1_pd( magicExp );
+        return _mm256_castsi256_pd( _mm256_or_si256( _mm256_and_si256( b, _mm256_set1_epi64x( 0x000fffffffffffffLL ) ),
+                                                     _mm256_set1_epi64x( 0x3fe0000000000000LL ) ) );
+    };
+    static CPPSIM_RNG_TARGET V ldexp( V x, V n )
+    {
+        __m256i b = _mm256_castpd_si256( n + _mm256_set1_pd( magicBias ) );
+        return x * _mm256_castsi256_pd( _mm256_slli_epi64( b, 52 ) );
+    };
+};
+
+#include "rngsimd.hh"
+
+} // namespace avx2
+} // namespace
+
+#undef CPPSIM_RNG_TARGET
+
+static bool useVector( void )
+{
+    static const bool avx2 = __builtin_cpu_supports( "avx2" );
+    return avx2;
+}
+
+#define CPPSIM_RNG_VECTOR avx2
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// NEON, which every aarch64 processor has
+//
+//////////////////////////////////////////////////////////////////////////////
+#elif defined( CPPSIM_RNG_NEON )
+
+#define CPPSIM_RNG_TARGET
+
+namespace {
+namespace neon {
+
+struct ops {
+    typedef float64x2_t V;
+    typedef uint64x2_t M;
+    enum { width = 2 };
+
+    static V set1( double x ) { return vdupq_n_f64( x ); };
+    static V load( const double* p ) { return vld1q_f64( p ); };
+    static void store( double* p, V v ) { vst1q_f64( p, v ); };
+    static V floor( V x ) { return vrndmq_f64( x ); };
+    static V trunc( V x ) { return vrndq_f64( x ); };
+    static V sqrt( V x ) { return vsqrtq_f64( x ); };
+    static M lt( V a, V b ) { return vcltq_f64( a, b ); };
+    static M le( V a, V b ) { return vcleq_f64( a, b ); };
+    static M eq( V a, V b ) { return vceqq_f64( a, b ); };
+    static M orM( M m, M n ) { return vorrq_u64( m, n ); };
+    static V select( M m, V a, V b ) { return vbslq_f64( m, a, b ); };
+
+    static V frexp( V x, V& e )
+    {
+        uint64x2_t b = vreinterpretq_u64_f64( x );
+        e = vsubq_f64( vreinterpretq_f64_u64( vorrq_u64( vshrq_n_u64( b, 52 ),
+                                                         vdupq_n_u64( 0x4330000000000000ULL ) ) ),
+                       vdupq_n_f64( magicExp ) );
+        return vreinterpretq_f64_u64( vorrq_u64( vandq_u64( b, vdupq_n_u64( 0x000fffffffffffffULL ) ),
+                                                 vdupq_n_u64( 0x3fe0000000000000ULL ) ) );
+    };
+    static V ldexp( V x, V n )
+    {
+        uint64x2_t b = vreinterpretq_u64_f64( vaddq_f64( n, vdupq_n_f64( magicBias ) ) );
+        return vmulq_f64( x, vreinterpretq_f64_u64( vshlq_n_u64( b, 52 ) ) );
+    };
+};
+
+#include "rngsimd.hh"
+
+} // namespace neon
+} // namespace
+
+#undef CPPSIM_RNG_TARGET
+
+static bool useVector( void )
+{
+    return true;
+}
+
+#define CPPSIM_RNG_VECTOR neon
+
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Dispatch. The vector code does what it can, the scalar code the rest
+//
+//////////////////////////////////////////////////////////////////////////////
+
+const char* rngKernels::isa( void )
+{
+#if defined( CPPSIM_RNG_VECTOR )
+#define CPPSIM_RNG_STR( x ) #x
+#define CPPSIM_RNG_NAME( x ) CPPSIM_RNG_STR( x )
+    if ( _vector && useVector( ) )
+        return CPPSIM_RNG_NAME( CPPSIM_RNG_VECTOR );
+#endif
+    return "scalar";
+}
+
+void rngKernels::mrg32k3a( double st[6][lanes], double* out, size_t len )
+{
+    int l = 0;
+#if defined( CPPSIM_RNG_VECTOR )
+    if ( _vector && useVector( ) )
+        for ( ; l + CPPSIM_RNG_VECTOR::ops::width <= lanes; l += CPPSIM_RNG_VECTOR::ops::width )
+            CPPSIM_RNG_VECTOR::mrg32k3a< CPPSIM_RNG_VECTOR::ops >( st, l, out, len );
+#endif
+    for ( ; l < lanes; l++ )
+        portable::mrg32k3a< portable::ops >( st, l, out, len );
+}
+
+void rngKernels::negLog1m( double* x, size_t n, double scale )
+{
+    size_t i = 0;
+#if defined( CPPSIM_RNG_VECTOR )
+    if ( _vector && useVector( ) )
+        i = CPPSIM_RNG_VECTOR::negLog1m< CPPSIM_RNG_VECTOR::ops >( x, n, scale );
+#endif
+    portable::negLog1m< portable::ops >( x + i, n - i, scale );
+}
+
+void rngKernels::weibull( double* x, size_t n, double a, double b )
+{
+    size_t i = 0;
+#if defined( CPPSIM_RNG_VECTOR )
+    if ( _vector && useVector( ) )
+        i = CPPSIM_RNG_VECTOR::weibull< CPPSIM_RNG_VECTOR::ops >( x, n, a, b );
+#endif
+    portable::weibull< portable::ops >( x + i, n - i, a, b );
+}
+
+void rngKernels::boxMuller( const double* u1, const double* u2, double* out,
+                            size_t pairs, double mu, double sigma )
+{
+    size_t i = 0;
+#if defined( CPPSIM_RNG_VECTOR )
+    if ( _vector && useVector( ) )
+        i = CPPSIM_RNG_VECTOR::boxMuller< CPPSIM_RNG_VECTOR::ops >( u1, u2, out, pairs, mu, sigma );
+#endif
+    portable::boxMuller< portable::ops >( u1 + i, u2 + i, out + 2 * i, pairs - i, mu, sigma );
+}
@@ -0,0 +1,77 @@
+/*****************************************************************************
+ *
+ * rngkernels.hh -- Vector kernels of the bulk random number generation
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#ifndef CPPSIM_RNGKERNELS_HH
+#define CPPSIM_RNGKERNELS_HH
+
+#include <cstddef>
+
+//
+// The kernels used by the fill( ) methods of the random number
+// generators (see rng.hh). They are written once, on top of a few
+// vector operations, and compiled for AVX2 (selected at run time, if
+// the processor has it) or NEON, and for plain scalar code. All of
+// them compute exactly the same values: the vector code only does
+// several of them at once.
+//
+// The logarithm, the exponential and the sine and cosine are
+// polynomial approximations (from the Cephes library), accurate to
+// about one unit in the last place; they can thus differ in the last
+// bits from the functions of the C library used by the value( )
+// methods.
+//
+class rngKernels {
+public:
+
+    // Number of MRG32k3a generators run side by side
+    enum { lanes = 4 };
+
+    //
+    // Runs lanes MRG32k3a generators, whose states are st[ 0..5 ][ l ],
+    // for len steps each. Generator l writes its values at out[ l * len ]
+    // to out[ ( l + 1 ) * len - 1 ]; the states are updated.
+    //
+    static void mrg32k3a( double st[6][lanes], double* out, size_t len );
+
+    // x[i] = -log( 1 - x[i] ) * scale
+    static void negLog1m( double* x, size_t n, double scale );
+
+    // x[i] = a * ( -log( 1 - x[i] ) )^( 1 / b )
+    static void weibull( double* x, size_t n, double a, double b );
+
+    //
+    // Box-Muller transform of the pairs ( u1[i], u2[i] ), with
+    // R = sqrt( -2 log( u1[i] ) ) and T = 2 pi u2[i]: out[ 2i ] is
+    // mu + sigma R sin( T ), and out[ 2i + 1 ] is mu + sigma R cos( T )
+    //
+    static void boxMuller( const double* u1, const double* u2, double* out,
+                           size_t pairs, double mu, double sigma );
+
+    // The instruction set of the kernels in use: "avx2", "neon" or
+    // "scalar". setVector( false ) makes them use the scalar code.
+    static const char* isa( void );
+    static void setVector( bool v ) { _vector = v; };
+
+private:
+    static bool         _vector;
+};
+
+#endif
@@ -0,0 +1,230 @@
+/*****************************************************************************
+ *
+ * rngsimd.hh -- Generic code of the kernels of rngkernels.cc
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+//
+// This file has no include guard: rngkernels.cc includes it once for
+// each instruction set, in a namespace of its own, so that each copy
+// of the templates below is compiled for that instruction set. It
+// must not include other files. CPPSIM_RNG_TARGET, defined by the
+// includer, is the target attribute of the instruction set (or
+// nothing), and is put on every function.
+//
+// Ops supplies the vector type V (with the arithmetic operators), the
+// mask type M, the number of lanes width, and:
+//
+//     set1( x ), load( p ), store( p, v )
+//     floor( v ), trunc( v ), sqrt( v )
+//     lt( a, b ), le( a, b ), eq( a, b ), orM( m, n )
+//     select( m, a, b )        m ? a : b, lane by lane
+//     frexp( x, e )            x = m 2^e, 0.5 <= m < 1, for x > 0 normal
+//     ldexp( x, n )            x 2^n, for n integral in [-1022, 1023]
+//
+
+// Runs the generators l0 to l0 + width - 1 (see rngKernels::mrg32k3a)
+template< class Ops >
+static CPPSIM_RNG_TARGET void mrg32k3a( double st[6][rngKernels::lanes], int l0, double* out, size_t len )
+{
+    typedef typename Ops::V V;
+    const V m1 = Ops::set1( 4294967087.0 );
+    const V m2 = Ops::set1( 4294944443.0 );
+    const V a12 = Ops::set1( 1403580.0 );
+    const V a13n = Ops::set1( 810728.0 );
+    const V a21 = Ops::set1( 527612.0 );
+    const V a23n = Ops::set1( 1370589.0 );
+    const V norm = Ops::set1( 2.328306549295728e-10 );
+    const V zero = Ops::set1( 0.0 );
+    V s10 = Ops::load( &st[0][l0] ), s11 = Ops::load( &st[1][l0] ), s12 = Ops::load( &st[2][l0] );
+    V s20 = Ops::load( &st[3][l0] ), s21 = Ops::load( &st[4][l0] ), s22 = Ops::load( &st[5][l0] );
+    double u[ Ops::width ];
+
+    for ( size_t i=0; i<len; i++ ) {
+        V p = a12 * s11 - a13n * s10;
+        p = p - Ops::trunc( p / m1 ) * m1;
+        p = Ops::select( Ops::lt( p, zero ), p + m1, p );
+        s10 = s11;  s11 = s12;  s12 = p;
+
+        p = a21 * s22 - a23n * s20;
+        p = p - Ops::trunc( p / m2 ) * m2;
+        p = Ops::select( Ops::lt( p, zero ), p + m2, p );
+        s20 = s21;  s21 = s22;  s22 = p;
+
+        Ops::store( u, Ops::select( Ops::le( s12, s22 ), ( s12 - s22 + m1 ) * norm,
+                                    ( s12 - s22 ) * norm ) );
+        for ( int j=0; j<Ops::width; j++ )
+            out[ ( l0 + j ) * len + i ] = u[ j ];
+    }
+    Ops::store( &st[0][l0], s10 );  Ops::store( &st[1][l0], s11 );  Ops::store( &st[2][l0], s12 );
+    Ops::store( &st[3][l0], s20 );  Ops::store( &st[4][l0], s21 );  Ops::store( &st[5][l0], s22 );
+}
+
+// Natural logarithm, for x > 0 normal (Cephes log.c)
+template< class Ops >
+static CPPSIM_RNG_TARGET typename Ops::V vlog( typename Ops::V x )
+{
+    typedef typename Ops::V V;
+    const V one = Ops::set1( 1.0 );
+    V e;
+    V m = Ops::frexp( x, e );
+    typename Ops::M small = Ops::lt( m, Ops::set1( 0.70710678118654752440 ) );
+    e = Ops::select( small, e - one, e );
+    m = Ops::select( small, m + m - one, m - one );
+
+    V z = m * m;
+    V p = Ops::set1( 1.01875663804580931796e-4 );
+    p = p * m + Ops::set1( 4.97494994976747001425e-1 );
+    p = p * m + Ops::set1( 4.70579119878881725854e0 );
+    p = p * m + Ops::set1( 1.44989225341610930846e1 );
+    p = p * m + Ops::set1( 1.79368678507819816313e1 );
+    p = p * m + Ops::set1( 7.70838733755885391666e0 );
+    V q = m + Ops::set1( 1.12873587189167450590e1 );
+    q = q * m + Ops::set1( 4.52279145837532221105e1 );
+    q = q * m + Ops::set1( 8.29875266912776603211e1 );
+    q = q * m + Ops::set1( 7.11544750618563894466e1 );
+    q = q * m + Ops::set1( 2.31251620126765340583e1 );
+
+    V y = m * ( z * p / q );
+    y = y + e * Ops::set1( -2.121944400546905827679e-4 );
+    y = y - Ops::set1( 0.5 ) * z;
+    z = m + y;
+    return z + e * Ops::set1( 0.693359375 );
+}
+
+// Exponential (Cephes exp.c); the result is 0, or the largest
+// double, beyond the range of the doubles
+template< class Ops >
+static CPPSIM_RNG_TARGET typename Ops::V vexp( typename Ops::V x )
+{
+    typedef typename Ops::V V;
+    x = Ops::select( Ops::lt( x, Ops::set1( -708.0 ) ), Ops::set1( -708.0 ), x );
+    x = Ops::select( Ops::lt( Ops::set1( 709.0 ), x ), Ops::set1( 709.0 ), x );
+    V n = Ops::floor( Ops::set1( 1.4426950408889634073599 ) * x + Ops::set1( 0.5 ) );
+    x = x - n * Ops::set1( 6.93145751953125e-1 );
+    x = x - n * Ops::set1( 1.42860682030941723212e-6 );
+
+    V xx = x * x;
+    V p = Ops::set1( 1.26177193074810590878e-4 );
+    p = p * xx + Ops::set1( 3.02994407707441961300e-2 );
+    p = p * xx + Ops::set1( 9.99999999999999999910e-1 );
+    p = x * p;
+    V q = Ops::set1( 3.00198505138664455042e-6 );
+    q = q * xx + Ops::set1( 2.52448340349684104192e-3 );
+    q = q * xx + Ops::set1( 2.27265548208155028766e-1 );
+    q = q * xx + Ops::set1( 2.00000000000000000009e0 );
+    x = p / ( q - p );
+    x = Ops::set1( 1.0 ) + Ops::set1( 2.0 ) * x;
+    return Ops::ldexp( x, n );
+}
+
+//
+// Sine and cosine of 2 pi u, for 0 <= u <= 1. u is reduced exactly to
+// f = u - k / 4, with |f| <= 1 / 8, and the sine and the cosine of
+// 2 pi f are then rotated by k quarters of a turn (Cephes sin.c for
+// the polynomials)
+//
+template< class Ops >
+static CPPSIM_RNG_TARGET void vsincos2pi( typename Ops::V u, typename Ops::V& s, typename Ops::V& c )
+{
+    typedef typename Ops::V V;
+    typedef typename Ops::M M;
+    V k = Ops::floor( Ops::set1( 4.0 ) * u + Ops::set1( 0.5 ) );
+    V z = ( u - k * Ops::set1( 0.25 ) ) * Ops::set1( 6.283185307179586476925 );
+    V q = k - Ops::set1( 4.0 ) * Ops::floor( k * Ops::set1( 0.25 ) );
+
+    V zz = z * z;
+    V ps = Ops::set1( 1.58962301576546568060e-10 );
+    ps = ps * zz + Ops::set1( -2.50507477628578072866e-8 );
+    ps = ps * zz + Ops::set1( 2.75573136213857245213e-6 );
+    ps = ps * zz + Ops::set1( -1.98412698295895385996e-4 );
+    ps = ps * zz + Ops::set1( 8.33333333332211858878e-3 );
+    ps = ps * zz + Ops::set1( -1.66666666666666307295e-1 );
+    V sz = z + z * zz * ps;
+    V pc = Ops::set1( -1.13585365213876817300e-11 );
+    pc = pc * zz + Ops::set1( 2.08757008419747316778e-9 );
+    pc = pc * zz + Ops::set1( -2.75573141792967388112e-7 );
+    pc = pc * zz + Ops::set1( 2.48015872888517045348e-5 );
+    pc = pc * zz + Ops::set1( -1.38888888888730564116e-3 );
+    pc = pc * zz + Ops::set1( 4.16666666666665929218e-2 );
+    V cz = Ops::set1( 1.0 ) - Ops::set1( 0.5 ) * zz + zz * zz * pc;
+
+    M q1 = Ops::eq( q, Ops::set1( 1.0 ) );
+    M q2 = Ops::eq( q, Ops::set1( 2.0 ) );
+    M q3 = Ops::eq( q, Ops::set1( 3.0 ) );
+    M swap = Ops::orM( q1, q3 );
+    s = Ops::select( swap, cz, sz );
+    c = Ops::select( swap, sz, cz );
+    s = Ops::select( Ops::orM( q2, q3 ), -s, s );
+    c = Ops::select( Ops::orM( q1, q2 ), -c, c );
+}
+
+// The kernels below do the first multiple of width values, and return
+// how many they did
+
+template< class Ops >
+static CPPSIM_RNG_TARGET size_t negLog1m( double* x, size_t n, double scale )
+{
+    typedef typename Ops::V V;
+    const V one = Ops::set1( 1.0 );
+    const V sc = Ops::set1( scale );
+    size_t i;
+    for ( i=0; i + Ops::width <= n; i += Ops::width ) {
+        V u = Ops::load( x + i );
+        Ops::store( x + i, -vlog< Ops >( one - u ) * sc );
+    }
+    return i;
+}
+
+template< class Ops >
+static CPPSIM_RNG_TARGET size_t weibull( double* x, size_t n, double a, double b )
+{
+    typedef typename Ops::V V;
+    const V one = Ops::set1( 1.0 );
+    const V va = Ops::set1( a );
+    const V vb = Ops::set1( 1.0 / b );
+    size_t i;
+    for ( i=0; i + Ops::width <= n; i += Ops::width ) {
+        V y = -vlog< Ops >( one - Ops::load( x + i ) );
+        Ops::store( x + i, va * vexp< Ops >( vlog< Ops >( y ) * vb ) );
+    }
+    return i;
+}
+
+template< class Ops >
+static CPPSIM_RNG_TARGET size_t boxMuller( const double* u1, const double* u2, double* out,
+                         size_t pairs, double mu, double sigma )
+{
+    typedef typename Ops::V V;
+    const V vmu = Ops::set1( mu );
+    const V vsigma = Ops::set1( sigma );
+    double sv[ Ops::width ], cv[ Ops::width ];
+    size_t i;
+    for ( i=0; i + Ops::width <= pairs; i += Ops::width ) {
+        V r = Ops::sqrt( Ops::set1( -2.0 ) * vlog< Ops >( Ops::load( u1 + i ) ) );
+        V s, c;
+        vsincos2pi< Ops >( Ops::load( u2 + i ), s, c );
+        Ops::store( sv, vmu + vsigma * r * s );
+        Ops::store( cv, vmu + vsigma * r * c );
+        for ( int j=0; j<Ops::width; j++ ) {
+            out[ 2 * ( i + j ) ] = sv[ j ];
+            out[ 2 * ( i + j ) + 1 ] = cv[ j ];
+        }
+    }
+    return i;
+}
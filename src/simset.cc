@@ -0,0 +1,63 @@
+/*****************************************************************************
+ *
+ * simset.cc
+ *
+ * Intrusive two-way lists of objects, after the SIMSET class of Simula
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "simset.hh"
+
+simset::head::head( order_t order ) :
+    linkage     ( ),
+    _order      ( order ),
+    _before     ( 0 ),
+    _cardinal   ( 0 )
+{
+    assert( ordered != order );
+    _suc = _pred = this;
+}
+
+simset::head::head( before_t before ) :
+    linkage     ( ),
+    _order      ( ordered ),
+    _before     ( before ),
+    _cardinal   ( 0 )
+{
+    assert( 0 != before );
+    _suc = _pred = this;
+}
+
+simset::head::~head( )
+{
+    clear( );
+}
+
+//
+// The members are taken out from the first one; each of them may be
+// destroyed as it leaves the set
+//
+void simset::head::clear( void )
+{
+    while ( !empty( ) )
+        first( )->out( );
+}
@@ -0,0 +1,244 @@
+/*****************************************************************************
+ *
+ * simset.hh
+ *
+ * Intrusive two-way lists of objects, after the SIMSET class of Simula
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#ifndef CPPSIM_SIMSET_HH
+#define CPPSIM_SIMSET_HH
+
+#include <cassert>
+#include "handle.hh"
+
+//
+// As in Simula, a set is a circular two-way list, whose members are
+// objects of class simset::link, and whose head, of class
+// simset::head, is part of the list. The pointers are part of the
+// members, so putting an object in a set or taking it out never
+// allocates memory, and takes constant time. A link is in at most
+// one set at a time.
+//
+// process derives from simset::link, so that processes can be put in
+// sets:
+//
+//     simset::head queue;
+//     ...
+//     into( queue );                  // in the body of a job
+//     passivate( );
+//     ...
+//     handle< job > j( static_cast< job* >( queue.first( ) ) );
+//     j->out( );
+//
+// A link is a shared object, and a set holds a reference to each of
+// its members, as the sqs does: a process waiting in a set needs no
+// other handle to stay alive, and it may be destroyed (or recycled)
+// when it leaves the set.
+//
+// into( ) puts a link in a set according to the order of the set:
+// at the end (simset::fifo, the default), at the beginning
+// (simset::lifo), or, for a set ordered by a function before( a, b ),
+// after the last member m for which before( link, m ) is false, so
+// that the members in the same rank keep the order in which they
+// entered. precede( ) and follow( ) put a link next to a given one,
+// regardless of the order of the set. Only the insertion into an
+// ordered set is not constant time: it scans the set from the end.
+//
+class simset {
+public:
+
+    class head;
+    class link;
+
+    enum order_t { fifo, lifo, ordered };
+
+    // True if a must come before b in an ordered set
+    typedef bool (*before_t)( const link* a, const link* b );
+
+    class linkage {
+        friend class head;
+        friend class link;
+    protected:
+        linkage( void ) : _suc( 0 ), _pred( 0 ) { };
+
+        linkage*        _suc;
+        linkage*        _pred;
+
+    private:
+        linkage( const linkage& );
+        linkage& operator=( const linkage& );
+    };
+
+    class link : public shared, public linkage {
+        friend class head;
+    public:
+
+        // The next and the previous member of the set, 0 at the ends
+        // of the set or if the link is not in a set
+        link* suc( void ) const
+        {
+            return ( _suc == _head ? 0 : static_cast< link* >( _suc ) );
+        };
+        link* pred( void ) const
+        {
+            return ( _pred == _head ? 0 : static_cast< link* >( _pred ) );
+        };
+
+        // The set of the link, 0 if none
+        head* set( void ) const { return _head; };
+
+        // Takes the link out of its set, if any. The link may be
+        // destroyed, if the set held the last reference to it
+        void out( void );
+
+        // Puts the link in s, according to the order of s; the link is
+        // first taken out of its set, if any
+        void into( head& s );
+
+        // Puts the link just after, or just before, x. If x is 0 or
+        // is not in a set, the link is only taken out of its set
+        void follow( link* x );
+        void precede( link* x );
+
+    protected:
+        link( void ) : shared( ), linkage( ), _head( 0 ) { };
+        virtual ~link( ) { assert( 0 == _head ); };
+
+    private:
+        // Links the link between p and p->_suc, in s
+        void insert( linkage* p, head* s );
+        // Unlinks the link, without releasing the reference of the set
+        void unlink( void );
+
+        head*           _head;
+    };
+
+    class head : public linkage {
+        friend class link;
+    public:
+        head( order_t order = fifo );
+        head( before_t before );
+        ~head( );
+
+        // The first and the last member, 0 if the set is empty
+        link* first( void ) const
+        {
+            return ( _suc == this ? 0 : static_cast< link* >( _suc ) );
+        };
+        link* last( void ) const
+        {
+            return ( _pred == this ? 0 : static_cast< link* >( _pred ) );
+        };
+
+        bool empty( void ) const { return ( _suc == this ); };
+        unsigned long cardinal( void ) const { return _cardinal; };
+        order_t order( void ) const { return _order; };
+
+        // Takes all the members out of the set
+        void clear( void );
+
+    private:
+        order_t         _order;
+        before_t        _before;        // If ordered
+        unsigned long   _cardinal;
+    };
+};
+
+inline void simset::link::insert( linkage* p, head* s )
+{
+    _pred = p;
+    _suc = p->_suc;
+    _suc->_pred = this;
+    p->_suc = this;
+    _head = s;
+    s->_cardinal++;
+}
+
+inline void simset::link::unlink( void )
+{
+    _pred->_suc = _suc;
+    _suc->_pred = _pred;
+    _suc = _pred = 0;
+    _head->_cardinal--;
+    _head = 0;
+}
+
+inline void simset::link::out( void )
+{
+    if ( 0 != _head ) {
+        unlink( );
+        if ( 0 == unget_ref( ) )
+            dispose( );
+    }
+}
+
+inline void simset::link::into( head& s )
+{
+    if ( 0 != _head )
+        unlink( );
+    else
+        get_ref( );
+    linkage* p;
+    switch ( s._order ) {
+    case lifo:
+        p = &s;
+        break;
+    case ordered:
+        p = s._pred;
+        while ( p != &s && s._before( this, static_cast< link* >( p ) ) )
+            p = p->_pred;
+        break;
+    default:
+        p = s._pred;
+        break;
+    }
+    insert( p, &s );
+}
+
+inline void simset::link::follow( link* x )
+{
+    if ( x == this )
+        return;
+    if ( 0 == x || 0 == x->_head ) {
+        out( );
+        return;
+    }
+    if ( 0 != _head )
+        unlink( );
+    else
+        get_ref( );
+    insert( x, x->_head );
+}
+
+inline void simset::link::precede( link* x )
+{
+    if ( x == this )
+        return;
+    if ( 0 == x || 0 == x->_head ) {
+        out( );
+        return;
+    }
+    if ( 0 != _head )
+        unlink( );
+    else
+        get_ref( );
+    insert( x->_pred, x->_head );
+}
+
+#endif
@@ -0,0 +1,93 @@
+/*****************************************************************************
+ *
+ * simtime.hh
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#ifndef CPPSIM_SIMTIME_HH
+#define CPPSIM_SIMTIME_HH
+
+//
+// Type of the simulated time. By default it is a double; when
+// CPPSIM_INTEGER_TIME is defined (see the --enable-integer-time
+// option of configure) it is a number of clock ticks, and all the
+// event times are compared as integers. Models, and the library, must
+// be compiled with the same setting.
+//
+#ifdef CPPSIM_INTEGER_TIME
+typedef long long simtime_t;
+#define SIMTIME_FMT "%lld"
+#else
+typedef double simtime_t;
+#define SIMTIME_FMT "%.2f"
+#endif
+
+#ifdef CPPSIM_INTEGER_TIME
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <type_traits>
+
+//
+// Converts a time, or a duration, to ticks. A floating point value
+// must be a whole number of ticks: a fractional one aborts, instead of
+// being silently truncated (round it first, e.g. with llround( ), if
+// that is what is meant).
+//
+template< class T >
+inline simtime_t ticks( T t )
+{
+    if constexpr ( std::is_floating_point< T >::value ) {
+        if ( !( std::fabs( t ) < 9.2e18 ) || std::trunc( t ) != t ) {
+            std::cerr << "FATAL: time " << t << " is not a whole number of ticks"
+                      << std::endl;
+            abort( );
+        }
+    }
+    return (simtime_t)t;
+}
+
+//
+// Type of the time arguments of the scheduling operations of the
+// processes: any arithmetic value, converted by ticks( ).
+//
+class simtime_arg {
+public:
+    template< class T, class = typename std::enable_if< std::is_arithmetic< T >::value >::type >
+    simtime_arg( T t ) : _t( ticks( t ) ) { };
+    operator simtime_t( ) const { return _t; };
+private:
+    simtime_t   _t;
+};
+
+#else
+
+template< class T >
+inline simtime_t ticks( T t )
+{
+    return (simtime_t)t;
+}
+
+typedef simtime_t simtime_arg;
+
+#endif
+
+#endif
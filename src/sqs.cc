@@ -24,9 +24,16 @@
 
 #include "sqs.hh"
 #include <cstdio>
+#include <ctime>
 #include "sqsDll.hh"
 #include "sqsPrio.hh"
+#include "sqsCal.hh"
+#include "sqsHeap.hh"
+#include "sqsLadder.hh"
+#include "sqsWheel.hh"
+#include "sqsAdaptive.hh"
 #include "logger.hh"
+#include "profiler.hh"
 
 unsigned int sqs::_id = 0;
 
@@ -35,8 +42,25 @@ sqs::sqs( ) :
     _insertions ( 0 ),
     _deletions  ( 0 ),
     _processed  ( 0 ),
-    _current    ( )
+    _current    ( ),
+    _previous   ( ),
+    _directTransfer( false ),
+    _batching   ( false ),
+    _instant    ( 0 ),
+    _hibernation( false ),
+    _simIdle    ( 0 ),
+    _wallIdle   ( 0.0 ),
+    _sweepInterval( 0 ),
+    _nextSweep  ( 0 ),
+    _idleHead   ( 0 ),
+    _idleTail   ( 0 ),
+    _idleNodes  ( 0 ),
+    _idleFree   ( 0 )
 {
+    // The scheduler is entered at each event, so it is not worth
+    // copying its stack in and out
+    ownStack( );
+
     // FIXME: Is there an easy way for concatenating an integer to a string,
     // without using snprintf??
     char buf[128];
@@ -44,22 +68,165 @@ sqs::sqs( ) :
     _logger = logger::instance( buf );
 }
 
-handle_p& sqs::firstProc( void ) const 
+sqs::~sqs( )
+{
+    while ( 0 != _idleHead )
+        idleRemove( _idleHead->p );
+    while ( 0 != _idleFree ) {
+        idleNode* n = _idleFree;
+        _idleFree = n->next;
+        delete n;
+    }
+}
+
+process* sqs::firstProc( void ) const 
 {
-    static handle_p nullProc( 0 );
     absEvNotice* _ev = first( );
-    return ( 0 == _ev ? nullProc : _ev->proc( ) );
+    return ( 0 == _ev ? 0 : _ev->proc( ) );
+}
+
+absEvNotice* sqs::bind( const handle_p& p, simtime_t t )
+{
+    absEvNotice* ev = &p->_ev;
+    assert( 0 == ev->_proc );
+    ev->_time = t;
+    ev->_proc = p.rep( );
+    p->get_ref( );
+    return ev;
+}
+
+//
+// The notice is part of the process, which may be destroyed here
+//
+void sqs::unbind( absEvNotice* ev )
+{
+    process* p = ev->_proc;
+    assert( 0 != p );
+    ev->_proc = 0;
+    ev->_prev = ev->_next = ev->_gprev = ev->_gnext = 0;
+    ev->_bin = 0;
+    if ( 0 == p->unget_ref( ) )
+        p->dispose( );
+}
+
+void sqs::insertBatch( const handle_p* p, size_t n, simtime_t t )
+{
+    sameTime times = { t };
+    insertRuns( p, n, times );
+}
+
+void sqs::insertBatch( const handle_p* p, size_t n, const simtime_t* t )
+{
+    insertRuns( p, n, t );
 }
 
 void sqs::main( void ) 
 {
-    while( !empty( ) ) {
-        absEvNotice* _ev = first( );
-        assert( 0 != _ev );
-        _current = _ev->proc( );
-        _current->resume( );
-        _processed++;
-        _logger->message( 0, "%u\n", size() );
+    run( this );
+}
+
+void sqs::ended( void )
+{
+    if ( profiler::cEnabled )
+        profiler::instance( )->countEvents( _processed );
+}
+
+static double wallTime( void )
+{
+    struct timespec t;
+    clock_gettime( CLOCK_MONOTONIC, &t );
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+void sqs::setHibernation( simtime_t simIdle, double wallIdle, unsigned long sweepInterval )
+{
+    _hibernation = ( simIdle > 0.0 || wallIdle > 0.0 );
+    _simIdle = simIdle;
+    _wallIdle = wallIdle;
+    _sweepInterval = sweepInterval;
+    _nextSweep = _processed + sweepInterval;
+}
+
+//
+// A process passivated again goes to the end of the list. Reactivated
+// processes are not removed from the list until they are found by the
+// next sweep. The nodes of the list are kept by the sqs, so that only
+// the processes in the list pay for them.
+//
+void sqs::idleInsert( process* p, simtime_t t )
+{
+    if ( 0 != p->_idle )
+        idleRemove( p );
+    idleNode* n = _idleFree;
+    if ( 0 != n )
+        _idleFree = n->next;
+    else {
+        n = new idleNode;
+        _idleNodes++;
+    }
+    n->p = p;
+    n->since = t;
+    n->wall = ( _wallIdle > 0.0 ? wallTime( ) : 0.0 );
+    n->prev = _idleTail;
+    n->next = 0;
+    if ( 0 != _idleTail )
+        _idleTail->next = n;
+    else
+        _idleHead = n;
+    _idleTail = n;
+    p->_idle = n;
+}
+
+void sqs::idleRemove( process* p )
+{
+    idleNode* n = p->_idle;
+    assert( 0 != n );
+    if ( 0 != n->prev )
+        n->prev->next = n->next;
+    else
+        _idleHead = n->next;
+    if ( 0 != n->next )
+        n->next->prev = n->prev;
+    else
+        _idleTail = n->prev;
+    n->next = _idleFree;
+    _idleFree = n;
+    p->_idle = 0;
+}
+
+size_t sqs::idleBytes( void ) const
+{
+    return _idleNodes * sizeof( idleNode );
+}
+
+//
+// The list is in order of passivation, so the sweep stops at the
+// first process which has not been idle long enough. The current
+// process is skipped, as it may still be running on its stack.
+//
+void sqs::hibernateIdle( void )
+{
+    _nextSweep = _processed + _sweepInterval;
+    if ( empty( ) )
+        return;
+
+    simtime_t now = first( )->evTime( );
+    double wall = ( _wallIdle > 0.0 ? wallTime( ) : 0.0 );
+    idleNode* n = _idleHead;
+    while ( 0 != n ) {
+        idleNode* next = n->next;
+        process* p = n->p;
+        if ( !p->idle( ) )
+            idleRemove( p );
+        else if ( p != _current.rep( ) ) {
+            if ( ( _simIdle > 0.0 && now - n->since >= _simIdle ) ||
+                 ( _wallIdle > 0.0 && wall - n->wall >= _wallIdle ) ) {
+                p->hibernate( );
+                idleRemove( p );
+            } else
+                break;
+        }
+        n = next;
     }
 }
 
@@ -72,14 +239,34 @@ sqs* makeSqs( sched_t s )
     case SQSPRIO:
         return new sqsPrio();
         break;
+    case SQSCAL:
+        return new sqsCal();
+        break;
+    case SQSHEAP:
+        return new sqsHeap();
+        break;
+    case SQSLADDER:
+        return new sqsLadder();
+        break;
+    case SQSWHEEL:
+        return new sqsWheel();
+        break;
+    case SQSADAPTIVE:
+        return new sqsAdaptive();
+        break;
     default:
         cerr << "Unsupported SQS type " << s << endl;
         abort( );
     };
 }
 
-sqsBuilder_t builders[2] = {
+sqsBuilder_t builders[7] = {
     sqsDllBuilder,
-    sqsPrioBuilder
+    sqsPrioBuilder,
+    sqsCalBuilder,
+    sqsHeapBuilder,
+    sqsLadderBuilder,
+    sqsWheelBuilder,
+    sqsAdaptiveBuilder
 };
 
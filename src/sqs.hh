@@ -32,52 +32,71 @@
 #include <cstdlib>
 #include "process.hh"
 #include "simulation.hh"
+#include "logger.hh"
 
 class logger;
 
 enum position_t { pos_after=0, pos_before };
-enum sched_t    { SQSDLL = 0, SQSPRIO, SQSCAL };
+enum sched_t    { SQSDLL = 0, SQSPRIO, SQSCAL, SQSHEAP, SQSLADDER, SQSWHEEL, SQSADAPTIVE };
 
-class absEvNotice {
-public:
-    virtual ~absEvNotice( ) { };
-
-    // Accessors
-
-    double evTime( void ) const { return _time; };
-    handle_p& proc( void )      { return _proc; };
-
-protected:
-
-    absEvNotice( double t, const handle_p& p ) :
-        _time( t ), _proc( p ) 
-    { 
-        assert( !p.isNull( ) );
-    };
-
-    const double        _time;  // Event Time
-    handle_p            _proc;  // Process associated to this event notice
+//
+// Node of the idle list of the sqs
+//
+struct idleNode {
+    process*    p;
+    idleNode*   prev;
+    idleNode*   next;
+    simtime_t   since;          // Simulated time of passivation
+    double      wall;           // Wall-clock time of passivation
 };
 
 class sqs : public coroutine {
+    friend class process;
 public:
 
-    virtual ~sqs( ) { };
+    virtual ~sqs( );
 
-    // Modifiers
-    virtual absEvNotice* insertAt( const handle_p& p, double t ) = 0;
+    //
+    // Modifiers. The event notices are those embedded in the processes
+    // (see absEvNotice): insertAt( ) and insert( ) link the notice of
+    // p, and remove( ) unlinks a notice, releasing its process.
+    // reschedule( ev, t ) moves a notice to time t, putting it before
+    // the other notices with time t, as remove( ) followed by
+    // insertAt( ) would do, but in place.
+    //
+    virtual absEvNotice* insertAt( const handle_p& p, simtime_t t ) = 0;
     virtual absEvNotice* insert( const handle_p& p, const handle_p& q, enum position_t where ) = 0;
     virtual void remove( absEvNotice* ev ) = 0;
+    virtual void reschedule( absEvNotice* ev, simtime_t t ) = 0;
     virtual void clear( void ) = 0;     // Empty the SQS
 
+    //
+    // Batch insertion. The notices of p[0..n-1] are linked at time t,
+    // or at the times t[0..n-1], which must not decrease. They keep
+    // the order of p, and go before the notices already in the sqs
+    // with the same time, as insertAt( p[i], t[i] ) for i from n-1
+    // down to 0 would do. Here, each run of notices with the same
+    // time is placed by insertAt( ) of its first notice, and the
+    // others are inserted after it; the sqs types override this to
+    // place the whole batch in a single pass.
+    //
+    virtual void insertBatch( const handle_p* p, size_t n, simtime_t t );
+    virtual void insertBatch( const handle_p* p, size_t n, const simtime_t* t );
+
     // Accessors (const)
     virtual absEvNotice* first( void )  const = 0;
-    handle_p& firstProc( void )         const;
+    process* firstProc( void )          const;
     virtual void dump_sqs( void )       const = 0;
     virtual void report( void )         const = 0;
     virtual unsigned int size( void )   const = 0;
     virtual bool empty( void )          const = 0;
 
+    // Bytes used by the sqs for each event notice, besides the notice
+    // itself, which is part of the process
+    virtual size_t noticeBytes( void )  const { return 0; };
+    // Bytes used by the idle list
+    size_t idleBytes( void ) const;
+
     // Accessors
     handle_p& current( void )           { return _current;      };
     logger* getLogger( void ) const     { return _logger;       };
@@ -85,21 +104,157 @@ public:
     unsigned long deletions( void ) const       { return _deletions;    };
     unsigned long processed( void ) const       { return _processed;    };
 
+    //
+    // When direct transfer is enabled, a process which suspends itself
+    // gives control straight to the process owning the next event
+    // notice, instead of going back to the scheduler coroutine. The
+    // scheduler only runs when the next process is stackless, when
+    // a process terminates, or when the simulation ends.
+    //
+    void setDirectTransfer( bool d )            { _directTransfer = d;  };
+    bool directTransfer( void ) const           { return _directTransfer; };
+
+    //
+    // The events with the same time (an "instant") are dispatched as a
+    // batch: the scheduler resumes the first process of the instant,
+    // and each process which suspends itself gives control straight
+    // to the next one, while the first notice of the sqs has the time
+    // of the instant. The scheduler runs again when the time advances
+    // (or, as with direct transfer, for a stackless process or a
+    // terminated one). The next process is always the one owning the
+    // first notice, after the operations of the previous one, so the
+    // notices inserted during the instant, at the front, before or
+    // after others, run in the same order as without batching.
+    // Batching is disabled by default.
+    //
+    void setBatching( bool b )                  { _batching = b;        };
+    bool batching( void ) const                 { return _batching;     };
+    simtime_t instant( void ) const             { return _instant;      };
+
+    //
+    // Hibernation of passivated processes (see coroutine::hibernate).
+    // Processes which have been passive for at least simIdle units of
+    // simulated time, or for wallIdle seconds of wall-clock time, are
+    // hibernated; a threshold of 0 is not used. Passive processes are
+    // checked every sweepInterval events, or when hibernateIdle( ) is
+    // called. Only the processes passivated while hibernation is
+    // enabled are considered.
+    //
+    void setHibernation( simtime_t simIdle, double wallIdle = 0.0,
+                         unsigned long sweepInterval = 1000 );
+    bool hibernation( void ) const              { return _hibernation;  };
+    void hibernateIdle( void );
+
 protected:
     sqs( );  
 
+    // Links the notice of p at time t, and keeps p alive
+    static absEvNotice* bind( const handle_p& p, simtime_t t );
+    // Releases the process of a notice which has been unlinked
+    static void unbind( absEvNotice* ev );
+
     // Runs the simulation
     void main( void );
 
+    //
+    // The loop of main( ), and transfer( ), on the sqs s of type Q: Q
+    // is sqs for main( ), and the actual type of the sqs for
+    // basic_sqs<Q> (see basic_process.hh), for which the calls to the
+    // sqs are direct.
+    //
+    template< class Q > static void run( Q* s );
+    void ended( void );                 // Called at the end of run( )
+
+    // Makes p the current process, without going through main( )
+    template< class Q > static void transfer( Q* s, const handle_p& p );
+
+    // The times of a batch with a single time, used as an array
+    struct sameTime {
+        simtime_t t;
+        simtime_t operator[]( size_t ) const { return t; };
+    };
+    template< class Times > void insertRuns( const handle_p* p, size_t n, Times t );
+
+    // Idle list, in order of passivation
+    void idleInsert( process* p, simtime_t t );
+    void idleRemove( process* p );
+    void sweep( void )
+    {
+        if ( _hibernation && _processed >= _nextSweep )
+            hibernateIdle( );
+    };
+
     unsigned long _insertions;  // Number of insertions into the SQS
     unsigned long _deletions;   // Number of deletions from the SQS
     unsigned long _processed;   // Number of processed events
 
     handle_p    _current;       // current process
+    handle_p    _previous;      // keeps the process which transferred
+                                // control to _current alive
+    bool        _directTransfer;
+    bool        _batching;
+    simtime_t   _instant;       // Time of the events being dispatched
+    bool        _hibernation;
+    simtime_t   _simIdle;
+    double      _wallIdle;
+    unsigned long _sweepInterval;
+    unsigned long _nextSweep;
+    idleNode*   _idleHead;
+    idleNode*   _idleTail;
+    unsigned long _idleNodes;   // Allocated, in the list or free
+    idleNode*   _idleFree;      // Free nodes
     static unsigned int _id;    // used for the name of the logger
     logger*     _logger;        // logger for the sqs length
 };
 
+template< class Q > void sqs::run( Q* s )
+{
+    while( !s->empty( ) ) {
+        absEvNotice* _ev = s->first( );
+        assert( 0 != _ev );
+        s->_instant = _ev->evTime( );
+        s->_current = _ev->proc( );
+        s->_current->dispatch( );
+        s->_previous = 0;
+        s->_processed++;
+        if ( s->_logger->enabled( 0 ) )
+            s->_logger->message( 0, "%u\n", s->size( ) );
+        s->sweep( );
+    }
+    s->ended( );
+}
+
+//
+// Called by the current process, which is still running on its own
+// stack: it must not be destroyed before it has switched to p, hence
+// the reference kept in _previous.
+//
+template< class Q > void sqs::transfer( Q* s, const handle_p& p )
+{
+    s->_processed++;
+    if ( s->_logger->enabled( 0 ) )
+        s->_logger->message( 0, "%u\n", s->size( ) );
+    s->sweep( );
+    s->_instant = p->_ev._time;
+    if ( p.rep( ) != s->_current.rep( ) ) {
+        s->_previous = s->_current;
+        s->_current = p;
+    }
+}
+
+template< class Times > void sqs::insertRuns( const handle_p* p, size_t n, Times t )
+{
+    size_t i = 0;
+    while ( i < n ) {
+        insertAt( p[ i ], t[ i ] );
+        size_t j = i + 1;
+        for ( ; j < n && t[ j ] == t[ i ]; j++ )
+            insert( p[ j ], p[ j-1 ], pos_after );
+        assert( j == n || t[ j ] > t[ i ] );
+        i = j;
+    }
+}
+
 //
 // Utility functions, to build the proper scehduler
 //
@@ -107,8 +262,14 @@ typedef sqs*(*sqsBuilder_t)( void );
 
 sqs* sqsDllBuilder( void );
 sqs* sqsPrioBuilder( void );
+sqs* sqsCalBuilder( void );
+sqs* sqsHeapBuilder( void );
+sqs* sqsLadderBuilder( void );
+sqs* sqsWheelBuilder( void );
+sqs* sqsAdaptiveBuilder( void );
 
-extern sqsBuilder_t builders[2];
+// Indexed by sched_t
+extern sqsBuilder_t builders[7];
 
 sqs* makeSqs( sched_t s );
 
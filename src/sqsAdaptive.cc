@@ -0,0 +1,268 @@
+/*****************************************************************************
+ *
+ * sqsAdaptive.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include "handle.hh"
+#include "sqsAdaptive.hh"
+#include "process.hh"
+#include "logger.hh"
+
+const double sqsAdaptive::maxCv = 1.5;
+
+static const char* typeNames[] = { "dll", "prio", "cal", "heap", "ladder", "wheel", "adaptive" };
+
+sqs* sqsAdaptiveBuilder( void )
+{
+    return new sqsAdaptive( );
+}
+
+sqsAdaptive::sqsAdaptive( sched_t initial, unsigned int window ) :
+    sqs         ( ),
+    _q          ( 0 ),
+    _now        ( 0 ),
+    _type       ( initial ),
+    _pending    ( initial ),
+    _window     ( window ),
+    _n          ( 0 ),
+    _front      ( 0 ),
+    _peak       ( 0 ),
+    _sum        ( 0.0 ),
+    _sumSq      ( 0.0 ),
+    _switches   ( 0 ),
+    _moved      ( 0 )
+{
+    assert( SQSADAPTIVE != initial );
+    assert( window > 0 );
+    for ( int i=0; i<SQSADAPTIVE; i++ )
+        _backends[ i ] = 0;
+    _q = _backends[ initial ] = builders[ initial ]( );
+}
+
+sqsAdaptive::~sqsAdaptive( )
+{
+    for ( int i=0; i<SQSADAPTIVE; i++ )
+        delete _backends[ i ];
+}
+
+//
+// Records an insertion at time t, before it is done
+//
+void sqsAdaptive::observe( simtime_t t )
+{
+    double dt = (double)( t - _now );
+    _n++;
+    if ( dt <= 0.0 )
+        _front++;
+    _sum += dt;
+    _sumSq += dt * dt;
+}
+
+//
+// Called after an insertion has been done
+//
+void sqsAdaptive::observed( void )
+{
+    if ( _q->size( ) > _peak )
+        _peak = _q->size( );
+    if ( _n >= _window )
+        adapt( );
+}
+
+sched_t sqsAdaptive::choose( void ) const
+{
+    unsigned int small = ( SQSDLL == _type ? smallSize : smallSize / 2 );
+#ifdef CPPSIM_INTEGER_TIME
+    const sched_t large_t = SQSWHEEL;
+#else
+    const sched_t large_t = SQSLADDER;
+#endif
+    unsigned int large = ( large_t == _type ? largeSize / 2 : largeSize );
+
+    if ( _peak <= small )
+        return SQSDLL;
+    if ( _front >= _n - _n / 16 && _peak <= largeSize )
+        return SQSDLL;
+    if ( _peak >= large )
+        return large_t;
+    double mean = _sum / _n;
+    double var = _sumSq / _n - mean * mean;
+    if ( mean > 0.0 && sqrt( var > 0.0 ? var : 0.0 ) <= maxCv * mean )
+        return SQSCAL;
+    return SQSHEAP;
+}
+
+//
+// Called at the end of a window
+//
+void sqsAdaptive::adapt( void )
+{
+    sched_t best = choose( );
+    if ( best != _type && best == _pending ) {
+        if ( _logger->enabled( 1 ) ) {
+            double mean = _sum / _n;
+            _logger->message( 1, "sqsAdaptive: %s -> %s (peak size %u, "
+                              "%.0f%% to the front, mean hold %g, cv %g)\n",
+                              typeNames[ _type ], typeNames[ best ], _peak,
+                              100.0 * _front / _n, mean,
+                              ( mean > 0.0 ? sqrt( fabs( _sumSq / _n - mean * mean ) ) / mean : 0.0 ) );
+        }
+        migrate( best );
+    }
+    _pending = best;
+    _n = _front = 0;
+    _peak = _q->size( );
+    _sum = _sumSq = 0.0;
+}
+
+//
+// The notices are taken from the front of the old backend, with their
+// processes kept alive, and inserted in the new one. insertAt( ) puts
+// each notice before those with the same time, so the notices with
+// the same time are inserted in reverse order. A linked list gets all
+// of them in reverse order, so that each one goes to its front; the
+// other backends get them in order of time, as the ladder queue sorts
+// the notices earlier than its first one at each insertion.
+//
+void sqsAdaptive::migrate( sched_t type )
+{
+    assert( SQSADAPTIVE != type );
+    if ( type == _type )
+        return;
+    // Each backend is an sqs, with its own logger, so it is only built
+    // once; the one left behind is empty, and waits for the next switch
+    if ( 0 == _backends[ type ] )
+        _backends[ type ] = builders[ type ]( );
+    sqs* q = _backends[ type ];
+    while ( !_q->empty( ) ) {
+        absEvNotice* ev = _q->first( );
+        _moving.push_back( make_pair( handle_p( ev->proc( ) ), ev->evTime( ) ) );
+        _q->remove( ev );
+    }
+    if ( SQSDLL == type ) {
+        for ( size_t i = _moving.size( ); i-- > 0; )
+            q->insertAt( _moving[ i ].first, _moving[ i ].second );
+    } else {
+        size_t i = 0;
+        while ( i < _moving.size( ) ) {
+            size_t j = i + 1;
+            while ( j < _moving.size( ) && _moving[ j ].second == _moving[ i ].second )
+                j++;
+            for ( size_t k = j; k-- > i; )
+                q->insertAt( _moving[ k ].first, _moving[ k ].second );
+            i = j;
+        }
+    }
+    _moved += _moving.size( );
+    _moving.clear( );
+    _q = q;
+    _type = type;
+    _pending = type;
+    _switches++;
+}
+
+absEvNotice* sqsAdaptive::insertAt( const handle_p& p, simtime_t t )
+{
+    observe( t );
+    absEvNotice* ev = _q->insertAt( p, t );
+    _insertions++;
+    observed( );
+    return ev;
+}
+
+absEvNotice* sqsAdaptive::insert( const handle_p& p, const handle_p& q, enum position_t where )
+{
+    observe( q->evTime( ) );
+    absEvNotice* ev = _q->insert( p, q, where );
+    _insertions++;
+    observed( );
+    return ev;
+}
+
+absEvNotice* sqsAdaptive::first( void ) const
+{
+    absEvNotice* ev = _q->first( );
+    if ( 0 != ev )
+        _now = ev->evTime( );
+    return ev;
+}
+
+void sqsAdaptive::remove( absEvNotice* ev )
+{
+    _q->remove( ev );
+    _deletions++;
+}
+
+void sqsAdaptive::reschedule( absEvNotice* ev, simtime_t t )
+{
+    observe( t );
+    _q->reschedule( ev, t );
+    _insertions++;
+    _deletions++;
+    observed( );
+}
+
+void sqsAdaptive::insertBatch( const handle_p* p, size_t n, simtime_t t )
+{
+    for ( size_t i=0; i<n; i++ )
+        observe( t );
+    _q->insertBatch( p, n, t );
+    _insertions += n;
+    observed( );
+}
+
+void sqsAdaptive::insertBatch( const handle_p* p, size_t n, const simtime_t* t )
+{
+    for ( size_t i=0; i<n; i++ )
+        observe( t[ i ] );
+    _q->insertBatch( p, n, t );
+    _insertions += n;
+    observed( );
+}
+
+void sqsAdaptive::clear( void )
+{
+    _q->clear( );
+}
+
+void sqsAdaptive::dump_sqs( void ) const
+{
+    _q->dump_sqs( );
+}
+
+void sqsAdaptive::report( void ) const
+{
+    cout << endl
+	 << "Adaptive SQS statistics:" << endl
+	 << "  Num. of insertions..........." << _insertions << endl
+	 << "  Num. of deletions............" << _deletions << endl
+	 << "  Num. of switches............." << _switches << endl
+	 << "  Notices moved................" << _moved << endl
+	 << "  Backend......................" << typeNames[ _type ] << endl;
+    _q->report( );
+}
@@ -0,0 +1,120 @@
+/*****************************************************************************
+ *
+ * sqsAdaptive.hh
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#ifndef SQSADAPTIVE_HH
+#define SQSADAPTIVE_HH
+
+#include <cstdlib>
+#include <utility>
+#include <vector>
+#include "process.hh"
+#include "sqs.hh"
+
+//
+// A sequencing set which keeps its notices in another one (the
+// "backend"), and moves them to a backend of a different type when
+// the load changes. Each insertion and rescheduling is observed: its
+// distance from the first notice (the hold time), whether it goes to
+// the front of the sqs, and the size of the sqs. Every window
+// observations, the best type for the window is chosen:
+//
+//   - sqsDll, when the sqs is small (at most smallSize notices), or
+//     when almost all the notices go to the front;
+//   - sqsLadder (sqsWheel with integer time), when the sqs is large
+//     (at least largeSize notices);
+//   - sqsCal, when the hold times are regular (their coefficient of
+//     variation is at most maxCv), as the calendar adapts its bins
+//     to them;
+//   - sqsHeap, otherwise.
+//
+// To leave sqsDll, or sqsLadder, the size must go below half the
+// threshold, and a different type must be chosen in two windows in a
+// row, so that the sqs does not switch back and forth. On a switch,
+// the notices are moved in order to the new backend; since they are
+// part of the processes (see absEvNotice), their addresses do not
+// change. Each type of backend is built the first time it is needed,
+// and kept until the sqs is deleted. The switches are logged, at
+// level 1, by the logger of the sqs.
+//
+// The hold times are measured from the time of the first notice at
+// the last call to first( ), which the scheduler makes at each event;
+// the backend is not asked for its first notice at each insertion, as
+// sqsWheel does not accept notices earlier than it.
+//
+class sqsAdaptive : public sqs {
+public:
+
+    sqsAdaptive( sched_t initial = SQSDLL, unsigned int window = 4096 );
+    virtual ~sqsAdaptive( );
+
+    // Modifiers
+    absEvNotice* insertAt( const handle_p& p, simtime_t t ) final;
+    absEvNotice* insert( const handle_p& p, const handle_p& q, enum position_t where ) final;
+    void remove( absEvNotice* ev ) final;
+    void reschedule( absEvNotice* ev, simtime_t t ) final;
+    void insertBatch( const handle_p* p, size_t n, simtime_t t ) final;
+    void insertBatch( const handle_p* p, size_t n, const simtime_t* t ) final;
+    void clear( void );
+
+    // Moves the notices to a backend of the given type
+    void migrate( sched_t type );
+
+    // Accessors
+    absEvNotice* first( void )  const final;
+    void dump_sqs( void )       const;
+    void report( void )         const;
+    bool empty( void )          const final { return _q->empty( ); };
+    unsigned int size( void )   const final { return _q->size( ); };
+    size_t noticeBytes( void )  const { return _q->noticeBytes( ); };
+    sched_t backend( void )     const { return _type; };
+    unsigned long switches( void ) const { return _switches; };
+
+    static const unsigned int smallSize = 32;
+    static const unsigned int largeSize = 16384;
+    static const double maxCv;
+
+protected:
+
+    void observe( simtime_t t );        // Before an insertion
+    void observed( void );              // After it
+    void adapt( void );
+    sched_t choose( void ) const;
+
+    sqs*                _q;             // Backend
+    sqs*                _backends[ SQSADAPTIVE ];   // Built so far, by type
+    mutable simtime_t   _now;           // Time of the first notice, at the
+                                        // last call to first( )
+    sched_t             _type;          // Type of the backend
+    sched_t             _pending;       // Chosen in the last window
+    unsigned int        _window;
+    unsigned int        _n;             // Observations in this window
+    unsigned int        _front;         // Of which to the front
+    unsigned int        _peak;          // Max size in this window
+    double              _sum;           // Of the hold times
+    double              _sumSq;
+    unsigned long       _switches;
+    unsigned long       _moved;         // Notices moved by the switches
+    vector< pair< handle_p, simtime_t > > _moving;
+};
+
+#endif
@@ -23,21 +23,34 @@
 
 #include <iostream>
 #include <cassert>
+#include <cmath>
+#include <algorithm>
 #include "handle.hh"
 #include "sqsCal.hh"
 #include "process.hh"
 
+sqs* sqsCalBuilder( void ) 
+{
+    return new sqsCal( );
+}
+
 sqsCal::sqsCal( unsigned int nbins,     // Number of entries
                 double bwidth           // Width of an entry
                 ) :
     sqs( ),
-    _sqs( nbins ),
+    _sqs( nbins, bin_t( ) ),
+    _old( ),
+    _times( ),
     _nbins( nbins ),
     _bwidth( bwidth ),
-    _t( 0.0 ),
-    _sqs_len( 0 )
+    _t( HUGE_VAL ),
+    _first( 0 ),
+    _sqs_len( 0 ),
+    _resizes( 0 ),
+    _directSearches( 0 )
 {
-
+    assert( nbins > 0 );
+    assert( bwidth > 0.0 );
 }
 
 sqsCal::~sqsCal( )
@@ -45,6 +58,62 @@ sqsCal::~sqsCal( )
 
 }
 
+unsigned int sqsCal::bin( double t ) const
+{
+    double i = fmod( floor( t / _bwidth ), (double)_nbins );
+    if ( i < 0.0 )
+        i += _nbins;
+    return (unsigned int)i;
+}
+
+//
+// Links ev before pos in bin b, or at the end of b if pos is 0
+//
+void sqsCal::link( absEvNotice* ev, absEvNotice* pos, bin_t& b )
+{
+    ev->_next = pos;
+    ev->_prev = ( 0 != pos ? pos->_prev : b.tail );
+    if ( 0 != ev->_prev )
+        ev->_prev->_next = ev;
+    else
+        b.head = ev;
+    if ( 0 != pos )
+        pos->_prev = ev;
+    else
+        b.tail = ev;
+}
+
+void sqsCal::unlink( absEvNotice* ev )
+{
+    bin_t& b( _sqs[ bin( ev->_time ) ] );
+    if ( 0 != ev->_prev )
+        ev->_prev->_next = ev->_next;
+    else
+        b.head = ev->_next;
+    if ( 0 != ev->_next )
+        ev->_next->_prev = ev->_prev;
+    else
+        b.tail = ev->_prev;
+}
+
+//
+// Links ev before the notices of its bin with the same or a later time
+//
+void sqsCal::place( absEvNotice* ev )
+{
+    const simtime_t t = ev->_time;
+    bin_t& b( _sqs[ bin( t ) ] );
+    absEvNotice* pos = b.head;
+    while ( 0 != pos && pos->_time < t )
+        pos = pos->_next;
+    link( ev, pos, b );
+
+    if ( t < _t )
+        _t = t;
+    if ( 0 != _first && t <= _first->_time )
+        _first = ev;
+}
+
 //
 // Creates a new event notice for process p at time t. Process p is inserted
 // _before_ any other process already scheduled for time t.
@@ -53,25 +122,18 @@ sqsCal::~sqsCal( )
 // - t must be greater or equal to the current simulation time;
 // - p must _not_ already have an associated event notice;
 //
-absEvNotice* sqsCal::insertAt( const handle_p& p, double t )
+absEvNotice* sqsCal::insertAt( const handle_p& p, simtime_t t )
 {
-    bin_t::iterator _sqs_it;
-
     assert( !p->terminated( ) );
     assert( 0 == p->notice( ) );
 
-    unsigned int i = (unsigned int)( t / _bwidth ) % _nbins;
-
-    for ( _sqs_it = _sqs[i].begin( ); _sqs_it != _sqs[i].end( ); _sqs_it++ ) {
-	if ( (*_sqs_it)->_time >= t ) 
-	    break;
-    }
-    
-    calEvNotice* ev = new calEvNotice( t, p );
-    
-    ev->_pos = _sqs[i].insert( _sqs_it, ev );
+    absEvNotice* ev = bind( p, t );
+    place( ev );
     _insertions++;
     _sqs_len++;
+
+    if ( _sqs_len > 2 * _nbins )
+        resize( 2 * _nbins );
     return ev;
 }
 
@@ -87,28 +149,24 @@ absEvNotice* sqsCal::insert( const handle_p& p,
                              const handle_p& q, 
                              enum position_t where )
 {
-    calEvNotice* ev_q = dynamic_cast<calEvNotice*>( q->notice( ) );
-    calEvNotice* ev_p = dynamic_cast<calEvNotice*>( p->notice( ) );
+    absEvNotice* ev_q = q->notice( );
 
     assert( !p->terminated( ) );
     assert( !q->terminated( ) );
-    assert( 0 == ev_p );
+    assert( 0 == p->notice( ) );
     assert( 0 != ev_q );
 
-    double t = ev_q->evTime( );
-    unsigned int i = (unsigned int)( t / _bwidth ) % _nbins;
-
-    bin_t::iterator _sqs_it( ev_q->_pos );
-
-    assert( _sqs_it != _sqs[i].end( ) );
-
-    if ( where == pos_after )
-	_sqs_it++;
-
-    ev_p = new calEvNotice( t, p );
-    ev_p->_pos = _sqs[i].insert( _sqs_it, ev_p );
+    simtime_t t = ev_q->evTime( );
+    absEvNotice* ev_p = bind( p, t );
+    link( ev_p, ( where == pos_after ? ev_q->_next : ev_q ), _sqs[ bin( t ) ] );
     _insertions++;
     _sqs_len++;
+
+    if ( where == pos_before && ev_q == _first )
+        _first = ev_p;
+
+    if ( _sqs_len > 2 * _nbins )
+        resize( 2 * _nbins );
     return ev_p;
 }
 
@@ -117,39 +175,208 @@ absEvNotice* sqsCal::insert( const handle_p& p,
 //
 void sqsCal::remove( absEvNotice* ev )
 {
-    calEvNotice* calEv = dynamic_cast<calEvNotice*>( ev );
-    assert( 0 != calEv );
+    assert( 0 != ev->proc( ) );
+    unlink( ev );
+    _deletions++;
+    _sqs_len--;
+
+    if ( ev == _first )
+        _first = 0;
+    unbind( ev );
 
-    bin_t::iterator _sqs_it( calEv->_pos );
-    double t = ev->evTime( );
-    unsigned int i = (unsigned int)( t / _bwidth ) % _nbins;
+    if ( _nbins > minBins && _sqs_len + 2 < _nbins / 2 )
+        resize( _nbins / 2 );
+}
 
-    _sqs[i].erase( _sqs_it );
+//
+// The size does not change, so there is no resize
+//
+void sqsCal::reschedule( absEvNotice* ev, simtime_t t )
+{
+    assert( 0 != ev->proc( ) );
+    unlink( ev );
+    if ( ev == _first )
+        _first = 0;
+    ev->_time = t;
+    place( ev );
+    _insertions++;
     _deletions++;
-    _sqs_len--;
 }
 
-void sqsCal::reset( void )
+//
+// Each run of notices with the same time is linked in a row in its
+// bin, which is scanned from the end, as the times of the batch do
+// not decrease. The calendar is resized once, at the end.
+//
+template< class Times > void sqsCal::batch( const handle_p* p, size_t n, Times t )
+{
+    size_t i = 0;
+    while ( i < n ) {
+        const simtime_t ti = t[ i ];
+        bin_t& b( _sqs[ bin( ti ) ] );
+        absEvNotice* pos = 0;
+        absEvNotice* prev = b.tail;
+        while ( 0 != prev && prev->_time >= ti ) {
+            pos = prev;
+            prev = prev->_prev;
+        }
+        absEvNotice* head = 0;
+        size_t j = i;
+        for ( ; j < n && t[ j ] == ti; j++ ) {
+            assert( !p[ j ]->terminated( ) );
+            assert( 0 == p[ j ]->notice( ) );
+            absEvNotice* ev = bind( p[ j ], ti );
+            link( ev, pos, b );
+            if ( 0 == head )
+                head = ev;
+        }
+        assert( j == n || t[ j ] > ti );
+        if ( ti < _t )
+            _t = ti;
+        if ( 0 != _first && ti <= _first->_time )
+            _first = head;
+        i = j;
+    }
+    _insertions += n;
+    _sqs_len += n;
+
+    unsigned int nbins = _nbins;
+    while ( _sqs_len > 2 * nbins )
+        nbins *= 2;
+    if ( nbins != _nbins )
+        resize( nbins );
+}
+
+void sqsCal::insertBatch( const handle_p* p, size_t n, simtime_t t )
+{
+    sameTime times = { t };
+    batch( p, n, times );
+}
+
+void sqsCal::insertBatch( const handle_p* p, size_t n, const simtime_t* t )
+{
+    batch( p, n, t );
+}
+
+void sqsCal::clear( void )
+{
+    sqs_t::iterator it;
+    for ( it = _sqs.begin( ); it != _sqs.end( ); it++ ) {
+        absEvNotice* ev = it->head;
+        it->head = it->tail = 0;
+        while ( 0 != ev ) {
+            absEvNotice* next = ev->_next;
+            unbind( ev );
+            ev = next;
+        }
+    }
+    _sqs_len = 0;
+    _first = 0;
+    _t = HUGE_VAL;
+}
+
+//
+// Average gap between the first notices, leaving out the gaps larger
+// than twice the average, times three (see Brown's paper). Returns 0
+// if there are not enough notices at different times.
+//
+double sqsCal::sampleWidth( void ) const
+{
+    vector< double >& times( _times );
+    times.clear( );
+    sqs_t::const_iterator it;
+    for ( it = _sqs.begin( ); it != _sqs.end( ); it++ )
+        for ( absEvNotice* ev = it->head; 0 != ev; ev = ev->_next )
+            times.push_back( ev->_time );
+    size_t k = std::min( (size_t)sampleSize, times.size( ) );
+    if ( k < 2 )
+        return 0.0;
+    partial_sort( times.begin( ), times.begin( ) + k, times.end( ) );
+
+    double avg = ( times[ k-1 ] - times[ 0 ] ) / ( k - 1 );
+    double sum = 0.0;
+    unsigned int n = 0;
+    for ( size_t j=1; j<k; j++ ) {
+        double gap = times[ j ] - times[ j-1 ];
+        if ( gap <= 2.0 * avg ) {
+            sum += gap;
+            n++;
+        }
+    }
+    return ( n > 0 ? 3.0 * sum / n : 0.0 );
+}
+
+//
+// Moves all the notices into nbins bins. The notices with the same
+// time come from the same bin, and keep their order.
+//
+void sqsCal::resize( unsigned int nbins )
 {
+    double w = sampleWidth( );
+    const bin_t emptyBin = { 0, 0 };
+    _old.assign( nbins, emptyBin );
+    _old.swap( _sqs );
+    _nbins = nbins;
+    if ( w > 0.0 )
+        _bwidth = w;
 
+    sqs_t::iterator it;
+    for ( it = _old.begin( ); it != _old.end( ); it++ ) {
+        absEvNotice* ev = it->head;
+        while ( 0 != ev ) {
+            absEvNotice* next = ev->_next;
+            bin_t& b( _sqs[ bin( ev->_time ) ] );
+            absEvNotice* pos = 0;
+            absEvNotice* prev = b.tail;
+            while ( 0 != prev && prev->_time > ev->_time ) {
+                pos = prev;
+                prev = prev->_prev;
+            }
+            link( ev, pos, b );
+            ev = next;
+        }
+    }
+    _resizes++;
 }
 
+//
+// Scans the bins one day at a time, starting from the day of _t,
+// for at most one year; if no notice is found, the bin with the
+// earliest notice is searched directly. The notices with the same
+// time are in the same bin, so the first notice of that bin is the
+// first of the sqs.
+//
 absEvNotice* sqsCal::first( void ) const
 {
     if ( empty( ) )
 	return (absEvNotice*)0;
-    else {
-        unsigned int i = (unsigned int)( _t / _bwidth ) % _nbins;
-        while( 1 ) {
-            calEvNotice* ev = _sqs[i].front( );
-            if ( ev && ev->evTime( ) < _t + _bwidth )
-                return ev;
-            else {
-                _t += _bwidth;
-                i = (i+1) % _nbins;
-            }
+    if ( 0 != _first )
+        return _first;
+
+    // Days are compared as bin( ) computes them, not by the time at
+    // which they end, which may be rounded differently
+    unsigned int i = bin( _t );
+    double day = floor( _t / _bwidth );
+    for ( unsigned int k=0; k<_nbins; k++ ) {
+        if ( 0 != _sqs[i].head &&
+             floor( _sqs[i].head->_time / _bwidth ) <= day ) {
+            _first = _sqs[i].head;
+            break;
         }
+        i = ( i + 1 == _nbins ? 0 : i + 1 );
+        day += 1.0;
+    }
+
+    if ( 0 == _first ) {
+        _directSearches++;
+        sqs_t::const_iterator it;
+        for ( it = _sqs.begin( ); it != _sqs.end( ); it++ )
+            if ( 0 != it->head &&
+                 ( 0 == _first || it->head->_time < _first->_time ) )
+                _first = it->head;
     }
+    _t = _first->_time;
+    return _first;
 }
 
 void sqsCal::dump_sqs( void ) const
@@ -159,11 +386,10 @@ void sqsCal::dump_sqs( void ) const
     for ( i = 0; i < _nbins; i++ ) {
         cout << "Bin[" << i << "]=";
         
-        bin_t::const_iterator _bin_it;
-        for ( _bin_it = _sqs[i].begin( ); _bin_it != _sqs[i].end( ); _bin_it++ ) 
-            cout << "(proc=" << (*_bin_it)->_proc->id( )
-                 << "/" << (*_bin_it)->_proc->name( )
-                 << " time=" << (*_bin_it)->_time << ") ";
+        for ( absEvNotice* ev = _sqs[i].head; 0 != ev; ev = ev->_next )
+            cout << "(proc=" << ev->_proc->id( )
+                 << "/" << ev->_proc->name( )
+                 << " time=" << ev->_time << ") ";
         cout << endl;
     }
     cout << "[SQS Tail]" << endl;
@@ -175,5 +401,9 @@ void sqsCal::report( void ) const
 	 << "Calendar Queue SQS statistics:" << endl
 	 << "  Num. of insertions..........." << _insertions << endl
 	 << "  Num. of deletions............" << _deletions << endl
+	 << "  Num. of bins................." << _nbins << endl
+	 << "  Bin width...................." << _bwidth << endl
+	 << "  Num. of resizes.............." << _resizes << endl
+	 << "  Num. of direct searches......" << _directSearches << endl
 	 << endl;
 }
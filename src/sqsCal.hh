@@ -27,58 +27,77 @@
 extern "C" {
 #include <stdlib.h>
 }
-#include <list>
 #include <vector>
 #include "handle.hh"
 #include "process.hh"
 #include "sqs.hh"
 
-class calEvNotice;
-
+//
+// Calendar queue (R. Brown, "Calendar Queues: A Fast O(1) Priority
+// Queue Implementation for the Simulation Event Set Problem", CACM
+// 31(10), 1988). The notices are kept in nbins sorted bins, each one
+// holding the notices whose time falls in a "day" of width bwidth,
+// modulo a "year" of nbins days. The number of bins is doubled or
+// halved as the sqs grows or shrinks, and the width is then computed
+// again from the gaps between the first notices. When no notice is
+// found in a whole year, the first one is found by a direct search.
+// The notices of a bin are linked through their _prev and _next
+// fields.
+//
 class sqsCal : public sqs {
 public:
 
     // Typedefs
-    typedef list< calEvNotice* >        bin_t;
+    struct bin_t {
+        absEvNotice* head;
+        absEvNotice* tail;
+    };
     typedef vector< bin_t >             sqs_t;
-    typedef calEvNotice                 evn_t;
 
-    sqsCal( unsigned int nbins, double bwidth );
+    sqsCal( unsigned int nbins = 2, double bwidth = 1.0 );
     virtual ~sqsCal( );
 
     // Modifiers
-    absEvNotice* insertAt( const handle_p& p, double t );
-    absEvNotice* insert( const handle_p& p, const handle_p& q, enum position_t where );
-    void remove( absEvNotice* ev );
-    void reset( void );
+    absEvNotice* insertAt( const handle_p& p, simtime_t t ) final;
+    absEvNotice* insert( const handle_p& p, const handle_p& q, enum position_t where ) final;
+    void remove( absEvNotice* ev ) final;
+    void reschedule( absEvNotice* ev, simtime_t t ) final;
+    void insertBatch( const handle_p* p, size_t n, simtime_t t ) final;
+    void insertBatch( const handle_p* p, size_t n, const simtime_t* t ) final;
+    void clear( void );
 
     // Accessors
-    absEvNotice* first( void )  const;
+    absEvNotice* first( void )  const final;
     void dump_sqs( void )       const;
     void report( void )         const;
-    bool empty( void )          const { return ( 0 == _sqs_len ); };
-    unsigned int size( void )   const { return _sqs_len; };
+    bool empty( void )          const final { return ( 0 == _sqs_len ); };
+    unsigned int size( void )   const final { return _sqs_len; };
 
 protected:
 
+    static const unsigned int minBins = 2;
+    static const unsigned int sampleSize = 25;
+
+    template< class Times > void batch( const handle_p* p, size_t n, Times t );
+    unsigned int bin( double t ) const;
+    void link( absEvNotice* ev, absEvNotice* pos, bin_t& b );
+    void unlink( absEvNotice* ev );
+    void place( absEvNotice* ev );
+    void resize( unsigned int nbins );
+    double sampleWidth( void ) const;
+
     sqs_t _sqs;
+    sqs_t _old;                 // The bins before the last resize, kept
+                                // so that resizing does not allocate
+    mutable vector< double > _times;    // Used by sampleWidth( )
     unsigned int _nbins;        // Number of bins
     double _bwidth;             // Width of a bin
-    mutable double _t;          // Current time
+    mutable double _t;          // No notice is earlier than this
+    mutable absEvNotice* _first;        // 0 if not known
     unsigned long _sqs_len;     // Number of events into the SQS
+    unsigned long _resizes;
+    mutable unsigned long _directSearches;
 
 };
 
-class calEvNotice : public absEvNotice {
-    friend class sqsCal; 
-public:
-    virtual ~calEvNotice( ) { };
-    
-protected:
-    calEvNotice( double t, const handle_p& p ) : 
-	absEvNotice( t, p ) { };
-
-    sqsCal::bin_t::iterator _pos; // Position in the bin
-};
-
 #endif
@@ -27,17 +27,6 @@
 
 #include <cassert>
 #include <iostream>
-
-#ifdef __GNUC__
-#if __GNUC__ < 3
-#include <functional>
-#else
-#include <ext/functional>
-using namespace __gnu_cxx;
-#endif // __GNUC__ < 3
-#endif // __GNUC__
-
-#include <algorithm>
 #include <fstream>
 #include "handle.hh"
 #include "sqsDll.hh"
@@ -51,7 +40,10 @@ sqs* sqsDllBuilder( void )
 // #define DO_STATS
 
 sqsDll::sqsDll( ) :
-    sqs( )
+    sqs( ),
+    _head( 0 ),
+    _tail( 0 ),
+    _size( 0 )
 #ifdef DO_STATS
     , os( "sqsDll.dump" )
 #endif
@@ -64,6 +56,35 @@ sqsDll::~sqsDll( )
 
 }
 
+//
+// Links ev before pos, or at the end of the list if pos is 0
+//
+void sqsDll::link( absEvNotice* ev, absEvNotice* pos )
+{
+    ev->_next = pos;
+    ev->_prev = ( 0 != pos ? pos->_prev : _tail );
+    if ( 0 != ev->_prev )
+        ev->_prev->_next = ev;
+    else
+        _head = ev;
+    if ( 0 != pos )
+        pos->_prev = ev;
+    else
+        _tail = ev;
+}
+
+void sqsDll::unlink( absEvNotice* ev )
+{
+    if ( 0 != ev->_prev )
+        ev->_prev->_next = ev->_next;
+    else
+        _head = ev->_next;
+    if ( 0 != ev->_next )
+        ev->_next->_prev = ev->_prev;
+    else
+        _tail = ev->_prev;
+}
+
 //
 // Creates a new event notice for process p at time t. Process p is inserted
 // _before_ any other process already scheduled for time t.
@@ -74,38 +95,24 @@ sqsDll::~sqsDll( )
 //
 // This routine is highly inefficient. The sequencing set is scanned linearly
 //
-absEvNotice* sqsDll::insertAt( const handle_p& p, double t )
+absEvNotice* sqsDll::insertAt( const handle_p& p, simtime_t t )
 {
-    sqs_t::iterator _sqs_it;
-
     assert( !p->terminated( ) );
     assert( 0 == p->notice( ) );
 
-    /*
-     * We have to find the first position _sqs_it in the Sequencing Set
-     * such that the event time is greater or equal than t. The easy
-     * way to do that is the following:
-     *
-     * for ( _sqs_it = _sqs.begin( ); _sqs_it != _sqs.end( ); _sqs_it++ ) {
-     *   if ( (*_sqs_it)->_time >= t ) 
-     *     break;
-     * }
-     *
-     * Using the <functional> classes, the above construct can be
-     * coded as follows:
-     */
-    _sqs_it = find_if( _sqs.begin(), _sqs.end(), 
-                       compose1( 
-                                bind2nd( greater_equal<double>(), t ),
-                                mem_fun( &absEvNotice::evTime )
-                                )
-                       );             
-
-    assert( _sqs_it == _sqs.end() || (*_sqs_it)->evTime() >= t );
-    dllEvNotice* ev = new dllEvNotice( t, p );
-    
-    ev->_pos = _sqs.insert( _sqs_it, ev );
+    //
+    // We have to find the first position in the Sequencing Set such
+    // that the event time is greater or equal than t.
+    //
+    absEvNotice* pos = _head;
+    while ( 0 != pos && pos->_time < t )
+        pos = pos->_next;
+
+    assert( pos == 0 || pos->evTime() >= t );
+    absEvNotice* ev = bind( p, t );
+    link( ev, pos );
     _insertions++;
+    _size++;
 
 #ifdef DO_STATS
     os << first()->evTime() << " " << size() << endl;
@@ -126,26 +133,17 @@ absEvNotice* sqsDll::insert( const handle_p& p,
                              const handle_p& q, 
                              enum position_t where )
 {
-    dllEvNotice* ev_q = dynamic_cast<dllEvNotice*>( q->notice( ) );
-    dllEvNotice* ev_p = dynamic_cast<dllEvNotice*>( p->notice( ) );
+    absEvNotice* ev_q = q->notice( );
 
     assert( !p->terminated( ) );
     assert( !q->terminated( ) );
-    assert( 0 == ev_p );
+    assert( 0 == p->notice( ) );
     assert( 0 != ev_q );
 
-    sqs_t::iterator _sqs_it( ev_q->_pos );
-
-    assert( _sqs_it != _sqs.end( ) );
-
-    if ( where == pos_after )
-	_sqs_it++;
-
-    double t = ev_q->evTime( );
-    ev_p = new dllEvNotice( t, p );
-
-    ev_p->_pos = _sqs.insert( _sqs_it, ev_p );
+    absEvNotice* ev_p = bind( p, ev_q->evTime( ) );
+    link( ev_p, ( where == pos_after ? ev_q->_next : ev_q ) );
     _insertions++;
+    _size++;
 
 #ifdef DO_STATS
     os << first()->evTime() << " " << size() << endl;
@@ -163,36 +161,91 @@ void sqsDll::remove( absEvNotice* ev )
     os << first()->evTime() << " ";
 #endif
 
-    dllEvNotice* dllEv = dynamic_cast<dllEvNotice*>( ev );
-    assert( 0 != dllEv );
-
-    sqs_t::iterator _sqs_it( dllEv->_pos );
-    _sqs.erase( _sqs_it );
+    assert( 0 != ev->proc( ) );
+    unlink( ev );
     _deletions++;
+    _size--;
+    unbind( ev );
 
 #ifdef DO_STATS
     os << size() << endl;
 #endif
 }
 
-void sqsDll::clear( void )
+//
+// The list is scanned from the old position of ev: backwards if t is
+// earlier, forwards otherwise. A hold( ) of a process which is near
+// the head of the list does not scan the notices before it.
+//
+void sqsDll::reschedule( absEvNotice* ev, simtime_t t )
 {
-    _sqs.clear( );
+    assert( 0 != ev->proc( ) );
+    absEvNotice* pos = ev->_next;
+    unlink( ev );
+    absEvNotice* prev = ( 0 != pos ? pos->_prev : _tail );
+    while ( 0 != prev && prev->_time >= t ) {
+        pos = prev;
+        prev = prev->_prev;
+    }
+    while ( 0 != pos && pos->_time < t )
+        pos = pos->_next;
+    ev->_time = t;
+    link( ev, pos );
+    _insertions++;
+    _deletions++;
 }
 
-absEvNotice* sqsDll::first( void ) const
+//
+// A single scan of the list: the times of the batch do not decrease,
+// so the position of each notice is at or after that of the previous
+// one, and the notices with the same time are linked in a row before
+// the first old notice with that time.
+//
+template< class Times > void sqsDll::batch( const handle_p* p, size_t n, Times t )
+{
+    absEvNotice* pos = _head;
+    for ( size_t i=0; i<n; i++ ) {
+        assert( !p[ i ]->terminated( ) );
+        assert( 0 == p[ i ]->notice( ) );
+        assert( 0 == i || t[ i ] >= t[ i-1 ] );
+        while ( 0 != pos && pos->_time < t[ i ] )
+            pos = pos->_next;
+        link( bind( p[ i ], t[ i ] ), pos );
+    }
+    _insertions += n;
+    _size += n;
+}
+
+void sqsDll::insertBatch( const handle_p* p, size_t n, simtime_t t )
+{
+    sameTime times = { t };
+    batch( p, n, times );
+}
+
+void sqsDll::insertBatch( const handle_p* p, size_t n, const simtime_t* t )
+{
+    batch( p, n, t );
+}
+
+void sqsDll::clear( void )
 {
-    return ( empty() ? 0 : _sqs.front( ) );
+    absEvNotice* ev = _head;
+    _head = _tail = 0;
+    _size = 0;
+    while ( 0 != ev ) {
+        absEvNotice* next = ev->_next;
+        unbind( ev );
+        ev = next;
+    }
 }
 
 void sqsDll::dump_sqs( void ) const
 {
-    sqs_t::const_iterator _sqs_it;
     cout << "[SQS Head ";    
-    for ( _sqs_it = _sqs.begin( ); _sqs_it != _sqs.end( ); _sqs_it ++ ) 
-	cout << "(proc=" << (*_sqs_it)->_proc->id( )
-	     << "/" << (*_sqs_it)->_proc->name( )
-	     << " time=" << (*_sqs_it)->_time << ") ";
+    for ( absEvNotice* ev = _head; 0 != ev; ev = ev->_next )
+	cout << "(proc=" << ev->_proc->id( )
+	     << "/" << ev->_proc->name( )
+	     << " time=" << ev->_time << ") ";
     cout << " SQS Tail]" << endl;
 }
 
@@ -25,53 +25,47 @@
 #define SQSDLL_HH
 
 #include <cstdlib>
-#include <list>
 #include <fstream>
 #include "process.hh"
 #include "sqs.hh"
 
-class dllEvNotice;
-
+//
+// The event notices are linked in a list, through their _prev and
+// _next fields, in order of time.
+//
 class sqsDll : public sqs {
 public:
 
-    // Typedefs
-    typedef list< dllEvNotice* > sqs_t;
-    typedef dllEvNotice          evn_t;
-
     sqsDll( );
     virtual ~sqsDll( );
 
     // Modifiers
-    absEvNotice* insertAt( const handle_p& p, double t );
-    absEvNotice* insert( const handle_p& p, const handle_p& q, enum position_t where );
-    void remove( absEvNotice* ev );
+    absEvNotice* insertAt( const handle_p& p, simtime_t t ) final;
+    absEvNotice* insert( const handle_p& p, const handle_p& q, enum position_t where ) final;
+    void remove( absEvNotice* ev ) final;
+    void reschedule( absEvNotice* ev, simtime_t t ) final;
+    void insertBatch( const handle_p* p, size_t n, simtime_t t ) final;
+    void insertBatch( const handle_p* p, size_t n, const simtime_t* t ) final;
     void clear( void );
 
     // Accessors
-    absEvNotice* first( void )  const;
+    absEvNotice* first( void )  const final { return _head; };
     void dump_sqs( void )       const;
     void report( void )         const;
-    bool empty( void )          const { return _sqs.empty( ); };
-    unsigned int size( void )   const { return _sqs.size( ); };
+    bool empty( void )          const final { return ( 0 == _head ); };
+    unsigned int size( void )   const final { return _size; };
 
 protected:
 
-    sqs_t _sqs;
-    ofstream os;
-
-};
+    template< class Times > void batch( const handle_p* p, size_t n, Times t );
+    void link( absEvNotice* ev, absEvNotice* pos );
+    void unlink( absEvNotice* ev );
 
-class dllEvNotice : public absEvNotice {
-    friend class sqsDll;
-public:
-    virtual ~dllEvNotice( ) { };
-
-protected:
-    dllEvNotice( double t, const handle_p& p ) : 
-	absEvNotice( t, p ) { };
+    absEvNotice* _head;
+    absEvNotice* _tail;
+    unsigned int _size;
+    ofstream os;
 
-    sqsDll::sqs_t::iterator _pos;
 };
 
 #endif
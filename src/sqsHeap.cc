@@ -0,0 +1,359 @@
+/*****************************************************************************
+ *
+ * sqsHeap.cc
+ *
+ * Sequencing Set implementation based on an indexed 4-ary heap.
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include "handle.hh"
+#include "sqsHeap.hh"
+#include "process.hh"
+
+sqs* sqsHeapBuilder( void )
+{
+    return new sqsHeap( );
+}
+
+sqsHeap::sqsHeap( ) :
+    sqs         ( ),
+    _size       ( 0 ),
+    _seq        ( 0 ),
+    _maxSize    ( 0 )
+{
+
+}
+
+sqsHeap::~sqsHeap( )
+{
+
+}
+
+void sqsHeap::place( unsigned int i, const entry_t& e )
+{
+    _heap[ i ] = e;
+    e.ev->_index = i;
+}
+
+void sqsHeap::siftUp( unsigned int i, entry_t e )
+{
+    while ( i > 0 ) {
+        unsigned int parent = ( i - 1 ) / arity;
+        if ( !before( e, _heap[ parent ] ) )
+            break;
+        place( i, _heap[ parent ] );
+        i = parent;
+    }
+    place( i, e );
+}
+
+void sqsHeap::siftDown( unsigned int i, entry_t e )
+{
+    const unsigned int n = _heap.size( );
+    while ( 1 ) {
+        unsigned int c = arity * i + 1;
+        if ( c >= n )
+            break;
+        unsigned int end = std::min( c + arity, n );
+        unsigned int best = c;
+        for ( unsigned int j = c + 1; j < end; j++ )
+            if ( before( _heap[ j ], _heap[ best ] ) )
+                best = j;
+        if ( !before( _heap[ best ], e ) )
+            break;
+        place( i, _heap[ best ] );
+        i = best;
+    }
+    place( i, e );
+}
+
+//
+// Entry i gets the key of e, and is moved up or down
+//
+void sqsHeap::moveEntry( unsigned int i, const entry_t& e )
+{
+    if ( i > 0 && before( e, _heap[ ( i - 1 ) / arity ] ) )
+        siftUp( i, e );
+    else
+        siftDown( i, e );
+}
+
+//
+// The last entry takes the place of entry i
+//
+void sqsHeap::removeEntry( unsigned int i )
+{
+    entry_t last = _heap.back( );
+    _heap.pop_back( );
+    if ( i == _heap.size( ) )
+        return;
+    moveEntry( i, last );
+}
+
+//
+// Unlinks ev from its group, which must have some other notice. If ev
+// is the head of the group, the next notice takes its entry.
+//
+void sqsHeap::unlinkGroup( absEvNotice* ev )
+{
+    if ( 0 != ev->_gprev ) {
+        ev->_gprev->_gnext = ev->_gnext;
+        if ( 0 != ev->_gnext )
+            ev->_gnext->_gprev = ev->_gprev;
+    } else {
+        absEvNotice* next = ev->_gnext;
+        assert( 0 != next );
+        next->_gprev = 0;
+        next->_index = ev->_index;
+        _heap[ next->_index ].ev = next;
+    }
+    ev->_gprev = ev->_gnext = 0;
+}
+
+//
+// Creates a new event notice for process p at time t. Process p is inserted
+// _before_ any other process already scheduled for time t.
+//
+// Preconditions:
+// - t must be greater or equal to the current simulation time;
+// - p must _not_ already have an associated event notice;
+//
+absEvNotice* sqsHeap::insertAt( const handle_p& p, simtime_t t )
+{
+    assert( !p->terminated( ) );
+    assert( 0 == p->notice( ) );
+
+    absEvNotice* ev = bind( p, t );
+    entry_t e;
+    e.time = t;
+    e.seq = --_seq;
+    e.ev = ev;
+    _heap.push_back( e );
+    siftUp( _heap.size( ) - 1, e );
+
+    _insertions++;
+    if ( ++_size > _maxSize )
+        _maxSize = _size;
+    return ev;
+}
+
+//
+// Schedules p immediately after or before q, in the group of q
+//
+// Preconditions:
+// - p and q must not be terminated processes;
+// - p must _not_ already have an associated event notice;
+// - q _must_ have an associated event notice.
+//
+absEvNotice* sqsHeap::insert( const handle_p& p,
+                              const handle_p& q,
+                              enum position_t where )
+{
+    absEvNotice* ev_q = q->notice( );
+
+    assert( !p->terminated( ) );
+    assert( !q->terminated( ) );
+    assert( 0 == p->notice( ) );
+    assert( 0 != ev_q );
+
+    absEvNotice* ev_p = bind( p, ev_q->evTime( ) );
+    if ( where == pos_after ) {
+        ev_p->_gprev = ev_q;
+        ev_p->_gnext = ev_q->_gnext;
+        if ( 0 != ev_q->_gnext )
+            ev_q->_gnext->_gprev = ev_p;
+        ev_q->_gnext = ev_p;
+    } else {
+        ev_p->_gnext = ev_q;
+        ev_p->_gprev = ev_q->_gprev;
+        if ( 0 != ev_q->_gprev )
+            ev_q->_gprev->_gnext = ev_p;
+        else {
+            // p becomes the head of the group
+            ev_p->_index = ev_q->_index;
+            _heap[ ev_p->_index ].ev = ev_p;
+        }
+        ev_q->_gprev = ev_p;
+    }
+
+    _insertions++;
+    if ( ++_size > _maxSize )
+        _maxSize = _size;
+    return ev_p;
+}
+
+//
+// Removes the event notice ev from the sequencing set. If ev is the
+// head of its group, the next notice of the group takes its entry.
+//
+void sqsHeap::remove( absEvNotice* ev )
+{
+    assert( 0 != ev->proc( ) );
+
+    if ( 0 != ev->_gprev || 0 != ev->_gnext )
+        unlinkGroup( ev );
+    else {
+        assert( _heap[ ev->_index ].ev == ev );
+        removeEntry( ev->_index );
+    }
+
+    _deletions++;
+    assert( _size > 0 );
+    _size--;
+    unbind( ev );
+}
+
+//
+// A notice alone in its entry keeps it, and the entry is moved up or
+// down with the new key; otherwise the notice leaves its group, and
+// gets an entry of its own.
+//
+void sqsHeap::reschedule( absEvNotice* ev, simtime_t t )
+{
+    assert( 0 != ev->proc( ) );
+
+    entry_t e;
+    e.time = t;
+    e.seq = --_seq;
+    e.ev = ev;
+    ev->_time = t;
+    if ( 0 != ev->_gprev || 0 != ev->_gnext ) {
+        unlinkGroup( ev );
+        _heap.push_back( e );
+        siftUp( _heap.size( ) - 1, e );
+    } else {
+        assert( _heap[ ev->_index ].ev == ev );
+        moveEntry( ev->_index, e );
+    }
+
+    _insertions++;
+    _deletions++;
+}
+
+//
+// The notices with the same time form a group, with a single entry,
+// which comes before the old entries with that time. The new entries
+// are appended to the heap, and sifted up; when they are more than
+// the old ones, the heap is built again from the bottom instead,
+// which takes linear time.
+//
+template< class Times > void sqsHeap::batch( const handle_p* p, size_t n, Times t )
+{
+    const size_t old = _heap.size( );
+    size_t i = 0;
+    while ( i < n ) {
+        assert( !p[ i ]->terminated( ) );
+        assert( 0 == p[ i ]->notice( ) );
+        entry_t e;
+        e.time = t[ i ];
+        e.seq = --_seq;
+        e.ev = bind( p[ i ], t[ i ] );
+        e.ev->_index = _heap.size( );
+        _heap.push_back( e );
+        absEvNotice* last = e.ev;
+        size_t j = i + 1;
+        for ( ; j < n && t[ j ] == t[ i ]; j++ ) {
+            assert( !p[ j ]->terminated( ) );
+            assert( 0 == p[ j ]->notice( ) );
+            absEvNotice* ev = bind( p[ j ], t[ j ] );
+            ev->_gprev = last;
+            last->_gnext = ev;
+            last = ev;
+        }
+        assert( j == n || t[ j ] > t[ i ] );
+        i = j;
+    }
+
+    const size_t size = _heap.size( );
+    if ( size - old > old ) {
+        if ( size > 1 )
+            for ( size_t k = ( size - 2 ) / arity + 1; k-- > 0; )
+                siftDown( k, _heap[ k ] );
+    } else
+        for ( size_t k = old; k < size; k++ )
+            siftUp( k, _heap[ k ] );
+
+    _insertions += n;
+    _size += n;
+    if ( _size > _maxSize )
+        _maxSize = _size;
+}
+
+void sqsHeap::insertBatch( const handle_p* p, size_t n, simtime_t t )
+{
+    sameTime times = { t };
+    batch( p, n, times );
+}
+
+void sqsHeap::insertBatch( const handle_p* p, size_t n, const simtime_t* t )
+{
+    batch( p, n, t );
+}
+
+void sqsHeap::clear( void )
+{
+    vector< entry_t > old;
+    old.swap( _heap );
+    _size = 0;
+    vector< entry_t >::const_iterator it;
+    for ( it = old.begin( ); it != old.end( ); it++ ) {
+        absEvNotice* ev = it->ev;
+        while ( 0 != ev ) {
+            absEvNotice* next = ev->_gnext;
+            unbind( ev );
+            ev = next;
+        }
+    }
+}
+
+void sqsHeap::dump_sqs( void ) const
+{
+    vector< entry_t > sorted( _heap );
+    sort( sorted.begin( ), sorted.end( ), before );
+    cout << "[SQS Head ";
+    vector< entry_t >::const_iterator it;
+    for ( it = sorted.begin( ); it != sorted.end( ); it++ )
+        for ( absEvNotice* ev = it->ev; 0 != ev; ev = ev->_gnext )
+            cout << "(proc=" << ev->_proc->id( )
+                 << "/" << ev->_proc->name( )
+                 << " time=" << ev->_time << ") ";
+    cout << " SQS Tail]" << endl;
+}
+
+// At most one heap entry
+size_t sqsHeap::noticeBytes( void ) const
+{
+    return sizeof( entry_t );
+}
+
+void sqsHeap::report( void ) const
+{
+    cout << endl
+	 << "4-ary heap SQS statistics:" << endl
+	 << "  Num. of insertions..........." << _insertions << endl
+	 << "  Num. of deletions............" << _deletions << endl
+	 << "  Max SQS size................." << _maxSize << endl
+	 << endl;
+}
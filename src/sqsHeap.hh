@@ -0,0 +1,98 @@
+/*****************************************************************************
+ *
+ * sqsHeap.hh
+ *
+ * Implementation of a Sequencing Set using an indexed 4-ary heap
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#ifndef SQSHEAP_HH
+#define SQSHEAP_HH
+
+#include <cstdlib>
+#include <vector>
+#include "process.hh"
+#include "sqs.hh"
+
+//
+// The event notices are kept in a 4-ary heap, stored in an array,
+// ordered by event time and then by a sequence number. insertAt( )
+// gives the new notice a sequence number smaller than all the previous
+// ones, so that it comes before the other notices with the same time.
+// A notice inserted before or after another notice q cannot be given a
+// sequence number in general; instead, it joins the "group" of q, a
+// list of notices which share a single entry of the heap, linked
+// through their _gprev and _gnext fields. The heap entry points to the
+// first notice of the group, and each notice at the head of a group
+// stores the index of its entry, so that it can be removed, or moved
+// up and down by reschedule( ), without searching.
+//
+class sqsHeap : public sqs {
+public:
+
+    sqsHeap( );
+    virtual ~sqsHeap( );
+
+    // Modifiers
+    absEvNotice* insertAt( const handle_p& p, simtime_t t ) final;
+    absEvNotice* insert( const handle_p& p, const handle_p& q, enum position_t where ) final;
+    void remove( absEvNotice* ev ) final;
+    void reschedule( absEvNotice* ev, simtime_t t ) final;
+    void insertBatch( const handle_p* p, size_t n, simtime_t t ) final;
+    void insertBatch( const handle_p* p, size_t n, const simtime_t* t ) final;
+    void clear( void );
+
+    // Accessors
+    absEvNotice* first( void )  const final { return ( empty( ) ? 0 : _heap[ 0 ].ev ); };
+    void dump_sqs( void )       const;
+    void report( void )         const;
+    bool empty( void )          const final { return ( 0 == _size ); };
+    unsigned int size( void )   const final { return _size; };
+    size_t noticeBytes( void )  const;
+
+protected:
+
+    template< class Times > void batch( const handle_p* p, size_t n, Times t );
+
+    struct entry_t {
+        simtime_t       time;
+        long long       seq;
+        absEvNotice*    ev;             // Head of the group
+    };
+
+    static const unsigned int arity = 4;
+
+    static bool before( const entry_t& a, const entry_t& b )
+    {
+        return ( a.time < b.time || ( a.time == b.time && a.seq < b.seq ) );
+    };
+
+    void place( unsigned int i, const entry_t& e );
+    void siftUp( unsigned int i, entry_t e );
+    void siftDown( unsigned int i, entry_t e );
+    void removeEntry( unsigned int i );
+    void moveEntry( unsigned int i, const entry_t& e );
+    void unlinkGroup( absEvNotice* ev );
+
+    vector< entry_t >   _heap;
+    unsigned int        _size;          // Num. of notices
+    long long           _seq;           // Decreases at each insertAt( )
+    unsigned int        _maxSize;
+};
+
+#endif
@@ -0,0 +1,476 @@
+/*****************************************************************************
+ *
+ * sqsLadder.cc
+ *
+ * Sequencing Set implementation based on a ladder queue.
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <algorithm>
+#include "handle.hh"
+#include "sqsLadder.hh"
+#include "process.hh"
+
+sqs* sqsLadderBuilder( void )
+{
+    return new sqsLadder( );
+}
+
+static const sqsLadder::bucket_t emptyBucket = { 0, 0, 0 };
+
+sqsLadder::sqsLadder( ) :
+    sqs         ( ),
+    _top        ( emptyBucket ),
+    _topMin     ( HUGE_VAL ),
+    _topMax     ( -HUGE_VAL ),
+    _topStart   ( -HUGE_VAL ),
+    _nRungs     ( 0 ),
+    _bottom     ( emptyBucket ),
+    _size       ( 0 ),
+    _seq        ( 0 ),
+    _spawned    ( 0 ),
+    _maxRungsUsed( 0 )
+{
+
+}
+
+sqsLadder::~sqsLadder( )
+{
+
+}
+
+bool sqsLadder::before( const absEvNotice* a, const absEvNotice* b )
+{
+    return ( a->_time < b->_time || ( a->_time == b->_time && a->_seq < b->_seq ) );
+}
+
+void sqsLadder::append( bucket_t& b, absEvNotice* ev )
+{
+    ev->_prev = b.tail;
+    ev->_next = 0;
+    if ( 0 != b.tail )
+        b.tail->_next = ev;
+    else
+        b.head = ev;
+    b.tail = ev;
+    b.n++;
+    ev->_bin = &b;
+}
+
+void sqsLadder::unlink( absEvNotice* ev )
+{
+    bucket_t& b( *bucket( ev ) );
+    if ( 0 != ev->_prev )
+        ev->_prev->_next = ev->_next;
+    else
+        b.head = ev->_next;
+    if ( 0 != ev->_next )
+        ev->_next->_prev = ev->_prev;
+    else
+        b.tail = ev->_prev;
+    assert( b.n > 0 );
+    b.n--;
+    if ( ev->_level >= 0 )
+        _rungs[ ev->_level ].n--;
+    ev->_prev = ev->_next = 0;
+    ev->_bin = 0;
+}
+
+//
+// ev takes the place of old, which must be the head of a group
+//
+void sqsLadder::replace( absEvNotice* old, absEvNotice* ev )
+{
+    ev->_level = old->_level;
+    ev->_bin = old->_bin;
+    ev->_prev = old->_prev;
+    ev->_next = old->_next;
+    if ( 0 != ev->_prev )
+        ev->_prev->_next = ev;
+    else
+        bucket( ev )->head = ev;
+    if ( 0 != ev->_next )
+        ev->_next->_prev = ev;
+    else
+        bucket( ev )->tail = ev;
+    old->_prev = old->_next = 0;
+    old->_bin = 0;
+}
+
+//
+// Bucket of rung r for time t, or -1 if t comes before the buckets
+// which are not yet in bottom. Notices beyond the last bucket go into
+// it, which only happens within the range of the bucket of the upper
+// rung (or of top) that the rung was made of.
+//
+long sqsLadder::bucketOf( const rung_t& r, double t ) const
+{
+    const unsigned int nb = r.buckets.size( );
+    if ( r.cur >= nb )
+        return -1;
+    double x = floor( ( t - r.start ) / r.width );
+    if ( x < r.cur )
+        return -1;
+    if ( x >= nb - 1 )
+        return nb - 1;
+    return (long)x;
+}
+
+//
+// Puts the head of a group in the right tier
+//
+void sqsLadder::enqueue( absEvNotice* ev )
+{
+    const simtime_t t = ev->_time;
+    if ( t > _topStart ) {
+        append( _top, ev );
+        ev->_level = levelTop;
+        if ( t < _topMin )
+            _topMin = t;
+        if ( t > _topMax )
+            _topMax = t;
+        return;
+    }
+    for ( int i=0; i<_nRungs; i++ ) {
+        long b = bucketOf( _rungs[ i ], t );
+        if ( b >= 0 ) {
+            append( _rungs[ i ].buckets[ b ], ev );
+            ev->_level = i;
+            _rungs[ i ].n++;
+            return;
+        }
+    }
+
+    // A large bottom is turned into a new rung, if possible
+    if ( _bottom.n >= threshold && spawn( _bottom ) ) {
+        enqueue( ev );
+        return;
+    }
+    absEvNotice* pos = _bottom.head;
+    while ( 0 != pos && !before( ev, pos ) )
+        pos = pos->_next;
+    ev->_level = levelBottom;
+    ev->_bin = &_bottom;
+    ev->_next = pos;
+    ev->_prev = ( 0 != pos ? pos->_prev : _bottom.tail );
+    if ( 0 != ev->_prev )
+        ev->_prev->_next = ev;
+    else
+        _bottom.head = ev;
+    if ( 0 != pos )
+        pos->_prev = ev;
+    else
+        _bottom.tail = ev;
+    _bottom.n++;
+}
+
+//
+// Sorts the notices of bucket b into bottom, which must be empty
+//
+void sqsLadder::toBottom( bucket_t& b )
+{
+    assert( 0 == _bottom.n );
+    vector< absEvNotice* >& v( _sorted );
+    v.clear( );
+    for ( absEvNotice* ev = b.head; 0 != ev; ev = ev->_next )
+        v.push_back( ev );
+    b = emptyBucket;
+    sort( v.begin( ), v.end( ), before );
+    vector< absEvNotice* >::iterator it;
+    for ( it = v.begin( ); it != v.end( ); it++ ) {
+        append( _bottom, *it );
+        (*it)->_level = levelBottom;
+    }
+}
+
+//
+// Creates a new rung with the notices of bucket b, which must be
+// either top, bottom or the bucket of the last rung which is being
+// moved down. There are as many buckets as notices, spread over the
+// range of their times. Returns false if the notices cannot be
+// spread, because they all have the same time or there are already
+// too many rungs.
+//
+bool sqsLadder::spawn( bucket_t& b )
+{
+    double lo = _topMin, hi = _topMax;
+    if ( &b != &_top ) {
+        lo = HUGE_VAL;
+        hi = -HUGE_VAL;
+        for ( absEvNotice* ev = b.head; 0 != ev; ev = ev->_next ) {
+            lo = std::min( lo, (double)ev->_time );
+            hi = std::max( hi, (double)ev->_time );
+        }
+    }
+    if ( _nRungs >= maxRungs || !( hi > lo ) || !( ( hi - lo ) / b.n > 0.0 ) )
+        return false;
+
+    const int level = _nRungs++;
+    rung_t& r( _rungs[ level ] );
+    r.start = lo;
+    r.width = ( hi - lo ) / b.n;
+    r.cur = 0;
+    r.n = 0;
+    // The buckets of a rung are kept, and grow geometrically, so that
+    // a rung made again does not allocate memory
+    if ( b.n > r.buckets.capacity( ) )
+        r.buckets.reserve( 2 * b.n );
+    r.buckets.assign( b.n, emptyBucket );
+
+    absEvNotice* ev = b.head;
+    b = emptyBucket;
+    while ( 0 != ev ) {
+        absEvNotice* next = ev->_next;
+        append( r.buckets[ bucketOf( r, ev->_time ) ], ev );
+        ev->_level = level;
+        r.n++;
+        ev = next;
+    }
+
+    _spawned++;
+    if ( _nRungs > _maxRungsUsed )
+        _maxRungsUsed = _nRungs;
+    return true;
+}
+
+//
+// Refills bottom, when it is empty, from the first non-empty bucket
+// of the last rung; when the ladder is empty, top is moved to it.
+//
+void sqsLadder::refill( void )
+{
+    while ( 0 == _bottom.n && _size > 0 ) {
+        if ( 0 == _nRungs ) {
+            assert( _top.n > 0 );
+            _topStart = _topMax;
+            if ( _top.n <= threshold || !spawn( _top ) )
+                toBottom( _top );
+            _topMin = HUGE_VAL;
+            _topMax = -HUGE_VAL;
+            continue;
+        }
+        rung_t& r( _rungs[ _nRungs-1 ] );
+        if ( 0 == r.n ) {
+            _nRungs--;
+            continue;
+        }
+        while ( 0 == r.buckets[ r.cur ].n )
+            r.cur++;
+        bucket_t& b( r.buckets[ r.cur ] );
+        r.cur++;
+        r.n -= b.n;
+        if ( b.n <= threshold || !spawn( b ) )
+            toBottom( b );
+    }
+}
+
+//
+// Creates a new event notice for process p at time t. Process p is inserted
+// _before_ any other process already scheduled for time t.
+//
+// Preconditions:
+// - t must be greater or equal to the current simulation time;
+// - p must _not_ already have an associated event notice;
+//
+absEvNotice* sqsLadder::insertAt( const handle_p& p, simtime_t t )
+{
+    assert( !p->terminated( ) );
+    assert( 0 == p->notice( ) );
+
+    absEvNotice* ev = bind( p, t );
+    ev->_seq = --_seq;
+    enqueue( ev );
+    _size++;
+    if ( 0 == _bottom.n )
+        refill( );
+
+    _insertions++;
+    return ev;
+}
+
+//
+// Schedules p immediately after or before q, in the group of q
+//
+// Preconditions:
+// - p and q must not be terminated processes;
+// - p must _not_ already have an associated event notice;
+// - q _must_ have an associated event notice.
+//
+absEvNotice* sqsLadder::insert( const handle_p& p,
+                                const handle_p& q,
+                                enum position_t where )
+{
+    absEvNotice* ev_q = q->notice( );
+
+    assert( !p->terminated( ) );
+    assert( !q->terminated( ) );
+    assert( 0 == p->notice( ) );
+    assert( 0 != ev_q );
+
+    absEvNotice* ev_p = bind( p, ev_q->evTime( ) );
+    ev_p->_seq = ev_q->_seq;
+    if ( where == pos_after ) {
+        ev_p->_gprev = ev_q;
+        ev_p->_gnext = ev_q->_gnext;
+        if ( 0 != ev_q->_gnext )
+            ev_q->_gnext->_gprev = ev_p;
+        ev_q->_gnext = ev_p;
+    } else {
+        ev_p->_gnext = ev_q;
+        ev_p->_gprev = ev_q->_gprev;
+        if ( 0 != ev_q->_gprev )
+            ev_q->_gprev->_gnext = ev_p;
+        else
+            replace( ev_q, ev_p );      // p becomes the head of the group
+        ev_q->_gprev = ev_p;
+    }
+
+    _insertions++;
+    _size++;
+    return ev_p;
+}
+
+//
+// Takes ev out of the tiers. If ev is the head of its group, the next
+// notice of the group takes its place.
+//
+void sqsLadder::leave( absEvNotice* ev )
+{
+    if ( 0 != ev->_gprev ) {
+        ev->_gprev->_gnext = ev->_gnext;
+        if ( 0 != ev->_gnext )
+            ev->_gnext->_gprev = ev->_gprev;
+    } else if ( 0 != ev->_gnext ) {
+        ev->_gnext->_gprev = 0;
+        replace( ev, ev->_gnext );
+    } else
+        unlink( ev );
+    ev->_gprev = ev->_gnext = 0;
+}
+
+//
+// Removes the event notice ev from the sequencing set.
+//
+void sqsLadder::remove( absEvNotice* ev )
+{
+    assert( 0 != ev->proc( ) );
+    leave( ev );
+
+    _deletions++;
+    assert( _size > 0 );
+    _size--;
+    unbind( ev );
+    if ( 0 == _bottom.n )
+        refill( );
+}
+
+//
+// The notice is put again in the tier of its new time; there is no
+// cheaper way, as the tiers are not sorted
+//
+void sqsLadder::reschedule( absEvNotice* ev, simtime_t t )
+{
+    assert( 0 != ev->proc( ) );
+    leave( ev );
+    ev->_time = t;
+    ev->_seq = --_seq;
+    enqueue( ev );
+    if ( 0 == _bottom.n )
+        refill( );
+
+    _insertions++;
+    _deletions++;
+}
+
+//
+// Releases the notices of a bucket, and of their groups
+//
+void sqsLadder::unbindBucket( absEvNotice* ev )
+{
+    while ( 0 != ev ) {
+        absEvNotice* next = ev->_next;
+        for ( absEvNotice* g = ev; 0 != g; ) {
+            absEvNotice* gnext = g->_gnext;
+            unbind( g );
+            g = gnext;
+        }
+        ev = next;
+    }
+}
+
+void sqsLadder::clear( void )
+{
+    for ( int i=0; i<_nRungs; i++ )
+        for ( unsigned int b=_rungs[ i ].cur; b<_rungs[ i ].buckets.size( ); b++ )
+            unbindBucket( _rungs[ i ].buckets[ b ].head );
+    unbindBucket( _top.head );
+    unbindBucket( _bottom.head );
+    _top = emptyBucket;
+    _topMin = HUGE_VAL;
+    _topMax = _topStart = -HUGE_VAL;
+    _nRungs = 0;
+    _bottom = emptyBucket;
+    _size = 0;
+}
+
+void sqsLadder::dump_sqs( void ) const
+{
+    vector< absEvNotice* > v;
+    for ( absEvNotice* ev = _bottom.head; 0 != ev; ev = ev->_next )
+        v.push_back( ev );
+    for ( int i=0; i<_nRungs; i++ )
+        for ( unsigned int b=_rungs[ i ].cur; b<_rungs[ i ].buckets.size( ); b++ )
+            for ( absEvNotice* ev = _rungs[ i ].buckets[ b ].head; 0 != ev; ev = ev->_next )
+                v.push_back( ev );
+    for ( absEvNotice* ev = _top.head; 0 != ev; ev = ev->_next )
+        v.push_back( ev );
+    sort( v.begin( ), v.end( ), before );
+
+    cout << "[SQS Head ";
+    vector< absEvNotice* >::const_iterator it;
+    for ( it = v.begin( ); it != v.end( ); it++ )
+        for ( absEvNotice* ev = *it; 0 != ev; ev = ev->_gnext )
+            cout << "(proc=" << ev->_proc->id( )
+                 << "/" << ev->_proc->name( )
+                 << " time=" << ev->_time << ") ";
+    cout << " SQS Tail]" << endl;
+}
+
+// About one bucket of a rung
+size_t sqsLadder::noticeBytes( void ) const
+{
+    return sizeof( bucket_t );
+}
+
+void sqsLadder::report( void ) const
+{
+    cout << endl
+	 << "Ladder queue SQS statistics:" << endl
+	 << "  Num. of insertions..........." << _insertions << endl
+	 << "  Num. of deletions............" << _deletions << endl
+	 << "  Num. of rungs created........" << _spawned << endl
+	 << "  Max num. of rungs............" << _maxRungsUsed << endl
+	 << endl;
+}
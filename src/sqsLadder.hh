@@ -0,0 +1,122 @@
+/*****************************************************************************
+ *
+ * sqsLadder.hh
+ *
+ * Implementation of a Sequencing Set using a ladder queue
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#ifndef SQSLADDER_HH
+#define SQSLADDER_HH
+
+#include <cstdlib>
+#include <vector>
+#include "process.hh"
+#include "sqs.hh"
+
+//
+// Ladder queue (W. T. Tang, R. S. M. Goh, I. L.-J. Thng, "Ladder
+// Queue: An O(1) Priority Queue Structure for Large-Scale Discrete
+// Event Simulation", ACM TOMACS 15(3), 2005).
+//
+// The notices are kept in three tiers: "top", an unsorted list of the
+// notices far in the future; the "ladder", a few rungs of buckets,
+// each rung covering one bucket of the rung above it; and "bottom", a
+// sorted list of the notices nearest in time. Only bottom is sorted,
+// one small bucket at a time; a bucket with too many notices is split
+// into a new rung instead. The first notice is always the head of
+// bottom, which is refilled as soon as it becomes empty.
+//
+// Notices are ordered by time and sequence number, and the notices
+// inserted before or after another notice join its group, as in
+// sqsHeap; only the head of each group is stored in the tiers. The
+// notices of a bucket are linked through their _prev and _next
+// fields, and those of a group through _gprev and _gnext.
+//
+class sqsLadder : public sqs {
+public:
+
+    sqsLadder( );
+    virtual ~sqsLadder( );
+
+    // Modifiers
+    absEvNotice* insertAt( const handle_p& p, simtime_t t ) final;
+    absEvNotice* insert( const handle_p& p, const handle_p& q, enum position_t where ) final;
+    void remove( absEvNotice* ev ) final;
+    void reschedule( absEvNotice* ev, simtime_t t ) final;
+    void clear( void );
+
+    // Accessors
+    absEvNotice* first( void )  const final { return _bottom.head; };
+    void dump_sqs( void )       const;
+    void report( void )         const;
+    bool empty( void )          const final { return ( 0 == _size ); };
+    unsigned int size( void )   const final { return _size; };
+    size_t noticeBytes( void )  const;
+
+    struct bucket_t {
+        absEvNotice* head;
+        absEvNotice* tail;
+        unsigned int    n;
+    };
+
+protected:
+
+    struct rung_t {
+        vector< bucket_t > buckets;
+        double          start;          // Time of the first bucket
+        double          width;          // Of each bucket
+        unsigned int    cur;            // First bucket not yet in bottom
+        unsigned int    n;              // Num. of notices in the rung
+    };
+
+    static const int maxRungs = 8;
+    static const unsigned int threshold = 50;   // Max. bucket size to sort
+    enum { levelTop = -1, levelBottom = -2 };
+
+    void enqueue( absEvNotice* ev );
+    void refill( void );
+    void toBottom( bucket_t& b );
+    bool spawn( bucket_t& b );
+    long bucketOf( const rung_t& r, double t ) const;
+    void unlink( absEvNotice* ev );
+    void leave( absEvNotice* ev );
+    static void unbindBucket( absEvNotice* ev );
+    static bucket_t* bucket( const absEvNotice* ev )
+    {
+        return static_cast< bucket_t* >( ev->_bin );
+    };
+    void replace( absEvNotice* old, absEvNotice* ev );
+    static void append( bucket_t& b, absEvNotice* ev );
+    static bool before( const absEvNotice* a, const absEvNotice* b );
+
+    bucket_t            _top;
+    double              _topMin;
+    double              _topMax;
+    double              _topStart;      // Notices later than this go to top
+    rung_t              _rungs[ maxRungs ];
+    int                 _nRungs;
+    bucket_t            _bottom;
+    unsigned int        _size;          // Num. of notices
+    long long           _seq;           // Decreases at each insertAt( )
+    vector< absEvNotice* > _sorted;     // Used by toBottom( )
+    unsigned long       _spawned;       // Num. of rungs created
+    int                 _maxRungsUsed;
+};
+
+#endif
@@ -44,6 +44,63 @@ sqsPrio::~sqsPrio( )
 
 }
 
+//
+// Returns the bin of time t, creating it if needed
+//
+sqsPrio::bin_t* sqsPrio::binAt( simtime_t t )
+{
+    sqs_t::iterator sqs_it = _sqs.lower_bound( t );
+    if ( _sqs.end( ) != sqs_it && sqs_it->first == t )
+        return &sqs_it->second;
+
+    const bin_t emptyBin = { 0, 0 };
+    if ( _spare.empty( ) )
+        return &_sqs.emplace_hint( sqs_it, t, emptyBin )->second;
+
+    sqs_t::node_type node( std::move( _spare.back( ) ) );
+    _spare.pop_back( );
+    node.key( ) = t;
+    node.mapped( ) = emptyBin;
+    return &_sqs.insert( sqs_it, std::move( node ) )->second;
+}
+
+//
+// Links ev before pos in bin b, or at the end of b if pos is 0
+//
+void sqsPrio::link( absEvNotice* ev, absEvNotice* pos, bin_t* b )
+{
+    ev->_bin = b;
+    ev->_next = pos;
+    ev->_prev = ( 0 != pos ? pos->_prev : b->tail );
+    if ( 0 != ev->_prev )
+        ev->_prev->_next = ev;
+    else
+        b->head = ev;
+    if ( 0 != pos )
+        pos->_prev = ev;
+    else
+        b->tail = ev;
+}
+
+//
+// Unlinks ev from its bin; the node of an empty bin is kept
+//
+void sqsPrio::unlink( absEvNotice* ev )
+{
+    bin_t* b = static_cast< bin_t* >( ev->_bin );
+    if ( 0 != ev->_prev )
+        ev->_prev->_next = ev->_next;
+    else
+        b->head = ev->_next;
+    if ( 0 != ev->_next )
+        ev->_next->_prev = ev->_prev;
+    else
+        b->tail = ev->_prev;
+
+    if ( 0 == b->head )
+        _spare.push_back( _sqs.extract( ev->_time ) );
+}
+
 //
 // Creates a new event notice for process p at time t. Process p is inserted
 // _before_ any other process already scheduled for time t.
@@ -52,32 +109,14 @@ sqsPrio::~sqsPrio( )
 // - t must be greater or equal to the current simulation time;
 // - p should _not_ already have an associated event notice;
 //
-absEvNotice* sqsPrio::insertAt( const handle_p& p, double t )
+absEvNotice* sqsPrio::insertAt( const handle_p& p, simtime_t t )
 {
     assert( !p->terminated( ) );
     assert( 0 == p->notice( ) );
 
-    prioEvNotice* ev( new prioEvNotice( t, p ) );
-    sqs_t::iterator sqs_it = _sqs.find(t);
-
-    if ( _sqs.end( ) == sqs_it ) {
-	bin_t emptyBin;
-
-        // Create a temporary sqs element (must be a pair)
-        sqs_t::value_type tmp( t, emptyBin );
-
-        // Insert the element into the map
-        sqs_it = _sqs.insert( tmp ).first;
-
-    }
-
-    bin_t& theList = sqs_it->second;
-
-    // theBin.push_front( ev );
-    theList.push_front( ev );
-
-    ev->_pos_bin = theList.begin( );
-    ev->_pos_sqs = sqs_it;
+    bin_t* b = binAt( t );
+    absEvNotice* ev = bind( p, t );
+    link( ev, b->head, b );
 
     _insertions++;
     _sqs_len++;
@@ -91,25 +130,16 @@ absEvNotice* sqsPrio::insert( const handle_p& p,
                               const handle_p& q, 
                               enum position_t where )
 {
-    prioEvNotice* ev_q = dynamic_cast< prioEvNotice* >( q->notice( ) );
-    prioEvNotice* ev_p = dynamic_cast< prioEvNotice* >( p->notice( ) );
+    absEvNotice* ev_q = q->notice( );
 
     assert( !p->terminated( ) );
     assert( !q->terminated( ) );
-    assert( 0 == ev_p );
+    assert( 0 == p->notice( ) );
     assert( 0 != ev_q );
 
-    bin_t::iterator bin_it( ev_q->_pos_bin );
-
-    if ( where == pos_after ) 
-        bin_it++;
-
-    double t = ev_q->evTime( );
-    ev_p = new prioEvNotice( t, p );
-    bin_t& theList( _sqs[t] );
-
-    ev_p->_pos_bin = theList.insert( bin_it, ev_p );
-    ev_p->_pos_sqs = ev_q->_pos_sqs;
+    absEvNotice* ev_p = bind( p, ev_q->evTime( ) );
+    link( ev_p, ( where == pos_after ? ev_q->_next : ev_q ),
+          static_cast< bin_t* >( ev_q->_bin ) );
 
     _insertions++;
     _sqs_len++;
@@ -121,27 +151,74 @@ absEvNotice* sqsPrio::insert( const handle_p& p,
 //
 void sqsPrio::remove( absEvNotice* ev )
 {
-    prioEvNotice* _prioqEv( dynamic_cast< prioEvNotice* >( ev ) );
-    assert( 0 != _prioqEv );
-
-    bin_t::iterator bin_it( _prioqEv->_pos_bin );
-    sqs_t::iterator sqs_it( _prioqEv->_pos_sqs );
-
-    sqs_t::mapped_type& _list( sqs_it->second );
-    _list.erase( bin_it );
-
-    if ( _list.empty( ) )
-        _sqs.erase( sqs_it );
+    assert( 0 != ev->proc( ) );
+    unlink( ev );
 
     _deletions++;
     assert( _sqs_len > 0 );
     _sqs_len--;
+    unbind( ev );
+}
+
+void sqsPrio::reschedule( absEvNotice* ev, simtime_t t )
+{
+    assert( 0 != ev->proc( ) );
+    unlink( ev );
+    ev->_time = t;
+    bin_t* b = binAt( t );
+    link( ev, b->head, b );
+    _insertions++;
+    _deletions++;
+}
+
+//
+// The notices with the same time go to their bin at once, before its
+// old notices
+//
+template< class Times > void sqsPrio::batch( const handle_p* p, size_t n, Times t )
+{
+    size_t i = 0;
+    while ( i < n ) {
+        bin_t* b = binAt( t[ i ] );
+        absEvNotice* pos = b->head;
+        size_t j = i;
+        for ( ; j < n && t[ j ] == t[ i ]; j++ ) {
+            assert( !p[ j ]->terminated( ) );
+            assert( 0 == p[ j ]->notice( ) );
+            link( bind( p[ j ], t[ j ] ), pos, b );
+        }
+        assert( j == n || t[ j ] > t[ i ] );
+        i = j;
+    }
+    _insertions += n;
+    _sqs_len += n;
+}
+
+void sqsPrio::insertBatch( const handle_p* p, size_t n, simtime_t t )
+{
+    sameTime times = { t };
+    batch( p, n, times );
+}
+
+void sqsPrio::insertBatch( const handle_p* p, size_t n, const simtime_t* t )
+{
+    batch( p, n, t );
 }
 
 void sqsPrio::clear( void )
 {
-    _sqs.clear( );
+    sqs_t old;
+    old.swap( _sqs );
     _sqs_len = 0;
+    sqs_t::iterator _sqs_it;
+    for ( _sqs_it = old.begin( ); _sqs_it != old.end( ); _sqs_it++ ) {
+        absEvNotice* ev = _sqs_it->second.head;
+        while ( 0 != ev ) {
+            absEvNotice* next = ev->_next;
+            unbind( ev );
+            ev = next;
+        }
+    }
 }
 
 void sqsPrio::dump_sqs( void ) const
@@ -149,37 +226,14 @@ void sqsPrio::dump_sqs( void ) const
     sqs_t::const_iterator _sqs_it;
     cout << "[SQS Head ";    
     for ( _sqs_it = _sqs.begin( ); _sqs_it != _sqs.end( ); _sqs_it ++ ) {
-        bin_t::const_iterator _list_it;
-        bin_t _list( _sqs_it->second );
-        for ( _list_it = _list.begin( ); _list_it != _list.end( ); _list_it++ )
-            cout << "(proc=" << (*_list_it)->_proc->id( )
-                 << "/" << (*_list_it)->_proc->name( )
-                 << " time=" << (*_list_it)->_time << ") ";
+        for ( absEvNotice* ev = _sqs_it->second.head; 0 != ev; ev = ev->_next )
+            cout << "(proc=" << ev->_proc->id( )
+                 << "/" << ev->_proc->name( )
+                 << " time=" << ev->_time << ") ";
     }
     cout << " SQS Tail]" << endl;
 }
 
-absEvNotice* sqsPrio::first( void ) const
-{
-    if ( empty( ) ) {
-        return 0;	
-    } else {
-        // Find the bin
-        sqs_t::const_iterator _it( _sqs.begin( ) );
-        assert( _it != _sqs.end( ) );
-        
-        // Get the list of events associated to the bin
-        bin_t _list( _it->second );
-        assert( !_list.empty() );
-
-        // Get the first event notice of the list
-        bin_t::const_iterator _it2( _list.begin( ) );
-        assert( _it2 != _list.end( ) );
-        
-        return *_it2;
-    }
-}
-
 void sqsPrio::report( void ) const
 {
     cout << endl
@@ -188,4 +242,3 @@ void sqsPrio::report( void ) const
 	 << "  Num. of deletions............" << _deletions << endl
 	 << endl;
 }
-
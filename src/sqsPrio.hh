@@ -24,57 +24,63 @@
 #ifndef _SQSPRIO_HH
 #define _SQSPRIO_HH
 
-#include <list>
 #include <map>
+#include <vector>
 #include <cstdlib>
 #include "process.hh"
 #include "sqs.hh"
 
-class prioEvNotice;
-
+//
+// The event notices are kept in bins, one for each event time, which
+// are the nodes of a map. The notices of a bin are linked through
+// their _prev and _next fields. The nodes of the bins which become
+// empty are kept for the next bins, so that the map does not allocate
+// memory once the number of bins has settled.
+//
 class sqsPrio : public sqs {
 public:
 
     // Typedefs
-    typedef list< prioEvNotice* >     bin_t;
-    typedef map< double, bin_t >      sqs_t;
-    typedef prioEvNotice              evn_t;
+    struct bin_t {
+        absEvNotice* head;
+        absEvNotice* tail;
+    };
+    typedef map< simtime_t, bin_t >   sqs_t;
 
     sqsPrio( );
     virtual ~sqsPrio( );
 
     // Modifiers
-    absEvNotice* insertAt( const handle_p& p, double t );
+    absEvNotice* insertAt( const handle_p& p, simtime_t t ) final;
     absEvNotice* insert( const handle_p& p, 
                          const handle_p& q, 
-                         enum position_t where );
-    void remove( absEvNotice* ev );
+                         enum position_t where ) final;
+    void remove( absEvNotice* ev ) final;
+    void reschedule( absEvNotice* ev, simtime_t t ) final;
+    void insertBatch( const handle_p* p, size_t n, simtime_t t ) final;
+    void insertBatch( const handle_p* p, size_t n, const simtime_t* t ) final;
     void clear( void );
 
     // Accessors
-    absEvNotice* first( void ) const;
+    absEvNotice* first( void ) const final
+    {
+        return ( empty( ) ? 0 : _sqs.begin( )->second.head );
+    };
     void dump_sqs( void ) const;
     void report( void ) const;
-    bool empty( void ) const { return ( 0 == _sqs_len ); };
-    unsigned int size( void ) const { return _sqs_len; };
+    bool empty( void ) const final { return ( 0 == _sqs_len ); };
+    unsigned int size( void ) const final { return _sqs_len; };
 
 protected:
 
+    template< class Times > void batch( const handle_p* p, size_t n, Times t );
+    bin_t* binAt( simtime_t t );
+    void link( absEvNotice* ev, absEvNotice* pos, bin_t* b );
+    void unlink( absEvNotice* ev );
+
     sqs_t _sqs;
+    vector< sqs_t::node_type > _spare;  // Nodes of the empty bins
     unsigned long _sqs_len;
 };
 
-class prioEvNotice : public absEvNotice {
-    friend class sqsPrio; 
-public:
-    virtual ~prioEvNotice( ) { };
-    
-protected:
-    prioEvNotice( double t, const handle_p& p ) : 
-	absEvNotice( t, p ) { };
-
-    sqsPrio::bin_t::iterator _pos_bin; // Position in the bin
-    sqsPrio::sqs_t::iterator _pos_sqs; // Position in the sqs
-};
-
 #endif
@@ -0,0 +1,322 @@
+/*****************************************************************************
+ *
+ * sqsWheel.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include "handle.hh"
+#include "sqsWheel.hh"
+#include "process.hh"
+
+sqs* sqsWheelBuilder( void )
+{
+    return new sqsWheel( );
+}
+
+sqsWheel::sqsWheel( ) :
+    sqs         ( ),
+    _now        ( 0 ),
+    _size       ( 0 ),
+    _maxSize    ( 0 ),
+    _cascades   ( 0 ),
+    _moved      ( 0 )
+{
+    memset( _slots, 0, sizeof( _slots ) );
+    memset( _used, 0, sizeof( _used ) );
+}
+
+sqsWheel::~sqsWheel( )
+{
+
+}
+
+sqsWheel::tick_t sqsWheel::tick( simtime_t t )
+{
+    if ( t < 0 || (simtime_t)(tick_t)t != t ) {
+        cerr << "FATAL: sqsWheel: event time " << t
+             << " is not a whole number of ticks" << endl;
+        abort( );
+    }
+    return (tick_t)t;
+}
+
+//
+// Puts ev at the front or at the end of its slot, which depends on the
+// current position of the wheel
+//
+void sqsWheel::place( absEvNotice* ev, bool front ) const
+{
+    tick_t x = tick( ev->_time );
+    tick_t diff = x ^ _now;
+    unsigned int level = 0;
+    while ( diff >= numSlots ) {
+        diff >>= slotBits;
+        x >>= slotBits;
+        level++;
+    }
+    const unsigned int s = x & ( numSlots - 1 );
+    slot_t& slot = _slots[ level ][ s ];
+    ev->_level = level;
+    ev->_index = s;
+    if ( 0 == slot.head ) {
+        ev->_prev = ev->_next = 0;
+        slot.head = slot.tail = ev;
+        _used[ level ][ s / 64 ] |= 1ULL << ( s % 64 );
+    } else if ( front ) {
+        ev->_prev = 0;
+        ev->_next = slot.head;
+        slot.head->_prev = ev;
+        slot.head = ev;
+    } else {
+        ev->_next = 0;
+        ev->_prev = slot.tail;
+        slot.tail->_next = ev;
+        slot.tail = ev;
+    }
+}
+
+void sqsWheel::unlink( absEvNotice* ev ) const
+{
+    slot_t& slot = _slots[ ev->_level ][ ev->_index ];
+    if ( 0 != ev->_prev )
+        ev->_prev->_next = ev->_next;
+    else
+        slot.head = ev->_next;
+    if ( 0 != ev->_next )
+        ev->_next->_prev = ev->_prev;
+    else
+        slot.tail = ev->_prev;
+    if ( 0 == slot.head )
+        _used[ ev->_level ][ ev->_index / 64 ] &= ~( 1ULL << ( ev->_index % 64 ) );
+    ev->_prev = ev->_next = 0;
+}
+
+// First non-empty slot of a level, or -1
+int sqsWheel::lowestSlot( unsigned int level ) const
+{
+    for ( unsigned int w = 0; w < numWords; w++ )
+        if ( 0 != _used[ level ][ w ] )
+            return w * 64 + __builtin_ctzll( _used[ level ][ w ] );
+    return -1;
+}
+
+//
+// Moves the wheel forward to the first non-empty slot of the lowest
+// non-empty level above 0, and spreads that slot over the lower
+// levels, until level 0 has some notice. Only the bytes of _now up
+// to the level of the slot change, so the notices of the levels above
+// it stay where they are.
+//
+void sqsWheel::cascade( void ) const
+{
+    while ( lowestSlot( 0 ) < 0 ) {
+        unsigned int level = 1;
+        int s;
+        while ( ( s = lowestSlot( level ) ) < 0 ) {
+            level++;
+            assert( level < numLevels );
+        }
+        const unsigned int shift = level * slotBits;
+        const tick_t high = ( shift + slotBits >= 64 ? 0 :
+                              _now >> ( shift + slotBits ) << ( shift + slotBits ) );
+        _now = high | ( (tick_t)s << shift );
+
+        slot_t& slot = _slots[ level ][ s ];
+        absEvNotice* ev = slot.head;
+        slot.head = slot.tail = 0;
+        _used[ level ][ s / 64 ] &= ~( 1ULL << ( s % 64 ) );
+        while ( 0 != ev ) {
+            absEvNotice* next = ev->_next;
+            place( ev, false );
+            _moved++;
+            ev = next;
+        }
+        _cascades++;
+    }
+}
+
+void sqsWheel::check( simtime_t t ) const
+{
+    if ( tick( t ) < _now ) {
+        cerr << "FATAL: sqsWheel: event time " << t
+             << " is earlier than the wheel" << endl;
+        abort( );
+    }
+}
+
+//
+// Creates a new event notice for process p at time t. Process p is inserted
+// _before_ any other process already scheduled for time t.
+//
+// Preconditions:
+// - t must be greater or equal to the current simulation time;
+// - p must _not_ already have an associated event notice;
+//
+absEvNotice* sqsWheel::insertAt( const handle_p& p, simtime_t t )
+{
+    assert( !p->terminated( ) );
+    assert( 0 == p->notice( ) );
+
+    // An empty wheel can go back to the start
+    if ( empty( ) )
+        _now = 0;
+    check( t );
+    absEvNotice* ev = bind( p, t );
+    place( ev, true );
+
+    _insertions++;
+    if ( ++_size > _maxSize )
+        _maxSize = _size;
+    return ev;
+}
+
+//
+// Schedules p immediately after or before q, in the slot of q
+//
+// Preconditions:
+// - p and q must not be terminated processes;
+// - p must _not_ already have an associated event notice;
+// - q _must_ have an associated event notice.
+//
+absEvNotice* sqsWheel::insert( const handle_p& p,
+                               const handle_p& q,
+                               enum position_t where )
+{
+    absEvNotice* ev_q = q->notice( );
+
+    assert( !p->terminated( ) );
+    assert( !q->terminated( ) );
+    assert( 0 == p->notice( ) );
+    assert( 0 != ev_q );
+
+    absEvNotice* ev_p = bind( p, ev_q->evTime( ) );
+    ev_p->_level = ev_q->_level;
+    ev_p->_index = ev_q->_index;
+    slot_t& slot = _slots[ ev_q->_level ][ ev_q->_index ];
+    if ( where == pos_after ) {
+        ev_p->_prev = ev_q;
+        ev_p->_next = ev_q->_next;
+        if ( 0 != ev_q->_next )
+            ev_q->_next->_prev = ev_p;
+        else
+            slot.tail = ev_p;
+        ev_q->_next = ev_p;
+    } else {
+        ev_p->_next = ev_q;
+        ev_p->_prev = ev_q->_prev;
+        if ( 0 != ev_q->_prev )
+            ev_q->_prev->_next = ev_p;
+        else
+            slot.head = ev_p;
+        ev_q->_prev = ev_p;
+    }
+
+    _insertions++;
+    if ( ++_size > _maxSize )
+        _maxSize = _size;
+    return ev_p;
+}
+
+void sqsWheel::remove( absEvNotice* ev )
+{
+    assert( 0 != ev->proc( ) );
+    unlink( ev );
+
+    _deletions++;
+    assert( _size > 0 );
+    _size--;
+    unbind( ev );
+}
+
+void sqsWheel::reschedule( absEvNotice* ev, simtime_t t )
+{
+    assert( 0 != ev->proc( ) );
+    unlink( ev );
+    if ( 1 == _size )
+        _now = 0;
+    check( t );
+    ev->_time = t;
+    place( ev, true );
+
+    _insertions++;
+    _deletions++;
+}
+
+void sqsWheel::clear( void )
+{
+    for ( unsigned int l = 0; l < numLevels; l++ )
+        for ( unsigned int s = 0; s < numSlots; s++ ) {
+            absEvNotice* ev = _slots[ l ][ s ].head;
+            _slots[ l ][ s ].head = _slots[ l ][ s ].tail = 0;
+            while ( 0 != ev ) {
+                absEvNotice* next = ev->_next;
+                unbind( ev );
+                ev = next;
+            }
+        }
+    memset( _used, 0, sizeof( _used ) );
+    _now = 0;
+    _size = 0;
+}
+
+//
+// The first notice of the first non-empty slot of level 0. The wheel
+// is moved to its time, as no notice can be inserted before it.
+//
+absEvNotice* sqsWheel::first( void ) const
+{
+    if ( empty( ) )
+        return 0;
+    cascade( );
+    const int s = lowestSlot( 0 );
+    _now = ( _now & ~(tick_t)( numSlots - 1 ) ) | s;
+    return _slots[ 0 ][ s ].head;
+}
+
+void sqsWheel::dump_sqs( void ) const
+{
+    cout << "[SQS Head ";
+    for ( unsigned int l = 0; l < numLevels; l++ )
+        for ( unsigned int s = 0; s < numSlots; s++ )
+            for ( absEvNotice* ev = _slots[ l ][ s ].head; 0 != ev; ev = ev->_next )
+                cout << "(proc=" << ev->_proc->id( )
+                     << "/" << ev->_proc->name( )
+                     << " time=" << ev->_time << ") ";
+    cout << " SQS Tail]" << endl;
+}
+
+void sqsWheel::report( void ) const
+{
+    cout << endl
+	 << "Timing wheel SQS statistics:" << endl
+	 << "  Num. of insertions..........." << _insertions << endl
+	 << "  Num. of deletions............" << _deletions << endl
+	 << "  Max SQS size................." << _maxSize << endl
+	 << "  Num. of cascaded slots......." << _cascades << endl
+	 << "  Num. of cascaded notices....." << _moved << endl
+	 << endl;
+}
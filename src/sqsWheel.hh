@@ -0,0 +1,103 @@
+/*****************************************************************************
+ *
+ * sqsWheel.hh
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#ifndef SQSWHEEL_HH
+#define SQSWHEEL_HH
+
+#include <cstdlib>
+#include "process.hh"
+#include "sqs.hh"
+
+//
+// Hierarchical timing wheel, for event times which are whole numbers
+// of ticks (see simtime.hh). Level l of the wheel has 256 slots, one
+// for each value of the l-th byte of the time; a notice is kept at
+// the level of the highest byte in which its time differs from the
+// current position of the wheel, so level 0 holds the notices of the
+// next 256 ticks, one tick per slot. When level 0 is empty, the first
+// non-empty slot of the lowest non-empty level is moved down
+// ("cascaded"). Insertion and removal take constant time; each notice
+// is cascaded at most once per level.
+//
+// The notices of a slot are in a list, linked through their _prev and
+// _next fields; _level and _index are the level and the slot of the
+// notice. insertAt( ) puts the new notice
+// at the front of its slot, and insert( ) next to q; a cascaded slot
+// is appended to the lower slots in order, as its notices were
+// scheduled before those already there for the same time.
+//
+// Event times must not be negative; with a floating point simtime_t,
+// they must have no fractional part.
+//
+class sqsWheel : public sqs {
+public:
+
+    sqsWheel( );
+    virtual ~sqsWheel( );
+
+    // Modifiers
+    absEvNotice* insertAt( const handle_p& p, simtime_t t ) final;
+    absEvNotice* insert( const handle_p& p, const handle_p& q, enum position_t where ) final;
+    void remove( absEvNotice* ev ) final;
+    void reschedule( absEvNotice* ev, simtime_t t ) final;
+    void clear( void );
+
+    // Accessors
+    absEvNotice* first( void )  const final;
+    void dump_sqs( void )       const;
+    void report( void )         const;
+    bool empty( void )          const final { return ( 0 == _size ); };
+    unsigned int size( void )   const final { return _size; };
+
+protected:
+
+    typedef unsigned long long tick_t;
+
+    static const unsigned int slotBits = 8;
+    static const unsigned int numSlots = 1 << slotBits;
+    static const unsigned int numLevels = 64 / slotBits;
+    static const unsigned int numWords = numSlots / 64;
+
+    struct slot_t {
+        absEvNotice*  head;
+        absEvNotice*  tail;
+    };
+
+    static tick_t tick( simtime_t t );
+    void check( simtime_t t ) const;
+    void place( absEvNotice* ev, bool front ) const;
+    void unlink( absEvNotice* ev ) const;
+    int lowestSlot( unsigned int level ) const;
+    void cascade( void ) const;
+
+    // The wheel is advanced lazily by first( )
+    mutable tick_t      _now;           // No notice is earlier than this
+    mutable slot_t      _slots[ numLevels ][ numSlots ];
+    mutable unsigned long long _used[ numLevels ][ numWords ]; // Non-empty slots
+    unsigned int        _size;          // Num. of notices
+    unsigned int        _maxSize;
+    mutable unsigned long _cascades;
+    mutable unsigned long _moved;       // Notices cascaded
+};
+
+#endif
@@ -0,0 +1,180 @@
+/*****************************************************************************
+ *
+ * stackPool.cc
+ *
+ * Pool of coroutine stacks
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <iostream>
+#include <cassert>
+#include "stackPool.hh"
+extern "C" {
+#include <unistd.h>
+#include <sys/mman.h>
+}
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+#ifndef MAP_STACK
+#define MAP_STACK 0
+#endif
+
+stackPool* stackPool::_instance = 0;
+
+stackPool::stackPool( ) :
+    _pageSize   ( (size_t)sysconf( _SC_PAGESIZE ) ),
+    _hits       ( 0 ),
+    _misses     ( 0 ),
+    _inUse      ( 0 ),
+    _inUseBytes ( 0 ),
+    _mapped     ( 0 ),
+    _bufferBytes( 0 )
+{
+
+}
+
+stackPool::~stackPool( )
+{
+    trim( );
+}
+
+stackPool* stackPool::instance( void )
+{
+    if ( 0 == _instance )
+        _instance = new stackPool( );
+    return _instance;
+}
+
+//
+// Returns a stack with at least "size" usable bytes. A stack of the
+// same size is taken from the free list if possible; otherwise, a new
+// one is mapped, one page larger than needed. The extra page is placed
+// at the low end and made inaccessible, as stacks grow downward on all
+// the architectures we support.
+//
+char* stackPool::acquire( size_t size )
+{
+    size = roundUp( size );
+    _inUse++;
+    _inUseBytes += size + _pageSize;
+
+    freeList_t& fl( _pool[ size ] );
+    if ( !fl.empty( ) ) {
+        char* result = fl.back( );
+        fl.pop_back( );
+        _hits++;
+        return result;
+    }
+
+    _misses++;
+    char* base = (char*)mmap( 0, size + _pageSize,
+                              PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK,
+                              -1, 0 );
+    if ( MAP_FAILED == base ) {
+        cerr << "FATAL: Cannot allocate a coroutine stack" << endl;
+        abort( );
+    }
+    if ( -1 == mprotect( base, _pageSize, PROT_NONE ) ) {
+        cerr << "FATAL: Cannot create the stack guard page" << endl;
+        abort( );
+    }
+    _mapped += size + _pageSize;
+    return base + _pageSize;
+}
+
+void stackPool::release( char* stack, size_t size )
+{
+    assert( 0 != stack );
+    assert( _inUse > 0 );
+    _inUse--;
+    size = roundUp( size );
+    _inUseBytes -= size + _pageSize;
+    _pool[ size ].push_back( stack );
+}
+
+char* stackPool::acquireBuffer( size_t& size )
+{
+    size = ( size + bufferGranularity - 1 ) / bufferGranularity * bufferGranularity;
+
+    freeList_t& fl( _buffers[ size ] );
+    if ( !fl.empty( ) ) {
+        char* result = fl.back( );
+        fl.pop_back( );
+        return result;
+    }
+    _bufferBytes += size;
+    return new char[ size ];
+}
+
+void stackPool::releaseBuffer( char* buf, size_t size )
+{
+    assert( 0 != buf );
+    size = ( size + bufferGranularity - 1 ) / bufferGranularity * bufferGranularity;
+    _buffers[ size ].push_back( buf );
+}
+
+//
+// Gives the memory of a stack back to the system, keeping its address
+// range. The content of the stack is lost.
+//
+void stackPool::discard( char* stack, size_t size )
+{
+    madvise( stack, roundUp( size ), MADV_DONTNEED );
+}
+
+void stackPool::trim( void )
+{
+    pool_t::iterator it;
+    for ( it = _pool.begin( ); it != _pool.end( ); it++ ) {
+        freeList_t::iterator st;
+        for ( st = it->second.begin( ); st != it->second.end( ); st++ ) {
+            munmap( *st - _pageSize, it->first + _pageSize );
+            _mapped -= it->first + _pageSize;
+        }
+        it->second.clear( );
+    }
+    for ( it = _buffers.begin( ); it != _buffers.end( ); it++ ) {
+        freeList_t::iterator b;
+        for ( b = it->second.begin( ); b != it->second.end( ); b++ ) {
+            delete[] *b;
+            _bufferBytes -= it->first;
+        }
+        it->second.clear( );
+    }
+}
+
+void stackPool::report( void ) const
+{
+    cout << endl
+         << "Coroutine stack pool statistics:" << endl
+         << "  Num. of pool hits............" << _hits << endl
+         << "  Num. of pool misses.........." << _misses << endl
+         << "  Num. of stacks in use........" << _inUse << endl
+         << "  Stack bytes in use..........." << _inUseBytes << endl
+         << "  Mapped stack bytes..........." << _mapped << endl
+         << "  Saved stack buffer bytes....." << _bufferBytes << endl
+         << endl;
+}
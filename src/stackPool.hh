@@ -0,0 +1,109 @@
+/*****************************************************************************
+ *
+ * stackPool.hh
+ *
+ * Pool of coroutine stacks
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#ifndef CPPSIM_STACKPOOL_HH
+#define CPPSIM_STACKPOOL_HH
+
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+using namespace std;
+
+//
+// Pool of coroutine stacks. Stacks are obtained with mmap(), and the
+// lowest page of each one is a guard page, so that a stack overflow
+// results in a segmentation fault instead of silently overwriting
+// some other memory area. Stacks which are given back are kept in a
+// free list (one for each stack size), and are handed out again on
+// the next request for the same size.
+//
+// The pool also keeps the buffers in which the coroutines running on
+// the shared stack save their part of it. These are ordinary heap
+// blocks, whose size is rounded up to a multiple of bufferGranularity.
+//
+class stackPool {
+public:
+    virtual ~stackPool( );
+
+    // Returns a stack with at least "size" usable bytes. The returned
+    // pointer is the lowest usable address of the stack.
+    char* acquire( size_t size );
+
+    // Gives back a stack obtained with acquire( size )
+    void release( char* stack, size_t size );
+
+    // Returns a buffer of at least "size" bytes; size is updated with
+    // the actual size of the buffer.
+    char* acquireBuffer( size_t& size );
+
+    // Gives back a buffer obtained with acquireBuffer( size )
+    void releaseBuffer( char* buf, size_t size );
+
+    // Releases the memory of a stack obtained with acquire( size ),
+    // which keeps its address but loses its content
+    void discard( char* stack, size_t size );
+
+    // Unmaps all the stacks, and frees all the buffers, currently in
+    // the free lists
+    void trim( void );
+
+    // Accessors
+    unsigned long hits( void ) const    { return _hits;     };
+    unsigned long misses( void ) const  { return _misses;   };
+    unsigned long inUse( void ) const   { return _inUse;    };
+    size_t mappedBytes( void ) const    { return _mapped;   };
+    size_t inUseBytes( void ) const     { return _inUseBytes; };
+    size_t pageSize( void ) const       { return _pageSize; };
+    size_t bufferBytes( void ) const    { return _bufferBytes; };
+    void report( void ) const;
+
+    static stackPool* instance( void );
+
+protected:
+    stackPool( );
+
+    // Rounds size up to a multiple of the page size
+    size_t roundUp( size_t size ) const
+    {
+        return ( size + _pageSize - 1 ) / _pageSize * _pageSize;
+    };
+
+    typedef vector< char* >             freeList_t;
+    typedef map< size_t, freeList_t >   pool_t;
+
+    static const size_t bufferGranularity = 256;
+
+    pool_t              _pool;          // Free stacks, by usable size
+    pool_t              _buffers;       // Free buffers, by size
+    const size_t        _pageSize;
+    unsigned long       _hits;          // Requests served from the pool
+    unsigned long       _misses;        // Requests which required a mmap()
+    unsigned long       _inUse;         // Number of stacks handed out
+    size_t              _inUseBytes;    // Their size, guard pages included
+    size_t              _mapped;        // Bytes mapped, guard pages included
+    size_t              _bufferBytes;   // Bytes allocated for buffers
+    static stackPool*   _instance;
+};
+
+#endif
@@ -0,0 +1,177 @@
+/****************************************************************************
+ *
+ * adaptiveTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * adaptiveTest. A model goes through several regimes: a few workers,
+ * then many holders with regular hold times, then heavy-tailed ones,
+ * then a very large number of them, and finally the few workers
+ * again. On an adaptive sqs, the backend must follow the regimes,
+ * and the sequence of events must be the same as with the heap.
+ */
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "cppsim.hh"
+#include "testutil.hh"
+
+const int numWorkers = 8;
+const int numRegular = 2000;
+const int numHeavy = 2000;
+const int numLarge = 20000;
+
+#ifdef CPPSIM_INTEGER_TIME
+const sched_t largeType = SQSWHEEL;
+#else
+const sched_t largeType = SQSLADDER;
+#endif
+
+vector<handle_p> workers;
+vector<int> trace;              // Order of execution
+vector<sched_t> backends;       // Backends, in order of use
+int created;                    // Processes created in this run
+
+double heavy( void )
+{
+    double u = ( rnd( 1 << 30 ) + 0.5 ) / ( 1 << 30 );
+    return floor( 1000.0 * pow( u, 8 ) );
+}
+
+class worker : public process {
+public:
+    worker( void ) : process( "worker" ), _n( created++ ) { };
+protected:
+    void inner_body( void ) {
+        while ( 1 ) {
+            trace.push_back( _n );
+            hold( rnd( 10 ) );
+        }
+    };
+    int _n;
+};
+
+class holder : public process {
+public:
+    holder( simtime_t until, bool heavy ) :
+        process( "holder" ), _n( created++ ), _until( until ), _heavy( heavy ) { };
+protected:
+    void inner_body( void ) {
+        while ( time( ) < _until ) {
+            trace.push_back( _n );
+            hold( _heavy ? heavy( ) : 1 + rnd( 20 ) );
+        }
+    };
+    int _n;
+    simtime_t _until;
+    bool _heavy;
+};
+
+class monitor : public process {
+public:
+    monitor( void ) : process( "monitor" ) { };
+protected:
+    void inner_body( void ) {
+        sqsAdaptive* s = dynamic_cast< sqsAdaptive* >( getSqs( ) );
+        while ( 1 ) {
+            if ( 0 != s && ( backends.empty( ) || backends.back( ) != s->backend( ) ) )
+                backends.push_back( s->backend( ) );
+            hold( 10 );
+        }
+    };
+};
+
+class driver : public process {
+public:
+    driver( void ) : process( "driver" ) { };
+protected:
+    void spawn( int n, simtime_t len, bool heavy ) {
+        for ( int i=0; i<n; i++ ) {
+            handle_p h( new holder( time( ) + len, heavy ) );
+            h->activateDelay( rnd( 20 ) );
+        }
+        hold( len + 2000 );
+    };
+    void inner_body( void ) {
+        for ( int i=0; i<numWorkers; i++ ) {
+            workers.push_back( new worker( ) );
+            workers.back( )->activateDelay( rnd( 10 ) );
+        }
+        workers.push_back( new monitor( ) );
+        workers.back( )->activate( );
+        hold( 5000 );
+        spawn( numRegular, 400, false );
+        spawn( numHeavy, 4000, true );
+        spawn( numLarge, 100, false );
+        hold( 5000 );
+        end_simulation( );
+    };
+};
+
+vector<int> run( sqs* s )
+{
+    seed = 1;
+    created = 0;
+    trace.clear( );
+    backends.clear( );
+    simulation::instance()->begin_simulation( s );
+    handle_p d( new driver( ) );
+    d->activate( );
+    simulation::instance()->run();
+    s->report( );
+    simulation::instance()->end_simulation();
+    d = 0;
+    workers.clear( );
+    return trace;
+}
+
+int main( void )
+{
+    coroutine::cSharedStack = true;
+
+    vector<int> ref( run( makeSqs( SQSHEAP ) ) );
+    vector<int> t( run( new sqsAdaptive( SQSDLL, 512 ) ) );
+    cout << ref.size( ) << " events" << endl;
+    if ( t != ref ) {
+        unsigned int n = 0;
+        while ( n < t.size( ) && n < ref.size( ) && t[ n ] == ref[ n ] )
+            n++;
+        cerr << "The adaptive sqs differs at event " << n << endl;
+        return 1;
+    }
+
+    // The backends of the regimes, in order
+    sched_t expected[] = { SQSDLL, SQSCAL, SQSHEAP, largeType, SQSDLL };
+    unsigned int k = 0;
+    for ( unsigned int i=0; i<backends.size( ); i++ ) {
+        cout << " " << backends[ i ];
+        if ( k < sizeof( expected ) / sizeof( expected[0] ) && backends[ i ] == expected[ k ] )
+            k++;
+    }
+    cout << endl;
+    if ( k != sizeof( expected ) / sizeof( expected[0] ) || SQSDLL != backends.back( ) ) {
+        cerr << "The backends do not follow the regimes" << endl;
+        return 1;
+    }
+    if ( !noneAlive( ) )
+        return 1;
+    return 0;
+}
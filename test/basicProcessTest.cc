@@ -0,0 +1,203 @@
+/****************************************************************************
+ *
+ * basicProcessTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * basicProcessTest. The workers of sqsTest are run as processes on
+ * an sqs of each type, and as basic_process<Q> on a basic_sqs<Q>:
+ * the sequence of events must be the same. Then a hold model is run
+ * both ways, and the time per event is printed.
+ */
+#include <iostream>
+#include <vector>
+#include "cppsim.hh"
+#include "testutil.hh"
+
+const int numWorkers = 50;
+const double simLen = 2000.0;
+const int numHolders = 1000;
+const double holdLen = 20000.0;
+
+vector<int> trace;              // Ids of the workers, in order of execution
+
+//
+// Base is process or basic_process<Q>
+//
+template< class Base >
+class worker : public Base {
+public:
+    worker( int n ) : Base( "worker" ), _n( n ) { };
+    static vector< handle< worker > > workers;
+protected:
+    void inner_body( void ) {
+        while ( 1 ) {
+            trace.push_back( _n );
+            bool pass = false;
+            {
+                // Released before the worker suspends, as the handles
+                // on the stacks of the workers are never destroyed
+                handle< worker > other( workers[ rnd( numWorkers ) ] );
+                handle_p q( workers[ rnd( numWorkers ) ].rep( ) );
+                if ( q->idle( ) )
+                    q = this->current( );
+                switch ( rnd( 9 ) ) {
+                case 0:
+                    if ( other->idle( ) )
+                        other->activateBefore( q );
+                    break;
+                case 1:
+                    if ( other->idle( ) )
+                        other->activateAfter( q );
+                    break;
+                case 2:
+                    if ( other->idle( ) )
+                        other->activateAt( this->time( ) + rnd( 3 ) );
+                    break;
+                case 3:
+                    if ( other.rep( ) != this && other.rep( ) != q.rep( ) )
+                        other->reactivateBefore( q );
+                    break;
+                case 4:
+                    if ( other.rep( ) != this && other.rep( ) != q.rep( ) )
+                        other->reactivateAfter( q );
+                    break;
+                case 5:
+                    if ( other.rep( ) != this )
+                        other->cancel( );
+                    break;
+                case 6:
+                    pass = ( this->getSqs( )->size( ) > 2 );
+                    break;
+                case 7:
+                    if ( other.rep( ) != this )
+                        other->reactivateDelay( rnd( 3 ) );
+                    break;
+                default:
+                    break;
+                }
+            }
+            if ( pass )
+                this->passivate( );
+            else
+                this->hold( rnd( 3 ) );
+        }
+    };
+    int _n;
+};
+
+template< class Base >
+vector< handle< worker< Base > > > worker< Base >::workers;
+
+template< class Base >
+class holder : public Base {
+public:
+    holder( void ) : Base( "holder" ) { };
+protected:
+    void inner_body( void ) {
+        while ( 1 )
+            this->hold( rnd( 100 ) );
+    };
+};
+
+template< class Base >
+class driver : public Base {
+public:
+    driver( bool bench ) : Base( "driver" ), _bench( bench ) { };
+protected:
+    void inner_body( void ) {
+        if ( _bench ) {
+            for ( int n=0; n<numHolders; n++ ) {
+                handle< holder< Base > > h( new holder< Base >( ) );
+                h->activateAt( rnd( 100 ) );
+            }
+            this->hold( holdLen );
+        } else {
+            vector< handle< worker< Base > > >& w( worker< Base >::workers );
+            for ( int n=0; n<numWorkers; n++ ) {
+                w.push_back( new worker< Base >( n ) );
+                w.back( )->activateAt( rnd( 3 ) );
+            }
+            this->hold( simLen );
+        }
+        this->end_simulation( );
+    };
+    bool _bench;
+};
+
+//
+// Runs a simulation with the processes derived from Base, returning
+// the wall-clock time per event
+//
+template< class Base >
+double run( bool bench )
+{
+    seed = 1;
+    trace.clear( );
+    unsigned long events = simulation::instance( )->getSqs( )->processed( );
+    double start = wallTime( );
+    handle< driver< Base > > d( new driver< Base >( bench ) );
+    d->activate( );
+    simulation::instance( )->run( );
+    double elapsed = wallTime( ) - start;
+    events = simulation::instance( )->getSqs( )->processed( ) - events;
+    simulation::instance( )->end_simulation( );
+    d = 0;
+    worker< Base >::workers.clear( );
+    return elapsed / events;
+}
+
+template< class Q >
+void test( const char* name )
+{
+    simulation::instance( )->begin_simulation( new Q( ) );
+    run< process >( false );
+    vector< int > expected( trace );
+
+    basic_simulation< Q >::begin_simulation( );
+    run< basic_process< Q > >( false );
+    if ( trace != expected ) {
+        cerr << name << ": the sequences of events differ" << endl;
+        errors++;
+    }
+
+    simulation::instance( )->begin_simulation( new Q( ) );
+    double virt = run< process >( true );
+    basic_simulation< Q >::begin_simulation( );
+    double direct = run< basic_process< Q > >( true );
+    cout << name << ": " << expected.size( ) << " events; hold "
+         << virt * 1e9 << " ns/event with process, "
+         << direct * 1e9 << " ns/event with basic_process" << endl;
+
+    if ( !noneAlive( ) )
+        errors++;
+}
+
+int main( void )
+{
+    test< sqsDll >( "sqsDll" );
+    test< sqsPrio >( "sqsPrio" );
+    test< sqsCal >( "sqsCal" );
+    test< sqsHeap >( "sqsHeap" );
+    test< sqsLadder >( "sqsLadder" );
+    test< sqsWheel >( "sqsWheel" );
+    return ( errors > 0 );
+}
@@ -0,0 +1,241 @@
+/****************************************************************************
+ *
+ * batchTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * batchTest. On each type of sqs, batches of notices are inserted
+ * with sqs::insertBatch( ), at a single time and at sorted times,
+ * among notices already in the sqs; the order in which the notices
+ * come out must be that of insertAt( ) from the last notice of the
+ * batch to the first. Then a barrier, whose processes are woken with
+ * process::activateAll( ), must run as with a loop of activateAt( ).
+ * Finally, the time per activation of the two is printed.
+ */
+#include <iostream>
+#include <vector>
+#include "cppsim.hh"
+#include "testutil.hh"
+
+const sched_t types[] = { SQSDLL, SQSPRIO, SQSCAL, SQSHEAP, SQSLADDER, SQSWHEEL, SQSADAPTIVE };
+const char* names[] = { "dll", "prio", "cal", "heap", "ladder", "wheel", "adaptive" };
+const int numTypes = sizeof( types ) / sizeof( types[0] );
+
+class dummy : public process {
+public:
+    dummy( void ) : process( "dummy" ) { };
+protected:
+    void inner_body( void ) { };
+};
+
+vector< handle_p > procs;
+
+//
+// Fills s with m notices, at whole times in [0, 50), some of them in
+// groups made by insert( ); then inserts the next n processes at time
+// t, or at sorted times if t < 0, with a batch or with insertAt( ).
+// Returns the ids in the order in which they come out.
+//
+vector< int > fill( sqs* s, int m, int n, int t, bool batch )
+{
+    seed = 7;
+    for ( int i=0; i<m; i++ ) {
+        if ( i > 0 && 0 == rnd( 4 ) )
+            s->insert( procs[ i ], procs[ rnd( i ) ], ( rnd( 2 ) ? pos_after : pos_before ) );
+        else
+            s->insertAt( procs[ i ], rnd( 50 ) );
+    }
+    vector< simtime_t > times;
+    simtime_t last = 0;
+    for ( int i=0; i<n; i++ ) {
+        if ( t >= 0 )
+            times.push_back( t );
+        else {
+            last += ( rnd( 3 ) ? 0 : rnd( 5 ) );
+            times.push_back( last );
+        }
+    }
+    if ( batch ) {
+        if ( t >= 0 )
+            s->insertBatch( &procs[ m ], n, (simtime_t)t );
+        else
+            s->insertBatch( &procs[ m ], n, &times[ 0 ] );
+    } else
+        for ( int i=n; i-- > 0; )
+            s->insertAt( procs[ m + i ], times[ i ] );
+
+    vector< int > order;
+    while ( !s->empty( ) ) {
+        absEvNotice* ev = s->first( );
+        order.push_back( ev->proc( )->id( ) );
+        s->remove( ev );
+    }
+    return order;
+}
+
+void testOrder( void )
+{
+    // Existing notices, batch size, batch time (-1 for sorted times)
+    const int cases[][3] = { { 0, 20, 10 }, { 100, 5, 20 }, { 100, 500, 20 },
+                             { 100, 5, -1 }, { 100, 500, -1 }, { 1000, 3000, 0 },
+                             { 0, 1000, -1 }, { 1000, 50, 70 } };
+    const int numCases = sizeof( cases ) / sizeof( cases[0] );
+    for ( int c=0; c<numCases; c++ ) {
+        sqs* ref = makeSqs( SQSDLL );
+        vector< int > expected( fill( ref, cases[c][0], cases[c][1], cases[c][2], false ) );
+        delete ref;
+        for ( int i=0; i<numTypes; i++ ) {
+            sqs* s = makeSqs( types[ i ] );
+            if ( fill( s, cases[c][0], cases[c][1], cases[c][2], true ) != expected ) {
+                cerr << names[ i ] << ": wrong order with " << cases[c][0]
+                     << " notices and a batch of " << cases[c][1] << endl;
+                errors++;
+            }
+            delete s;
+        }
+    }
+}
+
+vector< int > trace;
+vector< handle_p > waiters;
+bool useBatch;
+
+//
+// A waiter passivates at the barrier; one in four holds instead, so
+// that it is not idle when the barrier is opened
+//
+class waiter : public process {
+public:
+    waiter( int n ) : process( "waiter" ), _n( n ) { };
+protected:
+    void inner_body( void ) {
+        while ( 1 ) {
+            trace.push_back( _n );
+            if ( 0 == rnd( 4 ) )
+                hold( rnd( 3 ) );
+            else
+                passivate( );
+        }
+    };
+    int _n;
+};
+
+class opener : public process {
+public:
+    opener( void ) : process( "opener" ) { };
+protected:
+    void inner_body( void ) {
+        for ( int i=0; i<30; i++ ) {
+            waiters.push_back( new waiter( i ) );
+            waiters.back( )->activateAt( rnd( 3 ) );
+        }
+        for ( int i=0; i<100; i++ ) {
+            hold( 1 + rnd( 2 ) );
+            trace.push_back( -1 );
+            simtime_t t = time( ) + rnd( 2 );
+            bool now = ( t == time( ) && rnd( 2 ) );
+            if ( useBatch ) {
+                if ( now )
+                    activateAll( waiters.begin( ), waiters.end( ) );
+                else
+                    activateAll( waiters.begin( ), waiters.end( ), t );
+            } else
+                for ( size_t j=waiters.size( ); j-- > 0; )
+                    waiters[ j ]->activateAt( t );
+        }
+        end_simulation( );
+    };
+};
+
+vector< int > barrier( sched_t type, bool batch )
+{
+    seed = 3;
+    useBatch = batch;
+    trace.clear( );
+    simulation::instance( )->begin_simulation( makeSqs( type ) );
+    handle_p o( new opener( ) );
+    o->activate( );
+    simulation::instance( )->run( );
+    simulation::instance( )->end_simulation( );
+    o = 0;
+    waiters.clear( );
+    return trace;
+}
+
+void testBarrier( void )
+{
+    for ( int i=0; i<numTypes; i++ ) {
+        vector< int > expected( barrier( types[ i ], false ) );
+        if ( barrier( types[ i ], true ) != expected ) {
+            cerr << names[ i ] << ": activateAll( ) differs from activateAt( )" << endl;
+            errors++;
+        }
+    }
+}
+
+//
+// Time per notice of n notices inserted at the same time, among m
+// others, with insertAt( ) and with insertBatch( )
+//
+void bench( int m, int n )
+{
+    cout << "ns per notice, batch of " << n << " among " << m << " notices:" << endl;
+    for ( int i=0; i<numTypes; i++ ) {
+        if ( SQSDLL == types[ i ] )
+            continue;           // Scans the whole list at each insertAt( )
+        double elapsed[ 2 ];
+        for ( int batch=0; batch<2; batch++ ) {
+            sqs* s = makeSqs( types[ i ] );
+            seed = 5;
+            for ( int j=0; j<m; j++ )
+                s->insertAt( procs[ j ], rnd( 1000 ) );
+            double start = wallTime( );
+            if ( batch )
+                s->insertBatch( &procs[ m ], n, (simtime_t)500 );
+            else
+                for ( int j=n; j-- > 0; )
+                    s->insertAt( procs[ m + j ], 500 );
+            elapsed[ batch ] = wallTime( ) - start;
+            s->clear( );
+            delete s;
+        }
+        cout << "  " << names[ i ] << ": " << 1e9 * elapsed[ 0 ] / n
+             << " with insertAt( ), " << 1e9 * elapsed[ 1 ] / n
+             << " with insertBatch( )" << endl;
+    }
+}
+
+int main( void )
+{
+    simulation::instance( )->begin_simulation( makeSqs( SQSDLL ) );
+    for ( int i=0; i<300000; i++ )
+        procs.push_back( new dummy( ) );
+
+    testOrder( );
+    testBarrier( );
+    bench( 100000, 100000 );
+
+    procs.clear( );
+    simulation::instance( )->end_simulation( );
+    if ( !noneAlive( ) )
+        errors++;
+    return ( errors > 0 );
+}
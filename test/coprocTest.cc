@@ -0,0 +1,183 @@
+/****************************************************************************
+ *
+ * coprocTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * coprocTest. A single server queue is simulated twice: first with
+ * ordinary processes only, then with a stackless server and stackless
+ * jobs (the source is an ordinary process in both runs). The two runs
+ * use the same interarrival and service times, so the departure times
+ * of all jobs must be the same.
+ */
+#include <iostream>
+#include <vector>
+#include <list>
+#include <cmath>
+#include "cppsim.hh"
+
+#if defined( __cpp_impl_coroutine )
+
+const int numJobs = 10000;
+
+vector<double>  interTime;      // Interarrival times
+vector<double>  servTime;       // Service times
+vector<double>  departure;      // Departure time of each job
+list<handle_p>  queue;          // Jobs waiting for service
+handle_p        srv;            // The server
+
+//
+// Stackful model
+//
+class job : public process {
+public:
+    job( int n ) : process( "job" ), _n( n ) { };
+protected:
+    void inner_body( void ) {
+        queue.push_back( this );
+        if ( srv->idle( ) )
+            srv->activateAfter( current( ) );
+        passivate( );
+        departure[ _n ] = time( );
+    };
+    int _n;
+};
+
+class server : public process {
+public:
+    server( void ) : process( "server" ) { };
+protected:
+    void inner_body( void ) {
+        for ( int n=0; ; n++ ) {
+            while ( queue.empty( ) )
+                passivate( );
+            handle_p j( queue.front( ) );
+            queue.pop_front( );
+            hold( servTime[ n ] );
+            j->activateAfter( current( ) );
+        }
+    };
+};
+
+//
+// Stackless model
+//
+class cojob : public coprocess {
+public:
+    cojob( int n ) : coprocess( "cojob" ), _n( n ) { };
+protected:
+    task co_body( void ) {
+        queue.push_back( this );
+        if ( srv->idle( ) )
+            srv->activateAfter( current( ) );
+        co_await passivate( );
+        departure[ _n ] = time( );
+    };
+    int _n;
+};
+
+class coserver : public coprocess {
+public:
+    coserver( void ) : coprocess( "coserver" ) { };
+protected:
+    task co_body( void ) {
+        for ( int n=0; ; n++ ) {
+            while ( queue.empty( ) )
+                co_await passivate( );
+            handle_p j( queue.front( ) );
+            queue.pop_front( );
+            co_await hold( servTime[ n ] );
+            j->activateAfter( current( ) );
+        }
+    };
+};
+
+class source : public process {
+public:
+    source( bool stackless ) : process( "source" ), _stackless( stackless ) { };
+protected:
+    void inner_body( void ) {
+        for ( int n=0; n<numJobs; n++ ) {
+            hold( interTime[ n ] );
+            handle_p j;
+            if ( _stackless )
+                j = new cojob( n );
+            else
+                j = new job( n );
+            j->activateAfter( current( ) );
+        }
+        hold( 1.0e9 );
+        end_simulation( );
+    };
+    bool _stackless;
+};
+
+vector<double> run( bool stackless )
+{
+    departure.assign( numJobs, -1.0 );
+    simulation::instance()->begin_simulation( new sqsDll() );
+    if ( stackless )
+        srv = new coserver( );
+    else
+        srv = new server( );
+    handle_p src( new source( stackless ) );
+    src->activate( );
+    simulation::instance()->run();
+    simulation::instance()->end_simulation();
+    srv = 0;
+    queue.clear( );
+    return departure;
+}
+
+int main( void )
+{
+    // Whole times, which the integer time takes as well
+    rngExp arr( "Interarrival", 1000.0 );
+    rngExp svc( "Service", 900.0 );
+    for ( int n=0; n<numJobs; n++ ) {
+        interTime.push_back( floor( arr.value( ) ) );
+        servTime.push_back( floor( svc.value( ) ) );
+    }
+
+    vector<double> stackful( run( false ) );
+    vector<double> stackless( run( true ) );
+
+    for ( int n=0; n<numJobs; n++ ) {
+        if ( stackful[ n ] < 0.0 || stackful[ n ] != stackless[ n ] ) {
+            cerr << "Job " << n << " departed at " << stackful[ n ]
+                 << " (stackful) and " << stackless[ n ] << " (stackless)"
+                 << endl;
+            return 1;
+        }
+    }
+    cout << "Last departure at " << stackful[ numJobs-1 ] << endl;
+    return 0;
+}
+
+#else
+
+int main( void )
+{
+    // C++20 coroutines not available
+    return 77;
+}
+
+#endif
@@ -0,0 +1,148 @@
+/****************************************************************************
+ *
+ * ctxbench.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * ctxbench. Measures the number of context switches per second of
+ * the context switching method libcppsim has been configured with
+ * (see the --with-context option of configure). Two coroutines
+ * resume each other the given number of times; then the same is done
+ * with two processes which hold repeatedly, in order to measure the
+ * cost of a complete scheduler round trip, with and without direct
+ * transfer of control between processes.
+ *
+ * Usage: ctxbench [-n <num. of switches>]
+ */
+#include <iostream>
+#include <cstdlib>
+#include "cppsim.hh"
+
+extern "C" {
+#include <getopt.h>
+#include <sys/time.h>
+}
+
+using namespace std;
+
+long numSwitches = 10000000;
+
+static double now( void )
+{
+    struct timeval tv;
+    gettimeofday( &tv, 0 );
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+//
+// The pinger resumes the echo, which immediately resumes the pinger
+// back: each iteration of the loop costs two context switches.
+//
+class echo : public coroutine {
+public:
+    echo( void ) : coroutine( ), _other( 0 ) { };
+    void setOther( coroutine* other ) { _other = other; };
+protected:
+    void main( void )
+    {
+        while ( 1 )
+            _other->resume( );
+    };
+    coroutine* _other;
+};
+
+class pinger : public coroutine {
+public:
+    pinger( echo* e ) : coroutine( ), _e( e ) { };
+protected:
+    void main( void )
+    {
+        for ( long i=0; i<numSwitches/2; i++ )
+            _e->resume( );
+    };
+    echo* _e;
+};
+
+class holder : public process {
+public:
+    holder( const string& name ) : process( name ) { };
+protected:
+    void inner_body( void )
+    {
+        for ( long i=0; i<numSwitches/2; i++ )
+            hold( 1.0 );
+        end_simulation( );
+    };
+};
+
+int main( int argc, char* argv[] )
+{
+    int opt;
+    while ( -1 != ( opt = getopt( argc, argv, "n:h" ) ) ) {
+        switch ( opt ) {
+        case 'n':
+            numSwitches = atol( optarg );
+            break;
+        default:
+            cout << "Usage: " << argv[0] << " [-n <num. of switches>]" << endl;
+            exit( 0 );
+        }
+    }
+
+    cout << "Context switching method: " << coroutine::method( ) << endl;
+
+    //
+    // Plain coroutines resuming each other
+    //
+    echo* e = new echo( );
+    pinger* c = new pinger( e );
+    e->setOther( c );
+    double t0 = now( );
+    c->resume( );
+    double t1 = now( );
+    cout << "coroutine resume: " << numSwitches << " switches in "
+         << ( t1 - t0 ) << " s, "
+         << (long)( numSwitches / ( t1 - t0 ) ) << " switches/s" << endl;
+
+    //
+    // Processes: two holders alternate, each hold() switching to the
+    // scheduler and back, or directly to the other holder
+    //
+    for ( int direct=0; direct<2; direct++ ) {
+        sqs* s = new sqsDll( );
+        s->setDirectTransfer( direct );
+        simulation::instance()->begin_simulation( s );
+        handle_p h1( new holder( "holder1" ) );
+        handle_p h2( new holder( "holder2" ) );
+        h1->activate( );
+        h2->activateAfter( h1 );
+        t0 = now( );
+        simulation::instance()->run();
+        t1 = now( );
+        unsigned long events = s->processed( );
+        simulation::instance()->end_simulation();
+        cout << ( direct ? "process transfer: " : "process hold:     " )
+             << events << " events in "
+             << ( t1 - t0 ) << " s, "
+             << (long)( events / ( t1 - t0 ) ) << " events/s" << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,134 @@
+/****************************************************************************
+ *
+ * discbench.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+
+/*
+ * discbench. Measures the number of draws per second of
+ * rngDiscEmpirical, with the alias method and with the inversion
+ * method, against the number of categories, and compares them with
+ * the linear search of the cumulative probabilities that the
+ * inversion method used to do. The probabilities are random, and
+ * add up to 1.
+ *
+ * Usage: discbench [-n <num. of draws>] [-k <max. num. of categories>]
+ */
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include "cppsim.hh"
+#include "testutil.hh"
+
+extern "C" {
+#include <getopt.h>
+}
+
+using namespace std;
+
+long numDraws = 2000000;
+long maxCategories = 100000;
+
+// The linear search of the cumulative probabilities
+static int linear( const vector<double>& p, rngUniform01& u )
+{
+    const double tmp = u.value( );
+    double sum = 0.0;
+    int i;
+    for ( i=0; i<(int)p.size( )-1; i++ ) {
+        sum += p[i];
+        if ( tmp < sum ) return i;
+    }
+    return i;
+}
+
+int main( int argc, char* argv[] )
+{
+    int opt;
+    while ( -1 != ( opt = getopt( argc, argv, "n:k:h" ) ) ) {
+        switch ( opt ) {
+        case 'n':
+            numDraws = atol( optarg );
+            break;
+        case 'k':
+            maxCategories = atol( optarg );
+            break;
+        default:
+            cout << "Usage: " << argv[0] << " [-n <num. of draws>] [-k <max. num. of categories>]" << endl;
+            exit( 0 );
+        }
+    }
+
+    const int block = 1000;
+    vector<int> out( block );
+    long sum = 0;               // Keeps the draws from being optimized away
+
+    cout << "Millions of draws per second" << endl
+         << setw( 12 ) << "categories"
+         << setw( 10 ) << "linear"
+         << setw( 10 ) << "inversion"
+         << setw( 10 ) << "alias"
+         << setw( 12 ) << "alias fill" << endl;
+    for ( long k=2; k<=maxCategories; k*=10 ) {
+        seed = 1;
+        vector<double> p( k );
+        double total = 0.0;
+        for ( long i=0; i<k; i++ )
+            total += ( p[i] = uniform( ) );
+        for ( long i=0; i<k; i++ )
+            p[i] /= total;
+
+        rngUniform01 u( "u" );
+        rngDiscEmpirical inv( "inversion", p, rngDiscEmpirical::inversion );
+        rngDiscEmpirical ali( "alias", p, rngDiscEmpirical::alias );
+        double rate[4];
+
+        double t0 = wallTime( );
+        for ( long i=0; i<numDraws; i++ )
+            sum += linear( p, u );
+        rate[0] = numDraws / ( wallTime( ) - t0 );
+
+        t0 = wallTime( );
+        for ( long i=0; i<numDraws; i++ )
+            sum += inv.value( );
+        rate[1] = numDraws / ( wallTime( ) - t0 );
+
+        t0 = wallTime( );
+        for ( long i=0; i<numDraws; i++ )
+            sum += ali.value( );
+        rate[2] = numDraws / ( wallTime( ) - t0 );
+
+        t0 = wallTime( );
+        for ( long i=0; i<numDraws; i += block ) {
+            ali.fill( &out[0], block );
+            sum += out[0];
+        }
+        rate[3] = numDraws / ( wallTime( ) - t0 );
+
+        cout << setw( 12 ) << k << fixed << setprecision( 2 )
+             << setw( 10 ) << 1e-6 * rate[0]
+             << setw( 10 ) << 1e-6 * rate[1]
+             << setw( 10 ) << 1e-6 * rate[2]
+             << setw( 12 ) << 1e-6 * rate[3] << endl;
+    }
+    return ( sum < 0 );
+}
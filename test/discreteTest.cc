@@ -0,0 +1,164 @@
+/****************************************************************************
+ *
+ * discreteTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * discreteTest. With the inversion method, rngDiscEmpirical must
+ * return exactly the values of the linear search of the cumulative
+ * probabilities. With the alias method, the probabilities encoded in
+ * the alias table must be those of the inversion, also when the given
+ * probabilities do not add up to 1 or include zeros, and the
+ * frequencies of the values drawn must agree with them. fill( ) must
+ * give the values of value( ).
+ */
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "rng.hh"
+#include "testutil.hh"
+
+// The generators created after restart( ) draw from the same streams
+// as those created after the previous restart( )
+static void restart( void )
+{
+    const unsigned long seed[6] = { 12345, 12345, 12345, 12345, 12345, 12345 };
+    rngUniform01::setPackageSeed( seed );
+}
+
+// The linear search of the cumulative probabilities
+static int linear( const vector<double>& p, double tmp )
+{
+    double sum = 0.0;
+    int i;
+    for ( i=0; i<(int)p.size( )-1; i++ ) {
+        sum += p[i];
+        if ( tmp < sum ) return i;
+    }
+    return i;
+}
+
+// The probabilities of the linear search
+static vector<double> expected( const vector<double>& p )
+{
+    vector<double> q( p.size( ) );
+    double sum = 0.0, prev = 0.0;
+    for ( size_t i=0; i<p.size( ); i++ ) {
+        sum += p[i];
+        double c = ( i+1 < p.size( ) ? min( sum, 1.0 ) : 1.0 );
+        q[i] = max( c - prev, 0.0 );
+        prev = max( c, prev );
+    }
+    return q;
+}
+
+// Gives access to the alias table
+class aliasTable : public rngDiscEmpirical {
+public:
+    aliasTable( const vector<double>& p ) :
+        rngDiscEmpirical( "table", p, alias )
+    { };
+    // The probability of each value, according to the table
+    vector<double> probabilities( void ) const
+    {
+        const size_t n = _prob.size( );
+        vector<double> q( n, 0.0 );
+        for ( size_t i=0; i<n; i++ ) {
+            q[i] += _prob[i] / n;
+            q[ _alias[i] ] += ( 1.0 - _prob[i] ) / n;
+        }
+        return q;
+    };
+};
+
+int main( void )
+{
+    vector< vector<double> > cases;
+    cases.push_back( vector<double>( 1, 1.0 ) );
+    cases.push_back( { 0.1, 0.2, 0.3, 0.4 } );
+    cases.push_back( { 0.5, 0.0, 0.25, 0.0, 0.25 } );
+    cases.push_back( { 0.2, 0.2, 0.2 } );               // Less than 1
+    cases.push_back( { 0.6, 0.3, 0.4, 0.1 } );          // More than 1
+    cases.push_back( { 0.0, 0.0, 1.0 } );
+    vector<double> many( 1000 );
+    double total = 0.0;
+    for ( size_t i=0; i<many.size( ); i++ )
+        total += ( many[i] = 1.0 + sin( (double)i ) );
+    for ( size_t i=0; i<many.size( ); i++ )
+        many[i] /= total;
+    cases.push_back( many );
+
+    for ( size_t c=0; c<cases.size( ); c++ ) {
+        const vector<double>& p = cases[c];
+        const vector<double> q = expected( p );
+
+        // Inversion against the linear search
+        restart( );
+        rngDiscEmpirical inv( "inv", p, rngDiscEmpirical::inversion );
+        restart( );
+        rngUniform01 u( "u" );
+        bool same = true;
+        for ( int i=0; i<100000; i++ )
+            same = same && ( inv.value( ) == linear( p, u.value( ) ) );
+        check( same, "inversion against the linear search" );
+
+        // The alias table
+        aliasTable table( p );
+        vector<double> t = table.probabilities( );
+        bool ok = true;
+        for ( size_t i=0; i<p.size( ); i++ )
+            ok = ok && fabs( t[i] - q[i] ) < 1e-12;
+        check( ok, "probabilities of the alias table" );
+
+        // Frequencies of the alias method: each within five standard
+        // deviations of its expected value
+        const int n = 1000000;
+        rngDiscEmpirical ali( "ali", p );
+        vector<double> freq( p.size( ), 0.0 );
+        for ( int i=0; i<n; i++ ) {
+            int v = ali.value( );
+            ok = ok && v >= 0 && v < (int)p.size( );
+            freq[ v ]++;
+        }
+        for ( size_t i=0; i<p.size( ); i++ )
+            ok = ok && fabs( freq[i] - n * q[i] ) <= 5.0 * sqrt( n * q[i] * ( 1.0 - q[i] ) ) + 1e-9;
+        check( ok, "frequencies of the alias method" );
+
+        // fill( ) against value( )
+        for ( int m=0; m<2; m++ ) {
+            rngDiscEmpirical::method_t method = ( m == 0 ? rngDiscEmpirical::alias : rngDiscEmpirical::inversion );
+            restart( );
+            rngDiscEmpirical a( "a", p, method );
+            restart( );
+            rngDiscEmpirical b( "b", p, method );
+            vector<int> v( 1000 );
+            same = true;
+            for ( int r=0; r<3; r++ ) {
+                a.fill( &v[0], v.size( ) - r );
+                for ( size_t i=0; i<v.size( ) - r; i++ )
+                    same = same && ( v[i] == b.value( ) );
+            }
+            check( same, "fill( ) against value( )" );
+        }
+    }
+
+    return ( errors > 0 );
+}
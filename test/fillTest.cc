@@ -0,0 +1,214 @@
+/****************************************************************************
+ *
+ * fillTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * fillTest. rngUniform01::fill( ) must give exactly the values of as
+ * many calls to value( ), and leave the generator in the same state;
+ * the vector kernels must give exactly the values of the scalar ones.
+ * The exponential, Weibull and normal variates drawn with fill( ) must
+ * agree with those of value( ) to a few units in the last place, also
+ * when the two are mixed, and so must rngBuffer. Finally, the time per
+ * variate of value( ) and fill( ) is printed.
+ */
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "rng.hh"
+#include "rngkernels.hh"
+#include "testutil.hh"
+
+static bool close( double x, double y, double tol )
+{
+    return fabs( x - y ) <= tol * fabs( y );
+}
+
+// The generators created after restart( ) draw from the same streams
+// as those created after the previous restart( )
+static void restart( void )
+{
+    const unsigned long seed[6] = { 12345, 12345, 12345, 12345, 12345, 12345 };
+    rngUniform01::setPackageSeed( seed );
+}
+
+//
+// a and b draw from the same streams. Draws the values of a with
+// fill( ), in blocks of the given sizes, and those of b with value( ),
+// and compares them.
+//
+static void compare( rng<double>& a, rng<double>& b, double tol, const char* what )
+{
+    const size_t blocks[] = { 0, 1, 3, 100, 127, 128, 1000, 4097, 1, 256 };
+    bool ok = true;
+    for ( size_t k=0; k<sizeof( blocks ) / sizeof( blocks[0] ); k++ ) {
+        vector< double > v( blocks[ k ] + 1 );
+        a.fill( &v[0], blocks[ k ] );
+        for ( size_t i=0; i<blocks[ k ]; i++ )
+            ok = ok && close( v[i], b.value( ), tol );
+        ok = ok && close( a.value( ), b.value( ), tol );
+    }
+    check( ok, what );
+}
+
+int main( void )
+{
+    cout << "Kernels: " << rngKernels::isa( ) << endl;
+
+    // Uniform: exactly the same values, and the same state afterwards
+    {
+        restart( );
+        rngUniform01 a( "a" );
+        restart( );
+        rngUniform01 b( "b" );
+        compare( a, b, 0.0, "rngUniform01::fill( ) against value( )" );
+        unsigned long sa[6], sb[6];
+        a.getState( sa );
+        b.getState( sb );
+        bool same = true;
+        for ( int k=0; k<6; k++ )
+            same = same && ( sa[k] == sb[k] );
+        check( same, "state after rngUniform01::fill( )" );
+    }
+
+    // Vector against scalar kernels
+    {
+        const size_t n = 10007;
+        vector< double > v[2];
+        for ( int k=0; k<2; k++ ) {
+            rngKernels::setVector( k == 0 );
+            restart( );
+            rngUniform u( "u", -1.0, 2.0 );
+            rngExp e( "e", 3.0 );
+            rngWeib w( "w", 2.0, 1.5 );
+            rngNormal g( "g", 1.0, 4.0 );
+            v[k].resize( 4 * n );
+            u.fill( &v[k][0], n );
+            e.fill( &v[k][n], n );
+            w.fill( &v[k][2 * n], n );
+            g.fill( &v[k][3 * n], n );
+        }
+        rngKernels::setVector( true );
+        bool same = true;
+        for ( size_t i=0; i<4 * n; i++ )
+            same = same && ( v[0][i] == v[1][i] );
+        check( same, "vector kernels against scalar kernels" );
+    }
+
+    // The transforms against the C library
+    {
+        restart( );
+        rngUniform u1( "u1", -1.0, 2.0 );
+        rngExp e1( "e1", 3.0 );
+        rngWeib w1( "w1", 2.0, 1.5 );
+        rngWeib v1( "v1", 0.5, 0.3 );
+        rngNormal g1( "g1", 1.0, 4.0 );
+        rngConst c1( "c1", 7.0 );
+        restart( );
+        rngUniform u2( "u2", -1.0, 2.0 );
+        rngExp e2( "e2", 3.0 );
+        rngWeib w2( "w2", 2.0, 1.5 );
+        rngWeib v2( "v2", 0.5, 0.3 );
+        rngNormal g2( "g2", 1.0, 4.0 );
+        rngConst c2( "c2", 7.0 );
+        compare( u1, u2, 0.0, "rngUniform::fill( ) against value( )" );
+        compare( e1, e2, 1e-14, "rngExp::fill( ) against value( )" );
+        compare( w1, w2, 1e-14, "rngWeib::fill( ) against value( )" );
+        compare( v1, v2, 1e-13, "rngWeib::fill( ) against value( ), small shape" );
+        compare( c1, c2, 0.0, "rngConst::fill( ) against value( )" );
+        // Normal variates near the mean have no relative accuracy
+        // to speak of; compare them to the standard deviation
+        bool ok = true;
+        vector< double > v( 1001 );
+        for ( int k=0; k<20; k++ ) {
+            size_t n = ( k * 37 ) % 1001;
+            g1.fill( &v[0], n );
+            for ( size_t i=0; i<n; i++ )
+                ok = ok && fabs( v[i] - g2.value( ) ) < 1e-14 * 2.0;
+            if ( k % 3 == 0 )
+                ok = ok && ( g1.value( ) == g2.value( ) );
+        }
+        check( ok, "rngNormal::fill( ) against value( )" );
+    }
+
+    // Logarithm over the whole range of the uniforms
+    {
+        const size_t n = 100000;
+        vector< double > x( n ), y( n );
+        for ( size_t i=0; i<n; i++ )
+            x[i] = y[i] = ( i + 0.5 ) / n;
+        x[0] = y[0] = 2.328306549295728e-10;
+        x[1] = y[1] = 1.0 - 2.328306549295728e-10;
+        rngKernels::negLog1m( &x[0], n, 1.0 );
+        double maxErr = 0.0;
+        for ( size_t i=0; i<n; i++ )
+            maxErr = max( maxErr, fabs( x[i] + log( 1.0 - y[i] ) ) / fabs( log( 1.0 - y[i] ) ) );
+        cout << "Largest relative error of the logarithm: " << maxErr << endl;
+        check( maxErr < 1e-15, "accuracy of the logarithm" );
+    }
+
+    // rngBuffer
+    {
+        restart( );
+        rngExp e1( "e1", 3.0 );
+        rngBuffer< double > b1( "b1", &e1, 100 );
+        restart( );
+        rngExp e2( "e2", 3.0 );
+        bool ok = true;
+        for ( int r=0; r<3; r++ ) {
+            if ( r > 0 ) {
+                b1.reset( );
+                e2.reset( );
+            }
+            for ( int i=0; i<1234; i++ )
+                ok = ok && close( b1.value( ), e2.value( ), 1e-14 );
+        }
+        check( ok, "rngBuffer against value( )" );
+    }
+
+    // Speed
+    {
+        const size_t n = 1000000, block = 1024;
+        vector< double > v( block );
+        rngUniform01 u( "u" );
+        rngExp e( "e", 1.0 );
+        rngNormal g( "g", 0.0, 1.0 );
+        rng<double>* r[] = { &u, &e, &g };
+        const char* names[] = { "uniform", "exponential", "normal" };
+        for ( int k=0; k<3; k++ ) {
+            double sum = 0.0, start = wallTime( );
+            for ( size_t i=0; i<n; i++ )
+                sum += r[k]->value( );
+            double tValue = wallTime( ) - start;
+            start = wallTime( );
+            for ( size_t i=0; i<n; i += block ) {
+                r[k]->fill( &v[0], block );
+                sum += v[0];
+            }
+            double tFill = wallTime( ) - start;
+            cout << names[k] << ": " << 1e9 * tValue / n << " ns per value( ), "
+                 << 1e9 * tFill / n << " ns per value with fill( )"
+                 << ( sum == 0.0 ? " " : "" ) << endl;
+        }
+    }
+
+    return ( errors > 0 );
+}
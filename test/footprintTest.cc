@@ -0,0 +1,112 @@
+/****************************************************************************
+ *
+ * footprintTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+
+/*
+ * footprintTest. A large number of processes are created and never
+ * activated, and a smaller number of jobs are passivated on the
+ * shared stack. The processes with the same name must share it, the
+ * accounting of the live processes must be exact, and the memory used
+ * by each of them must stay small.
+ */
+#include <iostream>
+#include <vector>
+#include "cppsim.hh"
+#include "testutil.hh"
+
+const int numIdle = 200000;
+const int numJobs = 10000;
+
+vector<handle_p> idlers;
+vector<handle_p> jobs;
+
+class idler : public process {
+public:
+    idler( void ) : process( "idler" ) { };
+protected:
+    void inner_body( void ) { };
+};
+
+class job : public process {
+public:
+    job( void ) : process( "job" ) { };
+protected:
+    void inner_body( void ) {
+        passivate( );
+    };
+};
+
+class source : public process {
+public:
+    source( void ) : process( "source" ) { };
+protected:
+    void inner_body( void ) {
+        for ( int n=0; n<numIdle; n++ )
+            idlers.push_back( new idler( ) );
+        for ( int n=0; n<numJobs; n++ ) {
+            handle_p j( new job( ) );
+            j->activateAfter( current( ) );
+            jobs.push_back( j );
+        }
+        hold( 1.0 );
+
+        process::memoryReport( );
+        if ( process::live( ) != numIdle + numJobs + 1 ) {
+            cerr << process::live( ) << " live processes" << endl;
+            errors++;
+        }
+        if ( &idlers[ 0 ]->name( ) != &idlers[ numIdle-1 ]->name( ) ||
+             &jobs[ 0 ]->name( ) != &jobs[ numJobs-1 ]->name( ) ) {
+            cerr << "Names are not shared" << endl;
+            errors++;
+        }
+        if ( string( "sjlj_copy" ) != coroutine::method( ) ) {
+            // The event notice is part of the process
+            if ( sizeof( process ) > 16*sizeof( void* ) + sizeof( absEvNotice ) ) {
+                cerr << "Process objects of " << sizeof( process ) << " bytes" << endl;
+                errors++;
+            }
+            if ( coroutine::savedBytes( ) > numJobs * 2048 ) {
+                cerr << coroutine::savedBytes( ) << " bytes of saved stacks" << endl;
+                errors++;
+            }
+        }
+    };
+};
+
+int main( void )
+{
+    coroutine::cSharedStack = true;
+    simulation::instance()->begin_simulation( new sqsDll( ) );
+    handle_p src( new source( ) );
+    src->activate( );
+    simulation::instance()->run();
+    simulation::instance()->end_simulation();
+
+    idlers.clear( );
+    jobs.clear( );
+    src = 0;
+    if ( !noneAlive( ) )
+        errors++;
+    return ( errors > 0 );
+}
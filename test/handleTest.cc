@@ -27,7 +27,9 @@
 
 #include <string>
 #include <iostream>
+#include <utility>
 #include "handle.hh"
+#include "testutil.hh"
 
 using namespace std;
 
@@ -48,13 +50,69 @@ protected:
     const string _name;
 };
 
+class base : public shared {
+public:
+    base( int x = 0 ) : shared( ), _x( x ) { };
+    int x( void ) const { return _x; };
+protected:
+    int _x;
+};
+
+class derived : public base {
+public:
+    derived( int x = 0 ) : base( x ) { };
+};
+
+class other : public base {
+public:
+    other( int x = 0 ) : base( x ) { };
+};
+
+handle<derived> make( int x )
+{
+    return handle<derived>( new derived( x ) );
+}
+
+void testHandles( void )
+{
+    unsigned long n = shared::count( );
+    check( sizeof( handle<base> ) == sizeof( base* ), "a handle is as large as a pointer" );
+    {
+        handle<derived> d( make( 1 ) );
+        handle<derived> e( d );
+        d = d;
+        check( !d.isNull( ) && 1 == d->x( ), "self assignment" );
+        handle<derived> f( std::move( e ) );
+        check( e.isNull( ) && f == d, "move construction" );
+        e = std::move( f );
+        check( f.isNull( ) && e == d, "move assignment" );
+
+        handle<base> b( d );
+        check( b.rep( ) == d.rep( ), "conversion to the base class" );
+        handle<base> c( make( 2 ) );
+        check( 2 == c->x( ), "conversion of a temporary" );
+        handle<derived> g( b );
+        check( g == d, "conversion to the derived class" );
+        handle<other> o( b );
+        check( o.isNull( ), "conversion to the wrong class" );
+        handle<base> h( std::move( g ) );
+        check( g.isNull( ) && h == b, "conversion of a moved handle" );
+        check( shared::count( ) == n + 2, "number of shared objects" );
+    }
+    check( shared::count( ) == n, "shared objects released" );
+}
+
 int main( void )
 {
-    handle<foo> one( new foo("one") );
-    handle<foo> two( new foo("two") );
-    for ( int i=0; i<5; i++ ) {
-        handle<foo> three( new foo("three"+string(i,'#')) );
-        one = three;
+    {
+        handle<foo> one( new foo("one") );
+        handle<foo> two( new foo("two") );
+        for ( int i=0; i<5; i++ ) {
+            handle<foo> three( new foo("three"+string(i,'#')) );
+            one = three;
+        }
     }
-    return 0;
+    testHandles( );
+    check( 0 == shared::count( ), "all shared objects destroyed" );
+    return ( errors > 0 );
 }
@@ -0,0 +1,121 @@
+/****************************************************************************
+ *
+ * handlebench.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * handlebench. Measures the time per operation of the handles: copies,
+ * moves and conversions, and the creation and destruction of a shared
+ * object, against a raw pointer.
+ *
+ * Usage: handlebench
+ */
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "handle.hh"
+#include "testutil.hh"
+
+using namespace std;
+
+class base : public shared {
+public:
+    base( int x = 0 ) : shared( ), _x( x ) { };
+    int x( void ) const { return _x; };
+protected:
+    int _x;
+};
+
+class derived : public base {
+public:
+    derived( int x = 0 ) : base( x ) { };
+};
+
+handle<derived> make( int x )
+{
+    return handle<derived>( new derived( x ) );
+}
+
+int main( void )
+{
+    const int numObjs = 1000;
+    const int numRounds = 20000;
+    const double ops = (double)numObjs * numRounds;
+    vector< handle<derived> > v;
+    vector< derived* > raw;
+    for ( int i=0; i<numObjs; i++ ) {
+        v.push_back( make( i ) );
+        raw.push_back( v.back( ).rep( ) );
+    }
+    volatile long sink = 0;
+    double start;
+
+    start = wallTime( );
+    for ( int r=0; r<numRounds; r++ )
+        for ( int i=0; i<numObjs; i++ ) {
+            derived* p( raw[ i ] );
+            sink = sink + p->x( );
+        }
+    cout << "raw pointer: " << 1e9 * ( wallTime( ) - start ) / ops << " ns" << endl;
+
+    start = wallTime( );
+    for ( int r=0; r<numRounds; r++ )
+        for ( int i=0; i<numObjs; i++ ) {
+            handle<derived> h( v[ i ] );
+            sink = sink + h->x( );
+        }
+    cout << "copy: " << 1e9 * ( wallTime( ) - start ) / ops << " ns" << endl;
+
+    start = wallTime( );
+    for ( int r=0; r<numRounds; r++ )
+        for ( int i=0; i<numObjs; i++ ) {
+            handle<derived> h( std::move( v[ i ] ) );
+            sink = sink + h->x( );
+            v[ i ] = std::move( h );
+        }
+    cout << "move: " << 1e9 * ( wallTime( ) - start ) / ops << " ns" << endl;
+
+    start = wallTime( );
+    for ( int r=0; r<numRounds; r++ )
+        for ( int i=0; i<numObjs; i++ ) {
+            handle<base> h( v[ i ] );
+            sink = sink + h->x( );
+        }
+    cout << "conversion to the base class: " << 1e9 * ( wallTime( ) - start ) / ops << " ns" << endl;
+
+    vector< handle<base> > b( v.begin( ), v.end( ) );
+    start = wallTime( );
+    for ( int r=0; r<numRounds; r++ )
+        for ( int i=0; i<numObjs; i++ ) {
+            handle<derived> h( b[ i ] );
+            sink = sink + h->x( );
+        }
+    cout << "conversion to the derived class: " << 1e9 * ( wallTime( ) - start ) / ops << " ns" << endl;
+
+    start = wallTime( );
+    for ( int r=0; r<numRounds / 10; r++ )
+        for ( int i=0; i<numObjs; i++ ) {
+            handle<derived> h( new derived( i ) );
+            sink = sink + h->x( );
+        }
+    cout << "creation and destruction: " << 1e10 * ( wallTime( ) - start ) / ops << " ns" << endl;
+    return 0;
+}
@@ -0,0 +1,123 @@
+/****************************************************************************
+ *
+ * hibernateTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * hibernateTest. A number of jobs fill some stack frames with known
+ * values and passivate; the source keeps the simulation going long
+ * enough for all of them to be hibernated, then reactivates them.
+ * Each job checks its stack frames once it is restored. The test is
+ * done with and without direct transfer of control.
+ */
+#include <iostream>
+#include <vector>
+#include "cppsim.hh"
+
+const int numJobs = 5000;
+
+int errors = 0;
+int completed = 0;
+vector<handle_p> jobs;
+
+class job : public process {
+public:
+    job( int n ) : process( "job" ), _n( n ) { };
+protected:
+    void fill( int depth ) {
+        volatile int buf[ 32 ];
+        for ( int i=0; i<32; i++ )
+            buf[ i ] = _n * 64 + depth + i;
+        if ( depth > 0 )
+            fill( depth-1 );
+        else
+            passivate( );
+        for ( int i=0; i<32; i++ )
+            if ( buf[ i ] != _n * 64 + depth + i )
+                errors++;
+    };
+    void inner_body( void ) {
+        fill( _n % 16 );
+        completed++;
+    };
+    int _n;
+};
+
+class source : public process {
+public:
+    source( void ) : process( "source" ) { };
+protected:
+    void inner_body( void ) {
+        for ( int n=0; n<numJobs; n++ ) {
+            handle_p j( new job( n ) );
+            j->activateAfter( current( ) );
+            jobs.push_back( j );
+        }
+        // Some events, so that the idle jobs are swept
+        for ( int i=0; i<100; i++ )
+            hold( 1.0 );
+        int hibernated = 0;
+        for ( int n=0; n<numJobs; n++ )
+            if ( jobs[ n ]->hibernated( ) )
+                hibernated++;
+        if ( hibernated != numJobs ) {
+            cerr << "Only " << hibernated << " jobs hibernated" << endl;
+            errors++;
+        }
+        for ( int n=numJobs-1; n>=0; n-- )
+            jobs[ n ]->activateAfter( current( ) );
+        hold( 1.0 );
+        end_simulation( );
+    };
+};
+
+int main( void )
+{
+    // With stack copying, all the coroutines run on the process stack
+    if ( string( "sjlj_copy" ) == coroutine::method( ) )
+        return 77;
+
+    for ( int direct=0; direct<2; direct++ ) {
+        completed = 0;
+        sqs* s = new sqsDll( );
+        s->setDirectTransfer( direct );
+        s->setHibernation( 10.0, 0.0, 10 );
+        simulation::instance()->begin_simulation( s );
+        handle_p src( new source( ) );
+        src->activate( );
+        simulation::instance()->run();
+        simulation::instance()->end_simulation();
+
+        coroutine::hibernationReport( );
+        if ( errors > 0 || completed != numJobs ) {
+            cerr << "Direct transfer " << direct << ": " << errors
+                 << " errors, " << completed << " jobs completed" << endl;
+            return 1;
+        }
+        if ( coroutine::hibernatedBytes( ) != 0 ) {
+            cerr << "Hibernated stacks left: "
+                 << coroutine::hibernatedBytes( ) << " bytes" << endl;
+            return 1;
+        }
+        jobs.clear( );
+    }
+    return 0;
+}
@@ -0,0 +1,593 @@
+/****************************************************************************
+ *
+ * holdbench.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+
+/*
+ * holdbench. The standard benchmarks of the sequencing sets, run on
+ * every type of sqs:
+ *
+ *   - the hold model: the sqs is filled with n notices and brought
+ *     to a steady state with n holds (at most the number of measured
+ *     holds); then, at each hold, the first notice is moved to its
+ *     time plus a random increment;
+ *
+ *   - the up/down model: n notices are inserted in an empty sqs, at
+ *     the time of the last notice removed plus a random increment
+ *     (up), then all of them are removed in order (down). Small sqs
+ *     repeat the cycle, so that about as many operations as holds are
+ *     measured.
+ *
+ * The increments are drawn from the distributions of the classic
+ * studies of the sequencing sets, all with mean 1: exponential,
+ * uniform on [0, 2), bimodal (90% uniform on [0, 0.2), 10% uniform
+ * on [0, 18.2)), triangular on [0, 2), and camel (two humps, on
+ * [0.1, 0.3) and [1.7, 1.9), with 45% of the increments each, and
+ * 10% uniform on [0, 2)). They are scaled to a mean of 1000 ticks
+ * and rounded down to whole ticks, so that the timing wheel runs the
+ * same model as the others; with -c they are not rounded, and the
+ * timing wheel is left out.
+ *
+ * For each model, increment distribution, type and size, the time
+ * per operation is printed in a table. Where the perf counters of
+ * Linux are available, the number of cache misses per operation is
+ * measured as well; the peak heap memory taken by the sqs (the bytes
+ * allocated with operator new during the run, the processes excluded)
+ * is always measured. With -o, all of them are also written to a file
+ * in CSV format ("-" is the standard output), with a line per run:
+ *
+ *   model,increments,sqs,size,ops,ns_per_op,cache_misses_per_op,peak_bytes
+ *
+ * where the cache misses are left empty if they are not available.
+ * The linear list is not run beyond 10000 notices.
+ *
+ * Usage: holdbench [-n <num. of ops>] [-l <min. size>] [-s <max. size>]
+ *                  [-t <sqs>,...] [-d <increments>,...] [-m <model>,...]
+ *                  [-c] [-o <file>]
+ */
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include "cppsim.hh"
+#include "testutil.hh"
+
+extern "C" {
+#include <getopt.h>
+#include <malloc.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+}
+
+using namespace std;
+
+long numOps = 1000000;
+long minSize = 10;
+long maxSize = 10000000;
+bool continuous = false;
+const long maxDllSize = 10000;  // The linear list is too slow beyond this
+const double tickScale = 1000.0;
+
+//
+// The bytes allocated with operator new, and their peak since the
+// last call to resetPeak( ). All the forms of operator new and
+// delete are replaced, so that each block is freed by the allocator
+// which gave it.
+//
+static size_t liveBytes = 0;
+static size_t peakBytes = 0;
+
+static void* allocate( size_t n, size_t align )
+{
+    void* p = 0;
+    if ( align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__ )
+        p = malloc( n > 0 ? n : 1 );
+    else if ( 0 != posix_memalign( &p, align, n > 0 ? n : 1 ) )
+        p = 0;
+    if ( 0 == p )
+        return 0;
+    liveBytes += malloc_usable_size( p );
+    if ( liveBytes > peakBytes )
+        peakBytes = liveBytes;
+    return p;
+}
+
+// GCC inlines this in the callers of the operator delete, and warns
+// that memory from operator new goes to free( ); here it comes from
+// allocate( ), so the warning is wrong
+#if defined( __GNUC__ ) && !defined( __clang__ ) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+static void deallocate( void* p )
+{
+    if ( 0 == p )
+        return;
+    liveBytes -= malloc_usable_size( p );
+    free( p );
+}
+#if defined( __GNUC__ ) && !defined( __clang__ ) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+void* operator new( size_t n )
+{
+    void* p = allocate( n, 0 );
+    if ( 0 == p )
+        throw bad_alloc( );
+    return p;
+}
+
+void* operator new[]( size_t n )
+{
+    return operator new( n );
+}
+
+void* operator new( size_t n, align_val_t a )
+{
+    void* p = allocate( n, (size_t)a );
+    if ( 0 == p )
+        throw bad_alloc( );
+    return p;
+}
+
+void* operator new[]( size_t n, align_val_t a )
+{
+    return operator new( n, a );
+}
+
+void* operator new( size_t n, const nothrow_t& ) noexcept
+{
+    return allocate( n, 0 );
+}
+
+void* operator new[]( size_t n, const nothrow_t& ) noexcept
+{
+    return allocate( n, 0 );
+}
+
+void* operator new( size_t n, align_val_t a, const nothrow_t& ) noexcept
+{
+    return allocate( n, (size_t)a );
+}
+
+void* operator new[]( size_t n, align_val_t a, const nothrow_t& ) noexcept
+{
+    return allocate( n, (size_t)a );
+}
+
+void operator delete( void* p ) noexcept                                  { deallocate( p ); }
+void operator delete[]( void* p ) noexcept                                { deallocate( p ); }
+void operator delete( void* p, size_t ) noexcept                          { deallocate( p ); }
+void operator delete[]( void* p, size_t ) noexcept                        { deallocate( p ); }
+void operator delete( void* p, align_val_t ) noexcept                     { deallocate( p ); }
+void operator delete[]( void* p, align_val_t ) noexcept                   { deallocate( p ); }
+void operator delete( void* p, size_t, align_val_t ) noexcept             { deallocate( p ); }
+void operator delete[]( void* p, size_t, align_val_t ) noexcept           { deallocate( p ); }
+void operator delete( void* p, const nothrow_t& ) noexcept                { deallocate( p ); }
+void operator delete[]( void* p, const nothrow_t& ) noexcept              { deallocate( p ); }
+void operator delete( void* p, align_val_t, const nothrow_t& ) noexcept   { deallocate( p ); }
+void operator delete[]( void* p, align_val_t, const nothrow_t& ) noexcept { deallocate( p ); }
+
+static void resetPeak( void )
+{
+    peakBytes = liveBytes;
+}
+
+//
+// The cache misses of this process, in user mode. A counter of -1 is
+// not available (no perf_event_open, or no hardware counters, as in
+// most virtual machines).
+//
+class missCounter {
+public:
+    missCounter( void ) : _fd( -1 ) {
+#ifdef __linux__
+        struct perf_event_attr attr;
+        memset( &attr, 0, sizeof( attr ) );
+        attr.size = sizeof( attr );
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        _fd = syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 );
+#endif
+    };
+    ~missCounter( ) {
+#ifdef __linux__
+        if ( _fd >= 0 )
+            close( _fd );
+#endif
+    };
+    bool available( void ) const { return _fd >= 0; };
+    void start( void ) {
+#ifdef __linux__
+        if ( _fd >= 0 ) {
+            ioctl( _fd, PERF_EVENT_IOC_RESET, 0 );
+            ioctl( _fd, PERF_EVENT_IOC_ENABLE, 0 );
+        }
+#endif
+    };
+    long long stop( void ) {
+        long long n = -1;
+#ifdef __linux__
+        if ( _fd >= 0 ) {
+            ioctl( _fd, PERF_EVENT_IOC_DISABLE, 0 );
+            if ( sizeof( n ) != read( _fd, &n, sizeof( n ) ) )
+                n = -1;
+        }
+#endif
+        return n;
+    };
+protected:
+    int _fd;
+};
+
+missCounter misses;
+
+static double expIncrement( void )
+{
+    return -log( uniform( ) );
+}
+
+static double uniformIncrement( void )
+{
+    return 2.0 * uniform( );
+}
+
+static double bimodalIncrement( void )
+{
+    return ( uniform( ) < 0.9 ? 0.2 : 18.2 ) * uniform( );
+}
+
+static double triangularIncrement( void )
+{
+    return uniform( ) + uniform( );
+}
+
+static double camelIncrement( void )
+{
+    double u = uniform( );
+    if ( u < 0.45 )
+        return 0.1 + 0.2 * uniform( );
+    if ( u < 0.9 )
+        return 1.7 + 0.2 * uniform( );
+    return 2.0 * uniform( );
+}
+
+struct distribution {
+    const char* name;
+    double (*draw)( void );
+};
+
+const distribution distributions[] = {
+    { "exponential", expIncrement },
+    { "uniform", uniformIncrement },
+    { "bimodal", bimodalIncrement },
+    { "triangular", triangularIncrement },
+    { "camel", camelIncrement }
+};
+const int numDists = sizeof( distributions ) / sizeof( distributions[0] );
+
+const sched_t types[] = { SQSDLL, SQSPRIO, SQSCAL, SQSHEAP, SQSLADDER, SQSWHEEL, SQSADAPTIVE };
+const char* typeNames[] = { "dll", "prio", "cal", "heap", "ladder", "wheel", "adaptive" };
+const int numTypes = sizeof( types ) / sizeof( types[0] );
+
+const char* modelNames[] = { "hold", "up", "down" };
+const int numModels = 3;        // up and down are run together
+
+double (*draw)( void );
+
+static simtime_t increment( void )
+{
+    if ( continuous )
+        return (simtime_t)draw( );
+    return (simtime_t)floor( tickScale * draw( ) );
+}
+
+class dummy : public process {
+public:
+    dummy( void ) : process( "dummy" ) { };
+protected:
+    void inner_body( void ) { };
+};
+
+// The processes of the notices, created once for all the runs
+vector<handle_p> procs;
+
+//
+// The result of a run
+//
+struct result {
+    long ops;
+    double ns;                  // Per operation
+    double misses;              // Per operation, -1 if not available
+    size_t bytes;               // Peak heap memory of the sqs
+};
+
+static void measured( result& r, double t0, long long m )
+{
+    r.ns = 1e9 * ( wallTime( ) - t0 ) / r.ops;
+    r.misses = ( m < 0 ? -1.0 : (double)m / r.ops );
+}
+
+//
+// The hold model
+//
+result hold( sched_t type, long size )
+{
+    result r;
+    size_t base = liveBytes;
+    resetPeak( );
+    sqs* s = makeSqs( type );
+    for ( long i=0; i<size; i++ )
+        s->insertAt( procs[ i ], increment( ) );
+    for ( long i=0; i<size && i<numOps; i++ ) {
+        absEvNotice* ev = s->first( );
+        s->reschedule( ev, ev->evTime( ) + increment( ) );
+    }
+
+    r.ops = numOps;
+    misses.start( );
+    double t0 = wallTime( );
+    for ( long i=0; i<numOps; i++ ) {
+        absEvNotice* ev = s->first( );
+        s->reschedule( ev, ev->evTime( ) + increment( ) );
+    }
+    long long m = misses.stop( );
+    measured( r, t0, m );
+
+    s->clear( );
+    r.bytes = peakBytes - base;
+    delete s;
+    return r;
+}
+
+//
+// The up/down model; up and down are timed separately
+//
+void upDown( sched_t type, long size, result& up, result& down )
+{
+    size_t base = liveBytes;
+    resetPeak( );
+    sqs* s = makeSqs( type );
+    long cycles = ( size < numOps ? numOps / size : 1 );
+    double upTime = 0.0, downTime = 0.0;
+    long long upMisses = 0, downMisses = 0;
+    simtime_t t = 0;
+
+    for ( long c=0; c<cycles; c++ ) {
+        misses.start( );
+        double t0 = wallTime( );
+        for ( long i=0; i<size; i++ )
+            s->insertAt( procs[ i ], t + increment( ) );
+        upTime += wallTime( ) - t0;
+        upMisses += misses.stop( );
+
+        misses.start( );
+        t0 = wallTime( );
+        for ( long i=0; i<size; i++ ) {
+            absEvNotice* ev = s->first( );
+            t = ev->evTime( );
+            s->remove( ev );
+        }
+        downTime += wallTime( ) - t0;
+        downMisses += misses.stop( );
+    }
+
+    up.ops = down.ops = cycles * size;
+    up.ns = 1e9 * upTime / up.ops;
+    down.ns = 1e9 * downTime / down.ops;
+    up.misses = ( misses.available( ) ? (double)upMisses / up.ops : -1.0 );
+    down.misses = ( misses.available( ) ? (double)downMisses / down.ops : -1.0 );
+    up.bytes = down.bytes = peakBytes - base;
+    delete s;
+}
+
+//
+// Parses a comma separated list of names, setting sel[ i ] for each
+// one among names[ 0..n-1 ]
+//
+static void parseList( const char* list, const char* const names[], int n, vector<bool>& sel )
+{
+    sel.assign( n, false );
+    string l( list );
+    size_t b = 0;
+    while ( b <= l.size( ) ) {
+        size_t e = l.find( ',', b );
+        if ( string::npos == e )
+            e = l.size( );
+        string name( l, b, e - b );
+        int i = 0;
+        while ( i < n && name != names[ i ] )
+            i++;
+        if ( i == n ) {
+            cerr << "Unknown name " << name << endl;
+            exit( 1 );
+        }
+        sel[ i ] = true;
+        b = e + 1;
+    }
+}
+
+static void usage( const char* prog )
+{
+    cout << "Usage: " << prog << " [-n <num. of ops>] [-l <min. size>] [-s <max. size>]" << endl
+         << "       [-t <sqs>,...] [-d <increments>,...] [-m <model>,...] [-c] [-o <file>]" << endl
+         << "  sqs:        dll prio cal heap ladder wheel adaptive" << endl
+         << "  increments: exponential uniform bimodal triangular camel" << endl
+         << "  models:     hold updown" << endl;
+    exit( 0 );
+}
+
+int main( int argc, char* argv[] )
+{
+    vector<bool> selTypes( numTypes, true );
+    vector<bool> selDists( numDists, true );
+    vector<bool> selModels( 2, true );
+    const char* distNames[ numDists ];
+    for ( int i=0; i<numDists; i++ )
+        distNames[ i ] = distributions[ i ].name;
+    const char* models[] = { "hold", "updown" };
+    ofstream file;
+    ostream* csv = 0;
+
+    int opt;
+    while ( -1 != ( opt = getopt( argc, argv, "n:l:s:t:d:m:co:h" ) ) ) {
+        switch ( opt ) {
+        case 'n':
+            numOps = atol( optarg );
+            break;
+        case 'l':
+            minSize = atol( optarg );
+            break;
+        case 's':
+            maxSize = atol( optarg );
+            break;
+        case 't':
+            parseList( optarg, typeNames, numTypes, selTypes );
+            break;
+        case 'd':
+            parseList( optarg, distNames, numDists, selDists );
+            break;
+        case 'm':
+            parseList( optarg, models, 2, selModels );
+            break;
+        case 'c':
+            continuous = true;
+            break;
+        case 'o':
+            if ( 0 == strcmp( optarg, "-" ) )
+                csv = &cout;
+            else {
+                file.open( optarg );
+                if ( !file ) {
+                    cerr << "Cannot open " << optarg << endl;
+                    exit( 1 );
+                }
+                csv = &file;
+            }
+            break;
+        default:
+            usage( argv[0] );
+        }
+    }
+    if ( numOps < 1 || minSize < 1 || maxSize < minSize )
+        usage( argv[0] );
+#ifdef CPPSIM_INTEGER_TIME
+    if ( continuous ) {
+        cerr << "Continuous increments need a floating point time" << endl;
+        exit( 1 );
+    }
+#endif
+    if ( continuous )
+        selTypes[ 5 ] = false;  // The wheel only takes whole times
+
+    cout << "Cache misses " << ( misses.available( ) ? "" : "not " )
+         << "available; increments "
+         << ( continuous ? "with mean 1" : "in whole ticks, with mean 1000" ) << endl;
+    if ( 0 != csv )
+        *csv << "model,increments,sqs,size,ops,ns_per_op,cache_misses_per_op,peak_bytes" << endl;
+
+    simulation::instance()->begin_simulation( makeSqs( SQSDLL ) );
+    for ( long i=0; i<maxSize; i++ )
+        procs.push_back( new dummy( ) );
+
+    for ( int dist=0; dist<numDists; dist++ ) {
+        if ( !selDists[ dist ] )
+            continue;
+        draw = distributions[ dist ].draw;
+        // results[ model ][ type ][ size ]
+        vector< vector< vector< result > > > results( numModels, vector< vector< result > >( numTypes ) );
+        for ( int i=0; i<numTypes; i++ ) {
+            if ( !selTypes[ i ] )
+                continue;
+            for ( long size=minSize; size<=maxSize; size*=10 ) {
+                result r[ numModels ];
+                for ( int m=0; m<numModels; m++ )
+                    r[ m ].ops = 0;
+                if ( SQSDLL != types[ i ] || size <= maxDllSize ) {
+                    if ( selModels[ 0 ] ) {
+                        seed = 1;
+                        r[ 0 ] = hold( types[ i ], size );
+                    }
+                    if ( selModels[ 1 ] ) {
+                        seed = 1;
+                        upDown( types[ i ], size, r[ 1 ], r[ 2 ] );
+                    }
+                }
+                for ( int m=0; m<numModels; m++ ) {
+                    results[ m ][ i ].push_back( r[ m ] );
+                    if ( 0 == csv || 0 == r[ m ].ops )
+                        continue;
+                    *csv << modelNames[ m ] << ',' << distNames[ dist ] << ','
+                         << typeNames[ i ] << ',' << size << ',' << r[ m ].ops << ','
+                         << fixed << setprecision( 1 ) << r[ m ].ns << ',';
+                    if ( r[ m ].misses >= 0.0 )
+                        *csv << setprecision( 3 ) << r[ m ].misses;
+                    *csv << ',' << r[ m ].bytes << endl;
+                }
+            }
+        }
+
+        for ( int m=0; m<numModels; m++ ) {
+            if ( !selModels[ m == 0 ? 0 : 1 ] )
+                continue;
+            cout << endl
+                 << "ns/op, " << modelNames[ m ] << ", "
+                 << distNames[ dist ] << " increments" << endl
+                 << setw( 10 ) << "size";
+            for ( int i=0; i<numTypes; i++ )
+                if ( selTypes[ i ] )
+                    cout << setw( 10 ) << typeNames[ i ];
+            cout << endl;
+            int row = 0;
+            for ( long size=minSize; size<=maxSize; size*=10, row++ ) {
+                cout << setw( 10 ) << size;
+                for ( int i=0; i<numTypes; i++ ) {
+                    if ( !selTypes[ i ] )
+                        continue;
+                    const result& r = results[ m ][ i ][ row ];
+                    if ( 0 == r.ops )
+                        cout << setw( 10 ) << "-";
+                    else
+                        cout << setw( 10 ) << fixed << setprecision( 1 ) << r.ns;
+                }
+                cout << endl;
+            }
+        }
+    }
+
+    procs.clear( );
+    simulation::instance()->end_simulation();
+    return 0;
+}
@@ -0,0 +1,243 @@
+/****************************************************************************
+ *
+ * instantTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * instantTest. A model in which many events have the same time is
+ * run with and without batching of the instants (see
+ * sqs::setBatching), on each type of sqs, with separate and shared
+ * stacks: the processes activate others now, before and after other
+ * processes, hold for 0, cancel, passivate and terminate during the
+ * instants, and some of them are stackless. The sequence of events
+ * must be the same. Then the time per event of groups of processes
+ * holding for the same time is printed, with and without batching.
+ */
+#include <iostream>
+#include <vector>
+#include "cppsim.hh"
+#include "testutil.hh"
+
+const sched_t types[] = { SQSDLL, SQSPRIO, SQSCAL, SQSHEAP, SQSLADDER, SQSWHEEL, SQSADAPTIVE };
+const char* names[] = { "dll", "prio", "cal", "heap", "ladder", "wheel", "adaptive" };
+const int numTypes = sizeof( types ) / sizeof( types[0] );
+
+const int numWorkers = 40;
+const simtime_t simLen = 3000;
+
+vector< handle_p > workers;
+vector< int > trace;
+
+//
+// Runs once, and terminates
+//
+class flash : public process {
+public:
+    flash( int n ) : process( "flash" ), _n( n ) { };
+protected:
+    void inner_body( void ) {
+        trace.push_back( _n );
+    };
+    int _n;
+};
+
+class worker : public process {
+public:
+    worker( int n ) : process( "worker" ), _n( n ) { };
+protected:
+    void inner_body( void ) {
+        while ( 1 ) {
+            trace.push_back( _n );
+            bool pass = false;
+            {
+                handle_p other( workers[ rnd( workers.size( ) ) ] );
+                handle_p q( workers[ rnd( workers.size( ) ) ] );
+                if ( q->idle( ) )
+                    q = current( );
+                switch ( rnd( 10 ) ) {
+                case 0:
+                    if ( other->idle( ) )
+                        other->activate( );
+                    break;
+                case 1:
+                    if ( other->idle( ) )
+                        other->activateAfter( q );
+                    break;
+                case 2:
+                    if ( other->idle( ) )
+                        other->activateBefore( q );
+                    break;
+                case 3:
+                    if ( other.rep( ) != this )
+                        other->cancel( );
+                    break;
+                case 4: {
+                    handle_p f( new flash( 1000 + _n ) );
+                    f->activateAfter( current( ) );
+                    break;
+                }
+                case 5:
+                    pass = ( getSqs( )->size( ) > 2 );
+                    break;
+                case 6:
+                    if ( other.rep( ) != this && other.rep( ) != q.rep( ) )
+                        other->reactivateAfter( q );
+                    break;
+                default:
+                    break;
+                }
+            }
+            if ( pass )
+                passivate( );
+            else
+                hold( rnd( 4 ) ? rnd( 3 ) : 0 );
+        }
+    };
+    int _n;
+};
+
+#if defined( __cpp_impl_coroutine )
+class coworker : public coprocess {
+public:
+    coworker( int n ) : coprocess( "coworker" ), _n( n ) { };
+protected:
+    task co_body( void ) {
+        while ( 1 ) {
+            trace.push_back( _n );
+            {
+                handle_p other( workers[ rnd( workers.size( ) ) ] );
+                if ( other->idle( ) )
+                    other->activateAfter( current( ) );
+            }
+            co_await hold( rnd( 3 ) );
+        }
+    };
+    int _n;
+};
+#endif
+
+class driver : public process {
+public:
+    driver( void ) : process( "driver" ) { };
+protected:
+    void inner_body( void ) {
+        for ( int n=0; n<numWorkers; n++ ) {
+#if defined( __cpp_impl_coroutine )
+            if ( n % 8 == 7 )
+                workers.push_back( new coworker( n ) );
+            else
+#endif
+                workers.push_back( new worker( n ) );
+            workers.back( )->activateAt( time( ) + rnd( 3 ) );
+        }
+        hold( simLen );
+        end_simulation( );
+    };
+};
+
+vector< int > run( sched_t type, bool batching )
+{
+    seed = 1;
+    trace.clear( );
+    sqs* s = makeSqs( type );
+    s->setBatching( batching );
+    simulation::instance( )->begin_simulation( s );
+    handle_p d( new driver( ) );
+    d->activate( );
+    simulation::instance( )->run( );
+    simulation::instance( )->end_simulation( );
+    d = 0;
+    workers.clear( );
+    return trace;
+}
+
+//
+// k processes hold 1 at each step: k events per instant
+//
+class ticker : public process {
+public:
+    ticker( void ) : process( "ticker" ) { };
+protected:
+    void inner_body( void ) {
+        while ( 1 )
+            hold( 1 );
+    };
+};
+
+class starter : public process {
+public:
+    starter( int k ) : process( "starter" ), _k( k ) { };
+protected:
+    void inner_body( void ) {
+        for ( int i=0; i<_k; i++ ) {
+            workers.push_back( new ticker( ) );
+            workers.back( )->activateAt( 1 );
+        }
+        hold( 200000 / _k );
+        end_simulation( );
+    };
+    int _k;
+};
+
+double bench( int k, bool batching )
+{
+    sqs* s = makeSqs( SQSHEAP );
+    s->setBatching( batching );
+    simulation::instance( )->begin_simulation( s );
+    handle_p st( new starter( k ) );
+    st->activate( );
+    double start = wallTime( );
+    simulation::instance( )->run( );
+    double elapsed = wallTime( ) - start;
+    unsigned long events = s->processed( );
+    simulation::instance( )->end_simulation( );
+    st = 0;
+    workers.clear( );
+    return 1e9 * elapsed / events;
+}
+
+int main( void )
+{
+    int errors = 0;
+    for ( int shared=0; shared<2; shared++ ) {
+        coroutine::cSharedStack = ( shared > 0 );
+        for ( int i=0; i<numTypes; i++ ) {
+            vector< int > expected( run( types[ i ], false ) );
+            if ( run( types[ i ], true ) != expected ) {
+                cerr << names[ i ] << ( shared ? ", shared stack" : "" )
+                     << ": the events differ with batching" << endl;
+                errors++;
+            }
+            if ( 0 == i )
+                cout << expected.size( ) << " events" << endl;
+        }
+    }
+    coroutine::cSharedStack = false;
+
+    for ( int k=1; k<=1000; k*=10 )
+        cout << k << " events per instant: " << bench( k, false )
+             << " ns/event without batching, " << bench( k, true )
+             << " ns/event with batching" << endl;
+
+    if ( !noneAlive( ) )
+        errors++;
+    return ( errors > 0 );
+}
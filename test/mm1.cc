@@ -76,7 +76,7 @@ class server: public process {
 public:
     server( const string& name ) : 
 	process( name ) { };
-    list< handle<job> > queue;
+    simset::head queue;
 protected:
     void inner_body( void );
 };
@@ -89,7 +89,7 @@ class sink: public process {
 public:
     sink( const string& name ) : 
 	process( name ) { };
-    list< handle<job> > queue;
+    simset::head queue;
 protected:
     void inner_body( void );
 };
@@ -110,12 +110,16 @@ protected:
 //
 // class JOB
 //
-class job: public process {
+class job: public recyclable<job> {
 public:
     job( const string& name ) : 
-	process( name ),
+	recyclable<job>( name ),
 	createdAt( time( ) ),
 	servicedAt( 0.0 ) { };
+    void reinit( const string& ) {
+	createdAt = time( );
+	servicedAt = 0.0;
+    };
     double createdAt;
     double servicedAt;
 protected:
@@ -139,7 +143,7 @@ void source::inner_body( void )
 {    
     while ( 1 ) {
         hold( job_inter_time->value( ) );
-        handle<job> j( new job( "Job" ) );
+        handle<job> j( job::create( "Job" ) );
         j->activateAfter( current( ) );
     }
 }
@@ -148,7 +152,7 @@ void job::inner_body( void )
 {
     if ( srv->idle( ) ) 
         srv->activateAfter( current( ) );
-    srv->queue.push_back( this );
+    into( srv->queue );
 
     passivate( ); // wait for service
 
@@ -160,7 +164,7 @@ void job::inner_body( void )
 
     if ( snk->idle( ) )
 	snk->activateAfter( current( ) );
-    snk->queue.push_back( this );
+    into( snk->queue );
 }
 
 void sink::inner_body( void )
@@ -168,7 +172,7 @@ void sink::inner_body( void )
     while ( 1 ) {
         if ( queue.empty( ) )
             passivate( );
-        queue.pop_front( );
+        queue.first( )->out( );
     }    
 }
 
@@ -184,8 +188,8 @@ void server::inner_body( void )
             passivate( );
 	    t_restart = time( );
 	}
-        handle<job> j( queue.front( ) );
-        queue.pop_front( );
+        handle<job> j( static_cast< job* >( queue.first( ) ) );
+        j->out( );
         j->servicedAt = time( );
         hold( job_serv_time->value( ) );
 	j->activateAfter( current( ) );
@@ -216,24 +220,30 @@ int main( int argc, char* argv[] )
 {
     char opt;
 
+#ifdef CPPSIM_INTEGER_TIME
+    // The exponential times of the model are not whole numbers of ticks
+    return 77;
+#endif
+
     /*
      * Read the command line parameters
      */
-    while ( -1 != ( opt = getopt( argc, argv, "c:hr:l:t:DS:" ) ) ) {
+    while ( -1 != ( opt = getopt( argc, argv, "c:hr:l:t:DS:P" ) ) ) {
 	switch (opt) {
 	case 'c':
 	    confp = atof( optarg );
 	    break;
 	case 'h':
 	    cout << "Usage: " << argv[0] 
-		 << " [-c <confp>] [-h] [-r <numrep>] [-l <siml>] [-t <trlen>] [-D] [-S]" << endl
+		 << " [-c <confp>] [-h] [-r <numrep>] [-l <siml>] [-t <trlen>] [-D] [-S] [-P]" << endl
 		 << endl
 		 << " -c <confp>  Sets the confidence probability to <confp> (def: 0.9)" << endl
 		 << " -r <numrep> Sets the number of replications to <numrep> (def: 1)" << endl
 		 << " -l <siml>   Sets the length of the simulation, in time units (def 1e6)" << endl
 		 << " -t <trlen>  Length of the transient period (def 0)" << endl
 		 << " -D          Turns on lots of debugging messages (def off)" << endl
-		 << " -S          Sqs type (0 = Doubly linked List, 1 = Priority Queue)" << endl
+		 << " -S          Sqs type (0 = Doubly linked List, 1 = Priority Queue, 2 = Calendar Queue, 3 = 4-ary Heap, 4 = Ladder Queue, 5 = Timing Wheel)" << endl
+		 << " -P          Profiles the coroutine switches (def off)" << endl
 		 << " -h          Displays this help" << endl
 		 << endl;
 	    exit( 0 );
@@ -255,6 +265,9 @@ int main( int argc, char* argv[] )
 	case 'S':
 	    schedType = (sched_t)atoi( optarg );
 	    break;
+	case 'P':
+	    profiler::instance()->enable( true );
+	    break;
 	default:
 	    cerr << "Unrecognized option: " << argv[ optind ] << endl;
 	    exit( -1 );
@@ -306,6 +319,8 @@ int main( int argc, char* argv[] )
         simulation::instance()->end_simulation();
     }
     cout << "done!" << endl;
+    if ( profiler::cEnabled )
+        profiler::instance()->report( );
     try {
         wtime->report( );
         tput->report( );
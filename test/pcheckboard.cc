@@ -73,6 +73,10 @@ protected:
 
 int main( void )
 {
+#ifdef CPPSIM_INTEGER_TIME
+    // The times of the model are not whole numbers of ticks
+    return 77;
+#endif
     simulation::instance()->begin_simulation( new sqsDll() );
     handle<simulation_main> m( new simulation_main( ) );
     m->activate( );
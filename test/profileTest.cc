@@ -0,0 +1,90 @@
+/****************************************************************************
+ *
+ * profileTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * profileTest. A source creates jobs which hold once; the profiler
+ * must see every switch, and charge the right number of slices to
+ * each class.
+ */
+#include <iostream>
+#include "cppsim.hh"
+
+const int numJobs = 1000;
+
+class job : public process {
+public:
+    job( const string& name ) : process( name ) { };
+protected:
+    void inner_body( void ) {
+        hold( 1 );
+    };
+};
+
+class source : public process {
+public:
+    source( const string& name ) : process( name ) { };
+protected:
+    void inner_body( void ) {
+        for ( int i=0; i<numJobs; i++ ) {
+            handle_p j( new job( "job" ) );
+            j->activateAfter( current( ) );
+            hold( 2 );
+        }
+        end_simulation( );
+    };
+};
+
+int main( void )
+{
+    profiler* prof = profiler::instance( );
+    prof->enable( true );
+    unsigned long switches = coroutine::numCtxSwitch( );
+
+    simulation::instance()->begin_simulation( new sqsDll() );
+    handle_p src( new source( "source" ) );
+    src->activate();
+    simulation::instance()->run();
+    simulation::instance()->end_simulation();
+
+    prof->enable( false );
+    prof->report( );
+
+    switches = coroutine::numCtxSwitch( ) - switches;
+    if ( prof->switches( ) != switches ) {
+        cerr << "Profiled " << prof->switches( ) << " switches out of "
+             << switches << endl;
+        return 1;
+    }
+    // Each job runs twice: when activated, and at the end of its hold
+    if ( prof->slices( typeid( job ) ) != 2 * numJobs ) {
+        cerr << "Wrong number of job slices: "
+             << prof->slices( typeid( job ) ) << endl;
+        return 1;
+    }
+    if ( prof->slices( typeid( source ) ) != numJobs + 1 ) {
+        cerr << "Wrong number of source slices: "
+             << prof->slices( typeid( source ) ) << endl;
+        return 1;
+    }
+    return 0;
+}
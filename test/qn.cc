@@ -188,7 +188,7 @@ int main( int argc, char* argv[] )
 		 << " -l <siml>   Sets the length of the simulation, in time units (def 1e6)" << endl
 		 << " -t <trlen>  Length of the transient period (def 0)" << endl
 		 << " -D          Turns on lots of debugging messages (def off)" << endl
-		 << " -S          Sqs type (0 = Doubly linked List, 1 = Priority Queue)" << endl
+		 << " -S          Sqs type (0 = Doubly linked List, 1 = Priority Queue, 2 = Calendar Queue, 3 = 4-ary Heap, 4 = Ladder Queue, 5 = Timing Wheel)" << endl
 		 << " -h          Displays this help" << endl
 		 << endl;
 	    exit( 0 );
@@ -0,0 +1,167 @@
+/****************************************************************************
+ *
+ * recycleTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * recycleTest. A single server queue is simulated with ordinary jobs
+ * and with recycled ones; the departure times must be the same, and
+ * only a few recycled jobs must actually be constructed. Some of the
+ * recycled jobs are dropped while passive, so that they are recycled
+ * in the middle of their body.
+ */
+#include <iostream>
+#include <vector>
+#include <list>
+#include <cmath>
+#include "cppsim.hh"
+
+const int numJobs = 10000;
+
+vector<double>  interTime;      // Interarrival times
+vector<double>  servTime;       // Service times
+vector<double>  departure;      // Departure time of each job
+list<handle_p>  queue;          // Jobs waiting for service
+handle_p        srv;            // The server
+int             constructed = 0;
+
+class job : public process {
+public:
+    job( int n ) : process( "job" ), _n( n ) { };
+protected:
+    void inner_body( void ) {
+        queue.push_back( this );
+        if ( srv->idle( ) )
+            srv->activateAfter( current( ) );
+        passivate( );
+        departure[ _n ] = time( );
+    };
+    int _n;
+};
+
+class rjob : public recyclable<rjob> {
+public:
+    rjob( int n ) : recyclable<rjob>( "rjob" ), _n( n ) { constructed++; };
+    void reinit( int n ) { _n = n; };
+protected:
+    void inner_body( void ) {
+        queue.push_back( this );
+        if ( srv->idle( ) )
+            srv->activateAfter( current( ) );
+        passivate( );
+        departure[ _n ] = time( );
+    };
+    int _n;
+};
+
+// Passivates forever, and is then dropped
+class sleeper : public recyclable<sleeper> {
+public:
+    sleeper( void ) : recyclable<sleeper>( "sleeper" ) { constructed++; };
+    void reinit( void ) { };
+protected:
+    void inner_body( void ) {
+        passivate( );
+    };
+};
+
+class server : public process {
+public:
+    server( void ) : process( "server" ) { };
+protected:
+    void inner_body( void ) {
+        for ( int n=0; ; n++ ) {
+            while ( queue.empty( ) )
+                passivate( );
+            handle_p j( queue.front( ) );
+            queue.pop_front( );
+            hold( servTime[ n ] );
+            j->activateAfter( current( ) );
+        }
+    };
+};
+
+class source : public process {
+public:
+    source( bool recycle ) : process( "source" ), _recycle( recycle ) { };
+protected:
+    void inner_body( void ) {
+        for ( int n=0; n<numJobs; n++ ) {
+            hold( interTime[ n ] );
+            handle_p j;
+            if ( _recycle ) {
+                j = rjob::create( n );
+                handle_p s( sleeper::create( ) );
+                s->activateAfter( current( ) );
+            } else
+                j = new job( n );
+            j->activateAfter( current( ) );
+        }
+        hold( 1.0e9 );
+        end_simulation( );
+    };
+    bool _recycle;
+};
+
+vector<double> run( bool recycle )
+{
+    departure.assign( numJobs, -1.0 );
+    simulation::instance()->begin_simulation( new sqsDll( ) );
+    srv = new server( );
+    handle_p src( new source( recycle ) );
+    src->activate( );
+    simulation::instance()->run();
+    simulation::instance()->end_simulation();
+    srv = 0;
+    queue.clear( );
+    return departure;
+}
+
+int main( void )
+{
+    // Whole times, which the integer time takes as well
+    rngExp arr( "Interarrival", 1000.0 );
+    rngExp svc( "Service", 900.0 );
+    for ( int n=0; n<numJobs; n++ ) {
+        interTime.push_back( floor( arr.value( ) ) );
+        servTime.push_back( floor( svc.value( ) ) );
+    }
+
+    vector<double> plain( run( false ) );
+    vector<double> recycled( run( true ) );
+
+    for ( int n=0; n<numJobs; n++ ) {
+        if ( plain[ n ] < 0.0 || plain[ n ] != recycled[ n ] ) {
+            cerr << "Job " << n << " departed at " << plain[ n ]
+                 << " (new) and " << recycled[ n ] << " (recycled)"
+                 << endl;
+            return 1;
+        }
+    }
+    cout << constructed << " jobs constructed, "
+         << rjob::available( ) + sleeper::available( )
+         << " in the free lists" << endl;
+    if ( constructed > numJobs / 10 ) {
+        cerr << "Too many jobs constructed" << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,141 @@
+/****************************************************************************
+ *
+ * rescheduleTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * rescheduleTest. Workers hold, reactivate each other and passivate
+ * on every sequencing set. After a warm-up period, the simulation
+ * must not allocate any memory, since the event notices are part of
+ * the processes. The notices of the workers must always be their
+ * own.
+ */
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <new>
+#include "cppsim.hh"
+#include "testutil.hh"
+
+const int numWorkers = 200;
+const double warmUp = 5000.0;
+const double simLen = 10000.0;
+
+unsigned long allocations = 0;
+vector<handle_p> workers;
+
+void* operator new( size_t n )
+{
+    allocations++;
+    void* p = malloc( n > 0 ? n : 1 );
+    if ( 0 == p )
+        throw bad_alloc( );
+    return p;
+}
+
+void operator delete( void* p ) noexcept
+{
+    free( p );
+}
+
+void operator delete( void* p, size_t ) noexcept
+{
+    free( p );
+}
+
+class worker : public process {
+public:
+    worker( void ) : process( "worker" ) { };
+protected:
+    void inner_body( void ) {
+        while ( 1 ) {
+            if ( notice( ) != getSqs( )->first( ) ||
+                 notice( )->proc( ) != this )
+                errors++;
+            handle_p& other( workers[ rnd( numWorkers ) ] );
+            switch ( rnd( 8 ) ) {
+            case 0:
+                if ( other.rep( ) != this )
+                    other->reactivateDelay( rnd( 20 ) );
+                break;
+            case 1:
+                if ( other->idle( ) )
+                    other->activateDelay( rnd( 20 ) );
+                break;
+            case 2:
+                if ( getSqs( )->size( ) > numWorkers / 2 ) {
+                    passivate( );
+                    continue;
+                }
+                break;
+            default:
+                break;
+            }
+            hold( rnd( 100 ) );
+        }
+    };
+};
+
+class driver : public process {
+public:
+    driver( void ) : process( "driver" ) { };
+protected:
+    void inner_body( void ) {
+        for ( int n=0; n<numWorkers; n++ ) {
+            workers.push_back( new worker( ) );
+            workers[ n ]->activateAt( rnd( 100 ) );
+        }
+        hold( warmUp );
+        unsigned long before = allocations;
+        unsigned long events = getSqs( )->processed( );
+        hold( simLen );
+        events = getSqs( )->processed( ) - events;
+        cout << events << " events, "
+             << allocations - before << " allocations" << endl;
+        if ( allocations != before ) {
+            cerr << "The event loop allocates memory" << endl;
+            errors++;
+        }
+        end_simulation( );
+    };
+};
+
+int main( void )
+{
+    sched_t types[] = { SQSDLL, SQSPRIO, SQSCAL, SQSHEAP, SQSLADDER, SQSWHEEL, SQSADAPTIVE };
+    for ( unsigned int i=0; i<sizeof( types ) / sizeof( types[0] ); i++ ) {
+        seed = 1;
+        // The adaptive sqs starts on the backend it settles on, as a
+        // switch allocates the new backend, which then grows
+        sqs* s = ( SQSADAPTIVE == types[ i ] ? new sqsAdaptive( SQSCAL ) :
+                   makeSqs( types[ i ] ) );
+        simulation::instance()->begin_simulation( s );
+        handle_p d( new driver( ) );
+        d->activate( );
+        simulation::instance()->run();
+        simulation::instance()->end_simulation();
+        d = 0;
+        workers.clear( );
+        if ( !noneAlive( ) )
+            errors++;
+    }
+    return ( errors > 0 );
+}
@@ -0,0 +1,115 @@
+/****************************************************************************
+ *
+ * sharedstackTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * sharedstackTest. A large number of jobs run on the shared stack.
+ * Each job fills some stack frames with known values, passivates at
+ * the bottom of the recursion, and checks the values once it is
+ * reactivated. The test is done with and without direct transfer of
+ * control, as the stack is saved and restored on different paths.
+ * The memory used for the saved stacks must be much smaller than one
+ * stack per job.
+ */
+#include <iostream>
+#include <vector>
+#include "cppsim.hh"
+#include "stackPool.hh"
+
+const int numJobs = 20000;
+
+int errors = 0;
+int completed = 0;
+vector<handle_p> jobs;
+
+class job : public process {
+public:
+    job( int n ) : process( "job" ), _n( n ) { };
+protected:
+    void fill( int depth ) {
+        volatile int buf[ 32 ];
+        for ( int i=0; i<32; i++ )
+            buf[ i ] = _n * 64 + depth + i;
+        if ( depth > 0 )
+            fill( depth-1 );
+        else
+            passivate( );
+        for ( int i=0; i<32; i++ )
+            if ( buf[ i ] != _n * 64 + depth + i )
+                errors++;
+    };
+    void inner_body( void ) {
+        fill( _n % 16 );
+        completed++;
+    };
+    int _n;
+};
+
+class source : public process {
+public:
+    source( void ) : process( "source" ) { };
+protected:
+    void inner_body( void ) {
+        for ( int n=0; n<numJobs; n++ ) {
+            handle_p j( new job( n ) );
+            j->activateAfter( current( ) );
+            jobs.push_back( j );
+        }
+        hold( 1.0 );
+        for ( int n=numJobs-1; n>=0; n-- )
+            jobs[ n ]->activateAfter( current( ) );
+        hold( 1.0 );
+        end_simulation( );
+    };
+};
+
+int main( void )
+{
+    // With stack copying, all the coroutines run on the process stack
+    if ( string( "sjlj_copy" ) == coroutine::method( ) )
+        return 77;
+
+    coroutine::cSharedStack = true;
+    for ( int direct=0; direct<2; direct++ ) {
+        completed = 0;
+        sqs* s = new sqsDll( );
+        s->setDirectTransfer( direct );
+        simulation::instance()->begin_simulation( s );
+        handle_p src( new source( ) );
+        src->activate( );
+        simulation::instance()->run();
+        simulation::instance()->end_simulation();
+
+        stackPool::instance( )->report( );
+        if ( errors > 0 || completed != numJobs ) {
+            cerr << "Direct transfer " << direct << ": " << errors
+                 << " errors, " << completed << " jobs completed" << endl;
+            return 1;
+        }
+        if ( stackPool::instance( )->bufferBytes( ) > numJobs * coroutine::cStackSize / 8 ) {
+            cerr << "Too much memory for the saved stacks" << endl;
+            return 1;
+        }
+        jobs.clear( );
+    }
+    return 0;
+}
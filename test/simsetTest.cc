@@ -0,0 +1,269 @@
+/****************************************************************************
+ *
+ * simsetTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * simsetTest. Processes are put in sets (see simset.hh) in FIFO, LIFO
+ * and ranked order, moved with precede( ), follow( ) and into( ), and
+ * taken out; the order of the sets is checked against the expected
+ * one, and the processes must stay alive while they are in a set, and
+ * only then. Then a queueing model keeps its waiting jobs in a
+ * std::list of handles and in a set; the two must give the same
+ * results, and the time per enqueue and dequeue of each is printed.
+ */
+#include <iostream>
+#include <vector>
+#include <list>
+#include <cmath>
+#include "cppsim.hh"
+#include "testutil.hh"
+
+class item : public process {
+public:
+    item( int n, int rank = 0 ) : process( "item" ), _n( n ), _rank( rank ) { };
+    int n( void ) const { return _n; };
+    int rank( void ) const { return _rank; };
+protected:
+    void inner_body( void ) { };
+    int _n;
+    int _rank;
+};
+
+bool byRank( const simset::link* a, const simset::link* b )
+{
+    return static_cast< const item* >( a )->rank( ) < static_cast< const item* >( b )->rank( );
+}
+
+//
+// The numbers of the members of s, from the first to the last; the
+// walk backwards must give the same ones
+//
+vector< int > members( const simset::head& s )
+{
+    vector< int > result;
+    for ( simset::link* l = s.first( ); 0 != l; l = l->suc( ) )
+        result.push_back( static_cast< item* >( l )->n( ) );
+    vector< int > backwards;
+    for ( simset::link* l = s.last( ); 0 != l; l = l->pred( ) )
+        backwards.insert( backwards.begin( ), static_cast< item* >( l )->n( ) );
+    check( result == backwards, "walk backwards" );
+    check( result.size( ) == s.cardinal( ), "cardinal" );
+    return result;
+}
+
+void testOrders( void )
+{
+    const int ranks[] = { 3, 1, 2, 1, 3, 0, 2 };
+    const int n = sizeof( ranks ) / sizeof( ranks[0] );
+    simset::head f, l( simset::lifo ), r( byRank );
+    for ( int i=0; i<n; i++ ) {
+        // The items are only held by the sets
+        ( new item( i, ranks[ i ] ) )->into( f );
+        ( new item( i, ranks[ i ] ) )->into( l );
+        ( new item( i, ranks[ i ] ) )->into( r );
+    }
+    check( process::live( ) == 3 * n, "items held by the sets" );
+    check( members( f ) == vector< int >( { 0, 1, 2, 3, 4, 5, 6 } ), "fifo order" );
+    check( members( l ) == vector< int >( { 6, 5, 4, 3, 2, 1, 0 } ), "lifo order" );
+    check( members( r ) == vector< int >( { 5, 1, 3, 2, 6, 0, 4 } ), "ranked order" );
+
+    simset::link* a = f.first( );
+    simset::link* b = a->suc( )->suc( );
+    a->follow( b );
+    check( members( f ) == vector< int >( { 1, 2, 0, 3, 4, 5, 6 } ), "follow" );
+    b = f.last( );
+    b->precede( f.first( ) );
+    check( members( f ) == vector< int >( { 6, 1, 2, 0, 3, 4, 5 } ), "precede" );
+    b->follow( b );
+    check( members( f ) == vector< int >( { 6, 1, 2, 0, 3, 4, 5 } ), "follow itself" );
+
+    // Moves the first one of f to l
+    a = f.first( );
+    a->into( l );
+    check( a->set( ) == &l && 6 == f.cardinal( ) && 8 == l.cardinal( ), "into another set" );
+    check( l.first( ) == a, "into a lifo set" );
+    check( process::live( ) == 3 * n, "items moved" );
+
+    {
+        handle< item > h( static_cast< item* >( f.first( ) ) );
+        h->out( );
+        check( 0 == h->set( ) && 0 == h->suc( ) && 0 == h->pred( ), "out" );
+        check( process::live( ) == 3 * n, "item held by a handle" );
+        h->out( );
+        h->follow( 0 );
+    }
+    check( process::live( ) == 3 * n - 1, "item released" );
+    f.last( )->out( );
+    check( process::live( ) == 3 * n - 2, "item released by out( )" );
+
+    f.clear( );
+    check( f.empty( ) && 0 == f.cardinal( ) && 0 == f.first( ) && 0 == f.last( ), "clear" );
+    check( process::live( ) == 2 * n + 1, "items released by clear( )" );
+}
+
+//
+// An M/M/1 queue, whose waiting jobs are in a std::list of handles,
+// or in a set
+//
+bool useSet;
+double totalWait;
+unsigned long served;
+const int numJobs = 300000;
+
+class job;
+
+class server : public process {
+public:
+    server( void ) : process( "server" ) { };
+    list< handle<job> > queue;
+    simset::head set;
+    handle< job > serving;
+protected:
+    void inner_body( void );
+};
+
+handle< server > srv;
+
+class job : public recyclable< job > {
+public:
+    job( const string& name ) : recyclable< job >( name ), _arrival( time( ) ) { };
+    void reinit( const string& ) { _arrival = time( ); };
+    double _arrival;
+protected:
+    void inner_body( void ) {
+        if ( useSet )
+            into( srv->set );
+        else
+            srv->queue.push_back( this );
+        if ( srv->idle( ) )
+            srv->activateAfter( current( ) );
+        passivate( );
+    };
+};
+
+void server::inner_body( void )
+{
+    while ( 1 ) {
+        while ( queue.empty( ) && set.empty( ) )
+            passivate( );
+        if ( useSet ) {
+            serving = static_cast< job* >( set.first( ) );
+            serving->out( );
+        } else {
+            serving = queue.front( );
+            queue.pop_front( );
+        }
+        totalWait += time( ) - serving->_arrival;
+        served++;
+        hold( floor( -900.0 * log( uniform( ) ) ) );
+        serving->activate( );
+    }
+}
+
+class arrivals : public process {
+public:
+    arrivals( void ) : process( "arrivals" ) { };
+protected:
+    void inner_body( void ) {
+        for ( int i=0; i<numJobs; i++ ) {
+            hold( floor( -1000.0 * log( uniform( ) ) ) );
+            handle< job > j( job::create( "job" ) );
+            j->activate( );
+        }
+        end_simulation( );
+    };
+};
+
+double queueModel( bool set )
+{
+    useSet = set;
+    seed = 11;
+    totalWait = 0.0;
+    served = 0;
+    simulation::instance( )->begin_simulation( makeSqs( SQSHEAP ) );
+    srv = new server( );
+    handle_p a( new arrivals( ) );
+    a->activate( );
+    double start = wallTime( );
+    simulation::instance( )->run( );
+    double elapsed = wallTime( ) - start;
+    simulation::instance( )->end_simulation( );
+    srv->queue.clear( );
+    srv->set.clear( );
+    srv->serving = 0;
+    srv = 0;
+    a = 0;
+    cout << ( set ? "set" : "std::list" ) << ": mean wait " << totalWait / served
+         << ", " << 1e9 * elapsed / served << " ns per job" << endl;
+    return totalWait / served;
+}
+
+//
+// Time per into( ) and out( ), and per push_back( ) and pop_front( )
+// of a std::list of handles
+//
+void bench( void )
+{
+    const int numItems = 1000;
+    const int numRounds = 2000;
+    vector< handle< item > > items;
+    for ( int i=0; i<numItems; i++ )
+        items.push_back( new item( i ) );
+
+    simset::head s;
+    double start = wallTime( );
+    for ( int r=0; r<numRounds; r++ ) {
+        for ( int i=0; i<numItems; i++ )
+            items[ i ]->into( s );
+        while ( !s.empty( ) )
+            s.first( )->out( );
+    }
+    double setTime = wallTime( ) - start;
+
+    list< handle< item > > l;
+    start = wallTime( );
+    for ( int r=0; r<numRounds; r++ ) {
+        for ( int i=0; i<numItems; i++ )
+            l.push_back( items[ i ] );
+        while ( !l.empty( ) )
+            l.pop_front( );
+    }
+    double listTime = wallTime( ) - start;
+    cout << "enqueue and dequeue: " << 1e9 * setTime / numItems / numRounds
+         << " ns with a set, " << 1e9 * listTime / numItems / numRounds
+         << " ns with a std::list" << endl;
+}
+
+int main( void )
+{
+    simulation::instance( )->begin_simulation( makeSqs( SQSDLL ) );
+    testOrders( );
+    check( 0 == process::live( ), "items released by the sets" );
+    bench( );
+    simulation::instance( )->end_simulation( );
+
+    check( queueModel( false ) == queueModel( true ), "same results with a set" );
+    job::trim( );
+    if ( !noneAlive( ) )
+        errors++;
+    return ( errors > 0 );
+}
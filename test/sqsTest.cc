@@ -0,0 +1,229 @@
+/****************************************************************************
+ *
+ * sqsTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+
+/*
+ * sqsTest. A set of workers schedule, reschedule and cancel each
+ * other at random, with many events at the same times, using all the
+ * positioning operations (at a time, before and after a process). The
+ * workers draw their random numbers from a private generator, so the
+ * sequence of events must be the same with all the sequencing sets.
+ * Then the sequencing sets are filled with many notices, with both
+ * ties and widely spread times, and the notices are removed from the
+ * front and at random: the order of removal must be the same again.
+ * The timing wheel only takes whole times, so the bulk test is also
+ * run with the times rounded down, and spread over a wider range.
+ */
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "cppsim.hh"
+#include "testutil.hh"
+
+const int numWorkers = 50;
+const double simLen = 2000.0;
+
+vector<handle_p> workers;
+vector<int> trace;              // Ids of the workers, in order of execution
+
+class worker : public process {
+public:
+    worker( int n ) : process( "worker" ), _n( n ) { };
+protected:
+    void inner_body( void ) {
+        while ( 1 ) {
+            trace.push_back( _n );
+            handle_p other( workers[ rnd( numWorkers ) ] );
+            handle_p q( workers[ rnd( numWorkers ) ] );
+            if ( q->idle( ) )
+                q = current( );
+            switch ( rnd( 9 ) ) {
+            case 0:
+                if ( other->idle( ) )
+                    other->activateBefore( q );
+                break;
+            case 1:
+                if ( other->idle( ) )
+                    other->activateAfter( q );
+                break;
+            case 2:
+                if ( other->idle( ) )
+                    other->activateAt( time( ) + rnd( 3 ) );
+                break;
+            case 3:
+                if ( other.rep( ) != this && other.rep( ) != q.rep( ) )
+                    other->reactivateBefore( q );
+                break;
+            case 4:
+                if ( other.rep( ) != this && other.rep( ) != q.rep( ) )
+                    other->reactivateAfter( q );
+                break;
+            case 5:
+                if ( other.rep( ) != this )
+                    other->cancel( );
+                break;
+            case 6:
+                if ( getSqs( )->size( ) > 2 ) {
+                    passivate( );
+                    continue;
+                }
+                break;
+            default:
+                break;
+            }
+            hold( rnd( 3 ) );
+        }
+    };
+    int _n;
+};
+
+class driver : public process {
+public:
+    driver( void ) : process( "driver" ) { };
+protected:
+    void inner_body( void ) {
+        for ( int n=0; n<numWorkers; n++ ) {
+            handle_p w( new worker( n ) );
+            workers.push_back( w );
+            w->activateAt( rnd( 3 ) );
+        }
+        hold( simLen );
+        end_simulation( );
+    };
+};
+
+class dummy : public process {
+public:
+    dummy( int n ) : process( "dummy" ), _n( n ) { };
+    int _n;
+protected:
+    void inner_body( void ) { };
+};
+
+const int numBulk = 20000;
+
+double delay( bool ticks )
+{
+    double u = ( rnd( 1 << 30 ) + 0.5 ) / ( 1 << 30 );
+    switch ( rnd( 4 ) ) {
+    case 0:
+        return 0.0;
+    case 1:
+        return rnd( 5 );
+    case 2:
+        return ( ticks ? floor( -10.0 * log( u ) ) : -10.0 * log( u ) );
+    default:
+        return ( ticks ? floor( 1e9 * u * u * u * u ) : 1000.0 * u * u * u * u );
+    }
+}
+
+vector<int> bulk( sched_t type, bool ticks )
+{
+    seed = 7;
+    trace.clear( );
+    sqs* s = makeSqs( type );
+    simulation::instance()->begin_simulation( s );
+    vector<handle_p> d;
+    vector<absEvNotice*> ev( numBulk, (absEvNotice*)0 );
+    for ( int n=0; n<numBulk; n++ ) {
+        d.push_back( new dummy( n ) );
+        ev[ n ] = s->insertAt( d[ n ], delay( ticks ) );
+    }
+    double now = 0.0;
+    for ( int step=0; step<20*numBulk || !s->empty( ); step++ ) {
+        unsigned int r = rnd( 10 );
+        int k = rnd( numBulk );
+        if ( r < 5 && step < 20*numBulk ) {
+            if ( 0 == ev[ k ] )
+                ev[ k ] = s->insertAt( d[ k ], now + delay( ticks ) );
+        } else if ( s->empty( ) ) {
+            continue;
+        } else if ( r < 9 || 0 == ev[ k ] ) {
+            absEvNotice* e = s->first( );
+            now = e->evTime( );
+            k = dynamic_cast<dummy*>( e->proc( ) )->_n;
+            trace.push_back( k );
+            s->remove( e );
+            ev[ k ] = 0;
+        } else {
+            s->remove( ev[ k ] );
+            ev[ k ] = 0;
+        }
+    }
+    s->report( );
+    simulation::instance()->end_simulation();
+    return trace;
+}
+
+vector<int> run( sched_t s )
+{
+    seed = 1;
+    trace.clear( );
+    simulation::instance()->begin_simulation( makeSqs( s ) );
+    handle_p d( new driver( ) );
+    d->activate( );
+    simulation::instance()->run();
+    simulation::instance()->getSqs( )->report( );
+    simulation::instance()->end_simulation();
+    workers.clear( );
+    return trace;
+}
+
+int main( void )
+{
+    vector<int> ref( run( SQSDLL ) );
+    cout << ref.size( ) << " events" << endl;
+
+    sched_t types[] = { SQSPRIO, SQSCAL, SQSHEAP, SQSLADDER, SQSWHEEL, SQSADAPTIVE };
+    for ( unsigned int i=0; i<sizeof( types ) / sizeof( types[0] ); i++ ) {
+        vector<int> t( run( types[ i ] ) );
+        if ( t != ref ) {
+            unsigned int n = 0;
+            while ( n < t.size( ) && n < ref.size( ) && t[ n ] == ref[ n ] )
+                n++;
+            cerr << "SQS type " << types[ i ] << " differs at event " << n << endl;
+            return 1;
+        }
+    }
+
+    // The linear list is too slow for this
+    sched_t bulkTypes[] = { SQSPRIO, SQSCAL, SQSLADDER, SQSWHEEL, SQSADAPTIVE };
+    for ( int ticks=0; ticks<2; ticks++ ) {
+        ref = bulk( SQSHEAP, ticks );
+        cout << ref.size( ) << " notices removed from the front" << endl;
+        for ( unsigned int i=0; i<sizeof( bulkTypes ) / sizeof( bulkTypes[0] ); i++ ) {
+            if ( SQSWHEEL == bulkTypes[ i ] && !ticks )
+                continue;
+            vector<int> t( bulk( bulkTypes[ i ], ticks ) );
+            if ( t != ref ) {
+                unsigned int n = 0;
+                while ( n < t.size( ) && n < ref.size( ) && t[ n ] == ref[ n ] )
+                    n++;
+                cerr << "SQS type " << bulkTypes[ i ] << " differs at notice " << n
+                     << " of the bulk test" << endl;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,153 @@
+/****************************************************************************
+ *
+ * sqsbench.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+
+/*
+ * sqsbench. Measures the cost of the operations of the sequencing
+ * sets with the classic "hold" model: the sequencing set is filled
+ * with n notices, then the first notice is repeatedly removed and a
+ * new one is inserted at its time plus a random increment. The
+ * increments are drawn from an exponential distribution, and from a
+ * skewed (bimodal) one, in which 90% of the increments are small and
+ * the others are a thousand times larger. The third distribution is
+ * an exponential one rounded down to whole ticks, with a mean of 100;
+ * the timing wheel, which only takes whole times, is only measured
+ * with it.
+ *
+ * Usage: sqsbench [-n <num. of holds>] [-s <max. size>]
+ */
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include "cppsim.hh"
+#include "testutil.hh"
+
+extern "C" {
+#include <getopt.h>
+}
+
+using namespace std;
+
+long numHolds = 1000000;
+long maxSize = 1000000;
+const long maxDllSize = 10000;  // The linear list is too slow beyond this
+
+static double expIncrement( void )
+{
+    return -log( uniform( ) );
+}
+
+static double skewedIncrement( void )
+{
+    double scale = ( uniform( ) < 0.9 ? 0.1 : 100.0 );
+    return -scale * log( uniform( ) );
+}
+
+static double tickIncrement( void )
+{
+    return floor( -100.0 * log( uniform( ) ) );
+}
+
+class dummy : public process {
+public:
+    dummy( void ) : process( "dummy" ) { };
+protected:
+    void inner_body( void ) { };
+};
+
+//
+// Returns the time of a hold operation (the first notice is moved to
+// a later time), in nanoseconds
+//
+double hold( sched_t type, long size, double (*increment)( void ) )
+{
+    seed = 1;
+    sqs* s = makeSqs( type );
+    simulation::instance()->begin_simulation( s );
+    vector<handle_p> procs;
+    for ( long i=0; i<size; i++ ) {
+        procs.push_back( new dummy( ) );
+        s->insertAt( procs[ i ], increment( ) );
+    }
+
+    double t0 = wallTime( );
+    for ( long i=0; i<numHolds; i++ ) {
+        absEvNotice* ev = s->first( );
+        s->reschedule( ev, ev->evTime( ) + increment( ) );
+    }
+    double elapsed = wallTime( ) - t0;
+
+    s->clear( );
+    simulation::instance()->end_simulation();
+    return 1e9 * elapsed / numHolds;
+}
+
+int main( int argc, char* argv[] )
+{
+    int opt;
+    while ( -1 != ( opt = getopt( argc, argv, "n:s:h" ) ) ) {
+        switch ( opt ) {
+        case 'n':
+            numHolds = atol( optarg );
+            break;
+        case 's':
+            maxSize = atol( optarg );
+            break;
+        default:
+            cout << "Usage: " << argv[0] << " [-n <num. of holds>] [-s <max. size>]" << endl;
+            exit( 0 );
+        }
+    }
+
+    const sched_t types[] = { SQSDLL, SQSPRIO, SQSCAL, SQSHEAP, SQSLADDER, SQSWHEEL, SQSADAPTIVE };
+    const char* names[] = { "dll", "prio", "cal", "heap", "ladder", "wheel", "adaptive" };
+    const int numTypes = sizeof( types ) / sizeof( types[0] );
+    double (*increments[])( void ) = { expIncrement, skewedIncrement, tickIncrement };
+    const char* distNames[] = { "exponential", "skewed", "whole tick" };
+
+    for ( int dist=0; dist<3; dist++ ) {
+        cout << endl
+             << "Hold time (ns), " << distNames[ dist ]
+             << " increments" << endl
+             << setw( 10 ) << "size";
+        for ( int i=0; i<numTypes; i++ )
+            cout << setw( 10 ) << names[ i ];
+        cout << endl;
+        for ( long size=100; size<=maxSize; size*=10 ) {
+            cout << setw( 10 ) << size;
+            for ( int i=0; i<numTypes; i++ ) {
+                if ( ( SQSDLL == types[ i ] && size > maxDllSize ) ||
+                     ( SQSWHEEL == types[ i ] && tickIncrement != increments[ dist ] ) ) {
+                    cout << setw( 10 ) << "-";
+                    continue;
+                }
+                double ns = hold( types[ i ], size, increments[ dist ] );
+                cout << setw( 10 ) << fixed << setprecision( 1 ) << ns << flush;
+            }
+            cout << endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,89 @@
+/****************************************************************************
+ *
+ * stackpoolTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * stackpoolTest. A source creates a large number of short-lived jobs,
+ * at most a few of them being alive at the same time. Stacks of
+ * terminated jobs must be recycled, so that the number of stacks
+ * actually mapped stays small.
+ */
+#include <iostream>
+#include "cppsim.hh"
+#include "stackPool.hh"
+
+const int numJobs = 100000;
+
+class job : public process {
+public:
+    job( const string& name ) :
+        process( name )
+    { };
+protected:
+    void inner_body( void ) {
+        hold( 5 );
+    };
+};
+
+class source : public process {
+public:
+    source( const string& name ) :
+        process( name )
+    { };
+protected:
+    void inner_body( void ) {
+        for ( int i=0; i<numJobs; i++ ) {
+            handle<job> j( new job( "job" ) );
+            j->activateAfter( current() );
+            hold( 2 );
+        }
+        end_simulation( );
+    };
+};
+
+int main( void )
+{
+    stackPool* pool = stackPool::instance( );
+
+    // With stack copying, all the coroutines run on the process stack
+    if ( string( "sjlj_copy" ) == coroutine::method( ) )
+        return 77;
+
+    simulation::instance()->begin_simulation( new sqsDll() );
+    handle<source> src = new source( "source" );
+    src->activate();
+    simulation::instance()->run();
+    simulation::instance()->end_simulation();
+
+    pool->report( );
+
+    // Only a handful of jobs are alive at any time
+    if ( pool->misses( ) > 10 ) {
+        cerr << "Too many stacks mapped: " << pool->misses( ) << endl;
+        return 1;
+    }
+    if ( pool->hits( ) < numJobs - 10 ) {
+        cerr << "Too few stacks recycled: " << pool->hits( ) << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,102 @@
+/****************************************************************************
+ *
+ * stackusageTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * stackusageTest. Two kinds of processes are run with stack painting
+ * enabled: "deep" ones, which use more than 16KB of stack, and
+ * "shallow" ones, which run on a small stack of their own. The
+ * high-water marks reported for the two classes must reflect that.
+ */
+#include <iostream>
+#include "cppsim.hh"
+
+const size_t deepBytes = 16*1024;
+const size_t shallowStack = 16*1024;
+volatile int sink = 0;
+
+class deep : public process {
+public:
+    deep( const string& name ) : process( name, 4*deepBytes ) { };
+protected:
+    void inner_body( void ) {
+        volatile char buf[ deepBytes ];
+        for ( size_t i=0; i<deepBytes; i++ )
+            buf[ i ] = 0;
+        hold( 1.0 );
+        for ( size_t i=0; i<deepBytes; i++ )
+            sink = sink + buf[ i ];
+    };
+};
+
+class shallow : public process {
+public:
+    shallow( const string& name ) : process( name, shallowStack ) { };
+protected:
+    void inner_body( void ) {
+        hold( 1.0 );
+    };
+};
+
+class source : public process {
+public:
+    source( const string& name ) : process( name ) { };
+protected:
+    void inner_body( void ) {
+        for ( int i=0; i<10; i++ ) {
+            handle_p d( new deep( "deep" ) );
+            d->activateAfter( current( ) );
+            handle_p s( new shallow( "shallow" ) );
+            s->activateAfter( current( ) );
+            hold( 1.0 );
+        }
+        end_simulation( );
+    };
+};
+
+int main( void )
+{
+    // With stack copying, all the coroutines run on the process stack
+    if ( string( "sjlj_copy" ) == coroutine::method( ) )
+        return 77;
+
+    coroutine::cStackPaint = true;
+    simulation::instance()->begin_simulation( new sqsDll() );
+    handle_p src( new source( "source" ) );
+    src->activate();
+    simulation::instance()->run();
+    simulation::instance()->end_simulation();
+
+    coroutine::stackReport( );
+
+    size_t d = coroutine::maxStackUsed( typeid( deep ) );
+    size_t s = coroutine::maxStackUsed( typeid( shallow ) );
+    if ( d < deepBytes || d > 4*deepBytes ) {
+        cerr << "Wrong stack usage for deep: " << d << endl;
+        return 1;
+    }
+    if ( 0 == s || s >= shallowStack / 2 ) {
+        cerr << "Wrong stack usage for shallow: " << s << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,122 @@
+/****************************************************************************
+ *
+ * streamTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * streamTest. The streams and substreams of rngUniform01 must start
+ * where those of the RngStreams package do: the first values of the
+ * first stream, and the states at the start of the second stream and
+ * of the second substream, are compared with values computed
+ * independently. advanceState( n ) must give the same state as n
+ * draws, and the replications made with reset( ) must be reproducible
+ * after resetStartStream( ). Finally, the time to create a stream is
+ * printed.
+ */
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "rng.hh"
+#include "testutil.hh"
+
+bool sameState( const rngUniform01& u, const unsigned long expected[6] )
+{
+    unsigned long s[6];
+    u.getState( s );
+    for ( int i=0; i<6; i++ )
+        if ( s[i] != expected[i] )
+            return false;
+    return true;
+}
+
+bool sameState( const rngUniform01& u, const rngUniform01& v )
+{
+    unsigned long s[6];
+    v.getState( s );
+    return sameState( u, s );
+}
+
+int main( void )
+{
+    const unsigned long seed[6] = { 12345, 12345, 12345, 12345, 12345, 12345 };
+    const unsigned long stream2[6] = { 3692455944UL, 1366884236UL, 2968912127UL,
+                                       335948734UL, 4161675175UL, 475798818UL };
+    const unsigned long substream2[6] = { 870504860UL, 2641697727UL, 884013853UL,
+                                          339352413UL, 2374306706UL, 3651603887UL };
+    const unsigned long stream3substream3[6] = { 802748689UL, 1551999339UL, 3830145690UL,
+                                                 2695126791UL, 2062663228UL, 1507780846UL };
+    const double first[3] = { 0.1270111220465771, 0.3185275653967945, 0.3091860155832701 };
+
+    rngUniform01 u( "u" ), v( "v" ), w( "w" );
+    check( sameState( u, seed ), "start of the first stream" );
+    check( sameState( v, stream2 ), "start of the second stream" );
+    for ( int i=0; i<3; i++ )
+        check( fabs( u.value( ) - first[ i ] ) < 1e-15, "first values of the first stream" );
+    u.resetNextSubstream( );
+    check( sameState( u, substream2 ), "start of the second substream" );
+    w.reset( );
+    w.reset( );
+    check( sameState( w, stream3substream3 ), "start of the third substream of the third stream" );
+
+    // Jump-ahead against the draws
+    const unsigned long long jumps[] = { 0, 1, 2, 7, 1000, 123457, 1000000 };
+    for ( size_t j=0; j<sizeof( jumps ) / sizeof( jumps[0] ); j++ ) {
+        rngUniform01 a( "a" );
+        vector< double > ahead;
+        for ( unsigned long long i=0; i<jumps[ j ]; i++ )
+            a.value( );
+        for ( int i=0; i<5; i++ )
+            ahead.push_back( a.value( ) );
+        a.resetStartStream( );
+        a.advanceState( jumps[ j ] );
+        for ( int i=0; i<5; i++ )
+            check( a.value( ) == ahead[ i ], "advanceState( ) against the draws" );
+    }
+
+    // Replications
+    vector< double > runs;
+    for ( int r=0; r<3; r++ ) {
+        if ( r > 0 )
+            v.reset( );
+        for ( int i=0; i<100; i++ )
+            runs.push_back( v.value( ) );
+    }
+    v.resetStartStream( );
+    for ( int r=0; r<3; r++ ) {
+        if ( r > 0 )
+            v.reset( );
+        for ( int i=0; i<100; i++ )
+            check( v.value( ) == runs[ r * 100 + i ], "reproducible replications" );
+    }
+    v.resetStartSubstream( );
+    check( v.value( ) == runs[ 200 ], "start of the substream" );
+
+    // Time to create a stream
+    const int numStreams = 100000;
+    double start = wallTime( );
+    for ( int i=0; i<numStreams; i++ ) {
+        rngUniform01 s( "s" );
+        s.value( );
+    }
+    cout << 1e9 * ( wallTime( ) - start ) / numStreams << " ns per stream" << endl;
+
+    return ( errors > 0 );
+}
@@ -0,0 +1,80 @@
+/*****************************************************************************
+ *
+ * testutil.hh -- Helpers shared by the tests and the benchmarks
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ *****************************************************************************/
+
+#ifndef CPPSIM_TESTUTIL_HH
+#define CPPSIM_TESTUTIL_HH
+
+#include <iostream>
+#include <ctime>
+#include "process.hh"
+
+//
+// A private 64-bit linear congruential generator. The tests which
+// compare runs draw from it, rather than from the generators of the
+// library, so that their sequence of events only depends on the
+// seed. Set the seed before each run.
+//
+static unsigned long long seed;
+
+// A random integer in [0, n)
+static inline unsigned int rnd( unsigned int n )
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return ( seed >> 33 ) % n;
+}
+
+// A random double in (0, 1)
+static inline double uniform( void )
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return ( ( seed >> 11 ) + 0.5 ) / 9007199254740992.0;
+}
+
+// Number of failed checks; a test returns ( errors > 0 )
+static int errors = 0;
+
+// Counts, and reports, a failed check
+static inline void check( bool cond, const char* what )
+{
+    if ( !cond ) {
+        std::cerr << "Failed: " << what << std::endl;
+        errors++;
+    }
+}
+
+// Wall clock time in seconds, for the timings
+static inline double wallTime( void )
+{
+    struct timespec t;
+    clock_gettime( CLOCK_MONOTONIC, &t );
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// Returns false, with a message, if some processes are still alive
+static inline bool noneAlive( void )
+{
+    if ( process::live( ) == 0 )
+        return true;
+    std::cerr << process::live( ) << " processes still alive" << std::endl;
+    return false;
+}
+
+#endif
@@ -0,0 +1,136 @@
+/****************************************************************************
+ *
+ * transferTest.cc
+ *
+ * This file is part of libcppsim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ ****************************************************************************/
+
+/*
+ * transferTest. A single server queue is simulated with and without
+ * direct transfer of control between processes. Both runs use the
+ * same interarrival and service times, so the departure times of all
+ * jobs, and the number of processed events, must be the same.
+ */
+#include <iostream>
+#include <vector>
+#include <list>
+#include <cmath>
+#include "cppsim.hh"
+
+const int numJobs = 10000;
+
+vector<double>  interTime;      // Interarrival times
+vector<double>  servTime;       // Service times
+vector<double>  departure;      // Departure time of each job
+list<handle_p>  queue;          // Jobs waiting for service
+handle_p        srv;            // The server
+
+class job : public process {
+public:
+    job( int n ) : process( "job" ), _n( n ) { };
+protected:
+    void inner_body( void ) {
+        queue.push_back( this );
+        if ( srv->idle( ) )
+            srv->activateAfter( current( ) );
+        passivate( );
+        departure[ _n ] = time( );
+    };
+    int _n;
+};
+
+class server : public process {
+public:
+    server( void ) : process( "server" ) { };
+protected:
+    void inner_body( void ) {
+        for ( int n=0; ; n++ ) {
+            while ( queue.empty( ) )
+                passivate( );
+            handle_p j( queue.front( ) );
+            queue.pop_front( );
+            hold( servTime[ n ] );
+            j->activateAfter( current( ) );
+        }
+    };
+};
+
+class source : public process {
+public:
+    source( void ) : process( "source" ) { };
+protected:
+    void inner_body( void ) {
+        for ( int n=0; n<numJobs; n++ ) {
+            hold( interTime[ n ] );
+            handle_p j( new job( n ) );
+            j->activateAfter( current( ) );
+        }
+        hold( 1.0e9 );
+        end_simulation( );
+    };
+};
+
+vector<double> run( bool direct, unsigned long& events )
+{
+    departure.assign( numJobs, -1.0 );
+    sqs* s = new sqsDll( );
+    s->setDirectTransfer( direct );
+    simulation::instance()->begin_simulation( s );
+    srv = new server( );
+    handle_p src( new source( ) );
+    src->activate( );
+    simulation::instance()->run();
+    events = s->processed( );
+    simulation::instance()->end_simulation();
+    srv = 0;
+    queue.clear( );
+    return departure;
+}
+
+int main( void )
+{
+    // Whole times, which the integer time takes as well
+    rngExp arr( "Interarrival", 1000.0 );
+    rngExp svc( "Service", 900.0 );
+    for ( int n=0; n<numJobs; n++ ) {
+        interTime.push_back( floor( arr.value( ) ) );
+        servTime.push_back( floor( svc.value( ) ) );
+    }
+
+    unsigned long ev1, ev2;
+    vector<double> scheduled( run( false, ev1 ) );
+    vector<double> direct( run( true, ev2 ) );
+
+    for ( int n=0; n<numJobs; n++ ) {
+        if ( scheduled[ n ] < 0.0 || scheduled[ n ] != direct[ n ] ) {
+            cerr << "Job " << n << " departed at " << scheduled[ n ]
+                 << " (scheduler) and " << direct[ n ] << " (direct)"
+                 << endl;
+            return 1;
+        }
+    }
+    if ( ev1 != ev2 ) {
+        cerr << "Processed " << ev1 << " events (scheduler) and "
+             << ev2 << " (direct)" << endl;
+        return 1;
+    }
+    cout << "Last departure at " << scheduled[ numJobs-1 ] << ", "
+         << ev1 << " events" << endl;
+    return 0;
+}